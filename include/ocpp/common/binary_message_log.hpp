@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_BINARY_MESSAGE_LOG_HPP
+#define OCPP_COMMON_BINARY_MESSAGE_LOG_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+
+#include <date/tz.h>
+
+namespace ocpp {
+
+/// \brief Identifies a binary message log, followed by the version of its format
+constexpr char BINARY_MESSAGE_LOG_MAGIC[] = "OCPPBLG";
+constexpr std::uint8_t BINARY_MESSAGE_LOG_VERSION = 1;
+
+/// \brief A message as it is stored in a binary message log
+struct BinaryLogRecord {
+    std::chrono::time_point<date::utc_clock> timestamp; ///< When the message was logged
+    std::uint8_t typ; ///< 0 for ChargePoint, 1 for CentralSystem and 2 for SYS messages
+    std::string message_type; ///< The message type the message was logged with, the text of a SYS message
+    std::string message;      ///< The message exactly as it was sent or received, empty for SYS messages
+};
+
+/// \brief Writes the header that starts a binary message log to the given stream \p os
+void write_binary_log_header(std::ostream& os);
+
+/// \brief Appends the given \p record to the binary message log in \p os. A record is its length as a little endian
+/// uint32, the timestamp in nanoseconds as a little endian int64, the typ as a byte, the length of the message type as
+/// a little endian uint16, the message type and the message. The message is not parsed or reformatted
+/// \returns the number of bytes written
+size_t write_binary_log_record(std::ostream& os, const BinaryLogRecord& record);
+
+/// \brief Reads the header of a binary message log from the given stream \p is
+/// \returns true if \p is starts with a binary message log of a supported version
+bool read_binary_log_header(std::istream& is);
+
+/// \brief Reads the next record of the binary message log in \p is
+/// \returns the record or std::nullopt if the end of the log has been reached
+/// \throws std::runtime_error if the log ends within a record or the record is malformed, e.g. because the process
+/// that wrote it was killed
+std::optional<BinaryLogRecord> read_binary_log_record(std::istream& is);
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_BINARY_MESSAGE_LOG_HPP
@@ -14,6 +14,7 @@
 #include <string>
 
 #include <ocpp/common/cistring.hpp>
+#include <ocpp/common/json_writer.hpp>
 
 using json = nlohmann::json;
 
@@ -76,6 +77,16 @@ template <class T> struct Call {
         j.push_back(json(c.msg));
     }
 
+    /// \brief Writes the given Call message \p c to the given \p writer without building a json object
+    friend void write_json(JsonWriter& writer, const Call& c) {
+        writer.start_array();
+        writer.value(static_cast<int>(MessageTypeId::CALL));
+        writer.value(c.uniqueId);
+        writer.value(c.msg.get_type());
+        writer.value(c.msg);
+        writer.end_array();
+    }
+
     /// \brief Conversion from a given json object \p j to a given Call message \p c
     friend void from_json(const json& j, Call& c) {
         // the required parts of the message
@@ -114,6 +125,15 @@ template <class T> struct CallResult {
         j.push_back(json(c.msg));
     }
 
+    /// \brief Writes the given CallResult message \p c to the given \p writer without building a json object
+    friend void write_json(JsonWriter& writer, const CallResult& c) {
+        writer.start_array();
+        writer.value(static_cast<int>(MessageTypeId::CALLRESULT));
+        writer.value(c.uniqueId);
+        writer.value(c.msg);
+        writer.end_array();
+    }
+
     /// \brief Conversion from a given json object \p j to a given CallResult message \p c
     friend void from_json(const json& j, CallResult& c) {
         // the required parts of the message
@@ -151,6 +171,9 @@ void to_json(json& j, const CallError& c);
 /// \brief Conversion from a given json object \p j to a given CallError message \p c
 void from_json(const json& j, CallError& c);
 
+/// \brief Writes the given CallError message \p c to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CallError& c);
+
 /// \brief Writes the given case CallError \p c to the given output stream \p os
 /// \returns an output stream with the CallError written to
 std::ostream& operator<<(std::ostream& os, const CallError& c);
@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <chrono>
 #include <mutex>
+#include <optional>
 #include <sqlite3.h>
+#include <string>
+#include <vector>
 
 #include <ocpp/common/support_older_cpp_versions.hpp>
 
@@ -12,6 +16,52 @@
 
 namespace ocpp::common {
 
+/// \brief SQLite journal modes, see https://www.sqlite.org/pragma.html#pragma_journal_mode
+enum class JournalMode {
+    Delete,
+    Truncate,
+    Persist,
+    Memory,
+    WAL,
+    Off
+};
+
+/// \brief SQLite synchronous levels, see https://www.sqlite.org/pragma.html#pragma_synchronous
+enum class SynchronousMode {
+    Off,
+    Normal,
+    Full,
+    Extra
+};
+
+/// \brief Tuning options that are applied to every database connection when it is opened. Options that are not set
+/// keep the SQLite defaults.
+struct DatabaseTuning {
+    std::optional<JournalMode> journal_mode;
+    std::optional<SynchronousMode> synchronous;
+    /// \brief Maximum number of bytes of the database file that are memory mapped, 0 disables memory mapped I/O
+    std::optional<int64_t> mmap_size;
+    /// \brief Page cache size with the semantics of PRAGMA cache_size: positive values are a number of pages,
+    /// negative values an amount of KiB
+    std::optional<int64_t> cache_size;
+    /// \brief Time a statement waits for a lock held by another connection before it fails with SQLITE_BUSY
+    std::optional<std::chrono::milliseconds> busy_timeout;
+
+    /// \brief Preset for databases holding transaction critical data like transactions and the message queue: WAL
+    /// journal with a full sync on every commit, so no committed data is lost on power loss while commits no longer
+    /// need to sync the rollback journal and the database file.
+    static DatabaseTuning durable();
+
+    /// \brief Preset for databases holding data that can be rebuilt, or for deployments that accept losing the latest
+    /// commits on power loss: WAL journal that is only synced at checkpoints, a larger page cache and memory mapped
+    /// I/O. The database never gets corrupted.
+    static DatabaseTuning fast();
+
+    /// \brief Returns the preset with the given \p name, "Durable" or "Fast"
+    /// \throws std::out_of_range if there is no preset with this name
+    static DatabaseTuning from_preset(const std::string& name);
+};
+
 /// \brief Helper class for transactions. Will lock the database interface from new transaction until commit() or
 /// rollback() is called or the object destroyed
 class DatabaseTransactionInterface {
@@ -47,6 +97,11 @@ public:
     /// \note Will throw an std::runtime_error if the statement can't be prepared
     virtual std::unique_ptr<SQLiteStatementInterface> new_statement(const std::string& sql) = 0;
 
+    /// \brief Prepares the given \p statements ahead of time so that a later new_statement() with the same SQL text
+    /// does not need to compile it anymore.
+    /// \note Will throw an std::runtime_error if one of the statements can't be prepared
+    virtual void prepare_statements(const std::vector<std::string>& statements) = 0;
+
     /// \brief Returns the latest error message from sqlite3.
     virtual const char* get_error_message() = 0;
 
@@ -63,17 +118,33 @@ public:
     virtual uint32_t get_user_version() = 0;
 };
 
+/// \brief Default number of idle prepared statements that are kept per connection
+constexpr std::size_t DEFAULT_STATEMENT_CACHE_SIZE = 64;
+
 class DatabaseConnection : public DatabaseConnectionInterface {
 private:
     sqlite3* db;
     const fs::path database_file_path;
     std::atomic_uint32_t open_count;
     std::timed_mutex transaction_mutex;
+    const std::size_t statement_cache_size;
+    std::shared_ptr<SQLiteStatementCache> statement_cache;
+    const DatabaseTuning tuning;
 
     bool close_connection_internal(bool force_close);
 
+    /// \brief Applies the configured \p tuning to the opened connection
+    void apply_tuning();
+
 public:
-    explicit DatabaseConnection(const fs::path& database_file_path) noexcept;
+    /// \brief Creates a connection to the database at \p database_file_path
+    /// \param database_file_path
+    /// \param tuning PRAGMAs that are applied when the connection is opened, defaults to DatabaseTuning::durable()
+    /// \param statement_cache_size Maximum number of idle prepared statements that are kept for reuse by
+    /// new_statement(). 0 disables the cache and every statement is prepared and finalized on its own.
+    explicit DatabaseConnection(const fs::path& database_file_path,
+                                const DatabaseTuning& tuning = DatabaseTuning::durable(),
+                                std::size_t statement_cache_size = DEFAULT_STATEMENT_CACHE_SIZE) noexcept;
 
     virtual ~DatabaseConnection();
 
@@ -84,6 +155,7 @@ public:
 
     bool execute_statement(const std::string& statement) override;
     std::unique_ptr<SQLiteStatementInterface> new_statement(const std::string& sql) override;
+    void prepare_statements(const std::vector<std::string>& statements) override;
 
     const char* get_error_message() override;
 
@@ -19,6 +19,8 @@ struct DBTransactionMessage {
     int32_t message_attempts;
     DateTime timestamp;
     std::string unique_id;
+    // if not empty, this json text is stored instead of json_message, so that it does not have to be serialized again
+    std::string serialized_json_message{};
 };
 
 class DatabaseHandlerCommon {
@@ -30,6 +32,10 @@ protected:
     /// \brief Perform the initialization needed to use the database. Will be called by open_connection()
     virtual void init_sql() = 0;
 
+    /// \brief Returns the SQL statements that are used frequently. They are prepared once by open_connection() so
+    /// that they don't need to be compiled on every use. Derived handlers can extend this list.
+    virtual std::vector<std::string> get_hot_statements();
+
 public:
     /// \brief Common database handler class
     /// Class handles some common database functionality like inserting and removing transaction messages.
@@ -67,6 +73,13 @@ public:
     virtual void remove_message_queue_message(const std::string& unique_id,
                                               const QueueType queue_type = QueueType::Transaction);
 
+    /// \brief Inserts and removes messages of the message queue tables within a single database transaction.
+    /// Inserts are performed before removals.
+    /// \param inserts Messages to insert together with the queue type of the table they are inserted into
+    /// \param removals Unique ids of messages to remove together with the queue type of the table they are removed from
+    virtual void update_message_queue(const std::vector<std::pair<DBTransactionMessage, QueueType>>& inserts,
+                                      const std::vector<std::pair<std::string, QueueType>>& removals);
+
     /// \brief Deletes all entries from message queue table specified by \p queue_type
     /// \param queue_type , defaults to QueueType::Transaction
     virtual void clear_message_queue(const QueueType queue_type = QueueType::Transaction);
@@ -4,7 +4,10 @@
 #ifndef SQLITE_STATEMENT_HPP
 #define SQLITE_STATEMENT_HPP
 
+#include <memory>
+#include <mutex>
 #include <sqlite3.h>
+#include <unordered_map>
 
 #include <everest/logging.hpp>
 #include <ocpp/common/types.hpp>
@@ -48,14 +51,22 @@ public:
     virtual double column_double(const int idx) = 0;
 };
 
+class SQLiteStatementCache;
+
 /// \brief RAII wrapper class that handles finalization, step, binding and column access of sqlite3_stmt
 class SQLiteStatement : public SQLiteStatementInterface {
 private:
     sqlite3_stmt* stmt;
     sqlite3* db;
+    /// \brief Cache the statement is handed back to on destruction instead of being finalized, if set
+    std::weak_ptr<SQLiteStatementCache> cache;
+    std::string query;
 
 public:
     SQLiteStatement(sqlite3* db, const std::string& query);
+    /// \brief Wraps the already prepared \p stmt for \p query that will be given back to \p cache on destruction
+    SQLiteStatement(sqlite3* db, sqlite3_stmt* stmt, const std::string& query,
+                    std::weak_ptr<SQLiteStatementCache> cache);
     ~SQLiteStatement();
 
     int step() override;
@@ -83,6 +94,35 @@ public:
     double column_double(const int idx) override;
 };
 
+/// \brief Per connection cache of prepared sqlite3_stmt that are currently not in use, keyed by their SQL text.
+/// Statements are reset and their bindings are cleared before they are put back into the cache, so every
+/// SQLiteStatement handed out by get_statement() can be used as if it was freshly prepared.
+class SQLiteStatementCache : public std::enable_shared_from_this<SQLiteStatementCache> {
+private:
+    sqlite3* db;
+    const std::size_t max_size;
+    std::mutex statements_mutex;
+    std::unordered_multimap<std::string, sqlite3_stmt*> statements;
+
+public:
+    /// \brief Creates a cache for the connection \p db that holds at most \p max_size idle statements
+    SQLiteStatementCache(sqlite3* db, std::size_t max_size);
+
+    /// \brief Finalizes all idle statements of the cache
+    ~SQLiteStatementCache();
+
+    /// \brief Returns a statement for \p query, taken from the cache if available or prepared otherwise
+    /// \note Will throw a QueryExecutionException if the statement can't be prepared
+    std::unique_ptr<SQLiteStatement> get_statement(const std::string& query);
+
+    /// \brief Prepares \p query ahead of time and puts it into the cache if no idle statement for it exists yet
+    /// \note Will throw a QueryExecutionException if the statement can't be prepared
+    void prepare_statement(const std::string& query);
+
+    /// \brief Resets \p stmt and puts it back into the cache, finalizes it if the cache is full
+    void release_statement(const std::string& query, sqlite3_stmt* stmt);
+};
+
 } // namespace ocpp::common
 
 #endif // DEVICE_MODEL_STORAGE_SQLITE_HPP
@@ -0,0 +1,131 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_JSON_WRITER_HPP
+#define OCPP_COMMON_JSON_WRITER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include <ocpp/common/cistring.hpp>
+
+using json = nlohmann::json;
+
+namespace ocpp {
+
+/// \brief Writes compact json text directly into an output buffer without building a json object first.
+///
+/// The buffer is kept between messages when the writer is clear()ed, so a long living writer does not allocate once
+/// its buffer has grown to the size of the largest message. Values are written with value() and members of objects
+/// with member(). Types without a dedicated overload are written with a write_json(JsonWriter&, const T&) function
+/// that is found by argument dependent lookup, as generated for all OCPP types and messages. Types that only provide a
+/// to_json function are converted to json and dumped as a fallback. Like json::dump(), strings that are not valid UTF-8
+/// are rejected with a json::type_error.
+///
+/// A writer can keep headroom in front of the json text, e.g. for the frame header of a transport. This allows to
+/// hand the released buffer to the transport without copying the text into another buffer first.
+class JsonWriter {
+private:
+    std::string buffer;
+    size_t headroom = 0;
+    bool needs_separator = false;
+
+    void separate();
+    void append_string(std::string_view value);
+    void append_integer(int64_t value);
+    void append_unsigned(uint64_t value);
+    void append_floating_point(double value);
+    void append_bool(bool value);
+
+public:
+    /// \brief Creates a new JsonWriter with an empty buffer
+    JsonWriter() = default;
+
+    /// \brief Creates a new JsonWriter that reserves \p capacity bytes in its buffer
+    explicit JsonWriter(size_t capacity);
+
+    /// \brief Creates a new JsonWriter that writes into the given \p buffer, reusing its allocation. The json text is
+    /// written after \p headroom bytes that are left to the user of the buffer
+    JsonWriter(std::string&& buffer, size_t headroom);
+
+    /// \brief Removes the written text, the allocated buffer is kept for the next message
+    void clear();
+
+    /// \brief Provides the written json text. Only valid for writers without headroom, see text()
+    const std::string& str() const;
+
+    /// \brief Provides the written json text without the headroom
+    std::string_view text() const;
+
+    /// \brief Provides the number of bytes in front of the json text
+    size_t get_headroom() const;
+
+    /// \brief Moves the buffer out of the writer, it starts with the headroom followed by the written json text. The
+    /// writer is empty afterwards
+    std::string release();
+
+    void start_object();
+    void end_object();
+    void start_array();
+    void end_array();
+
+    /// \brief Writes the key \p name of the next object member
+    void key(std::string_view name);
+
+    /// \brief Writes a json null value
+    void null();
+
+    /// \brief Writes already serialized json \p text as the next value
+    void raw(std::string_view text);
+
+    /// \brief Writes the given \p value as the next json value
+    template <typename T> void value(const T& value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            this->append_bool(value);
+        } else if constexpr (std::is_integral_v<T> and std::is_signed_v<T>) {
+            this->append_integer(value);
+        } else if constexpr (std::is_integral_v<T>) {
+            this->append_unsigned(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            this->append_floating_point(value);
+        } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+            this->append_string(value);
+        } else {
+            write_json(*this, value);
+        }
+    }
+
+    /// \brief Writes the elements of the given \p values as json array
+    template <typename T> void value(const std::vector<T>& values) {
+        this->start_array();
+        for (const auto& element : values) {
+            this->value(element);
+        }
+        this->end_array();
+    }
+
+    /// \brief Writes an object member with the given \p name and \p value
+    template <typename T> void member(std::string_view name, const T& value) {
+        this->key(name);
+        this->value(value);
+    }
+};
+
+/// \brief Writes the given CiString \p k to the given \p writer as json string
+template <size_t L> void write_json(JsonWriter& writer, const CiString<L>& k) {
+    writer.value(k.view());
+}
+
+/// \brief Writes the given json object \p k to the given \p writer. This is also the fallback for types that only
+/// provide a to_json function
+void write_json(JsonWriter& writer, const json& k);
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_JSON_WRITER_HPP
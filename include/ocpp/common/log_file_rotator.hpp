@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_LOG_FILE_ROTATOR_HPP
+#define OCPP_COMMON_LOG_FILE_ROTATOR_HPP
+
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <string>
+#include <utility>
+
+namespace ocpp {
+
+/// Configuration for log rotation
+struct LogRotationConfig {
+    bool date_suffix; ///< If set to true the log rotation files use a date after the ".", if not use an increasing
+                      ///< .0, .1 ... index
+    uint64_t
+        maximum_file_size_bytes; ///< The maximum size of the log file in bytes after which the file will be rotated
+    uint64_t maximum_file_count; ///< The maximum number of log files to keep in rotation
+    bool compress;               ///< If set to true rotated files are gzip compressed in the background
+
+    LogRotationConfig(bool date_suffix, uint64_t maximum_file_size_bytes, uint64_t maximum_file_count,
+                      bool compress = false) :
+        date_suffix(date_suffix),
+        maximum_file_size_bytes(maximum_file_size_bytes),
+        maximum_file_count(maximum_file_count),
+        compress(compress) {
+    }
+};
+
+/// \brief Rotates a single log file. The size of the file is tracked in memory and the rotated files are kept in a
+/// list, so that the directory is only listed once on construction and a rotation is a single rename plus the removal
+/// of the oldest file
+class LogFileRotator {
+private:
+    std::filesystem::path file;
+    LogRotationConfig config;
+    std::uintmax_t current_size;
+    /// The rotated files from oldest to newest, without the extension of the compressed file
+    std::deque<std::filesystem::path> rotated_files;
+    uint64_t next_index;
+    /// The date of the last rotation with a date suffix and the sequence number of its last rotated file
+    std::string last_date;
+    uint64_t date_sequence;
+    /// The rotated files that are being compressed in the background
+    std::deque<std::pair<std::filesystem::path, std::future<void>>> compressions;
+
+    /// \brief Collects the rotated files of a previous run
+    void scan();
+
+    /// \brief Removes the oldest rotated file, compressed or not
+    void remove_oldest();
+
+    /// \brief Forgets the compressions that have finished, without waiting for the others
+    void collect_compressions();
+
+    /// \brief Waits until the given rotated \p path has been compressed, if it is being compressed
+    void wait_for_compression(const std::filesystem::path& path);
+
+    /// \returns the path the current file is renamed to by the next rotation, a path that is not used by another
+    /// rotated file
+    std::filesystem::path next_rotated_file();
+
+    /// \brief Compresses the given \p path to a .gz file next to it and removes \p path afterwards
+    static void compress_file(const std::filesystem::path& path);
+
+public:
+    /// \brief Creates a rotator for the given \p file with the provided \p config
+    LogFileRotator(const std::filesystem::path& file, const LogRotationConfig& config);
+
+    /// \brief Waits for the compressions that are still running
+    ~LogFileRotator();
+
+    /// \returns the rotated file
+    const std::filesystem::path& get_file() const;
+
+    /// \brief Adds the given number of \p bytes written to the file to its size
+    void add_written(std::uintmax_t bytes);
+
+    /// \returns true if the file has reached its maximum size
+    bool rotation_needed() const;
+
+    /// \brief Renames the file to the next rotated file and removes the oldest rotated file if there are more files
+    /// than the maximum. The file must have been closed before and is reopened afterwards. The rotated file is
+    /// compressed in the background, the rotation only waits for a compression if it removes the file being compressed
+    void rotate();
+};
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_LOG_FILE_ROTATOR_HPP
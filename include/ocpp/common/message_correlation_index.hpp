@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_COMMON_MESSAGE_CORRELATION_INDEX_HPP
+#define OCPP_COMMON_MESSAGE_CORRELATION_INDEX_HPP
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ocpp {
+
+/// \brief Response time percentiles of an action
+struct ResponseTimeStats {
+    size_t count;                  ///< Number of responses the percentiles are calculated from
+    std::chrono::milliseconds p50; ///< Median response time
+    std::chrono::milliseconds p90; ///< 90th percentile of the response time
+    std::chrono::milliseconds p99; ///< 99th percentile of the response time
+    std::chrono::milliseconds max; ///< Longest response time
+};
+
+/// \brief Correlates the responses of OCPP messages with their CALLs. The number of pending CALLs is bounded and CALLs
+/// that have not been answered within the maximum age are dropped, so that unanswered CALLs don't accumulate. The
+/// response times of the CALLs sent by the charge point are recorded per action. The times are taken from the steady
+/// clock, so that an adjustment of the system clock does not distort them
+class MessageCorrelationIndex {
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    /// \brief Default maximum number of pending CALLs
+    static constexpr size_t DEFAULT_MAXIMUM_ENTRIES = 1024;
+    /// \brief Default time after which an unanswered CALL is dropped
+    static constexpr std::chrono::seconds DEFAULT_MAXIMUM_AGE{600};
+    /// \brief Number of the most recent response times per action the percentiles are calculated from
+    static constexpr size_t RESPONSE_TIME_SAMPLES = 256;
+
+    /// \brief Creates a new index that keeps at most \p maximum_entries pending CALLs for at most \p maximum_age
+    explicit MessageCorrelationIndex(size_t maximum_entries = DEFAULT_MAXIMUM_ENTRIES,
+                                     std::chrono::seconds maximum_age = DEFAULT_MAXIMUM_AGE);
+
+    /// \brief Adds the CALL with the given \p message_id and \p action that has been logged at \p timestamp, replaces
+    /// a pending CALL with the same id that has been sent in the same direction
+    void add_call(const std::string& message_id, const std::string& action, bool sent_by_charge_point,
+                  TimePoint timestamp);
+
+    /// \brief Removes the CALL that a CALLRESULT or CALLERROR with the given \p message_id logged at \p timestamp
+    /// answers and records its response time. A response only answers a CALL of the other side, so a response that is
+    /// \p sent_by_charge_point answers a CALL of the CSMS, even if the charge point has a pending CALL with the same id
+    /// \returns the action of the CALL or std::nullopt if there is no pending CALL with this id
+    std::optional<std::string> take_call(const std::string& message_id, bool sent_by_charge_point,
+                                         TimePoint timestamp);
+
+    /// \returns the number of pending CALLs
+    size_t size() const;
+
+    /// \returns the response time percentiles of the CALLs sent by the charge point per action
+    std::map<std::string, ResponseTimeStats> get_response_time_stats() const;
+
+private:
+    struct PendingCall {
+        std::string message_id;
+        std::string action;
+        bool sent_by_charge_point;
+        TimePoint timestamp;
+    };
+
+    /// \brief The most recent response times of an action, RESPONSE_TIME_SAMPLES at most
+    struct ResponseTimes {
+        std::vector<std::chrono::milliseconds> samples;
+        size_t next = 0;
+    };
+
+    size_t maximum_entries;
+    std::chrono::seconds maximum_age;
+    /// Pending CALLs from oldest to newest
+    std::list<PendingCall> calls;
+    /// The pending CALLs by their id, the CALLs of the CSMS at index 0 and those of the charge point at index 1. Both
+    /// sides choose their ids independently, so the same id can be pending in both directions
+    std::array<std::unordered_map<std::string, std::list<PendingCall>::iterator>, 2> calls_by_id;
+    std::map<std::string, ResponseTimes> response_times;
+
+    /// \brief Drops the CALLs that are older than the maximum age at \p now and the oldest CALLs above the maximum
+    /// number of entries
+    void expire(TimePoint now);
+
+    void erase(std::list<PendingCall>::iterator it);
+};
+
+} // namespace ocpp
+
+#endif // OCPP_COMMON_MESSAGE_CORRELATION_INDEX_HPP
@@ -3,14 +3,20 @@
 #ifndef OCPP_COMMON_MESSAGE_QUEUE_HPP
 #define OCPP_COMMON_MESSAGE_QUEUE_HPP
 
+#include <algorithm>
 #include <chrono>
 #include <condition_variable>
 #include <deque>
 #include <future>
+#include <list>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <set>
+#include <string>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
@@ -20,7 +26,10 @@
 
 #include <ocpp/common/call_types.hpp>
 #include <ocpp/common/database/database_handler_common.hpp>
+#include <ocpp/common/json_writer.hpp>
+#include <ocpp/common/mpsc_ring_buffer.hpp>
 #include <ocpp/common/types.hpp>
+#include <ocpp/v16/messages/MeterValues.hpp>
 #include <ocpp/v16/messages/StopTransaction.hpp>
 #include <ocpp/v16/types.hpp>
 #include <ocpp/v201/messages/TransactionEvent.hpp>
@@ -47,6 +56,22 @@ template <typename M> struct MessageQueueConfig {
         60; // interval for BootNotification.req in case response by CSMS is CALLERROR or CSMS does not respond at all
             // (within specified MessageTimeout)
 
+    // maximum time in milliseconds a persisted message queue update may be held back in order to commit it together
+    // with other updates in a single database transaction. 0 disables grouping, every update is written immediately
+    int queue_db_flush_interval_ms = 0;
+    // number of pending persisted message queue updates that triggers a commit before queue_db_flush_interval_ms passed
+    int queue_db_flush_max_operations = 100;
+
+    // maximum number of CALLs that are kept in flight while replaying a backlog of queued messages after a reconnect.
+    // Messages belonging to the same transaction are still delivered strictly one after another. 1 disables the
+    // pipelined replay, so that only one CALL is outstanding at any time as required by OCPP
+    int replay_window = 1;
+
+    // capacity of the lock-free ring that push() writes to, so that producers do not wait for the worker while it is
+    // sending a message. The worker moves the messages into the queues. 0 disables the ring, push() then adds the
+    // message to the queues directly
+    int ingress_ring_capacity = 0;
+
     /// \brief Returns true if the given \p message_type shall be queued based on the configuration of
     /// queue_all_messages and message_types_discard_for_queueing
     bool check_queue(const M& message_type) {
@@ -62,11 +87,33 @@ template <typename M> struct EnhancedMessage {
     M messageType = M::InternalError; ///< The OCPP message type
     MessageTypeId messageTypeId;      ///< The OCPP message type ID (CALL/CALLRESULT/CALLERROR)
     json call_message;    ///< If the message is a CALLRESULT or CALLERROR this can contain the original CALL message
+    std::shared_ptr<const std::string> call_message_text; ///< If the original CALL of a CALLRESULT was sent as json
+                                                          ///< text, this contains the text and call_message is empty
     bool offline = false; ///< A flag indicating if the connection to the central system is offline
+
+    /// \brief Provides the original CALL of a CALLRESULT or CALLERROR. A CALL that is only available as json text is
+    /// parsed on every call, so response handlers that do not need the CALL do not pay for it
+    /// \returns the original CALL as json or an empty json if it is not available
+    json get_call_message() const {
+        if (this->call_message_text != nullptr) {
+            return json::parse(*this->call_message_text);
+        }
+        return this->call_message;
+    }
 };
 
 /// \brief This contains an internal control message
 template <typename M> struct ControlMessage {
+    /// \brief Contains a CALL that has been written to json text directly and the information about it that the queue
+    /// needs, so that the message does not have to be parsed unless it is modified
+    struct Serialized {
+        std::string text;                          ///< The OCPP message as json text
+        MessageId unique_id;                       ///< The unique ID of the message
+        std::string action;                        ///< The action of the CALL
+        std::optional<std::string> transaction_id; ///< The id of the transaction the message belongs to
+        bool transaction_update_message = false;   ///< True for transactional messages containing updates
+    };
+
     json::array_t message;    ///< The OCPP message as a json array
     M messageType;            ///< The OCPP message type
     int32_t message_attempts; ///< The number of times this message has been rejected by the central system
@@ -74,18 +121,60 @@ template <typename M> struct ControlMessage {
     DateTime timestamp;                       ///< A timestamp that shows when this message can be sent
     MessageId initial_unique_id;
     bool stall_until_accepted; // if true, message shall be sent only if registration status is accepted
+    // the message as json text as long as it has not been parsed, message is empty then
+    std::optional<Serialized> serialized;
 
     /// \brief Creates a new ControlMessage object from the provided \p message
     explicit ControlMessage(const json& message, const bool stall_until_accepted = false);
 
+    /// \brief Creates a new ControlMessage object from the provided \p serialized message of the given \p message_type
+    ControlMessage(Serialized serialized, const M message_type, const bool stall_until_accepted = false) :
+        messageType(message_type),
+        message_attempts(0),
+        initial_unique_id(serialized.unique_id),
+        stall_until_accepted(stall_until_accepted),
+        serialized(std::move(serialized)) {
+    }
+
     /// \brief Provides the unique message ID stored in the message
     /// \returns the unique ID of the contained message
     [[nodiscard]] MessageId uniqueId() const {
+        if (this->serialized.has_value()) {
+            return this->serialized->unique_id;
+        }
         return this->message[MESSAGE_ID];
     }
 
+    /// \brief Provides the action of the contained CALL
+    [[nodiscard]] std::string_view action() const {
+        if (this->serialized.has_value()) {
+            return this->serialized->action;
+        }
+        return this->message.at(CALL_ACTION).template get_ref<const std::string&>();
+    }
+
+    /// \brief Provides the message as json array, a serialized message is parsed on first use. The returned message
+    /// can be modified, the serialized text is discarded therefore
+    /// \returns the contained message as json array
+    json::array_t& json_message() {
+        if (this->serialized.has_value()) {
+            this->message = json::parse(this->serialized->text).template get<json::array_t>();
+            this->serialized.reset();
+        }
+        return this->message;
+    }
+
     /// \brief True for transactional messages containing updates (measurements) for a transaction
     bool is_transaction_update_message() const;
+
+    /// \brief Provides the id of the transaction the message belongs to
+    /// \returns the transaction id or std::nullopt if the message does not refer to a (known) transaction
+    std::optional<std::string> transaction_id() const;
+
+    /// \brief Provides the key of the group of messages that have to be delivered strictly in order during a pipelined
+    /// replay, e.g. all messages of the same transaction
+    /// \returns the ordering key or std::nullopt if the message must not be pipelined at all
+    std::optional<std::string> replay_ordering_key() const;
 };
 
 /// \brief Indicates the transmission priority of a message that is being pushed to the message queue
@@ -164,6 +253,199 @@ bool allowed_to_send_message(const ControlMessage<M>& message, const DateTime& t
     return true;
 }
 
+/// \brief FIFO queue of ControlMessage objects that is additionally indexed by unique id, transaction id and message
+/// type, so that lookups do not need to scan the whole queue
+template <typename M> class IndexedMessageQueue {
+public:
+    using iterator = typename std::list<std::shared_ptr<ControlMessage<M>>>::const_iterator;
+
+private:
+    struct IndexEntry {
+        int64_t position; ///< Position in the queue, only used to order the entries
+        std::string unique_id;
+        std::optional<std::string> transaction_id;
+        M message_type;
+        bool is_transaction_update_message;
+    };
+
+    std::list<std::shared_ptr<ControlMessage<M>>> messages;
+    std::unordered_map<const ControlMessage<M>*, IndexEntry> entries;
+    std::unordered_map<std::string, iterator> by_unique_id;
+    std::unordered_map<std::string, std::map<M, size_t>> by_transaction_id;
+    std::map<M, size_t> by_message_type;
+    std::map<int64_t, iterator> transaction_update_messages;
+    int64_t front_position = 0;
+    int64_t back_position = 0;
+
+    void add_to_index(iterator it, const int64_t position) {
+        const auto& message = *it;
+        IndexEntry entry{position, message->uniqueId().get(), message->transaction_id(), message->messageType,
+                         message->is_transaction_update_message()};
+        this->by_unique_id[entry.unique_id] = it;
+        if (entry.transaction_id.has_value()) {
+            this->by_transaction_id[entry.transaction_id.value()][entry.message_type]++;
+        }
+        this->by_message_type[entry.message_type]++;
+        if (entry.is_transaction_update_message) {
+            this->transaction_update_messages[position] = it;
+        }
+        this->entries[message.get()] = std::move(entry);
+    }
+
+    void remove_from_index(iterator it) {
+        auto entry_it = this->entries.find(it->get());
+        if (entry_it == this->entries.end()) {
+            return;
+        }
+        const auto& entry = entry_it->second;
+        auto unique_id_it = this->by_unique_id.find(entry.unique_id);
+        if (unique_id_it != this->by_unique_id.end() and unique_id_it->second == it) {
+            this->by_unique_id.erase(unique_id_it);
+        }
+        if (entry.transaction_id.has_value()) {
+            auto transaction_it = this->by_transaction_id.find(entry.transaction_id.value());
+            if (transaction_it != this->by_transaction_id.end() and --transaction_it->second[entry.message_type] == 0) {
+                transaction_it->second.erase(entry.message_type);
+                if (transaction_it->second.empty()) {
+                    this->by_transaction_id.erase(transaction_it);
+                }
+            }
+        }
+        if (--this->by_message_type[entry.message_type] == 0) {
+            this->by_message_type.erase(entry.message_type);
+        }
+        if (entry.is_transaction_update_message) {
+            this->transaction_update_messages.erase(entry.position);
+        }
+        this->entries.erase(entry_it);
+    }
+
+public:
+    bool empty() const {
+        return this->messages.empty();
+    }
+
+    size_t size() const {
+        return this->messages.size();
+    }
+
+    iterator begin() const {
+        return this->messages.cbegin();
+    }
+
+    iterator end() const {
+        return this->messages.cend();
+    }
+
+    const std::shared_ptr<ControlMessage<M>>& front() const {
+        return this->messages.front();
+    }
+
+    void push_back(const std::shared_ptr<ControlMessage<M>>& message) {
+        this->messages.push_back(message);
+        this->add_to_index(std::prev(this->messages.cend()), this->back_position++);
+    }
+
+    void push_front(const std::shared_ptr<ControlMessage<M>>& message) {
+        this->messages.push_front(message);
+        this->add_to_index(this->messages.cbegin(), --this->front_position);
+    }
+
+    void pop_front() {
+        this->erase(this->messages.cbegin());
+    }
+
+    /// \brief Removes the message at \p it from the queue
+    /// \returns iterator following the removed message
+    iterator erase(iterator it) {
+        this->remove_from_index(it);
+        return this->messages.erase(it);
+    }
+
+    /// \brief Updates the index of the message at \p it. Has to be called after the message has been modified in a way
+    /// that changes its unique id or transaction id
+    void reindex(iterator it) {
+        const auto position = this->entries.at(it->get()).position;
+        this->remove_from_index(it);
+        this->add_to_index(it, position);
+    }
+
+    /// \returns iterator to the message with the given \p unique_id or end() if it is not queued
+    iterator find(const std::string& unique_id) const {
+        const auto it = this->by_unique_id.find(unique_id);
+        if (it == this->by_unique_id.end()) {
+            return this->end();
+        }
+        return it->second;
+    }
+
+    /// \returns true if a message of the transaction with the given \p transaction_id is queued
+    bool contains_transaction(const std::string& transaction_id) const {
+        return this->by_transaction_id.count(transaction_id) > 0;
+    }
+
+    /// \returns the number of queued messages of the given \p message_type that belong to the transaction with the
+    /// given \p transaction_id
+    size_t count(const std::string& transaction_id, const M message_type) const {
+        const auto transaction_it = this->by_transaction_id.find(transaction_id);
+        if (transaction_it == this->by_transaction_id.end()) {
+            return 0;
+        }
+        const auto type_it = transaction_it->second.find(message_type);
+        return type_it != transaction_it->second.end() ? type_it->second : 0;
+    }
+
+    /// \returns the number of queued messages of the given \p message_type
+    size_t count(const M message_type) const {
+        const auto it = this->by_message_type.find(message_type);
+        return it != this->by_message_type.end() ? it->second : 0;
+    }
+
+    /// \returns iterators to all queued transaction update messages in queue order
+    std::vector<iterator> get_transaction_update_messages() const {
+        std::vector<iterator> result;
+        result.reserve(this->transaction_update_messages.size());
+        for (const auto& [position, it] : this->transaction_update_messages) {
+            result.push_back(it);
+        }
+        return result;
+    }
+};
+
+/// \brief Provides the id of the transaction the given \p request belongs to without serializing it
+/// \returns the transaction id or std::nullopt if the request does not refer to a (known) transaction
+template <typename T> std::optional<std::string> get_transaction_id(const T& request) {
+    return std::nullopt;
+}
+
+inline std::optional<std::string> get_transaction_id(const v16::StopTransactionRequest& request) {
+    return std::to_string(request.transactionId);
+}
+
+inline std::optional<std::string> get_transaction_id(const v16::MeterValuesRequest& request) {
+    if (request.transactionId.has_value()) {
+        return std::to_string(request.transactionId.value());
+    }
+    return std::nullopt;
+}
+
+inline std::optional<std::string> get_transaction_id(const v201::TransactionEventRequest& request) {
+    return request.transactionInfo.transactionId.get();
+}
+
+/// \brief Indicates if the given \p request contains updates (measurements) for a transaction
+template <typename T> bool is_transaction_update_request(const T& request) {
+    return false;
+}
+
+inline bool is_transaction_update_request(const v16::MeterValuesRequest& request) {
+    return true;
+}
+
+inline bool is_transaction_update_request(const v201::TransactionEventRequest& request) {
+    return request.eventType == v201::TransactionEventEnum::Updated;
+}
+
 /// \brief contains a message queue that makes sure that OCPPs synchronicity requirements are met
 template <typename M> class MessageQueue {
 private:
@@ -172,13 +454,33 @@ private:
 
     std::thread worker_thread;
     /// message deque for transaction related messages
-    std::deque<std::shared_ptr<ControlMessage<M>>> transaction_message_queue;
+    IndexedMessageQueue<M> transaction_message_queue;
     /// message queue for non-transaction related messages
-    std::deque<std::shared_ptr<ControlMessage<M>>> normal_message_queue;
+    IndexedMessageQueue<M> normal_message_queue;
     std::shared_ptr<ControlMessage<M>> in_flight;
+    std::unique_ptr<MpscRingBuffer<std::shared_ptr<ControlMessage<M>>>> ingress;
+    // held by producers of the ingress ring while notifying and by the worker from checking the ring until it waits,
+    // so that no wakeup is lost without producers having to wait for message_mutex
+    std::mutex ingress_mutex;
     std::recursive_mutex message_mutex;
     std::condition_variable_any cv;
     std::function<bool(json message)> send_callback;
+    // if set, CALLs are written to json text directly and sent with this callback instead of send_callback. A CALL is
+    // passed together with a callback that the transport calls with false if it drops the CALL after accepting it
+    std::function<bool(const std::string& message, const std::function<void(bool sent)>& on_sent)>
+        serialized_send_callback;
+    // if set, CALLRESULTs and CALLERRORs are written directly into a send buffer of the transport with this callback
+    std::function<bool(const std::function<void(JsonWriter& writer)>& write)> writer_send_callback;
+    // reused for every CALLRESULT and CALLERROR, so that responses do not allocate once it has grown large enough
+    JsonWriter response_writer;
+    std::mutex response_writer_mutex;
+
+    /// \brief Lets the on_sent callbacks that a transport may still hold reach the queue only as long as it exists
+    struct SendResultTarget {
+        std::mutex mutex;
+        MessageQueue* queue = nullptr;
+    };
+    std::shared_ptr<SendResultTarget> send_result_target;
     std::vector<M> external_notify;
     bool paused;
     // Transiently true while the queue is paused, but is waiting to unpause
@@ -214,6 +516,34 @@ private:
     std::function<void(const std::string& new_message_id, const std::string& old_message_id)>
         start_transaction_message_retry_callback;
 
+    // persisted message queue updates that have not been committed to the database yet (cf.
+    // MessageQueueConfig::queue_db_flush_interval_ms)
+    std::mutex db_operations_mutex;
+    std::vector<std::pair<ocpp::common::DBTransactionMessage, QueueType>> pending_db_inserts;
+    std::vector<std::pair<std::string, QueueType>> pending_db_removals;
+    bool db_flush_scheduled = false;
+    // serializes flushes so that the groups are committed in the order they have been collected
+    std::mutex db_flush_mutex;
+    Everest::SteadyTimer db_flush_timer;
+
+    struct ReplayInFlightMessage {
+        std::shared_ptr<ControlMessage<M>> message;
+        QueueType queue_type;
+        std::chrono::steady_clock::time_point deadline;
+    };
+    // messages that have been sent during a pipelined replay, key is the unique id of the message
+    std::map<std::string, ReplayInFlightMessage> replay_in_flight;
+    bool replay_active = false;
+    size_t replay_total = 0;
+    size_t replay_delivered = 0;
+    std::chrono::steady_clock::time_point replay_start;
+    // checks the messages in flight for timeouts and wakes up the worker while a replay is active
+    Everest::SteadyTimer replay_timer;
+    std::function<void(const ReplayProgress& progress)> replay_progress_callback;
+    // number of messages not further ahead of the transaction message queue than this are considered for a replay
+    static constexpr size_t REPLAY_MAX_LOOKAHEAD = 1000;
+    static constexpr size_t REPLAY_PROGRESS_REPORT_INTERVAL = 100;
+
     MessageId getMessageId(const json::array_t& json_message) {
         return MessageId(json_message.at(MESSAGE_ID).get<std::string>());
     }
@@ -240,6 +570,110 @@ private:
         return false;
     }
 
+    bool is_db_group_commit_enabled() const {
+        return this->config.queue_db_flush_interval_ms > 0;
+    }
+
+    /// \brief Persists the given \p message in the message queue table of the given \p queue_type
+    void persist_message(const std::shared_ptr<ControlMessage<M>>& message, const QueueType queue_type) {
+        ocpp::common::DBTransactionMessage db_message{message->message, messagetype_to_string(message->messageType),
+                                                      message->message_attempts, message->timestamp,
+                                                      message->uniqueId()};
+        if (message->serialized.has_value()) {
+            db_message.serialized_json_message = message->serialized->text;
+        }
+        if (!this->is_db_group_commit_enabled()) {
+            try {
+                this->database_handler->insert_message_queue_message(db_message, queue_type);
+            } catch (const QueryExecutionException& e) {
+                EVLOG_warning << "Could not insert message into message queue: " << e.what();
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lk(this->db_operations_mutex);
+            this->pending_db_inserts.emplace_back(std::move(db_message), queue_type);
+        }
+        this->schedule_db_flush();
+    }
+
+    /// \brief Removes the message with the given \p unique_id from the message queue table of the given \p queue_type
+    void remove_persisted_message(const std::string& unique_id, const QueueType queue_type) {
+        if (!this->is_db_group_commit_enabled()) {
+            try {
+                this->database_handler->remove_message_queue_message(unique_id, queue_type);
+            } catch (const QueryExecutionException& e) {
+                EVLOG_warning << "Could not delete message from message queue: " << e.what();
+            } catch (const std::exception& e) {
+                EVLOG_warning << "Could not delete message from message queue: " << e.what();
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lk(this->db_operations_mutex);
+            auto it = std::find_if(this->pending_db_inserts.begin(), this->pending_db_inserts.end(),
+                                   [&](const auto& insert) {
+                                       return insert.first.unique_id == unique_id and insert.second == queue_type;
+                                   });
+            if (it != this->pending_db_inserts.end()) {
+                // message has been handled before it was written, so it does not need to hit the database at all
+                this->pending_db_inserts.erase(it);
+                return;
+            }
+            this->pending_db_removals.emplace_back(unique_id, queue_type);
+        }
+        this->schedule_db_flush();
+    }
+
+    /// \brief Commits the pending updates immediately if queue_db_flush_max_operations is reached, otherwise makes
+    /// sure that they are committed within queue_db_flush_interval_ms
+    void schedule_db_flush() {
+        bool flush_now = false;
+        bool start_timer = false;
+        {
+            std::lock_guard<std::mutex> lk(this->db_operations_mutex);
+            const auto pending_operations = this->pending_db_inserts.size() + this->pending_db_removals.size();
+            if (pending_operations >= static_cast<size_t>(std::max(this->config.queue_db_flush_max_operations, 1))) {
+                flush_now = true;
+            } else if (pending_operations > 0 and !this->db_flush_scheduled) {
+                this->db_flush_scheduled = true;
+                start_timer = true;
+            }
+        }
+
+        if (flush_now) {
+            this->flush_persisted_message_updates();
+        } else if (start_timer) {
+            this->db_flush_timer.timeout([this]() { this->flush_persisted_message_updates(); },
+                                         std::chrono::milliseconds(this->config.queue_db_flush_interval_ms));
+        }
+    }
+
+    /// \brief Commits all pending updates of the persisted message queue in a single database transaction
+    void flush_persisted_message_updates() {
+        std::lock_guard<std::mutex> flush_lk(this->db_flush_mutex);
+        std::vector<std::pair<ocpp::common::DBTransactionMessage, QueueType>> inserts;
+        std::vector<std::pair<std::string, QueueType>> removals;
+        {
+            std::lock_guard<std::mutex> lk(this->db_operations_mutex);
+            std::swap(inserts, this->pending_db_inserts);
+            std::swap(removals, this->pending_db_removals);
+            this->db_flush_scheduled = false;
+        }
+
+        if (inserts.empty() and removals.empty()) {
+            return;
+        }
+
+        try {
+            this->database_handler->update_message_queue(inserts, removals);
+        } catch (const std::exception& e) {
+            EVLOG_warning << "Could not update persisted message queue: " << e.what();
+        }
+    }
+
     void add_to_normal_message_queue(std::shared_ptr<ControlMessage<M>> message) {
         EVLOG_debug << "Adding message to normal message queue";
         {
@@ -251,14 +685,7 @@ private:
                 this->normal_message_queue.push_back(message);
             }
             if (this->config.check_queue(message->messageType)) {
-                ocpp::common::DBTransactionMessage db_message{
-                    message->message, messagetype_to_string(message->messageType), message->message_attempts,
-                    message->timestamp, message->uniqueId()};
-                try {
-                    this->database_handler->insert_message_queue_message(db_message, QueueType::Normal);
-                } catch (const QueryExecutionException& e) {
-                    EVLOG_warning << "Could not insert message into transaction queue: " << e.what();
-                }
+                this->persist_message(message, QueueType::Normal);
             }
             this->new_message = true;
             this->check_queue_sizes();
@@ -271,14 +698,7 @@ private:
         {
             std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
             this->transaction_message_queue.push_back(message);
-            ocpp::common::DBTransactionMessage db_message{message->message, messagetype_to_string(message->messageType),
-                                                          message->message_attempts, message->timestamp,
-                                                          message->uniqueId()};
-            try {
-                this->database_handler->insert_message_queue_message(db_message);
-            } catch (const QueryExecutionException& e) {
-                EVLOG_warning << "Could not insert message into transaction queue: " << e.what();
-            }
+            this->persist_message(message, QueueType::Transaction);
             this->new_message = true;
             this->check_queue_sizes();
         }
@@ -286,6 +706,65 @@ private:
         EVLOG_debug << "Notified message queue worker";
     }
 
+    /// \brief Adds the given \p message to the transaction or normal message queue or discards it
+    void enqueue(const std::shared_ptr<ControlMessage<M>>& message) {
+        if (is_transaction_message(*message)) {
+            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
+            // MeterValues have to be delivered in chronological order
+            this->add_to_transaction_message_queue(message);
+        } else if (!this->paused || this->resuming || this->config.check_queue(message->messageType) ||
+                   message->messageType == M::BootNotification) {
+            // all other messages are allowed to "jump the queue" to improve user experience
+            // TODO: decide if we only want to allow this for a subset of messages
+            this->add_to_normal_message_queue(message);
+        } else {
+            // do not add a normal message to the queue if the queue is paused/offline
+            EnhancedMessage<M> enhanced_message;
+            enhanced_message.offline = true;
+            message->promise.set_value(enhanced_message);
+        }
+    }
+
+    /// \brief Lockable for the worker's wait that releases and reacquires message_mutex and ingress_mutex together
+    struct WorkerLock {
+        std::recursive_mutex& message_mutex;
+        std::mutex& ingress_mutex;
+
+        void lock() {
+            std::lock(this->message_mutex, this->ingress_mutex);
+        }
+
+        void unlock() {
+            this->ingress_mutex.unlock();
+            this->message_mutex.unlock();
+        }
+    };
+
+    /// \brief Hands the given \p message over to the queue. Uses the lock-free ingress ring if possible
+    void submit(std::shared_ptr<ControlMessage<M>> message) {
+        if (this->ingress != nullptr and this->ingress->try_push(message)) {
+            std::lock_guard<std::mutex> lk(this->ingress_mutex);
+            this->cv.notify_all();
+            return;
+        }
+
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        // messages already in the ring have been pushed before this one
+        this->drain_ingress();
+        this->enqueue(message);
+    }
+
+    /// \brief Moves all messages of the ingress ring into the message queues. message_mutex has to be held
+    void drain_ingress() {
+        if (this->ingress == nullptr) {
+            return;
+        }
+        std::shared_ptr<ControlMessage<M>> message;
+        while (this->ingress->try_pop(message)) {
+            this->enqueue(message);
+        }
+    }
+
     void check_queue_sizes() {
         if (this->transaction_message_queue.size() + this->normal_message_queue.size() <=
             this->config.queues_total_size_threshold) {
@@ -316,14 +795,8 @@ private:
 
         for (int i = 0; i < number_of_dropped_messages; i++) {
             if (this->config.queue_all_messages) {
-                try {
-                    database_handler->remove_message_queue_message(
-                        this->normal_message_queue.front()->initial_unique_id, QueueType::Normal);
-                } catch (const QueryExecutionException& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                } catch (const std::exception& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                }
+                this->remove_persisted_message(this->normal_message_queue.front()->initial_unique_id,
+                                               QueueType::Normal);
             }
             this->normal_message_queue.pop_front();
         }
@@ -337,32 +810,31 @@ private:
      */
     bool drop_update_messages_from_transactional_message_queue() {
         int drop_count = 0;
-        std::deque<std::shared_ptr<ControlMessage<M>>> temporary_swap_queue;
         bool remove_next_update_message = true;
-        while (!transaction_message_queue.empty()) {
-            auto element = transaction_message_queue.front();
-            transaction_message_queue.pop_front();
+        // only the update messages need to be visited; a message directly following the previously visited update
+        // message continues the current sequence of update messages, every other message starts a new one
+        auto successor_of_previous_update_message = this->transaction_message_queue.end();
+        const auto update_messages = this->transaction_message_queue.get_transaction_update_messages();
+        for (size_t i = 0; i < update_messages.size(); i++) {
+            const auto it = update_messages[i];
+            if (it != successor_of_previous_update_message) {
+                remove_next_update_message = true;
+            }
+            successor_of_previous_update_message = std::next(it);
             // drop every second update message (except last one)
-            if (remove_next_update_message && element->is_transaction_update_message() &&
-                transaction_message_queue.size() > 1) {
+            if (remove_next_update_message and std::next(it) != this->transaction_message_queue.end() and
+                std::next(std::next(it)) != this->transaction_message_queue.end()) {
+                const auto element = *it;
                 EVLOG_debug << "Drop transactional message " << element->initial_unique_id;
-                try {
-                    database_handler->remove_message_queue_message(element->initial_unique_id);
-                } catch (const QueryExecutionException& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                } catch (const std::exception& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                }
+                this->remove_persisted_message(element->initial_unique_id, QueueType::Transaction);
+                this->transaction_message_queue.erase(it);
                 drop_count++;
                 remove_next_update_message = false;
             } else {
                 remove_next_update_message = true;
-                temporary_swap_queue.push_back(element);
             }
         }
 
-        std::swap(transaction_message_queue, temporary_swap_queue);
-
         if (drop_count > 0) {
             EVLOG_warning << "Dropped " << drop_count << " transactional update messages to reduce queue size.";
             return true;
@@ -372,17 +844,405 @@ private:
         }
     }
 
+    /// \brief Schedules a retry of the given \p message after a timeout or a CALLERROR or drops it if it shall not or
+    /// cannot be delivered anymore. \p enhanced_message_opt is set only in case of CALLERROR
+    void retry_or_drop_message(const std::shared_ptr<ControlMessage<M>>& message,
+                               const std::optional<EnhancedMessage<M>>& enhanced_message_opt) {
+        const auto queue_type = is_transaction_message(*message) ? QueueType::Transaction : QueueType::Normal;
+        if (is_transaction_message(*message) or this->config.check_queue(message->messageType)) {
+            if (message->message_attempts < this->config.transaction_message_attempts) {
+                EVLOG_warning << "Message shall be persisted and will therefore be sent again";
+                // Generate a new message ID for the retry
+                const auto old_message_id = message->json_message()[MESSAGE_ID];
+                message->json_message()[MESSAGE_ID] = this->createMessageId();
+                if (this->config.transaction_message_retry_interval > 0) {
+                    // exponential backoff
+                    message->timestamp =
+                        DateTime(message->timestamp.to_time_point() +
+                                 std::chrono::seconds(this->config.transaction_message_retry_interval) *
+                                     message->message_attempts);
+                    EVLOG_debug << "Retry interval > 0: " << this->config.transaction_message_retry_interval
+                                << " attempting to retry message at: " << message->timestamp;
+                } else {
+                    // immediate retry
+                    message->timestamp = DateTime();
+                    EVLOG_debug << "Retry interval of 0 means immediate retry";
+                }
+
+                EVLOG_warning << "Attempt: " << message->message_attempts + 1 << "/"
+                              << this->config.transaction_message_attempts << " will be sent at " << message->timestamp;
+
+                if (queue_type == QueueType::Transaction) {
+                    this->transaction_message_queue.push_front(message);
+                } else if (queue_type == QueueType::Normal) {
+                    this->normal_message_queue.push_front(message);
+                }
+                if (is_start_transaction_message(*message)) {
+                    this->start_transaction_message_retry_callback(message->uniqueId(), old_message_id);
+                }
+                this->notify_queue_timer.at(
+                    [this]() {
+                        this->new_message = true;
+                        this->cv.notify_all();
+                    },
+                    message->timestamp.to_time_point());
+            } else {
+                EVLOG_error << "Could not deliver message within the configured amount of attempts, "
+                               "dropping message";
+                if (enhanced_message_opt) {
+                    message->promise.set_value(enhanced_message_opt.value());
+                } else {
+                    EnhancedMessage<M> enhanced_message;
+                    enhanced_message.offline = true;
+                    message->promise.set_value(enhanced_message);
+                }
+                // also drop the message from the database
+                this->remove_persisted_message(message->initial_unique_id, queue_type);
+            }
+        } else if (is_boot_notification_message(message->messageType)) {
+            EVLOG_warning << "Message is BootNotification.req and will therefore be sent again";
+            // Generate a new message ID for the retry
+            message->json_message()[MESSAGE_ID] = this->createMessageId();
+            // Spec does not define how to handle retries for BootNotification.req: We use the
+            // the boot_notification_retry_interval_seconds
+            message->timestamp = DateTime(message->timestamp.to_time_point() +
+                                          std::chrono::seconds(this->config.boot_notification_retry_interval_seconds));
+            this->normal_message_queue.push_front(message);
+            this->notify_queue_timer.at(
+                [this]() {
+                    this->new_message = true;
+                    this->cv.notify_all();
+                },
+                message->timestamp.to_time_point());
+        } else {
+            EVLOG_warning << "Message is not transaction related, dropping it";
+            if (enhanced_message_opt) {
+                message->promise.set_value(enhanced_message_opt.value());
+            } else {
+                EnhancedMessage<M> enhanced_message;
+                enhanced_message.offline = true;
+                message->promise.set_value(enhanced_message);
+            }
+        }
+    }
+
+    size_t get_replay_window() const {
+        return static_cast<size_t>(std::max(this->config.replay_window, 1));
+    }
+
+    /// \brief Starts a pipelined replay if it is enabled and a backlog of transaction messages has been queued
+    void start_replay() {
+        if (this->get_replay_window() <= 1 or this->replay_active or this->transaction_message_queue.size() <= 1) {
+            return;
+        }
+        this->replay_active = true;
+        this->replay_total = this->transaction_message_queue.size() + this->normal_message_queue.size();
+        this->replay_delivered = 0;
+        this->replay_start = std::chrono::steady_clock::now();
+        EVLOG_info << "Replaying " << this->replay_total << " queued messages with up to " << this->get_replay_window()
+                   << " messages in flight";
+        this->replay_timer.interval([this]() { this->check_replay_timeouts(); }, std::chrono::seconds(1));
+    }
+
+    ReplayProgress get_replay_progress() const {
+        ReplayProgress progress;
+        progress.total = this->replay_total;
+        progress.delivered = this->replay_delivered;
+        progress.remaining =
+            this->transaction_message_queue.size() + this->normal_message_queue.size() + this->replay_in_flight.size();
+        progress.elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
+                                                                                  this->replay_start);
+        progress.messages_per_second =
+            progress.elapsed.count() > 0 ? progress.delivered * 1000.0 / progress.elapsed.count() : 0.0;
+        return progress;
+    }
+
+    void report_replay_progress(const ReplayProgress& progress) {
+        if (this->replay_progress_callback != nullptr) {
+            this->replay_progress_callback(progress);
+        }
+    }
+
+    /// \brief Ends the replay once all transaction messages have been delivered
+    void finish_replay_if_done() {
+        if (!this->replay_active or !this->replay_in_flight.empty() or !this->transaction_message_queue.empty()) {
+            return;
+        }
+        this->replay_active = false;
+        this->replay_timer.stop();
+        const auto progress = this->get_replay_progress();
+        EVLOG_info << "Replayed " << progress.delivered << " messages in " << progress.elapsed.count() << "ms ("
+                   << progress.messages_per_second << " messages/s)";
+        this->report_replay_progress(progress);
+    }
+
+    /// \brief Sends the given \p message as part of a pipelined replay
+    /// \returns false if the message could not be sent
+    bool send_replay_message(const std::shared_ptr<ControlMessage<M>>& message, const QueueType queue_type) {
+        EVLOG_debug << "Replaying message. UID: " << message->uniqueId() << " attempt#: " << message->message_attempts;
+        message->message_attempts += 1;
+        if (!this->send_message(*message)) {
+            this->paused = true;
+            EVLOG_error << "Could not replay message, this is most likely because the charge point is offline.";
+            if (message->action() == "TransactionEvent") {
+                message->json_message().at(CALL_PAYLOAD)["offline"] = true;
+            }
+            return false;
+        }
+        this->replay_in_flight[message->uniqueId()] = {
+            message, queue_type,
+            std::chrono::steady_clock::now() + this->current_message_timeout(message->message_attempts)};
+        return true;
+    }
+
+    /// \brief Sends as many messages as the replay window allows. Only the first queued message of every ordering key
+    /// is eligible and only if no other message with the same key is in flight
+    /// \returns the number of messages that have been sent
+    size_t dispatch_replay_messages() {
+        {
+            std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
+            if (this->next_message_to_send.has_value()) {
+                // a response to a CALL of the CSMS has to be sent first
+                return 0;
+            }
+        }
+
+        const auto now = DateTime();
+        size_t sent = 0;
+        auto has_free_slot = [this]() { return this->replay_in_flight.size() < this->get_replay_window(); };
+
+        // non-transaction messages do not depend on each other
+        auto it = this->normal_message_queue.begin();
+        while (it != this->normal_message_queue.end() and has_free_slot()) {
+            const auto message = *it;
+            if (!message->replay_ordering_key().has_value() or
+                !allowed_to_send_message(*message, now, this->is_registration_status_accepted)) {
+                ++it;
+                continue;
+            }
+            if (!this->send_replay_message(message, QueueType::Normal)) {
+                if (!this->config.check_queue(message->messageType)) {
+                    EnhancedMessage<M> enhanced_message;
+                    enhanced_message.offline = true;
+                    message->promise.set_value(enhanced_message);
+                    this->normal_message_queue.erase(it);
+                }
+                return sent;
+            }
+            it = this->normal_message_queue.erase(it);
+            sent++;
+        }
+
+        std::set<std::string> blocked_keys;
+        for (const auto& [unique_id, in_flight_message] : this->replay_in_flight) {
+            if (const auto key = in_flight_message.message->replay_ordering_key(); key.has_value()) {
+                blocked_keys.insert(key.value());
+            }
+        }
+
+        size_t scanned = 0;
+        for (auto it = this->transaction_message_queue.begin();
+             it != this->transaction_message_queue.end() and has_free_slot() and scanned < REPLAY_MAX_LOOKAHEAD;
+             scanned++) {
+            const auto message = *it;
+            const auto key = message->replay_ordering_key();
+            if (!key.has_value()) {
+                // this message and everything queued behind it waits until it has been delivered regularly
+                break;
+            }
+            // only the first message of every key can be sent, later ones have to wait for their predecessor
+            const bool blocked = !blocked_keys.insert(key.value()).second;
+            if (blocked or !allowed_to_send_message(*message, now, this->is_registration_status_accepted)) {
+                ++it;
+                continue;
+            }
+            if (!this->send_replay_message(message, QueueType::Transaction)) {
+                return sent;
+            }
+            it = this->transaction_message_queue.erase(it);
+            sent++;
+        }
+        return sent;
+    }
+
+    /// \brief Attaches the original CALL to the CALLRESULT \p enhanced_message of the delivered \p message. The json
+    /// text of a CALL that was sent as text is handed over, so it is only parsed if a response handler needs it
+    void attach_call_message(EnhancedMessage<M>& enhanced_message, ControlMessage<M>& message) {
+        if (message.serialized.has_value()) {
+            // the message has been delivered, so its text is not needed for a retry or to persist it anymore
+            enhanced_message.call_message_text =
+                std::make_shared<const std::string>(std::move(message.serialized->text));
+        } else {
+            enhanced_message.call_message = message.message;
+        }
+    }
+
+    /// \brief Handles the CALLRESULT or CALLERROR of a message that has been sent during a pipelined replay
+    /// \returns false if the given \p enhanced_message does not belong to a replayed message
+    bool handle_replay_response(EnhancedMessage<M>& enhanced_message) {
+        auto it = this->replay_in_flight.find(enhanced_message.uniqueId);
+        if (it == this->replay_in_flight.end()) {
+            return false;
+        }
+        const auto replayed = it->second;
+        this->replay_in_flight.erase(it);
+
+        if (enhanced_message.messageTypeId == MessageTypeId::CALLERROR) {
+            enhanced_message.call_message = replayed.message->json_message();
+            EVLOG_warning << "CALLERROR for: " << replayed.message->messageType << " ("
+                          << replayed.message->uniqueId() << ")";
+            this->retry_or_drop_message(replayed.message, enhanced_message);
+        } else {
+            this->attach_call_message(enhanced_message, *replayed.message);
+            enhanced_message.messageType = this->string_to_messagetype(
+                std::string(replayed.message->action()) + std::string("Response"));
+            replayed.message->promise.set_value(enhanced_message);
+            if (is_transaction_message(*replayed.message) or
+                this->config.check_queue(replayed.message->messageType)) {
+                this->remove_persisted_message(replayed.message->initial_unique_id, replayed.queue_type);
+            }
+            this->replay_delivered++;
+            if (this->replay_delivered % REPLAY_PROGRESS_REPORT_INTERVAL == 0) {
+                this->report_replay_progress(this->get_replay_progress());
+            }
+        }
+
+        this->finish_replay_if_done();
+        if (!this->transaction_message_queue.empty() or !this->normal_message_queue.empty()) {
+            this->new_message = true;
+        }
+        this->cv.notify_all();
+        return true;
+    }
+
+    void check_replay_timeouts() {
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        const auto now = std::chrono::steady_clock::now();
+        for (auto it = this->replay_in_flight.begin(); it != this->replay_in_flight.end();) {
+            if (it->second.deadline > now) {
+                ++it;
+                continue;
+            }
+            const auto message = it->second.message;
+            it = this->replay_in_flight.erase(it);
+            EVLOG_warning << "Message timeout for: " << message->messageType << " (" << message->uniqueId() << ")";
+            this->retry_or_drop_message(message, std::nullopt);
+        }
+        this->finish_replay_if_done();
+        if (!this->transaction_message_queue.empty() or !this->normal_message_queue.empty()) {
+            this->new_message = true;
+        }
+        this->cv.notify_all();
+    }
+
     // The public resume() delegates the actual resumption to this method
     void resume_now(u_int64_t expected_pause_resume_ctr) {
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
         if (this->pause_resume_ctr == expected_pause_resume_ctr) {
             this->paused = false;
             this->resuming = false;
+            this->start_replay();
             this->cv.notify_one();
             EVLOG_debug << "resume() notified message queue";
         }
     }
 
+    /// \brief Creates a control message for the given \p call that is written to json text without building a json
+    /// object
+    template <class T>
+    std::shared_ptr<ControlMessage<M>> make_serialized_control_message(const Call<T>& call,
+                                                                       const bool stall_until_accepted = false) {
+        JsonWriter writer;
+        writer.value(call);
+        typename ControlMessage<M>::Serialized serialized{writer.release(), call.uniqueId, call.msg.get_type(),
+                                                          get_transaction_id(call.msg),
+                                                          is_transaction_update_request(call.msg)};
+        const auto message_type = this->string_to_messagetype(serialized.action);
+        return std::make_shared<ControlMessage<M>>(std::move(serialized), message_type, stall_until_accepted);
+    }
+
+    /// \brief Sends the given \p message, serialized messages are sent as they are. If a serialized send callback is
+    /// registered, a message that the transport drops after accepting it is handled by handle_dropped_message()
+    /// \returns false if the message could not be sent
+    bool send_message(ControlMessage<M>& message) {
+        if (this->serialized_send_callback == nullptr) {
+            return this->send_callback(message.json_message());
+        }
+        auto on_sent = [target = this->send_result_target, unique_id = message.uniqueId()](bool sent) {
+            if (sent) {
+                return;
+            }
+            std::lock_guard<std::mutex> lk(target->mutex);
+            if (target->queue != nullptr) {
+                target->queue->handle_dropped_message(unique_id);
+            }
+        };
+        if (message.serialized.has_value()) {
+            return this->serialized_send_callback(message.serialized->text, on_sent);
+        }
+        return this->serialized_send_callback(json(message.json_message()).dump(), on_sent);
+    }
+
+    /// \brief Handles the CALL with the given \p unique_id that the transport accepted, but dropped before it was
+    /// written, e.g. because the connection has been closed. This is handled like a CALL that could not be sent at all:
+    /// the queue is paused and the CALL is sent again once the queue is resumed if it is a transaction related or
+    /// queued message
+    void handle_dropped_message(const MessageId& unique_id) {
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        std::shared_ptr<ControlMessage<M>> message;
+        if (this->in_flight != nullptr and this->in_flight->uniqueId() == unique_id) {
+            message = this->in_flight;
+            this->reset_in_flight();
+        } else if (auto it = this->replay_in_flight.find(unique_id); it != this->replay_in_flight.end()) {
+            message = it->second.message;
+            this->replay_in_flight.erase(it);
+        } else {
+            // the message has been answered, has timed out or has been sent again with a new message id meanwhile
+            return;
+        }
+
+        this->paused = true;
+        EVLOG_error << "Message " << unique_id
+                    << " has been dropped by the transport, this is most likely because the charge point is offline.";
+        if (is_transaction_message(*message)) {
+            EVLOG_info << "The dropped message is transaction related and will be sent again once the connection can "
+                          "be established again.";
+            if (message->action() == "TransactionEvent") {
+                message->json_message().at(CALL_PAYLOAD)["offline"] = true;
+            }
+            this->transaction_message_queue.push_front(message);
+        } else if (this->config.check_queue(message->messageType)) {
+            EVLOG_info << "The dropped message will be sent again once the connection can be established again since "
+                          "QueueAllMessages is set to 'true'.";
+            this->normal_message_queue.push_front(message);
+        } else {
+            EVLOG_info << "The dropped message is not transaction related and will be dropped";
+            EnhancedMessage<M> enhanced_message;
+            enhanced_message.offline = true;
+            message->promise.set_value(enhanced_message);
+        }
+        this->new_message = true;
+        this->cv.notify_all();
+    }
+
+    /// \brief Sends the given CALLRESULT or CALLERROR \p response. It is written directly into a send buffer of the
+    /// transport if a writer send callback is registered, or to the reused response buffer if a serialized send
+    /// callback is registered
+    template <class T> void send_response(const T& response) {
+        if (this->writer_send_callback != nullptr) {
+            this->writer_send_callback([&response](JsonWriter& writer) { writer.value(response); });
+            return;
+        }
+        if (this->serialized_send_callback == nullptr) {
+            this->send_callback(response);
+            return;
+        }
+        std::lock_guard<std::mutex> lk(this->response_writer_mutex);
+        this->response_writer.clear();
+        this->response_writer.value(response);
+        this->serialized_send_callback(this->response_writer.str(), nullptr);
+    }
+
     // Computes the current message timeout = interval * attempt + message timeout
     std::chrono::seconds current_message_timeout(unsigned int attempt) {
         return std::chrono::seconds(this->config.message_timeout_seconds +
@@ -410,6 +1270,12 @@ public:
 
         this->send_callback = send_callback;
         this->in_flight = nullptr;
+        this->send_result_target = std::make_shared<SendResultTarget>();
+        this->send_result_target->queue = this;
+        if (this->config.ingress_ring_capacity > 0) {
+            this->ingress = std::make_unique<MpscRingBuffer<std::shared_ptr<ControlMessage<M>>>>(
+                this->config.ingress_ring_capacity);
+        }
     }
 
     MessageQueue(const std::function<bool(json message)>& send_callback, const MessageQueueConfig<M>& config,
@@ -417,6 +1283,12 @@ public:
         MessageQueue(send_callback, config, {}, databaseHandler) {
     }
 
+    ~MessageQueue() {
+        // wait for an on_sent callback that is being handled and ignore the ones that are called later
+        std::lock_guard<std::mutex> lk(this->send_result_target->mutex);
+        this->send_result_target->queue = nullptr;
+    }
+
     void start() {
         this->worker_thread = std::thread([this]() {
             // TODO(kai): implement message timeout
@@ -426,9 +1298,19 @@ public:
                 std::unique_lock<std::recursive_mutex> lk(this->message_mutex);
                 using namespace std::chrono_literals;
                 // It's safe to wait on the cv here because we're guaranteed to only lock this->message_mutex once
-                this->cv.wait(lk, [this]() {
-                    return !this->running || (!this->paused && this->new_message && this->in_flight == nullptr);
-                });
+                auto can_progress = [this]() {
+                    return !this->running || (this->ingress != nullptr && !this->ingress->empty()) ||
+                           (!this->paused && this->new_message && this->in_flight == nullptr &&
+                            this->replay_in_flight.size() < this->get_replay_window());
+                };
+                {
+                    // message_mutex is already held by lk
+                    this->ingress_mutex.lock();
+                    WorkerLock worker_lock{this->message_mutex, this->ingress_mutex};
+                    this->cv.wait(worker_lock, can_progress);
+                    this->ingress_mutex.unlock();
+                }
+                this->drain_ingress();
                 if (this->transaction_message_queue.empty() && this->normal_message_queue.empty()) {
                     // There is nothing in the message queue, not progressing further
                     continue;
@@ -450,6 +1332,17 @@ public:
                     EVLOG_debug << "There is no message in flight, checking message queue for a new message.";
                 }
 
+                if (this->replay_active) {
+                    const auto dispatched = this->dispatch_replay_messages();
+                    if (dispatched > 0 or !this->replay_in_flight.empty()) {
+                        if (dispatched == 0) {
+                            // wait for a response of a message in flight
+                            this->new_message = false;
+                        }
+                        continue;
+                    }
+                }
+
                 // prioritize the message with the oldest timestamp
                 std::shared_ptr<ControlMessage<M>> message = nullptr;
                 QueueType queue_type = QueueType::None;
@@ -521,21 +1414,25 @@ public:
                 this->in_flight = message;
                 this->in_flight->message_attempts += 1;
 
-                if (this->message_id_transaction_id_map.count(this->in_flight->message.at(1))) {
+                if (this->message_id_transaction_id_map.count(this->in_flight->uniqueId().get())) {
                     EVLOG_debug << "Replacing transaction id";
-                    this->in_flight->message.at(3)["transactionId"] =
-                        this->message_id_transaction_id_map.at(this->in_flight->message.at(1));
-                    this->message_id_transaction_id_map.erase(this->in_flight->message.at(1));
+                    auto& in_flight_message = this->in_flight->json_message();
+                    in_flight_message.at(3)["transactionId"] =
+                        this->message_id_transaction_id_map.at(in_flight_message.at(1));
+                    this->message_id_transaction_id_map.erase(in_flight_message.at(1));
+                    if (queue_type == QueueType::Transaction) {
+                        this->transaction_message_queue.reindex(selected_transaction_message_it);
+                    }
                 }
 
-                if (!this->send_callback(this->in_flight->message)) {
+                if (!this->send_message(*this->in_flight)) {
                     this->paused = true;
                     EVLOG_error << "Could not send message, this is most likely because the charge point is offline.";
                     if (this->in_flight && is_transaction_message(*this->in_flight)) {
                         EVLOG_info << "The message in flight is transaction related and will be sent again once the "
                                       "connection can be established again.";
-                        if (this->in_flight->message.at(CALL_ACTION) == "TransactionEvent") {
-                            this->in_flight->message.at(CALL_PAYLOAD)["offline"] = true;
+                        if (this->in_flight->action() == "TransactionEvent") {
+                            this->in_flight->json_message().at(CALL_PAYLOAD)["offline"] = true;
                         }
                     } else if (this->config.check_queue(this->in_flight->messageType)) {
                         EVLOG_info << "The message in flight  will be sent again once the connection can be "
@@ -593,15 +1490,8 @@ public:
 
                     if (ignore_security_event_notifications &&
                         persisted_message.message_type == "SecurityEventNotification") {
-                        try {
-                            // remove from database in case SecurityEventNotification.req should not be sent
-                            this->database_handler->remove_message_queue_message(persisted_message.unique_id,
-                                                                                 queue_type);
-                        } catch (const QueryExecutionException& e) {
-                            EVLOG_warning << "Could not delete message from message queue: " << e.what();
-                        } catch (const std::exception& e) {
-                            EVLOG_warning << "Could not delete message from message queue: " << e.what();
-                        }
+                        // remove from database in case SecurityEventNotification.req should not be sent
+                        this->remove_persisted_message(persisted_message.unique_id, queue_type);
                     } else {
                         std::shared_ptr<ControlMessage<M>> message =
                             std::make_shared<ControlMessage<M>>(persisted_message.json_message);
@@ -621,6 +1511,8 @@ public:
         }
 
         if (!this->config.queue_all_messages) {
+            // pending updates must not be committed after the table has been cleared
+            this->flush_persisted_message_updates();
             // make sure to clear normal message queue table in case queue_all_messages is false, since without clearing
             // it here messages would not be removed in handle_call_result or handle_call_timeout_or_error
             this->database_handler->clear_message_queue(QueueType::Normal);
@@ -632,6 +1524,10 @@ public:
         if (!running) {
             return;
         }
+        if (this->serialized_send_callback != nullptr) {
+            this->submit(this->make_serialized_control_message(call, stall_until_accepted));
+            return;
+        }
         json call_json = call;
         push(call_json, stall_until_accepted);
     }
@@ -641,23 +1537,7 @@ public:
             return;
         }
 
-        auto control_message = std::make_shared<ControlMessage<M>>(message, stall_until_accepted);
-        if (is_transaction_message(*control_message)) {
-            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
-            // MeterValues have to be delivered in chronological order
-
-            // intentionally break this message for testing...
-            // message->message[CALL_PAYLOAD]["broken"] = this->createMessageId();
-            this->add_to_transaction_message_queue(control_message);
-        } else {
-            // all other messages are allowed to "jump the queue" to improve user experience
-            // TODO: decide if we only want to allow this for a subset of messages
-            if (!this->paused || this->resuming || this->config.check_queue(control_message->messageType) ||
-                control_message->messageType == M::BootNotification) {
-                this->add_to_normal_message_queue(control_message);
-            }
-        }
-        this->cv.notify_all();
+        this->submit(std::make_shared<ControlMessage<M>>(message, stall_until_accepted));
     }
 
     /// \brief Sends a new \p call_result message over the websocket
@@ -666,7 +1546,7 @@ public:
             return;
         }
 
-        this->send_callback(call_result);
+        this->send_response(call_result);
         {
             std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
             if (next_message_to_send.has_value()) {
@@ -685,7 +1565,7 @@ public:
             return;
         }
 
-        this->send_callback(call_error);
+        this->send_response(call_error);
         {
             std::lock_guard<std::recursive_mutex> lk(this->next_message_mutex);
             if (next_message_to_send.has_value()) {
@@ -701,30 +1581,18 @@ public:
     /// \brief pushes a new \p call message onto the message queue
     /// \returns a future from which the CallResult can be extracted
     template <class T> std::future<EnhancedMessage<M>> push_async(Call<T> call) {
-        auto message = std::make_shared<ControlMessage<M>>(call);
+        auto message = this->serialized_send_callback != nullptr ? this->make_serialized_control_message(call)
+                                                                 : std::make_shared<ControlMessage<M>>(call);
+        auto future = message->promise.get_future();
 
         if (!running) {
             auto enhanced_message = EnhancedMessage<M>();
             enhanced_message.offline = true;
             message->promise.set_value(enhanced_message);
-        } else if (is_transaction_message(message->messageType)) {
-            // according to the spec the "transaction related messages" StartTransaction, StopTransaction and
-            // MeterValues have to be delivered in chronological order
-            this->add_to_transaction_message_queue(message);
         } else {
-            // all other messages are allowed to "jump the queue" to improve user experience
-            // TODO: decide if we only want to allow this for a subset of messages
-            if (this->paused && !this->config.check_queue(message->messageType) && !this->resuming &&
-                message->messageType != M::BootNotification) {
-                // do not add a normal message to the queue if the queue is paused/offline
-                auto enhanced_message = EnhancedMessage<M>();
-                enhanced_message.offline = true;
-                message->promise.set_value(enhanced_message);
-            } else {
-                this->add_to_normal_message_queue(message);
-            }
+            this->submit(message);
         }
-        return message->promise.get_future();
+        return future;
     }
 
     /// \brief Enhances a received \p json_message with additional meta information, checks if it is a valid CallResult
@@ -738,7 +1606,8 @@ public:
         enhanced_message.messageTypeId = this->getMessageTypeId(enhanced_message.message);
 
         if (enhanced_message.messageTypeId == MessageTypeId::CALL) {
-            enhanced_message.messageType = this->string_to_messagetype(enhanced_message.message.at(CALL_ACTION));
+            enhanced_message.messageType = this->string_to_messagetype(
+                enhanced_message.message.at(CALL_ACTION).template get_ref<const std::string&>());
             enhanced_message.call_message = enhanced_message.message;
 
             {
@@ -760,6 +1629,9 @@ public:
 
             // TODO(kai): we need to do some error handling in the CallError case
             std::unique_lock<std::recursive_mutex> lk(this->message_mutex);
+            if (this->handle_replay_response(enhanced_message)) {
+                return enhanced_message;
+            }
             if (this->in_flight == nullptr) {
                 EVLOG_error << "Received a CALLRESULT OR CALLERROR without a message in flight, this should not happen";
                 return enhanced_message;
@@ -772,7 +1644,7 @@ public:
             if (enhanced_message.messageTypeId == MessageTypeId::CALLERROR) {
                 EVLOG_error << "Received a CALLERROR for message with UID: " << enhanced_message.uniqueId;
                 // make sure the original call message is attached to the callerror
-                enhanced_message.call_message = this->in_flight->message;
+                enhanced_message.call_message = this->in_flight->json_message();
                 lk.unlock();
                 this->handle_timeout_or_callerror(enhanced_message);
             } else {
@@ -790,26 +1662,23 @@ public:
 
     void handle_call_result(EnhancedMessage<M>& enhanced_message) {
         if (this->in_flight->uniqueId() == enhanced_message.uniqueId) {
-            enhanced_message.call_message = this->in_flight->message;
+            this->attach_call_message(enhanced_message, *this->in_flight);
             enhanced_message.messageType = this->string_to_messagetype(
-                this->in_flight->message.at(CALL_ACTION).template get<std::string>() + std::string("Response"));
+                std::string(this->in_flight->action()) + std::string("Response"));
             this->in_flight->promise.set_value(enhanced_message);
 
             const auto queue_type =
                 is_transaction_message(*this->in_flight) ? QueueType::Transaction : QueueType::Normal;
             if (is_transaction_message(*this->in_flight) or this->config.check_queue(this->in_flight->messageType)) {
-                try {
-                    // We only remove the message as soon as a response is received. Otherwise we might miss a message
-                    // if the charging station just boots after sending, but before receiving the result.
-                    this->database_handler->remove_message_queue_message(this->in_flight->initial_unique_id,
-                                                                         queue_type);
-                } catch (const QueryExecutionException& e) {
-                    EVLOG_warning << "Could not delete message from message queue: " << e.what();
-                } catch (const std::exception& e) {
-                    EVLOG_warning << "Could not delete message from message queue: " << e.what();
-                }
+                // We only remove the message as soon as a response is received. Otherwise we might miss a message
+                // if the charging station just boots after sending, but before receiving the result.
+                this->remove_persisted_message(this->in_flight->initial_unique_id, queue_type);
             }
             this->reset_in_flight();
+            if (this->replay_active) {
+                this->replay_delivered++;
+                this->finish_replay_if_done();
+            }
 
             // we want the start transaction response handler to be executed before the next message will be
             // send in order to be able to replace the transaction id if necessary
@@ -834,92 +1703,7 @@ public:
                           << ")";
         }
 
-        const auto queue_type = is_transaction_message(*this->in_flight) ? QueueType::Transaction : QueueType::Normal;
-        if (is_transaction_message(*this->in_flight) or this->config.check_queue(this->in_flight->messageType)) {
-            if (this->in_flight->message_attempts < this->config.transaction_message_attempts) {
-                EVLOG_warning << "Message shall be persisted and will therefore be sent again";
-                // Generate a new message ID for the retry
-                const auto old_message_id = this->in_flight->message[MESSAGE_ID];
-                this->in_flight->message[MESSAGE_ID] = this->createMessageId();
-                if (this->config.transaction_message_retry_interval > 0) {
-                    // exponential backoff
-                    this->in_flight->timestamp =
-                        DateTime(this->in_flight->timestamp.to_time_point() +
-                                 std::chrono::seconds(this->config.transaction_message_retry_interval) *
-                                     this->in_flight->message_attempts);
-                    EVLOG_debug << "Retry interval > 0: " << this->config.transaction_message_retry_interval
-                                << " attempting to retry message at: " << this->in_flight->timestamp;
-                } else {
-                    // immediate retry
-                    this->in_flight->timestamp = DateTime();
-                    EVLOG_debug << "Retry interval of 0 means immediate retry";
-                }
-
-                EVLOG_warning << "Attempt: " << this->in_flight->message_attempts + 1 << "/"
-                              << this->config.transaction_message_attempts << " will be sent at "
-                              << this->in_flight->timestamp;
-
-                if (queue_type == QueueType::Transaction) {
-                    this->transaction_message_queue.push_front(this->in_flight);
-                } else if (queue_type == QueueType::Normal) {
-                    this->normal_message_queue.push_front(this->in_flight);
-                }
-                if (is_start_transaction_message(*this->in_flight)) {
-                    this->start_transaction_message_retry_callback(this->in_flight->message[MESSAGE_ID],
-                                                                   old_message_id);
-                }
-                this->notify_queue_timer.at(
-                    [this]() {
-                        this->new_message = true;
-                        this->cv.notify_all();
-                    },
-                    this->in_flight->timestamp.to_time_point());
-            } else {
-                EVLOG_error << "Could not deliver message within the configured amount of attempts, "
-                               "dropping message";
-                if (enhanced_message_opt) {
-                    this->in_flight->promise.set_value(enhanced_message_opt.value());
-                } else {
-                    EnhancedMessage<M> enhanced_message;
-                    enhanced_message.offline = true;
-                    this->in_flight->promise.set_value(enhanced_message);
-                }
-                try {
-                    // also drop the message from the database
-                    this->database_handler->remove_message_queue_message(this->in_flight->initial_unique_id,
-                                                                         queue_type);
-                } catch (const QueryExecutionException& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                } catch (const std::exception& e) {
-                    EVLOG_warning << "Could not delete message from transaction queue: " << e.what();
-                }
-            }
-        } else if (is_boot_notification_message(this->in_flight->messageType)) {
-            EVLOG_warning << "Message is BootNotification.req and will therefore be sent again";
-            // Generate a new message ID for the retry
-            this->in_flight->message[MESSAGE_ID] = this->createMessageId();
-            // Spec does not define how to handle retries for BootNotification.req: We use the
-            // the boot_notification_retry_interval_seconds
-            this->in_flight->timestamp =
-                DateTime(this->in_flight->timestamp.to_time_point() +
-                         std::chrono::seconds(this->config.boot_notification_retry_interval_seconds));
-            this->normal_message_queue.push_front(this->in_flight);
-            this->notify_queue_timer.at(
-                [this]() {
-                    this->new_message = true;
-                    this->cv.notify_all();
-                },
-                this->in_flight->timestamp.to_time_point());
-        } else {
-            EVLOG_warning << "Message is not transaction related, dropping it";
-            if (enhanced_message_opt) {
-                this->in_flight->promise.set_value(enhanced_message_opt.value());
-            } else {
-                EnhancedMessage<M> enhanced_message;
-                enhanced_message.offline = true;
-                this->in_flight->promise.set_value(enhanced_message);
-            }
-        }
+        this->retry_or_drop_message(this->in_flight, enhanced_message_opt);
         this->reset_in_flight();
         this->cv.notify_all();
     }
@@ -931,6 +1715,15 @@ public:
         this->running = false;
         this->cv.notify_one();
         this->worker_thread.join();
+        {
+            // messages that are still in the ingress ring have to be persisted as well
+            std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+            this->drain_ingress();
+        }
+        this->replay_timer.stop();
+        // make sure that no persisted message queue update is lost
+        this->db_flush_timer.stop();
+        this->flush_persisted_message_updates();
         EVLOG_debug << "stop() notified message queue";
     }
 
@@ -976,17 +1769,19 @@ public:
 
     bool is_transaction_message_queue_empty() {
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        this->drain_ingress();
         return this->transaction_message_queue.empty();
     }
 
     bool contains_transaction_messages(const CiString<36> transaction_id) {
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
-        for (const auto control_message : this->transaction_message_queue) {
-            if (control_message->messageType == v201::MessageType::TransactionEvent) {
-                v201::TransactionEventRequest req = control_message->message.at(CALL_PAYLOAD);
-                if (req.transactionInfo.transactionId == transaction_id) {
-                    return true;
-                }
+        this->drain_ingress();
+        if (this->transaction_message_queue.contains_transaction(transaction_id.get())) {
+            return true;
+        }
+        for (const auto& [unique_id, replayed] : this->replay_in_flight) {
+            if (replayed.message->transaction_id() == transaction_id.get()) {
+                return true;
             }
         }
         return false;
@@ -994,15 +1789,36 @@ public:
 
     bool contains_stop_transaction_message(const int32_t transaction_id) {
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
-        for (const auto control_message : this->transaction_message_queue) {
-            if (control_message->messageType == v16::MessageType::StopTransaction) {
-                v16::StopTransactionRequest req = control_message->message.at(CALL_PAYLOAD);
-                if (req.transactionId == transaction_id) {
-                    return true;
-                }
-            }
-        }
-        return false;
+        this->drain_ingress();
+        const auto count =
+            this->transaction_message_queue.count(std::to_string(transaction_id), v16::MessageType::StopTransaction);
+        return count > 0;
+    }
+
+    /// \brief Registers a \p callback that is called with the progress of a pipelined replay of queued messages. It is
+    /// called periodically while the replay is running and once when it has finished
+    void register_replay_progress_callback(const std::function<void(const ReplayProgress& progress)>& callback) {
+        std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        this->replay_progress_callback = callback;
+    }
+
+    /// \brief Registers a \p callback that sends json text. If it is set, CALLs, CALLRESULTs and CALLERRORs are written
+    /// to json text directly instead of being converted to json objects first and are sent with this callback instead
+    /// of the send_callback. The callback may return before the message has been written. For a CALL it gets an
+    /// on_sent callback, which it has to call with false if the CALL is dropped after the callback returned true. For
+    /// CALLRESULTs and CALLERRORs on_sent is nullptr. Must be registered before the queue is started
+    void register_serialized_send_callback(
+        const std::function<bool(const std::string& message, const std::function<void(bool sent)>& on_sent)>&
+            callback) {
+        this->serialized_send_callback = callback;
+    }
+
+    /// \brief Registers a \p callback that lets the transport provide the buffer that a message is written into. If it
+    /// is set, CALLRESULTs and CALLERRORs are written into that buffer so that they are not copied before being sent.
+    /// Must be registered before the queue is started
+    void register_writer_send_callback(
+        const std::function<bool(const std::function<void(JsonWriter& writer)>& write)>& callback) {
+        this->writer_send_callback = callback;
     }
 
     /// \brief Set transaction_message_attempts to given \p transaction_message_attempts
@@ -1015,6 +1831,12 @@ public:
         this->config.transaction_message_retry_interval = transaction_message_retry_interval;
     }
 
+    /// \brief Commits all pending updates of the persisted message queue to the database
+    void flush() {
+        this->db_flush_timer.stop();
+        this->flush_persisted_message_updates();
+    }
+
     /// \brief Set message_timeout to given \p timeout (in seconds)
     void update_message_timeout(const int timeout) {
         this->config.message_timeout_seconds = timeout;
@@ -1054,15 +1876,15 @@ public:
         // replace transaction id in meter values if start_transaction_message_id is present in map
         // this is necessary when the chargepoint queued MeterValue.req for a transaction with unknown transaction_id
         std::lock_guard<std::recursive_mutex> lk(this->message_mutex);
+        this->drain_ingress();
         if (this->start_transaction_mid_meter_values_mid_map.count(start_transaction_message_id)) {
-            for (auto it = this->transaction_message_queue.begin(); it != transaction_message_queue.end(); ++it) {
-                for (const auto& meter_value_message_id :
-                     this->start_transaction_mid_meter_values_mid_map.at(start_transaction_message_id)) {
-
-                    if (meter_value_message_id == (*it)->message.at(1)) {
-                        EVLOG_debug << "Adding transactionId " << transaction_id << " to MeterValue.req";
-                        (*it)->message.at(3)["transactionId"] = transaction_id;
-                    }
+            for (const auto& meter_value_message_id :
+                 this->start_transaction_mid_meter_values_mid_map.at(start_transaction_message_id)) {
+                const auto it = this->transaction_message_queue.find(meter_value_message_id);
+                if (it != this->transaction_message_queue.end()) {
+                    EVLOG_debug << "Adding transactionId " << transaction_id << " to MeterValue.req";
+                    (*it)->json_message().at(3)["transactionId"] = transaction_id;
+                    this->transaction_message_queue.reindex(it);
                 }
             }
         }
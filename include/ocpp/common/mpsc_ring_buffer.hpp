@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace ocpp {
+
+/// \brief Bounded lock-free ring buffer for multiple producers and a single consumer.
+///
+/// Producers never block: try_push() either claims a slot with a single CAS or fails if the ring is full. Every slot
+/// carries a sequence number that tells producers and the consumer whether the slot is free or holds a value, so that
+/// a slow producer that claimed a slot but has not written it yet does not corrupt the order. try_pop() and empty()
+/// must only be called by one consumer at a time.
+template <typename T> class MpscRingBuffer {
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static size_t round_up_to_power_of_two(size_t capacity) {
+        size_t result = 2;
+        while (result < capacity) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    const size_t mask;
+    std::unique_ptr<Slot[]> slots;
+    // producer and consumer positions are kept on separate cache lines
+    alignas(64) std::atomic<size_t> enqueue_position{0};
+    alignas(64) size_t dequeue_position{0};
+
+public:
+    /// \brief Creates a ring buffer that can hold at least \p capacity elements
+    explicit MpscRingBuffer(const size_t capacity) :
+        mask(round_up_to_power_of_two(capacity) - 1), slots(std::make_unique<Slot[]>(mask + 1)) {
+        for (size_t i = 0; i <= this->mask; i++) {
+            this->slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingBuffer(const MpscRingBuffer&) = delete;
+    MpscRingBuffer& operator=(const MpscRingBuffer&) = delete;
+
+    /// \brief Appends \p value to the ring buffer without blocking. Can be called concurrently by any thread.
+    /// \return false if the ring buffer is full, \p value is left untouched in this case
+    bool try_push(T& value) {
+        Slot* slot;
+        size_t position = this->enqueue_position.load(std::memory_order_relaxed);
+        for (;;) {
+            slot = &this->slots[position & this->mask];
+            const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0) {
+                if (this->enqueue_position.compare_exchange_weak(position, position + 1,
+                                                                 std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;
+            } else {
+                position = this->enqueue_position.load(std::memory_order_relaxed);
+            }
+        }
+        slot->value = std::move(value);
+        slot->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// \brief Removes the oldest element from the ring buffer and stores it in \p value. Consumer only.
+    /// \return false if the ring buffer is empty
+    bool try_pop(T& value) {
+        Slot& slot = this->slots[this->dequeue_position & this->mask];
+        const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != this->dequeue_position + 1) {
+            return false;
+        }
+        value = std::move(slot.value);
+        slot.value = T{};
+        slot.sequence.store(this->dequeue_position + this->mask + 1, std::memory_order_release);
+        this->dequeue_position++;
+        return true;
+    }
+
+    /// \brief Indicates if there is no element that can be popped. Consumer only.
+    bool empty() const {
+        const Slot& slot = this->slots[this->dequeue_position & this->mask];
+        return slot.sequence.load(std::memory_order_acquire) != this->dequeue_position + 1;
+    }
+
+    /// \brief Returns the number of elements the ring buffer can hold
+    size_t capacity() const {
+        return this->mask + 1;
+    }
+};
+
+} // namespace ocpp
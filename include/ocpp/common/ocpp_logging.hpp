@@ -3,14 +3,25 @@
 #ifndef OCPP_COMMON_LOGGING_HPP
 #define OCPP_COMMON_LOGGING_HPP
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <string_view>
+#include <ocpp/common/binary_message_log.hpp>
+#include <ocpp/common/log_file_rotator.hpp>
+#include <ocpp/common/message_correlation_index.hpp>
+#include <ocpp/common/mpsc_ring_buffer.hpp>
 #include <ocpp/common/types.hpp>
 #include <thread>
+#include <vector>
 
 namespace ocpp {
 
@@ -20,24 +31,61 @@ struct FormattedMessageWithType {
     std::string message;      ///< The message content
 };
 
-/// Configuration for log rotation
-struct LogRotationConfig {
-    bool date_suffix; ///< If set to true the log rotation files use a date after the ".", if not use the traditional
-                      ///< .0, .1 ... style
-    uint64_t
-        maximum_file_size_bytes; ///< The maximum size of the log file in bytes after which the file will be rotated
-    uint64_t maximum_file_count; ///< The maximum number of log files to keep in rotation
-
-    LogRotationConfig(bool date_suffix, uint64_t maximum_file_size_bytes, uint64_t maximum_file_count) :
-        date_suffix(date_suffix),
-        maximum_file_size_bytes(maximum_file_size_bytes),
-        maximum_file_count(maximum_file_count) {
+/// Default number of messages that can be queued for the writer thread of the message log
+constexpr size_t DEFAULT_LOG_QUEUE_CAPACITY = 1024;
+
+/// What the message log does with a message when its queue is full
+enum class LogQueueFullPolicy {
+    Block, ///< The logging thread waits until the writer thread has made room, no message is lost
+    Drop,  ///< The message is dropped, the writer thread logs how many messages have been dropped
+};
+
+/// Configuration of the queue between the threads that log messages and the thread that writes the message log
+struct LogQueueConfig {
+    /// Maximum number of queued messages, 0 writes the log synchronously on the logging thread
+    size_t capacity;
+    /// What happens to a message when the queue is full. Security events always wait for room
+    LogQueueFullPolicy full_policy;
+
+    explicit LogQueueConfig(size_t capacity = DEFAULT_LOG_QUEUE_CAPACITY,
+                            LogQueueFullPolicy full_policy = LogQueueFullPolicy::Block) :
+        capacity(capacity), full_policy(full_policy) {
     }
 };
 
 /// \brief contains a ocpp message logging abstraction
 class MessageLogging {
 private:
+    /// \brief A message that is handed over to the writer thread
+    struct LogRecord {
+        /// 0 for ChargePoint, 1 for CentralSystem, 2 for SYS and 3 for security messages
+        unsigned int typ = 0;
+        std::string message_type;
+        std::string json_str;
+        /// When the message was logged, not when it was written
+        std::chrono::time_point<date::utc_clock> timestamp;
+        /// Only set for the marker of flush(), fulfilled once the records before it have been written
+        std::shared_ptr<std::promise<void>> flushed;
+        /// When the message was logged on the steady clock, to measure the response times of the CALLs
+        std::chrono::steady_clock::time_point steady_timestamp = std::chrono::steady_clock::now();
+    };
+
+    /// \brief A message formatted once and written to the log of this object and to all session logs
+    struct FormattedRecord {
+        /// 0 for ChargePoint, 1 for CentralSystem and 2 for SYS messages
+        unsigned int typ = 0;
+        std::string origin;
+        std::string target;
+        std::string timestamp;
+        std::string message_type;
+        std::string message;
+        /// The complete row of the html log, only set if a html log is written
+        std::string html_entry;
+    };
+
+    /// \brief Maximum number of records the writer thread writes before it flushes the files
+    static constexpr size_t WRITE_BATCH_SIZE = 64;
+
     bool log_messages;
     std::string message_log_path; // FIXME: use fs::path here
     std::string output_file_name;
@@ -45,36 +93,92 @@ private:
     bool detailed_log_to_console;
     bool log_to_file;
     bool log_to_html;
+    bool log_to_binary;
     bool log_security;
     bool session_logging;
     std::filesystem::path log_file;
     std::ofstream log_os;
     std::filesystem::path html_log_file;
     std::ofstream html_log_os;
+    std::filesystem::path binary_log_file;
+    std::ofstream binary_log_os;
     std::filesystem::path security_log_file;
     std::ofstream security_log_os;
     std::mutex output_file_mutex;
     std::function<void(const std::string& message, MessageDirection direction)> message_callback;
-    std::map<std::string, std::string> lookup_map;
+    MessageCorrelationIndex correlation_index;
     std::recursive_mutex session_id_logging_mutex;
     std::map<std::string, std::shared_ptr<MessageLogging>> session_id_logging;
-    bool rotate_logs;
-    bool date_suffix;
-    std::string logfile_basename;
-    uint64_t maximum_file_size_bytes;
-    uint64_t maximum_file_count;
+    std::optional<LogRotationConfig> log_rotation_config;
+    // Only set for the files that are rotated
+    std::unique_ptr<LogFileRotator> log_rotator;
+    std::unique_ptr<LogFileRotator> html_log_rotator;
+    std::unique_ptr<LogFileRotator> binary_log_rotator;
+    std::unique_ptr<LogFileRotator> security_log_rotator;
+    // Only set if messages are written by the writer thread, otherwise they are written on the logging thread
+    std::unique_ptr<MpscRingBuffer<LogRecord>> queue;
+    LogQueueFullPolicy queue_full_policy;
+    std::thread writer_thread;
+    std::atomic_bool writer_running;
+    // Set while the writer thread waits for records, only then producers take the writer_mutex to wake it
+    std::atomic_bool writer_waiting;
+    std::mutex writer_mutex;
+    std::condition_variable writer_cv;
+    std::mutex queue_space_mutex;
+    std::condition_variable queue_space_cv;
+    std::atomic<int> blocked_producers;
+    std::atomic<uint64_t> dropped_messages;
+
+    /// \brief Initialize the OCPP message logging, starts the writer thread if the queue has a \p queue_capacity
+    void initialize(size_t queue_capacity);
+
+    /// \brief Hands the given \p record over to the writer thread, or writes it directly if there is none
+    void enqueue(LogRecord record);
+
+    /// \brief Pushes the given \p record to the queue, waits for room if it is full and \p block is set
+    /// \returns false if the queue is full and the record has not been queued
+    bool push(LogRecord& record, bool block);
+
+    /// \brief Wakes the writer thread if it is waiting for records
+    void wake_writer();
+
+    /// \brief Writes the queued records in batches until the logging is destroyed
+    void run_writer();
+
+    /// \brief Formats the given \p record once and writes it to the configured targets and the session logs, without
+    /// flushing the files. output_file_mutex has to be held
+    void write_record(const LogRecord& record);
 
-    /// \brief Initialize the OCPP message logging
-    void initialize();
+    /// \brief Flushes the files the messages are written to, including the session logs. output_file_mutex has to be
+    /// held
+    void flush_output();
 
-    /// \brief Output log message to the configured targets
-    void log_output(unsigned int typ, const std::string& message_type, const std::string& json_str);
+    /// \brief Appends the unformatted \p record to the binary log
+    void log_binary(const LogRecord& record);
+
+    /// \brief Output the formatted \p record to the configured targets
+    void log_output(const FormattedRecord& record);
+
+    /// \returns the row of the html log for the given \p record
+    std::string format_html_entry(const FormattedRecord& record);
 
     /// \brief HTML encode the provided message \p msg
     std::string html_encode(const std::string& msg);
 
-    /// \brief Format the given \p json_str with the given \p message_type
-    FormattedMessageWithType format_message(const std::string& message_type, const std::string& json_str);
+    /// \brief Format the message of the given \p record and correlate it with its CALL if it is a response
+    FormattedMessageWithType format_message(const LogRecord& record);
+
+    /// \brief Correlates the message of the given \p record with its CALL if it is a response, without formatting it.
+    /// Only the header of the message is parsed
+    void correlate_header(const LogRecord& record);
+
+    /// \brief Adds the parsed message \p json_object of the given \p record to the correlation index if it is a CALL,
+    /// or takes its CALL from the index if it is a response
+    /// \returns the message type to log, the action of a CALL or of the CALL a CALLRESULT answers
+    std::optional<std::string> correlate_message(const json& json_object, const LogRecord& record);
+
+    /// \brief Writes the response time percentiles of the CSMS as SYS messages
+    void log_response_time_stats();
 
     /// \brief Add opening html tags to the given stream \p os
     void open_html_tags(std::ofstream& os);
@@ -82,32 +186,33 @@ private:
     /// \brief Add closing html tags to the given stream \p os
     void close_html_tags(std::ofstream& os);
 
-    /// \returns a datetime string in YearMonthDayHourMinuteSecond format
-    std::string get_datetime_string();
-
     /// \returns file size of the given path or 0 if the file does not exist
     std::uintmax_t file_size(const std::filesystem::path& path);
 
-    /// \brief Rotates the log at the given file \p file_basename and remove oldest file if there are more log files
-    /// than the maximum
-    void rotate_log(const std::string& file_basename);
+    /// \returns a rotator for the given \p path if log rotation is configured, nullptr otherwise
+    std::unique_ptr<LogFileRotator> make_rotator(const std::filesystem::path& path);
 
-    /// \brief Rotates the log at the given \p path if needed based on the config, closing the stream \p os before
-    void rotate_log_if_needed(const std::filesystem::path& path, std::ofstream& os);
+    /// \brief Adds the given number of \p bytes written to the file of the \p rotator, if it is rotated
+    static void add_written(const std::unique_ptr<LogFileRotator>& rotator, std::uintmax_t bytes);
 
-    /// \brief Rotates the log at the given \p path if needed based on the config, calling \p before_close_of_os before
-    /// closing the stream \p os and calling \p after_open_of_os afterwards
-    void rotate_log_if_needed(const std::filesystem::path& path, std::ofstream& os,
+    /// \brief Rotates the log of the given \p rotator if needed, closing the stream \p os before
+    void rotate_log_if_needed(const std::unique_ptr<LogFileRotator>& rotator, std::ofstream& os);
+
+    /// \brief Rotates the log of the given \p rotator if needed, calling \p before_close_of_os before closing the
+    /// stream \p os and calling \p after_open_of_os afterwards
+    void rotate_log_if_needed(const std::unique_ptr<LogFileRotator>& rotator, std::ofstream& os,
                               std::function<void(std::ofstream& os)> before_close_of_os,
                               std::function<void(std::ofstream& os)> after_open_of_os);
 
 public:
-    /// \brief Creates a new MessageLogging object with the provided configuration
+    /// \brief Creates a new MessageLogging object with the provided configuration. Messages are written unformatted to
+    /// a binary log as well if \p log_to_binary is set
     explicit MessageLogging(
         bool log_messages, const std::string& message_log_path, const std::string& output_file_name,
         bool log_to_console, bool detailed_log_to_console, bool log_to_file, bool log_to_html, bool log_security,
         bool session_logging,
-        std::function<void(const std::string& message, MessageDirection direction)> message_callback);
+        std::function<void(const std::string& message, MessageDirection direction)> message_callback,
+        LogQueueConfig log_queue_config = LogQueueConfig(), bool log_to_binary = false);
 
     /// \brief Creates a new MessageLogging object with the provided configuration and enabled log rotation
     explicit MessageLogging(
@@ -115,14 +220,18 @@ public:
         bool log_to_console, bool detailed_log_to_console, bool log_to_file, bool log_to_html, bool log_security,
         bool session_logging,
         std::function<void(const std::string& message, MessageDirection direction)> message_callback,
-        LogRotationConfig log_rotation_config);
+        LogRotationConfig log_rotation_config, LogQueueConfig log_queue_config = LogQueueConfig(),
+        bool log_to_binary = false);
+
+    /// \brief Writes the messages that are still queued and closes the log files
     ~MessageLogging();
 
-    /// \brief Log a message originating from the charge point
-    void charge_point(const std::string& message_type, const std::string& json_str);
+    /// \brief Log a message originating from the charge point. The message is copied once into the log record, so
+    /// it can be logged directly from a send buffer
+    void charge_point(std::string_view message_type, std::string_view json_str);
 
     /// \brief Log a message originating from the central system
-    void central_system(const std::string& message_type, const std::string& json_str);
+    void central_system(std::string_view message_type, std::string_view json_str);
 
     /// \brief Log a system message
     void sys(const std::string& msg);
@@ -130,6 +239,16 @@ public:
     /// \brief Log a security message
     void security(const std::string& msg);
 
+    /// \brief Log a message that has been read from a binary log, keeping its original timestamp
+    void replay(const BinaryLogRecord& record);
+
+    /// \brief Waits until all messages that have been logged before have been written
+    void flush();
+
+    /// \returns the response time percentiles of the CSMS per action, calculated from the logged messages. The
+    /// responses are correlated with their CALLs no matter which logs are written
+    std::map<std::string, ResponseTimeStats> get_response_time_stats();
+
     /// \brief Start session logging (without log rotation)
     void start_session_logging(const std::string& session_id, const std::string& log_path);
 
@@ -8,6 +8,7 @@
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <string_view>
 
 namespace ocpp {
 
@@ -37,6 +38,12 @@ public:
         return data;
     }
 
+    /// \brief Provides a view of the string without copying it
+    /// \returns a std::string_view that is valid as long as this string is not modified
+    std::string_view view() const {
+        return data;
+    }
+
     /// \brief Sets the content of the string to the given \p data
     void set(const std::string& data) {
         if (data.length() <= this->length) {
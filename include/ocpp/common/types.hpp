@@ -146,7 +146,7 @@ public:
     /// \param str input string that failed to convert
     /// \param type name of the enum trying to convert to
     StringToEnumException(std::string_view str, std::string_view type) :
-        EnumConversionException{std::string{"Provided string '"} + str.data() + "' could not be converted to " +
+        EnumConversionException{std::string{"Provided string '"} + std::string{str} + "' could not be converted to " +
                                 type.data()} {
     }
 };
@@ -438,6 +438,15 @@ struct TriggerMeterValue {
     friend void from_json(const json& j, TriggerMeterValue& t);
 };
 
+/// \brief Contains the progress of a pipelined replay of queued messages
+struct ReplayProgress {
+    size_t total;                      ///< Number of messages that were queued when the replay started
+    size_t delivered;                  ///< Number of messages for which a response has been received
+    size_t remaining;                  ///< Number of messages that are still queued or in flight
+    std::chrono::milliseconds elapsed; ///< Time since the replay started
+    double messages_per_second;        ///< Average throughput since the replay started
+};
+
 enum class CaCertificateType {
     V2G,
     MO,
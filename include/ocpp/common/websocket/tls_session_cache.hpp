@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_TLS_SESSION_CACHE_HPP
+#define OCPP_TLS_SESSION_CACHE_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+struct ssl_ctx_st;
+struct ssl_session_st;
+
+namespace ocpp {
+
+/// \brief Client side cache of TLS sessions, so that a reconnect can resume the previous session with an abbreviated
+/// handshake instead of a full handshake. The sessions are kept serialized and can be persisted to a file to survive
+/// restarts. The file contains the session secrets and is only readable by its owner. New sessions are written to
+/// the file at most once per SAVE_INTERVAL, the remaining ones when the cache is flushed or destroyed
+class TlsSessionCache : public std::enable_shared_from_this<TlsSessionCache> {
+private:
+    /// \brief A serialized session and when it was last stored or resumed, to evict the least recently used one
+    struct Session {
+        std::vector<unsigned char> der;
+        uint64_t last_used;
+    };
+
+    /// \brief The sessions to write to the file, ordered from the least to the most recently used
+    using Snapshot = std::vector<std::pair<std::string, std::vector<unsigned char>>>;
+
+    std::optional<std::filesystem::path> file;
+    std::map<std::string, Session> sessions;
+    uint64_t use_counter;
+    // If sessions have changed since they were written to the file
+    bool dirty;
+    std::optional<std::chrono::steady_clock::time_point> saved_at;
+    std::mutex sessions_mutex;
+    // Serializes the writes of the file, which are done without the sessions_mutex
+    std::mutex file_mutex;
+
+    /// \brief Loads the sessions that are not expired yet from the file
+    void load();
+
+    /// \brief Provides the sessions to write to the file and marks them as saved, must be called with the lock held
+    Snapshot take_snapshot();
+
+    /// \brief Writes the given \p snapshot to a temporary file that replaces the file
+    void save(const Snapshot& snapshot);
+
+public:
+    /// \brief Maximum number of cached sessions, one per server and client identity
+    static constexpr size_t MAX_SESSIONS = 16;
+
+    /// \brief Minimum time between two writes of the file. A server sends a few tickets with every connection, which
+    /// are not worth a write each
+    static constexpr std::chrono::seconds SAVE_INTERVAL{10};
+
+    /// \brief Creates a new TlsSessionCache that persists its sessions to the given \p file if it is set. Sessions
+    /// that have been saved to it before are loaded
+    explicit TlsSessionCache(const std::optional<std::filesystem::path>& file);
+
+    /// \brief Writes the sessions that have not been written to the file yet
+    ~TlsSessionCache();
+
+    /// \brief Provides the file the sessions are persisted to
+    const std::optional<std::filesystem::path>& get_file() const;
+
+    /// \brief Makes the connections of the given client \p ctx resume the session that is cached for \p key and
+    /// store the sessions they receive under \p key. The key has to identify the server and the client identity, a
+    /// session must not be resumed with another client certificate
+    void attach(ssl_ctx_st* ctx, const std::string& key);
+
+    /// \brief Stores the given \p session under \p key, replaces the session that was stored before. If the cache is
+    /// full the least recently used session is evicted
+    void store(const std::string& key, ssl_session_st* session);
+
+    /// \brief Provides the session stored under \p key, nullptr if there is none or it has expired. A TLS 1.3
+    /// session is removed from the cache since its ticket should only be used once, the resumed connection receives
+    /// new tickets. The caller owns the returned session
+    ssl_session_st* take(const std::string& key);
+
+    /// \brief Writes the sessions that have not been written to the file yet, without waiting for the SAVE_INTERVAL
+    void flush();
+
+    /// \brief Provides the number of cached sessions
+    size_t size();
+};
+
+} // namespace ocpp
+
+#endif // OCPP_TLS_SESSION_CACHE_HPP
@@ -62,6 +62,25 @@ public:
     /// \returns true if the message was sent successfully
     bool send(const std::string& message);
 
+    /// \brief send a \p message over the websocket without waiting until it has been written. The optional \p on_sent
+    /// callback is called with true once the message has been written or with false if it has been dropped
+    /// \returns true if the message was accepted for sending
+    bool send_async(const std::string& message, const std::function<void(bool sent)>& on_sent = nullptr);
+
+    /// \brief send a message that is written by \p write directly into a send buffer of the websocket
+    /// \returns true if the message was accepted for sending
+    bool send_async(const std::function<void(JsonWriter& writer)>& write,
+                    const std::function<void(bool sent)>& on_sent = nullptr);
+
+    /// \brief Provides the number of accepted messages that have not been written yet
+    size_t get_send_queue_depth();
+
+    /// \brief Provides the compression statistics of the current connection
+    WebsocketCompressionStats get_compression_stats();
+
+    /// \brief Provides a snapshot of the transport metrics of the websocket
+    WebsocketMetrics get_metrics();
+
     /// \brief set the websocket ping interval \p interval_s in seconds
     void set_websocket_ping_interval(int32_t interval_s);
 
@@ -3,6 +3,7 @@
 #ifndef OCPP_WEBSOCKET_BASE_HPP
 #define OCPP_WEBSOCKET_BASE_HPP
 
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -10,11 +11,21 @@
 
 #include <everest/timer.hpp>
 
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/common/websocket/websocket_uri.hpp>
 
 namespace ocpp {
 
+/// \brief Default maximum size of the frames an outgoing message is split into
+constexpr size_t DEFAULT_WEBSOCKET_MAX_FRAGMENT_SIZE = 64 * 1024;
+
+/// \brief Default maximum number of messages that are queued for a websocket but not written yet
+constexpr size_t DEFAULT_WEBSOCKET_MAX_SEND_QUEUE_SIZE = 1000;
+
+/// \brief Default number of workers of the event loop that is shared by the websockets of a process
+constexpr size_t DEFAULT_WEBSOCKET_EVENT_LOOP_WORKERS = 4;
+
 struct WebsocketConnectionOptions {
     OcppProtocolVersion ocpp_version;
     Uri csms_uri;         // the URI of the CSMS
@@ -38,6 +49,91 @@ struct WebsocketConnectionOptions {
     std::optional<std::string> iface; // Optional interface where the socket is created. Only usable for libwebsocket
     bool enable_tls_keylog = false;   ///< If set to true enables logging of TLS secrets to the keylog_file
     std::optional<std::filesystem::path> keylog_file; ///< Optional path to a keylog file
+    /// Outgoing messages larger than this are sent as continuation frames of at most this size, so that a large
+    /// message does not delay pings. 0 disables fragmentation. Only usable for libwebsocket
+    size_t max_fragment_size = DEFAULT_WEBSOCKET_MAX_FRAGMENT_SIZE;
+    /// Messages that are not written yet, beyond which send_async() rejects further messages until the queue has
+    /// drained. Pings are always queued. 0 does not limit the queue. Only usable for libwebsocket
+    size_t max_send_queue_size = DEFAULT_WEBSOCKET_MAX_SEND_QUEUE_SIZE;
+    /// If set to true the permessage-deflate extension is offered to the CSMS. Only usable for libwebsocket
+    bool enable_compression = false;
+    int compression_window_bits = 15; ///< The client_max_window_bits (8-15) offered with permessage-deflate
+    int compression_level = 6;        ///< zlib compression level (1-9) of sent messages
+    /// If set to true the connection is served by the event loop that is shared by all websockets of the process
+    /// instead of its own threads, e.g. to simulate many charge points. Only usable for libwebsocket
+    bool use_shared_event_loop = false;
+    /// Number of workers of the shared event loop, taken from the websocket that creates it. The loop is destroyed
+    /// once all websockets have released it
+    size_t shared_event_loop_workers = DEFAULT_WEBSOCKET_EVENT_LOOP_WORKERS;
+    /// If set to true TLS sessions are cached and resumed on reconnects, which saves the full handshake with the
+    /// private key. Only usable for libwebsocket
+    bool enable_tls_session_resumption = false;
+    /// Optional file the TLS sessions are persisted to, so that they can be resumed after a restart
+    std::optional<std::filesystem::path> tls_session_cache_file;
+};
+
+/// \brief Statistics of the permessage-deflate compression of a websocket connection
+struct WebsocketCompressionStats {
+    bool negotiated = false;          ///< If the CSMS accepted permessage-deflate for the connection
+    uint64_t tx_payload_bytes = 0;    ///< Uncompressed payload bytes of sent messages
+    uint64_t tx_compressed_bytes = 0; ///< Compressed payload bytes of sent messages
+    uint64_t rx_payload_bytes = 0;    ///< Uncompressed payload bytes of received messages
+    uint64_t rx_compressed_bytes = 0; ///< Compressed payload bytes of received messages
+
+    /// \brief Provides the ratio of uncompressed to compressed bytes of sent messages, 0 if nothing was compressed
+    double tx_ratio() const;
+
+    /// \brief Provides the ratio of uncompressed to compressed bytes of received messages, 0 if nothing was
+    /// compressed
+    double rx_ratio() const;
+};
+
+/// \brief Aggregated durations of a websocket metric
+struct WebsocketLatencyStats {
+    uint64_t count = 0;                 ///< Number of recorded durations
+    std::chrono::microseconds total{0}; ///< Sum of the recorded durations
+    std::chrono::microseconds max{0};   ///< Longest recorded duration
+    std::chrono::microseconds last{0};  ///< Most recently recorded duration
+
+    /// \brief Records the given \p duration
+    void record(std::chrono::steady_clock::duration duration);
+
+    /// \brief Provides the mean of the recorded durations, 0 if nothing was recorded
+    std::chrono::microseconds mean() const;
+};
+
+/// \brief Transport metrics of a websocket, accumulated over all of its connections. Can be compared with the
+/// response times of the CSMS to tell a slow CSMS from a backlog in our own send queue
+struct WebsocketMetrics {
+    uint64_t messages_sent = 0;     ///< Messages that have been written completely
+    uint64_t messages_dropped = 0;  ///< Messages that were queued but could not be written, e.g. after a disconnect
+    uint64_t messages_rejected = 0; ///< Messages that were not queued because the send queue was full
+    uint64_t messages_received = 0; ///< Complete messages that have been received
+    uint64_t frames_sent = 0;       ///< Frames handed to the transport, including continuation frames and pings
+    uint64_t frames_received = 0;   ///< Frames that have been received completely
+    uint64_t bytes_sent = 0;        ///< Payload bytes of the sent frames
+    uint64_t bytes_received = 0;    ///< Payload bytes of the received frames
+    size_t send_queue_depth = 0;    ///< Messages that are queued but not written yet at the time of the snapshot
+    uint64_t reconnects = 0;        ///< Reconnect attempts that have been scheduled
+
+    uint64_t tls_handshakes = 0;         ///< Established TLS connections, with a full or an abbreviated handshake
+    uint64_t tls_resumed_handshakes = 0; ///< Established TLS connections that resumed a cached session
+
+    /// Time a frame waited until it was handed to the transport, since its message was queued for the first frame and
+    /// since the previous frame was written for the continuation frames
+    WebsocketLatencyStats frame_queue_time;
+    WebsocketLatencyStats write_completion_time; ///< Time from queueing a message until it was written completely
+    WebsocketLatencyStats ping_rtt;              ///< Round trip time from writing a ping until its pong was received
+    /// Time from starting a connection until the websocket handshake was completed, including the TCP connect and
+    /// the TLS handshake
+    WebsocketLatencyStats time_to_connect;
+
+    /// permessage-deflate statistics of the current connection at the time of the snapshot
+    WebsocketCompressionStats compression;
+
+    /// \brief Provides the share of TLS connections that resumed a cached session instead of a full handshake, 0 if
+    /// there was no TLS connection
+    double tls_resumption_ratio() const;
 };
 
 ///
@@ -60,6 +156,8 @@ protected:
     std::atomic_int connection_attempts;
     std::atomic_bool shutting_down;
     std::atomic_bool reconnecting;
+    WebsocketMetrics metrics;
+    std::mutex metrics_mutex;
 
     /// \brief Indicates if the required callbacks are registered
     /// \returns true if the websocket is properly initialized
@@ -81,6 +179,13 @@ protected:
     /// \brief send a websocket ping
     virtual void ping() = 0;
 
+    /// \brief starts sending a websocket ping every \p interval_s. The default implementation uses a timer thread that
+    /// is created with the first ping interval
+    virtual void start_ping_timer(int32_t interval_s);
+
+    /// \brief stops sending websocket pings
+    virtual void stop_ping_timer();
+
     /// \brief Called when a websocket pong timeout is received
     void on_pong_timeout(std::string msg);
 
@@ -130,6 +235,33 @@ public:
     /// \returns true if the message was sent successfully
     virtual bool send(const std::string& message) = 0;
 
+    /// \brief send a \p message over the websocket without waiting until it has been written. The \p on_sent callback
+    /// is called with true once the message has been written or with false if the message has been dropped, it may be
+    /// nullptr. A dropped message is not retried by the websocket. \p on_sent is not called if the message is not
+    /// accepted, e.g. because the websocket is not connected or its send queue is full. The default implementation
+    /// sends the message synchronously
+    /// \returns true if the message was accepted for sending
+    virtual bool send_async(const std::string& message, const std::function<void(bool sent)>& on_sent);
+
+    /// \brief send a message that is written by \p write directly into a send buffer of the websocket, so that it
+    /// can be handed to the transport without copying it. \p on_sent is called as for send_async(). The default
+    /// implementation writes the message into a temporary buffer
+    /// \returns true if the message was accepted for sending
+    virtual bool send_async(const std::function<void(JsonWriter& writer)>& write,
+                            const std::function<void(bool sent)>& on_sent);
+
+    /// \brief Provides the number of messages that have been accepted by send_async() but not written yet. Senders
+    /// can use this to throttle themselves instead of blocking until every message has been written
+    virtual size_t get_send_queue_depth();
+
+    /// \brief Provides the compression statistics of the current connection. The default implementation reports that
+    /// no compression was negotiated
+    virtual WebsocketCompressionStats get_compression_stats();
+
+    /// \brief Provides a snapshot of the transport metrics of the websocket. Implementations that do not record
+    /// metrics only report the send queue depth and the compression statistics
+    WebsocketMetrics get_metrics();
+
     /// \brief starts a timer that sends a websocket ping at the given \p interval_s
     void set_websocket_ping_interval(int32_t interval_s);
 
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_WEBSOCKET_EVENT_LOOP_HPP
+#define OCPP_WEBSOCKET_EVENT_LOOP_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ocpp/common/websocket/websocket_worker_pool.hpp>
+
+struct lws_context;
+
+namespace ocpp {
+
+/// \brief A single libwebsockets context with one service thread that serves the connections of many websockets.
+/// Each connection gets its own vhost in the shared context for its TLS configuration. The callbacks of the
+/// connections are dispatched onto a fixed pool of workers, so the number of threads stays constant no matter how
+/// many charge points run in the process
+class WebsocketEventLoop {
+public:
+    /// \brief Identifies a timer of the loop, 0 is never used
+    using TimerId = std::uint64_t;
+
+private:
+    /// \brief Timer that is scheduled in the libwebsockets context, defined with the libwebsockets types
+    struct Timer;
+
+    lws_context* context;
+    std::thread service_thread;
+    std::atomic_bool running;
+
+    std::vector<std::function<void()>> tasks;
+    std::mutex tasks_mutex;
+
+    // Only used from the service thread
+    std::map<TimerId, std::unique_ptr<Timer>> timers;
+    std::atomic<TimerId> next_timer_id;
+
+    std::shared_ptr<WebsocketWorkerPool> workers;
+
+    /// \brief Services the libwebsockets context and runs the posted tasks until the loop is destroyed
+    void run();
+
+    /// \brief Schedules a new timer with the given \p id that runs \p task after \p delay, and again every \p delay if
+    /// it is \p periodic. Must be called from the service thread
+    void start_timer(TimerId id, std::chrono::steady_clock::duration delay, std::function<void()> task,
+                     bool periodic);
+
+    /// \brief Schedules the given \p timer to expire after its delay in the libwebsockets context
+    static void schedule(Timer* timer);
+
+    /// \brief Called by libwebsockets on the service thread when the given \p timer expires
+    static void on_timer(Timer* timer);
+
+public:
+    /// \brief Creates a new WebsocketEventLoop with its own libwebsockets context and \p worker_count workers
+    /// \throws std::runtime_error if the libwebsockets context could not be created
+    explicit WebsocketEventLoop(size_t worker_count);
+
+    ~WebsocketEventLoop();
+
+    /// \brief Provides the event loop that is shared by all websockets of the process. It is created with
+    /// \p worker_count workers if no websocket holds it at the moment, and it is destroyed once the last websocket and
+    /// connection have released it
+    static std::shared_ptr<WebsocketEventLoop> get_shared(size_t worker_count);
+
+    /// \brief Posts the given \p task to the service thread. libwebsockets is not thread safe, everything that uses
+    /// the context or one of its connections has to be done from a task
+    void post(std::function<void()> task);
+
+    /// \brief Runs the given \p task on the service thread and waits until it has finished. The task is run directly
+    /// if this is called from the service thread
+    void run_sync(const std::function<void()>& task);
+
+    /// \brief Runs the given \p task on the service thread once after \p delay. The timers of the loop are driven by
+    /// the libwebsockets context, so that connections don't need a timer thread of their own
+    /// \returns the id to cancel the timer with
+    TimerId timeout(const std::function<void()>& task, std::chrono::steady_clock::duration delay);
+
+    /// \brief Runs the given \p task on the service thread every \p interval until the timer is cancelled
+    /// \returns the id to cancel the timer with
+    TimerId interval(const std::function<void()>& task, std::chrono::steady_clock::duration interval);
+
+    /// \brief Cancels the timer with the given \p id, unknown or expired timers are ignored. The cancellation is
+    /// posted to the service thread, a task that already expired may still run until then. Called from the service
+    /// thread the timer is cancelled right away
+    void cancel(TimerId id);
+
+    /// \brief Indicates if this is called from the service thread
+    bool is_service_thread() const;
+
+    /// \brief Provides the shared libwebsockets context, must only be used from the service thread
+    lws_context* get_context() const;
+
+    /// \brief Creates a new strand that runs the callbacks of a connection in order on the workers of the loop
+    std::shared_ptr<WebsocketStrand> make_strand();
+
+    /// \brief Provides the number of threads of the loop, the service thread and the workers
+    size_t get_thread_count() const;
+};
+
+} // namespace ocpp
+
+#endif // OCPP_WEBSOCKET_EVENT_LOOP_HPP
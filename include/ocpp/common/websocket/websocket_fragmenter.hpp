@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_WEBSOCKET_FRAGMENTER_HPP
+#define OCPP_WEBSOCKET_FRAGMENTER_HPP
+
+#include <cstddef>
+
+namespace ocpp {
+
+/// \brief A part of an outgoing message that is written as a single websocket frame
+struct WebsocketFragment {
+    size_t offset; ///< Offset of the fragment in the message payload
+    size_t length; ///< Number of payload bytes in the fragment
+    bool first;    ///< If this is the first frame of the message, all other frames are continuation frames
+    bool last;     ///< If this is the final frame of the message
+};
+
+/// \brief Splits an outgoing message into websocket fragments of at most a maximum size, so that a large message is
+/// written frame by frame from its buffer. Control frames like pings can be sent between the fragments
+class WebsocketFragmenter {
+private:
+    size_t message_length;
+    size_t max_fragment_size;
+    size_t written;
+    bool started;
+
+public:
+    /// \brief Creates a new WebsocketFragmenter for a message of \p message_length bytes. A \p max_fragment_size of 0
+    /// disables fragmentation, the message is written as a single frame then
+    WebsocketFragmenter(size_t message_length, size_t max_fragment_size);
+
+    /// \brief Indicates if all fragments of the message have been provided by next()
+    bool done() const;
+
+    /// \brief Provides the next fragment of the message. Must not be called once done() is true
+    WebsocketFragment next();
+
+    /// \brief Provides the number of payload bytes of the fragments that have been provided by next()
+    size_t get_written() const;
+};
+
+} // namespace ocpp
+
+#endif // OCPP_WEBSOCKET_FRAGMENTER_HPP
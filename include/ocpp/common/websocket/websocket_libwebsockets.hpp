@@ -5,8 +5,10 @@
 
 #include <ocpp/common/evse_security.hpp>
 #include <ocpp/common/websocket/websocket_base.hpp>
+#include <ocpp/common/websocket/websocket_event_loop.hpp>
 
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -14,11 +16,16 @@
 #include <string>
 
 struct ssl_ctx_st;
+struct lws_context;
+struct lws_context_creation_info;
+struct lws_vhost;
 
 namespace ocpp {
 
 struct ConnectionData;
 struct WebsocketMessage;
+struct BufferPool;
+class TlsSessionCache;
 
 /// \brief Experimental libwebsockets TLS connection
 class WebsocketTlsTPM final : public WebsocketBase {
@@ -43,22 +50,76 @@ public:
     /// \brief closes the websocket
     void close(const WebsocketCloseReason code, const std::string& reason) override;
 
-    /// \brief send a \p message over the websocket
+    /// \brief send a \p message over the websocket, blocks until the message has been written or dropped
     /// \returns true if the message was sent successfully
     bool send(const std::string& message) override;
 
+    /// \brief queue a \p message for sending without waiting until the lws thread has written it. The \p on_sent
+    /// callback is called from the deferred callback thread. A message is not written again once it has been handed
+    /// to libwebsockets, since the payload is masked in place. If its write fails or the connection is closed before
+    /// it has been written, \p on_sent is called with false and the sender has to send it again
+    /// \returns true if the message was queued, false if the websocket is not connected or if max_send_queue_size
+    /// messages are already queued
+    bool send_async(const std::string& message, const std::function<void(bool sent)>& on_sent) override;
+
+    /// \brief queue a message that is written by \p write directly into a pooled send buffer with the headroom
+    /// required by libwebsockets, the buffer is handed to libwebsockets without copying the message
+    /// \returns true if the message was queued
+    bool send_async(const std::function<void(JsonWriter& writer)>& write,
+                    const std::function<void(bool sent)>& on_sent) override;
+
+    /// \brief Provides the number of queued messages that have not been written yet
+    size_t get_send_queue_depth() override;
+
+    /// \brief Provides the permessage-deflate statistics of the current connection
+    WebsocketCompressionStats get_compression_stats() override;
+
     /// \brief send a websocket ping
     void ping() override;
 
+protected:
+    /// \brief starts sending a websocket ping every \p interval_s, from a timer of the shared event loop if the
+    /// websocket uses it
+    void start_ping_timer(int32_t interval_s) override;
+
+    /// \brief stops sending websocket pings
+    void stop_ping_timer() override;
+
 public:
     int process_callback(void* wsi_ptr, int callback_reason, void* user, void* in, size_t len);
 
 private:
     bool tls_init(struct ssl_ctx_st* ctx, const std::string& path_chain, const std::string& path_key, bool custom_key,
                   std::optional<std::string>& password);
+
+    /// \brief Attaches the TLS session cache to the given \p ctx of a new connection, so that it resumes the session
+    /// of the previous connection to the same CSMS with the same client certificate \p path_chain
+    void attach_tls_session_cache(struct ssl_ctx_st* ctx, const std::string& path_chain);
     void client_loop();
     void recv_loop();
 
+    /// \brief Replaces the current connection with new connection data, interrupts the previous connection and
+    /// drops the messages that are still queued for it
+    /// \returns the data of the new connection
+    std::shared_ptr<ConnectionData> replace_connection();
+
+    /// \brief Starts a new connection in the shared event loop without waiting until it is established, called from
+    /// its service thread when the reconnect timer expires. The result is handled in the callbacks of the connection
+    void start_shared_connect();
+
+    /// \brief Connects with the given \p local_data in the shared event loop, called from its service thread
+    void shared_client_connect(const std::shared_ptr<ConnectionData>& local_data);
+
+    /// \brief Sets up the interface, extensions and TLS context of the connection in the given \p info, that is
+    /// used to create the lws context or the vhost of the connection in the shared event loop
+    /// \returns false if the connection failed, the failure has been handled then
+    bool init_connection_info(lws_context_creation_info& info, const std::shared_ptr<ConnectionData>& local_data);
+
+    /// \brief Starts the client connection of the given \p local_data in the \p lws_ctx. \p vhost is the vhost
+    /// of the connection in the shared event loop, or nullptr for the default vhost of an own context
+    /// \returns false if the connection failed, the failure has been handled then
+    bool connect_client(const std::shared_ptr<ConnectionData>& local_data, lws_context* lws_ctx, lws_vhost* vhost);
+
     /// \brief Called when a TLS websocket connection is established, calls the connected callback
     void on_conn_connected();
 
@@ -71,12 +132,35 @@ private:
     /// \brief When the connection can send data
     void on_writable();
 
-    /// \brief Called when a message is received over the TLS websocket, calls the message callback
+    /// \brief Called with every chunk of \p len bytes of \p data that is received over the TLS websocket.
+    /// \p remaining bytes of the current frame are still to be received. The chunks are reassembled into a pooled
+    /// buffer that is handed over with on_message() once the \p final_fragment of the message is complete
+    void on_receive(const char* data, size_t len, size_t remaining, bool final_fragment);
+
+    /// \brief Called when a message is received over the TLS websocket, hands it over to the receiving thread
     void on_message(std::string&& message);
 
+    /// \brief Wakes the receiving thread, e.g. to let it finish after the connection has been interrupted
+    void wake_recv_loop();
+
     void request_write();
 
-    void poll_message(const std::shared_ptr<WebsocketMessage>& msg);
+    /// \brief Queues the given \p msg for the lws thread without waiting for it to be written
+    /// \returns false if the message could not be queued because the websocket is not connected or the queue is full
+    bool queue_message(const std::shared_ptr<WebsocketMessage>& msg);
+
+    /// \brief Marks the given \p msg as sent or dropped depending on \p sent and dispatches its completion callback
+    void complete_message(const std::shared_ptr<WebsocketMessage>& msg, bool sent);
+
+    /// \brief Drops all queued messages that have not been written yet
+    void drop_queued_messages();
+
+    /// \brief Removes the given \p msg from the queue
+    /// \returns false if the message is not queued any more, e.g. because the queue has been dropped
+    bool remove_queued_message(const std::shared_ptr<WebsocketMessage>& msg);
+
+    /// \brief Stops a pending reconnect, must be called with the reconnect_mutex locked
+    void stop_reconnect_timer();
 
     /// \brief Function to handle the deferred callbacks
     void handle_deferred_callback_queue();
@@ -89,18 +173,26 @@ private:
 
     std::function<void()> reconnect_callback;
 
-    // Connection related data
-    Everest::SteadyTimer reconnect_timer_tpm;
+    // Connection related data. The reconnect timer thread is only created if the websocket does not use the shared
+    // event loop, its timers are used otherwise
+    std::unique_ptr<Everest::SteadyTimer> reconnect_timer_tpm;
+    WebsocketEventLoop::TimerId reconnect_timer_id = 0;
+    std::atomic<WebsocketEventLoop::TimerId> ping_timer_id{0};
     std::unique_ptr<std::thread> websocket_thread;
     std::shared_ptr<ConnectionData> conn_data;
     std::condition_variable conn_cv;
 
     std::mutex queue_mutex;
 
-    std::queue<std::shared_ptr<WebsocketMessage>> message_queue;
+    std::deque<std::shared_ptr<WebsocketMessage>> message_queue;
+    std::shared_ptr<BufferPool> send_buffer_pool;
+    std::shared_ptr<BufferPool> recv_buffer_pool;
     std::condition_variable msg_send_cv;
     std::mutex msg_send_cv_mutex;
 
+    // When the last ping was written, to measure the round trip time until its pong. Only used from the lws thread
+    std::optional<std::chrono::steady_clock::time_point> ping_written_at;
+
     std::unique_ptr<std::thread> recv_message_thread;
     std::mutex recv_mutex;
     std::queue<std::string> recv_message_queue;
@@ -112,6 +204,14 @@ private:
     std::mutex deferred_callback_mutex;
     std::condition_variable deferred_callback_cv;
     std::atomic_bool stop_deferred_handler;
+
+    // Only set if the websocket uses the shared event loop instead of its own threads
+    std::shared_ptr<WebsocketEventLoop> event_loop;
+    std::shared_ptr<WebsocketStrand> recv_strand;
+    std::shared_ptr<WebsocketStrand> deferred_strand;
+
+    // Only set if TLS session resumption is enabled, used from the lws thread of the connection being established
+    std::shared_ptr<TlsSessionCache> tls_session_cache;
 };
 
 } // namespace ocpp
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_WEBSOCKET_WORKER_POOL_HPP
+#define OCPP_WEBSOCKET_WORKER_POOL_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ocpp {
+
+/// \brief Fixed number of worker threads that run the callbacks of many websocket connections, so that the number
+/// of threads does not grow with the number of connections
+class WebsocketWorkerPool {
+private:
+    /// \brief Task queue shared with the workers, so that it outlives a pool that is released from one of its tasks
+    struct TaskQueue;
+
+    std::shared_ptr<TaskQueue> queue;
+    std::vector<std::thread> workers;
+
+    static void run(const std::shared_ptr<TaskQueue>& queue);
+
+public:
+    /// \brief Creates a new WebsocketWorkerPool that starts \p worker_count threads, at least one
+    explicit WebsocketWorkerPool(size_t worker_count);
+
+    /// \brief Runs the tasks that have already been posted and joins the worker threads
+    ~WebsocketWorkerPool();
+
+    /// \brief Posts the given \p task, it is run by the next idle worker
+    void post(std::function<void()> task);
+
+    /// \brief Provides the number of worker threads
+    size_t get_worker_count() const;
+};
+
+/// \brief Runs the posted tasks one after the other in the order they were posted on the workers of a
+/// WebsocketWorkerPool. A connection uses strands to get the ordering of a dedicated thread without owning one
+class WebsocketStrand : public std::enable_shared_from_this<WebsocketStrand> {
+private:
+    // Not owned, the last reference to a strand may be released on a worker that can't destroy its own pool
+    std::weak_ptr<WebsocketWorkerPool> pool;
+    std::deque<std::function<void()>> tasks;
+    std::mutex tasks_mutex;
+    std::condition_variable idle_cv;
+    std::thread::id running_thread;
+    bool scheduled;
+    bool stopped;
+
+    /// \brief Runs a batch of the posted tasks on a worker, reschedules itself if more tasks are left so that a busy
+    /// strand does not block the other strands of the pool
+    void run();
+
+    /// \brief Posts the next run() to the pool, the remaining tasks are dropped if the pool has been destroyed
+    void schedule();
+
+public:
+    /// \brief Maximum number of tasks a strand runs before it gives the worker to the next strand
+    static constexpr size_t MAX_TASKS_PER_BATCH = 16;
+
+    /// \brief Creates a new WebsocketStrand that runs its tasks on the given \p pool, the pool has to be kept alive
+    /// by its owner
+    explicit WebsocketStrand(const std::shared_ptr<WebsocketWorkerPool>& pool);
+
+    /// \brief Posts the given \p task, it runs after all tasks that were posted before
+    /// \returns false if the strand has been stopped and the task is not run
+    bool post(std::function<void()> task);
+
+    /// \brief Stops the strand after all posted tasks have run, tasks posted afterwards are not run. Waits until the
+    /// last task has finished, unless it is called from a task of this strand
+    void stop();
+};
+
+} // namespace ocpp
+
+#endif // OCPP_WEBSOCKET_WORKER_POOL_HPP
@@ -7,6 +7,7 @@
 #include <ocpp/common/evse_security.hpp>
 #include <ocpp/common/evse_security_impl.hpp>
 #include <ocpp/common/support_older_cpp_versions.hpp>
+#include <ocpp/common/websocket/websocket_base.hpp>
 #include <ocpp/v16/charge_point_state_machine.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 #include <ocpp/v16/smart_charging.hpp>
@@ -111,6 +112,10 @@ public:
     /// \brief Disconnects the the websocket connection to the CSMS if it is connected
     void disconnect_websocket();
 
+    /// \brief Provides a snapshot of the transport metrics of the websocket connection to the CSMS, e.g. to correlate
+    /// slow responses of the CSMS with the backlog of our own send queue
+    WebsocketMetrics get_websocket_metrics();
+
     /// \brief Calls the set_connection_timeout_callback that can be registered. This function is used to notify an
     /// Authorization mechanism about a changed ConnectionTimeout configuration key.
     void call_set_connection_timeout();
@@ -549,6 +554,12 @@ public:
     void register_set_display_message_callback(
         const std::function<DataTransferResponse(const std::vector<DisplayMessage>&)> set_display_message_callback);
 
+    /// \brief Registers a \p callback that reports the progress of replaying the queued messages after a reconnect. It
+    /// is only called if MessageQueueReplayWindow is greater than 1
+    /// \param callback
+    void register_message_queue_replay_progress_callback(
+        const std::function<void(const ReplayProgress& progress)>& callback);
+
     /// \brief Delay draining the message queue after reconnecting, so the CSMS can perform post-reconnect checks first
     /// \param delay The delay period (seconds)
     void set_message_queue_resume_delay(std::chrono::seconds delay);
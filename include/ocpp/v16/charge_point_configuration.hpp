@@ -3,12 +3,16 @@
 #ifndef OCPP_V16_CHARGE_POINT_CONFIGURATION_HPP
 #define OCPP_V16_CHARGE_POINT_CONFIGURATION_HPP
 
+#include <atomic>
+#include <functional>
 #include <mutex>
 #include <set>
+#include <unordered_map>
 
 #include <ocpp/common/support_older_cpp_versions.hpp>
 #include <ocpp/v16/ocpp_types.hpp>
 #include <ocpp/v16/types.hpp>
+#include <ocpp/v16/user_config_persister.hpp>
 
 namespace ocpp {
 namespace v16 {
@@ -19,6 +23,7 @@ private:
     json config;
     json custom_schema;
     fs::path user_config_path;
+    std::unique_ptr<UserConfigPersister> user_config_persister;
 
     std::set<SupportedFeatureProfiles> supported_feature_profiles;
     std::map<Measurand, std::vector<Phase>> supported_measurands;
@@ -28,12 +33,25 @@ private:
     std::set<MessageType> supported_message_types_receiving;
     std::recursive_mutex configuration_mutex;
 
+    using KeyValueGetter = std::function<std::optional<KeyValue>()>;
+    /// \brief Getters of the KeyValues of the supported configuration keys indexed by their lower case key
+    std::unordered_map<std::string, KeyValueGetter> key_value_getters;
+    /// \brief Getters of the CostAndPrice configuration keys that are only available if CustomDisplayCostAndPrice is
+    /// enabled, indexed like key_value_getters
+    std::unordered_map<std::string, KeyValueGetter> cost_and_price_key_value_getters;
+
+    // Frequently read configuration values that are kept up to date by their setters
+    std::atomic<int32_t> clock_aligned_data_interval;
+    std::atomic<int32_t> meter_value_sample_interval;
+    std::vector<MeasurandWithPhase> meter_values_aligned_data;
+    std::vector<MeasurandWithPhase> meter_values_sampled_data;
+
     std::vector<MeasurandWithPhase> csv_to_measurand_with_phase_vector(std::string csv);
     bool validate_measurands(const json& config);
     bool measurands_supported(std::string csv);
-    json get_user_config();
     void setInUserConfig(std::string profile, std::string key, json value);
     void init_supported_measurands();
+    void init_key_value_getters();
 
     bool isConnectorPhaseRotationValid(std::string str);
 
@@ -43,6 +61,12 @@ public:
     ChargePointConfiguration(const std::string& config, const fs::path& ocpp_main_path,
                              const fs::path& user_config_path);
 
+    // The getters in key_value_getters capture this
+    ChargePointConfiguration(const ChargePointConfiguration&) = delete;
+    ChargePointConfiguration& operator=(const ChargePointConfiguration&) = delete;
+    ChargePointConfiguration(ChargePointConfiguration&&) = delete;
+    ChargePointConfiguration& operator=(ChargePointConfiguration&&) = delete;
+
     // Internal config options
     std::string getChargePointId();
     KeyValue getChargePointIdKeyValue();
@@ -82,6 +106,9 @@ public:
     KeyValue getLogRotationMaximumFileSizeKeyValue();
     uint64_t getLogRotationMaximumFileCount();
     KeyValue getLogRotationMaximumFileCountKeyValue();
+    bool getLogRotationCompress();
+    uint64_t getLogMessagesQueueSize();
+    std::string getLogMessagesQueueFullPolicy();
     std::vector<ChargingProfilePurposeType> getSupportedChargingProfilePurposeTypes();
     KeyValue getSupportedChargingProfilePurposeTypesKeyValue();
     int32_t getMaxCompositeScheduleDuration();
@@ -106,6 +133,21 @@ public:
     bool getEnableTLSKeylog();
     std::string getTLSKeylogFile();
 
+    int getWebsocketMaxFragmentSize();
+    int getWebsocketMaxSendQueueSize();
+
+    bool getWebsocketCompression();
+    int getWebsocketCompressionWindowBits();
+    int getWebsocketCompressionLevel();
+
+    bool getWebsocketSharedEventLoop();
+    int getWebsocketSharedEventLoopWorkers();
+
+    bool getTLSSessionResumption();
+    std::optional<std::string> getTLSSessionCacheFile();
+
+    int32_t getUserConfigWriteDelay();
+
     int32_t getRetryBackoffRandomRange();
     void setRetryBackoffRandomRange(int32_t retry_backoff_random_range);
     KeyValue getRetryBackoffRandomRangeKeyValue();
@@ -141,6 +183,8 @@ public:
 
     std::optional<int> getMessageQueueSizeThreshold();
     std::optional<KeyValue> getMessageQueueSizeThresholdKeyValue();
+    int getMessageQueueReplayWindow();
+    std::string getDatabaseTuning();
 
     // Core Profile - optional
     std::optional<bool> getAllowOfflineTxForUnknownId();
@@ -480,6 +524,12 @@ public:
     std::vector<KeyValue> get_all_key_value();
 
     ConfigurationStatus set(CiString<50> key, CiString<500> value);
+
+    /// \brief Writes the changed configuration keys that have not been persisted yet to the user config. Changes are
+    /// written behind, up to UserConfigPersister::MAXIMUM_DELAY_FACTOR times UserConfigWriteDelay after they have been
+    /// made, and are lost if the charge point restarts before, so this has to be called before a restart
+    /// \returns true if all changes have been persisted
+    bool flush_user_config();
 };
 
 } // namespace v16
@@ -145,6 +145,8 @@ private:
     /// \brief optional delay to resumption of message queue after reconnecting to the CSMS
     std::chrono::seconds message_queue_resume_delay = std::chrono::seconds(0);
 
+    std::function<void(const ReplayProgress& progress)> message_queue_replay_progress_callback;
+
     // callbacks
     std::function<bool(int32_t connector)> enable_evse_callback;
     std::function<bool(int32_t connector)> disable_evse_callback;
@@ -446,6 +448,9 @@ public:
     /// \brief Disconnects the the websocket connection to the CSMS if it is connected
     void disconnect_websocket();
 
+    /// \brief Provides a snapshot of the transport metrics of the websocket connection to the CSMS
+    WebsocketMetrics get_websocket_metrics();
+
     /// \brief Calls the set_connection_timeout_callback that can be registered. This function is used to notify an
     /// Authorization mechanism about a changed ConnectionTimeout configuration key.
     void call_set_connection_timeout();
@@ -868,6 +873,9 @@ public:
     void register_set_display_message_callback(
         const std::function<DataTransferResponse(const std::vector<DisplayMessage>&)> set_display_message_callback);
 
+    void register_message_queue_replay_progress_callback(
+        const std::function<void(const ReplayProgress& progress)>& callback);
+
     /// \brief Gets the configured configuration key requested in the given \p request
     /// \param request specifies the keys that should be returned. If empty or not set, all keys will be reported
     /// \return a response containing the requested key(s) including the values and unkown keys if present
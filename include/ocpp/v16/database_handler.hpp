@@ -46,6 +46,7 @@ private:
 
     // Runs initialization script and initializes the CONNECTORS and AUTH_LIST_VERSION table.
     void init_sql() override;
+    std::vector<std::string> get_hot_statements() override;
     void init_connector_table();
 
 public:
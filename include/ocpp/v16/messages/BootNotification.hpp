@@ -35,6 +35,9 @@ struct BootNotificationRequest : public ocpp::Message {
 /// \brief Conversion from a given BootNotificationRequest \p k to a given json object \p j
 void to_json(json& j, const BootNotificationRequest& k);
 
+/// \brief Writes the given BootNotificationRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const BootNotificationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given BootNotificationRequest \p k
 void from_json(const json& j, BootNotificationRequest& k);
 
@@ -56,6 +59,9 @@ struct BootNotificationResponse : public ocpp::Message {
 /// \brief Conversion from a given BootNotificationResponse \p k to a given json object \p j
 void to_json(json& j, const BootNotificationResponse& k);
 
+/// \brief Writes the given BootNotificationResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const BootNotificationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given BootNotificationResponse \p k
 void from_json(const json& j, BootNotificationResponse& k);
 
@@ -25,6 +25,9 @@ struct CancelReservationRequest : public ocpp::Message {
 /// \brief Conversion from a given CancelReservationRequest \p k to a given json object \p j
 void to_json(json& j, const CancelReservationRequest& k);
 
+/// \brief Writes the given CancelReservationRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CancelReservationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given CancelReservationRequest \p k
 void from_json(const json& j, CancelReservationRequest& k);
 
@@ -44,6 +47,9 @@ struct CancelReservationResponse : public ocpp::Message {
 /// \brief Conversion from a given CancelReservationResponse \p k to a given json object \p j
 void to_json(json& j, const CancelReservationResponse& k);
 
+/// \brief Writes the given CancelReservationResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CancelReservationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given CancelReservationResponse \p k
 void from_json(const json& j, CancelReservationResponse& k);
 
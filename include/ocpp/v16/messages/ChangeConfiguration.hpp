@@ -27,6 +27,9 @@ struct ChangeConfigurationRequest : public ocpp::Message {
 /// \brief Conversion from a given ChangeConfigurationRequest \p k to a given json object \p j
 void to_json(json& j, const ChangeConfigurationRequest& k);
 
+/// \brief Writes the given ChangeConfigurationRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChangeConfigurationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ChangeConfigurationRequest \p k
 void from_json(const json& j, ChangeConfigurationRequest& k);
 
@@ -46,6 +49,9 @@ struct ChangeConfigurationResponse : public ocpp::Message {
 /// \brief Conversion from a given ChangeConfigurationResponse \p k to a given json object \p j
 void to_json(json& j, const ChangeConfigurationResponse& k);
 
+/// \brief Writes the given ChangeConfigurationResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChangeConfigurationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ChangeConfigurationResponse \p k
 void from_json(const json& j, ChangeConfigurationResponse& k);
 
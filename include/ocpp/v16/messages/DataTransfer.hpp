@@ -29,6 +29,9 @@ struct DataTransferRequest : public ocpp::Message {
 /// \brief Conversion from a given DataTransferRequest \p k to a given json object \p j
 void to_json(json& j, const DataTransferRequest& k);
 
+/// \brief Writes the given DataTransferRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const DataTransferRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given DataTransferRequest \p k
 void from_json(const json& j, DataTransferRequest& k);
 
@@ -49,6 +52,9 @@ struct DataTransferResponse : public ocpp::Message {
 /// \brief Conversion from a given DataTransferResponse \p k to a given json object \p j
 void to_json(json& j, const DataTransferResponse& k);
 
+/// \brief Writes the given DataTransferResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const DataTransferResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given DataTransferResponse \p k
 void from_json(const json& j, DataTransferResponse& k);
 
@@ -25,6 +25,10 @@ struct DiagnosticsStatusNotificationRequest : public ocpp::Message {
 /// \brief Conversion from a given DiagnosticsStatusNotificationRequest \p k to a given json object \p j
 void to_json(json& j, const DiagnosticsStatusNotificationRequest& k);
 
+/// \brief Writes the given DiagnosticsStatusNotificationRequest \p k to the given \p writer without building a json
+/// object
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given DiagnosticsStatusNotificationRequest \p k
 void from_json(const json& j, DiagnosticsStatusNotificationRequest& k);
 
@@ -43,6 +47,10 @@ struct DiagnosticsStatusNotificationResponse : public ocpp::Message {
 /// \brief Conversion from a given DiagnosticsStatusNotificationResponse \p k to a given json object \p j
 void to_json(json& j, const DiagnosticsStatusNotificationResponse& k);
 
+/// \brief Writes the given DiagnosticsStatusNotificationResponse \p k to the given \p writer without building a json
+/// object
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given DiagnosticsStatusNotificationResponse \p k
 void from_json(const json& j, DiagnosticsStatusNotificationResponse& k);
 
@@ -27,6 +27,9 @@ struct ExtendedTriggerMessageRequest : public ocpp::Message {
 /// \brief Conversion from a given ExtendedTriggerMessageRequest \p k to a given json object \p j
 void to_json(json& j, const ExtendedTriggerMessageRequest& k);
 
+/// \brief Writes the given ExtendedTriggerMessageRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ExtendedTriggerMessageRequest \p k
 void from_json(const json& j, ExtendedTriggerMessageRequest& k);
 
@@ -46,6 +49,9 @@ struct ExtendedTriggerMessageResponse : public ocpp::Message {
 /// \brief Conversion from a given ExtendedTriggerMessageResponse \p k to a given json object \p j
 void to_json(json& j, const ExtendedTriggerMessageResponse& k);
 
+/// \brief Writes the given ExtendedTriggerMessageResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ExtendedTriggerMessageResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ExtendedTriggerMessageResponse \p k
 void from_json(const json& j, ExtendedTriggerMessageResponse& k);
 
@@ -26,6 +26,9 @@ struct GetConfigurationRequest : public ocpp::Message {
 /// \brief Conversion from a given GetConfigurationRequest \p k to a given json object \p j
 void to_json(json& j, const GetConfigurationRequest& k);
 
+/// \brief Writes the given GetConfigurationRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetConfigurationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetConfigurationRequest \p k
 void from_json(const json& j, GetConfigurationRequest& k);
 
@@ -46,6 +49,9 @@ struct GetConfigurationResponse : public ocpp::Message {
 /// \brief Conversion from a given GetConfigurationResponse \p k to a given json object \p j
 void to_json(json& j, const GetConfigurationResponse& k);
 
+/// \brief Writes the given GetConfigurationResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetConfigurationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetConfigurationResponse \p k
 void from_json(const json& j, GetConfigurationResponse& k);
 
@@ -30,6 +30,9 @@ struct GetDiagnosticsRequest : public ocpp::Message {
 /// \brief Conversion from a given GetDiagnosticsRequest \p k to a given json object \p j
 void to_json(json& j, const GetDiagnosticsRequest& k);
 
+/// \brief Writes the given GetDiagnosticsRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetDiagnosticsRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetDiagnosticsRequest \p k
 void from_json(const json& j, GetDiagnosticsRequest& k);
 
@@ -49,6 +52,9 @@ struct GetDiagnosticsResponse : public ocpp::Message {
 /// \brief Conversion from a given GetDiagnosticsResponse \p k to a given json object \p j
 void to_json(json& j, const GetDiagnosticsResponse& k);
 
+/// \brief Writes the given GetDiagnosticsResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetDiagnosticsResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetDiagnosticsResponse \p k
 void from_json(const json& j, GetDiagnosticsResponse& k);
 
@@ -26,6 +26,9 @@ struct GetInstalledCertificateIdsRequest : public ocpp::Message {
 /// \brief Conversion from a given GetInstalledCertificateIdsRequest \p k to a given json object \p j
 void to_json(json& j, const GetInstalledCertificateIdsRequest& k);
 
+/// \brief Writes the given GetInstalledCertificateIdsRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetInstalledCertificateIdsRequest \p k
 void from_json(const json& j, GetInstalledCertificateIdsRequest& k);
 
@@ -46,6 +49,10 @@ struct GetInstalledCertificateIdsResponse : public ocpp::Message {
 /// \brief Conversion from a given GetInstalledCertificateIdsResponse \p k to a given json object \p j
 void to_json(json& j, const GetInstalledCertificateIdsResponse& k);
 
+/// \brief Writes the given GetInstalledCertificateIdsResponse \p k to the given \p writer without building a json
+/// object
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetInstalledCertificateIdsResponse \p k
 void from_json(const json& j, GetInstalledCertificateIdsResponse& k);
 
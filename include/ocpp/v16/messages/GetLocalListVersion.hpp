@@ -23,6 +23,9 @@ struct GetLocalListVersionRequest : public ocpp::Message {
 /// \brief Conversion from a given GetLocalListVersionRequest \p k to a given json object \p j
 void to_json(json& j, const GetLocalListVersionRequest& k);
 
+/// \brief Writes the given GetLocalListVersionRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetLocalListVersionRequest \p k
 void from_json(const json& j, GetLocalListVersionRequest& k);
 
@@ -42,6 +45,9 @@ struct GetLocalListVersionResponse : public ocpp::Message {
 /// \brief Conversion from a given GetLocalListVersionResponse \p k to a given json object \p j
 void to_json(json& j, const GetLocalListVersionResponse& k);
 
+/// \brief Writes the given GetLocalListVersionResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetLocalListVersionResponse \p k
 void from_json(const json& j, GetLocalListVersionResponse& k);
 
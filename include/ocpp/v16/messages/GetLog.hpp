@@ -31,6 +31,9 @@ struct GetLogRequest : public ocpp::Message {
 /// \brief Conversion from a given GetLogRequest \p k to a given json object \p j
 void to_json(json& j, const GetLogRequest& k);
 
+/// \brief Writes the given GetLogRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetLogRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetLogRequest \p k
 void from_json(const json& j, GetLogRequest& k);
 
@@ -51,6 +54,9 @@ struct GetLogResponse : public ocpp::Message {
 /// \brief Conversion from a given GetLogResponse \p k to a given json object \p j
 void to_json(json& j, const GetLogResponse& k);
 
+/// \brief Writes the given GetLogResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetLogResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetLogResponse \p k
 void from_json(const json& j, GetLogResponse& k);
 
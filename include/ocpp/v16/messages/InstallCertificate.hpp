@@ -26,6 +26,9 @@ struct InstallCertificateRequest : public ocpp::Message {
 /// \brief Conversion from a given InstallCertificateRequest \p k to a given json object \p j
 void to_json(json& j, const InstallCertificateRequest& k);
 
+/// \brief Writes the given InstallCertificateRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given InstallCertificateRequest \p k
 void from_json(const json& j, InstallCertificateRequest& k);
 
@@ -45,6 +48,9 @@ struct InstallCertificateResponse : public ocpp::Message {
 /// \brief Conversion from a given InstallCertificateResponse \p k to a given json object \p j
 void to_json(json& j, const InstallCertificateResponse& k);
 
+/// \brief Writes the given InstallCertificateResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given InstallCertificateResponse \p k
 void from_json(const json& j, InstallCertificateResponse& k);
 
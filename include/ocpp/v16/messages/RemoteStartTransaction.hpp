@@ -29,6 +29,9 @@ struct RemoteStartTransactionRequest : public ocpp::Message {
 /// \brief Conversion from a given RemoteStartTransactionRequest \p k to a given json object \p j
 void to_json(json& j, const RemoteStartTransactionRequest& k);
 
+/// \brief Writes the given RemoteStartTransactionRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const RemoteStartTransactionRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given RemoteStartTransactionRequest \p k
 void from_json(const json& j, RemoteStartTransactionRequest& k);
 
@@ -48,6 +51,9 @@ struct RemoteStartTransactionResponse : public ocpp::Message {
 /// \brief Conversion from a given RemoteStartTransactionResponse \p k to a given json object \p j
 void to_json(json& j, const RemoteStartTransactionResponse& k);
 
+/// \brief Writes the given RemoteStartTransactionResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const RemoteStartTransactionResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given RemoteStartTransactionResponse \p k
 void from_json(const json& j, RemoteStartTransactionResponse& k);
 
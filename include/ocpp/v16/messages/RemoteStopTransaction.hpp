@@ -25,6 +25,9 @@ struct RemoteStopTransactionRequest : public ocpp::Message {
 /// \brief Conversion from a given RemoteStopTransactionRequest \p k to a given json object \p j
 void to_json(json& j, const RemoteStopTransactionRequest& k);
 
+/// \brief Writes the given RemoteStopTransactionRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const RemoteStopTransactionRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given RemoteStopTransactionRequest \p k
 void from_json(const json& j, RemoteStopTransactionRequest& k);
 
@@ -44,6 +47,9 @@ struct RemoteStopTransactionResponse : public ocpp::Message {
 /// \brief Conversion from a given RemoteStopTransactionResponse \p k to a given json object \p j
 void to_json(json& j, const RemoteStopTransactionResponse& k);
 
+/// \brief Writes the given RemoteStopTransactionResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const RemoteStopTransactionResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given RemoteStopTransactionResponse \p k
 void from_json(const json& j, RemoteStopTransactionResponse& k);
 
@@ -31,6 +31,9 @@ struct ReserveNowRequest : public ocpp::Message {
 /// \brief Conversion from a given ReserveNowRequest \p k to a given json object \p j
 void to_json(json& j, const ReserveNowRequest& k);
 
+/// \brief Writes the given ReserveNowRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ReserveNowRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ReserveNowRequest \p k
 void from_json(const json& j, ReserveNowRequest& k);
 
@@ -50,6 +53,9 @@ struct ReserveNowResponse : public ocpp::Message {
 /// \brief Conversion from a given ReserveNowResponse \p k to a given json object \p j
 void to_json(json& j, const ReserveNowResponse& k);
 
+/// \brief Writes the given ReserveNowResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ReserveNowResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ReserveNowResponse \p k
 void from_json(const json& j, ReserveNowResponse& k);
 
@@ -29,6 +29,9 @@ struct SendLocalListRequest : public ocpp::Message {
 /// \brief Conversion from a given SendLocalListRequest \p k to a given json object \p j
 void to_json(json& j, const SendLocalListRequest& k);
 
+/// \brief Writes the given SendLocalListRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SendLocalListRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SendLocalListRequest \p k
 void from_json(const json& j, SendLocalListRequest& k);
 
@@ -48,6 +51,9 @@ struct SendLocalListResponse : public ocpp::Message {
 /// \brief Conversion from a given SendLocalListResponse \p k to a given json object \p j
 void to_json(json& j, const SendLocalListResponse& k);
 
+/// \brief Writes the given SendLocalListResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SendLocalListResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SendLocalListResponse \p k
 void from_json(const json& j, SendLocalListResponse& k);
 
@@ -27,6 +27,9 @@ struct SetChargingProfileRequest : public ocpp::Message {
 /// \brief Conversion from a given SetChargingProfileRequest \p k to a given json object \p j
 void to_json(json& j, const SetChargingProfileRequest& k);
 
+/// \brief Writes the given SetChargingProfileRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SetChargingProfileRequest \p k
 void from_json(const json& j, SetChargingProfileRequest& k);
 
@@ -46,6 +49,9 @@ struct SetChargingProfileResponse : public ocpp::Message {
 /// \brief Conversion from a given SetChargingProfileResponse \p k to a given json object \p j
 void to_json(json& j, const SetChargingProfileResponse& k);
 
+/// \brief Writes the given SetChargingProfileResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SetChargingProfileResponse \p k
 void from_json(const json& j, SetChargingProfileResponse& k);
 
@@ -27,6 +27,10 @@ struct SignedFirmwareStatusNotificationRequest : public ocpp::Message {
 /// \brief Conversion from a given SignedFirmwareStatusNotificationRequest \p k to a given json object \p j
 void to_json(json& j, const SignedFirmwareStatusNotificationRequest& k);
 
+/// \brief Writes the given SignedFirmwareStatusNotificationRequest \p k to the given \p writer without building a json
+/// object
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SignedFirmwareStatusNotificationRequest \p k
 void from_json(const json& j, SignedFirmwareStatusNotificationRequest& k);
 
@@ -45,6 +49,10 @@ struct SignedFirmwareStatusNotificationResponse : public ocpp::Message {
 /// \brief Conversion from a given SignedFirmwareStatusNotificationResponse \p k to a given json object \p j
 void to_json(json& j, const SignedFirmwareStatusNotificationResponse& k);
 
+/// \brief Writes the given SignedFirmwareStatusNotificationResponse \p k to the given \p writer without building a json
+/// object
+void write_json(JsonWriter& writer, const SignedFirmwareStatusNotificationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SignedFirmwareStatusNotificationResponse \p k
 void from_json(const json& j, SignedFirmwareStatusNotificationResponse& k);
 
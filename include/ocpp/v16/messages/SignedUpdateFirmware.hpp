@@ -29,6 +29,9 @@ struct SignedUpdateFirmwareRequest : public ocpp::Message {
 /// \brief Conversion from a given SignedUpdateFirmwareRequest \p k to a given json object \p j
 void to_json(json& j, const SignedUpdateFirmwareRequest& k);
 
+/// \brief Writes the given SignedUpdateFirmwareRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SignedUpdateFirmwareRequest \p k
 void from_json(const json& j, SignedUpdateFirmwareRequest& k);
 
@@ -48,6 +51,9 @@ struct SignedUpdateFirmwareResponse : public ocpp::Message {
 /// \brief Conversion from a given SignedUpdateFirmwareResponse \p k to a given json object \p j
 void to_json(json& j, const SignedUpdateFirmwareResponse& k);
 
+/// \brief Writes the given SignedUpdateFirmwareResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SignedUpdateFirmwareResponse \p k
 void from_json(const json& j, SignedUpdateFirmwareResponse& k);
 
@@ -31,6 +31,9 @@ struct StartTransactionRequest : public ocpp::Message {
 /// \brief Conversion from a given StartTransactionRequest \p k to a given json object \p j
 void to_json(json& j, const StartTransactionRequest& k);
 
+/// \brief Writes the given StartTransactionRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const StartTransactionRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given StartTransactionRequest \p k
 void from_json(const json& j, StartTransactionRequest& k);
 
@@ -51,6 +54,9 @@ struct StartTransactionResponse : public ocpp::Message {
 /// \brief Conversion from a given StartTransactionResponse \p k to a given json object \p j
 void to_json(json& j, const StartTransactionResponse& k);
 
+/// \brief Writes the given StartTransactionResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const StartTransactionResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given StartTransactionResponse \p k
 void from_json(const json& j, StartTransactionResponse& k);
 
@@ -32,6 +32,9 @@ struct StopTransactionRequest : public ocpp::Message {
 /// \brief Conversion from a given StopTransactionRequest \p k to a given json object \p j
 void to_json(json& j, const StopTransactionRequest& k);
 
+/// \brief Writes the given StopTransactionRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const StopTransactionRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given StopTransactionRequest \p k
 void from_json(const json& j, StopTransactionRequest& k);
 
@@ -51,6 +54,9 @@ struct StopTransactionResponse : public ocpp::Message {
 /// \brief Conversion from a given StopTransactionResponse \p k to a given json object \p j
 void to_json(json& j, const StopTransactionResponse& k);
 
+/// \brief Writes the given StopTransactionResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const StopTransactionResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given StopTransactionResponse \p k
 void from_json(const json& j, StopTransactionResponse& k);
 
@@ -10,6 +10,7 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 #include <ocpp/v16/types.hpp>
@@ -25,6 +26,9 @@ struct IdTagInfo {
 /// \brief Conversion from a given IdTagInfo \p k to a given json object \p j
 void to_json(json& j, const IdTagInfo& k);
 
+/// \brief Writes the given IdTagInfo \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const IdTagInfo& k);
+
 /// \brief Conversion from a given json object \p j to a given IdTagInfo \p k
 void from_json(const json& j, IdTagInfo& k);
 
@@ -41,6 +45,9 @@ struct CertificateHashDataType {
 /// \brief Conversion from a given CertificateHashDataType \p k to a given json object \p j
 void to_json(json& j, const CertificateHashDataType& k);
 
+/// \brief Writes the given CertificateHashDataType \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CertificateHashDataType& k);
+
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k);
 
@@ -56,6 +63,9 @@ struct ChargingSchedulePeriod {
 /// \brief Conversion from a given ChargingSchedulePeriod \p k to a given json object \p j
 void to_json(json& j, const ChargingSchedulePeriod& k);
 
+/// \brief Writes the given ChargingSchedulePeriod \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k);
+
 /// \brief Conversion from a given json object \p j to a given ChargingSchedulePeriod \p k
 void from_json(const json& j, ChargingSchedulePeriod& k);
 
@@ -73,6 +83,9 @@ struct ChargingSchedule {
 /// \brief Conversion from a given ChargingSchedule \p k to a given json object \p j
 void to_json(json& j, const ChargingSchedule& k);
 
+/// \brief Writes the given ChargingSchedule \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingSchedule& k);
+
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, ChargingSchedule& k);
 
@@ -88,6 +101,9 @@ struct KeyValue {
 /// \brief Conversion from a given KeyValue \p k to a given json object \p j
 void to_json(json& j, const KeyValue& k);
 
+/// \brief Writes the given KeyValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const KeyValue& k);
+
 /// \brief Conversion from a given json object \p j to a given KeyValue \p k
 void from_json(const json& j, KeyValue& k);
 
@@ -103,6 +119,9 @@ struct LogParametersType {
 /// \brief Conversion from a given LogParametersType \p k to a given json object \p j
 void to_json(json& j, const LogParametersType& k);
 
+/// \brief Writes the given LogParametersType \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const LogParametersType& k);
+
 /// \brief Conversion from a given json object \p j to a given LogParametersType \p k
 void from_json(const json& j, LogParametersType& k);
 
@@ -122,6 +141,9 @@ struct SampledValue {
 /// \brief Conversion from a given SampledValue \p k to a given json object \p j
 void to_json(json& j, const SampledValue& k);
 
+/// \brief Writes the given SampledValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SampledValue& k);
+
 /// \brief Conversion from a given json object \p j to a given SampledValue \p k
 void from_json(const json& j, SampledValue& k);
 
@@ -136,6 +158,9 @@ struct MeterValue {
 /// \brief Conversion from a given MeterValue \p k to a given json object \p j
 void to_json(json& j, const MeterValue& k);
 
+/// \brief Writes the given MeterValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MeterValue& k);
+
 /// \brief Conversion from a given json object \p j to a given MeterValue \p k
 void from_json(const json& j, MeterValue& k);
 
@@ -157,6 +182,9 @@ struct ChargingProfile {
 /// \brief Conversion from a given ChargingProfile \p k to a given json object \p j
 void to_json(json& j, const ChargingProfile& k);
 
+/// \brief Writes the given ChargingProfile \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingProfile& k);
+
 /// \brief Conversion from a given json object \p j to a given ChargingProfile \p k
 void from_json(const json& j, ChargingProfile& k);
 
@@ -171,6 +199,9 @@ struct LocalAuthorizationList {
 /// \brief Conversion from a given LocalAuthorizationList \p k to a given json object \p j
 void to_json(json& j, const LocalAuthorizationList& k);
 
+/// \brief Writes the given LocalAuthorizationList \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const LocalAuthorizationList& k);
+
 /// \brief Conversion from a given json object \p j to a given LocalAuthorizationList \p k
 void from_json(const json& j, LocalAuthorizationList& k);
 
@@ -188,6 +219,9 @@ struct FirmwareType {
 /// \brief Conversion from a given FirmwareType \p k to a given json object \p j
 void to_json(json& j, const FirmwareType& k);
 
+/// \brief Writes the given FirmwareType \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const FirmwareType& k);
+
 /// \brief Conversion from a given json object \p j to a given FirmwareType \p k
 void from_json(const json& j, FirmwareType& k);
 
@@ -202,6 +236,9 @@ struct TransactionData {
 /// \brief Conversion from a given TransactionData \p k to a given json object \p j
 void to_json(json& j, const TransactionData& k);
 
+/// \brief Writes the given TransactionData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const TransactionData& k);
+
 /// \brief Conversion from a given json object \p j to a given TransactionData \p k
 void from_json(const json& j, TransactionData& k);
 
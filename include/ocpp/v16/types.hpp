@@ -5,6 +5,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <string_view>
 
 #include <nlohmann/json_fwd.hpp>
 
@@ -106,9 +107,9 @@ namespace conversions {
 /// \returns a string representation of the MessageType
 std::string messagetype_to_string(MessageType m);
 
-/// \brief Converts the given std::string \p s to MessageType
+/// \brief Converts the given std::string_view \p s to MessageType
 /// \returns a MessageType from a string representation
-MessageType string_to_messagetype(const std::string& s);
+MessageType string_to_messagetype(std::string_view s);
 } // namespace conversions
 
 /// \brief Writes the string representation of the given \p message_type to the given output stream \p os
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#ifndef OCPP_V16_USER_CONFIG_PERSISTER_HPP
+#define OCPP_V16_USER_CONFIG_PERSISTER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+
+#include <ocpp/common/support_older_cpp_versions.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+/// \brief Persists changes of configuration keys to the user config file. The user config is read once on construction
+/// and changed in memory. Changes are written behind: a burst of changes is coalesced into a single write once no
+/// change has been made for the write delay, at the latest after MAXIMUM_DELAY_FACTOR times the write delay. The file
+/// is replaced atomically by writing a temporary file, syncing it to disk and renaming it, so a crash never leaves a
+/// partially written user config behind. Changes that have not been written when the process ends without destroying
+/// the persister are lost, flush() has to be called before a restart
+class UserConfigPersister {
+public:
+    /// \brief Upper bound of the delay of a write while changes keep coming in, in multiples of the write delay
+    static constexpr int MAXIMUM_DELAY_FACTOR = 10;
+
+    /// \brief Creates a new persister for the user config at \p user_config_path. Changes are written \p write_delay
+    /// after the last change, a delay of 0 writes every change immediately
+    /// \throws nlohmann::json::parse_error if the existing user config can not be parsed
+    UserConfigPersister(const fs::path& user_config_path, std::chrono::milliseconds write_delay);
+
+    /// \brief Writes pending changes before the persister is destroyed
+    ~UserConfigPersister();
+
+    /// \brief Sets the \p key of the given \p profile to \p value and schedules the user config to be written
+    void set(const std::string& profile, const std::string& key, const nlohmann::json& value);
+
+    /// \brief Writes pending changes immediately
+    /// \returns true if there were no pending changes or they have been written successfully
+    bool flush();
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    fs::path user_config_path;
+    std::chrono::milliseconds write_delay;
+    nlohmann::json user_config;
+    bool pending_changes;
+    Clock::time_point first_pending_change;
+    Clock::time_point last_pending_change;
+    bool running;
+    /// Protects the user config and the pending changes
+    std::mutex mutex;
+    std::condition_variable cv;
+    /// Serializes the writes, so that an older user config never replaces a newer one
+    std::mutex write_mutex;
+    std::thread writer_thread;
+
+    /// \brief Waits for pending changes and writes them after the write delay
+    void run_writer();
+
+    /// \returns true if the user config could be written to disk
+    bool write();
+};
+
+} // namespace v16
+} // namespace ocpp
+
+#endif // OCPP_V16_USER_CONFIG_PERSISTER_HPP
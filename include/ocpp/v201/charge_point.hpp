@@ -109,6 +109,10 @@ public:
     /// \brief Disconnects the the websocket connection to the CSMS if it is connected
     virtual void disconnect_websocket() = 0;
 
+    /// \brief Provides a snapshot of the transport metrics of the websocket connection to the CSMS, e.g. to correlate
+    /// slow responses of the CSMS with the backlog of our own send queue
+    virtual WebsocketMetrics get_websocket_metrics() = 0;
+
     /// \brief Chargepoint notifies about new firmware update status firmware_update_status. This function should be
     ///        called during a Firmware Update to indicate the current firmware_update_status.
     /// \param request_id   The request_id. When it is -1, it will not be included in the request.
@@ -731,6 +735,12 @@ private:
     /// If \param persist is set to true, the change will be persisted across a reboot
     void execute_change_availability_request(ChangeAvailabilityRequest request, bool persist);
 
+    /// \brief Creates the core database at \p core_database_path with the DatabaseTuning configured in the
+    /// \p device_model and constructs the ChargePoint with it
+    ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure, std::shared_ptr<DeviceModel> device_model,
+                const fs::path& core_database_path, const fs::path& sql_init_path, const std::string& message_log_path,
+                const std::shared_ptr<EvseSecurity> evse_security, const Callbacks& callbacks);
+
 protected:
     std::shared_ptr<SmartChargingHandlerInterface> smart_charging_handler;
 
@@ -798,6 +808,7 @@ public:
 
     virtual void connect_websocket() override;
     virtual void disconnect_websocket() override;
+    WebsocketMetrics get_websocket_metrics() override;
 
     void on_firmware_update_status_notification(int32_t request_id,
                                                 const FirmwareStatusEnum& firmware_update_status) override;
@@ -149,5 +149,9 @@ struct Callbacks {
     std::optional<std::function<void(const RunningCost& running_cost, const uint32_t number_of_decimals,
                                      std::optional<std::string> currency_code)>>
         set_running_cost_callback;
+
+    /// \brief Callback function that reports the progress of replaying the queued messages after a reconnect. It is
+    /// only called if MessageQueueReplayWindow is greater than 1
+    std::optional<std::function<void(const ReplayProgress& progress)>> message_queue_replay_progress_callback;
 };
 } // namespace ocpp::v201
@@ -94,6 +94,11 @@ public:
     ///
     bool is_websocket_connected();
 
+    /// \brief Provides a snapshot of the transport metrics of the websocket
+    /// \return The metrics, empty if the websocket has not been initialized yet
+    ///
+    WebsocketMetrics get_websocket_metrics();
+
     /// \brief Start the connectivity manager
     ///
     void start();
@@ -115,6 +120,17 @@ public:
     ///
     bool send_to_websocket(const std::string& message);
 
+    /// \brief queue a \p message for sending over the websocket without waiting until it has been written. The optional
+    /// \p on_sent callback is called with false if the websocket drops the message after accepting it
+    /// \returns true if the message was accepted for sending
+    ///
+    bool send_to_websocket_async(const std::string& message, const std::function<void(bool sent)>& on_sent = nullptr);
+
+    /// \brief queue a message that is written by \p write directly into a send buffer of the websocket
+    /// \returns true if the message was accepted for sending
+    ///
+    bool send_to_websocket_async(const std::function<void(JsonWriter& writer)>& write);
+
 private:
     /// \brief Init the websocket
     ///
@@ -61,6 +61,9 @@ extern const ComponentVariable& LogRotation;
 extern const ComponentVariable& LogRotationDateSuffix;
 extern const ComponentVariable& LogRotationMaximumFileSize;
 extern const ComponentVariable& LogRotationMaximumFileCount;
+extern const ComponentVariable& LogRotationCompress;
+extern const ComponentVariable& LogMessagesQueueSize;
+extern const ComponentVariable& LogMessagesQueueFullPolicy;
 extern const ComponentVariable& SupportedChargingProfilePurposeTypes;
 extern const ComponentVariable& SupportedCriteria;
 extern const ComponentVariable& RoundClockAlignedTimestamps;
@@ -73,6 +76,15 @@ extern const ComponentVariable& VerifyCsmsAllowWildcards;
 extern const ComponentVariable& IFace;
 extern const ComponentVariable& EnableTLSKeylog;
 extern const ComponentVariable& TLSKeylogFile;
+extern const ComponentVariable& WebsocketMaxFragmentSize;
+extern const ComponentVariable& WebsocketMaxSendQueueSize;
+extern const ComponentVariable& WebsocketCompression;
+extern const ComponentVariable& WebsocketCompressionWindowBits;
+extern const ComponentVariable& WebsocketCompressionLevel;
+extern const ComponentVariable& WebsocketSharedEventLoop;
+extern const ComponentVariable& WebsocketSharedEventLoopWorkers;
+extern const ComponentVariable& TLSSessionResumption;
+extern const ComponentVariable& TLSSessionCacheFile;
 extern const ComponentVariable& OcspRequestInterval;
 extern const ComponentVariable& WebsocketPingPayload;
 extern const ComponentVariable& WebsocketPongTimeout;
@@ -83,6 +95,8 @@ extern const ComponentVariable& V2GCertificateExpireCheckIntervalSeconds;
 extern const ComponentVariable& ClientCertificateExpireCheckInitialDelaySeconds;
 extern const ComponentVariable& ClientCertificateExpireCheckIntervalSeconds;
 extern const ComponentVariable& MessageQueueSizeThreshold;
+extern const ComponentVariable& MessageQueueReplayWindow;
+extern const ComponentVariable& DatabaseTuning;
 extern const ComponentVariable& MaxMessageSize;
 extern const ComponentVariable& ResumeTransactionsOnBoot;
 extern const ComponentVariable& AlignedDataCtrlrEnabled;
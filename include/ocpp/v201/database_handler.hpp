@@ -29,6 +29,7 @@ struct AuthorizationCacheEntry {
 class DatabaseHandler : public common::DatabaseHandlerCommon {
 private:
     void init_sql() override;
+    std::vector<std::string> get_hot_statements() override;
 
     void inintialize_enum_tables();
     void init_enum_table_inner(const std::string& table_name, const int begin, const int end,
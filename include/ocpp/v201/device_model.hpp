@@ -4,6 +4,7 @@
 #ifndef DEVICE_MODEL_HPP
 #define DEVICE_MODEL_HPP
 
+#include <mutex>
 #include <type_traits>
 
 #include <everest/logging.hpp>
@@ -99,14 +100,23 @@ private:
     DeviceModelMap device_model;
     std::unique_ptr<DeviceModelStorage> storage;
 
+    /// \brief Protects the VariableAttribute(s) cached in \p device_model against concurrent reads and writes
+    mutable std::mutex attributes_mutex;
+
     /// \brief Listener for the internal change of a variable
     on_variable_changed variable_listener;
     /// \brief Listener for the internal update of a monitor
     on_monitor_updated monitor_update_listener;
 
+    /// \brief Loads all VariableAttribute(s) from the device model storage into the in-memory device model
+    void load_variable_attributes();
+
+    /// \brief Gets a copy of the cached VariableAttribute(s) of the given \p variable_meta_data
+    std::vector<VariableAttribute> get_cached_variable_attributes(const VariableMetaData& variable_meta_data) const;
+
     /// \brief Private helper method that does some checks with the device model representation in memory to evaluate if
-    /// a value for the given parameters can be requested. If it can be requested it will be retrieved from the device
-    /// model storage and the given \p value will be set to the value that was retrieved
+    /// a value for the given parameters can be requested. If it can be requested it will be retrieved from the
+    /// in-memory cache of the device model and the given \p value will be set to the value that was retrieved
     /// \param component_id
     /// \param variable_id
     /// \param attribute_enum
@@ -137,7 +147,8 @@ private:
                                    const struct ocpp::v201::Variable& variable_);
 
 public:
-    /// \brief Constructor for the device model
+    /// \brief Constructor for the device model. Reads the device model and all VariableAttribute(s) from the storage
+    /// into memory. Reads are served from memory afterwards, only writes of persistent values reach the storage.
     /// \param device_model_storage pointer to a device model storage class
     explicit DeviceModel(std::unique_ptr<DeviceModelStorage> device_model_storage);
 
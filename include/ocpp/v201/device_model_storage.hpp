@@ -34,6 +34,9 @@ struct VariableMonitoringPeriodic {
 struct VariableMetaData {
     VariableCharacteristics characteristics;
     std::unordered_map<int64_t, VariableMonitoringMeta> monitors;
+    /// \brief VariableAttribute(s) of the variable. Not filled by the DeviceModelStorage, the DeviceModel uses it to
+    /// cache the attributes in memory
+    std::map<AttributeEnum, VariableAttribute> attributes;
 };
 
 using VariableMap = std::map<Variable, VariableMetaData>;
@@ -30,6 +30,9 @@ struct AuthorizeRequest : public ocpp::Message {
 /// \brief Conversion from a given AuthorizeRequest \p k to a given json object \p j
 void to_json(json& j, const AuthorizeRequest& k);
 
+/// \brief Writes the given AuthorizeRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const AuthorizeRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given AuthorizeRequest \p k
 void from_json(const json& j, AuthorizeRequest& k);
 
@@ -51,6 +54,9 @@ struct AuthorizeResponse : public ocpp::Message {
 /// \brief Conversion from a given AuthorizeResponse \p k to a given json object \p j
 void to_json(json& j, const AuthorizeResponse& k);
 
+/// \brief Writes the given AuthorizeResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const AuthorizeResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given AuthorizeResponse \p k
 void from_json(const json& j, AuthorizeResponse& k);
 
@@ -29,6 +29,9 @@ struct CertificateSignedRequest : public ocpp::Message {
 /// \brief Conversion from a given CertificateSignedRequest \p k to a given json object \p j
 void to_json(json& j, const CertificateSignedRequest& k);
 
+/// \brief Writes the given CertificateSignedRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given CertificateSignedRequest \p k
 void from_json(const json& j, CertificateSignedRequest& k);
 
@@ -50,6 +53,9 @@ struct CertificateSignedResponse : public ocpp::Message {
 /// \brief Conversion from a given CertificateSignedResponse \p k to a given json object \p j
 void to_json(json& j, const CertificateSignedResponse& k);
 
+/// \brief Writes the given CertificateSignedResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given CertificateSignedResponse \p k
 void from_json(const json& j, CertificateSignedResponse& k);
 
@@ -29,6 +29,9 @@ struct ChangeAvailabilityRequest : public ocpp::Message {
 /// \brief Conversion from a given ChangeAvailabilityRequest \p k to a given json object \p j
 void to_json(json& j, const ChangeAvailabilityRequest& k);
 
+/// \brief Writes the given ChangeAvailabilityRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ChangeAvailabilityRequest \p k
 void from_json(const json& j, ChangeAvailabilityRequest& k);
 
@@ -50,6 +53,9 @@ struct ChangeAvailabilityResponse : public ocpp::Message {
 /// \brief Conversion from a given ChangeAvailabilityResponse \p k to a given json object \p j
 void to_json(json& j, const ChangeAvailabilityResponse& k);
 
+/// \brief Writes the given ChangeAvailabilityResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ChangeAvailabilityResponse \p k
 void from_json(const json& j, ChangeAvailabilityResponse& k);
 
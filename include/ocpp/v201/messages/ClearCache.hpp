@@ -27,6 +27,9 @@ struct ClearCacheRequest : public ocpp::Message {
 /// \brief Conversion from a given ClearCacheRequest \p k to a given json object \p j
 void to_json(json& j, const ClearCacheRequest& k);
 
+/// \brief Writes the given ClearCacheRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearCacheRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearCacheRequest \p k
 void from_json(const json& j, ClearCacheRequest& k);
 
@@ -48,6 +51,9 @@ struct ClearCacheResponse : public ocpp::Message {
 /// \brief Conversion from a given ClearCacheResponse \p k to a given json object \p j
 void to_json(json& j, const ClearCacheResponse& k);
 
+/// \brief Writes the given ClearCacheResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearCacheResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearCacheResponse \p k
 void from_json(const json& j, ClearCacheResponse& k);
 
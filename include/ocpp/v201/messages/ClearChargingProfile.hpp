@@ -29,6 +29,9 @@ struct ClearChargingProfileRequest : public ocpp::Message {
 /// \brief Conversion from a given ClearChargingProfileRequest \p k to a given json object \p j
 void to_json(json& j, const ClearChargingProfileRequest& k);
 
+/// \brief Writes the given ClearChargingProfileRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfileRequest \p k
 void from_json(const json& j, ClearChargingProfileRequest& k);
 
@@ -50,6 +53,9 @@ struct ClearChargingProfileResponse : public ocpp::Message {
 /// \brief Conversion from a given ClearChargingProfileResponse \p k to a given json object \p j
 void to_json(json& j, const ClearChargingProfileResponse& k);
 
+/// \brief Writes the given ClearChargingProfileResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfileResponse \p k
 void from_json(const json& j, ClearChargingProfileResponse& k);
 
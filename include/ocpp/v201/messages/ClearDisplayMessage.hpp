@@ -28,6 +28,9 @@ struct ClearDisplayMessageRequest : public ocpp::Message {
 /// \brief Conversion from a given ClearDisplayMessageRequest \p k to a given json object \p j
 void to_json(json& j, const ClearDisplayMessageRequest& k);
 
+/// \brief Writes the given ClearDisplayMessageRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearDisplayMessageRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearDisplayMessageRequest \p k
 void from_json(const json& j, ClearDisplayMessageRequest& k);
 
@@ -49,6 +52,9 @@ struct ClearDisplayMessageResponse : public ocpp::Message {
 /// \brief Conversion from a given ClearDisplayMessageResponse \p k to a given json object \p j
 void to_json(json& j, const ClearDisplayMessageResponse& k);
 
+/// \brief Writes the given ClearDisplayMessageResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearDisplayMessageResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearDisplayMessageResponse \p k
 void from_json(const json& j, ClearDisplayMessageResponse& k);
 
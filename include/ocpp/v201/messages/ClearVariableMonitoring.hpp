@@ -28,6 +28,9 @@ struct ClearVariableMonitoringRequest : public ocpp::Message {
 /// \brief Conversion from a given ClearVariableMonitoringRequest \p k to a given json object \p j
 void to_json(json& j, const ClearVariableMonitoringRequest& k);
 
+/// \brief Writes the given ClearVariableMonitoringRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearVariableMonitoringRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearVariableMonitoringRequest \p k
 void from_json(const json& j, ClearVariableMonitoringRequest& k);
 
@@ -48,6 +51,9 @@ struct ClearVariableMonitoringResponse : public ocpp::Message {
 /// \brief Conversion from a given ClearVariableMonitoringResponse \p k to a given json object \p j
 void to_json(json& j, const ClearVariableMonitoringResponse& k);
 
+/// \brief Writes the given ClearVariableMonitoringResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearVariableMonitoringResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearVariableMonitoringResponse \p k
 void from_json(const json& j, ClearVariableMonitoringResponse& k);
 
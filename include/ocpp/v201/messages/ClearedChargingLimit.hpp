@@ -29,6 +29,9 @@ struct ClearedChargingLimitRequest : public ocpp::Message {
 /// \brief Conversion from a given ClearedChargingLimitRequest \p k to a given json object \p j
 void to_json(json& j, const ClearedChargingLimitRequest& k);
 
+/// \brief Writes the given ClearedChargingLimitRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearedChargingLimitRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearedChargingLimitRequest \p k
 void from_json(const json& j, ClearedChargingLimitRequest& k);
 
@@ -48,6 +51,9 @@ struct ClearedChargingLimitResponse : public ocpp::Message {
 /// \brief Conversion from a given ClearedChargingLimitResponse \p k to a given json object \p j
 void to_json(json& j, const ClearedChargingLimitResponse& k);
 
+/// \brief Writes the given ClearedChargingLimitResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearedChargingLimitResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearedChargingLimitResponse \p k
 void from_json(const json& j, ClearedChargingLimitResponse& k);
 
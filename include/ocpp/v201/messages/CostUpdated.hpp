@@ -28,6 +28,9 @@ struct CostUpdatedRequest : public ocpp::Message {
 /// \brief Conversion from a given CostUpdatedRequest \p k to a given json object \p j
 void to_json(json& j, const CostUpdatedRequest& k);
 
+/// \brief Writes the given CostUpdatedRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CostUpdatedRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given CostUpdatedRequest \p k
 void from_json(const json& j, CostUpdatedRequest& k);
 
@@ -47,6 +50,9 @@ struct CostUpdatedResponse : public ocpp::Message {
 /// \brief Conversion from a given CostUpdatedResponse \p k to a given json object \p j
 void to_json(json& j, const CostUpdatedResponse& k);
 
+/// \brief Writes the given CostUpdatedResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CostUpdatedResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given CostUpdatedResponse \p k
 void from_json(const json& j, CostUpdatedResponse& k);
 
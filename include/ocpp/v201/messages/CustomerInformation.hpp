@@ -33,6 +33,9 @@ struct CustomerInformationRequest : public ocpp::Message {
 /// \brief Conversion from a given CustomerInformationRequest \p k to a given json object \p j
 void to_json(json& j, const CustomerInformationRequest& k);
 
+/// \brief Writes the given CustomerInformationRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CustomerInformationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given CustomerInformationRequest \p k
 void from_json(const json& j, CustomerInformationRequest& k);
 
@@ -54,6 +57,9 @@ struct CustomerInformationResponse : public ocpp::Message {
 /// \brief Conversion from a given CustomerInformationResponse \p k to a given json object \p j
 void to_json(json& j, const CustomerInformationResponse& k);
 
+/// \brief Writes the given CustomerInformationResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CustomerInformationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given CustomerInformationResponse \p k
 void from_json(const json& j, CustomerInformationResponse& k);
 
@@ -28,6 +28,9 @@ struct DeleteCertificateRequest : public ocpp::Message {
 /// \brief Conversion from a given DeleteCertificateRequest \p k to a given json object \p j
 void to_json(json& j, const DeleteCertificateRequest& k);
 
+/// \brief Writes the given DeleteCertificateRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given DeleteCertificateRequest \p k
 void from_json(const json& j, DeleteCertificateRequest& k);
 
@@ -49,6 +52,9 @@ struct DeleteCertificateResponse : public ocpp::Message {
 /// \brief Conversion from a given DeleteCertificateResponse \p k to a given json object \p j
 void to_json(json& j, const DeleteCertificateResponse& k);
 
+/// \brief Writes the given DeleteCertificateResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given DeleteCertificateResponse \p k
 void from_json(const json& j, DeleteCertificateResponse& k);
 
@@ -29,6 +29,9 @@ struct FirmwareStatusNotificationRequest : public ocpp::Message {
 /// \brief Conversion from a given FirmwareStatusNotificationRequest \p k to a given json object \p j
 void to_json(json& j, const FirmwareStatusNotificationRequest& k);
 
+/// \brief Writes the given FirmwareStatusNotificationRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given FirmwareStatusNotificationRequest \p k
 void from_json(const json& j, FirmwareStatusNotificationRequest& k);
 
@@ -48,6 +51,10 @@ struct FirmwareStatusNotificationResponse : public ocpp::Message {
 /// \brief Conversion from a given FirmwareStatusNotificationResponse \p k to a given json object \p j
 void to_json(json& j, const FirmwareStatusNotificationResponse& k);
 
+/// \brief Writes the given FirmwareStatusNotificationResponse \p k to the given \p writer without building a json
+/// object
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given FirmwareStatusNotificationResponse \p k
 void from_json(const json& j, FirmwareStatusNotificationResponse& k);
 
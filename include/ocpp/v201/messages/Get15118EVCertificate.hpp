@@ -30,6 +30,9 @@ struct Get15118EVCertificateRequest : public ocpp::Message {
 /// \brief Conversion from a given Get15118EVCertificateRequest \p k to a given json object \p j
 void to_json(json& j, const Get15118EVCertificateRequest& k);
 
+/// \brief Writes the given Get15118EVCertificateRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Get15118EVCertificateRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given Get15118EVCertificateRequest \p k
 void from_json(const json& j, Get15118EVCertificateRequest& k);
 
@@ -52,6 +55,9 @@ struct Get15118EVCertificateResponse : public ocpp::Message {
 /// \brief Conversion from a given Get15118EVCertificateResponse \p k to a given json object \p j
 void to_json(json& j, const Get15118EVCertificateResponse& k);
 
+/// \brief Writes the given Get15118EVCertificateResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Get15118EVCertificateResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given Get15118EVCertificateResponse \p k
 void from_json(const json& j, Get15118EVCertificateResponse& k);
 
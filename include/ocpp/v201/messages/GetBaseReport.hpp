@@ -29,6 +29,9 @@ struct GetBaseReportRequest : public ocpp::Message {
 /// \brief Conversion from a given GetBaseReportRequest \p k to a given json object \p j
 void to_json(json& j, const GetBaseReportRequest& k);
 
+/// \brief Writes the given GetBaseReportRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetBaseReportRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetBaseReportRequest \p k
 void from_json(const json& j, GetBaseReportRequest& k);
 
@@ -50,6 +53,9 @@ struct GetBaseReportResponse : public ocpp::Message {
 /// \brief Conversion from a given GetBaseReportResponse \p k to a given json object \p j
 void to_json(json& j, const GetBaseReportResponse& k);
 
+/// \brief Writes the given GetBaseReportResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetBaseReportResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetBaseReportResponse \p k
 void from_json(const json& j, GetBaseReportResponse& k);
 
@@ -28,6 +28,9 @@ struct GetCertificateStatusRequest : public ocpp::Message {
 /// \brief Conversion from a given GetCertificateStatusRequest \p k to a given json object \p j
 void to_json(json& j, const GetCertificateStatusRequest& k);
 
+/// \brief Writes the given GetCertificateStatusRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetCertificateStatusRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetCertificateStatusRequest \p k
 void from_json(const json& j, GetCertificateStatusRequest& k);
 
@@ -50,6 +53,9 @@ struct GetCertificateStatusResponse : public ocpp::Message {
 /// \brief Conversion from a given GetCertificateStatusResponse \p k to a given json object \p j
 void to_json(json& j, const GetCertificateStatusResponse& k);
 
+/// \brief Writes the given GetCertificateStatusResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetCertificateStatusResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetCertificateStatusResponse \p k
 void from_json(const json& j, GetCertificateStatusResponse& k);
 
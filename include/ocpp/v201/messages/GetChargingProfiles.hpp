@@ -30,6 +30,9 @@ struct GetChargingProfilesRequest : public ocpp::Message {
 /// \brief Conversion from a given GetChargingProfilesRequest \p k to a given json object \p j
 void to_json(json& j, const GetChargingProfilesRequest& k);
 
+/// \brief Writes the given GetChargingProfilesRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetChargingProfilesRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetChargingProfilesRequest \p k
 void from_json(const json& j, GetChargingProfilesRequest& k);
 
@@ -51,6 +54,9 @@ struct GetChargingProfilesResponse : public ocpp::Message {
 /// \brief Conversion from a given GetChargingProfilesResponse \p k to a given json object \p j
 void to_json(json& j, const GetChargingProfilesResponse& k);
 
+/// \brief Writes the given GetChargingProfilesResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetChargingProfilesResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetChargingProfilesResponse \p k
 void from_json(const json& j, GetChargingProfilesResponse& k);
 
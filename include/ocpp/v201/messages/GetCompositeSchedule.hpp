@@ -30,6 +30,9 @@ struct GetCompositeScheduleRequest : public ocpp::Message {
 /// \brief Conversion from a given GetCompositeScheduleRequest \p k to a given json object \p j
 void to_json(json& j, const GetCompositeScheduleRequest& k);
 
+/// \brief Writes the given GetCompositeScheduleRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetCompositeScheduleRequest \p k
 void from_json(const json& j, GetCompositeScheduleRequest& k);
 
@@ -52,6 +55,9 @@ struct GetCompositeScheduleResponse : public ocpp::Message {
 /// \brief Conversion from a given GetCompositeScheduleResponse \p k to a given json object \p j
 void to_json(json& j, const GetCompositeScheduleResponse& k);
 
+/// \brief Writes the given GetCompositeScheduleResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetCompositeScheduleResponse \p k
 void from_json(const json& j, GetCompositeScheduleResponse& k);
 
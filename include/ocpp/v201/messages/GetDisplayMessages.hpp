@@ -31,6 +31,9 @@ struct GetDisplayMessagesRequest : public ocpp::Message {
 /// \brief Conversion from a given GetDisplayMessagesRequest \p k to a given json object \p j
 void to_json(json& j, const GetDisplayMessagesRequest& k);
 
+/// \brief Writes the given GetDisplayMessagesRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetDisplayMessagesRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetDisplayMessagesRequest \p k
 void from_json(const json& j, GetDisplayMessagesRequest& k);
 
@@ -52,6 +55,9 @@ struct GetDisplayMessagesResponse : public ocpp::Message {
 /// \brief Conversion from a given GetDisplayMessagesResponse \p k to a given json object \p j
 void to_json(json& j, const GetDisplayMessagesResponse& k);
 
+/// \brief Writes the given GetDisplayMessagesResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetDisplayMessagesResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetDisplayMessagesResponse \p k
 void from_json(const json& j, GetDisplayMessagesResponse& k);
 
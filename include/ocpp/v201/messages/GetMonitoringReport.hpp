@@ -30,6 +30,9 @@ struct GetMonitoringReportRequest : public ocpp::Message {
 /// \brief Conversion from a given GetMonitoringReportRequest \p k to a given json object \p j
 void to_json(json& j, const GetMonitoringReportRequest& k);
 
+/// \brief Writes the given GetMonitoringReportRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetMonitoringReportRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetMonitoringReportRequest \p k
 void from_json(const json& j, GetMonitoringReportRequest& k);
 
@@ -51,6 +54,9 @@ struct GetMonitoringReportResponse : public ocpp::Message {
 /// \brief Conversion from a given GetMonitoringReportResponse \p k to a given json object \p j
 void to_json(json& j, const GetMonitoringReportResponse& k);
 
+/// \brief Writes the given GetMonitoringReportResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetMonitoringReportResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetMonitoringReportResponse \p k
 void from_json(const json& j, GetMonitoringReportResponse& k);
 
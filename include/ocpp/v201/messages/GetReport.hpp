@@ -30,6 +30,9 @@ struct GetReportRequest : public ocpp::Message {
 /// \brief Conversion from a given GetReportRequest \p k to a given json object \p j
 void to_json(json& j, const GetReportRequest& k);
 
+/// \brief Writes the given GetReportRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetReportRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetReportRequest \p k
 void from_json(const json& j, GetReportRequest& k);
 
@@ -51,6 +54,9 @@ struct GetReportResponse : public ocpp::Message {
 /// \brief Conversion from a given GetReportResponse \p k to a given json object \p j
 void to_json(json& j, const GetReportResponse& k);
 
+/// \brief Writes the given GetReportResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetReportResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetReportResponse \p k
 void from_json(const json& j, GetReportResponse& k);
 
@@ -27,6 +27,9 @@ struct GetTransactionStatusRequest : public ocpp::Message {
 /// \brief Conversion from a given GetTransactionStatusRequest \p k to a given json object \p j
 void to_json(json& j, const GetTransactionStatusRequest& k);
 
+/// \brief Writes the given GetTransactionStatusRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetTransactionStatusRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetTransactionStatusRequest \p k
 void from_json(const json& j, GetTransactionStatusRequest& k);
 
@@ -48,6 +51,9 @@ struct GetTransactionStatusResponse : public ocpp::Message {
 /// \brief Conversion from a given GetTransactionStatusResponse \p k to a given json object \p j
 void to_json(json& j, const GetTransactionStatusResponse& k);
 
+/// \brief Writes the given GetTransactionStatusResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetTransactionStatusResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetTransactionStatusResponse \p k
 void from_json(const json& j, GetTransactionStatusResponse& k);
 
@@ -28,6 +28,9 @@ struct GetVariablesRequest : public ocpp::Message {
 /// \brief Conversion from a given GetVariablesRequest \p k to a given json object \p j
 void to_json(json& j, const GetVariablesRequest& k);
 
+/// \brief Writes the given GetVariablesRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetVariablesRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given GetVariablesRequest \p k
 void from_json(const json& j, GetVariablesRequest& k);
 
@@ -48,6 +51,9 @@ struct GetVariablesResponse : public ocpp::Message {
 /// \brief Conversion from a given GetVariablesResponse \p k to a given json object \p j
 void to_json(json& j, const GetVariablesResponse& k);
 
+/// \brief Writes the given GetVariablesResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetVariablesResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given GetVariablesResponse \p k
 void from_json(const json& j, GetVariablesResponse& k);
 
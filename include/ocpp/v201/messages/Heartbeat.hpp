@@ -26,6 +26,9 @@ struct HeartbeatRequest : public ocpp::Message {
 /// \brief Conversion from a given HeartbeatRequest \p k to a given json object \p j
 void to_json(json& j, const HeartbeatRequest& k);
 
+/// \brief Writes the given HeartbeatRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const HeartbeatRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given HeartbeatRequest \p k
 void from_json(const json& j, HeartbeatRequest& k);
 
@@ -46,6 +49,9 @@ struct HeartbeatResponse : public ocpp::Message {
 /// \brief Conversion from a given HeartbeatResponse \p k to a given json object \p j
 void to_json(json& j, const HeartbeatResponse& k);
 
+/// \brief Writes the given HeartbeatResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const HeartbeatResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given HeartbeatResponse \p k
 void from_json(const json& j, HeartbeatResponse& k);
 
@@ -29,6 +29,9 @@ struct LogStatusNotificationRequest : public ocpp::Message {
 /// \brief Conversion from a given LogStatusNotificationRequest \p k to a given json object \p j
 void to_json(json& j, const LogStatusNotificationRequest& k);
 
+/// \brief Writes the given LogStatusNotificationRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const LogStatusNotificationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given LogStatusNotificationRequest \p k
 void from_json(const json& j, LogStatusNotificationRequest& k);
 
@@ -48,6 +51,9 @@ struct LogStatusNotificationResponse : public ocpp::Message {
 /// \brief Conversion from a given LogStatusNotificationResponse \p k to a given json object \p j
 void to_json(json& j, const LogStatusNotificationResponse& k);
 
+/// \brief Writes the given LogStatusNotificationResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const LogStatusNotificationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given LogStatusNotificationResponse \p k
 void from_json(const json& j, LogStatusNotificationResponse& k);
 
@@ -29,6 +29,9 @@ struct MeterValuesRequest : public ocpp::Message {
 /// \brief Conversion from a given MeterValuesRequest \p k to a given json object \p j
 void to_json(json& j, const MeterValuesRequest& k);
 
+/// \brief Writes the given MeterValuesRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MeterValuesRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given MeterValuesRequest \p k
 void from_json(const json& j, MeterValuesRequest& k);
 
@@ -48,6 +51,9 @@ struct MeterValuesResponse : public ocpp::Message {
 /// \brief Conversion from a given MeterValuesResponse \p k to a given json object \p j
 void to_json(json& j, const MeterValuesResponse& k);
 
+/// \brief Writes the given MeterValuesResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MeterValuesResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given MeterValuesResponse \p k
 void from_json(const json& j, MeterValuesResponse& k);
 
@@ -30,6 +30,9 @@ struct NotifyChargingLimitRequest : public ocpp::Message {
 /// \brief Conversion from a given NotifyChargingLimitRequest \p k to a given json object \p j
 void to_json(json& j, const NotifyChargingLimitRequest& k);
 
+/// \brief Writes the given NotifyChargingLimitRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyChargingLimitRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyChargingLimitRequest \p k
 void from_json(const json& j, NotifyChargingLimitRequest& k);
 
@@ -49,6 +52,9 @@ struct NotifyChargingLimitResponse : public ocpp::Message {
 /// \brief Conversion from a given NotifyChargingLimitResponse \p k to a given json object \p j
 void to_json(json& j, const NotifyChargingLimitResponse& k);
 
+/// \brief Writes the given NotifyChargingLimitResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyChargingLimitResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyChargingLimitResponse \p k
 void from_json(const json& j, NotifyChargingLimitResponse& k);
 
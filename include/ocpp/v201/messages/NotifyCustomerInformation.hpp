@@ -31,6 +31,9 @@ struct NotifyCustomerInformationRequest : public ocpp::Message {
 /// \brief Conversion from a given NotifyCustomerInformationRequest \p k to a given json object \p j
 void to_json(json& j, const NotifyCustomerInformationRequest& k);
 
+/// \brief Writes the given NotifyCustomerInformationRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyCustomerInformationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyCustomerInformationRequest \p k
 void from_json(const json& j, NotifyCustomerInformationRequest& k);
 
@@ -50,6 +53,9 @@ struct NotifyCustomerInformationResponse : public ocpp::Message {
 /// \brief Conversion from a given NotifyCustomerInformationResponse \p k to a given json object \p j
 void to_json(json& j, const NotifyCustomerInformationResponse& k);
 
+/// \brief Writes the given NotifyCustomerInformationResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyCustomerInformationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyCustomerInformationResponse \p k
 void from_json(const json& j, NotifyCustomerInformationResponse& k);
 
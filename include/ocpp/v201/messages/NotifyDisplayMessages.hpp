@@ -30,6 +30,9 @@ struct NotifyDisplayMessagesRequest : public ocpp::Message {
 /// \brief Conversion from a given NotifyDisplayMessagesRequest \p k to a given json object \p j
 void to_json(json& j, const NotifyDisplayMessagesRequest& k);
 
+/// \brief Writes the given NotifyDisplayMessagesRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyDisplayMessagesRequest \p k
 void from_json(const json& j, NotifyDisplayMessagesRequest& k);
 
@@ -49,6 +52,9 @@ struct NotifyDisplayMessagesResponse : public ocpp::Message {
 /// \brief Conversion from a given NotifyDisplayMessagesResponse \p k to a given json object \p j
 void to_json(json& j, const NotifyDisplayMessagesResponse& k);
 
+/// \brief Writes the given NotifyDisplayMessagesResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyDisplayMessagesResponse \p k
 void from_json(const json& j, NotifyDisplayMessagesResponse& k);
 
@@ -30,6 +30,9 @@ struct NotifyEVChargingNeedsRequest : public ocpp::Message {
 /// \brief Conversion from a given NotifyEVChargingNeedsRequest \p k to a given json object \p j
 void to_json(json& j, const NotifyEVChargingNeedsRequest& k);
 
+/// \brief Writes the given NotifyEVChargingNeedsRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingNeedsRequest \p k
 void from_json(const json& j, NotifyEVChargingNeedsRequest& k);
 
@@ -51,6 +54,9 @@ struct NotifyEVChargingNeedsResponse : public ocpp::Message {
 /// \brief Conversion from a given NotifyEVChargingNeedsResponse \p k to a given json object \p j
 void to_json(json& j, const NotifyEVChargingNeedsResponse& k);
 
+/// \brief Writes the given NotifyEVChargingNeedsResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingNeedsResponse \p k
 void from_json(const json& j, NotifyEVChargingNeedsResponse& k);
 
@@ -30,6 +30,9 @@ struct NotifyEVChargingScheduleRequest : public ocpp::Message {
 /// \brief Conversion from a given NotifyEVChargingScheduleRequest \p k to a given json object \p j
 void to_json(json& j, const NotifyEVChargingScheduleRequest& k);
 
+/// \brief Writes the given NotifyEVChargingScheduleRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingScheduleRequest \p k
 void from_json(const json& j, NotifyEVChargingScheduleRequest& k);
 
@@ -51,6 +54,9 @@ struct NotifyEVChargingScheduleResponse : public ocpp::Message {
 /// \brief Conversion from a given NotifyEVChargingScheduleResponse \p k to a given json object \p j
 void to_json(json& j, const NotifyEVChargingScheduleResponse& k);
 
+/// \brief Writes the given NotifyEVChargingScheduleResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyEVChargingScheduleResponse \p k
 void from_json(const json& j, NotifyEVChargingScheduleResponse& k);
 
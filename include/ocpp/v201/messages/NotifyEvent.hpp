@@ -31,6 +31,9 @@ struct NotifyEventRequest : public ocpp::Message {
 /// \brief Conversion from a given NotifyEventRequest \p k to a given json object \p j
 void to_json(json& j, const NotifyEventRequest& k);
 
+/// \brief Writes the given NotifyEventRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyEventRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyEventRequest \p k
 void from_json(const json& j, NotifyEventRequest& k);
 
@@ -50,6 +53,9 @@ struct NotifyEventResponse : public ocpp::Message {
 /// \brief Conversion from a given NotifyEventResponse \p k to a given json object \p j
 void to_json(json& j, const NotifyEventResponse& k);
 
+/// \brief Writes the given NotifyEventResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyEventResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyEventResponse \p k
 void from_json(const json& j, NotifyEventResponse& k);
 
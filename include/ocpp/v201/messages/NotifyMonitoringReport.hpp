@@ -32,6 +32,9 @@ struct NotifyMonitoringReportRequest : public ocpp::Message {
 /// \brief Conversion from a given NotifyMonitoringReportRequest \p k to a given json object \p j
 void to_json(json& j, const NotifyMonitoringReportRequest& k);
 
+/// \brief Writes the given NotifyMonitoringReportRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyMonitoringReportRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyMonitoringReportRequest \p k
 void from_json(const json& j, NotifyMonitoringReportRequest& k);
 
@@ -51,6 +54,9 @@ struct NotifyMonitoringReportResponse : public ocpp::Message {
 /// \brief Conversion from a given NotifyMonitoringReportResponse \p k to a given json object \p j
 void to_json(json& j, const NotifyMonitoringReportResponse& k);
 
+/// \brief Writes the given NotifyMonitoringReportResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyMonitoringReportResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyMonitoringReportResponse \p k
 void from_json(const json& j, NotifyMonitoringReportResponse& k);
 
@@ -32,6 +32,9 @@ struct NotifyReportRequest : public ocpp::Message {
 /// \brief Conversion from a given NotifyReportRequest \p k to a given json object \p j
 void to_json(json& j, const NotifyReportRequest& k);
 
+/// \brief Writes the given NotifyReportRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyReportRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyReportRequest \p k
 void from_json(const json& j, NotifyReportRequest& k);
 
@@ -51,6 +54,9 @@ struct NotifyReportResponse : public ocpp::Message {
 /// \brief Conversion from a given NotifyReportResponse \p k to a given json object \p j
 void to_json(json& j, const NotifyReportResponse& k);
 
+/// \brief Writes the given NotifyReportResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NotifyReportResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given NotifyReportResponse \p k
 void from_json(const json& j, NotifyReportResponse& k);
 
@@ -32,6 +32,9 @@ struct PublishFirmwareRequest : public ocpp::Message {
 /// \brief Conversion from a given PublishFirmwareRequest \p k to a given json object \p j
 void to_json(json& j, const PublishFirmwareRequest& k);
 
+/// \brief Writes the given PublishFirmwareRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const PublishFirmwareRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareRequest \p k
 void from_json(const json& j, PublishFirmwareRequest& k);
 
@@ -53,6 +56,9 @@ struct PublishFirmwareResponse : public ocpp::Message {
 /// \brief Conversion from a given PublishFirmwareResponse \p k to a given json object \p j
 void to_json(json& j, const PublishFirmwareResponse& k);
 
+/// \brief Writes the given PublishFirmwareResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const PublishFirmwareResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareResponse \p k
 void from_json(const json& j, PublishFirmwareResponse& k);
 
@@ -30,6 +30,10 @@ struct PublishFirmwareStatusNotificationRequest : public ocpp::Message {
 /// \brief Conversion from a given PublishFirmwareStatusNotificationRequest \p k to a given json object \p j
 void to_json(json& j, const PublishFirmwareStatusNotificationRequest& k);
 
+/// \brief Writes the given PublishFirmwareStatusNotificationRequest \p k to the given \p writer without building a json
+/// object
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareStatusNotificationRequest \p k
 void from_json(const json& j, PublishFirmwareStatusNotificationRequest& k);
 
@@ -49,6 +53,10 @@ struct PublishFirmwareStatusNotificationResponse : public ocpp::Message {
 /// \brief Conversion from a given PublishFirmwareStatusNotificationResponse \p k to a given json object \p j
 void to_json(json& j, const PublishFirmwareStatusNotificationResponse& k);
 
+/// \brief Writes the given PublishFirmwareStatusNotificationResponse \p k to the given \p writer without building a
+/// json object
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given PublishFirmwareStatusNotificationResponse \p k
 void from_json(const json& j, PublishFirmwareStatusNotificationResponse& k);
 
@@ -32,6 +32,9 @@ struct ReportChargingProfilesRequest : public ocpp::Message {
 /// \brief Conversion from a given ReportChargingProfilesRequest \p k to a given json object \p j
 void to_json(json& j, const ReportChargingProfilesRequest& k);
 
+/// \brief Writes the given ReportChargingProfilesRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ReportChargingProfilesRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ReportChargingProfilesRequest \p k
 void from_json(const json& j, ReportChargingProfilesRequest& k);
 
@@ -51,6 +54,9 @@ struct ReportChargingProfilesResponse : public ocpp::Message {
 /// \brief Conversion from a given ReportChargingProfilesResponse \p k to a given json object \p j
 void to_json(json& j, const ReportChargingProfilesResponse& k);
 
+/// \brief Writes the given ReportChargingProfilesResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ReportChargingProfilesResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ReportChargingProfilesResponse \p k
 void from_json(const json& j, ReportChargingProfilesResponse& k);
 
@@ -32,6 +32,9 @@ struct RequestStartTransactionRequest : public ocpp::Message {
 /// \brief Conversion from a given RequestStartTransactionRequest \p k to a given json object \p j
 void to_json(json& j, const RequestStartTransactionRequest& k);
 
+/// \brief Writes the given RequestStartTransactionRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const RequestStartTransactionRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given RequestStartTransactionRequest \p k
 void from_json(const json& j, RequestStartTransactionRequest& k);
 
@@ -54,6 +57,9 @@ struct RequestStartTransactionResponse : public ocpp::Message {
 /// \brief Conversion from a given RequestStartTransactionResponse \p k to a given json object \p j
 void to_json(json& j, const RequestStartTransactionResponse& k);
 
+/// \brief Writes the given RequestStartTransactionResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const RequestStartTransactionResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given RequestStartTransactionResponse \p k
 void from_json(const json& j, RequestStartTransactionResponse& k);
 
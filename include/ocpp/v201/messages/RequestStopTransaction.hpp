@@ -28,6 +28,9 @@ struct RequestStopTransactionRequest : public ocpp::Message {
 /// \brief Conversion from a given RequestStopTransactionRequest \p k to a given json object \p j
 void to_json(json& j, const RequestStopTransactionRequest& k);
 
+/// \brief Writes the given RequestStopTransactionRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const RequestStopTransactionRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given RequestStopTransactionRequest \p k
 void from_json(const json& j, RequestStopTransactionRequest& k);
 
@@ -49,6 +52,9 @@ struct RequestStopTransactionResponse : public ocpp::Message {
 /// \brief Conversion from a given RequestStopTransactionResponse \p k to a given json object \p j
 void to_json(json& j, const RequestStopTransactionResponse& k);
 
+/// \brief Writes the given RequestStopTransactionResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const RequestStopTransactionResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given RequestStopTransactionResponse \p k
 void from_json(const json& j, RequestStopTransactionResponse& k);
 
@@ -29,6 +29,9 @@ struct ReservationStatusUpdateRequest : public ocpp::Message {
 /// \brief Conversion from a given ReservationStatusUpdateRequest \p k to a given json object \p j
 void to_json(json& j, const ReservationStatusUpdateRequest& k);
 
+/// \brief Writes the given ReservationStatusUpdateRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ReservationStatusUpdateRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ReservationStatusUpdateRequest \p k
 void from_json(const json& j, ReservationStatusUpdateRequest& k);
 
@@ -48,6 +51,9 @@ struct ReservationStatusUpdateResponse : public ocpp::Message {
 /// \brief Conversion from a given ReservationStatusUpdateResponse \p k to a given json object \p j
 void to_json(json& j, const ReservationStatusUpdateResponse& k);
 
+/// \brief Writes the given ReservationStatusUpdateResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ReservationStatusUpdateResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ReservationStatusUpdateResponse \p k
 void from_json(const json& j, ReservationStatusUpdateResponse& k);
 
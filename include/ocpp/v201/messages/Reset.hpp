@@ -29,6 +29,9 @@ struct ResetRequest : public ocpp::Message {
 /// \brief Conversion from a given ResetRequest \p k to a given json object \p j
 void to_json(json& j, const ResetRequest& k);
 
+/// \brief Writes the given ResetRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ResetRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given ResetRequest \p k
 void from_json(const json& j, ResetRequest& k);
 
@@ -50,6 +53,9 @@ struct ResetResponse : public ocpp::Message {
 /// \brief Conversion from a given ResetResponse \p k to a given json object \p j
 void to_json(json& j, const ResetResponse& k);
 
+/// \brief Writes the given ResetResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ResetResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given ResetResponse \p k
 void from_json(const json& j, ResetResponse& k);
 
@@ -29,6 +29,9 @@ struct SecurityEventNotificationRequest : public ocpp::Message {
 /// \brief Conversion from a given SecurityEventNotificationRequest \p k to a given json object \p j
 void to_json(json& j, const SecurityEventNotificationRequest& k);
 
+/// \brief Writes the given SecurityEventNotificationRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SecurityEventNotificationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SecurityEventNotificationRequest \p k
 void from_json(const json& j, SecurityEventNotificationRequest& k);
 
@@ -48,6 +51,9 @@ struct SecurityEventNotificationResponse : public ocpp::Message {
 /// \brief Conversion from a given SecurityEventNotificationResponse \p k to a given json object \p j
 void to_json(json& j, const SecurityEventNotificationResponse& k);
 
+/// \brief Writes the given SecurityEventNotificationResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SecurityEventNotificationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SecurityEventNotificationResponse \p k
 void from_json(const json& j, SecurityEventNotificationResponse& k);
 
@@ -28,6 +28,9 @@ struct SetDisplayMessageRequest : public ocpp::Message {
 /// \brief Conversion from a given SetDisplayMessageRequest \p k to a given json object \p j
 void to_json(json& j, const SetDisplayMessageRequest& k);
 
+/// \brief Writes the given SetDisplayMessageRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetDisplayMessageRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SetDisplayMessageRequest \p k
 void from_json(const json& j, SetDisplayMessageRequest& k);
 
@@ -49,6 +52,9 @@ struct SetDisplayMessageResponse : public ocpp::Message {
 /// \brief Conversion from a given SetDisplayMessageResponse \p k to a given json object \p j
 void to_json(json& j, const SetDisplayMessageResponse& k);
 
+/// \brief Writes the given SetDisplayMessageResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetDisplayMessageResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SetDisplayMessageResponse \p k
 void from_json(const json& j, SetDisplayMessageResponse& k);
 
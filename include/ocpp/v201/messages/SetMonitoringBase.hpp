@@ -28,6 +28,9 @@ struct SetMonitoringBaseRequest : public ocpp::Message {
 /// \brief Conversion from a given SetMonitoringBaseRequest \p k to a given json object \p j
 void to_json(json& j, const SetMonitoringBaseRequest& k);
 
+/// \brief Writes the given SetMonitoringBaseRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetMonitoringBaseRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SetMonitoringBaseRequest \p k
 void from_json(const json& j, SetMonitoringBaseRequest& k);
 
@@ -49,6 +52,9 @@ struct SetMonitoringBaseResponse : public ocpp::Message {
 /// \brief Conversion from a given SetMonitoringBaseResponse \p k to a given json object \p j
 void to_json(json& j, const SetMonitoringBaseResponse& k);
 
+/// \brief Writes the given SetMonitoringBaseResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetMonitoringBaseResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SetMonitoringBaseResponse \p k
 void from_json(const json& j, SetMonitoringBaseResponse& k);
 
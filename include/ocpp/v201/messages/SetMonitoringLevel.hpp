@@ -28,6 +28,9 @@ struct SetMonitoringLevelRequest : public ocpp::Message {
 /// \brief Conversion from a given SetMonitoringLevelRequest \p k to a given json object \p j
 void to_json(json& j, const SetMonitoringLevelRequest& k);
 
+/// \brief Writes the given SetMonitoringLevelRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetMonitoringLevelRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SetMonitoringLevelRequest \p k
 void from_json(const json& j, SetMonitoringLevelRequest& k);
 
@@ -49,6 +52,9 @@ struct SetMonitoringLevelResponse : public ocpp::Message {
 /// \brief Conversion from a given SetMonitoringLevelResponse \p k to a given json object \p j
 void to_json(json& j, const SetMonitoringLevelResponse& k);
 
+/// \brief Writes the given SetMonitoringLevelResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetMonitoringLevelResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SetMonitoringLevelResponse \p k
 void from_json(const json& j, SetMonitoringLevelResponse& k);
 
@@ -29,6 +29,9 @@ struct SetNetworkProfileRequest : public ocpp::Message {
 /// \brief Conversion from a given SetNetworkProfileRequest \p k to a given json object \p j
 void to_json(json& j, const SetNetworkProfileRequest& k);
 
+/// \brief Writes the given SetNetworkProfileRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetNetworkProfileRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SetNetworkProfileRequest \p k
 void from_json(const json& j, SetNetworkProfileRequest& k);
 
@@ -50,6 +53,9 @@ struct SetNetworkProfileResponse : public ocpp::Message {
 /// \brief Conversion from a given SetNetworkProfileResponse \p k to a given json object \p j
 void to_json(json& j, const SetNetworkProfileResponse& k);
 
+/// \brief Writes the given SetNetworkProfileResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetNetworkProfileResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SetNetworkProfileResponse \p k
 void from_json(const json& j, SetNetworkProfileResponse& k);
 
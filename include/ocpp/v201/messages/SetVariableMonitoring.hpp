@@ -28,6 +28,9 @@ struct SetVariableMonitoringRequest : public ocpp::Message {
 /// \brief Conversion from a given SetVariableMonitoringRequest \p k to a given json object \p j
 void to_json(json& j, const SetVariableMonitoringRequest& k);
 
+/// \brief Writes the given SetVariableMonitoringRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetVariableMonitoringRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SetVariableMonitoringRequest \p k
 void from_json(const json& j, SetVariableMonitoringRequest& k);
 
@@ -48,6 +51,9 @@ struct SetVariableMonitoringResponse : public ocpp::Message {
 /// \brief Conversion from a given SetVariableMonitoringResponse \p k to a given json object \p j
 void to_json(json& j, const SetVariableMonitoringResponse& k);
 
+/// \brief Writes the given SetVariableMonitoringResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetVariableMonitoringResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SetVariableMonitoringResponse \p k
 void from_json(const json& j, SetVariableMonitoringResponse& k);
 
@@ -28,6 +28,9 @@ struct SetVariablesRequest : public ocpp::Message {
 /// \brief Conversion from a given SetVariablesRequest \p k to a given json object \p j
 void to_json(json& j, const SetVariablesRequest& k);
 
+/// \brief Writes the given SetVariablesRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetVariablesRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SetVariablesRequest \p k
 void from_json(const json& j, SetVariablesRequest& k);
 
@@ -48,6 +51,9 @@ struct SetVariablesResponse : public ocpp::Message {
 /// \brief Conversion from a given SetVariablesResponse \p k to a given json object \p j
 void to_json(json& j, const SetVariablesResponse& k);
 
+/// \brief Writes the given SetVariablesResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetVariablesResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SetVariablesResponse \p k
 void from_json(const json& j, SetVariablesResponse& k);
 
@@ -29,6 +29,9 @@ struct SignCertificateRequest : public ocpp::Message {
 /// \brief Conversion from a given SignCertificateRequest \p k to a given json object \p j
 void to_json(json& j, const SignCertificateRequest& k);
 
+/// \brief Writes the given SignCertificateRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SignCertificateRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given SignCertificateRequest \p k
 void from_json(const json& j, SignCertificateRequest& k);
 
@@ -50,6 +53,9 @@ struct SignCertificateResponse : public ocpp::Message {
 /// \brief Conversion from a given SignCertificateResponse \p k to a given json object \p j
 void to_json(json& j, const SignCertificateResponse& k);
 
+/// \brief Writes the given SignCertificateResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SignCertificateResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given SignCertificateResponse \p k
 void from_json(const json& j, SignCertificateResponse& k);
 
@@ -31,6 +31,9 @@ struct StatusNotificationRequest : public ocpp::Message {
 /// \brief Conversion from a given StatusNotificationRequest \p k to a given json object \p j
 void to_json(json& j, const StatusNotificationRequest& k);
 
+/// \brief Writes the given StatusNotificationRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given StatusNotificationRequest \p k
 void from_json(const json& j, StatusNotificationRequest& k);
 
@@ -50,6 +53,9 @@ struct StatusNotificationResponse : public ocpp::Message {
 /// \brief Conversion from a given StatusNotificationResponse \p k to a given json object \p j
 void to_json(json& j, const StatusNotificationResponse& k);
 
+/// \brief Writes the given StatusNotificationResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given StatusNotificationResponse \p k
 void from_json(const json& j, StatusNotificationResponse& k);
 
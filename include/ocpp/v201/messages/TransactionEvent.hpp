@@ -39,6 +39,9 @@ struct TransactionEventRequest : public ocpp::Message {
 /// \brief Conversion from a given TransactionEventRequest \p k to a given json object \p j
 void to_json(json& j, const TransactionEventRequest& k);
 
+/// \brief Writes the given TransactionEventRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const TransactionEventRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given TransactionEventRequest \p k
 void from_json(const json& j, TransactionEventRequest& k);
 
@@ -62,6 +65,9 @@ struct TransactionEventResponse : public ocpp::Message {
 /// \brief Conversion from a given TransactionEventResponse \p k to a given json object \p j
 void to_json(json& j, const TransactionEventResponse& k);
 
+/// \brief Writes the given TransactionEventResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const TransactionEventResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given TransactionEventResponse \p k
 void from_json(const json& j, TransactionEventResponse& k);
 
@@ -29,6 +29,9 @@ struct TriggerMessageRequest : public ocpp::Message {
 /// \brief Conversion from a given TriggerMessageRequest \p k to a given json object \p j
 void to_json(json& j, const TriggerMessageRequest& k);
 
+/// \brief Writes the given TriggerMessageRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const TriggerMessageRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given TriggerMessageRequest \p k
 void from_json(const json& j, TriggerMessageRequest& k);
 
@@ -50,6 +53,9 @@ struct TriggerMessageResponse : public ocpp::Message {
 /// \brief Conversion from a given TriggerMessageResponse \p k to a given json object \p j
 void to_json(json& j, const TriggerMessageResponse& k);
 
+/// \brief Writes the given TriggerMessageResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const TriggerMessageResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given TriggerMessageResponse \p k
 void from_json(const json& j, TriggerMessageResponse& k);
 
@@ -29,6 +29,9 @@ struct UnlockConnectorRequest : public ocpp::Message {
 /// \brief Conversion from a given UnlockConnectorRequest \p k to a given json object \p j
 void to_json(json& j, const UnlockConnectorRequest& k);
 
+/// \brief Writes the given UnlockConnectorRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const UnlockConnectorRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given UnlockConnectorRequest \p k
 void from_json(const json& j, UnlockConnectorRequest& k);
 
@@ -50,6 +53,9 @@ struct UnlockConnectorResponse : public ocpp::Message {
 /// \brief Conversion from a given UnlockConnectorResponse \p k to a given json object \p j
 void to_json(json& j, const UnlockConnectorResponse& k);
 
+/// \brief Writes the given UnlockConnectorResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const UnlockConnectorResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given UnlockConnectorResponse \p k
 void from_json(const json& j, UnlockConnectorResponse& k);
 
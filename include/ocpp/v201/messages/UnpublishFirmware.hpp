@@ -28,6 +28,9 @@ struct UnpublishFirmwareRequest : public ocpp::Message {
 /// \brief Conversion from a given UnpublishFirmwareRequest \p k to a given json object \p j
 void to_json(json& j, const UnpublishFirmwareRequest& k);
 
+/// \brief Writes the given UnpublishFirmwareRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const UnpublishFirmwareRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given UnpublishFirmwareRequest \p k
 void from_json(const json& j, UnpublishFirmwareRequest& k);
 
@@ -48,6 +51,9 @@ struct UnpublishFirmwareResponse : public ocpp::Message {
 /// \brief Conversion from a given UnpublishFirmwareResponse \p k to a given json object \p j
 void to_json(json& j, const UnpublishFirmwareResponse& k);
 
+/// \brief Writes the given UnpublishFirmwareResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const UnpublishFirmwareResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given UnpublishFirmwareResponse \p k
 void from_json(const json& j, UnpublishFirmwareResponse& k);
 
@@ -31,6 +31,9 @@ struct UpdateFirmwareRequest : public ocpp::Message {
 /// \brief Conversion from a given UpdateFirmwareRequest \p k to a given json object \p j
 void to_json(json& j, const UpdateFirmwareRequest& k);
 
+/// \brief Writes the given UpdateFirmwareRequest \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k);
+
 /// \brief Conversion from a given json object \p j to a given UpdateFirmwareRequest \p k
 void from_json(const json& j, UpdateFirmwareRequest& k);
 
@@ -52,6 +55,9 @@ struct UpdateFirmwareResponse : public ocpp::Message {
 /// \brief Conversion from a given UpdateFirmwareResponse \p k to a given json object \p j
 void to_json(json& j, const UpdateFirmwareResponse& k);
 
+/// \brief Writes the given UpdateFirmwareResponse \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k);
+
 /// \brief Conversion from a given json object \p j to a given UpdateFirmwareResponse \p k
 void from_json(const json& j, UpdateFirmwareResponse& k);
 
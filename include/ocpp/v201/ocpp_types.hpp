@@ -10,6 +10,7 @@
 #include <nlohmann/json_fwd.hpp>
 #include <optional>
 
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 
@@ -26,6 +27,9 @@ struct AdditionalInfo {
 /// \brief Conversion from a given AdditionalInfo \p k to a given json object \p j
 void to_json(json& j, const AdditionalInfo& k);
 
+/// \brief Writes the given AdditionalInfo \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const AdditionalInfo& k);
+
 /// \brief Conversion from a given json object \p j to a given AdditionalInfo \p k
 void from_json(const json& j, AdditionalInfo& k);
 
@@ -42,6 +46,9 @@ struct IdToken {
 /// \brief Conversion from a given IdToken \p k to a given json object \p j
 void to_json(json& j, const IdToken& k);
 
+/// \brief Writes the given IdToken \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const IdToken& k);
+
 /// \brief Conversion from a given json object \p j to a given IdToken \p k
 void from_json(const json& j, IdToken& k);
 
@@ -60,6 +67,9 @@ struct OCSPRequestData {
 /// \brief Conversion from a given OCSPRequestData \p k to a given json object \p j
 void to_json(json& j, const OCSPRequestData& k);
 
+/// \brief Writes the given OCSPRequestData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const OCSPRequestData& k);
+
 /// \brief Conversion from a given json object \p j to a given OCSPRequestData \p k
 void from_json(const json& j, OCSPRequestData& k);
 
@@ -76,6 +86,9 @@ struct MessageContent {
 /// \brief Conversion from a given MessageContent \p k to a given json object \p j
 void to_json(json& j, const MessageContent& k);
 
+/// \brief Writes the given MessageContent \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MessageContent& k);
+
 /// \brief Conversion from a given json object \p j to a given MessageContent \p k
 void from_json(const json& j, MessageContent& k);
 
@@ -97,6 +110,9 @@ struct IdTokenInfo {
 /// \brief Conversion from a given IdTokenInfo \p k to a given json object \p j
 void to_json(json& j, const IdTokenInfo& k);
 
+/// \brief Writes the given IdTokenInfo \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const IdTokenInfo& k);
+
 /// \brief Conversion from a given json object \p j to a given IdTokenInfo \p k
 void from_json(const json& j, IdTokenInfo& k);
 
@@ -112,6 +128,9 @@ struct Modem {
 /// \brief Conversion from a given Modem \p k to a given json object \p j
 void to_json(json& j, const Modem& k);
 
+/// \brief Writes the given Modem \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Modem& k);
+
 /// \brief Conversion from a given json object \p j to a given Modem \p k
 void from_json(const json& j, Modem& k);
 
@@ -130,6 +149,9 @@ struct ChargingStation {
 /// \brief Conversion from a given ChargingStation \p k to a given json object \p j
 void to_json(json& j, const ChargingStation& k);
 
+/// \brief Writes the given ChargingStation \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingStation& k);
+
 /// \brief Conversion from a given json object \p j to a given ChargingStation \p k
 void from_json(const json& j, ChargingStation& k);
 
@@ -145,6 +167,9 @@ struct StatusInfo {
 /// \brief Conversion from a given StatusInfo \p k to a given json object \p j
 void to_json(json& j, const StatusInfo& k);
 
+/// \brief Writes the given StatusInfo \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const StatusInfo& k);
+
 /// \brief Conversion from a given json object \p j to a given StatusInfo \p k
 void from_json(const json& j, StatusInfo& k);
 
@@ -160,6 +185,9 @@ struct EVSE {
 /// \brief Conversion from a given EVSE \p k to a given json object \p j
 void to_json(json& j, const EVSE& k);
 
+/// \brief Writes the given EVSE \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const EVSE& k);
+
 /// \brief Conversion from a given json object \p j to a given EVSE \p k
 void from_json(const json& j, EVSE& k);
 
@@ -176,6 +204,9 @@ struct ClearChargingProfile {
 /// \brief Conversion from a given ClearChargingProfile \p k to a given json object \p j
 void to_json(json& j, const ClearChargingProfile& k);
 
+/// \brief Writes the given ClearChargingProfile \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearChargingProfile& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfile \p k
 void from_json(const json& j, ClearChargingProfile& k);
 
@@ -192,6 +223,9 @@ struct ClearMonitoringResult {
 /// \brief Conversion from a given ClearMonitoringResult \p k to a given json object \p j
 void to_json(json& j, const ClearMonitoringResult& k);
 
+/// \brief Writes the given ClearMonitoringResult \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearMonitoringResult& k);
+
 /// \brief Conversion from a given json object \p j to a given ClearMonitoringResult \p k
 void from_json(const json& j, ClearMonitoringResult& k);
 
@@ -209,6 +243,9 @@ struct CertificateHashDataType {
 /// \brief Conversion from a given CertificateHashDataType \p k to a given json object \p j
 void to_json(json& j, const CertificateHashDataType& k);
 
+/// \brief Writes the given CertificateHashDataType \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CertificateHashDataType& k);
+
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k);
 
@@ -226,6 +263,9 @@ struct ChargingProfileCriterion {
 /// \brief Conversion from a given ChargingProfileCriterion \p k to a given json object \p j
 void to_json(json& j, const ChargingProfileCriterion& k);
 
+/// \brief Writes the given ChargingProfileCriterion \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingProfileCriterion& k);
+
 /// \brief Conversion from a given json object \p j to a given ChargingProfileCriterion \p k
 void from_json(const json& j, ChargingProfileCriterion& k);
 
@@ -243,6 +283,9 @@ struct ChargingSchedulePeriod {
 /// \brief Conversion from a given ChargingSchedulePeriod \p k to a given json object \p j
 void to_json(json& j, const ChargingSchedulePeriod& k);
 
+/// \brief Writes the given ChargingSchedulePeriod \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k);
+
 /// \brief Conversion from a given json object \p j to a given ChargingSchedulePeriod \p k
 void from_json(const json& j, ChargingSchedulePeriod& k);
 
@@ -261,6 +304,9 @@ struct CompositeSchedule {
 /// \brief Conversion from a given CompositeSchedule \p k to a given json object \p j
 void to_json(json& j, const CompositeSchedule& k);
 
+/// \brief Writes the given CompositeSchedule \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CompositeSchedule& k);
+
 /// \brief Conversion from a given json object \p j to a given CompositeSchedule \p k
 void from_json(const json& j, CompositeSchedule& k);
 
@@ -277,6 +323,9 @@ struct CertificateHashDataChain {
 /// \brief Conversion from a given CertificateHashDataChain \p k to a given json object \p j
 void to_json(json& j, const CertificateHashDataChain& k);
 
+/// \brief Writes the given CertificateHashDataChain \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CertificateHashDataChain& k);
+
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataChain \p k
 void from_json(const json& j, CertificateHashDataChain& k);
 
@@ -293,6 +342,9 @@ struct LogParameters {
 /// \brief Conversion from a given LogParameters \p k to a given json object \p j
 void to_json(json& j, const LogParameters& k);
 
+/// \brief Writes the given LogParameters \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const LogParameters& k);
+
 /// \brief Conversion from a given json object \p j to a given LogParameters \p k
 void from_json(const json& j, LogParameters& k);
 
@@ -309,6 +361,9 @@ struct Component {
 /// \brief Conversion from a given Component \p k to a given json object \p j
 void to_json(json& j, const Component& k);
 
+/// \brief Writes the given Component \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Component& k);
+
 /// \brief Conversion from a given json object \p j to a given Component \p k
 void from_json(const json& j, Component& k);
 
@@ -324,6 +379,9 @@ struct Variable {
 /// \brief Conversion from a given Variable \p k to a given json object \p j
 void to_json(json& j, const Variable& k);
 
+/// \brief Writes the given Variable \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Variable& k);
+
 /// \brief Conversion from a given json object \p j to a given Variable \p k
 void from_json(const json& j, Variable& k);
 
@@ -339,6 +397,9 @@ struct ComponentVariable {
 /// \brief Conversion from a given ComponentVariable \p k to a given json object \p j
 void to_json(json& j, const ComponentVariable& k);
 
+/// \brief Writes the given ComponentVariable \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ComponentVariable& k);
+
 /// \brief Conversion from a given json object \p j to a given ComponentVariable \p k
 void from_json(const json& j, ComponentVariable& k);
 
@@ -355,6 +416,9 @@ struct GetVariableData {
 /// \brief Conversion from a given GetVariableData \p k to a given json object \p j
 void to_json(json& j, const GetVariableData& k);
 
+/// \brief Writes the given GetVariableData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetVariableData& k);
+
 /// \brief Conversion from a given json object \p j to a given GetVariableData \p k
 void from_json(const json& j, GetVariableData& k);
 
@@ -374,6 +438,9 @@ struct GetVariableResult {
 /// \brief Conversion from a given GetVariableResult \p k to a given json object \p j
 void to_json(json& j, const GetVariableResult& k);
 
+/// \brief Writes the given GetVariableResult \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetVariableResult& k);
+
 /// \brief Conversion from a given json object \p j to a given GetVariableResult \p k
 void from_json(const json& j, GetVariableResult& k);
 
@@ -391,6 +458,9 @@ struct SignedMeterValue {
 /// \brief Conversion from a given SignedMeterValue \p k to a given json object \p j
 void to_json(json& j, const SignedMeterValue& k);
 
+/// \brief Writes the given SignedMeterValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SignedMeterValue& k);
+
 /// \brief Conversion from a given json object \p j to a given SignedMeterValue \p k
 void from_json(const json& j, SignedMeterValue& k);
 
@@ -406,6 +476,9 @@ struct UnitOfMeasure {
 /// \brief Conversion from a given UnitOfMeasure \p k to a given json object \p j
 void to_json(json& j, const UnitOfMeasure& k);
 
+/// \brief Writes the given UnitOfMeasure \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const UnitOfMeasure& k);
+
 /// \brief Conversion from a given json object \p j to a given UnitOfMeasure \p k
 void from_json(const json& j, UnitOfMeasure& k);
 
@@ -426,6 +499,9 @@ struct SampledValue {
 /// \brief Conversion from a given SampledValue \p k to a given json object \p j
 void to_json(json& j, const SampledValue& k);
 
+/// \brief Writes the given SampledValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SampledValue& k);
+
 /// \brief Conversion from a given json object \p j to a given SampledValue \p k
 void from_json(const json& j, SampledValue& k);
 
@@ -441,6 +517,9 @@ struct MeterValue {
 /// \brief Conversion from a given MeterValue \p k to a given json object \p j
 void to_json(json& j, const MeterValue& k);
 
+/// \brief Writes the given MeterValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MeterValue& k);
+
 /// \brief Conversion from a given json object \p j to a given MeterValue \p k
 void from_json(const json& j, MeterValue& k);
 
@@ -456,6 +535,9 @@ struct RelativeTimeInterval {
 /// \brief Conversion from a given RelativeTimeInterval \p k to a given json object \p j
 void to_json(json& j, const RelativeTimeInterval& k);
 
+/// \brief Writes the given RelativeTimeInterval \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const RelativeTimeInterval& k);
+
 /// \brief Conversion from a given json object \p j to a given RelativeTimeInterval \p k
 void from_json(const json& j, RelativeTimeInterval& k);
 
@@ -472,6 +554,9 @@ struct Cost {
 /// \brief Conversion from a given Cost \p k to a given json object \p j
 void to_json(json& j, const Cost& k);
 
+/// \brief Writes the given Cost \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Cost& k);
+
 /// \brief Conversion from a given json object \p j to a given Cost \p k
 void from_json(const json& j, Cost& k);
 
@@ -487,6 +572,9 @@ struct ConsumptionCost {
 /// \brief Conversion from a given ConsumptionCost \p k to a given json object \p j
 void to_json(json& j, const ConsumptionCost& k);
 
+/// \brief Writes the given ConsumptionCost \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ConsumptionCost& k);
+
 /// \brief Conversion from a given json object \p j to a given ConsumptionCost \p k
 void from_json(const json& j, ConsumptionCost& k);
 
@@ -503,6 +591,9 @@ struct SalesTariffEntry {
 /// \brief Conversion from a given SalesTariffEntry \p k to a given json object \p j
 void to_json(json& j, const SalesTariffEntry& k);
 
+/// \brief Writes the given SalesTariffEntry \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SalesTariffEntry& k);
+
 /// \brief Conversion from a given json object \p j to a given SalesTariffEntry \p k
 void from_json(const json& j, SalesTariffEntry& k);
 
@@ -520,6 +611,9 @@ struct SalesTariff {
 /// \brief Conversion from a given SalesTariff \p k to a given json object \p j
 void to_json(json& j, const SalesTariff& k);
 
+/// \brief Writes the given SalesTariff \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SalesTariff& k);
+
 /// \brief Conversion from a given json object \p j to a given SalesTariff \p k
 void from_json(const json& j, SalesTariff& k);
 
@@ -540,6 +634,9 @@ struct ChargingSchedule {
 /// \brief Conversion from a given ChargingSchedule \p k to a given json object \p j
 void to_json(json& j, const ChargingSchedule& k);
 
+/// \brief Writes the given ChargingSchedule \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingSchedule& k);
+
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, ChargingSchedule& k);
 
@@ -555,6 +652,9 @@ struct ChargingLimit {
 /// \brief Conversion from a given ChargingLimit \p k to a given json object \p j
 void to_json(json& j, const ChargingLimit& k);
 
+/// \brief Writes the given ChargingLimit \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingLimit& k);
+
 /// \brief Conversion from a given json object \p j to a given ChargingLimit \p k
 void from_json(const json& j, ChargingLimit& k);
 
@@ -576,6 +676,9 @@ struct MessageInfo {
 /// \brief Conversion from a given MessageInfo \p k to a given json object \p j
 void to_json(json& j, const MessageInfo& k);
 
+/// \brief Writes the given MessageInfo \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MessageInfo& k);
+
 /// \brief Conversion from a given json object \p j to a given MessageInfo \p k
 void from_json(const json& j, MessageInfo& k);
 
@@ -593,6 +696,9 @@ struct ACChargingParameters {
 /// \brief Conversion from a given ACChargingParameters \p k to a given json object \p j
 void to_json(json& j, const ACChargingParameters& k);
 
+/// \brief Writes the given ACChargingParameters \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ACChargingParameters& k);
+
 /// \brief Conversion from a given json object \p j to a given ACChargingParameters \p k
 void from_json(const json& j, ACChargingParameters& k);
 
@@ -614,6 +720,9 @@ struct DCChargingParameters {
 /// \brief Conversion from a given DCChargingParameters \p k to a given json object \p j
 void to_json(json& j, const DCChargingParameters& k);
 
+/// \brief Writes the given DCChargingParameters \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const DCChargingParameters& k);
+
 /// \brief Conversion from a given json object \p j to a given DCChargingParameters \p k
 void from_json(const json& j, DCChargingParameters& k);
 
@@ -631,6 +740,9 @@ struct ChargingNeeds {
 /// \brief Conversion from a given ChargingNeeds \p k to a given json object \p j
 void to_json(json& j, const ChargingNeeds& k);
 
+/// \brief Writes the given ChargingNeeds \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingNeeds& k);
+
 /// \brief Conversion from a given json object \p j to a given ChargingNeeds \p k
 void from_json(const json& j, ChargingNeeds& k);
 
@@ -657,6 +769,9 @@ struct EventData {
 /// \brief Conversion from a given EventData \p k to a given json object \p j
 void to_json(json& j, const EventData& k);
 
+/// \brief Writes the given EventData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const EventData& k);
+
 /// \brief Conversion from a given json object \p j to a given EventData \p k
 void from_json(const json& j, EventData& k);
 
@@ -675,6 +790,9 @@ struct VariableMonitoring {
 /// \brief Conversion from a given VariableMonitoring \p k to a given json object \p j
 void to_json(json& j, const VariableMonitoring& k);
 
+/// \brief Writes the given VariableMonitoring \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const VariableMonitoring& k);
+
 /// \brief Conversion from a given json object \p j to a given VariableMonitoring \p k
 void from_json(const json& j, VariableMonitoring& k);
 
@@ -691,6 +809,9 @@ struct MonitoringData {
 /// \brief Conversion from a given MonitoringData \p k to a given json object \p j
 void to_json(json& j, const MonitoringData& k);
 
+/// \brief Writes the given MonitoringData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MonitoringData& k);
+
 /// \brief Conversion from a given json object \p j to a given MonitoringData \p k
 void from_json(const json& j, MonitoringData& k);
 
@@ -709,6 +830,9 @@ struct VariableAttribute {
 /// \brief Conversion from a given VariableAttribute \p k to a given json object \p j
 void to_json(json& j, const VariableAttribute& k);
 
+/// \brief Writes the given VariableAttribute \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const VariableAttribute& k);
+
 /// \brief Conversion from a given json object \p j to a given VariableAttribute \p k
 void from_json(const json& j, VariableAttribute& k);
 
@@ -728,6 +852,9 @@ struct VariableCharacteristics {
 /// \brief Conversion from a given VariableCharacteristics \p k to a given json object \p j
 void to_json(json& j, const VariableCharacteristics& k);
 
+/// \brief Writes the given VariableCharacteristics \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const VariableCharacteristics& k);
+
 /// \brief Conversion from a given json object \p j to a given VariableCharacteristics \p k
 void from_json(const json& j, VariableCharacteristics& k);
 
@@ -745,6 +872,9 @@ struct ReportData {
 /// \brief Conversion from a given ReportData \p k to a given json object \p j
 void to_json(json& j, const ReportData& k);
 
+/// \brief Writes the given ReportData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ReportData& k);
+
 /// \brief Conversion from a given json object \p j to a given ReportData \p k
 void from_json(const json& j, ReportData& k);
 
@@ -767,6 +897,9 @@ struct ChargingProfile {
 /// \brief Conversion from a given ChargingProfile \p k to a given json object \p j
 void to_json(json& j, const ChargingProfile& k);
 
+/// \brief Writes the given ChargingProfile \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingProfile& k);
+
 /// \brief Conversion from a given json object \p j to a given ChargingProfile \p k
 void from_json(const json& j, ChargingProfile& k);
 
@@ -782,6 +915,9 @@ struct AuthorizationData {
 /// \brief Conversion from a given AuthorizationData \p k to a given json object \p j
 void to_json(json& j, const AuthorizationData& k);
 
+/// \brief Writes the given AuthorizationData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const AuthorizationData& k);
+
 /// \brief Conversion from a given json object \p j to a given AuthorizationData \p k
 void from_json(const json& j, AuthorizationData& k);
 
@@ -802,6 +938,9 @@ struct APN {
 /// \brief Conversion from a given APN \p k to a given json object \p j
 void to_json(json& j, const APN& k);
 
+/// \brief Writes the given APN \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const APN& k);
+
 /// \brief Conversion from a given json object \p j to a given APN \p k
 void from_json(const json& j, APN& k);
 
@@ -821,6 +960,9 @@ struct VPN {
 /// \brief Conversion from a given VPN \p k to a given json object \p j
 void to_json(json& j, const VPN& k);
 
+/// \brief Writes the given VPN \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const VPN& k);
+
 /// \brief Conversion from a given json object \p j to a given VPN \p k
 void from_json(const json& j, VPN& k);
 
@@ -842,6 +984,9 @@ struct NetworkConnectionProfile {
 /// \brief Conversion from a given NetworkConnectionProfile \p k to a given json object \p j
 void to_json(json& j, const NetworkConnectionProfile& k);
 
+/// \brief Writes the given NetworkConnectionProfile \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NetworkConnectionProfile& k);
+
 /// \brief Conversion from a given json object \p j to a given NetworkConnectionProfile \p k
 void from_json(const json& j, NetworkConnectionProfile& k);
 
@@ -862,6 +1007,9 @@ struct SetMonitoringData {
 /// \brief Conversion from a given SetMonitoringData \p k to a given json object \p j
 void to_json(json& j, const SetMonitoringData& k);
 
+/// \brief Writes the given SetMonitoringData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetMonitoringData& k);
+
 /// \brief Conversion from a given json object \p j to a given SetMonitoringData \p k
 void from_json(const json& j, SetMonitoringData& k);
 
@@ -882,6 +1030,9 @@ struct SetMonitoringResult {
 /// \brief Conversion from a given SetMonitoringResult \p k to a given json object \p j
 void to_json(json& j, const SetMonitoringResult& k);
 
+/// \brief Writes the given SetMonitoringResult \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetMonitoringResult& k);
+
 /// \brief Conversion from a given json object \p j to a given SetMonitoringResult \p k
 void from_json(const json& j, SetMonitoringResult& k);
 
@@ -899,6 +1050,9 @@ struct SetVariableData {
 /// \brief Conversion from a given SetVariableData \p k to a given json object \p j
 void to_json(json& j, const SetVariableData& k);
 
+/// \brief Writes the given SetVariableData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetVariableData& k);
+
 /// \brief Conversion from a given json object \p j to a given SetVariableData \p k
 void from_json(const json& j, SetVariableData& k);
 
@@ -917,6 +1071,9 @@ struct SetVariableResult {
 /// \brief Conversion from a given SetVariableResult \p k to a given json object \p j
 void to_json(json& j, const SetVariableResult& k);
 
+/// \brief Writes the given SetVariableResult \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetVariableResult& k);
+
 /// \brief Conversion from a given json object \p j to a given SetVariableResult \p k
 void from_json(const json& j, SetVariableResult& k);
 
@@ -935,6 +1092,9 @@ struct Transaction {
 /// \brief Conversion from a given Transaction \p k to a given json object \p j
 void to_json(json& j, const Transaction& k);
 
+/// \brief Writes the given Transaction \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Transaction& k);
+
 /// \brief Conversion from a given json object \p j to a given Transaction \p k
 void from_json(const json& j, Transaction& k);
 
@@ -953,6 +1113,9 @@ struct Firmware {
 /// \brief Conversion from a given Firmware \p k to a given json object \p j
 void to_json(json& j, const Firmware& k);
 
+/// \brief Writes the given Firmware \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Firmware& k);
+
 /// \brief Conversion from a given json object \p j to a given Firmware \p k
 void from_json(const json& j, Firmware& k);
 
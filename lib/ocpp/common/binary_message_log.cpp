@@ -0,0 +1,102 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/binary_message_log.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace ocpp {
+
+namespace {
+
+/// \brief Size of the fields of a record that follow its length, without the message type and the message
+constexpr std::uint32_t RECORD_FIXED_SIZE = sizeof(std::int64_t) + sizeof(std::uint8_t) + sizeof(std::uint16_t);
+
+template <typename T> void put_le(std::ostream& os, T value) {
+    char bytes[sizeof(T)];
+    for (size_t i = 0; i < sizeof(T); i++) {
+        bytes[i] = static_cast<char>(static_cast<std::uint64_t>(value) >> (8 * i));
+    }
+    os.write(bytes, sizeof(T));
+}
+
+template <typename T> T get_le(const char* bytes) {
+    std::uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(T); i++) {
+        value |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    }
+    return static_cast<T>(value);
+}
+
+} // namespace
+
+void write_binary_log_header(std::ostream& os) {
+    os.write(BINARY_MESSAGE_LOG_MAGIC, sizeof(BINARY_MESSAGE_LOG_MAGIC) - 1);
+    put_le(os, BINARY_MESSAGE_LOG_VERSION);
+}
+
+size_t write_binary_log_record(std::ostream& os, const BinaryLogRecord& record) {
+    // A message type longer than the length field allows is cut, it is only a label
+    const auto message_type_size = static_cast<std::uint16_t>(
+        std::min<size_t>(record.message_type.size(), std::numeric_limits<std::uint16_t>::max()));
+    const auto timestamp =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(record.timestamp.time_since_epoch()).count();
+
+    const auto length = RECORD_FIXED_SIZE + message_type_size + record.message.size();
+    put_le(os, static_cast<std::uint32_t>(length));
+    put_le(os, static_cast<std::int64_t>(timestamp));
+    put_le(os, record.typ);
+    put_le(os, message_type_size);
+    os.write(record.message_type.data(), message_type_size);
+    os.write(record.message.data(), static_cast<std::streamsize>(record.message.size()));
+    return sizeof(std::uint32_t) + length;
+}
+
+bool read_binary_log_header(std::istream& is) {
+    char header[sizeof(BINARY_MESSAGE_LOG_MAGIC)];
+    if (not is.read(header, sizeof(header))) {
+        return false;
+    }
+    return std::memcmp(header, BINARY_MESSAGE_LOG_MAGIC, sizeof(BINARY_MESSAGE_LOG_MAGIC) - 1) == 0 and
+           get_le<std::uint8_t>(&header[sizeof(header) - 1]) == BINARY_MESSAGE_LOG_VERSION;
+}
+
+std::optional<BinaryLogRecord> read_binary_log_record(std::istream& is) {
+    char length_bytes[sizeof(std::uint32_t)];
+    is.read(length_bytes, sizeof(length_bytes));
+    if (is.gcount() == 0 and is.eof()) {
+        return std::nullopt;
+    }
+    if (not is) {
+        throw std::runtime_error("Binary message log ends within the length of a record");
+    }
+
+    const auto length = get_le<std::uint32_t>(length_bytes);
+    if (length < RECORD_FIXED_SIZE) {
+        throw std::runtime_error("Binary message log contains a record with an invalid length");
+    }
+
+    std::string payload(length, '\0');
+    if (not is.read(payload.data(), length)) {
+        throw std::runtime_error("Binary message log ends within a record");
+    }
+
+    BinaryLogRecord record;
+    record.timestamp = std::chrono::time_point<date::utc_clock>(
+        std::chrono::duration_cast<date::utc_clock::duration>(
+            std::chrono::nanoseconds(get_le<std::int64_t>(payload.data()))));
+    record.typ = get_le<std::uint8_t>(&payload[sizeof(std::int64_t)]);
+
+    const auto message_type_size = get_le<std::uint16_t>(&payload[sizeof(std::int64_t) + sizeof(std::uint8_t)]);
+    if (RECORD_FIXED_SIZE + message_type_size > length) {
+        throw std::runtime_error("Binary message log contains a record with an invalid message type length");
+    }
+    record.message_type = payload.substr(RECORD_FIXED_SIZE, message_type_size);
+    record.message = payload.substr(RECORD_FIXED_SIZE + message_type_size);
+    return record;
+}
+
+} // namespace ocpp
@@ -4,6 +4,8 @@
 #include <ocpp/common/database/database_connection.hpp>
 #include <ocpp/common/database/database_handler_common.hpp>
 
+#include <algorithm>
+#include <cctype>
 #include <everest/logging.hpp>
 
 using namespace std::chrono_literals;
@@ -45,8 +47,73 @@ public:
     }
 };
 
-DatabaseConnection::DatabaseConnection(const fs::path& database_file_path) noexcept :
-    db(nullptr), database_file_path(database_file_path), open_count(0) {
+DatabaseTuning DatabaseTuning::durable() {
+    DatabaseTuning tuning;
+    tuning.journal_mode = JournalMode::WAL;
+    tuning.synchronous = SynchronousMode::Full;
+    tuning.busy_timeout = 5s;
+    return tuning;
+}
+
+DatabaseTuning DatabaseTuning::fast() {
+    DatabaseTuning tuning;
+    tuning.journal_mode = JournalMode::WAL;
+    tuning.synchronous = SynchronousMode::Normal;
+    tuning.mmap_size = 64 * 1024 * 1024;
+    tuning.cache_size = -8 * 1024;
+    tuning.busy_timeout = 5s;
+    return tuning;
+}
+
+DatabaseTuning DatabaseTuning::from_preset(const std::string& name) {
+    if (name == "Durable") {
+        return DatabaseTuning::durable();
+    }
+    if (name == "Fast") {
+        return DatabaseTuning::fast();
+    }
+    throw std::out_of_range("No known database tuning preset: " + name);
+}
+
+static std::string journal_mode_to_string(const JournalMode journal_mode) {
+    switch (journal_mode) {
+    case JournalMode::Delete:
+        return "DELETE";
+    case JournalMode::Truncate:
+        return "TRUNCATE";
+    case JournalMode::Persist:
+        return "PERSIST";
+    case JournalMode::Memory:
+        return "MEMORY";
+    case JournalMode::WAL:
+        return "WAL";
+    case JournalMode::Off:
+        return "OFF";
+    }
+    throw std::out_of_range("No known string conversion for provided enum of type JournalMode");
+}
+
+static std::string synchronous_mode_to_string(const SynchronousMode synchronous) {
+    switch (synchronous) {
+    case SynchronousMode::Off:
+        return "OFF";
+    case SynchronousMode::Normal:
+        return "NORMAL";
+    case SynchronousMode::Full:
+        return "FULL";
+    case SynchronousMode::Extra:
+        return "EXTRA";
+    }
+    throw std::out_of_range("No known string conversion for provided enum of type SynchronousMode");
+}
+
+DatabaseConnection::DatabaseConnection(const fs::path& database_file_path, const DatabaseTuning& tuning,
+                                       std::size_t statement_cache_size) noexcept :
+    db(nullptr),
+    database_file_path(database_file_path),
+    open_count(0),
+    statement_cache_size(statement_cache_size),
+    tuning(tuning) {
 }
 
 DatabaseConnection::~DatabaseConnection() {
@@ -74,10 +141,52 @@ bool DatabaseConnection::open_connection() {
         EVLOG_error << "Error opening database at " << this->database_file_path << ": " << sqlite3_errmsg(db);
         return false;
     }
+    this->apply_tuning();
+    if (this->statement_cache_size > 0) {
+        this->statement_cache = std::make_shared<SQLiteStatementCache>(this->db, this->statement_cache_size);
+    }
     EVLOG_info << "Established connection to database: " << this->database_file_path;
     return true;
 }
 
+void DatabaseConnection::apply_tuning() {
+    if (this->tuning.busy_timeout.has_value()) {
+        sqlite3_busy_timeout(this->db, static_cast<int>(this->tuning.busy_timeout.value().count()));
+    }
+
+    // journal_mode has to be set first, it might not be changeable (e.g. for in-memory databases) and reports the mode
+    // that is actually used
+    if (this->tuning.journal_mode.has_value()) {
+        const auto requested = journal_mode_to_string(this->tuning.journal_mode.value());
+        try {
+            SQLiteStatement statement(this->db, "PRAGMA journal_mode = "s + requested);
+            if (statement.step() == SQLITE_ROW) {
+                std::string actual = statement.column_text(0);
+                std::transform(actual.begin(), actual.end(), actual.begin(),
+                               [](unsigned char c) { return static_cast<char>(std::toupper(c)); });
+                if (actual != requested) {
+                    EVLOG_info << "Database " << this->database_file_path << " uses journal_mode " << actual
+                               << " instead of requested " << requested;
+                }
+            }
+        } catch (const QueryExecutionException& e) {
+            EVLOG_warning << "Could not set journal_mode of database " << this->database_file_path << ": "
+                          << e.what();
+        }
+    }
+
+    if (this->tuning.synchronous.has_value()) {
+        const auto synchronous = synchronous_mode_to_string(this->tuning.synchronous.value());
+        this->execute_statement("PRAGMA synchronous = "s + synchronous);
+    }
+    if (this->tuning.mmap_size.has_value()) {
+        this->execute_statement("PRAGMA mmap_size = "s + std::to_string(this->tuning.mmap_size.value()));
+    }
+    if (this->tuning.cache_size.has_value()) {
+        this->execute_statement("PRAGMA cache_size = "s + std::to_string(this->tuning.cache_size.value()));
+    }
+}
+
 bool DatabaseConnection::close_connection() {
     return this->close_connection_internal(false);
 }
@@ -93,6 +202,9 @@ bool DatabaseConnection::close_connection_internal(bool force_close) {
         return true;
     }
 
+    // finalizes all idle cached statements, statements still in use will finalize themselves
+    this->statement_cache.reset();
+
     // forcefully finalize all statements before calling sqlite3_close
     sqlite3_stmt* stmt = nullptr;
     while ((stmt = sqlite3_next_stmt(db, stmt)) != nullptr) {
@@ -127,9 +239,21 @@ std::unique_ptr<DatabaseTransactionInterface> DatabaseConnection::begin_transact
 }
 
 std::unique_ptr<SQLiteStatementInterface> DatabaseConnection::new_statement(const std::string& sql) {
+    if (this->statement_cache != nullptr) {
+        return this->statement_cache->get_statement(sql);
+    }
     return std::make_unique<SQLiteStatement>(this->db, sql);
 }
 
+void DatabaseConnection::prepare_statements(const std::vector<std::string>& statements) {
+    if (this->statement_cache == nullptr) {
+        return;
+    }
+    for (const auto& statement : statements) {
+        this->statement_cache->prepare_statement(statement);
+    }
+}
+
 bool DatabaseConnection::clear_table(const std::string& table) {
     return this->execute_statement("DELETE FROM "s + table);
 }
@@ -8,6 +8,20 @@
 
 namespace ocpp::common {
 
+static std::string get_message_queue_table_name(const QueueType queue_type) {
+    return queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
+}
+
+static std::string get_insert_message_queue_sql(const QueueType queue_type) {
+    return "INSERT INTO " + get_message_queue_table_name(queue_type) +
+           " (UNIQUE_ID, MESSAGE, MESSAGE_TYPE, MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP) VALUES "
+           "(@unique_id, @message, @message_type, @message_attempts, @message_timestamp)";
+}
+
+static std::string get_remove_message_queue_sql(const QueueType queue_type) {
+    return "DELETE FROM " + get_message_queue_table_name(queue_type) + " WHERE UNIQUE_ID = @unique_id";
+}
+
 DatabaseHandlerCommon::DatabaseHandlerCommon(std::unique_ptr<DatabaseConnectionInterface> database,
                                              const fs::path& sql_migration_files_path,
                                              uint32_t target_schema_version) noexcept :
@@ -28,6 +42,12 @@ void DatabaseHandlerCommon::open_connection() {
     }
 
     this->init_sql();
+    this->database->prepare_statements(this->get_hot_statements());
+}
+
+std::vector<std::string> DatabaseHandlerCommon::get_hot_statements() {
+    return {get_insert_message_queue_sql(QueueType::Normal), get_insert_message_queue_sql(QueueType::Transaction),
+            get_remove_message_queue_sql(QueueType::Normal), get_remove_message_queue_sql(QueueType::Transaction)};
 }
 
 void DatabaseHandlerCommon::close_connection() {
@@ -37,7 +57,7 @@ void DatabaseHandlerCommon::close_connection() {
 std::vector<DBTransactionMessage> DatabaseHandlerCommon::get_message_queue_messages(const QueueType queue_type) {
     std::vector<DBTransactionMessage> messages;
 
-    const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
+    const std::string table_name = get_message_queue_table_name(queue_type);
 
     std::string sql = "SELECT UNIQUE_ID, MESSAGE, MESSAGE_TYPE, MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP FROM " + table_name;
 
@@ -80,15 +100,12 @@ std::vector<DBTransactionMessage> DatabaseHandlerCommon::get_message_queue_messa
 
 void DatabaseHandlerCommon::insert_message_queue_message(const DBTransactionMessage& db_message,
                                                          const QueueType queue_type) {
-    const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
-
-    const std::string sql = "INSERT INTO " + table_name +
-                            " (UNIQUE_ID, MESSAGE, MESSAGE_TYPE, MESSAGE_ATTEMPTS, MESSAGE_TIMESTAMP) VALUES "
-                            "(@unique_id, @message, @message_type, @message_attempts, @message_timestamp)";
+    const std::string sql = get_insert_message_queue_sql(queue_type);
 
     auto stmt = this->database->new_statement(sql);
 
-    const std::string message = db_message.json_message.dump();
+    const std::string message = db_message.serialized_json_message.empty() ? db_message.json_message.dump()
+                                                                           : db_message.serialized_json_message;
     stmt->bind_text("@unique_id", db_message.unique_id);
     stmt->bind_text("@message", message);
     stmt->bind_text("@message_type", db_message.message_type);
@@ -101,8 +118,7 @@ void DatabaseHandlerCommon::insert_message_queue_message(const DBTransactionMess
 }
 
 void DatabaseHandlerCommon::remove_message_queue_message(const std::string& unique_id, const QueueType queue_type) {
-    const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
-    std::string sql = "DELETE FROM " + table_name + " WHERE UNIQUE_ID = @unique_id";
+    const std::string sql = get_remove_message_queue_sql(queue_type);
 
     auto stmt = this->database->new_statement(sql);
 
@@ -113,8 +129,32 @@ void DatabaseHandlerCommon::remove_message_queue_message(const std::string& uniq
     }
 }
 
+void DatabaseHandlerCommon::update_message_queue(
+    const std::vector<std::pair<DBTransactionMessage, QueueType>>& inserts,
+    const std::vector<std::pair<std::string, QueueType>>& removals) {
+    auto transaction = this->database->begin_transaction();
+
+    // a single failing statement shall not discard the whole batch
+    for (const auto& [message, queue_type] : inserts) {
+        try {
+            this->insert_message_queue_message(message, queue_type);
+        } catch (const QueryExecutionException& e) {
+            EVLOG_warning << "Could not insert message into message queue: " << e.what();
+        }
+    }
+    for (const auto& [unique_id, queue_type] : removals) {
+        try {
+            this->remove_message_queue_message(unique_id, queue_type);
+        } catch (const QueryExecutionException& e) {
+            EVLOG_warning << "Could not delete message from message queue: " << e.what();
+        }
+    }
+
+    transaction->commit();
+}
+
 void DatabaseHandlerCommon::clear_message_queue(const QueueType queue_type) {
-    const std::string table_name = queue_type == QueueType::Normal ? "NORMAL_QUEUE" : "TRANSACTION_QUEUE";
+    const std::string table_name = get_message_queue_table_name(queue_type);
     const auto retval = this->database->clear_table(table_name);
     if (retval == false) {
         throw QueryExecutionException(this->database->get_error_message());
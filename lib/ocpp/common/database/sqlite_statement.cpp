@@ -8,21 +8,40 @@
 
 namespace ocpp::common {
 
-SQLiteStatement::SQLiteStatement(sqlite3* db, const std::string& query) : db(db), stmt(nullptr) {
-    if (sqlite3_prepare_v2(db, query.c_str(), query.size(), &this->stmt, nullptr) != SQLITE_OK) {
+static sqlite3_stmt* prepare_sqlite_statement(sqlite3* db, const std::string& query) {
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(db, query.c_str(), query.size(), &stmt, nullptr) != SQLITE_OK) {
         EVLOG_error << sqlite3_errmsg(db);
         throw QueryExecutionException("Could not prepare statement for database.");
     }
+    return stmt;
 }
 
-SQLiteStatement::~SQLiteStatement() {
-    if (this->stmt != nullptr) {
-        if (sqlite3_finalize(this->stmt) != SQLITE_OK) {
-            EVLOG_error << "Error finalizing statement: " << sqlite3_errmsg(this->db);
+static void finalize_sqlite_statement(sqlite3* db, sqlite3_stmt* stmt) {
+    if (stmt != nullptr) {
+        if (sqlite3_finalize(stmt) != SQLITE_OK) {
+            EVLOG_error << "Error finalizing statement: " << sqlite3_errmsg(db);
         }
     }
 }
 
+SQLiteStatement::SQLiteStatement(sqlite3* db, const std::string& query) :
+    db(db), stmt(prepare_sqlite_statement(db, query)) {
+}
+
+SQLiteStatement::SQLiteStatement(sqlite3* db, sqlite3_stmt* stmt, const std::string& query,
+                                 std::weak_ptr<SQLiteStatementCache> cache) :
+    db(db), stmt(stmt), cache(std::move(cache)), query(query) {
+}
+
+SQLiteStatement::~SQLiteStatement() {
+    if (const auto statement_cache = this->cache.lock()) {
+        statement_cache->release_statement(this->query, this->stmt);
+    } else {
+        finalize_sqlite_statement(this->db, this->stmt);
+    }
+}
+
 int SQLiteStatement::step() {
     return sqlite3_step(this->stmt);
 }
@@ -133,4 +152,60 @@ double SQLiteStatement::column_double(const int idx) {
     return sqlite3_column_double(this->stmt, idx);
 }
 
+SQLiteStatementCache::SQLiteStatementCache(sqlite3* db, std::size_t max_size) : db(db), max_size(max_size) {
+}
+
+SQLiteStatementCache::~SQLiteStatementCache() {
+    for (auto& [query, stmt] : this->statements) {
+        finalize_sqlite_statement(this->db, stmt);
+    }
+}
+
+std::unique_ptr<SQLiteStatement> SQLiteStatementCache::get_statement(const std::string& query) {
+    {
+        std::lock_guard<std::mutex> lock(this->statements_mutex);
+        const auto it = this->statements.find(query);
+        if (it != this->statements.end()) {
+            sqlite3_stmt* stmt = it->second;
+            this->statements.erase(it);
+            return std::make_unique<SQLiteStatement>(this->db, stmt, query, this->weak_from_this());
+        }
+    }
+
+    return std::make_unique<SQLiteStatement>(this->db, prepare_sqlite_statement(this->db, query), query,
+                                             this->weak_from_this());
+}
+
+void SQLiteStatementCache::prepare_statement(const std::string& query) {
+    {
+        std::lock_guard<std::mutex> lock(this->statements_mutex);
+        if (this->statements.count(query) != 0) {
+            return;
+        }
+    }
+
+    this->release_statement(query, prepare_sqlite_statement(this->db, query));
+}
+
+void SQLiteStatementCache::release_statement(const std::string& query, sqlite3_stmt* stmt) {
+    if (stmt == nullptr) {
+        return;
+    }
+
+    // a statement that is reset does not hold any read or write lock anymore and bindings are cleared so that
+    // parameters which are not bound by the next user are NULL, just like for a freshly prepared statement
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+
+    {
+        std::lock_guard<std::mutex> lock(this->statements_mutex);
+        if (this->statements.size() < this->max_size) {
+            this->statements.emplace(query, stmt);
+            return;
+        }
+    }
+
+    finalize_sqlite_statement(this->db, stmt);
+}
+
 } // namespace ocpp::common
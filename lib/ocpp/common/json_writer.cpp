@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/json_writer.hpp>
+
+#include <array>
+#include <charconv>
+#include <cmath>
+
+namespace ocpp {
+
+/// \brief Provides the length of the well-formed UTF-8 sequence that starts at \p position of \p value, with the same
+/// rules as the json serializer: no overlong encodings, no surrogates and no code points above U+10FFFF
+/// \returns the length of the sequence or 0 if it is not well-formed
+static size_t utf8_sequence_length(std::string_view value, size_t position) {
+    const auto byte = [&value](size_t i) { return static_cast<unsigned char>(value[i]); };
+    const auto lead = byte(position);
+    size_t length;
+    unsigned char min_second = 0x80;
+    unsigned char max_second = 0xbf;
+    if (lead >= 0xc2 and lead <= 0xdf) {
+        length = 2;
+    } else if (lead >= 0xe0 and lead <= 0xef) {
+        length = 3;
+        if (lead == 0xe0) {
+            min_second = 0xa0;
+        } else if (lead == 0xed) {
+            max_second = 0x9f;
+        }
+    } else if (lead >= 0xf0 and lead <= 0xf4) {
+        length = 4;
+        if (lead == 0xf0) {
+            min_second = 0x90;
+        } else if (lead == 0xf4) {
+            max_second = 0x8f;
+        }
+    } else {
+        return 0;
+    }
+    if (position + length > value.size()) {
+        return 0;
+    }
+    if (byte(position + 1) < min_second or byte(position + 1) > max_second) {
+        return 0;
+    }
+    for (size_t i = position + 2; i < position + length; i++) {
+        if (byte(i) < 0x80 or byte(i) > 0xbf) {
+            return 0;
+        }
+    }
+    return length;
+}
+
+JsonWriter::JsonWriter(size_t capacity) {
+    this->buffer.reserve(capacity);
+}
+
+JsonWriter::JsonWriter(std::string&& buffer, size_t headroom) : buffer(std::move(buffer)), headroom(headroom) {
+    this->clear();
+}
+
+void JsonWriter::clear() {
+    this->buffer.resize(this->headroom);
+    this->needs_separator = false;
+}
+
+const std::string& JsonWriter::str() const {
+    return this->buffer;
+}
+
+std::string_view JsonWriter::text() const {
+    return std::string_view(this->buffer).substr(this->headroom);
+}
+
+size_t JsonWriter::get_headroom() const {
+    return this->headroom;
+}
+
+std::string JsonWriter::release() {
+    auto released = std::move(this->buffer);
+    this->buffer = std::string();
+    this->clear();
+    return released;
+}
+
+void JsonWriter::separate() {
+    if (this->needs_separator) {
+        this->buffer.push_back(',');
+    }
+    this->needs_separator = true;
+}
+
+void JsonWriter::start_object() {
+    this->separate();
+    this->buffer.push_back('{');
+    this->needs_separator = false;
+}
+
+void JsonWriter::end_object() {
+    this->buffer.push_back('}');
+    this->needs_separator = true;
+}
+
+void JsonWriter::start_array() {
+    this->separate();
+    this->buffer.push_back('[');
+    this->needs_separator = false;
+}
+
+void JsonWriter::end_array() {
+    this->buffer.push_back(']');
+    this->needs_separator = true;
+}
+
+void JsonWriter::key(std::string_view name) {
+    this->append_string(name);
+    this->buffer.push_back(':');
+    this->needs_separator = false;
+}
+
+void JsonWriter::null() {
+    this->separate();
+    this->buffer.append("null");
+}
+
+void JsonWriter::raw(std::string_view text) {
+    this->separate();
+    this->buffer.append(text);
+}
+
+void JsonWriter::append_string(std::string_view value) {
+    static constexpr char hex_digits[] = "0123456789abcdef";
+
+    this->separate();
+    this->buffer.push_back('"');
+    // escapes the same characters as json::dump()
+    for (size_t i = 0; i < value.size(); i++) {
+        const char c = value[i];
+        if (static_cast<unsigned char>(c) >= 0x80) {
+            auto length = utf8_sequence_length(value, i);
+            if (length == 0) {
+                // let the json serializer report the invalid UTF-8 exactly like json::dump() does
+                json(std::string(value)).dump();
+                length = 1;
+            }
+            this->buffer.append(value.substr(i, length));
+            i += length - 1;
+            continue;
+        }
+        switch (c) {
+        case '"':
+            this->buffer.append("\\\"");
+            break;
+        case '\\':
+            this->buffer.append("\\\\");
+            break;
+        case '\b':
+            this->buffer.append("\\b");
+            break;
+        case '\f':
+            this->buffer.append("\\f");
+            break;
+        case '\n':
+            this->buffer.append("\\n");
+            break;
+        case '\r':
+            this->buffer.append("\\r");
+            break;
+        case '\t':
+            this->buffer.append("\\t");
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                this->buffer.append("\\u00");
+                this->buffer.push_back(hex_digits[(c >> 4) & 0x0f]);
+                this->buffer.push_back(hex_digits[c & 0x0f]);
+            } else {
+                this->buffer.push_back(c);
+            }
+            break;
+        }
+    }
+    this->buffer.push_back('"');
+}
+
+void JsonWriter::append_integer(int64_t value) {
+    std::array<char, 24> digits;
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    this->separate();
+    this->buffer.append(digits.data(), result.ptr);
+}
+
+void JsonWriter::append_unsigned(uint64_t value) {
+    std::array<char, 24> digits;
+    const auto result = std::to_chars(digits.data(), digits.data() + digits.size(), value);
+    this->separate();
+    this->buffer.append(digits.data(), result.ptr);
+}
+
+void JsonWriter::append_floating_point(double value) {
+    if (!std::isfinite(value)) {
+        // json::dump() writes null for values that cannot be represented in json
+        this->null();
+        return;
+    }
+    // the shortest digits that read back to the same value, e.g. 1.2345e+02
+    std::array<char, 32> scientific;
+    const auto result =
+        std::to_chars(scientific.data(), scientific.data() + scientific.size(), value, std::chars_format::scientific);
+    const char* position = scientific.data();
+    const bool negative = *position == '-';
+    if (negative) {
+        position++;
+    }
+    std::array<char, 17> digits;
+    size_t digit_count = 0;
+    for (; *position != 'e'; position++) {
+        if (*position != '.') {
+            digits[digit_count++] = *position;
+        }
+    }
+    int exponent = 0;
+    std::from_chars(position + (position[1] == '+' ? 2 : 1), result.ptr, exponent);
+
+    this->separate();
+    // the same layout as json::dump(): fixed notation if the decimal point is at most 4 places in front of or 15
+    // places behind the first digit, with a ".0" for integral values to keep them floating point numbers
+    const int decimal_point = exponent + 1;
+    const int length = static_cast<int>(digit_count);
+    if (decimal_point <= -4 or decimal_point > 15) {
+        this->buffer.append(scientific.data(), result.ptr);
+        return;
+    }
+    if (negative) {
+        this->buffer.push_back('-');
+    }
+    if (decimal_point <= 0) {
+        this->buffer.append("0.");
+        this->buffer.append(-decimal_point, '0');
+        this->buffer.append(digits.data(), digit_count);
+    } else if (decimal_point >= length) {
+        this->buffer.append(digits.data(), digit_count);
+        this->buffer.append(decimal_point - length, '0');
+        this->buffer.append(".0");
+    } else {
+        this->buffer.append(digits.data(), decimal_point);
+        this->buffer.push_back('.');
+        this->buffer.append(digits.data() + decimal_point, length - decimal_point);
+    }
+}
+
+void JsonWriter::append_bool(bool value) {
+    this->separate();
+    this->buffer.append(value ? "true" : "false");
+}
+
+void write_json(JsonWriter& writer, const json& k) {
+    writer.raw(k.dump());
+}
+
+} // namespace ocpp
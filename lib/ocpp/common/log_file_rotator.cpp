@@ -0,0 +1,239 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/log_file_rotator.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include <date/date.h>
+#include <date/tz.h>
+#include <everest/logging.hpp>
+#include <zlib.h>
+
+namespace ocpp {
+
+namespace {
+
+constexpr auto COMPRESSED_EXTENSION = ".gz";
+constexpr size_t COMPRESSION_CHUNK_SIZE = 64 * 1024;
+
+std::string get_datetime_string() {
+    return date::format("%Y%m%d%H%M%S", std::chrono::time_point_cast<std::chrono::seconds>(date::utc_clock::now()));
+}
+
+std::filesystem::path with_compressed_extension(const std::filesystem::path& path) {
+    auto compressed = path;
+    compressed += COMPRESSED_EXTENSION;
+    return compressed;
+}
+
+} // namespace
+
+LogFileRotator::LogFileRotator(const std::filesystem::path& file, const LogRotationConfig& config) :
+    file(file), config(config), current_size(0), next_index(0), date_sequence(0) {
+    this->scan();
+}
+
+LogFileRotator::~LogFileRotator() {
+    for (auto& [path, compression] : this->compressions) {
+        compression.wait();
+    }
+}
+
+const std::filesystem::path& LogFileRotator::get_file() const {
+    return this->file;
+}
+
+void LogFileRotator::add_written(std::uintmax_t bytes) {
+    this->current_size += bytes;
+}
+
+bool LogFileRotator::rotation_needed() const {
+    return this->config.maximum_file_size_bytes > 0 and this->current_size >= this->config.maximum_file_size_bytes;
+}
+
+void LogFileRotator::rotate() {
+    EVLOG_info << "Logfile: " << this->file.filename().string() << " file size (" << this->current_size
+               << " bytes) >= (" << this->config.maximum_file_size_bytes << " bytes) rotating log.";
+
+    this->collect_compressions();
+
+    // The current file counts towards the maximum as well
+    const auto maximum_file_count = this->config.maximum_file_count;
+    while (maximum_file_count > 0 and not this->rotated_files.empty() and
+           this->rotated_files.size() + 1 >= maximum_file_count) {
+        this->remove_oldest();
+    }
+
+    std::error_code ec;
+    if (maximum_file_count == 1) {
+        EVLOG_info << "Removing log file: " << this->file.string();
+        std::filesystem::remove(this->file, ec);
+    } else {
+        const auto rotated_file = this->next_rotated_file();
+        EVLOG_info << "Renaming: " << this->file.string() << " -> " << rotated_file.string();
+        std::filesystem::rename(this->file, rotated_file, ec);
+        if (not ec) {
+            this->rotated_files.push_back(rotated_file);
+            if (this->config.compress) {
+                this->compressions.emplace_back(
+                    rotated_file, std::async(std::launch::async, &LogFileRotator::compress_file, rotated_file));
+            }
+        }
+    }
+
+    if (ec) {
+        EVLOG_warning << "Could not rotate logfile: " << this->file.string() << ": " << ec.message();
+    }
+    this->current_size = 0;
+}
+
+void LogFileRotator::scan() {
+    std::error_code ec;
+    this->current_size = std::filesystem::file_size(this->file, ec);
+    if (ec) {
+        this->current_size = 0;
+    }
+
+    const auto prefix = this->file.filename().string() + ".";
+    std::vector<std::pair<std::filesystem::file_time_type, std::filesystem::path>> files;
+    for (const auto& entry : std::filesystem::directory_iterator(this->file.parent_path(), ec)) {
+        const auto filename = entry.path().filename().string();
+        if (not entry.is_regular_file() or filename.rfind(prefix, 0) != 0) {
+            continue;
+        }
+
+        auto path = entry.path();
+        if (path.extension() == COMPRESSED_EXTENSION) {
+            path.replace_extension();
+        }
+
+        // The index of a rotated file is the part after the name of the file, e.g. 3 for ocpp.log.3 or ocpp.log.3.gz
+        const auto suffix = path.filename().string().substr(prefix.size());
+        if (not suffix.empty() and
+            std::all_of(suffix.begin(), suffix.end(), [](unsigned char c) { return std::isdigit(c) != 0; })) {
+            try {
+                this->next_index = std::max<uint64_t>(this->next_index, std::stoull(suffix) + 1);
+            } catch (...) {
+                EVLOG_warning << "Could not parse index of logfile: " << entry.path().string();
+            }
+        }
+
+        files.emplace_back(entry.last_write_time(ec), path);
+    }
+
+    // Sorted by age instead of by name, the name of a file does not tell its age for every suffix. A file that has
+    // been left uncompressed next to its compressed file is only listed once
+    std::sort(files.begin(), files.end());
+    std::set<std::filesystem::path> listed;
+    for (auto& [time, path] : files) {
+        if (listed.insert(path).second) {
+            this->rotated_files.push_back(std::move(path));
+        }
+    }
+}
+
+void LogFileRotator::remove_oldest() {
+    const auto oldest = this->rotated_files.front();
+    this->rotated_files.pop_front();
+
+    // Otherwise the compression would leave the compressed file behind
+    this->wait_for_compression(oldest);
+
+    EVLOG_info << "Removing oldest log file: " << oldest.string();
+    std::error_code ec;
+    std::filesystem::remove(oldest, ec);
+    std::filesystem::remove(with_compressed_extension(oldest), ec);
+}
+
+void LogFileRotator::collect_compressions() {
+    this->compressions.erase(std::remove_if(this->compressions.begin(), this->compressions.end(),
+                                            [](const auto& compression) {
+                                                return compression.second.wait_for(std::chrono::seconds(0)) ==
+                                                       std::future_status::ready;
+                                            }),
+                             this->compressions.end());
+}
+
+void LogFileRotator::wait_for_compression(const std::filesystem::path& path) {
+    for (auto& [compressed_path, compression] : this->compressions) {
+        if (compressed_path == path) {
+            compression.wait();
+        }
+    }
+}
+
+std::filesystem::path LogFileRotator::next_rotated_file() {
+    auto rotated_file = this->file;
+    if (not this->config.date_suffix) {
+        // The index increases with every rotation, so the existing rotated files keep their names
+        rotated_file += "." + std::to_string(this->next_index++);
+        return rotated_file;
+    }
+
+    // Several rotations within the same second get the same date, the later ones get an increasing sequence number so
+    // that they neither replace an earlier file nor reuse the name of a removed one
+    const auto date = get_datetime_string();
+    if (date != this->last_date) {
+        this->last_date = date;
+        this->date_sequence = 0;
+    }
+
+    const auto is_used = [this](const std::filesystem::path& path) {
+        std::error_code ec;
+        return std::find(this->rotated_files.begin(), this->rotated_files.end(), path) != this->rotated_files.end() or
+               std::filesystem::exists(path, ec) or std::filesystem::exists(with_compressed_extension(path), ec);
+    };
+
+    while (true) {
+        auto candidate = rotated_file;
+        candidate += "." + date;
+        if (this->date_sequence > 0) {
+            candidate += "-" + std::to_string(this->date_sequence);
+        }
+        this->date_sequence++;
+
+        if (not is_used(candidate)) {
+            return candidate;
+        }
+    }
+}
+
+void LogFileRotator::compress_file(const std::filesystem::path& path) {
+    const auto compressed_path = with_compressed_extension(path);
+    std::ifstream ifs(path, std::ifstream::binary);
+    gzFile gz = gzopen(compressed_path.c_str(), "wb");
+    if (not ifs.is_open() or gz == nullptr) {
+        EVLOG_warning << "Could not compress logfile: " << path.string();
+        if (gz != nullptr) {
+            gzclose(gz);
+        }
+        return;
+    }
+
+    std::vector<char> buffer(COMPRESSION_CHUNK_SIZE);
+    bool success = true;
+    while (success and ifs) {
+        ifs.read(buffer.data(), buffer.size());
+        const auto count = static_cast<int>(ifs.gcount());
+        if (count > 0) {
+            success = gzwrite(gz, buffer.data(), static_cast<unsigned int>(count)) == count;
+        }
+    }
+    success = gzclose(gz) == Z_OK and success and not ifs.bad();
+
+    std::error_code ec;
+    if (success) {
+        std::filesystem::remove(path, ec);
+    } else {
+        EVLOG_warning << "Could not compress logfile: " << path.string();
+        std::filesystem::remove(compressed_path, ec);
+    }
+}
+
+} // namespace ocpp
@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/message_correlation_index.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace ocpp {
+
+namespace {
+
+/// \returns the nearest rank \p percentile of the given sorted \p samples
+std::chrono::milliseconds percentile(const std::vector<std::chrono::milliseconds>& samples, double percentile) {
+    const auto rank = static_cast<size_t>(std::ceil(percentile / 100.0 * static_cast<double>(samples.size())));
+    return samples.at(std::max<size_t>(rank, 1) - 1);
+}
+
+} // namespace
+
+MessageCorrelationIndex::MessageCorrelationIndex(size_t maximum_entries, std::chrono::seconds maximum_age) :
+    maximum_entries(std::max<size_t>(maximum_entries, 1)), maximum_age(maximum_age) {
+}
+
+void MessageCorrelationIndex::add_call(const std::string& message_id, const std::string& action,
+                                       bool sent_by_charge_point, TimePoint timestamp) {
+    auto& calls_by_id = this->calls_by_id[sent_by_charge_point];
+    auto existing = calls_by_id.find(message_id);
+    if (existing != calls_by_id.end()) {
+        this->erase(existing->second);
+    }
+
+    this->calls.push_back({message_id, action, sent_by_charge_point, timestamp});
+    calls_by_id[message_id] = std::prev(this->calls.end());
+    this->expire(timestamp);
+}
+
+std::optional<std::string> MessageCorrelationIndex::take_call(const std::string& message_id, bool sent_by_charge_point,
+                                                              TimePoint timestamp) {
+    this->expire(timestamp);
+
+    const auto& calls_by_id = this->calls_by_id[not sent_by_charge_point];
+    auto it = calls_by_id.find(message_id);
+    if (it == calls_by_id.end()) {
+        return std::nullopt;
+    }
+
+    const auto call = it->second;
+    auto action = call->action;
+    if (call->sent_by_charge_point) {
+        // Replayed records can be out of order
+        const auto response_time = std::max(
+            std::chrono::duration_cast<std::chrono::milliseconds>(timestamp - call->timestamp),
+            std::chrono::milliseconds(0));
+        auto& response_times = this->response_times[action];
+        if (response_times.samples.size() < RESPONSE_TIME_SAMPLES) {
+            response_times.samples.push_back(response_time);
+        } else {
+            response_times.samples[response_times.next] = response_time;
+        }
+        response_times.next = (response_times.next + 1) % RESPONSE_TIME_SAMPLES;
+    }
+
+    this->erase(call);
+    return action;
+}
+
+size_t MessageCorrelationIndex::size() const {
+    return this->calls.size();
+}
+
+std::map<std::string, ResponseTimeStats> MessageCorrelationIndex::get_response_time_stats() const {
+    std::map<std::string, ResponseTimeStats> stats;
+    for (const auto& [action, response_times] : this->response_times) {
+        auto samples = response_times.samples;
+        std::sort(samples.begin(), samples.end());
+        stats[action] = {samples.size(), percentile(samples, 50), percentile(samples, 90), percentile(samples, 99),
+                         samples.back()};
+    }
+    return stats;
+}
+
+void MessageCorrelationIndex::expire(TimePoint now) {
+    while (not this->calls.empty() and (this->calls.size() > this->maximum_entries or
+                                        now - this->calls.front().timestamp > this->maximum_age)) {
+        this->erase(this->calls.begin());
+    }
+}
+
+void MessageCorrelationIndex::erase(std::list<PendingCall>::iterator it) {
+    this->calls_by_id[it->sent_by_charge_point].erase(it->message_id);
+    this->calls.erase(it);
+}
+
+} // namespace ocpp
@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright Pionix GmbH and Contributors to EVerest
 #include <algorithm>
+#include <sstream>
 
 #include <everest/logging.hpp>
 
@@ -17,7 +18,8 @@ namespace ocpp {
 MessageLogging::MessageLogging(
     bool log_messages, const std::string& message_log_path, const std::string& output_file_name, bool log_to_console,
     bool detailed_log_to_console, bool log_to_file, bool log_to_html, bool log_security, bool session_logging,
-    std::function<void(const std::string& message, MessageDirection direction)> message_callback) :
+    std::function<void(const std::string& message, MessageDirection direction)> message_callback,
+    LogQueueConfig log_queue_config, bool log_to_binary) :
     log_messages(log_messages),
     message_log_path(message_log_path),
     output_file_name(output_file_name),
@@ -25,21 +27,23 @@ MessageLogging::MessageLogging(
     detailed_log_to_console(detailed_log_to_console),
     log_to_file(log_to_file),
     log_to_html(log_to_html),
+    log_to_binary(log_to_binary),
     log_security(log_security),
     session_logging(session_logging),
     message_callback(message_callback),
-    rotate_logs(false),
-    date_suffix(false),
-    maximum_file_size_bytes(0),
-    maximum_file_count(0) {
-    this->initialize();
+    queue_full_policy(log_queue_config.full_policy),
+    writer_running(false),
+    writer_waiting(false),
+    blocked_producers(0),
+    dropped_messages(0) {
+    this->initialize(log_queue_config.capacity);
 }
 
 MessageLogging::MessageLogging(
     bool log_messages, const std::string& message_log_path, const std::string& output_file_name, bool log_to_console,
     bool detailed_log_to_console, bool log_to_file, bool log_to_html, bool log_security, bool session_logging,
     std::function<void(const std::string& message, MessageDirection direction)> message_callback,
-    LogRotationConfig log_rotation_config) :
+    LogRotationConfig log_rotation_config, LogQueueConfig log_queue_config, bool log_to_binary) :
     log_messages(log_messages),
     message_log_path(message_log_path),
     output_file_name(output_file_name),
@@ -47,19 +51,26 @@ MessageLogging::MessageLogging(
     detailed_log_to_console(detailed_log_to_console),
     log_to_file(log_to_file),
     log_to_html(log_to_html),
+    log_to_binary(log_to_binary),
     log_security(log_security),
     session_logging(session_logging),
     message_callback(message_callback),
-    rotate_logs(true),
-    date_suffix(log_rotation_config.date_suffix),
-    maximum_file_size_bytes(log_rotation_config.maximum_file_size_bytes),
-    maximum_file_count(log_rotation_config.maximum_file_count) {
-    this->initialize();
+    log_rotation_config(log_rotation_config),
+    queue_full_policy(log_queue_config.full_policy),
+    writer_running(false),
+    writer_waiting(false),
+    blocked_producers(0),
+    dropped_messages(0) {
+    this->initialize(log_queue_config.capacity);
 }
 
-void MessageLogging::initialize() {
+void MessageLogging::initialize(size_t queue_capacity) {
+    if (queue_capacity > 0 and (this->log_messages or this->session_logging)) {
+        this->queue = std::make_unique<MpscRingBuffer<LogRecord>>(queue_capacity);
+    }
+
     if (this->log_messages) {
-        if (this->rotate_logs) {
+        if (this->log_rotation_config.has_value()) {
             EVLOG_info << "Log rotation enabled";
         }
         if (this->log_to_console) {
@@ -75,7 +86,8 @@ void MessageLogging::initialize() {
             EVLOG_info << "Logging OCPP messages to log file: " << output_file_path;
             this->log_file = std::filesystem::path(output_file_path);
             this->log_os.open(output_file_path, std::ofstream::app);
-            this->rotate_log_if_needed(this->log_file, this->log_os);
+            this->log_rotator = this->make_rotator(this->log_file);
+            this->rotate_log_if_needed(this->log_rotator, this->log_os);
         }
 
         if (this->log_to_html) {
@@ -85,8 +97,9 @@ void MessageLogging::initialize() {
             EVLOG_info << "Logging OCPP messages to html file: " << html_file_path;
             this->html_log_file = std::filesystem::path(html_file_path);
             this->html_log_os.open(html_log_file, std::ofstream::app);
+            this->html_log_rotator = this->make_rotator(this->html_log_file);
             this->rotate_log_if_needed(
-                this->html_log_file, this->html_log_os, [this](std::ofstream& os) { this->close_html_tags(os); },
+                this->html_log_rotator, this->html_log_os, [this](std::ofstream& os) { this->close_html_tags(os); },
                 [this](std::ofstream& os) { this->open_html_tags(os); });
 
             if (this->file_size(this->html_log_file) > 0) {
@@ -95,6 +108,21 @@ void MessageLogging::initialize() {
                 this->open_html_tags(this->html_log_os);
             }
         }
+        if (this->log_to_binary) {
+            auto binary_file_path = message_log_path + "/";
+            binary_file_path += output_file_name;
+            binary_file_path += ".binlog";
+            EVLOG_info << "Logging OCPP messages to binary file: " << binary_file_path;
+            this->binary_log_file = std::filesystem::path(binary_file_path);
+            this->binary_log_os.open(binary_log_file, std::ofstream::app | std::ofstream::binary);
+            this->binary_log_rotator = this->make_rotator(this->binary_log_file);
+            if (this->file_size(this->binary_log_file) == 0) {
+                write_binary_log_header(this->binary_log_os);
+            } else {
+                this->rotate_log_if_needed(this->binary_log_rotator, this->binary_log_os, nullptr,
+                                           [](std::ofstream& os) { write_binary_log_header(os); });
+            }
+        }
         if (this->log_security) {
             auto security_file_path = message_log_path + "/";
             security_file_path += output_file_name;
@@ -102,8 +130,17 @@ void MessageLogging::initialize() {
             EVLOG_info << "Logging SecurityEvents to file: " << security_file_path;
             this->security_log_file = std::filesystem::path(security_file_path);
             this->security_log_os.open(security_log_file, std::ofstream::app);
-            this->rotate_log_if_needed(this->security_log_file, this->security_log_os);
+            this->security_log_rotator = this->make_rotator(this->security_log_file);
+            this->rotate_log_if_needed(this->security_log_rotator, this->security_log_os);
         }
+    }
+
+    if (this->queue != nullptr) {
+        this->writer_running = true;
+        this->writer_thread = std::thread(&MessageLogging::run_writer, this);
+    }
+
+    if (this->log_messages) {
         sys("Session logging started.");
     }
 }
@@ -142,10 +179,6 @@ void MessageLogging::close_html_tags(std::ofstream& os) {
     os.flush();
 }
 
-std::string MessageLogging::get_datetime_string() {
-    return date::format("%Y%m%d%H%M%S", std::chrono::time_point_cast<std::chrono::seconds>(date::utc_clock::now()));
-}
-
 std::uintmax_t MessageLogging::file_size(const std::filesystem::path& path) {
     try {
         return std::filesystem::file_size(path);
@@ -154,98 +187,55 @@ std::uintmax_t MessageLogging::file_size(const std::filesystem::path& path) {
     }
 }
 
-void MessageLogging::rotate_log(const std::string& file_basename) {
-    auto path = std::filesystem::path(this->message_log_path);
-    std::vector<std::filesystem::path> files;
-    for (const auto& entry : std::filesystem::directory_iterator(path)) {
-        const auto& file_path = entry.path();
-        if (std::filesystem::is_regular_file(entry)) {
-            // check file
-            if (file_path.filename() == file_basename or file_path.stem() == file_basename) {
-                files.push_back(file_path);
-            }
-        }
+std::unique_ptr<LogFileRotator> MessageLogging::make_rotator(const std::filesystem::path& path) {
+    if (not this->log_rotation_config.has_value() or this->log_rotation_config->maximum_file_size_bytes == 0) {
+        // do nothing if log rotation is turned off or no maximum file size is set
+        return nullptr;
     }
-    std::sort(files.begin(), files.end(), std::greater<std::filesystem::path>());
-
-    if (this->maximum_file_count > 0 and files.size() >= this->maximum_file_count) {
-        // drop the oldest file
-        EVLOG_info << "Removing oldest log file: " << files.front();
-        std::filesystem::remove(files.front());
-        files.erase(files.begin());
-    }
-
-    // rename the oldest file first
-    for (auto& file : files) {
-        if (file.filename() == file_basename) {
-            std::filesystem::path new_file_name;
-            if (this->date_suffix) {
-                new_file_name = std::filesystem::path(file.string() + "." + this->get_datetime_string());
-            } else {
-                // traditional .0 .1 ... suffix
-                // does not have a .0 or .1, so needs a new one
-                new_file_name = std::filesystem::path(file.string() + ".0");
-            }
-
-            std::filesystem::rename(file, new_file_name);
-            EVLOG_info << "Renaming: " << file.string() << " -> " << new_file_name.string();
-        } else {
-            // try parsing the .x extension and log an error if this was not possible
-            try {
-                if (not this->date_suffix) {
-                    auto extension_str = file.extension().string();
-                    boost::replace_all(extension_str, ".", ""); // .extension() comes with the "."
-                    auto extension = std::stoi(extension_str);
-                    extension += 1;
-                    auto new_extension = std::to_string(extension);
-
-                    std::filesystem::path new_file_name = file;
-                    new_file_name.replace_extension(new_extension);
-                    EVLOG_info << "Renaming: " << file.string() << " -> " << new_file_name.string();
-                    std::filesystem::rename(file, new_file_name);
-                }
+    return std::make_unique<LogFileRotator>(path, this->log_rotation_config.value());
+}
 
-            } catch (...) {
-                EVLOG_warning << "Could not rename logfile: " << file.string();
-            }
-        }
+void MessageLogging::add_written(const std::unique_ptr<LogFileRotator>& rotator, std::uintmax_t bytes) {
+    if (rotator != nullptr) {
+        rotator->add_written(bytes);
     }
 }
 
-void MessageLogging::rotate_log_if_needed(const std::filesystem::path& path, std::ofstream& os) {
-    rotate_log_if_needed(path, os, nullptr, nullptr);
+void MessageLogging::rotate_log_if_needed(const std::unique_ptr<LogFileRotator>& rotator, std::ofstream& os) {
+    rotate_log_if_needed(rotator, os, nullptr, nullptr);
 }
 
-void MessageLogging::rotate_log_if_needed(const std::filesystem::path& path, std::ofstream& os,
+void MessageLogging::rotate_log_if_needed(const std::unique_ptr<LogFileRotator>& rotator, std::ofstream& os,
                                           std::function<void(std::ofstream& os)> before_close_of_os,
                                           std::function<void(std::ofstream& os)> after_open_of_os) {
-    if (not this->rotate_logs) {
-        // do nothing if log rotation is turned off
+    // The size of the file is tracked by the rotator, checking it does not touch the file system
+    if (rotator == nullptr or not rotator->rotation_needed()) {
         return;
     }
-    if (maximum_file_size_bytes <= 0) {
-        // do nothing if no maximum file size is set
-        return;
+
+    if (before_close_of_os != nullptr) {
+        before_close_of_os(os);
     }
-    auto log_file_size = this->file_size(path);
-    if (log_file_size >= maximum_file_size_bytes) {
-        EVLOG_info << "Logfile: " << path.filename().string() << " file size (" << log_file_size << " bytes) >= ("
-                   << maximum_file_size_bytes << " bytes) rotating log.";
-        if (before_close_of_os != nullptr) {
-            before_close_of_os(os);
-        }
-        os.close();
-        os.clear();
-        rotate_log(path.filename().string());
-        os.open(path.string(), std::ofstream::app);
-        if (after_open_of_os != nullptr) {
-            after_open_of_os(os);
-        }
+    os.close();
+    os.clear();
+    rotator->rotate();
+    os.open(rotator->get_file().string(), std::ofstream::app | std::ofstream::binary);
+    if (after_open_of_os != nullptr) {
+        after_open_of_os(os);
     }
 }
 
 MessageLogging::~MessageLogging() {
+    if (this->writer_thread.joinable()) {
+        // The writer thread writes the remaining records before it exits
+        this->writer_running = false;
+        this->wake_writer();
+        this->writer_thread.join();
+    }
+
     if (this->log_messages) {
+        this->log_response_time_stats();
+
         if (this->log_to_file) {
             this->log_os.close();
         }
@@ -255,76 +245,290 @@ MessageLogging::~MessageLogging() {
             this->html_log_os.close();
         }
 
+        if (this->log_to_binary) {
+            this->binary_log_os.close();
+        }
+
         if (this->log_security) {
             this->security_log_os.close();
         }
     }
 }
 
-void MessageLogging::charge_point(const std::string& message_type, const std::string& json_str) {
+void MessageLogging::charge_point(std::string_view message_type, std::string_view json_str) {
+    LogRecord record{0, std::string(message_type), std::string(json_str), date::utc_clock::now(), nullptr};
     if (this->message_callback != nullptr) {
-        this->message_callback(json_str, MessageDirection::ChargingStationToCSMS);
+        this->message_callback(record.json_str, MessageDirection::ChargingStationToCSMS);
     }
-    auto formatted = format_message(message_type, json_str);
-    log_output(0, formatted.message_type, formatted.message);
-    if (this->session_logging) {
-        std::scoped_lock lock(this->session_id_logging_mutex);
-        for (auto const& [session_id, logging] : this->session_id_logging) {
-            logging->charge_point(message_type, json_str);
+    this->enqueue(std::move(record));
+}
+
+void MessageLogging::central_system(std::string_view message_type, std::string_view json_str) {
+    LogRecord record{1, std::string(message_type), std::string(json_str), date::utc_clock::now(), nullptr};
+    if (this->message_callback != nullptr) {
+        this->message_callback(record.json_str, MessageDirection::CSMSToChargingStation);
+    }
+    this->enqueue(std::move(record));
+}
+
+void MessageLogging::sys(const std::string& msg) {
+    this->enqueue({2, msg, "", date::utc_clock::now(), nullptr});
+}
+
+void MessageLogging::security(const std::string& msg) {
+    this->enqueue({3, msg, "", date::utc_clock::now(), nullptr});
+}
+
+void MessageLogging::replay(const BinaryLogRecord& record) {
+    LogRecord replayed{record.typ, record.message_type, record.message, record.timestamp, nullptr};
+    // A binary log has no steady time, the response times of a replayed log are taken from its UTC timestamps
+    replayed.steady_timestamp = std::chrono::steady_clock::time_point(
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(record.timestamp.time_since_epoch()));
+    this->enqueue(std::move(replayed));
+}
+
+void MessageLogging::flush() {
+    if (this->queue == nullptr) {
+        return;
+    }
+
+    LogRecord marker;
+    marker.flushed = std::make_shared<std::promise<void>>();
+    auto flushed = marker.flushed->get_future();
+    this->push(marker, true);
+    flushed.wait();
+}
+
+void MessageLogging::enqueue(LogRecord record) {
+    if (not this->log_messages and not this->session_logging) {
+        return;
+    }
+
+    if (this->queue == nullptr) {
+        std::lock_guard<std::mutex> lock(this->output_file_mutex);
+        this->write_record(record);
+        this->flush_output();
+        return;
+    }
+
+    // Security events are not dropped
+    const bool block = this->queue_full_policy == LogQueueFullPolicy::Block or record.typ == 3;
+    if (not this->push(record, block)) {
+        this->dropped_messages++;
+    }
+}
+
+bool MessageLogging::push(LogRecord& record, bool block) {
+    if (this->queue->try_push(record)) {
+        this->wake_writer();
+        return true;
+    }
+
+    if (not block) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(this->queue_space_mutex);
+    this->blocked_producers++;
+    // Pairs with the fence of the writer after it has made room, either it sees us blocked or we see the room
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (not this->queue->try_push(record)) {
+        this->wake_writer();
+        this->queue_space_cv.wait(lock);
+    }
+    this->blocked_producers--;
+    lock.unlock();
+
+    this->wake_writer();
+    return true;
+}
+
+void MessageLogging::wake_writer() {
+    // Pairs with the fence of the writer before it waits: either the writer sees the pushed record when it checks the
+    // queue, or we see that it waits. The lock is only taken then, so a busy writer costs the producers no lock
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (this->writer_waiting) {
+        std::lock_guard<std::mutex> lock(this->writer_mutex);
+        this->writer_cv.notify_one();
+    }
+}
+
+void MessageLogging::run_writer() {
+    std::vector<LogRecord> batch;
+    batch.reserve(WRITE_BATCH_SIZE);
+
+    while (true) {
+        LogRecord record;
+        while (batch.size() < WRITE_BATCH_SIZE and this->queue->try_pop(record)) {
+            batch.push_back(std::move(record));
+        }
+
+        // Dropped messages are reported even if nothing else is left to write
+        if (batch.empty() and this->dropped_messages == 0) {
+            if (not this->writer_running) {
+                break;
+            }
+
+            std::unique_lock<std::mutex> lock(this->writer_mutex);
+            this->writer_waiting = true;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            this->writer_cv.wait(lock, [this]() { return not this->queue->empty() or not this->writer_running; });
+            this->writer_waiting = false;
+            continue;
+        }
+
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (this->blocked_producers > 0) {
+            // The batch has made room in the queue
+            std::lock_guard<std::mutex> lock(this->queue_space_mutex);
+            this->queue_space_cv.notify_all();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(this->output_file_mutex);
+
+            const auto dropped = this->dropped_messages.exchange(0);
+            if (dropped > 0) {
+                this->write_record({2,
+                                    "Dropped " + std::to_string(dropped) + " messages, the message log queue was full",
+                                    "", date::utc_clock::now(), nullptr});
+            }
+
+            for (const auto& queued_record : batch) {
+                if (queued_record.flushed == nullptr) {
+                    this->write_record(queued_record);
+                }
+            }
+            this->flush_output();
+        }
+
+        for (auto& queued_record : batch) {
+            if (queued_record.flushed != nullptr) {
+                queued_record.flushed->set_value();
+            }
         }
+        batch.clear();
     }
 }
 
-void MessageLogging::central_system(const std::string& message_type, const std::string& json_str) {
-    if (this->message_callback != nullptr) {
-        this->message_callback(json_str, MessageDirection::CSMSToChargingStation);
+void MessageLogging::write_record(const LogRecord& record) {
+    if (record.typ == 3) {
+        if (this->log_security) {
+            this->rotate_log_if_needed(this->security_log_rotator, this->security_log_os);
+            this->security_log_os << record.message_type << "\n";
+            add_written(this->security_log_rotator, record.message_type.size() + 1);
+        }
+        return;
+    }
+
+    if (this->log_to_binary) {
+        this->log_binary(record);
     }
-    auto formatted = format_message(message_type, json_str);
-    log_output(1, formatted.message_type, formatted.message);
+
+    std::unique_lock<std::recursive_mutex> session_lock(this->session_id_logging_mutex, std::defer_lock);
     if (this->session_logging) {
-        std::scoped_lock lock(this->session_id_logging_mutex);
+        session_lock.lock();
+    }
+
+    const bool text_output = this->log_messages and (this->log_to_console or this->detailed_log_to_console or
+                                                     this->log_to_file or this->log_to_html);
+    const bool session_output = this->session_logging and not this->session_id_logging.empty();
+    if (not text_output and not session_output) {
+        // Parsing and pretty printing is the expensive part of logging, it is skipped if only the binary log is
+        // written. The responses are still correlated with their CALLs for the response time statistics
+        if (record.typ == 0 or record.typ == 1) {
+            this->correlate_header(record);
+        }
+        return;
+    }
+
+    // The message is parsed, pretty printed and html encoded once for this log and all session logs. Session logs
+    // only write html
+    FormattedRecord formatted;
+    formatted.typ = record.typ;
+    if (record.typ == 0) {
+        formatted.origin = "ChargePoint";
+        formatted.target = "CentralSystem";
+    } else if (record.typ == 1) {
+        formatted.origin = "CentralSystem";
+        formatted.target = "ChargePoint";
+    } else {
+        formatted.origin = "SYS";
+    }
+    formatted.timestamp = DateTime(record.timestamp).to_rfc3339();
+    if (record.typ == 2) {
+        formatted.message_type = record.message_type;
+    } else {
+        auto formatted_message = format_message(record);
+        formatted.message_type = std::move(formatted_message.message_type);
+        formatted.message = std::move(formatted_message.message);
+    }
+    if ((text_output and this->log_to_html) or session_output) {
+        formatted.html_entry = this->format_html_entry(formatted);
+    }
+
+    if (text_output) {
+        this->log_output(formatted);
+    }
+
+    if (session_output) {
         for (auto const& [session_id, logging] : this->session_id_logging) {
-            logging->central_system(message_type, json_str);
+            std::lock_guard<std::mutex> lock(logging->output_file_mutex);
+            logging->log_output(formatted);
         }
     }
 }
 
-void MessageLogging::sys(const std::string& msg) {
-    log_output(2, msg, "");
+void MessageLogging::flush_output() {
+    if (this->log_to_file) {
+        this->log_os.flush();
+    }
+    if (this->log_to_html) {
+        this->html_log_os.flush();
+    }
+    if (this->log_to_binary) {
+        this->binary_log_os.flush();
+    }
+    if (this->log_security) {
+        this->security_log_os.flush();
+    }
+
     if (this->session_logging) {
         std::scoped_lock lock(this->session_id_logging_mutex);
         for (auto const& [session_id, logging] : this->session_id_logging) {
-            log_output(2, msg, "");
+            std::lock_guard<std::mutex> session_lock(logging->output_file_mutex);
+            logging->flush_output();
         }
     }
 }
 
-void MessageLogging::security(const std::string& msg) {
-    std::lock_guard<std::mutex> lock(this->output_file_mutex);
-    this->rotate_log_if_needed(this->security_log_file, this->security_log_os);
-    this->security_log_os << msg << "\n";
-    this->security_log_os.flush();
-}
-
-void MessageLogging::log_output(unsigned int typ, const std::string& message_type, const std::string& json_str) {
-    if (this->log_messages) {
-        std::lock_guard<std::mutex> lock(this->output_file_mutex);
+void MessageLogging::log_binary(const LogRecord& record) {
+    if (not this->log_messages) {
+        return;
+    }
 
-        std::string ts = DateTime().to_rfc3339();
+    // every rotated file starts with its own header so that it can be converted on its own
+    this->rotate_log_if_needed(this->binary_log_rotator, this->binary_log_os, nullptr,
+                               [](std::ofstream& os) { write_binary_log_header(os); });
+    const auto written = write_binary_log_record(
+        this->binary_log_os,
+        {record.timestamp, static_cast<std::uint8_t>(record.typ), record.message_type, record.json_str});
+    add_written(this->binary_log_rotator, written);
+}
 
-        std::string origin, target;
+void MessageLogging::log_output(const FormattedRecord& record) {
+    const auto typ = record.typ;
+    const auto& message_type = record.message_type;
+    const auto& json_str = record.message;
 
+    if (this->log_messages) {
         if (typ == 0) {
-            origin = "ChargePoint";
-            target = "CentralSystem";
             if (this->detailed_log_to_console) {
                 EVLOG_info << "\033[1;35mChargePoint: " << json_str << "\033[1;0m";
             } else if (this->log_to_console) {
                 EVLOG_info << "\033[1;35mChargePoint: " << message_type << "\033[1;0m";
             }
         } else if (typ == 1) {
-            origin = "CentralSystem";
-            target = "ChargePoint";
             if (this->detailed_log_to_console) {
                 EVLOG_info << "\033[1;36mCentralSystem: " << json_str << "\033[1;0m";
             } else if (this->log_to_console) {
@@ -332,35 +536,38 @@ void MessageLogging::log_output(unsigned int typ, const std::string& message_typ
                            << "\033[1;0m";
             }
         } else {
-            origin = "SYS";
-            target = "";
             if (this->detailed_log_to_console || this->log_to_console) {
                 EVLOG_info << "\033[1;32mSYS:  " << message_type << "\033[1;0m";
             }
         }
 
         if (this->log_to_file) {
-            this->rotate_log_if_needed(this->log_file, this->log_os);
-            this->log_os << ts << ": " << origin + ">" + target << " " << (typ == 0 || typ == 2 ? message_type : "")
-                         << " " << (typ == 1 ? message_type : "") << "\n"
-                         << json_str << "\n\n";
-            this->log_os.flush();
+            this->rotate_log_if_needed(this->log_rotator, this->log_os);
+            const auto entry = record.timestamp + ": " + record.origin + ">" + record.target + " " +
+                               (typ == 0 || typ == 2 ? message_type : "") + " " + (typ == 1 ? message_type : "") +
+                               "\n" + json_str + "\n\n";
+            this->log_os << entry;
+            add_written(this->log_rotator, entry.size());
         }
         if (this->log_to_html) {
             this->rotate_log_if_needed(
-                this->html_log_file, this->html_log_os, [this](std::ofstream& os) { this->close_html_tags(os); },
+                this->html_log_rotator, this->html_log_os, [this](std::ofstream& os) { this->close_html_tags(os); },
                 [this](std::ofstream& os) { this->open_html_tags(os); });
 
-            this->html_log_os << "<tr class=\"" << origin << "\"> <td>" << ts << "</td> <td>"
-                              << origin + "&gt;" + target << "</td> <td><b>"
-                              << (typ == 0 || typ == 2 ? message_type : "") << "</b></td><td><b>"
-                              << (typ == 1 ? message_type : "") << "</b></td> <td><pre lang=\"json\">"
-                              << html_encode(json_str) << "</pre></td> </tr>\n";
-            this->html_log_os.flush();
+            this->html_log_os << record.html_entry;
+            add_written(this->html_log_rotator, record.html_entry.size());
         }
     }
 }
 
+std::string MessageLogging::format_html_entry(const FormattedRecord& record) {
+    const auto typ = record.typ;
+    return "<tr class=\"" + record.origin + "\"> <td>" + record.timestamp + "</td> <td>" + record.origin + "&gt;" +
+           record.target + "</td> <td><b>" + (typ == 0 || typ == 2 ? record.message_type : "") + "</b></td><td><b>" +
+           (typ == 1 ? record.message_type : "") + "</b></td> <td><pre lang=\"json\">" + html_encode(record.message) +
+           "</pre></td> </tr>\n";
+}
+
 std::string MessageLogging::html_encode(const std::string& msg) {
     std::string out = msg;
     boost::replace_all(out, "<", "&lt;");
@@ -368,34 +575,66 @@ std::string MessageLogging::html_encode(const std::string& msg) {
     return out;
 }
 
-FormattedMessageWithType MessageLogging::format_message(const std::string& message_type, const std::string& json_str) {
-    auto extracted_message_type = message_type;
-    auto formatted_message = json_str;
+FormattedMessageWithType MessageLogging::format_message(const LogRecord& record) {
+    auto extracted_message_type = record.message_type;
+    auto formatted_message = record.json_str;
 
     try {
-        auto json_object = json::parse(json_str);
-        if (json_object.at(MESSAGE_TYPE_ID) == MessageTypeId::CALL) {
-            extracted_message_type = json_object.at(CALL_ACTION);
-            this->lookup_map[json_object.at(MESSAGE_ID)] = extracted_message_type + "Response";
-        } else if (json_object.at(MESSAGE_TYPE_ID) == MessageTypeId::CALLRESULT) {
-            extracted_message_type = this->lookup_map[json_object.at(MESSAGE_ID)];
-            this->lookup_map[json_object.at(MESSAGE_ID)].erase();
+        auto json_object = json::parse(record.json_str);
+        if (auto message_type = this->correlate_message(json_object, record)) {
+            extracted_message_type = std::move(message_type.value());
         }
         formatted_message = json_object.dump(2);
     } catch (const std::exception& e) {
-        EVLOG_warning << "Error parsing OCPP message " << message_type << ": " << e.what();
+        EVLOG_warning << "Error parsing OCPP message " << record.message_type << ": " << e.what();
     }
 
     return {extracted_message_type, formatted_message};
 }
 
+void MessageLogging::correlate_header(const LogRecord& record) {
+    try {
+        // The payload is skipped by the parser without being built, only the header of the message is kept
+        const auto header =
+            json::parse(record.json_str, [](int depth, json::parse_event_t event, json& /*parsed*/) {
+                return not(depth > 0 and
+                           (event == json::parse_event_t::object_start or event == json::parse_event_t::array_start));
+            });
+        this->correlate_message(header, record);
+    } catch (const std::exception& e) {
+        EVLOG_warning << "Error parsing OCPP message " << record.message_type << ": " << e.what();
+    }
+}
+
+std::optional<std::string> MessageLogging::correlate_message(const json& json_object, const LogRecord& record) {
+    const auto& message_type_id = json_object.at(MESSAGE_TYPE_ID);
+    if (message_type_id == MessageTypeId::CALL) {
+        const std::string action = json_object.at(CALL_ACTION);
+        this->correlation_index.add_call(json_object.at(MESSAGE_ID), action, record.typ == 0,
+                                         record.steady_timestamp);
+        return action;
+    }
+
+    if (message_type_id == MessageTypeId::CALLRESULT or message_type_id == MessageTypeId::CALLERROR) {
+        const auto action =
+            this->correlation_index.take_call(json_object.at(MESSAGE_ID), record.typ == 0, record.steady_timestamp);
+        if (action.has_value() and message_type_id == MessageTypeId::CALLRESULT) {
+            return action.value() + "Response";
+        }
+    }
+    return std::nullopt;
+}
+
 void MessageLogging::start_session_logging(const std::string& session_id, const std::string& log_path) {
     std::scoped_lock lock(this->session_id_logging_mutex);
     this->session_id_logging[session_id] = std::make_shared<ocpp::MessageLogging>(
-        true, log_path, "incomplete-ocpp", false, false, false, true, false, false, nullptr);
+        true, log_path, "incomplete-ocpp", false, false, false, true, false, false, nullptr, LogQueueConfig(0));
 }
 
 void MessageLogging::stop_session_logging(const std::string& session_id) {
+    // The messages that are still queued belong to the session as well
+    this->flush();
+
     std::scoped_lock lock(this->session_id_logging_mutex);
     if (this->session_id_logging.count(session_id)) {
         auto old_file_path =
@@ -406,6 +645,23 @@ void MessageLogging::stop_session_logging(const std::string& session_id) {
     }
 }
 
+void MessageLogging::log_response_time_stats() {
+    std::lock_guard<std::mutex> lock(this->output_file_mutex);
+    for (const auto& [action, stats] : this->correlation_index.get_response_time_stats()) {
+        std::stringstream msg;
+        msg << "Response times of the CSMS for " << action << ": " << stats.count << " responses, p50 "
+            << stats.p50.count() << " ms, p90 " << stats.p90.count() << " ms, p99 " << stats.p99.count() << " ms, max "
+            << stats.max.count() << " ms";
+        this->write_record({2, msg.str(), "", date::utc_clock::now(), nullptr});
+    }
+    this->flush_output();
+}
+
+std::map<std::string, ResponseTimeStats> MessageLogging::get_response_time_stats() {
+    std::lock_guard<std::mutex> lock(this->output_file_mutex);
+    return this->correlation_index.get_response_time_stats();
+}
+
 std::string MessageLogging::get_message_log_path() {
     return this->message_log_path;
 }
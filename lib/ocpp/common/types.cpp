@@ -111,6 +111,16 @@ void from_json(const json& j, CallError& c) {
     c.errorDetails = j.at(CALLERROR_ERROR_DETAILS);
 }
 
+void write_json(JsonWriter& writer, const CallError& c) {
+    writer.start_array();
+    writer.value(static_cast<int>(MessageTypeId::CALLERROR));
+    writer.value(c.uniqueId);
+    writer.value(c.errorCode);
+    writer.value(c.errorDescription);
+    writer.value(c.errorDetails);
+    writer.end_array();
+}
+
 std::ostream& operator<<(std::ostream& os, const CallError& c) {
     os << json(c).dump(4);
     return os;
@@ -563,7 +573,8 @@ void from_json(const json& j, DisplayMessageContent& m) {
     }
 
     if (j.contains("format")) {
-        m.message_format = v201::conversions::string_to_message_format_enum(j.at("format"));
+        m.message_format =
+            v201::conversions::string_to_message_format_enum(j.at("format").get_ref<const std::string&>());
     }
 
     if (j.contains("language")) {
@@ -971,7 +982,8 @@ void to_json(json& j, const CertificateHashDataType& k) {
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k) {
     // the required parts of the message
-    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum_type(j.at("hashAlgorithm"));
+    k.hashAlgorithm =
+        conversions::string_to_hash_algorithm_enum_type(j.at("hashAlgorithm").get_ref<const std::string&>());
     k.issuerNameHash = j.at("issuerNameHash");
     k.issuerKeyHash = j.at("issuerKeyHash");
     k.serialNumber = j.at("serialNumber");
@@ -1006,7 +1018,7 @@ void to_json(json& j, const CertificateHashDataChain& k) {
 void from_json(const json& j, CertificateHashDataChain& k) {
     // the required parts of the message
     k.certificateHashData = j.at("certificateHashData");
-    k.certificateType = conversions::string_to_certificate_type(j.at("certificateType"));
+    k.certificateType = conversions::string_to_certificate_type(j.at("certificateType").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("childCertificateHashData")) {
@@ -0,0 +1,342 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/websocket/tls_session_cache.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <everest/logging.hpp>
+
+#include <openssl/ssl.h>
+
+namespace ocpp {
+
+namespace {
+
+/// \brief The cache and the key a client context has been attached to, owned by the context
+struct Attachment {
+    std::shared_ptr<TlsSessionCache> cache;
+    std::string key;
+};
+
+void free_attachment(void* /*parent*/, void* ptr, CRYPTO_EX_DATA* /*ad*/, int /*idx*/, long /*argl*/,
+                     void* /*argp*/) {
+    delete static_cast<Attachment*>(ptr);
+}
+
+int attachment_index() {
+    static const int index = SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, free_attachment);
+    return index;
+}
+
+Attachment* get_attachment(const SSL* ssl) {
+    return static_cast<Attachment*>(SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), attachment_index()));
+}
+
+/// \brief Called by OpenSSL with every new session of a connection, for TLS 1.3 with every received ticket
+int new_session_callback(SSL* ssl, SSL_SESSION* session) {
+    if (Attachment* attachment = get_attachment(ssl)) {
+        attachment->cache->store(attachment->key, session);
+    }
+
+    // The session has been serialized, OpenSSL keeps its reference
+    return 0;
+}
+
+/// \brief Hands the cached session to a connection when its handshake starts, before the ClientHello is built.
+/// libwebsockets creates the SSL object of a connection itself, so this is the first point where it can be set
+void info_callback(const SSL* ssl, int where, int /*ret*/) {
+    if ((where & SSL_CB_HANDSHAKE_START) == 0 or SSL_get_session(ssl) != nullptr) {
+        return;
+    }
+
+    Attachment* attachment = get_attachment(ssl);
+    if (attachment == nullptr) {
+        return;
+    }
+
+    if (SSL_SESSION* session = attachment->cache->take(attachment->key)) {
+        SSL_set_session(const_cast<SSL*>(ssl), session);
+        SSL_SESSION_free(session);
+    }
+}
+
+bool is_expired(const SSL_SESSION* session) {
+    return SSL_SESSION_get_time(session) + SSL_SESSION_get_timeout(session) <= std::time(nullptr);
+}
+
+SSL_SESSION* deserialize(const std::vector<unsigned char>& der) {
+    const unsigned char* data = der.data();
+    return d2i_SSL_SESSION(nullptr, &data, static_cast<long>(der.size()));
+}
+
+std::string to_hex(const std::vector<unsigned char>& data) {
+    static constexpr char digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(data.size() * 2);
+    for (const auto byte : data) {
+        hex.push_back(digits[byte >> 4]);
+        hex.push_back(digits[byte & 0x0f]);
+    }
+    return hex;
+}
+
+bool write_all(int fd, const std::string& content) {
+    size_t written = 0;
+    while (written < content.size()) {
+        const auto result = ::write(fd, content.data() + written, content.size() - written);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        written += static_cast<size_t>(result);
+    }
+    return true;
+}
+
+std::optional<std::vector<unsigned char>> from_hex(const std::string& hex) {
+    if (hex.size() % 2 != 0) {
+        return std::nullopt;
+    }
+
+    const auto nibble = [](char c) -> int {
+        if (c >= '0' and c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'a' and c <= 'f') {
+            return c - 'a' + 10;
+        }
+        return -1;
+    };
+
+    std::vector<unsigned char> data;
+    data.reserve(hex.size() / 2);
+    for (size_t i = 0; i < hex.size(); i += 2) {
+        const int high = nibble(hex[i]);
+        const int low = nibble(hex[i + 1]);
+        if (high < 0 or low < 0) {
+            return std::nullopt;
+        }
+        data.push_back(static_cast<unsigned char>(high << 4 | low));
+    }
+    return data;
+}
+
+} // namespace
+
+TlsSessionCache::TlsSessionCache(const std::optional<std::filesystem::path>& file) :
+    file(file), use_counter(0), dirty(false) {
+    this->load();
+}
+
+TlsSessionCache::~TlsSessionCache() {
+    this->flush();
+}
+
+const std::optional<std::filesystem::path>& TlsSessionCache::get_file() const {
+    return this->file;
+}
+
+void TlsSessionCache::attach(SSL_CTX* ctx, const std::string& key) {
+    // The sessions are stored by the callback only, OpenSSL does not look up client sessions in its own cache
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ctx, new_session_callback);
+    SSL_CTX_set_info_callback(ctx, info_callback);
+
+    auto attachment = new Attachment{this->shared_from_this(), key};
+    if (SSL_CTX_set_ex_data(ctx, attachment_index(), attachment) != 1) {
+        EVLOG_warning << "Could not attach the TLS session cache, sessions are not resumed";
+        delete attachment;
+    }
+}
+
+void TlsSessionCache::store(const std::string& key, SSL_SESSION* session) {
+    if (SSL_SESSION_is_resumable(session) != 1) {
+        return;
+    }
+
+    const int length = i2d_SSL_SESSION(session, nullptr);
+    if (length <= 0) {
+        return;
+    }
+
+    std::vector<unsigned char> der(length);
+    unsigned char* data = der.data();
+    i2d_SSL_SESSION(session, &data);
+
+    Snapshot snapshot;
+    {
+        std::lock_guard<std::mutex> lock(this->sessions_mutex);
+        if (this->sessions.size() >= MAX_SESSIONS and this->sessions.count(key) == 0) {
+            const auto least_recently_used =
+                std::min_element(this->sessions.begin(), this->sessions.end(), [](const auto& lhs, const auto& rhs) {
+                    return lhs.second.last_used < rhs.second.last_used;
+                });
+            this->sessions.erase(least_recently_used);
+        }
+        this->sessions[key] = Session{std::move(der), ++this->use_counter};
+        this->dirty = true;
+
+        // Called from the handshake of a connection, the tickets that follow shortly are written with a later session
+        // or when the cache is flushed
+        const auto now = std::chrono::steady_clock::now();
+        const bool saved_recently = this->saved_at.has_value() and now - this->saved_at.value() < SAVE_INTERVAL;
+        if (not this->file.has_value() or saved_recently) {
+            return;
+        }
+        snapshot = this->take_snapshot();
+    }
+
+    this->save(snapshot);
+}
+
+SSL_SESSION* TlsSessionCache::take(const std::string& key) {
+    std::lock_guard<std::mutex> lock(this->sessions_mutex);
+    auto it = this->sessions.find(key);
+    if (it == this->sessions.end()) {
+        return nullptr;
+    }
+
+    SSL_SESSION* session = deserialize(it->second.der);
+    if (session == nullptr or is_expired(session)) {
+        SSL_SESSION_free(session);
+        this->sessions.erase(it);
+        return nullptr;
+    }
+
+    if (SSL_SESSION_get_protocol_version(session) >= TLS1_3_VERSION) {
+        this->sessions.erase(it);
+    } else {
+        it->second.last_used = ++this->use_counter;
+    }
+    return session;
+}
+
+void TlsSessionCache::flush() {
+    Snapshot snapshot;
+    {
+        std::lock_guard<std::mutex> lock(this->sessions_mutex);
+        if (not this->file.has_value() or not this->dirty) {
+            return;
+        }
+        snapshot = this->take_snapshot();
+    }
+
+    this->save(snapshot);
+}
+
+size_t TlsSessionCache::size() {
+    std::lock_guard<std::mutex> lock(this->sessions_mutex);
+    return this->sessions.size();
+}
+
+void TlsSessionCache::load() {
+    if (not this->file.has_value()) {
+        return;
+    }
+
+    std::ifstream ifs(this->file.value());
+    if (not ifs.is_open()) {
+        return;
+    }
+
+    // One session per line, the key and the hex encoded DER of the session separated by a tab
+    std::string line;
+    while (std::getline(ifs, line)) {
+        const auto separator = line.rfind('\t');
+        if (separator == std::string::npos) {
+            continue;
+        }
+
+        auto der = from_hex(line.substr(separator + 1));
+        if (not der.has_value()) {
+            continue;
+        }
+
+        // The file is ordered from the least to the most recently used session
+        SSL_SESSION* session = deserialize(der.value());
+        if (session != nullptr and not is_expired(session) and this->sessions.size() < MAX_SESSIONS) {
+            this->sessions[line.substr(0, separator)] = Session{std::move(der.value()), ++this->use_counter};
+        }
+        SSL_SESSION_free(session);
+    }
+
+    EVLOG_debug << "Loaded " << this->sessions.size() << " TLS sessions from: " << this->file.value().string();
+}
+
+TlsSessionCache::Snapshot TlsSessionCache::take_snapshot() {
+    std::vector<const std::pair<const std::string, Session>*> ordered;
+    ordered.reserve(this->sessions.size());
+    for (const auto& entry : this->sessions) {
+        ordered.push_back(&entry);
+    }
+    std::sort(ordered.begin(), ordered.end(),
+              [](const auto* lhs, const auto* rhs) { return lhs->second.last_used < rhs->second.last_used; });
+
+    Snapshot snapshot;
+    snapshot.reserve(ordered.size());
+    for (const auto* entry : ordered) {
+        snapshot.emplace_back(entry->first, entry->second.der);
+    }
+
+    this->dirty = false;
+    this->saved_at = std::chrono::steady_clock::now();
+    return snapshot;
+}
+
+void TlsSessionCache::save(const Snapshot& snapshot) {
+    std::string content;
+    for (const auto& [key, der] : snapshot) {
+        content += key + '\t' + to_hex(der) + '\n';
+    }
+
+    std::lock_guard<std::mutex> lock(this->file_mutex);
+
+    std::filesystem::path tmp_file = this->file.value();
+    tmp_file += ".tmp";
+
+    // The sessions contain the secrets to resume them, so the file is private from the start. It is created
+    // exclusively and never through a link, a file left behind by a crash is removed first
+    const int flags = O_WRONLY | O_CREAT | O_EXCL | O_NOFOLLOW | O_CLOEXEC;
+    int fd = ::open(tmp_file.c_str(), flags, 0600);
+    if (fd < 0 and errno == EEXIST and ::unlink(tmp_file.c_str()) == 0) {
+        fd = ::open(tmp_file.c_str(), flags, 0600);
+    }
+    if (fd < 0) {
+        EVLOG_warning << "Could not write TLS session cache file: " << tmp_file.string() << ": "
+                      << std::strerror(errno);
+        return;
+    }
+
+    if (not write_all(fd, content) or ::fsync(fd) != 0) {
+        EVLOG_warning << "Could not write TLS session cache file: " << tmp_file.string() << ": "
+                      << std::strerror(errno);
+        ::close(fd);
+        ::unlink(tmp_file.c_str());
+        return;
+    }
+    if (::close(fd) != 0) {
+        EVLOG_warning << "Could not close TLS session cache file: " << tmp_file.string() << ": "
+                      << std::strerror(errno);
+        ::unlink(tmp_file.c_str());
+        return;
+    }
+
+    // Replaces the file in one step, so that a crash while writing does not leave a truncated cache behind
+    if (::rename(tmp_file.c_str(), this->file.value().c_str()) != 0) {
+        EVLOG_warning << "Could not replace TLS session cache file: " << this->file.value().string() << ": "
+                      << std::strerror(errno);
+        ::unlink(tmp_file.c_str());
+    }
+}
+
+} // namespace ocpp
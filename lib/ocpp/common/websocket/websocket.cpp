@@ -23,6 +23,14 @@ Websocket::Websocket(const WebsocketConnectionOptions& connection_options, std::
     logging(logging) {
 
 #ifdef LIBOCPP_ENABLE_DEPRECATED_WEBSOCKETPP
+    if (connection_options.enable_compression) {
+        EVLOG_warning << "Websocket compression is only supported by the libwebsockets implementation, the "
+                         "connection is not compressed";
+    }
+    if (connection_options.use_shared_event_loop) {
+        EVLOG_warning << "The shared websocket event loop is only supported by the libwebsockets implementation, the "
+                         "connection uses its own threads";
+    }
     if (connection_options.security_profile <= 1) {
         this->websocket = std::make_unique<WebsocketPlain>(connection_options);
     } else if (connection_options.security_profile >= 2) {
@@ -98,6 +106,33 @@ bool Websocket::send(const std::string& message) {
     return this->websocket->send(message);
 }
 
+bool Websocket::send_async(const std::string& message, const std::function<void(bool sent)>& on_sent) {
+    this->logging->charge_point("Unknown", message);
+    return this->websocket->send_async(message, on_sent);
+}
+
+bool Websocket::send_async(const std::function<void(JsonWriter& writer)>& write,
+                           const std::function<void(bool sent)>& on_sent) {
+    return this->websocket->send_async(
+        [this, &write](JsonWriter& writer) {
+            write(writer);
+            this->logging->charge_point("Unknown", writer.text());
+        },
+        on_sent);
+}
+
+size_t Websocket::get_send_queue_depth() {
+    return this->websocket->get_send_queue_depth();
+}
+
+WebsocketCompressionStats Websocket::get_compression_stats() {
+    return this->websocket->get_compression_stats();
+}
+
+WebsocketMetrics Websocket::get_metrics() {
+    return this->websocket->get_metrics();
+}
+
 void Websocket::set_websocket_ping_interval(int32_t interval_s) {
     this->logging->sys("WebsocketPingInterval changed");
     this->websocket->set_websocket_ping_interval(interval_s);
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
+#include <algorithm>
 #include <random>
 
 #include <everest/logging.hpp>
@@ -20,7 +21,6 @@ WebsocketBase::WebsocketBase() :
 
     set_connection_options_base(connection_options);
 
-    this->ping_timer = std::make_unique<Everest::SteadyTimer>();
     const auto auth_key = connection_options.authorization_key;
     if (auth_key.has_value() and auth_key.value().length() < 16) {
         EVLOG_warning << "AuthorizationKey with only " << auth_key.value().length()
@@ -28,6 +28,42 @@ WebsocketBase::WebsocketBase() :
     }
 }
 
+double WebsocketCompressionStats::tx_ratio() const {
+    if (this->tx_compressed_bytes == 0) {
+        return 0;
+    }
+    return static_cast<double>(this->tx_payload_bytes) / this->tx_compressed_bytes;
+}
+
+double WebsocketCompressionStats::rx_ratio() const {
+    if (this->rx_compressed_bytes == 0) {
+        return 0;
+    }
+    return static_cast<double>(this->rx_payload_bytes) / this->rx_compressed_bytes;
+}
+
+void WebsocketLatencyStats::record(std::chrono::steady_clock::duration duration) {
+    const auto duration_us = std::chrono::duration_cast<std::chrono::microseconds>(duration);
+    this->count++;
+    this->total += duration_us;
+    this->max = std::max(this->max, duration_us);
+    this->last = duration_us;
+}
+
+std::chrono::microseconds WebsocketLatencyStats::mean() const {
+    if (this->count == 0) {
+        return std::chrono::microseconds(0);
+    }
+    return this->total / this->count;
+}
+
+double WebsocketMetrics::tls_resumption_ratio() const {
+    if (this->tls_handshakes == 0) {
+        return 0;
+    }
+    return static_cast<double>(this->tls_resumed_handshakes) / this->tls_handshakes;
+}
+
 WebsocketBase::~WebsocketBase() {
     this->cancel_reconnect_timer();
 }
@@ -90,9 +126,7 @@ void WebsocketBase::disconnect(const WebsocketCloseReason code) {
         }
     }
 
-    if (this->ping_timer) {
-        this->ping_timer->stop();
-    }
+    this->stop_ping_timer();
 
     EVLOG_info << "Disconnecting websocket...";
     this->close(code, "");
@@ -158,16 +192,64 @@ void WebsocketBase::cancel_reconnect_timer() {
     this->reconnect_timer = nullptr;
 }
 
-void WebsocketBase::set_websocket_ping_interval(int32_t interval_s) {
-    if (this->ping_timer) {
-        this->ping_timer->stop();
+bool WebsocketBase::send_async(const std::string& message, const std::function<void(bool sent)>& on_sent) {
+    if (!this->send(message)) {
+        // the message has not been accepted, so on_sent is not called
+        return false;
+    }
+    if (on_sent) {
+        on_sent(true);
     }
+    return true;
+}
+
+bool WebsocketBase::send_async(const std::function<void(JsonWriter& writer)>& write,
+                               const std::function<void(bool sent)>& on_sent) {
+    JsonWriter writer;
+    write(writer);
+    return this->send_async(writer.str(), on_sent);
+}
+
+size_t WebsocketBase::get_send_queue_depth() {
+    return 0;
+}
+
+WebsocketCompressionStats WebsocketBase::get_compression_stats() {
+    return {};
+}
+
+WebsocketMetrics WebsocketBase::get_metrics() {
+    WebsocketMetrics snapshot;
+    {
+        std::lock_guard<std::mutex> lock(this->metrics_mutex);
+        snapshot = this->metrics;
+    }
+    snapshot.send_queue_depth = this->get_send_queue_depth();
+    snapshot.compression = this->get_compression_stats();
+    return snapshot;
+}
+
+void WebsocketBase::set_websocket_ping_interval(int32_t interval_s) {
+    this->stop_ping_timer();
     if (interval_s > 0) {
-        this->ping_timer->interval([this]() { this->ping(); }, std::chrono::seconds(interval_s));
+        this->start_ping_timer(interval_s);
     }
     this->connection_options.ping_interval_s = interval_s;
 }
 
+void WebsocketBase::start_ping_timer(int32_t interval_s) {
+    if (this->ping_timer == nullptr) {
+        this->ping_timer = std::make_unique<Everest::SteadyTimer>();
+    }
+    this->ping_timer->interval([this]() { this->ping(); }, std::chrono::seconds(interval_s));
+}
+
+void WebsocketBase::stop_ping_timer() {
+    if (this->ping_timer) {
+        this->ping_timer->stop();
+    }
+}
+
 void WebsocketBase::set_authorization_key(const std::string& authorization_key) {
     this->connection_options.authorization_key = authorization_key;
 }
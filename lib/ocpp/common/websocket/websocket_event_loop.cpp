@@ -0,0 +1,249 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/websocket/websocket_event_loop.hpp>
+
+#include <condition_variable>
+#include <cstring>
+#include <stdexcept>
+
+#include <everest/logging.hpp>
+
+#include <libwebsockets.h>
+
+namespace ocpp {
+
+constexpr auto event_loop_protocol_name = "lws-everest-event-loop";
+
+// The default vhost of the shared context only exists to keep the context serviced, the connections bring their own
+static const struct lws_protocols event_loop_protocols[] = {
+    {event_loop_protocol_name, lws_callback_http_dummy, 0, 0, 0, NULL, 0}, LWS_PROTOCOL_LIST_TERM};
+
+// Standard layout, so that libwebsockets can find the timer of an expired sul
+struct TimerSul {
+    lws_sorted_usec_list_t sul;
+    void* timer;
+};
+
+struct WebsocketEventLoop::Timer {
+    TimerSul sul;
+    WebsocketEventLoop* loop;
+    TimerId id;
+    std::chrono::steady_clock::duration delay;
+    std::function<void()> task;
+    bool periodic;
+};
+
+WebsocketEventLoop::WebsocketEventLoop(size_t worker_count) : context(nullptr), running(true), next_timer_id(1) {
+    lws_set_log_level(LLL_ERR, nullptr);
+
+    lws_context_creation_info info;
+    memset(&info, 0, sizeof(lws_context_creation_info));
+
+    info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
+    info.port = CONTEXT_PORT_NO_LISTEN; /* we do not run any server */
+    info.protocols = event_loop_protocols;
+
+    this->context = lws_create_context(&info);
+    if (this->context == nullptr) {
+        throw std::runtime_error("Could not create libwebsockets context of the shared event loop");
+    }
+
+    this->workers = std::make_shared<WebsocketWorkerPool>(worker_count);
+    this->service_thread = std::thread(&WebsocketEventLoop::run, this);
+
+    EVLOG_info << "Started shared websocket event loop with " << this->workers->get_worker_count() << " workers";
+}
+
+WebsocketEventLoop::~WebsocketEventLoop() {
+    this->running = false;
+    lws_cancel_service(this->context);
+
+    if (this->service_thread.joinable()) {
+        this->service_thread.join();
+    }
+
+    // Closes the remaining connections and destroys their vhosts, afterwards the tasks that still own resources of
+    // the connections can be released
+    lws_context_destroy(this->context);
+    this->tasks.clear();
+    this->timers.clear();
+}
+
+std::shared_ptr<WebsocketEventLoop> WebsocketEventLoop::get_shared(size_t worker_count) {
+    static std::mutex shared_mutex;
+    // Not owned, the websockets and their connections keep the loop alive as long as one of them uses it
+    static std::weak_ptr<WebsocketEventLoop> shared_loop;
+
+    std::lock_guard<std::mutex> lock(shared_mutex);
+    if (auto loop = shared_loop.lock()) {
+        return loop;
+    }
+
+    // The last reference may be released by a task on the service thread, which can't join itself. The loop is
+    // destroyed on a thread of its own then
+    std::shared_ptr<WebsocketEventLoop> loop(new WebsocketEventLoop(worker_count), [](WebsocketEventLoop* loop) {
+        if (loop->is_service_thread()) {
+            std::thread([loop]() { delete loop; }).detach();
+        } else {
+            delete loop;
+        }
+    });
+    shared_loop = loop;
+    return loop;
+}
+
+void WebsocketEventLoop::post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(this->tasks_mutex);
+        this->tasks.push_back(std::move(task));
+    }
+
+    // Wakes the service thread, according to the docs this is the only function that may be called from other threads
+    lws_cancel_service(this->context);
+}
+
+void WebsocketEventLoop::run_sync(const std::function<void()>& task) {
+    if (this->is_service_thread()) {
+        task();
+        return;
+    }
+
+    std::mutex done_mutex;
+    std::condition_variable done_cv;
+    bool done = false;
+
+    this->post([&]() {
+        task();
+        {
+            std::lock_guard<std::mutex> lock(done_mutex);
+            done = true;
+        }
+        done_cv.notify_one();
+    });
+
+    std::unique_lock<std::mutex> lock(done_mutex);
+    done_cv.wait(lock, [&]() { return done; });
+}
+
+WebsocketEventLoop::TimerId WebsocketEventLoop::timeout(const std::function<void()>& task,
+                                                        std::chrono::steady_clock::duration delay) {
+    const auto id = this->next_timer_id++;
+    this->post([this, id, task, delay]() { this->start_timer(id, delay, task, false); });
+    return id;
+}
+
+WebsocketEventLoop::TimerId WebsocketEventLoop::interval(const std::function<void()>& task,
+                                                         std::chrono::steady_clock::duration interval) {
+    const auto id = this->next_timer_id++;
+    this->post([this, id, task, interval]() { this->start_timer(id, interval, task, true); });
+    return id;
+}
+
+void WebsocketEventLoop::cancel(TimerId id) {
+    auto cancel_timer = [this, id]() {
+        auto it = this->timers.find(id);
+        if (it != this->timers.end()) {
+            lws_sul_cancel(&it->second->sul.sul);
+            this->timers.erase(it);
+        }
+    };
+
+    if (this->is_service_thread()) {
+        cancel_timer();
+    } else {
+        this->post(cancel_timer);
+    }
+}
+
+bool WebsocketEventLoop::is_service_thread() const {
+    return std::this_thread::get_id() == this->service_thread.get_id();
+}
+
+lws_context* WebsocketEventLoop::get_context() const {
+    return this->context;
+}
+
+std::shared_ptr<WebsocketStrand> WebsocketEventLoop::make_strand() {
+    return std::make_shared<WebsocketStrand>(this->workers);
+}
+
+size_t WebsocketEventLoop::get_thread_count() const {
+    return 1 + this->workers->get_worker_count();
+}
+
+void WebsocketEventLoop::start_timer(TimerId id, std::chrono::steady_clock::duration delay,
+                                     std::function<void()> task, bool periodic) {
+    auto timer = std::make_unique<Timer>();
+    memset(&timer->sul.sul, 0, sizeof(lws_sorted_usec_list_t));
+    timer->sul.timer = timer.get();
+    timer->loop = this;
+    timer->id = id;
+    timer->delay = delay;
+    timer->task = std::move(task);
+    timer->periodic = periodic;
+
+    schedule(timer.get());
+    this->timers[id] = std::move(timer);
+}
+
+void WebsocketEventLoop::schedule(Timer* timer) {
+    const auto delay_us = std::chrono::duration_cast<std::chrono::microseconds>(timer->delay).count();
+    lws_sul_schedule(
+        timer->loop->context, 0, &timer->sul.sul,
+        [](lws_sorted_usec_list_t* sul) {
+            on_timer(static_cast<Timer*>(lws_container_of(sul, TimerSul, sul)->timer));
+        },
+        delay_us);
+}
+
+void WebsocketEventLoop::on_timer(Timer* timer) {
+    auto* loop = timer->loop;
+    const auto id = timer->id;
+
+    std::function<void()> task;
+    if (timer->periodic) {
+        // The timer stays registered while its task runs, so that the task can cancel it
+        task = timer->task;
+    } else {
+        task = std::move(timer->task);
+        loop->timers.erase(id);
+    }
+
+    try {
+        task();
+    } catch (const std::exception& e) {
+        EVLOG_error << "Exception in websocket event loop timer: " << e.what();
+    }
+
+    // Not registered any more if the timer was cancelled by its task
+    auto it = loop->timers.find(id);
+    if (it != loop->timers.end()) {
+        schedule(it->second.get());
+    }
+}
+
+void WebsocketEventLoop::run() {
+    EVLOG_debug << "Init shared event loop with ID: " << std::hex << std::this_thread::get_id();
+
+    while (this->running) {
+        // Returns after an event of one of the connections was handled or the service was cancelled by post()
+        if (lws_service(this->context, 0) < 0) {
+            EVLOG_error << "Servicing the shared libwebsockets context failed";
+        }
+
+        std::vector<std::function<void()>> pending;
+        {
+            std::lock_guard<std::mutex> lock(this->tasks_mutex);
+            pending.swap(this->tasks);
+        }
+
+        for (auto& task : pending) {
+            task();
+        }
+    }
+
+    EVLOG_debug << "Exit shared event loop with ID: " << std::hex << std::this_thread::get_id();
+}
+
+} // namespace ocpp
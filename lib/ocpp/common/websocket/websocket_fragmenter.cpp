@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/websocket/websocket_fragmenter.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace ocpp {
+
+WebsocketFragmenter::WebsocketFragmenter(size_t message_length, size_t max_fragment_size) :
+    message_length(message_length), max_fragment_size(max_fragment_size), written(0), started(false) {
+}
+
+bool WebsocketFragmenter::done() const {
+    // an empty message is still written as one empty frame
+    return this->started and this->written >= this->message_length;
+}
+
+WebsocketFragment WebsocketFragmenter::next() {
+    if (this->done()) {
+        throw std::out_of_range("All fragments of the websocket message have been provided");
+    }
+
+    const auto remaining = this->message_length - this->written;
+    const auto length = this->max_fragment_size == 0 ? remaining : std::min(remaining, this->max_fragment_size);
+
+    WebsocketFragment fragment{this->written, length, not this->started, length == remaining};
+    this->written += length;
+    this->started = true;
+    return fragment;
+}
+
+size_t WebsocketFragmenter::get_written() const {
+    return this->written;
+}
+
+} // namespace ocpp
@@ -1,12 +1,17 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
 #include <evse_security/crypto/openssl/openssl_provider.hpp>
+#include <ocpp/common/websocket/tls_session_cache.hpp>
+#include <ocpp/common/websocket/websocket_event_loop.hpp>
+#include <ocpp/common/websocket/websocket_fragmenter.hpp>
 #include <ocpp/common/websocket/websocket_libwebsockets.hpp>
 
 #include <everest/logging.hpp>
 
 #include <libwebsockets.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <fstream>
 #include <memory>
@@ -68,10 +73,18 @@ enum class EConnectionState {
 /// \brief Message to return in the callback to close the socket connection
 static constexpr int LWS_CLOSE_SOCKET_RESPONSE_MESSAGE = -1;
 
+/// \brief Time after which a connection that has not been established yet is handled as failed
+static constexpr auto CONNECT_TIMEOUT = std::chrono::seconds(60);
+
 /// \brief Per thread connection data
 struct ConnectionData {
     ConnectionData() :
-        wsi(nullptr), owner(nullptr), is_running(true), is_marked_close(false), state(EConnectionState::INITIALIZE) {
+        wsi(nullptr),
+        connect_started_at(std::chrono::steady_clock::now()),
+        owner(nullptr),
+        is_running(true),
+        is_marked_close(false),
+        state(EConnectionState::INITIALIZE) {
     }
 
     ~ConnectionData() {
@@ -79,6 +92,17 @@ struct ConnectionData {
         is_running = false;
         wsi = nullptr;
         owner = nullptr;
+
+        if (event_loop != nullptr && vhost != nullptr) {
+            if (event_loop->is_service_thread()) {
+                lws_vhost_destroy(vhost);
+            } else {
+                // The vhost belongs to the shared context and is destroyed on its service thread, it uses the TLS
+                // context until then
+                std::shared_ptr<SSL_CTX> ssl_ctx = std::move(sec_context);
+                event_loop->post([vhost = this->vhost, ssl_ctx]() { lws_vhost_destroy(vhost); });
+            }
+        }
     }
 
     void bind_thread(std::thread::id id) {
@@ -129,6 +153,16 @@ struct ConnectionData {
         owner = o;
     }
 
+    /// \brief Called from the lws thread when libwebsockets destroys the connection
+    void on_wsi_destroyed() {
+        wsi = nullptr;
+
+        if (keep_alive != nullptr) {
+            // Released from a task of the shared event loop, since the data is still used by the running callback
+            event_loop->post([keep_alive = std::move(keep_alive)]() {});
+        }
+    }
+
 public:
     // This public block will only be used from client loop thread, no locking needed
     // Openssl context, must be destroyed in this order
@@ -138,6 +172,30 @@ public:
 
     lws* wsi;
 
+    // When the connection was started, to measure the time until it is established
+    std::chrono::steady_clock::time_point connect_started_at;
+
+    // Lifetime of this is important since we use the data from this in private_key_callback()
+    std::optional<std::string> private_key_password;
+
+    // Only set for connections of the shared event loop, the connection has its own vhost in the shared context
+    std::shared_ptr<WebsocketEventLoop> event_loop;
+    lws_vhost* vhost = nullptr;
+    std::string vhost_name;
+    // Keeps the data alive until libwebsockets destroys the connection, even if the websocket has released it
+    std::shared_ptr<ConnectionData> keep_alive;
+
+    // permessage-deflate offer of this connection, must live as long as the lws context
+    std::string compression_offer;
+    std::array<lws_extension, 2> extensions{};
+
+    // Compression statistics, updated from the client loop thread
+    std::atomic_bool compression_negotiated{false};
+    std::atomic<uint64_t> tx_payload_bytes{0};
+    std::atomic<uint64_t> tx_compressed_bytes{0};
+    std::atomic<uint64_t> rx_payload_bytes{0};
+    std::atomic<uint64_t> rx_compressed_bytes{0};
+
 private:
     std::atomic<WebsocketTlsTPM*> owner;
 
@@ -148,23 +206,88 @@ private:
     std::atomic<EConnectionState> state;
 };
 
+/// \brief Maximum number of message buffers that are kept for reuse
+static constexpr size_t MAX_POOLED_BUFFERS = 16;
+/// \brief Buffers that have grown larger than this are freed instead of being kept for reuse
+static constexpr size_t MAX_POOLED_BUFFER_CAPACITY = 64 * 1024;
+
+/// \brief Buffers of sent or received messages, kept so that their allocations are reused for the next messages. Only
+/// the allocation is reused, acquired buffers are always empty
+struct BufferPool {
+    std::string acquire() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->buffers.empty()) {
+            return {};
+        }
+        auto buffer = std::move(this->buffers.back());
+        this->buffers.pop_back();
+        return buffer;
+    }
+
+    void release(std::string&& buffer) {
+        if (buffer.capacity() > MAX_POOLED_BUFFER_CAPACITY) {
+            return;
+        }
+        // Keeps the capacity, the content of a processed message must not leak into the next one
+        buffer.clear();
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (this->buffers.size() < MAX_POOLED_BUFFERS) {
+            this->buffers.push_back(std::move(buffer));
+        }
+    }
+
+private:
+    std::mutex mutex;
+    std::vector<std::string> buffers;
+};
+
 struct WebsocketMessage {
-    WebsocketMessage() : sent_bytes(0), message_sent(false) {
+    explicit WebsocketMessage(const std::shared_ptr<BufferPool>& pool) :
+        pool(pool), fragmenter(0, 0), message_sent(false), message_dropped(false) {
     }
 
     virtual ~WebsocketMessage() {
+        // Nobody references the message any more, so the buffer can be reused
+        if (pool != nullptr) {
+            pool->release(std::move(buffer));
+        }
+    }
+
+    size_t payload_length() const {
+        return buffer.size() - LWS_PRE;
     }
 
+    unsigned char* payload() {
+        return reinterpret_cast<unsigned char*>(&buffer[LWS_PRE]);
+    }
+
+    std::string_view payload_view() const {
+        return std::string_view(buffer).substr(LWS_PRE);
+    }
+
+private:
+    std::shared_ptr<BufferPool> pool;
+
 public:
-    std::string payload;
+    // LWS_PRE bytes of headroom for libwebsockets followed by the payload, handed to lws_write without a copy
+    std::string buffer;
     lws_write_protocol protocol;
 
-    // How many bytes we have sent to libwebsockets, does not
+    // When the message was queued, to measure how long it takes until it has been written
+    std::chrono::steady_clock::time_point queued_at;
+    // Since when the next frame waits for the transport, when the message was queued or the previous frame written
+    std::chrono::steady_clock::time_point frame_ready_at;
+
+    // The fragments we have sent to libwebsockets, once done it does not
     // necessarily mean that all bytes have been sent over the wire,
     // just that these were sent to libwebsockets
-    size_t sent_bytes;
+    WebsocketFragmenter fragmenter;
     // If libwebsockets has sent all the bytes through the wire
     std::atomic_bool message_sent;
+    // If the message was removed from the queue before it could be sent
+    std::atomic_bool message_dropped;
+    // Optional callback that is informed if the message was sent or dropped
+    std::function<void(bool sent)> on_sent;
 };
 
 static bool verify_csms_cn(const std::string& hostname, bool preverified, const X509_STORE_CTX* ctx,
@@ -231,12 +354,47 @@ static bool verify_csms_cn(const std::string& hostname, bool preverified, const
     return preverified;
 }
 
+/// \brief Creates a message with a copy of the given \p payload in a send buffer from the given \p pool
+static std::shared_ptr<WebsocketMessage> make_message(const std::shared_ptr<BufferPool>& pool,
+                                                      std::string_view payload, lws_write_protocol protocol) {
+    auto msg = std::make_shared<WebsocketMessage>(pool);
+    msg->buffer = pool->acquire();
+    msg->buffer.resize(LWS_PRE);
+    msg->buffer.append(payload);
+    msg->protocol = protocol;
+    return msg;
+}
+
+/// \brief Detaches the connection of the given \p data from its websocket and closes it. Runs on the service thread of
+/// the shared event loop, so no callback of the connection reaches the websocket afterwards
+static void detach_connection(const std::shared_ptr<ConnectionData>& data) {
+    data->event_loop->run_sync([&data]() {
+        data->set_owner(nullptr);
+
+        if (lws* wsi = data->get_conn()) {
+            lws_set_timeout(wsi, PENDING_TIMEOUT_USER_OK, LWS_TO_KILL_ASYNC);
+        }
+    });
+}
+
 WebsocketTlsTPM::WebsocketTlsTPM(const WebsocketConnectionOptions& connection_options,
                                  std::shared_ptr<EvseSecurity> evse_security) :
-    WebsocketBase(), evse_security(evse_security), stop_deferred_handler(false) {
+    WebsocketBase(),
+    evse_security(evse_security),
+    send_buffer_pool(std::make_shared<BufferPool>()),
+    recv_buffer_pool(std::make_shared<BufferPool>()),
+    stop_deferred_handler(false) {
 
     set_connection_options(connection_options);
 
+    if (this->connection_options.use_shared_event_loop) {
+        this->event_loop = WebsocketEventLoop::get_shared(this->connection_options.shared_event_loop_workers);
+        this->recv_strand = this->event_loop->make_strand();
+        this->deferred_strand = this->event_loop->make_strand();
+    } else {
+        this->reconnect_timer_tpm = std::make_unique<Everest::SteadyTimer>();
+    }
+
     EVLOG_debug << "Initialised WebsocketTlsTPM with URI: " << this->connection_options.csms_uri.string();
 }
 
@@ -244,13 +402,31 @@ WebsocketTlsTPM::~WebsocketTlsTPM() {
     std::shared_ptr<ConnectionData> local_data = conn_data;
     if (local_data != nullptr) {
         local_data->do_interrupt();
+
+        if (this->event_loop != nullptr) {
+            detach_connection(local_data);
+        }
     }
 
+    if (this->event_loop != nullptr) {
+        // The reconnect timer runs on the service thread, cancelled there it can't start a connection any more. No
+        // callback of the detached connection can schedule a new one afterwards
+        this->event_loop->run_sync([this]() {
+            std::lock_guard<std::mutex> lk(this->reconnect_mutex);
+            this->stop_reconnect_timer();
+        });
+    } else {
+        std::lock_guard<std::mutex> lk(this->reconnect_mutex);
+        this->stop_reconnect_timer();
+    }
+    this->stop_ping_timer();
+
     if (websocket_thread != nullptr) {
         websocket_thread->join();
     }
 
     if (recv_message_thread != nullptr) {
+        wake_recv_loop();
         recv_message_thread->join();
     }
 
@@ -262,6 +438,11 @@ WebsocketTlsTPM::~WebsocketTlsTPM() {
         this->deferred_callback_cv.notify_one();
         this->deferred_callback_thread->join();
     }
+
+    if (this->event_loop != nullptr) {
+        this->recv_strand->stop();
+        this->deferred_strand->stop();
+    }
 }
 
 void WebsocketTlsTPM::set_connection_options(const WebsocketConnectionOptions& connection_options) {
@@ -289,12 +470,20 @@ static int callback_minimal(struct lws* wsi, enum lws_callback_reasons reason, v
     // Get user safely, since on some callbacks (void *user) can be different than what we set
     if (wsi != nullptr) {
         if (ConnectionData* data = reinterpret_cast<ConnectionData*>(lws_wsi_user(wsi))) {
+            int result = 0;
             auto owner = data->get_owner();
             if (owner not_eq nullptr) {
-                return data->get_owner()->process_callback(wsi, static_cast<int>(reason), user, in, len);
-            } else {
+                result = owner->process_callback(wsi, static_cast<int>(reason), user, in, len);
+            } else if (!data->is_interupted()) {
+                // Connections that were detached from their websocket are interrupted and only wait to be closed
                 EVLOG_warning << "callback_minimal called, but data->owner is nullptr. Reason: " << reason;
             }
+
+            if (reason == LWS_CALLBACK_WSI_DESTROY) {
+                data->on_wsi_destroyed();
+            }
+
+            return result;
         }
     }
 
@@ -313,6 +502,39 @@ static int private_key_callback(char* buf, int size, int rwflag, void* userdata)
     return max_copy_chars;
 }
 
+/// \brief Forwards to the permessage-deflate extension of libwebsockets and counts the compressed and uncompressed
+/// payload bytes of the connection
+static int callback_pm_deflate(struct lws_context* context, const struct lws_extension* ext, struct lws* wsi,
+                               enum lws_extension_callback_reasons reason, void* user, void* in, size_t len) {
+    ConnectionData* data = (wsi != nullptr) ? reinterpret_cast<ConnectionData*>(lws_wsi_user(wsi)) : nullptr;
+    auto* ebufs = reinterpret_cast<lws_ext_pm_deflate_rx_ebufs*>(in);
+    const bool is_payload = (reason == LWS_EXT_CB_PAYLOAD_TX || reason == LWS_EXT_CB_PAYLOAD_RX);
+    const int in_len = (is_payload && ebufs != nullptr) ? ebufs->eb_in.len : 0;
+
+    const int result = lws_extension_callback_pm_deflate(context, ext, wsi, reason, user, in, len);
+
+    if (data == nullptr) {
+        return result;
+    }
+
+    if (reason == LWS_EXT_CB_CLIENT_CONSTRUCT) {
+        data->compression_negotiated = true;
+    } else if (is_payload && ebufs != nullptr) {
+        // eb_in is consumed by the extension and eb_out is produced by it
+        const uint64_t consumed = std::max(in_len - ebufs->eb_in.len, 0);
+        const uint64_t produced = std::max(ebufs->eb_out.len, 0);
+        if (reason == LWS_EXT_CB_PAYLOAD_TX) {
+            data->tx_payload_bytes += consumed;
+            data->tx_compressed_bytes += produced;
+        } else {
+            data->rx_compressed_bytes += consumed;
+            data->rx_payload_bytes += produced;
+        }
+    }
+
+    return result;
+}
+
 constexpr auto local_protocol_name = "lws-everest-client";
 static const struct lws_protocols protocols[] = {{local_protocol_name, callback_minimal, 0, 0, 0, NULL, 0},
                                                  LWS_PROTOCOL_LIST_TERM};
@@ -428,6 +650,25 @@ bool WebsocketTlsTPM::tls_init(SSL_CTX* ctx, const std::string& path_chain, cons
     return true;
 }
 
+void WebsocketTlsTPM::attach_tls_session_cache(SSL_CTX* ctx, const std::string& path_chain) {
+    const auto& cache_file = this->connection_options.tls_session_cache_file;
+    if (this->tls_session_cache == nullptr or this->tls_session_cache->get_file() != cache_file) {
+        this->tls_session_cache = std::make_shared<TlsSessionCache>(cache_file);
+    }
+
+    // A session must not be resumed with another client certificate, a renewed certificate gets a new key
+    auto& uri = this->connection_options.csms_uri;
+    std::string key = uri.get_hostname() + ":" + std::to_string(uri.get_port()) + "|" +
+                      std::to_string(this->connection_options.security_profile);
+    if (!path_chain.empty()) {
+        std::error_code ec;
+        const auto modified = std::filesystem::last_write_time(path_chain, ec);
+        key += "|" + path_chain + "|" + std::to_string(modified.time_since_epoch().count());
+    }
+
+    this->tls_session_cache->attach(ctx, key);
+}
+
 void WebsocketTlsTPM::recv_loop() {
     std::shared_ptr<ConnectionData> local_data = conn_data;
 
@@ -438,31 +679,28 @@ void WebsocketTlsTPM::recv_loop() {
 
     EVLOG_debug << "Init recv loop with ID: " << std::hex << std::this_thread::get_id();
 
-    while (!local_data->is_interupted()) {
-        // Process all messages
-        while (true) {
-            std::string message{};
+    while (true) {
+        std::string message{};
 
-            {
-                std::lock_guard lk(this->recv_mutex);
-                if (recv_message_queue.empty())
-                    break;
+        {
+            // While we are empty, sleep until a message is handed over or the connection is interrupted
+            std::unique_lock<std::mutex> lock(this->recv_mutex);
+            recv_message_cv.wait(lock, [&]() { return !recv_message_queue.empty() || local_data->is_interupted(); });
 
-                message = std::move(recv_message_queue.front());
-                recv_message_queue.pop();
+            if (local_data->is_interupted()) {
+                break;
             }
 
-            // Invoke our processing callback, that might trigger a send back that
-            // can cause a deadlock if is not managed on a different thread
-            this->message_callback(message);
+            message = std::move(recv_message_queue.front());
+            recv_message_queue.pop();
         }
 
-        // While we are empty, sleep
-        {
-            std::unique_lock<std::mutex> lock(this->recv_mutex);
-            recv_message_cv.wait_for(lock, std::chrono::seconds(1),
-                                     [&]() { return (false == recv_message_queue.empty()); });
-        }
+        // Invoke our processing callback, that might trigger a send back that
+        // can cause a deadlock if is not managed on a different thread
+        this->message_callback(message);
+
+        // The message has been processed, its buffer can be reused for one of the next messages
+        this->recv_buffer_pool->release(std::move(message));
     }
 
     EVLOG_debug << "Exit recv loop with ID: " << std::hex << std::this_thread::get_id();
@@ -489,7 +727,96 @@ void WebsocketTlsTPM::client_loop() {
     info.options = LWS_SERVER_OPTION_DO_SSL_GLOBAL_INIT;
     info.port = CONTEXT_PORT_NO_LISTEN; /* we do not run any server */
     info.protocols = protocols;
+    info.fd_limit_per_thread = 1 + 1 + 1;
+
+    if (!init_connection_info(info, local_data)) {
+        return;
+    }
+
+    lws_context* lws_ctx = lws_create_context(&info);
+    if (nullptr == lws_ctx) {
+        EVLOG_error << "lws init failed!";
+        local_data->update_state(EConnectionState::FINALIZED);
+        return;
+    }
+
+    // Conn acquire the lws context
+    local_data->lws_ctx = std::unique_ptr<lws_context>(lws_ctx);
+
+    if (!connect_client(local_data, lws_ctx, nullptr)) {
+        return;
+    }
+
+    EVLOG_debug << "Init client loop with ID: " << std::hex << std::this_thread::get_id();
+
+    // Process while we're running
+    int n = 0;
+
+    while (n >= 0 && (!local_data->is_interupted())) {
+        // Set to -1 for continuous servicing, of required, not recommended
+        n = lws_service(local_data->lws_ctx.get(), 0);
+
+        bool message_queue_empty;
+        {
+            std::lock_guard<std::mutex> lock(this->queue_mutex);
+            message_queue_empty = message_queue.empty();
+        }
+        if (!message_queue_empty && local_data->get_conn() != nullptr) {
+            lws_callback_on_writable(local_data->get_conn());
+        }
+    }
+
+    // Client loop finished for our tid
+    EVLOG_debug << "Exit client loop with ID: " << std::hex << std::this_thread::get_id();
+}
+
+void WebsocketTlsTPM::shared_client_connect(const std::shared_ptr<ConnectionData>& local_data) {
+    // The connection has been replaced or closed before the service thread got to it
+    if (local_data->is_interupted()) {
+        return;
+    }
+
+    // Bind thread for checks
+    local_data->bind_thread(std::this_thread::get_id());
+
+    lws_context_creation_info info;
+    memset(&info, 0, sizeof(lws_context_creation_info));
+
+    info.port = CONTEXT_PORT_NO_LISTEN; /* we do not run any server */
+    info.protocols = protocols;
+
+    if (!init_connection_info(info, local_data)) {
+        return;
+    }
+
+    // The vhost can outlive the data, the connection itself references it with its userdata
+    info.user = nullptr;
+
+    // Every connection gets its own vhost in the shared context for its TLS context and extensions
+    static std::atomic<uint64_t> vhost_count{0};
+    local_data->vhost_name = "ocpp-client-" + std::to_string(vhost_count++);
+    info.vhost_name = local_data->vhost_name.c_str();
+
+    lws_context* lws_ctx = this->event_loop->get_context();
+    local_data->vhost = lws_create_vhost(lws_ctx, &info);
+    if (local_data->vhost == nullptr) {
+        EVLOG_error << "lws vhost init failed!";
+        local_data->update_state(EConnectionState::ERROR);
+        on_conn_fail();
+
+        // Notify conn waiter
+        conn_cv.notify_one();
+        return;
+    }
+
+    if (connect_client(local_data, lws_ctx, local_data->vhost)) {
+        // There is no client loop that holds the data while the connection is alive, see callback_minimal()
+        local_data->keep_alive = local_data;
+    }
+}
 
+bool WebsocketTlsTPM::init_connection_info(lws_context_creation_info& info,
+                                           const std::shared_ptr<ConnectionData>& local_data) {
     if (this->connection_options.iface.has_value()) {
         EVLOG_info << "Using network iface: " << this->connection_options.iface.value().c_str();
 
@@ -500,10 +827,13 @@ void WebsocketTlsTPM::client_loop() {
     // Set reference to ConnectionData since 'data' can go away in the websocket
     info.user = local_data.get();
 
-    info.fd_limit_per_thread = 1 + 1 + 1;
-
-    // Lifetime of this is important since we use the data from this in private_key_callback()
-    std::optional<std::string> private_key_password;
+    if (this->connection_options.enable_compression) {
+        const auto window_bits = std::clamp(this->connection_options.compression_window_bits, 8, 15);
+        local_data->compression_offer = "permessage-deflate; client_max_window_bits=" + std::to_string(window_bits);
+        local_data->extensions[0] = {"permessage-deflate", callback_pm_deflate, local_data->compression_offer.c_str()};
+        local_data->extensions[1] = {nullptr, nullptr, nullptr};
+        info.extensions = local_data->extensions.data();
+    }
 
     if (this->connection_options.security_profile == 2 || this->connection_options.security_profile == 3) {
         // Setup context - need to know the key type first
@@ -523,7 +853,7 @@ void WebsocketTlsTPM::client_loop() {
 
                 // Notify conn waiter
                 conn_cv.notify_one();
-                return;
+                return false;
             }
 
             const auto& certificate_info = certificate_response.info.value();
@@ -540,11 +870,11 @@ void WebsocketTlsTPM::client_loop() {
 
                 // Notify conn waiter
                 conn_cv.notify_one();
-                return;
+                return false;
             }
 
             path_key = certificate_info.key_path;
-            private_key_password = certificate_info.password;
+            local_data->private_key_password = certificate_info.password;
         }
 
         SSL_CTX* ssl_ctx = nullptr;
@@ -574,7 +904,7 @@ void WebsocketTlsTPM::client_loop() {
 
             // Notify conn waiter
             conn_cv.notify_one();
-            return;
+            return false;
         }
 
         if (this->connection_options.enable_tls_keylog and this->connection_options.keylog_file.has_value()) {
@@ -583,8 +913,12 @@ void WebsocketTlsTPM::client_loop() {
             SSL_CTX_set_keylog_callback(ssl_ctx, keylog_callback);
         }
 
+        if (this->connection_options.enable_tls_session_resumption) {
+            attach_tls_session_cache(ssl_ctx, path_chain);
+        }
+
         // Init TLS data
-        if (tls_init(ssl_ctx, path_chain, path_key, custom_key, private_key_password) == false) {
+        if (tls_init(ssl_ctx, path_chain, path_key, custom_key, local_data->private_key_password) == false) {
             EVLOG_error << "Unable to init tls";
 
             local_data->update_state(EConnectionState::ERROR);
@@ -592,7 +926,7 @@ void WebsocketTlsTPM::client_loop() {
 
             // Notify conn waiter
             conn_cv.notify_one();
-            return;
+            return false;
         }
 
         // Setup our context
@@ -602,16 +936,11 @@ void WebsocketTlsTPM::client_loop() {
         local_data->sec_context = std::unique_ptr<SSL_CTX>(ssl_ctx);
     }
 
-    lws_context* lws_ctx = lws_create_context(&info);
-    if (nullptr == lws_ctx) {
-        EVLOG_error << "lws init failed!";
-        local_data->update_state(EConnectionState::FINALIZED);
-        return;
-    }
-
-    // Conn acquire the lws context
-    local_data->lws_ctx = std::unique_ptr<lws_context>(lws_ctx);
+    return true;
+}
 
+bool WebsocketTlsTPM::connect_client(const std::shared_ptr<ConnectionData>& local_data, lws_context* lws_ctx,
+                                     lws_vhost* vhost) {
     lws_client_connect_info i;
     memset(&i, 0, sizeof(lws_client_connect_info));
 
@@ -636,6 +965,7 @@ void WebsocketTlsTPM::client_loop() {
 
     // TODO: No idea who releases the strdup?
     i.context = lws_ctx;
+    i.vhost = vhost;
     i.port = uri.get_port();
     i.address = strdup(uri.get_hostname().c_str());                       // Base address, as resolved by getnameinfo
     i.path = strdup((uri.get_path() + uri.get_chargepoint_id()).c_str()); // Path of resource
@@ -665,49 +995,26 @@ void WebsocketTlsTPM::client_loop() {
 
         // Notify conn waiter
         conn_cv.notify_one();
-    } else {
-        EVLOG_debug << "Init client loop with ID: " << std::hex << std::this_thread::get_id();
-
-        // Process while we're running
-        int n = 0;
-
-        while (n >= 0 && (!local_data->is_interupted())) {
-            // Set to -1 for continuous servicing, of required, not recommended
-            n = lws_service(local_data->lws_ctx.get(), 0);
-
-            bool message_queue_empty;
-            {
-                std::lock_guard<std::mutex> lock(this->queue_mutex);
-                message_queue_empty = message_queue.empty();
-            }
-            if (!message_queue_empty) {
-                lws_callback_on_writable(local_data->get_conn());
-            }
-        }
-
-        // Client loop finished for our tid
-        EVLOG_debug << "Exit client loop with ID: " << std::hex << std::this_thread::get_id();
-    }
-}
-
-// Will be called from external threads as well
-bool WebsocketTlsTPM::connect() {
-    if (!this->initialized()) {
         return false;
     }
 
-    EVLOG_info << "Connecting to uri: " << this->connection_options.csms_uri.string() << " with security-profile "
-               << this->connection_options.security_profile
-               << (this->connection_options.use_tpm_tls ? " with TPM keys" : "");
+    return true;
+}
 
+std::shared_ptr<ConnectionData> WebsocketTlsTPM::replace_connection() {
     // new connection context
     std::shared_ptr<ConnectionData> local_data = std::make_shared<ConnectionData>();
     local_data->set_owner(this);
+    local_data->event_loop = this->event_loop;
 
     // Interrupt any previous connection
     std::shared_ptr<ConnectionData> tmp_data = conn_data;
     if (tmp_data != nullptr) {
         tmp_data->do_interrupt();
+
+        if (this->event_loop != nullptr) {
+            detach_connection(tmp_data);
+        }
     }
 
     // use new connection context
@@ -722,11 +1029,11 @@ bool WebsocketTlsTPM::connect() {
 
     if (this->recv_message_thread) {
         // Awake the receiving message thread to finish
-        recv_message_cv.notify_one();
+        wake_recv_loop();
         this->recv_message_thread->join();
     }
 
-    if (this->deferred_callback_thread == nullptr) {
+    if (this->event_loop == nullptr && this->deferred_callback_thread == nullptr) {
         this->deferred_callback_thread =
             std::make_unique<std::thread>(&WebsocketTlsTPM::handle_deferred_callback_queue, this);
     }
@@ -734,15 +1041,11 @@ bool WebsocketTlsTPM::connect() {
     // Stop any pending reconnect timer
     {
         std::lock_guard<std::mutex> lk(this->reconnect_mutex);
-        this->reconnect_timer_tpm.stop();
+        this->stop_reconnect_timer();
     }
 
     // Clear any pending messages on a new connection
-    {
-        std::lock_guard<std::mutex> lock(queue_mutex);
-        std::queue<std::shared_ptr<WebsocketMessage>> empty;
-        empty.swap(message_queue);
-    }
+    drop_queued_messages();
 
     {
         std::lock_guard<std::mutex> lock(recv_mutex);
@@ -750,6 +1053,21 @@ bool WebsocketTlsTPM::connect() {
         empty.swap(recv_message_queue);
     }
 
+    return local_data;
+}
+
+// Will be called from external threads as well
+bool WebsocketTlsTPM::connect() {
+    if (!this->initialized()) {
+        return false;
+    }
+
+    EVLOG_info << "Connecting to uri: " << this->connection_options.csms_uri.string() << " with security-profile "
+               << this->connection_options.security_profile
+               << (this->connection_options.use_tpm_tls ? " with TPM keys" : "");
+
+    std::shared_ptr<ConnectionData> local_data = replace_connection();
+
     // Bind reconnect callback
     this->reconnect_callback = [this]() {
         // close connection before reconnecting
@@ -766,19 +1084,25 @@ bool WebsocketTlsTPM::connect() {
     {
         std::unique_lock<std::mutex> lock(connection_mutex);
 
-        // Release other threads
-        this->websocket_thread.reset(new std::thread(&WebsocketTlsTPM::client_loop, this));
-
-        // TODO(ioan): remove this thread when the fix will be moved into 'MessageQueue'
-        // The reason for having a received message processing thread is that because
-        // if we dispatch a message receive from the client_loop thread, then the callback
-        // will send back another message, and since we're waiting for that message to be
-        // sent over the wire on the client_loop, not giving the opportunity to the loop to
-        // advance we will have a dead-lock
-        this->recv_message_thread.reset(new std::thread(&WebsocketTlsTPM::recv_loop, this));
+        if (this->event_loop != nullptr) {
+            // The connection is created on the service thread of the shared event loop, received messages and
+            // deferred callbacks are dispatched onto its workers instead of our own threads
+            this->event_loop->post([this, local_data]() { this->shared_client_connect(local_data); });
+        } else {
+            // Release other threads
+            this->websocket_thread.reset(new std::thread(&WebsocketTlsTPM::client_loop, this));
+
+            // TODO(ioan): remove this thread when the fix will be moved into 'MessageQueue'
+            // The reason for having a received message processing thread is that because
+            // if we dispatch a message receive from the client_loop thread, then the callback
+            // will send back another message, and since we're waiting for that message to be
+            // sent over the wire on the client_loop, not giving the opportunity to the loop to
+            // advance we will have a dead-lock
+            this->recv_message_thread.reset(new std::thread(&WebsocketTlsTPM::recv_loop, this));
+        }
 
         // Wait until connect or timeout
-        timeouted = !conn_cv.wait_for(lock, std::chrono::seconds(60), [&]() {
+        timeouted = !conn_cv.wait_for(lock, CONNECT_TIMEOUT, [&]() {
             return !local_data->is_connecting() && EConnectionState::INITIALIZE != local_data->get_state();
         });
 
@@ -797,6 +1121,10 @@ bool WebsocketTlsTPM::connect() {
         // Interrupt and drop the connection data
         local_data->do_interrupt();
 
+        if (this->event_loop != nullptr) {
+            detach_connection(local_data);
+        }
+
         // Also interrupt the latest conenction, if it was set by a parallel thread
         auto local = conn_data;
 
@@ -810,6 +1138,44 @@ bool WebsocketTlsTPM::connect() {
     return (connected);
 }
 
+void WebsocketTlsTPM::start_shared_connect() {
+    // close connection before reconnecting
+    if (this->m_is_connected) {
+        this->close(WebsocketCloseReason::AbnormalClose, "before reconnecting");
+    }
+
+    EVLOG_info << "Connecting to uri: " << this->connection_options.csms_uri.string() << " with security-profile "
+               << this->connection_options.security_profile
+               << (this->connection_options.use_tpm_tls ? " with TPM keys" : "");
+
+    std::shared_ptr<ConnectionData> local_data = replace_connection();
+    shared_client_connect(local_data);
+
+    // Nobody waits for the connection, a connection that is neither established nor failed in time is failed by a
+    // timer. A detached connection has no owner any more, its websocket may be gone then
+    std::weak_ptr<ConnectionData> weak_data = local_data;
+    this->event_loop->timeout(
+        [weak_data]() {
+            std::shared_ptr<ConnectionData> data = weak_data.lock();
+            if (data == nullptr) {
+                return;
+            }
+
+            WebsocketTlsTPM* owner = data->get_owner();
+            const auto state = data->get_state();
+            if (owner == nullptr or (state != EConnectionState::INITIALIZE and state != EConnectionState::CONNECTING)) {
+                return;
+            }
+
+            EVLOG_error << "Conn failed with timeout, without disconnect dispatch, dispatching manually.";
+            data->update_state(EConnectionState::ERROR);
+            data->do_interrupt();
+            detach_connection(data);
+            owner->on_conn_fail();
+        },
+        CONNECT_TIMEOUT);
+}
+
 void WebsocketTlsTPM::reconnect(long delay) {
     if (this->shutting_down) {
         EVLOG_info << "Not reconnecting because the websocket is being shutdown.";
@@ -819,21 +1185,73 @@ void WebsocketTlsTPM::reconnect(long delay) {
     EVLOG_info << "Reconnecting in: " << delay << "ms"
                << ", attempt: " << this->connection_attempts;
 
+    {
+        std::lock_guard<std::mutex> lock(this->metrics_mutex);
+        this->metrics.reconnects++;
+    }
+
     if (this->m_is_connected) {
         this->close(WebsocketCloseReason::AbnormalClose, "before reconnecting");
     }
 
     {
         std::lock_guard<std::mutex> lk(this->reconnect_mutex);
-        this->reconnect_timer_tpm.timeout(
-            [this]() {
-                if (this->reconnect_callback) {
-                    this->reconnect_callback();
-                } else {
-                    EVLOG_error << "Invalid reconnect callback!";
-                }
-            },
-            std::chrono::milliseconds(delay));
+        if (this->event_loop != nullptr) {
+            // The timer only starts the connection on the service thread, it is finished by the callbacks of the
+            // connection. No worker of the loop waits for it, so many reconnecting websockets don't stall the others.
+            // The timer is cancelled on the service thread in our destructor, so it can't expire after we're gone
+            this->stop_reconnect_timer();
+            this->reconnect_timer_id =
+                this->event_loop->timeout([this]() { this->start_shared_connect(); }, std::chrono::milliseconds(delay));
+        } else {
+            this->reconnect_timer_tpm->timeout(
+                [this]() {
+                    if (this->reconnect_callback) {
+                        this->reconnect_callback();
+                    } else {
+                        EVLOG_error << "Invalid reconnect callback!";
+                    }
+                },
+                std::chrono::milliseconds(delay));
+        }
+    }
+}
+
+void WebsocketTlsTPM::stop_reconnect_timer() {
+    if (this->event_loop == nullptr) {
+        this->reconnect_timer_tpm->stop();
+        return;
+    }
+
+    if (this->reconnect_timer_id != 0) {
+        this->event_loop->cancel(this->reconnect_timer_id);
+        this->reconnect_timer_id = 0;
+    }
+}
+
+void WebsocketTlsTPM::start_ping_timer(int32_t interval_s) {
+    if (this->event_loop == nullptr) {
+        WebsocketBase::start_ping_timer(interval_s);
+        return;
+    }
+
+    const auto id = this->event_loop->interval(
+        [strand = this->deferred_strand, this]() { strand->post([this]() { this->ping(); }); },
+        std::chrono::seconds(interval_s));
+
+    if (const auto previous = this->ping_timer_id.exchange(id)) {
+        this->event_loop->cancel(previous);
+    }
+}
+
+void WebsocketTlsTPM::stop_ping_timer() {
+    if (this->event_loop == nullptr) {
+        WebsocketBase::stop_ping_timer();
+        return;
+    }
+
+    if (const auto id = this->ping_timer_id.exchange(0)) {
+        this->event_loop->cancel(id);
     }
 }
 
@@ -842,7 +1260,7 @@ void WebsocketTlsTPM::close(const WebsocketCloseReason code, const std::string&
 
     {
         std::lock_guard<std::mutex> lk(this->reconnect_mutex);
-        this->reconnect_timer_tpm.stop();
+        this->stop_reconnect_timer();
     }
 
     std::shared_ptr<ConnectionData> local_data = conn_data;
@@ -850,14 +1268,21 @@ void WebsocketTlsTPM::close(const WebsocketCloseReason code, const std::string&
         // Set the trigger from us
         local_data->request_close();
         local_data->do_interrupt();
+
+        if (this->event_loop != nullptr) {
+            detach_connection(local_data);
+        } else if (local_data->lws_ctx != nullptr) {
+            // Wake the client loop, so that it sees the interruption and closes the connection
+            lws_cancel_service(local_data->lws_ctx.get());
+        }
     }
     // Release the connection data
     conn_data.reset();
 
     this->m_is_connected = false;
 
-    // Notify any message senders that are waiting, since we can't send messages any more
-    msg_send_cv.notify_all();
+    // Messages that are still queued can't be sent any more, this also notifies any waiting senders
+    drop_queued_messages();
 
     // Clear any irrelevant data after a DC
     recv_buffered_message.clear();
@@ -953,6 +1378,44 @@ void WebsocketTlsTPM::on_conn_fail() {
     }
 }
 
+void WebsocketTlsTPM::wake_recv_loop() {
+    {
+        // Taking the lock makes sure that the receiving thread either sees the interruption or is already waiting
+        std::lock_guard<std::mutex> lock(this->recv_mutex);
+    }
+    recv_message_cv.notify_all();
+}
+
+void WebsocketTlsTPM::on_receive(const char* data, size_t len, size_t remaining, bool final_fragment) {
+    if (recv_buffered_message.empty()) {
+        // Start of a new message, reserve the size of the whole frame up front
+        recv_buffered_message = this->recv_buffer_pool->acquire();
+        recv_buffered_message.reserve(len + remaining);
+    } else if (recv_buffered_message.capacity() < recv_buffered_message.size() + len + remaining) {
+        // Next frame of a fragmented message
+        recv_buffered_message.reserve(recv_buffered_message.size() + len + remaining);
+    }
+
+    recv_buffered_message.append(data, len);
+
+    {
+        std::lock_guard<std::mutex> lock(this->metrics_mutex);
+        this->metrics.bytes_received += len;
+        if (remaining == 0) {
+            this->metrics.frames_received++;
+        }
+        if (remaining == 0 && final_fragment) {
+            this->metrics.messages_received++;
+        }
+    }
+
+    // Message is complete
+    if (remaining == 0 && final_fragment) {
+        on_message(std::move(recv_buffered_message));
+        recv_buffered_message.clear();
+    }
+}
+
 void WebsocketTlsTPM::on_message(std::string&& message) {
     if (!this->initialized()) {
         EVLOG_error << "Message received but TLS websocket has not been correctly initialized. Discarding message.";
@@ -961,6 +1424,18 @@ void WebsocketTlsTPM::on_message(std::string&& message) {
 
     EVLOG_debug << "Received message over TLS websocket polling for process: " << message;
 
+    if (this->event_loop != nullptr) {
+        std::shared_ptr<ConnectionData> local_data = conn_data;
+        this->recv_strand->post([this, local_data, message = std::move(message)]() mutable {
+            // Like in the recv loop, messages of an interrupted connection are not processed any more
+            if (local_data != nullptr && !local_data->is_interupted()) {
+                this->message_callback(message);
+            }
+            this->recv_buffer_pool->release(std::move(message));
+        });
+        return;
+    }
+
     {
         std::lock_guard<std::mutex> lock(this->recv_mutex);
         recv_message_queue.push(std::move(message));
@@ -970,47 +1445,29 @@ void WebsocketTlsTPM::on_message(std::string&& message) {
 }
 
 static bool send_internal(lws* wsi, WebsocketMessage* msg) {
-    static std::vector<char> buff;
+    const auto fragment = msg->fragmenter.next();
+    const auto flags = lws_write_ws_flags(msg->protocol, fragment.first, fragment.last);
 
-    std::string& message = msg->payload;
-    size_t message_len = message.length();
-    size_t buff_req_size = message_len + LWS_PRE;
-
-    if (buff.size() < buff_req_size)
-        buff.resize(buff_req_size);
-
-    // Copy data in send buffer
-    memcpy(&buff[LWS_PRE], message.data(), message_len);
-
-    // TODO (ioan): if we require certain sending over the wire,
-    // we'll have to send chunked manually something like this:
-
-    // Ethernet MTU: ~= 1500bytes
-    // size_t BUFF_SIZE = (MTU * 2);
-    // char *buff = alloca(LWS_PRE + BUFF_SIZE);
-    // memcpy(buff, message.data() + already_written, BUFF_SIZE);
-    // int flags = lws_write_ws_flags(proto, is_start, is_end);
-    // already_written += lws_write(wsi, buff + LWS_PRE, BUFF_SIZE - LWS_PRE, flags);
-
-    auto sent = lws_write(wsi, reinterpret_cast<unsigned char*>(&buff[LWS_PRE]), message_len, msg->protocol);
+    // The fragment is written from the message buffer without a copy. libwebsockets writes the frame header into the
+    // LWS_PRE bytes in front of it, which are either the headroom of the buffer or belong to the previous fragment
+    // that libwebsockets has already consumed
+    auto sent =
+        lws_write(wsi, msg->payload() + fragment.offset, fragment.length, static_cast<lws_write_protocol>(flags));
 
     if (sent < 0) {
         // Fatal error, conn closed
         EVLOG_error << "Error sending message over TLS websocket, conn closed.";
-        msg->sent_bytes = 0;
         return false;
     }
 
     // Even if we have written all the bytes to lws, it doesn't mean that it has been sent over
     // the wire. According to the function comment (lws_write), until everything has been
     // sent, the 'LWS_CALLBACK_CLIENT_WRITEABLE' callback will be suppressed. When we received
-    // another callback, it means that everything was sent and that we can mark the message
-    // as certainly 'sent' over the wire
-    msg->sent_bytes = sent;
-
-    if (static_cast<size_t>(sent) < message_len) {
+    // another callback after the last fragment, it means that everything was sent and that we
+    // can mark the message as certainly 'sent' over the wire
+    if (static_cast<size_t>(sent) < fragment.length) {
         EVLOG_error << "Error sending message over TLS websocket. Sent bytes: " << sent
-                    << " Total to send: " << message_len;
+                    << " Total to send: " << fragment.length;
         return false;
     }
 
@@ -1037,7 +1494,7 @@ void WebsocketTlsTPM::on_writable() {
 
     // Execute while we have messages that were polled
     while (true) {
-        WebsocketMessage* message = nullptr;
+        std::shared_ptr<WebsocketMessage> message;
 
         {
             std::lock_guard<std::mutex> lock(this->queue_mutex);
@@ -1046,78 +1503,102 @@ void WebsocketTlsTPM::on_writable() {
             if (message_queue.empty())
                 break;
 
-            message = message_queue.front().get();
+            message = message_queue.front();
         }
 
         if (message == nullptr) {
             EVLOG_AND_THROW(std::runtime_error("Null message in queue, fatal error!"));
         }
 
-        // This message was polled in a previous iteration
-        if (message->sent_bytes >= message->payload.length()) {
+        // All fragments of this message were polled in a previous iteration
+        if (message->fragmenter.done()) {
             EVLOG_debug << "Websocket message fully written, popping processing thread from queue!";
 
             // If we have written all bytes to libwebsockets it means that if we received
             // this writable callback everything is sent over the wire, mark the message
-            // as 'sent' and remove it from the queue
-            {
-                std::lock_guard<std::mutex> lock(this->queue_mutex);
-                message->message_sent = true;
-                message_queue.pop();
+            // as 'sent' and remove it from the queue. If the queue was dropped in the meantime
+            // the message has already been completed as dropped
+            if (!remove_queued_message(message)) {
+                break;
             }
 
             EVLOG_debug << "Notifying waiting thread!";
-            // Notify any waiting thread to check it's state
-            msg_send_cv.notify_all();
+            complete_message(message, true);
         } else {
             // If the message was not polled, we reached the first unpolled and break
             break;
         }
     }
 
-    // If we still have message ONLY poll a single one that can be processed in the invoke of the function
+    // If we still have message ONLY poll a single fragment that can be processed in the invoke of the function
     // libwebsockets is designed so that when a message is sent to the wire from the internal buffer it
-    // will invoke 'on_writable' again and we can execute the code above
-    bool any_message_polled;
+    // will invoke 'on_writable' again and we can execute the code above. Pings are queued in front of the
+    // other messages, so they are written between the fragments of a large message
+    std::shared_ptr<WebsocketMessage> message;
     {
+        // The queue can be dropped by close() in the meantime, keep the message alive while writing it
         std::lock_guard<std::mutex> lock(this->queue_mutex);
-        any_message_polled = not message_queue.empty();
+        if (message_queue.empty()) {
+            return;
+        }
+        message = message_queue.front();
     }
 
-    // Poll a single message
-    if (any_message_polled) {
-        EVLOG_debug << "Client writable, sending message part!";
+    EVLOG_debug << "Client writable, sending message part!";
 
-        WebsocketMessage* message = nullptr;
+    if (message == nullptr) {
+        EVLOG_AND_THROW(std::runtime_error("Null message in queue, fatal error!"));
+    }
 
-        {
-            std::lock_guard<std::mutex> lock(this->queue_mutex);
-            message = message_queue.front().get();
-        }
+    if (message->fragmenter.done()) {
+        EVLOG_AND_THROW(std::runtime_error("Already polled message should be handled above, fatal error!"));
+    }
 
-        if (message == nullptr) {
-            EVLOG_AND_THROW(std::runtime_error("Null message in queue, fatal error!"));
-        }
+    // Continue sending the next fragment, for a single message only
+    const auto written_before = message->fragmenter.get_written();
+    bool sent = send_internal(local_data->get_conn(), message.get());
 
-        if (message->sent_bytes >= message->payload.length()) {
-            EVLOG_AND_THROW(std::runtime_error("Already polled message should be handled above, fatal error!"));
+    if (sent) {
+        const auto now = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(this->metrics_mutex);
+        this->metrics.frames_sent++;
+        this->metrics.bytes_sent += message->fragmenter.get_written() - written_before;
+        this->metrics.frame_queue_time.record(now - message->frame_ready_at);
+        message->frame_ready_at = now;
+
+        if (message->protocol == LWS_WRITE_PING) {
+            this->ping_written_at = now;
         }
+    }
 
-        // Continue sending message part, for a single message only
-        bool sent = send_internal(local_data->get_conn(), message);
+    // libwebsockets masks the payload in place, so a message that failed can't be written again
+    if (!sent and remove_queued_message(message)) {
+        complete_message(message, false);
+    }
+}
 
-        // If we failed, attempt again later
-        if (!sent) {
-            message->sent_bytes = 0;
-        }
+bool WebsocketTlsTPM::remove_queued_message(const std::shared_ptr<WebsocketMessage>& msg) {
+    std::lock_guard<std::mutex> lock(this->queue_mutex);
+    const auto it = std::find(message_queue.begin(), message_queue.end(), msg);
+    if (it == message_queue.end()) {
+        return false;
     }
+    message_queue.erase(it);
+    return true;
 }
 
 void WebsocketTlsTPM::request_write() {
     std::shared_ptr<ConnectionData> local_data = conn_data;
     if (this->m_is_connected) {
         if (local_data != nullptr) {
-            if (local_data->get_conn()) {
+            if (local_data->get_conn() && this->event_loop != nullptr) {
+                // The shared context is not thread safe, the write is requested from its service thread
+                this->event_loop->post([local_data]() {
+                    if (lws* wsi = local_data->get_conn()) {
+                        lws_callback_on_writable(wsi);
+                    }
+                });
+            } else if (local_data->get_conn()) {
                 // Notify waiting processing thread to wake up. According to docs it is ok to call from another
                 // thread.
                 lws_cancel_service(local_data->lws_ctx.get());
@@ -1128,46 +1609,89 @@ void WebsocketTlsTPM::request_write() {
     }
 }
 
-void WebsocketTlsTPM::poll_message(const std::shared_ptr<WebsocketMessage>& msg) {
+bool WebsocketTlsTPM::queue_message(const std::shared_ptr<WebsocketMessage>& msg) {
     if (this->m_is_connected == false) {
-        EVLOG_debug << "Trying to poll message without being connected!";
-        return;
+        EVLOG_debug << "Trying to queue message without being connected!";
+        return false;
     }
 
     std::shared_ptr<ConnectionData> local_data = conn_data;
 
-    if (local_data != nullptr) {
-        auto cd_tid = local_data->get_lws_thread_id();
-
-        if (std::this_thread::get_id() == cd_tid) {
-            EVLOG_AND_THROW(std::runtime_error("Deadlock detected, polling send from client lws thread!"));
-        }
-
-        // If we are interupted or finalized
-        if (local_data->is_interupted() || local_data->get_state() == EConnectionState::FINALIZED) {
-            EVLOG_warning << "Trying to poll message to interrupted/finalized state!";
-            return;
-        }
+    // If we are interupted or finalized
+    if (local_data != nullptr &&
+        (local_data->is_interupted() || local_data->get_state() == EConnectionState::FINALIZED)) {
+        EVLOG_warning << "Trying to queue message to interrupted/finalized state!";
+        return false;
     }
 
-    EVLOG_debug << "Queueing message over TLS websocket: " << msg->payload;
+    EVLOG_debug << "Queueing message over TLS websocket: " << msg->payload_view();
 
     {
         std::lock_guard<std::mutex> lock(this->queue_mutex);
-        message_queue.emplace(msg);
+        // Only data frames are fragmented, control frames may be sent between the fragments of a message
+        msg->queued_at = std::chrono::steady_clock::now();
+        msg->frame_ready_at = msg->queued_at;
+        if (msg->protocol == LWS_WRITE_PING) {
+            msg->fragmenter = WebsocketFragmenter(msg->payload_length(), 0);
+            message_queue.emplace_front(msg);
+        } else {
+            const auto max_queue_size = this->connection_options.max_send_queue_size;
+            if (max_queue_size > 0 and message_queue.size() >= max_queue_size) {
+                EVLOG_warning << "Rejecting message, " << message_queue.size()
+                              << " messages are queued over TLS websocket and not written yet";
+                std::lock_guard<std::mutex> metrics_lock(this->metrics_mutex);
+                this->metrics.messages_rejected++;
+                return false;
+            }
+            msg->fragmenter = WebsocketFragmenter(msg->payload_length(), this->connection_options.max_fragment_size);
+            message_queue.emplace_back(msg);
+        }
     }
 
     // Request a write callback
     request_write();
 
+    return true;
+}
+
+void WebsocketTlsTPM::complete_message(const std::shared_ptr<WebsocketMessage>& msg, bool sent) {
+    if (msg->protocol != LWS_WRITE_PING) {
+        std::lock_guard<std::mutex> lock(this->metrics_mutex);
+        if (sent) {
+            this->metrics.messages_sent++;
+            this->metrics.write_completion_time.record(std::chrono::steady_clock::now() - msg->queued_at);
+        } else {
+            this->metrics.messages_dropped++;
+        }
+    }
+
     {
-        std::unique_lock lock(this->msg_send_cv_mutex);
-        if (msg_send_cv.wait_for(lock, std::chrono::seconds(20), [&] { return (true == msg->message_sent); })) {
-            EVLOG_debug << "Successfully sent last message over TLS websocket!";
+        // Take the lock so that a sender can't miss the notification between checking and waiting
+        std::lock_guard<std::mutex> lock(this->msg_send_cv_mutex);
+        if (sent) {
+            msg->message_sent = true;
         } else {
-            EVLOG_warning << "Could not send last message over TLS websocket!";
+            msg->message_dropped = true;
         }
     }
+    msg_send_cv.notify_all();
+
+    if (msg->on_sent) {
+        // Dispatched from the deferred thread since the callback may queue the next message
+        this->push_deferred_callback([on_sent = std::move(msg->on_sent), sent]() { on_sent(sent); });
+    }
+}
+
+void WebsocketTlsTPM::drop_queued_messages() {
+    std::deque<std::shared_ptr<WebsocketMessage>> dropped;
+    {
+        std::lock_guard<std::mutex> lock(this->queue_mutex);
+        dropped.swap(message_queue);
+    }
+
+    for (const auto& msg : dropped) {
+        complete_message(msg, false);
+    }
 }
 
 // Will be called from external threads
@@ -1177,25 +1701,89 @@ bool WebsocketTlsTPM::send(const std::string& message) {
         return false;
     }
 
-    auto msg = std::make_shared<WebsocketMessage>();
-    msg->payload = std::move(message);
-    msg->protocol = LWS_WRITE_TEXT;
+    std::shared_ptr<ConnectionData> local_data = conn_data;
+    if (local_data != nullptr && std::this_thread::get_id() == local_data->get_lws_thread_id()) {
+        EVLOG_AND_THROW(std::runtime_error("Deadlock detected, polling send from client lws thread!"));
+    }
 
-    poll_message(msg);
+    auto msg = make_message(this->send_buffer_pool, message, LWS_WRITE_TEXT);
+
+    if (!queue_message(msg)) {
+        return false;
+    }
+
+    std::unique_lock lock(this->msg_send_cv_mutex);
+    const auto completed =
+        msg_send_cv.wait_for(lock, std::chrono::seconds(20), [&] { return msg->message_sent || msg->message_dropped; });
+    if (completed and msg->message_sent) {
+        EVLOG_debug << "Successfully sent last message over TLS websocket!";
+    } else {
+        EVLOG_warning << "Could not send last message over TLS websocket!";
+    }
 
     return msg->message_sent;
 }
 
+// Will be called from external threads, never waits for the lws thread
+bool WebsocketTlsTPM::send_async(const std::string& message, const std::function<void(bool sent)>& on_sent) {
+    if (!this->initialized()) {
+        EVLOG_error << "Could not send message because websocket is not properly initialized.";
+        return false;
+    }
+
+    auto msg = make_message(this->send_buffer_pool, message, LWS_WRITE_TEXT);
+    msg->on_sent = on_sent;
+
+    return queue_message(msg);
+}
+
+// Will be called from external threads, never waits for the lws thread
+bool WebsocketTlsTPM::send_async(const std::function<void(JsonWriter& writer)>& write,
+                                 const std::function<void(bool sent)>& on_sent) {
+    if (!this->initialized()) {
+        EVLOG_error << "Could not send message because websocket is not properly initialized.";
+        return false;
+    }
+
+    // The message is written behind the headroom libwebsockets needs for the frame header
+    JsonWriter writer(this->send_buffer_pool->acquire(), LWS_PRE);
+    write(writer);
+
+    auto msg = std::make_shared<WebsocketMessage>(this->send_buffer_pool);
+    msg->buffer = writer.release();
+    msg->protocol = LWS_WRITE_TEXT;
+    msg->on_sent = on_sent;
+
+    return queue_message(msg);
+}
+
+WebsocketCompressionStats WebsocketTlsTPM::get_compression_stats() {
+    WebsocketCompressionStats stats;
+    std::shared_ptr<ConnectionData> local_data = conn_data;
+    if (local_data != nullptr) {
+        stats.negotiated = local_data->compression_negotiated;
+        stats.tx_payload_bytes = local_data->tx_payload_bytes;
+        stats.tx_compressed_bytes = local_data->tx_compressed_bytes;
+        stats.rx_payload_bytes = local_data->rx_payload_bytes;
+        stats.rx_compressed_bytes = local_data->rx_compressed_bytes;
+    }
+    return stats;
+}
+
+size_t WebsocketTlsTPM::get_send_queue_depth() {
+    std::lock_guard<std::mutex> lock(this->queue_mutex);
+    return message_queue.size();
+}
+
 void WebsocketTlsTPM::ping() {
     if (!this->initialized()) {
         EVLOG_error << "Could not send ping because websocket is not properly initialized.";
     }
 
-    auto msg = std::make_shared<WebsocketMessage>();
-    msg->payload = this->connection_options.ping_payload;
-    msg->protocol = LWS_WRITE_PING;
+    auto msg = make_message(this->send_buffer_pool, this->connection_options.ping_payload, LWS_WRITE_PING);
 
-    poll_message(msg);
+    // A ping does not need to wait until it has been written, a missing pong is detected by the pong timeout
+    queue_message(msg);
 }
 
 int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void* user, void* in, size_t len) {
@@ -1289,7 +1877,7 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
         EVLOG_error << "CLIENT_CONNECTION_ERROR: " << (in ? reinterpret_cast<char*>(in) : "(null)");
         ERR_print_errors_fp(stderr);
 
-        if (data->get_state() == EConnectionState::CONNECTING) {
+        if (data->get_state() == EConnectionState::INITIALIZE or data->is_connecting()) {
             data->update_state(EConnectionState::ERROR);
             conn_cv.notify_one();
         }
@@ -1308,6 +1896,31 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
             conn_cv.notify_one();
         }
 
+        {
+            // Includes the TCP connect, the TLS handshake and the websocket handshake
+            std::lock_guard<std::mutex> lock(this->metrics_mutex);
+            this->metrics.time_to_connect.record(std::chrono::steady_clock::now() - data->connect_started_at);
+
+            if (SSL* ssl = lws_get_ssl(wsi)) {
+                this->metrics.tls_handshakes++;
+                if (SSL_session_reused(ssl) == 1) {
+                    this->metrics.tls_resumed_handshakes++;
+                    EVLOG_info << "Resumed TLS session, skipped the full handshake";
+                }
+            }
+        }
+
+        if (this->connection_options.enable_compression) {
+            if (data->compression_negotiated) {
+                // Has to be set before the first message is compressed
+                const auto level = std::to_string(std::clamp(this->connection_options.compression_level, 1, 9));
+                lws_set_extension_option(wsi, "permessage-deflate", "compression_level", level.c_str());
+                EVLOG_info << "Websocket compression with permessage-deflate negotiated";
+            } else {
+                EVLOG_info << "CSMS did not accept websocket compression, the connection is not compressed";
+            }
+        }
+
         on_conn_connected();
 
         // Attempt first write after connection
@@ -1366,6 +1979,12 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
         break;
 
     case LWS_CALLBACK_CLIENT_RECEIVE_PONG: {
+        if (this->ping_written_at.has_value()) {
+            std::lock_guard<std::mutex> lock(this->metrics_mutex);
+            this->metrics.ping_rtt.record(std::chrono::steady_clock::now() - this->ping_written_at.value());
+            this->ping_written_at.reset();
+        }
+
         bool message_queue_empty;
         {
             std::lock_guard<std::mutex> lock(this->queue_mutex);
@@ -1377,13 +1996,7 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
     } break;
 
     case LWS_CALLBACK_CLIENT_RECEIVE:
-        recv_buffered_message.append(reinterpret_cast<char*>(in), reinterpret_cast<char*>(in) + len);
-
-        // Message is complete
-        if (lws_remaining_packet_payload(wsi) <= 0) {
-            on_message(std::move(recv_buffered_message));
-            recv_buffered_message.clear();
-        }
+        on_receive(reinterpret_cast<char*>(in), len, lws_remaining_packet_payload(wsi), lws_is_final_fragment(wsi));
 
         {
             bool message_queue_empty;
@@ -1403,7 +2016,7 @@ int WebsocketTlsTPM::process_callback(void* wsi_ptr, int callback_reason, void*
             std::lock_guard<std::mutex> lock(this->queue_mutex);
             message_queue_empty = message_queue.empty();
         }
-        if (false == message_queue_empty) {
+        if (false == message_queue_empty && data->get_conn() != nullptr) {
             lws_callback_on_writable(data->get_conn());
         }
     } break;
@@ -1434,6 +2047,11 @@ void WebsocketTlsTPM::push_deferred_callback(const std::function<void()>& callba
         return;
     }
 
+    if (this->deferred_strand != nullptr) {
+        this->deferred_strand->post(callback);
+        return;
+    }
+
     std::scoped_lock tmp_lock(this->deferred_callback_mutex);
     this->deferred_callback_queue.push(callback);
     this->deferred_callback_cv.notify_one();
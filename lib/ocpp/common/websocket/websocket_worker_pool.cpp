@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/common/websocket/websocket_worker_pool.hpp>
+
+#include <algorithm>
+
+#include <everest/logging.hpp>
+
+namespace ocpp {
+
+struct WebsocketWorkerPool::TaskQueue {
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool stopped = false;
+};
+
+WebsocketWorkerPool::WebsocketWorkerPool(size_t worker_count) : queue(std::make_shared<TaskQueue>()) {
+    worker_count = std::max<size_t>(worker_count, 1);
+    this->workers.reserve(worker_count);
+    for (size_t i = 0; i < worker_count; i++) {
+        this->workers.emplace_back(&WebsocketWorkerPool::run, this->queue);
+    }
+}
+
+WebsocketWorkerPool::~WebsocketWorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(this->queue->mutex);
+        this->queue->stopped = true;
+    }
+    this->queue->cv.notify_all();
+
+    for (auto& worker : this->workers) {
+        if (worker.get_id() == std::this_thread::get_id()) {
+            // Released from one of our own tasks, this worker exits on its own once the queue is empty
+            worker.detach();
+        } else {
+            worker.join();
+        }
+    }
+}
+
+void WebsocketWorkerPool::post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(this->queue->mutex);
+        this->queue->tasks.push_back(std::move(task));
+    }
+    this->queue->cv.notify_one();
+}
+
+size_t WebsocketWorkerPool::get_worker_count() const {
+    return this->workers.size();
+}
+
+void WebsocketWorkerPool::run(const std::shared_ptr<TaskQueue>& queue) {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(queue->mutex);
+            queue->cv.wait(lock, [&queue]() { return !queue->tasks.empty() or queue->stopped; });
+
+            if (queue->tasks.empty()) {
+                break;
+            }
+
+            task = std::move(queue->tasks.front());
+            queue->tasks.pop_front();
+        }
+
+        // Run outside of the lock, the task may post other tasks
+        try {
+            task();
+        } catch (const std::exception& e) {
+            EVLOG_error << "Exception in websocket worker task: " << e.what();
+        }
+    }
+}
+
+WebsocketStrand::WebsocketStrand(const std::shared_ptr<WebsocketWorkerPool>& pool) :
+    pool(pool), scheduled(false), stopped(false) {
+}
+
+bool WebsocketStrand::post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(this->tasks_mutex);
+        if (this->stopped) {
+            return false;
+        }
+
+        this->tasks.push_back(std::move(task));
+
+        // A strand is scheduled on the pool at most once, the scheduled run picks up this task as well
+        if (this->scheduled) {
+            return true;
+        }
+        this->scheduled = true;
+    }
+
+    this->schedule();
+    return true;
+}
+
+void WebsocketStrand::stop() {
+    std::unique_lock<std::mutex> lock(this->tasks_mutex);
+    this->stopped = true;
+
+    if (this->running_thread == std::this_thread::get_id()) {
+        // Stopped from one of our own tasks, which can't be waited for. The remaining tasks are dropped
+        this->tasks.clear();
+        return;
+    }
+
+    this->idle_cv.wait(lock, [this]() { return !this->scheduled; });
+}
+
+void WebsocketStrand::run() {
+    for (size_t i = 0; i < MAX_TASKS_PER_BATCH; i++) {
+        std::function<void()> task;
+        {
+            std::lock_guard<std::mutex> lock(this->tasks_mutex);
+            if (this->tasks.empty()) {
+                this->scheduled = false;
+                this->running_thread = std::thread::id();
+                this->idle_cv.notify_all();
+                return;
+            }
+
+            task = std::move(this->tasks.front());
+            this->tasks.pop_front();
+            this->running_thread = std::this_thread::get_id();
+        }
+
+        try {
+            task();
+        } catch (const std::exception& e) {
+            EVLOG_error << "Exception in websocket strand task: " << e.what();
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->tasks_mutex);
+        this->running_thread = std::thread::id();
+    }
+
+    // More tasks are left, continue after the tasks of the other strands that were posted in the meantime
+    this->schedule();
+}
+
+void WebsocketStrand::schedule() {
+    if (auto locked_pool = this->pool.lock()) {
+        locked_pool->post([self = this->shared_from_this()]() { self->run(); });
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(this->tasks_mutex);
+    this->tasks.clear();
+    this->scheduled = false;
+    this->idle_cv.notify_all();
+}
+
+} // namespace ocpp
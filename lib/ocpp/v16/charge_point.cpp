@@ -42,6 +42,10 @@ void ChargePoint::disconnect_websocket() {
     this->charge_point->disconnect_websocket();
 }
 
+WebsocketMetrics ChargePoint::get_websocket_metrics() {
+    return this->charge_point->get_websocket_metrics();
+}
+
 void ChargePoint::call_set_connection_timeout() {
     this->charge_point->call_set_connection_timeout();
 }
@@ -350,6 +354,11 @@ void ChargePoint::register_set_display_message_callback(
     this->charge_point->register_set_display_message_callback(set_display_message_callback);
 }
 
+void ChargePoint::register_message_queue_replay_progress_callback(
+    const std::function<void(const ReplayProgress& progress)>& callback) {
+    this->charge_point->register_message_queue_replay_progress_callback(callback);
+}
+
 void ChargePoint::set_message_queue_resume_delay(std::chrono::seconds delay) {
     this->charge_point->set_message_queue_resume_delay(delay);
 }
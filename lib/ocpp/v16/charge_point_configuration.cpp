@@ -4,6 +4,7 @@
 #include <future>
 #include <mutex>
 
+#include <boost/algorithm/string/case_conv.hpp>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -16,6 +17,15 @@
 namespace ocpp {
 namespace v16 {
 
+namespace {
+
+/// \brief Configuration keys are case insensitive, they are indexed by their lower case key
+std::string to_lower_case_key(const std::string& key) {
+    return boost::algorithm::to_lower_copy(key);
+}
+
+} // namespace
+
 ChargePointConfiguration::ChargePointConfiguration(const std::string& config, const fs::path& ocpp_main_path,
                                                    const fs::path& user_config_path) {
 
@@ -58,6 +68,9 @@ ChargePointConfiguration::ChargePointConfiguration(const std::string& config, co
         EVLOG_AND_THROW(e);
     }
 
+    this->user_config_persister = std::make_unique<UserConfigPersister>(
+        this->user_config_path, std::chrono::milliseconds(this->getUserConfigWriteDelay()));
+
     if (!this->config["Core"].contains("SupportedFeatureProfiles")) {
         throw std::runtime_error("SupportedFeatureProfiles key is missing from config");
     }
@@ -176,26 +189,23 @@ ChargePointConfiguration::ChargePointConfiguration(const std::string& config, co
     this->supported_message_types_receiving.insert(MessageType::GetLocalListVersion);
     this->supported_message_types_receiving.insert(MessageType::SendLocalList);
     this->supported_message_types_receiving.insert(MessageType::ReserveNow);
-}
 
-json ChargePointConfiguration::get_user_config() {
-    if (fs::exists(this->user_config_path)) {
-        // reading from and overriding to existing user config
-        std::fstream ifs(user_config_path.c_str());
-        std::string user_config_file((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
-        ifs.close();
-        return json::parse(user_config_file);
-    }
+    this->init_key_value_getters();
 
-    return json({}, true);
+    this->clock_aligned_data_interval = this->config["Core"]["ClockAlignedDataInterval"];
+    this->meter_value_sample_interval = this->config["Core"]["MeterValueSampleInterval"];
+    this->meter_values_aligned_data =
+        this->csv_to_measurand_with_phase_vector(this->config["Core"]["MeterValuesAlignedData"]);
+    this->meter_values_sampled_data =
+        this->csv_to_measurand_with_phase_vector(this->config["Core"]["MeterValuesSampledData"]);
 }
 
 void ChargePointConfiguration::setInUserConfig(std::string profile, std::string key, const json value) {
-    json user_config = this->get_user_config();
-    user_config[profile][key] = value;
-    std::ofstream ofs(this->user_config_path.c_str());
-    ofs << user_config << std::endl;
-    ofs.close();
+    this->user_config_persister->set(profile, key, value);
+}
+
+bool ChargePointConfiguration::flush_user_config() {
+    return this->user_config_persister->flush();
 }
 
 std::string to_csl(const std::vector<std::string>& vec) {
@@ -337,6 +347,18 @@ uint64_t ChargePointConfiguration::getLogRotationMaximumFileCount() {
     return this->config["Internal"]["LogRotationMaximumFileCount"];
 }
 
+bool ChargePointConfiguration::getLogRotationCompress() {
+    return this->config["Internal"]["LogRotationCompress"];
+}
+
+uint64_t ChargePointConfiguration::getLogMessagesQueueSize() {
+    return this->config["Internal"]["LogMessagesQueueSize"];
+}
+
+std::string ChargePointConfiguration::getLogMessagesQueueFullPolicy() {
+    return this->config["Internal"]["LogMessagesQueueFullPolicy"];
+}
+
 std::vector<ChargingProfilePurposeType> ChargePointConfiguration::getSupportedChargingProfilePurposeTypes() {
     std::vector<ChargingProfilePurposeType> supported_purpose_types;
     const auto str_list = this->config["Internal"]["SupportedChargingProfilePurposeTypes"];
@@ -644,6 +666,50 @@ std::string ChargePointConfiguration::getTLSKeylogFile() {
     return this->config["Internal"]["TLSKeylogFile"];
 }
 
+int ChargePointConfiguration::getWebsocketMaxFragmentSize() {
+    return this->config["Internal"]["WebsocketMaxFragmentSize"];
+}
+
+int ChargePointConfiguration::getWebsocketMaxSendQueueSize() {
+    return this->config["Internal"]["WebsocketMaxSendQueueSize"];
+}
+
+bool ChargePointConfiguration::getWebsocketCompression() {
+    return this->config["Internal"]["WebsocketCompression"];
+}
+
+int ChargePointConfiguration::getWebsocketCompressionWindowBits() {
+    return this->config["Internal"]["WebsocketCompressionWindowBits"];
+}
+
+int ChargePointConfiguration::getWebsocketCompressionLevel() {
+    return this->config["Internal"]["WebsocketCompressionLevel"];
+}
+
+bool ChargePointConfiguration::getWebsocketSharedEventLoop() {
+    return this->config["Internal"]["WebsocketSharedEventLoop"];
+}
+
+int ChargePointConfiguration::getWebsocketSharedEventLoopWorkers() {
+    return this->config["Internal"]["WebsocketSharedEventLoopWorkers"];
+}
+
+bool ChargePointConfiguration::getTLSSessionResumption() {
+    return this->config["Internal"]["TLSSessionResumption"];
+}
+
+std::optional<std::string> ChargePointConfiguration::getTLSSessionCacheFile() {
+    std::optional<std::string> tls_session_cache_file = std::nullopt;
+    if (this->config["Internal"].contains("TLSSessionCacheFile")) {
+        tls_session_cache_file.emplace(this->config["Internal"]["TLSSessionCacheFile"]);
+    }
+    return tls_session_cache_file;
+}
+
+int32_t ChargePointConfiguration::getUserConfigWriteDelay() {
+    return this->config["Internal"]["UserConfigWriteDelay"];
+}
+
 KeyValue ChargePointConfiguration::getWebsocketPingPayloadKeyValue() {
     KeyValue kv;
     kv.key = "WebsocketPingPayload";
@@ -905,6 +971,14 @@ std::optional<KeyValue> ChargePointConfiguration::getMessageQueueSizeThresholdKe
     return message_queue_size_threshold_kv;
 }
 
+int ChargePointConfiguration::getMessageQueueReplayWindow() {
+    return this->config["Internal"]["MessageQueueReplayWindow"];
+}
+
+std::string ChargePointConfiguration::getDatabaseTuning() {
+    return this->config["Internal"]["DatabaseTuning"];
+}
+
 // Core Profile - optional
 std::optional<bool> ChargePointConfiguration::getAllowOfflineTxForUnknownId() {
     std::optional<bool> unknown_offline_auth = std::nullopt;
@@ -1004,10 +1078,12 @@ std::optional<KeyValue> ChargePointConfiguration::getBlinkRepeatKeyValue() {
 
 // Core Profile
 int32_t ChargePointConfiguration::getClockAlignedDataInterval() {
-    return this->config["Core"]["ClockAlignedDataInterval"];
+    return this->clock_aligned_data_interval;
 }
 void ChargePointConfiguration::setClockAlignedDataInterval(int32_t interval) {
+    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
     this->config["Core"]["ClockAlignedDataInterval"] = interval;
+    this->clock_aligned_data_interval = interval;
     this->setInUserConfig("Core", "ClockAlignedDataInterval", interval);
 }
 KeyValue ChargePointConfiguration::getClockAlignedDataIntervalKeyValue() {
@@ -1193,7 +1269,9 @@ bool ChargePointConfiguration::setMeterValuesAlignedData(std::string meter_value
     if (!this->measurands_supported(meter_values_aligned_data)) {
         return false;
     }
+    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
     this->config["Core"]["MeterValuesAlignedData"] = meter_values_aligned_data;
+    this->meter_values_aligned_data = this->csv_to_measurand_with_phase_vector(meter_values_aligned_data);
     this->setInUserConfig("Core", "MeterValuesAlignedData", meter_values_aligned_data);
     return true;
 }
@@ -1205,7 +1283,8 @@ KeyValue ChargePointConfiguration::getMeterValuesAlignedDataKeyValue() {
     return kv;
 }
 std::vector<MeasurandWithPhase> ChargePointConfiguration::getMeterValuesAlignedDataVector() {
-    return this->csv_to_measurand_with_phase_vector(this->getMeterValuesAlignedData());
+    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+    return this->meter_values_aligned_data;
 }
 
 // Core Profile - optional
@@ -1237,7 +1316,9 @@ bool ChargePointConfiguration::setMeterValuesSampledData(std::string meter_value
     if (!this->measurands_supported(meter_values_sampled_data)) {
         return false;
     }
+    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
     this->config["Core"]["MeterValuesSampledData"] = meter_values_sampled_data;
+    this->meter_values_sampled_data = this->csv_to_measurand_with_phase_vector(meter_values_sampled_data);
     this->setInUserConfig("Core", "MeterValuesSampledData", meter_values_sampled_data);
     return true;
 }
@@ -1249,7 +1330,8 @@ KeyValue ChargePointConfiguration::getMeterValuesSampledDataKeyValue() {
     return kv;
 }
 std::vector<MeasurandWithPhase> ChargePointConfiguration::getMeterValuesSampledDataVector() {
-    return this->csv_to_measurand_with_phase_vector(this->getMeterValuesSampledData());
+    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+    return this->meter_values_sampled_data;
 }
 
 // Core Profile - optional
@@ -1275,10 +1357,12 @@ std::optional<KeyValue> ChargePointConfiguration::getMeterValuesSampledDataMaxLe
 
 // Core Profile
 int32_t ChargePointConfiguration::getMeterValueSampleInterval() {
-    return this->config["Core"]["MeterValueSampleInterval"];
+    return this->meter_value_sample_interval;
 }
 void ChargePointConfiguration::setMeterValueSampleInterval(int32_t interval) {
+    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
     this->config["Core"]["MeterValueSampleInterval"] = interval;
+    this->meter_value_sample_interval = interval;
     this->setInUserConfig("Core", "MeterValueSampleInterval", interval);
 }
 KeyValue ChargePointConfiguration::getMeterValueSampleIntervalKeyValue() {
@@ -2777,309 +2861,172 @@ ConfigurationStatus ChargePointConfiguration::setCustomKey(CiString<50> key, CiS
     return ConfigurationStatus::Accepted;
 }
 
-std::optional<KeyValue> ChargePointConfiguration::get(CiString<50> key) {
-    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
-    // Internal Profile
-    if (key == "ChargePointId") {
-        return this->getChargePointIdKeyValue();
-    }
-    if (key == "CentralSystemURI") {
-        return this->getCentralSystemURIKeyValue();
-    }
-    if (key == "ChargeBoxSerialNumber") {
-        return this->getChargeBoxSerialNumberKeyValue();
-    }
-    if (key == "ChargePointModel") {
-        return this->getChargePointModelKeyValue();
-    }
-    if (key == "ChargePointSerialNumber") {
-        return this->getChargePointSerialNumberKeyValue();
-    }
-    if (key == "ChargePointVendor") {
-        return this->getChargePointVendorKeyValue();
-    }
-    if (key == "FirmwareVersion") {
-        return this->getFirmwareVersionKeyValue();
-    }
-    if (key == "ICCID") {
-        return this->getICCIDKeyValue();
-    }
-    if (key == "IMSI") {
-        return this->getIMSIKeyValue();
-    }
-    if (key == "MeterSerialNumber") {
-        return this->getMeterSerialNumberKeyValue();
-    }
-    if (key == "MeterType") {
-        return this->getMeterTypeKeyValue();
-    }
-    if (key == "SupportedCiphers12") {
-        return this->getSupportedCiphers12KeyValue();
-    }
-    if (key == "SupportedCiphers13") {
-        return this->getSupportedCiphers13KeyValue();
-    }
-    if (key == "RetryBackoffRandomRange") {
-        return this->getRetryBackoffRandomRangeKeyValue();
-    }
-    if (key == "RetryBackoffRepeatTimes") {
-        return this->getRetryBackoffRepeatTimesKeyValue();
-    }
-    if (key == "RetryBackoffWaitMinimum") {
-        return this->getRetryBackoffWaitMinimumKeyValue();
-    }
-    if (key == "AuthorizeConnectorZeroOnConnectorOne") {
-        return this->getAuthorizeConnectorZeroOnConnectorOneKeyValue();
-    }
-    if (key == "LogMessages") {
-        return this->getLogMessagesKeyValue();
-    }
-    if (key == "LogMessagesFormat") {
-        return this->getLogMessagesFormatKeyValue();
-    }
-    if (key == "SupportedChargingProfilePurposeTypes") {
-        return this->getSupportedChargingProfilePurposeTypesKeyValue();
-    }
-    if (key == "MaxCompositeScheduleDuration") {
-        return this->getMaxCompositeScheduleDurationKeyValue();
-    }
-    if (key == "WebsocketPingPayload") {
-        return this->getWebsocketPingPayloadKeyValue();
-    }
-    if (key == "WebsocketPongTimeout") {
-        return this->getWebsocketPongTimeoutKeyValue();
-    }
-    if (key == "UseSslDefaultVerifyPaths") {
-        return this->getUseSslDefaultVerifyPathsKeyValue();
-    }
-    if (key == "VerifyCsmsCommonName") {
-        return this->getVerifyCsmsCommonNameKeyValue();
-    }
-    if (key == "VerifyCsmsAllowWildcards") {
-        return this->getVerifyCsmsAllowWildcardsKeyValue();
-    }
-    if (key == "OcspRequestInterval") {
-        return this->getOcspRequestIntervalKeyValue();
-    }
-    if (key == "SeccLeafSubjectCommonName") {
-        return this->getSeccLeafSubjectCommonNameKeyValue();
-    }
-    if (key == "SeccLeafSubjectCountry") {
-        return this->getSeccLeafSubjectCountryKeyValue();
-    }
-    if (key == "SeccLeafSubjectOrganization") {
-        return this->getSeccLeafSubjectOrganizationKeyValue();
-    }
-    if (key == "ConnectorEvseIds") {
-        return this->getConnectorEvseIdsKeyValue();
-    }
-    if (key == "AllowChargingProfileWithoutStartSchedule") {
-        return this->getAllowChargingProfileWithoutStartScheduleKeyValue();
-    }
-    if (key == "WaitForStopTransactionsOnResetTimeout") {
-        return this->getWaitForStopTransactionsOnResetTimeoutKeyValue();
-    }
-    if (key == "HostName") {
-        return this->getHostNameKeyValue();
-    }
-    if (key == "SupportedMeasurands") {
-        return this->getSupportedMeasurandsKeyValue();
-    }
-    if (key == "MaxMessageSize") {
-        return this->getMaxMessageSizeKeyValue();
-    }
-    if (key == "QueueAllMessages") {
-        return this->getQueueAllMessagesKeyValue();
-    }
-    if (key == "MessageTypesDiscardForQueueing") {
-        return this->getMessageTypesDiscardForQueueingKeyValue();
-    }
-    if (key == "MessageQueueSizeThreshold") {
-        return this->getMessageQueueSizeThresholdKeyValue();
-    }
+void ChargePointConfiguration::init_key_value_getters() {
+    using KeyValueGetters = std::vector<std::pair<std::string, KeyValueGetter>>;
+    const auto index_by_key = [](const KeyValueGetters& getters,
+                                 std::unordered_map<std::string, KeyValueGetter>& key_value_getters) {
+        for (const auto& [key, getter] : getters) {
+            key_value_getters.emplace(to_lower_case_key(key), getter);
+        }
+    };
+
+    const KeyValueGetters internal_getters = {
+        {"ChargePointId", [this]() { return this->getChargePointIdKeyValue(); }},
+        {"CentralSystemURI", [this]() { return this->getCentralSystemURIKeyValue(); }},
+        {"ChargeBoxSerialNumber", [this]() { return this->getChargeBoxSerialNumberKeyValue(); }},
+        {"ChargePointModel", [this]() { return this->getChargePointModelKeyValue(); }},
+        {"ChargePointSerialNumber", [this]() { return this->getChargePointSerialNumberKeyValue(); }},
+        {"ChargePointVendor", [this]() { return this->getChargePointVendorKeyValue(); }},
+        {"FirmwareVersion", [this]() { return this->getFirmwareVersionKeyValue(); }},
+        {"ICCID", [this]() { return this->getICCIDKeyValue(); }},
+        {"IMSI", [this]() { return this->getIMSIKeyValue(); }},
+        {"MeterSerialNumber", [this]() { return this->getMeterSerialNumberKeyValue(); }},
+        {"MeterType", [this]() { return this->getMeterTypeKeyValue(); }},
+        {"SupportedCiphers12", [this]() { return this->getSupportedCiphers12KeyValue(); }},
+        {"SupportedCiphers13", [this]() { return this->getSupportedCiphers13KeyValue(); }},
+        {"RetryBackoffRandomRange", [this]() { return this->getRetryBackoffRandomRangeKeyValue(); }},
+        {"RetryBackoffRepeatTimes", [this]() { return this->getRetryBackoffRepeatTimesKeyValue(); }},
+        {"RetryBackoffWaitMinimum", [this]() { return this->getRetryBackoffWaitMinimumKeyValue(); }},
+        {"AuthorizeConnectorZeroOnConnectorOne",
+         [this]() { return this->getAuthorizeConnectorZeroOnConnectorOneKeyValue(); }},
+        {"LogMessages", [this]() { return this->getLogMessagesKeyValue(); }},
+        {"LogMessagesFormat", [this]() { return this->getLogMessagesFormatKeyValue(); }},
+        {"SupportedChargingProfilePurposeTypes",
+         [this]() { return this->getSupportedChargingProfilePurposeTypesKeyValue(); }},
+        {"MaxCompositeScheduleDuration", [this]() { return this->getMaxCompositeScheduleDurationKeyValue(); }},
+        {"WebsocketPingPayload", [this]() { return this->getWebsocketPingPayloadKeyValue(); }},
+        {"WebsocketPongTimeout", [this]() { return this->getWebsocketPongTimeoutKeyValue(); }},
+        {"UseSslDefaultVerifyPaths", [this]() { return this->getUseSslDefaultVerifyPathsKeyValue(); }},
+        {"VerifyCsmsCommonName", [this]() { return this->getVerifyCsmsCommonNameKeyValue(); }},
+        {"VerifyCsmsAllowWildcards", [this]() { return this->getVerifyCsmsAllowWildcardsKeyValue(); }},
+        {"OcspRequestInterval", [this]() { return this->getOcspRequestIntervalKeyValue(); }},
+        {"SeccLeafSubjectCommonName", [this]() { return this->getSeccLeafSubjectCommonNameKeyValue(); }},
+        {"SeccLeafSubjectCountry", [this]() { return this->getSeccLeafSubjectCountryKeyValue(); }},
+        {"SeccLeafSubjectOrganization", [this]() { return this->getSeccLeafSubjectOrganizationKeyValue(); }},
+        {"ConnectorEvseIds", [this]() { return this->getConnectorEvseIdsKeyValue(); }},
+        {"AllowChargingProfileWithoutStartSchedule",
+         [this]() { return this->getAllowChargingProfileWithoutStartScheduleKeyValue(); }},
+        {"WaitForStopTransactionsOnResetTimeout",
+         [this]() { return this->getWaitForStopTransactionsOnResetTimeoutKeyValue(); }},
+        {"HostName", [this]() { return this->getHostNameKeyValue(); }},
+        {"SupportedMeasurands", [this]() { return this->getSupportedMeasurandsKeyValue(); }},
+        {"MaxMessageSize", [this]() { return this->getMaxMessageSizeKeyValue(); }},
+        {"QueueAllMessages", [this]() { return this->getQueueAllMessagesKeyValue(); }},
+        {"MessageTypesDiscardForQueueing", [this]() { return this->getMessageTypesDiscardForQueueingKeyValue(); }},
+        {"MessageQueueSizeThreshold", [this]() { return this->getMessageQueueSizeThresholdKeyValue(); }},
+        // California Pricing, available even if the CostAndPrice profile is not configured
+        {"CustomDisplayCostAndPrice", [this]() { return this->getCustomDisplayCostAndPriceEnabledKeyValue(); }},
+    };
+    index_by_key(internal_getters, this->key_value_getters);
+
+    const KeyValueGetters core_getters = {
+        {"AllowOfflineTxForUnknownId", [this]() { return this->getAllowOfflineTxForUnknownIdKeyValue(); }},
+        {"AuthorizationCacheEnabled", [this]() { return this->getAuthorizationCacheEnabledKeyValue(); }},
+        // we should not return an AuthorizationKey because it's readonly
+        {"AuthorizeRemoteTxRequests", [this]() { return this->getAuthorizeRemoteTxRequestsKeyValue(); }},
+        {"BlinkRepeat", [this]() { return this->getBlinkRepeatKeyValue(); }},
+        {"ClockAlignedDataInterval", [this]() { return this->getClockAlignedDataIntervalKeyValue(); }},
+        {"ConnectionTimeOut", [this]() { return this->getConnectionTimeOutKeyValue(); }},
+        {"ConnectorPhaseRotation", [this]() { return this->getConnectorPhaseRotationKeyValue(); }},
+        {"ConnectorPhaseRotationMaxLength", [this]() { return this->getConnectorPhaseRotationMaxLengthKeyValue(); }},
+        {"CpoName", [this]() { return this->getCpoNameKeyValue(); }},
+        {"GetConfigurationMaxKeys", [this]() { return this->getGetConfigurationMaxKeysKeyValue(); }},
+        {"HeartbeatInterval", [this]() { return this->getHeartbeatIntervalKeyValue(); }},
+        {"LightIntensity", [this]() { return this->getLightIntensityKeyValue(); }},
+        {"LocalAuthorizeOffline", [this]() { return this->getLocalAuthorizeOfflineKeyValue(); }},
+        {"LocalPreAuthorize", [this]() { return this->getLocalPreAuthorizeKeyValue(); }},
+        {"MaxEnergyOnInvalidId", [this]() { return this->getMaxEnergyOnInvalidIdKeyValue(); }},
+        {"MeterValuesAlignedData", [this]() { return this->getMeterValuesAlignedDataKeyValue(); }},
+        {"MeterValuesAlignedDataMaxLength", [this]() { return this->getMeterValuesAlignedDataMaxLengthKeyValue(); }},
+        {"MeterValuesSampledData", [this]() { return this->getMeterValuesSampledDataKeyValue(); }},
+        {"MeterValuesSampledDataMaxLength", [this]() { return this->getMeterValuesSampledDataMaxLengthKeyValue(); }},
+        {"MeterValueSampleInterval", [this]() { return this->getMeterValueSampleIntervalKeyValue(); }},
+        {"MinimumStatusDuration", [this]() { return this->getMinimumStatusDurationKeyValue(); }},
+        {"NumberOfConnectors", [this]() { return this->getNumberOfConnectorsKeyValue(); }},
+        {"ReserveConnectorZeroSupported", [this]() { return this->getReserveConnectorZeroSupportedKeyValue(); }},
+        {"ResetRetries", [this]() { return this->getResetRetriesKeyValue(); }},
+        {"SecurityProfile", [this]() { return this->getSecurityProfileKeyValue(); }},
+        {"DisableSecurityEventNotifications",
+         [this]() { return this->getDisableSecurityEventNotificationsKeyValue(); }},
+        {"StopTransactionOnEVSideDisconnect",
+         [this]() { return this->getStopTransactionOnEVSideDisconnectKeyValue(); }},
+        {"StopTransactionOnInvalidId", [this]() { return this->getStopTransactionOnInvalidIdKeyValue(); }},
+        {"StopTxnAlignedData", [this]() { return this->getStopTxnAlignedDataKeyValue(); }},
+        {"StopTxnAlignedDataMaxLength", [this]() { return this->getStopTxnAlignedDataMaxLengthKeyValue(); }},
+        {"StopTxnSampledData", [this]() { return this->getStopTxnSampledDataKeyValue(); }},
+        {"StopTxnSampledDataMaxLength", [this]() { return this->getStopTxnSampledDataMaxLengthKeyValue(); }},
+        {"SupportedFeatureProfiles", [this]() { return this->getSupportedFeatureProfilesKeyValue(); }},
+        {"SupportedFeatureProfilesMaxLength",
+         [this]() { return this->getSupportedFeatureProfilesMaxLengthKeyValue(); }},
+        {"TransactionMessageAttempts", [this]() { return this->getTransactionMessageAttemptsKeyValue(); }},
+        {"TransactionMessageRetryInterval", [this]() { return this->getTransactionMessageRetryIntervalKeyValue(); }},
+        {"UnlockConnectorOnEVSideDisconnect",
+         [this]() { return this->getUnlockConnectorOnEVSideDisconnectKeyValue(); }},
+        {"WebsocketPingInterval", [this]() { return this->getWebsocketPingIntervalKeyValue(); }},
+    };
+    index_by_key(core_getters, this->key_value_getters);
 
-    // Core Profile
-    if (key == "AllowOfflineTxForUnknownId") {
-        return this->getAllowOfflineTxForUnknownIdKeyValue();
-    }
-    if (key == "AuthorizationCacheEnabled") {
-        return this->getAuthorizationCacheEnabledKeyValue();
-    }
-    // we should not return an AuthorizationKey because it's readonly
-    // if (key == "AuthorizationKey") {
-    //     return this->getAuthorizationKeyKeyValue();
-    // }
-    if (key == "AuthorizeRemoteTxRequests") {
-        return this->getAuthorizeRemoteTxRequestsKeyValue();
-    }
-    if (key == "BlinkRepeat") {
-        return this->getBlinkRepeatKeyValue();
-    }
-    if (key == "ClockAlignedDataInterval") {
-        return this->getClockAlignedDataIntervalKeyValue();
-    }
-    if (key == "ConnectionTimeOut") {
-        return this->getConnectionTimeOutKeyValue();
-    }
-    if (key == "ConnectorPhaseRotation") {
-        return this->getConnectorPhaseRotationKeyValue();
-    }
-    if (key == "ConnectorPhaseRotationMaxLength") {
-        return this->getConnectorPhaseRotationMaxLengthKeyValue();
-    }
-    if (key == "CpoName") {
-        return this->getCpoNameKeyValue();
-    }
-    if (key == "GetConfigurationMaxKeys") {
-        return this->getGetConfigurationMaxKeysKeyValue();
-    }
-    if (key == "HeartbeatInterval") {
-        return this->getHeartbeatIntervalKeyValue();
-    }
-    if (key == "LightIntensity") {
-        return this->getLightIntensityKeyValue();
-    }
-    if (key == "LocalAuthorizeOffline") {
-        return this->getLocalAuthorizeOfflineKeyValue();
-    }
-    if (key == "LocalPreAuthorize") {
-        return this->getLocalPreAuthorizeKeyValue();
-    }
-    if (key == "MaxEnergyOnInvalidId") {
-        return this->getMaxEnergyOnInvalidIdKeyValue();
-    }
-    if (key == "MeterValuesAlignedData") {
-        return this->getMeterValuesAlignedDataKeyValue();
-    }
-    if (key == "MeterValuesAlignedDataMaxLength") {
-        return this->getMeterValuesAlignedDataMaxLengthKeyValue();
-    }
-    if (key == "MeterValuesSampledData") {
-        return this->getMeterValuesSampledDataKeyValue();
-    }
-    if (key == "MeterValuesSampledDataMaxLength") {
-        return this->getMeterValuesSampledDataMaxLengthKeyValue();
-    }
-    if (key == "MeterValueSampleInterval") {
-        return this->getMeterValueSampleIntervalKeyValue();
-    }
-    if (key == "MinimumStatusDuration") {
-        return this->getMinimumStatusDurationKeyValue();
-    }
-    if (key == "NumberOfConnectors") {
-        return this->getNumberOfConnectorsKeyValue();
-    }
-    if (key == "ReserveConnectorZeroSupported") {
-        return this->getReserveConnectorZeroSupportedKeyValue();
-    }
-    if (key == "ResetRetries") {
-        return this->getResetRetriesKeyValue();
-    }
-    if (key == "SecurityProfile") {
-        return this->getSecurityProfileKeyValue();
-    }
-    if (key == "DisableSecurityEventNotifications") {
-        return this->getDisableSecurityEventNotificationsKeyValue();
-    }
-    if (key == "StopTransactionOnEVSideDisconnect") {
-        return this->getStopTransactionOnEVSideDisconnectKeyValue();
-    }
-    if (key == "StopTransactionOnInvalidId") {
-        return this->getStopTransactionOnInvalidIdKeyValue();
-    }
-    if (key == "StopTxnAlignedData") {
-        return this->getStopTxnAlignedDataKeyValue();
-    }
-    if (key == "StopTxnAlignedDataMaxLength") {
-        return this->getStopTxnAlignedDataMaxLengthKeyValue();
-    }
-    if (key == "StopTxnSampledData") {
-        return this->getStopTxnSampledDataKeyValue();
-    }
-    if (key == "StopTxnSampledDataMaxLength") {
-        return this->getStopTxnSampledDataMaxLengthKeyValue();
-    }
-    if (key == "SupportedFeatureProfiles") {
-        return this->getSupportedFeatureProfilesKeyValue();
-    }
-    if (key == "SupportedFeatureProfilesMaxLength") {
-        return this->getSupportedFeatureProfilesMaxLengthKeyValue();
-    }
-    if (key == "TransactionMessageAttempts") {
-        return this->getTransactionMessageAttemptsKeyValue();
-    }
-    if (key == "TransactionMessageRetryInterval") {
-        return this->getTransactionMessageRetryIntervalKeyValue();
-    }
-    if (key == "UnlockConnectorOnEVSideDisconnect") {
-        return this->getUnlockConnectorOnEVSideDisconnectKeyValue();
-    }
-    if (key == "WebsocketPingInterval") {
-        return this->getWebsocketPingIntervalKeyValue();
-    }
-
-    // PnC
     if (this->supported_feature_profiles.count(SupportedFeatureProfiles::PnC)) {
-        if (key == "ISO15118PnCEnabled") {
-            return this->getISO15118PnCEnabledKeyValue();
-        }
-        if (key == "CentralContractValidationAllowed") {
-            return this->getCentralContractValidationAllowedKeyValue();
-        }
-        if (key == "CertSigningWaitMinimum") {
-            return this->getCertSigningWaitMinimumKeyValue();
-        }
-        if (key == "CertSigningRepeatTimes") {
-            return this->getCertSigningRepeatTimesKeyValue();
-        }
-        if (key == "ContractValidationOffline") {
-            return this->getContractValidationOfflineKeyValue();
-        }
+        const KeyValueGetters pnc_getters = {
+            {"ISO15118PnCEnabled", [this]() { return this->getISO15118PnCEnabledKeyValue(); }},
+            {"CentralContractValidationAllowed",
+             [this]() { return this->getCentralContractValidationAllowedKeyValue(); }},
+            {"CertSigningWaitMinimum", [this]() { return this->getCertSigningWaitMinimumKeyValue(); }},
+            {"CertSigningRepeatTimes", [this]() { return this->getCertSigningRepeatTimesKeyValue(); }},
+            {"ContractValidationOffline", [this]() { return this->getContractValidationOfflineKeyValue(); }},
+        };
+        index_by_key(pnc_getters, this->key_value_getters);
     }
 
-    // Smart Charging
     if (this->supported_feature_profiles.count(SupportedFeatureProfiles::SmartCharging)) {
-        if (key == "ChargeProfileMaxStackLevel") {
-            return this->getChargeProfileMaxStackLevelKeyValue();
-        }
-        if (key == "ChargingScheduleAllowedChargingRateUnit") {
-            return this->getChargingScheduleAllowedChargingRateUnitKeyValue();
-        }
-        if (key == "ChargingScheduleMaxPeriods") {
-            return this->getChargingScheduleMaxPeriodsKeyValue();
-        }
-        if (key == "ConnectorSwitch3to1PhaseSupported") {
-            return this->getConnectorSwitch3to1PhaseSupportedKeyValue();
-        }
-        if (key == "MaxChargingProfilesInstalled") {
-            return this->getMaxChargingProfilesInstalledKeyValue();
-        }
+        const KeyValueGetters smart_charging_getters = {
+            {"ChargeProfileMaxStackLevel", [this]() { return this->getChargeProfileMaxStackLevelKeyValue(); }},
+            {"ChargingScheduleAllowedChargingRateUnit",
+             [this]() { return this->getChargingScheduleAllowedChargingRateUnitKeyValue(); }},
+            {"ChargingScheduleMaxPeriods", [this]() { return this->getChargingScheduleMaxPeriodsKeyValue(); }},
+            {"ConnectorSwitch3to1PhaseSupported",
+             [this]() { return this->getConnectorSwitch3to1PhaseSupportedKeyValue(); }},
+            {"MaxChargingProfilesInstalled", [this]() { return this->getMaxChargingProfilesInstalledKeyValue(); }},
+        };
+        index_by_key(smart_charging_getters, this->key_value_getters);
     }
 
-    // Local Auth List Managementg
     if (this->supported_feature_profiles.count(SupportedFeatureProfiles::LocalAuthListManagement)) {
-        if (key == "LocalAuthListEnabled") {
-            return this->getLocalAuthListEnabledKeyValue();
-        }
-        if (key == "LocalAuthListMaxLength") {
-            return this->getLocalAuthListMaxLengthKeyValue();
-        }
-        if (key == "SendLocalListMaxLength") {
-            return this->getSendLocalListMaxLengthKeyValue();
-        }
-    }
+        const KeyValueGetters local_auth_list_getters = {
+            {"LocalAuthListEnabled", [this]() { return this->getLocalAuthListEnabledKeyValue(); }},
+            {"LocalAuthListMaxLength", [this]() { return this->getLocalAuthListMaxLengthKeyValue(); }},
+            {"SendLocalListMaxLength", [this]() { return this->getSendLocalListMaxLengthKeyValue(); }},
+        };
+        index_by_key(local_auth_list_getters, this->key_value_getters);
+    }
+
+    const KeyValueGetters cost_and_price_getters = {
+        {"NumberOfDecimalsForCostValues", [this]() { return this->getPriceNumberOfDecimalsForCostValuesKeyValue(); }},
+        {"DefaultPrice", [this]() { return this->getDefaultPriceKeyValue(); }},
+        {"TimeOffset", [this]() { return this->getDisplayTimeOffsetKeyValue(); }},
+        {"NextTimeOffsetTransitionDateTime", [this]() { return this->getNextTimeOffsetTransitionDateTimeKeyValue(); }},
+        {"TimeOffsetNextTransition", [this]() { return this->getTimeOffsetNextTransitionKeyValue(); }},
+        {"CustomIdleFeeAfterStop", [this]() { return this->getCustomIdleFeeAfterStopKeyValue(); }},
+        {"SupportedLanguages", [this]() { return this->getMultiLanguageSupportedLanguagesKeyValue(); }},
+        {"CustomMultiLanguageMessages", [this]() { return this->getCustomMultiLanguageMessagesEnabledKeyValue(); }},
+        {"Language", [this]() { return this->getLanguageKeyValue(); }},
+    };
+    index_by_key(cost_and_price_getters, this->cost_and_price_key_value_getters);
+}
 
-    // California Pricing
-    if (key == "CustomDisplayCostAndPrice") {
-        return this->getCustomDisplayCostAndPriceEnabledKeyValue();
+std::optional<KeyValue> ChargePointConfiguration::get(CiString<50> key) {
+    std::lock_guard<std::recursive_mutex> lock(this->configuration_mutex);
+    const auto lower_case_key = to_lower_case_key(key.get());
+
+    const auto getter = this->key_value_getters.find(lower_case_key);
+    if (getter != this->key_value_getters.end()) {
+        return getter->second();
     }
 
     if (getCustomDisplayCostAndPriceEnabled()) {
-        if (key == "NumberOfDecimalsForCostValues") {
-            return this->getPriceNumberOfDecimalsForCostValuesKeyValue();
-        }
-        if (key == "DefaultPrice") {
-            return this->getDefaultPriceKeyValue();
+        const auto cost_and_price_getter = this->cost_and_price_key_value_getters.find(lower_case_key);
+        if (cost_and_price_getter != this->cost_and_price_key_value_getters.end()) {
+            return cost_and_price_getter->second();
         }
         if (key.get().find("DefaultPriceText") == 0 and this->getCustomMultiLanguageMessagesEnabled().has_value() and
             this->getCustomMultiLanguageMessagesEnabled().value()) {
@@ -3088,27 +3035,6 @@ std::optional<KeyValue> ChargePointConfiguration::get(CiString<50> key) {
                 return this->getDefaultPriceTextKeyValue(message_language.at(1));
             }
         }
-        if (key == "TimeOffset") {
-            return this->getDisplayTimeOffsetKeyValue();
-        }
-        if (key == "NextTimeOffsetTransitionDateTime") {
-            return this->getNextTimeOffsetTransitionDateTimeKeyValue();
-        }
-        if (key == "TimeOffsetNextTransition") {
-            return this->getTimeOffsetNextTransitionKeyValue();
-        }
-        if (key == "CustomIdleFeeAfterStop") {
-            return this->getCustomIdleFeeAfterStopKeyValue();
-        }
-        if (key == "SupportedLanguages") {
-            return this->getMultiLanguageSupportedLanguagesKeyValue();
-        }
-        if (key == "CustomMultiLanguageMessages") {
-            return this->getCustomMultiLanguageMessagesEnabledKeyValue();
-        }
-        if (key == "Language") {
-            return this->getLanguageKeyValue();
-        }
     }
 
     if (this->supported_feature_profiles.count(SupportedFeatureProfiles::Custom)) {
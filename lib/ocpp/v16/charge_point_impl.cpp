@@ -31,6 +31,8 @@ const auto OCSP_REQUEST_TIMER_INTERVAL = std::chrono::hours(12);
 const auto INITIAL_CERTIFICATE_REQUESTS_DELAY = std::chrono::seconds(60);
 const auto WEBSOCKET_INIT_DELAY = std::chrono::seconds(2);
 const auto DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD = 2E5;
+const auto DEFAULT_MESSAGE_QUEUE_DB_FLUSH_INTERVAL_MS = 250;
+const auto DEFAULT_MESSAGE_QUEUE_INGRESS_RING_CAPACITY = 1024;
 const auto DEFAULT_BOOT_NOTIFICATION_INTERVAL_S = 60; // fallback interval if BootNotification returns interval of 0.
 const auto DEFAULT_WAIT_FOR_FUTURE_TIMEOUT = std::chrono::seconds(60);
 const auto DEFAULT_PRICE_NUMBER_OF_DECIMALS = 3;
@@ -52,8 +54,9 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
     this->configuration = std::make_shared<ocpp::v16::ChargePointConfiguration>(config, share_path, user_config_path);
     this->heartbeat_timer = std::make_unique<Everest::SteadyTimer>(&this->io_service, [this]() { this->heartbeat(); });
     this->heartbeat_interval = this->configuration->getHeartbeatInterval();
-    auto database_connection =
-        std::make_unique<common::DatabaseConnection>(database_path / (this->configuration->getChargePointId() + ".db"));
+    auto database_connection = std::make_unique<common::DatabaseConnection>(
+        database_path / (this->configuration->getChargePointId() + ".db"),
+        common::DatabaseTuning::from_preset(this->configuration->getDatabaseTuning()));
     this->database_handler = std::make_shared<DatabaseHandler>(std::move(database_connection), sql_init_path,
                                                                this->configuration->getNumberOfConnectors());
     this->database_handler->open_connection();
@@ -66,8 +69,13 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
         std::find(log_formats.begin(), log_formats.end(), "console_detailed") != log_formats.end();
     bool log_to_file = std::find(log_formats.begin(), log_formats.end(), "log") != log_formats.end();
     bool log_to_html = std::find(log_formats.begin(), log_formats.end(), "html") != log_formats.end();
+    bool log_to_binary = std::find(log_formats.begin(), log_formats.end(), "binary") != log_formats.end();
     bool log_security = std::find(log_formats.begin(), log_formats.end(), "security") != log_formats.end();
     bool session_logging = std::find(log_formats.begin(), log_formats.end(), "session_logging") != log_formats.end();
+    const ocpp::LogQueueConfig log_queue_config(this->configuration->getLogMessagesQueueSize(),
+                                                this->configuration->getLogMessagesQueueFullPolicy() == "Drop"
+                                                    ? ocpp::LogQueueFullPolicy::Drop
+                                                    : ocpp::LogQueueFullPolicy::Block);
 
     if (this->configuration->getLogRotation()) {
         this->logging = std::make_shared<ocpp::MessageLogging>(
@@ -75,11 +83,14 @@ ChargePointImpl::ChargePointImpl(const std::string& config, const fs::path& shar
             detailed_log_to_console, log_to_file, log_to_html, log_security, session_logging, nullptr,
             ocpp::LogRotationConfig(this->configuration->getLogRotationDateSuffix(),
                                     this->configuration->getLogRotationMaximumFileSize(),
-                                    this->configuration->getLogRotationMaximumFileCount()));
+                                    this->configuration->getLogRotationMaximumFileCount(),
+                                    this->configuration->getLogRotationCompress()),
+            log_queue_config, log_to_binary);
     } else {
         this->logging = std::make_shared<ocpp::MessageLogging>(
             this->configuration->getLogMessages(), this->message_log_path, DateTime().to_rfc3339(), log_to_console,
-            detailed_log_to_console, log_to_file, log_to_html, log_security, session_logging, nullptr);
+            detailed_log_to_console, log_to_file, log_to_html, log_security, session_logging, nullptr, log_queue_config,
+            log_to_binary);
     }
 
     this->boot_notification_timer =
@@ -265,14 +276,34 @@ std::unique_ptr<ocpp::MessageQueue<v16::MessageType>> ChargePointImpl::create_me
         }
     }
 
-    return std::make_unique<ocpp::MessageQueue<v16::MessageType>>(
-        [this](json message) -> bool { return this->websocket->send(message.dump()); },
-        MessageQueueConfig<v16::MessageType>{
-            this->configuration->getTransactionMessageAttempts(),
-            this->configuration->getTransactionMessageRetryInterval(),
-            this->configuration->getMessageQueueSizeThreshold().value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
-            this->configuration->getQueueAllMessages().value_or(false), message_types_discard_for_queueing},
+    MessageQueueConfig<v16::MessageType> config{
+        this->configuration->getTransactionMessageAttempts(),
+        this->configuration->getTransactionMessageRetryInterval(),
+        this->configuration->getMessageQueueSizeThreshold().value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
+        this->configuration->getQueueAllMessages().value_or(false), message_types_discard_for_queueing};
+    config.queue_db_flush_interval_ms = DEFAULT_MESSAGE_QUEUE_DB_FLUSH_INTERVAL_MS;
+    config.ingress_ring_capacity = DEFAULT_MESSAGE_QUEUE_INGRESS_RING_CAPACITY;
+    config.replay_window = this->configuration->getMessageQueueReplayWindow();
+
+    // messages are only queued for the websocket so that a slow write does not block the message queue. A CALL that the
+    // websocket drops after accepting it is reported back through on_sent and sent again
+    auto message_queue = std::make_unique<ocpp::MessageQueue<v16::MessageType>>(
+        [this](json message) -> bool { return this->websocket->send_async(message.dump()); }, config,
         this->external_notify, this->database_handler, start_transaction_message_retry_callback);
+    message_queue->register_serialized_send_callback(
+        [this](const std::string& message, const std::function<void(bool sent)>& on_sent) -> bool {
+            return this->websocket->send_async(message, on_sent);
+        });
+    message_queue->register_writer_send_callback([this](const std::function<void(JsonWriter& writer)>& write) -> bool {
+        return this->websocket->send_async(write);
+    });
+    // the message queue is recreated on restart, so the callback is forwarded instead of registered directly
+    message_queue->register_replay_progress_callback([this](const ReplayProgress& progress) {
+        if (this->message_queue_replay_progress_callback != nullptr) {
+            this->message_queue_replay_progress_callback(progress);
+        }
+    });
+    return message_queue;
 }
 
 void ChargePointImpl::init_websocket() {
@@ -365,6 +396,15 @@ WebsocketConnectionOptions ChargePointImpl::get_ws_connection_options() {
                                                   this->configuration->getIFace(),
                                                   this->configuration->getEnableTLSKeylog(),
                                                   this->configuration->getTLSKeylogFile()};
+    connection_options.max_fragment_size = this->configuration->getWebsocketMaxFragmentSize();
+    connection_options.max_send_queue_size = this->configuration->getWebsocketMaxSendQueueSize();
+    connection_options.enable_compression = this->configuration->getWebsocketCompression();
+    connection_options.compression_window_bits = this->configuration->getWebsocketCompressionWindowBits();
+    connection_options.compression_level = this->configuration->getWebsocketCompressionLevel();
+    connection_options.use_shared_event_loop = this->configuration->getWebsocketSharedEventLoop();
+    connection_options.shared_event_loop_workers = this->configuration->getWebsocketSharedEventLoopWorkers();
+    connection_options.enable_tls_session_resumption = this->configuration->getTLSSessionResumption();
+    connection_options.tls_session_cache_file = this->configuration->getTLSSessionCacheFile();
     return connection_options;
 }
 
@@ -381,6 +421,13 @@ void ChargePointImpl::disconnect_websocket() {
     }
 }
 
+WebsocketMetrics ChargePointImpl::get_websocket_metrics() {
+    if (this->websocket == nullptr) {
+        return {};
+    }
+    return this->websocket->get_metrics();
+}
+
 void ChargePointImpl::call_set_connection_timeout() {
     if (this->set_connection_timeout_callback != nullptr) {
         this->set_connection_timeout_callback(this->configuration->getConnectionTimeOut());
@@ -1184,6 +1231,10 @@ bool ChargePointImpl::stop() {
 
         this->stop_all_transactions();
 
+        // The reset or shutdown that follows must not lose configuration changes that are still written behind
+        if (!this->configuration->flush_user_config()) {
+            EVLOG_error << "Could not persist the changed configuration keys before stopping";
+        }
         this->database_handler->close_connection();
         this->websocket->disconnect(WebsocketCloseReason::Normal);
         this->message_queue->stop();
@@ -1239,7 +1290,7 @@ void ChargePointImpl::message_callback(const std::string& message) {
         return;
     }
 
-    auto json_message = enhanced_message.message;
+    const auto& json_message = enhanced_message.message;
     this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message);
     try {
         // reject unsupported messages
@@ -1671,6 +1722,8 @@ void ChargePointImpl::handleChangeConfigurationRequest(ocpp::Call<ChangeConfigur
                     this->update_clock_aligned_meter_values_interval();
                 } else if (call.msg.key == "AuthorizationKey") {
                     EVLOG_info << "AuthorizationKey was changed by central system";
+                    // The new key is needed to connect after a restart, persist it before it is used
+                    this->configuration->flush_user_config();
                     this->websocket->set_authorization_key(this->configuration->getAuthorizationKey().value());
                     if (this->configuration->getSecurityProfile() == 0) {
                         EVLOG_info << "AuthorizationKey was changed while on security profile 0.";
@@ -1712,7 +1765,8 @@ void ChargePointImpl::handleChangeConfigurationRequest(ocpp::Call<ChangeConfigur
                         } else if (security_profile > 3) {
                             response.status = ConfigurationStatus::Rejected;
                         } else {
-                            // valid set of security profile
+                            // valid set of security profile, persist it before switching to it
+                            this->configuration->flush_user_config();
                             ocpp::CallResult<ChangeConfigurationResponse> call_result(response, call.uniqueId);
                             this->send<ChangeConfigurationResponse>(call_result);
                             int32_t security_profile = std::stoi(call.msg.value);
@@ -2140,7 +2194,7 @@ void ChargePointImpl::handleStartTransactionResponse(ocpp::CallResult<StartTrans
 void ChargePointImpl::handleStopTransactionResponse(const EnhancedMessage<v16::MessageType>& message) {
 
     CallResult<StopTransactionResponse> call_result = message.message;
-    const Call<StopTransactionRequest>& original_call = message.call_message;
+    const Call<StopTransactionRequest> original_call = message.get_call_message();
 
     StopTransactionResponse stop_transaction_response = call_result.msg;
     const auto transaction = this->transaction_handler->get_transaction(call_result.uniqueId);
@@ -3191,7 +3245,7 @@ void ChargePointImpl::set_time_offset_timer(const std::string& date_time) {
 }
 
 template <class T> bool ChargePointImpl::send(ocpp::Call<T> call, bool initiated_by_trigger_message) {
-    const auto message_type = conversions::string_to_messagetype(json(call).at(CALL_ACTION));
+    const auto message_type = conversions::string_to_messagetype(call.msg.get_type());
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), initiated_by_trigger_message,
         (this->registration_status == RegistrationStatus::Accepted), is_transaction_message(message_type),
@@ -3212,7 +3266,7 @@ template <class T> bool ChargePointImpl::send(ocpp::Call<T> call, bool initiated
 template <class T>
 std::future<EnhancedMessage<v16::MessageType>> ChargePointImpl::send_async(ocpp::Call<T> call,
                                                                            bool initiated_by_trigger_message) {
-    const auto message_type = conversions::string_to_messagetype(json(call).at(CALL_ACTION));
+    const auto message_type = conversions::string_to_messagetype(call.msg.get_type());
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), initiated_by_trigger_message,
         (this->registration_status == RegistrationStatus::Accepted), is_transaction_message(message_type),
@@ -4518,6 +4572,11 @@ void ChargePointImpl::register_set_display_message_callback(
     this->set_display_message_callback = set_display_message_callback;
 }
 
+void ChargePointImpl::register_message_queue_replay_progress_callback(
+    const std::function<void(const ReplayProgress& progress)>& callback) {
+    this->message_queue_replay_progress_callback = callback;
+}
+
 void ChargePointImpl::on_reservation_start(int32_t connector) {
     this->status->submit_event(connector, FSMEvent::ReserveConnector, ocpp::DateTime());
 }
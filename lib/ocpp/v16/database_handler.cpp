@@ -11,6 +11,17 @@ using namespace common;
 
 namespace v16 {
 
+static const std::string UPDATE_TRANSACTION_METER_VALUE_SQL =
+    "UPDATE TRANSACTIONS SET METER_LAST=@meter_last, METER_LAST_TIME=@meter_last_time, "
+    "LAST_UPDATE=@last_update WHERE ID==@session_id";
+static const std::string INSERT_AUTHORIZATION_CACHE_ENTRY_SQL =
+    "INSERT OR REPLACE INTO AUTH_CACHE (ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG) VALUES "
+    "(@id_tag, @auth_status, @expiry_date, @parent_id_tag)";
+static const std::string GET_AUTHORIZATION_CACHE_ENTRY_SQL =
+    "SELECT ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG FROM AUTH_CACHE WHERE ID_TAG = @id_tag";
+static const std::string GET_LOCAL_AUTHORIZATION_LIST_ENTRY_SQL =
+    "SELECT ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG FROM AUTH_LIST WHERE ID_TAG = @id_tag";
+
 DatabaseHandler::DatabaseHandler(std::unique_ptr<DatabaseConnectionInterface> database,
                                  const fs::path& sql_migration_files_path, int32_t number_of_connectors) :
     DatabaseHandlerCommon(std::move(database), sql_migration_files_path, MIGRATION_FILE_VERSION_V16),
@@ -26,6 +37,13 @@ void DatabaseHandler::init_sql() {
     }
 }
 
+std::vector<std::string> DatabaseHandler::get_hot_statements() {
+    auto statements = DatabaseHandlerCommon::get_hot_statements();
+    statements.insert(statements.end(), {UPDATE_TRANSACTION_METER_VALUE_SQL, INSERT_AUTHORIZATION_CACHE_ENTRY_SQL,
+                                         GET_AUTHORIZATION_CACHE_ENTRY_SQL, GET_LOCAL_AUTHORIZATION_LIST_ENTRY_SQL});
+    return statements;
+}
+
 void DatabaseHandler::init_connector_table() {
     for (int32_t connector = 0; connector <= this->number_of_connectors; connector++) {
         std::string sql = "INSERT OR IGNORE INTO CONNECTORS (ID, AVAILABILITY) VALUES (@connector, @availability_type)";
@@ -152,9 +170,7 @@ void DatabaseHandler::update_start_transaction_message_id(const std::string& ses
 
 void DatabaseHandler::update_transaction_meter_value(const std::string& session_id, const int32_t value,
                                                      const std::string& last_meter_time) {
-    std::string sql = "UPDATE TRANSACTIONS SET METER_LAST=@meter_last, METER_LAST_TIME=@meter_last_time, "
-                      "LAST_UPDATE=@last_update WHERE ID==@session_id";
-    auto stmt = this->database->new_statement(sql);
+    auto stmt = this->database->new_statement(UPDATE_TRANSACTION_METER_VALUE_SQL);
 
     stmt->bind_int("@meter_last", value);
     stmt->bind_text("@meter_last_time", last_meter_time);
@@ -229,9 +245,7 @@ void DatabaseHandler::insert_or_update_authorization_cache_entry(const CiString<
 
     // TODO(piet): Only call this when authorization cache is enabled!
 
-    std::string sql = "INSERT OR REPLACE INTO AUTH_CACHE (ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG) VALUES "
-                      "(@id_tag, @auth_status, @expiry_date, @parent_id_tag)";
-    auto stmt = this->database->new_statement(sql);
+    auto stmt = this->database->new_statement(INSERT_AUTHORIZATION_CACHE_ENTRY_SQL);
 
     stmt->bind_text("@id_tag", id_tag.get(), SQLiteString::Transient);
     stmt->bind_text("@auth_status", v16::conversions::authorization_status_to_string(id_tag_info.status),
@@ -250,8 +264,7 @@ void DatabaseHandler::insert_or_update_authorization_cache_entry(const CiString<
 
 std::optional<v16::IdTagInfo> DatabaseHandler::get_authorization_cache_entry(const CiString<20>& id_tag) {
 
-    std::string sql = "SELECT ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG FROM AUTH_CACHE WHERE ID_TAG = @id_tag";
-    auto stmt = this->database->new_statement(sql);
+    auto stmt = this->database->new_statement(GET_AUTHORIZATION_CACHE_ENTRY_SQL);
 
     stmt->bind_text("@id_tag", id_tag.get(), SQLiteString::Transient);
 
@@ -453,8 +466,7 @@ void DatabaseHandler::delete_local_authorization_list_entry(const std::string& i
 }
 
 std::optional<v16::IdTagInfo> DatabaseHandler::get_local_authorization_list_entry(const CiString<20>& id_tag) {
-    std::string sql = "SELECT ID_TAG, AUTH_STATUS, EXPIRY_DATE, PARENT_ID_TAG FROM AUTH_LIST WHERE ID_TAG = @id_tag";
-    auto stmt = this->database->new_statement(sql);
+    auto stmt = this->database->new_statement(GET_LOCAL_AUTHORIZATION_LIST_ENTRY_SQL);
 
     stmt->bind_text("@id_tag", id_tag.get(), SQLiteString::Transient);
 
@@ -10,7 +10,8 @@ namespace ocpp {
 template <>
 ControlMessage<v16::MessageType>::ControlMessage(const json& message, const bool stall_until_accepted) :
     message(message.get<json::array_t>()),
-    messageType(v16::conversions::string_to_messagetype(message.at(CALL_ACTION))),
+    messageType(
+        v16::conversions::string_to_messagetype(message.at(CALL_ACTION).get_ref<const std::string&>())),
     message_attempts(0),
     initial_unique_id(message[MESSAGE_ID]),
     stall_until_accepted(stall_until_accepted) {
@@ -34,6 +35,32 @@ template <> bool ControlMessage<v16::MessageType>::is_transaction_update_message
     return (this->messageType == v16::MessageType::MeterValues);
 }
 
+template <> std::optional<std::string> ControlMessage<v16::MessageType>::transaction_id() const {
+    if (this->serialized.has_value()) {
+        return this->serialized->transaction_id;
+    }
+    if (this->messageType == v16::MessageType::StopTransaction or this->messageType == v16::MessageType::MeterValues) {
+        const auto& payload = this->message.at(CALL_PAYLOAD);
+        if (payload.contains("transactionId")) {
+            return std::to_string(payload.at("transactionId").get<int32_t>());
+        }
+    }
+    return std::nullopt;
+}
+
+template <> std::optional<std::string> ControlMessage<v16::MessageType>::replay_ordering_key() const {
+    // the transactionId of queued MeterValues.req and StopTransaction.req can only be filled in once the
+    // StartTransaction.conf has been handled, so these messages are never pipelined
+    if (is_transaction_message(this->messageType) and
+        this->messageType != v16::MessageType::SecurityEventNotification) {
+        return std::nullopt;
+    }
+    if (this->messageType == v16::MessageType::BootNotification) {
+        return std::nullopt;
+    }
+    return this->initial_unique_id.get();
+}
+
 template <> v16::MessageType MessageQueue<v16::MessageType>::string_to_messagetype(const std::string& s) {
     return v16::conversions::string_to_messagetype(s);
 }
@@ -25,6 +25,14 @@ void to_json(json& j, const AuthorizeRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const AuthorizeRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("idTag", k.idTag);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, AuthorizeRequest& k) {
     // the required parts of the message
     k.idTag = j.at("idTag");
@@ -51,6 +59,14 @@ void to_json(json& j, const AuthorizeResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const AuthorizeResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("idTagInfo", k.idTagInfo);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, AuthorizeResponse& k) {
     // the required parts of the message
     k.idTagInfo = j.at("idTagInfo");
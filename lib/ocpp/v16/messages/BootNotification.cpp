@@ -47,6 +47,36 @@ void to_json(json& j, const BootNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const BootNotificationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("chargePointVendor", k.chargePointVendor);
+    writer.member("chargePointModel", k.chargePointModel);
+    // the optional parts of the message
+    if (k.chargePointSerialNumber) {
+        writer.member("chargePointSerialNumber", k.chargePointSerialNumber.value());
+    }
+    if (k.chargeBoxSerialNumber) {
+        writer.member("chargeBoxSerialNumber", k.chargeBoxSerialNumber.value());
+    }
+    if (k.firmwareVersion) {
+        writer.member("firmwareVersion", k.firmwareVersion.value());
+    }
+    if (k.iccid) {
+        writer.member("iccid", k.iccid.value());
+    }
+    if (k.imsi) {
+        writer.member("imsi", k.imsi.value());
+    }
+    if (k.meterType) {
+        writer.member("meterType", k.meterType.value());
+    }
+    if (k.meterSerialNumber) {
+        writer.member("meterSerialNumber", k.meterSerialNumber.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, BootNotificationRequest& k) {
     // the required parts of the message
     k.chargePointVendor = j.at("chargePointVendor");
@@ -97,9 +127,19 @@ void to_json(json& j, const BootNotificationResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const BootNotificationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::registration_status_to_string(k.status));
+    writer.member("currentTime", k.currentTime.to_rfc3339());
+    writer.member("interval", k.interval);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, BootNotificationResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_registration_status(j.at("status"));
+    k.status = conversions::string_to_registration_status(j.at("status").get_ref<const std::string&>());
     k.currentTime = ocpp::DateTime(std::string(j.at("currentTime")));
     k.interval = j.at("interval");
 
@@ -24,6 +24,14 @@ void to_json(json& j, const CancelReservationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CancelReservationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("reservationId", k.reservationId);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, CancelReservationRequest& k) {
     // the required parts of the message
     k.reservationId = j.at("reservationId");
@@ -50,9 +58,17 @@ void to_json(json& j, const CancelReservationResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CancelReservationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::cancel_reservation_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, CancelReservationResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_cancel_reservation_status(j.at("status"));
+    k.status = conversions::string_to_cancel_reservation_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -24,6 +24,14 @@ void to_json(json& j, const CertificateSignedRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("certificateChain", k.certificateChain);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, CertificateSignedRequest& k) {
     // the required parts of the message
     k.certificateChain = j.at("certificateChain");
@@ -50,9 +58,17 @@ void to_json(json& j, const CertificateSignedResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::certificate_signed_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, CertificateSignedResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_certificate_signed_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_certificate_signed_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -25,10 +25,19 @@ void to_json(json& j, const ChangeAvailabilityRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("type", conversions::availability_type_to_string(k.type));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, ChangeAvailabilityRequest& k) {
     // the required parts of the message
     k.connectorId = j.at("connectorId");
-    k.type = conversions::string_to_availability_type(j.at("type"));
+    k.type = conversions::string_to_availability_type(j.at("type").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -52,9 +61,17 @@ void to_json(json& j, const ChangeAvailabilityResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::availability_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, ChangeAvailabilityResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_availability_status(j.at("status"));
+    k.status = conversions::string_to_availability_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
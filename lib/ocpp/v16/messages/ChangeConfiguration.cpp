@@ -25,6 +25,15 @@ void to_json(json& j, const ChangeConfigurationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeConfigurationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("key", k.key);
+    writer.member("value", k.value);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, ChangeConfigurationRequest& k) {
     // the required parts of the message
     k.key = j.at("key");
@@ -52,9 +61,17 @@ void to_json(json& j, const ChangeConfigurationResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ChangeConfigurationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::configuration_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, ChangeConfigurationResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_configuration_status(j.at("status"));
+    k.status = conversions::string_to_configuration_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
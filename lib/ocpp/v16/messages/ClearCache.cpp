@@ -23,6 +23,14 @@ void to_json(json& j, const ClearCacheRequest& k) {
     (void)k; // no elements to unpack, silence unused parameter warning
 }
 
+void write_json(JsonWriter& writer, const ClearCacheRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    (void)k; // no elements to write, silence unused parameter warning
+}
+
 void from_json(const json& j, ClearCacheRequest& k) {
     // the required parts of the message
 
@@ -51,9 +59,17 @@ void to_json(json& j, const ClearCacheResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ClearCacheResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_cache_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearCacheResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_cache_status(j.at("status"));
+    k.status = conversions::string_to_clear_cache_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -36,6 +36,26 @@ void to_json(json& j, const ClearChargingProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.id) {
+        writer.member("id", k.id.value());
+    }
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    if (k.chargingProfilePurpose) {
+        writer.member("chargingProfilePurpose",
+                      conversions::charging_profile_purpose_type_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.stackLevel) {
+        writer.member("stackLevel", k.stackLevel.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearChargingProfileRequest& k) {
     // the required parts of the message
 
@@ -48,7 +68,8 @@ void from_json(const json& j, ClearChargingProfileRequest& k) {
     }
     if (j.contains("chargingProfilePurpose")) {
         k.chargingProfilePurpose.emplace(
-            conversions::string_to_charging_profile_purpose_type(j.at("chargingProfilePurpose")));
+            conversions::string_to_charging_profile_purpose_type(
+                j.at("chargingProfilePurpose").get_ref<const std::string&>()));
     }
     if (j.contains("stackLevel")) {
         k.stackLevel.emplace(j.at("stackLevel"));
@@ -74,9 +95,17 @@ void to_json(json& j, const ClearChargingProfileResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_charging_profile_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearChargingProfileResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_charging_profile_status(j.at("status"));
+    k.status = conversions::string_to_clear_charging_profile_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -24,6 +24,14 @@ void to_json(json& j, const DeleteCertificateRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("certificateHashData", k.certificateHashData);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, DeleteCertificateRequest& k) {
     // the required parts of the message
     k.certificateHashData = j.at("certificateHashData");
@@ -50,9 +58,17 @@ void to_json(json& j, const DeleteCertificateResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::delete_certificate_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, DeleteCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_delete_certificate_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_delete_certificate_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
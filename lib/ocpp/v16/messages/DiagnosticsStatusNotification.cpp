@@ -24,9 +24,17 @@ void to_json(json& j, const DiagnosticsStatusNotificationRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::diagnostics_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, DiagnosticsStatusNotificationRequest& k) {
     // the required parts of the message
-    k.status = conversions::string_to_diagnostics_status(j.at("status"));
+    k.status = conversions::string_to_diagnostics_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -49,6 +57,14 @@ void to_json(json& j, const DiagnosticsStatusNotificationResponse& k) {
     (void)k; // no elements to unpack, silence unused parameter warning
 }
 
+void write_json(JsonWriter& writer, const DiagnosticsStatusNotificationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    (void)k; // no elements to write, silence unused parameter warning
+}
+
 void from_json(const json& j, DiagnosticsStatusNotificationResponse& k) {
     // the required parts of the message
 
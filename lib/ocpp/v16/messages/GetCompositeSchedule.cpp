@@ -29,6 +29,18 @@ void to_json(json& j, const GetCompositeScheduleRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("duration", k.duration);
+    // the optional parts of the message
+    if (k.chargingRateUnit) {
+        writer.member("chargingRateUnit", conversions::charging_rate_unit_to_string(k.chargingRateUnit.value()));
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetCompositeScheduleRequest& k) {
     // the required parts of the message
     k.connectorId = j.at("connectorId");
@@ -36,7 +48,8 @@ void from_json(const json& j, GetCompositeScheduleRequest& k) {
 
     // the optional parts of the message
     if (j.contains("chargingRateUnit")) {
-        k.chargingRateUnit.emplace(conversions::string_to_charging_rate_unit(j.at("chargingRateUnit")));
+        k.chargingRateUnit.emplace(
+            conversions::string_to_charging_rate_unit(j.at("chargingRateUnit").get_ref<const std::string&>()));
     }
 }
 
@@ -68,9 +81,26 @@ void to_json(json& j, const GetCompositeScheduleResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_composite_schedule_status_to_string(k.status));
+    // the optional parts of the message
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    if (k.scheduleStart) {
+        writer.member("scheduleStart", k.scheduleStart.value().to_rfc3339());
+    }
+    if (k.chargingSchedule) {
+        writer.member("chargingSchedule", k.chargingSchedule.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetCompositeScheduleResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_composite_schedule_status(j.at("status"));
+    k.status = conversions::string_to_get_composite_schedule_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("connectorId")) {
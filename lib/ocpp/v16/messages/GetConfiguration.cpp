@@ -33,6 +33,16 @@ void to_json(json& j, const GetConfigurationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetConfigurationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.key) {
+        writer.member("key", k.key.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetConfigurationRequest& k) {
     // the required parts of the message
 
@@ -84,6 +94,19 @@ void to_json(json& j, const GetConfigurationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetConfigurationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.configurationKey) {
+        writer.member("configurationKey", k.configurationKey.value());
+    }
+    if (k.unknownKey) {
+        writer.member("unknownKey", k.unknownKey.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetConfigurationResponse& k) {
     // the required parts of the message
 
@@ -37,6 +37,26 @@ void to_json(json& j, const GetDiagnosticsRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDiagnosticsRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("location", k.location);
+    // the optional parts of the message
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    if (k.startTime) {
+        writer.member("startTime", k.startTime.value().to_rfc3339());
+    }
+    if (k.stopTime) {
+        writer.member("stopTime", k.stopTime.value().to_rfc3339());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetDiagnosticsRequest& k) {
     // the required parts of the message
     k.location = j.at("location");
@@ -76,6 +96,16 @@ void to_json(json& j, const GetDiagnosticsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDiagnosticsResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.fileName) {
+        writer.member("fileName", k.fileName.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetDiagnosticsResponse& k) {
     // the required parts of the message
 
@@ -25,9 +25,18 @@ void to_json(json& j, const GetInstalledCertificateIdsRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("certificateType", conversions::certificate_use_enum_type_to_string(k.certificateType));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, GetInstalledCertificateIdsRequest& k) {
     // the required parts of the message
-    k.certificateType = conversions::string_to_certificate_use_enum_type(j.at("certificateType"));
+    k.certificateType =
+        conversions::string_to_certificate_use_enum_type(j.at("certificateType").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -57,9 +66,21 @@ void to_json(json& j, const GetInstalledCertificateIdsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_installed_certificate_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    if (k.certificateHashData) {
+        writer.member("certificateHashData", k.certificateHashData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetInstalledCertificateIdsResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_installed_certificate_status_enum_type(j.at("status"));
+    k.status =
+        conversions::string_to_get_installed_certificate_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("certificateHashData")) {
@@ -23,6 +23,14 @@ void to_json(json& j, const GetLocalListVersionRequest& k) {
     (void)k; // no elements to unpack, silence unused parameter warning
 }
 
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    (void)k; // no elements to write, silence unused parameter warning
+}
+
 void from_json(const json& j, GetLocalListVersionRequest& k) {
     // the required parts of the message
 
@@ -51,6 +59,14 @@ void to_json(json& j, const GetLocalListVersionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("listVersion", k.listVersion);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, GetLocalListVersionResponse& k) {
     // the required parts of the message
     k.listVersion = j.at("listVersion");
@@ -23,6 +23,14 @@ void to_json(json& j, const HeartbeatRequest& k) {
     (void)k; // no elements to unpack, silence unused parameter warning
 }
 
+void write_json(JsonWriter& writer, const HeartbeatRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    (void)k; // no elements to write, silence unused parameter warning
+}
+
 void from_json(const json& j, HeartbeatRequest& k) {
     // the required parts of the message
 
@@ -51,6 +59,14 @@ void to_json(json& j, const HeartbeatResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const HeartbeatResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("currentTime", k.currentTime.to_rfc3339());
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, HeartbeatResponse& k) {
     // the required parts of the message
     k.currentTime = ocpp::DateTime(std::string(j.at("currentTime")));
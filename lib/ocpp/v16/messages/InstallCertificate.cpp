@@ -25,9 +25,19 @@ void to_json(json& j, const InstallCertificateRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("certificateType", conversions::certificate_use_enum_type_to_string(k.certificateType));
+    writer.member("certificate", k.certificate);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, InstallCertificateRequest& k) {
     // the required parts of the message
-    k.certificateType = conversions::string_to_certificate_use_enum_type(j.at("certificateType"));
+    k.certificateType =
+        conversions::string_to_certificate_use_enum_type(j.at("certificateType").get_ref<const std::string&>());
     k.certificate = j.at("certificate");
 
     // the optional parts of the message
@@ -52,9 +62,18 @@ void to_json(json& j, const InstallCertificateResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::install_certificate_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, InstallCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_install_certificate_status_enum_type(j.at("status"));
+    k.status =
+        conversions::string_to_install_certificate_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -28,9 +28,20 @@ void to_json(json& j, const LogStatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const LogStatusNotificationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::upload_log_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    if (k.requestId) {
+        writer.member("requestId", k.requestId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, LogStatusNotificationRequest& k) {
     // the required parts of the message
-    k.status = conversions::string_to_upload_log_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_upload_log_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("requestId")) {
@@ -56,6 +67,14 @@ void to_json(json& j, const LogStatusNotificationResponse& k) {
     (void)k; // no elements to unpack, silence unused parameter warning
 }
 
+void write_json(JsonWriter& writer, const LogStatusNotificationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    (void)k; // no elements to write, silence unused parameter warning
+}
+
 void from_json(const json& j, LogStatusNotificationResponse& k) {
     // the required parts of the message
 
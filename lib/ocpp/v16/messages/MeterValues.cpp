@@ -29,6 +29,18 @@ void to_json(json& j, const MeterValuesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const MeterValuesRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("meterValue", k.meterValue);
+    // the optional parts of the message
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, MeterValuesRequest& k) {
     // the required parts of the message
     k.connectorId = j.at("connectorId");
@@ -60,6 +72,14 @@ void to_json(json& j, const MeterValuesResponse& k) {
     (void)k; // no elements to unpack, silence unused parameter warning
 }
 
+void write_json(JsonWriter& writer, const MeterValuesResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    (void)k; // no elements to write, silence unused parameter warning
+}
+
 void from_json(const json& j, MeterValuesResponse& k) {
     // the required parts of the message
 
@@ -31,6 +31,20 @@ void to_json(json& j, const RemoteStartTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RemoteStartTransactionRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("idTag", k.idTag);
+    // the optional parts of the message
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    if (k.chargingProfile) {
+        writer.member("chargingProfile", k.chargingProfile.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, RemoteStartTransactionRequest& k) {
     // the required parts of the message
     k.idTag = j.at("idTag");
@@ -63,9 +77,17 @@ void to_json(json& j, const RemoteStartTransactionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const RemoteStartTransactionResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::remote_start_stop_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, RemoteStartTransactionResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_remote_start_stop_status(j.at("status"));
+    k.status = conversions::string_to_remote_start_stop_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
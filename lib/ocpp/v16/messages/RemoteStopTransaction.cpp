@@ -24,6 +24,14 @@ void to_json(json& j, const RemoteStopTransactionRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const RemoteStopTransactionRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, RemoteStopTransactionRequest& k) {
     // the required parts of the message
     k.transactionId = j.at("transactionId");
@@ -50,9 +58,17 @@ void to_json(json& j, const RemoteStopTransactionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const RemoteStopTransactionResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::remote_start_stop_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, RemoteStopTransactionResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_remote_start_stop_status(j.at("status"));
+    k.status = conversions::string_to_remote_start_stop_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
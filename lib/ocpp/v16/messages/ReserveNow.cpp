@@ -31,6 +31,20 @@ void to_json(json& j, const ReserveNowRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReserveNowRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("expiryDate", k.expiryDate.to_rfc3339());
+    writer.member("idTag", k.idTag);
+    writer.member("reservationId", k.reservationId);
+    // the optional parts of the message
+    if (k.parentIdTag) {
+        writer.member("parentIdTag", k.parentIdTag.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ReserveNowRequest& k) {
     // the required parts of the message
     k.connectorId = j.at("connectorId");
@@ -63,9 +77,17 @@ void to_json(json& j, const ReserveNowResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ReserveNowResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::reservation_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, ReserveNowResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_reservation_status(j.at("status"));
+    k.status = conversions::string_to_reservation_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
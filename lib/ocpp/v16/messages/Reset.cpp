@@ -24,9 +24,17 @@ void to_json(json& j, const ResetRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ResetRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("type", conversions::reset_type_to_string(k.type));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, ResetRequest& k) {
     // the required parts of the message
-    k.type = conversions::string_to_reset_type(j.at("type"));
+    k.type = conversions::string_to_reset_type(j.at("type").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -50,9 +58,17 @@ void to_json(json& j, const ResetResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const ResetResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::reset_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, ResetResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_reset_status(j.at("status"));
+    k.status = conversions::string_to_reset_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -32,10 +32,22 @@ void to_json(json& j, const SendLocalListRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SendLocalListRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("listVersion", k.listVersion);
+    writer.member("updateType", conversions::update_type_to_string(k.updateType));
+    // the optional parts of the message
+    if (k.localAuthorizationList) {
+        writer.member("localAuthorizationList", k.localAuthorizationList.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SendLocalListRequest& k) {
     // the required parts of the message
     k.listVersion = j.at("listVersion");
-    k.updateType = conversions::string_to_update_type(j.at("updateType"));
+    k.updateType = conversions::string_to_update_type(j.at("updateType").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("localAuthorizationList")) {
@@ -67,9 +79,17 @@ void to_json(json& j, const SendLocalListResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SendLocalListResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::update_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, SendLocalListResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_update_status(j.at("status"));
+    k.status = conversions::string_to_update_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -26,6 +26,15 @@ void to_json(json& j, const SetChargingProfileRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("csChargingProfiles", k.csChargingProfiles);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, SetChargingProfileRequest& k) {
     // the required parts of the message
     k.connectorId = j.at("connectorId");
@@ -53,9 +62,17 @@ void to_json(json& j, const SetChargingProfileResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::charging_profile_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, SetChargingProfileResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_charging_profile_status(j.at("status"));
+    k.status = conversions::string_to_charging_profile_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -24,6 +24,14 @@ void to_json(json& j, const SignCertificateRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SignCertificateRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("csr", k.csr);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, SignCertificateRequest& k) {
     // the required parts of the message
     k.csr = j.at("csr");
@@ -50,9 +58,17 @@ void to_json(json& j, const SignCertificateResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SignCertificateResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, SignCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -32,6 +32,21 @@ void to_json(json& j, const SignedUpdateFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("firmware", k.firmware);
+    // the optional parts of the message
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SignedUpdateFirmwareRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
@@ -65,9 +80,17 @@ void to_json(json& j, const SignedUpdateFirmwareResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const SignedUpdateFirmwareResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::update_firmware_status_enum_type_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, SignedUpdateFirmwareResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_update_firmware_status_enum_type(j.at("status"));
+    k.status = conversions::string_to_update_firmware_status_enum_type(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
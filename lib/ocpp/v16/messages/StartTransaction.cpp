@@ -31,6 +31,20 @@ void to_json(json& j, const StartTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StartTransactionRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("idTag", k.idTag);
+    writer.member("meterStart", k.meterStart);
+    writer.member("timestamp", k.timestamp.to_rfc3339());
+    // the optional parts of the message
+    if (k.reservationId) {
+        writer.member("reservationId", k.reservationId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, StartTransactionRequest& k) {
     // the required parts of the message
     k.connectorId = j.at("connectorId");
@@ -64,6 +78,15 @@ void to_json(json& j, const StartTransactionResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const StartTransactionResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("idTagInfo", k.idTagInfo);
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, StartTransactionResponse& k) {
     // the required parts of the message
     k.idTagInfo = j.at("idTagInfo");
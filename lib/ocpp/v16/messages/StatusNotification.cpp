@@ -39,11 +39,33 @@ void to_json(json& j, const StatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    writer.member("errorCode", conversions::charge_point_error_code_to_string(k.errorCode));
+    writer.member("status", conversions::charge_point_status_to_string(k.status));
+    // the optional parts of the message
+    if (k.info) {
+        writer.member("info", k.info.value());
+    }
+    if (k.timestamp) {
+        writer.member("timestamp", k.timestamp.value().to_rfc3339());
+    }
+    if (k.vendorId) {
+        writer.member("vendorId", k.vendorId.value());
+    }
+    if (k.vendorErrorCode) {
+        writer.member("vendorErrorCode", k.vendorErrorCode.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, StatusNotificationRequest& k) {
     // the required parts of the message
     k.connectorId = j.at("connectorId");
-    k.errorCode = conversions::string_to_charge_point_error_code(j.at("errorCode"));
-    k.status = conversions::string_to_charge_point_status(j.at("status"));
+    k.errorCode = conversions::string_to_charge_point_error_code(j.at("errorCode").get_ref<const std::string&>());
+    k.status = conversions::string_to_charge_point_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("info")) {
@@ -78,6 +100,14 @@ void to_json(json& j, const StatusNotificationResponse& k) {
     (void)k; // no elements to unpack, silence unused parameter warning
 }
 
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    (void)k; // no elements to write, silence unused parameter warning
+}
+
 void from_json(const json& j, StatusNotificationResponse& k) {
     // the required parts of the message
 
@@ -39,6 +39,25 @@ void to_json(json& j, const StopTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StopTransactionRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("meterStop", k.meterStop);
+    writer.member("timestamp", k.timestamp.to_rfc3339());
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    if (k.idTag) {
+        writer.member("idTag", k.idTag.value());
+    }
+    if (k.reason) {
+        writer.member("reason", conversions::reason_to_string(k.reason.value()));
+    }
+    if (k.transactionData) {
+        writer.member("transactionData", k.transactionData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, StopTransactionRequest& k) {
     // the required parts of the message
     k.meterStop = j.at("meterStop");
@@ -50,7 +69,7 @@ void from_json(const json& j, StopTransactionRequest& k) {
         k.idTag.emplace(j.at("idTag"));
     }
     if (j.contains("reason")) {
-        k.reason.emplace(conversions::string_to_reason(j.at("reason")));
+        k.reason.emplace(conversions::string_to_reason(j.at("reason").get_ref<const std::string&>()));
     }
     if (j.contains("transactionData")) {
         json arr = j.at("transactionData");
@@ -82,6 +101,16 @@ void to_json(json& j, const StopTransactionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StopTransactionResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.idTagInfo) {
+        writer.member("idTagInfo", k.idTagInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, StopTransactionResponse& k) {
     // the required parts of the message
 
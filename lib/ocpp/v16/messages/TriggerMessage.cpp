@@ -28,9 +28,20 @@ void to_json(json& j, const TriggerMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TriggerMessageRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestedMessage", conversions::message_trigger_to_string(k.requestedMessage));
+    // the optional parts of the message
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, TriggerMessageRequest& k) {
     // the required parts of the message
-    k.requestedMessage = conversions::string_to_message_trigger(j.at("requestedMessage"));
+    k.requestedMessage = conversions::string_to_message_trigger(j.at("requestedMessage").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("connectorId")) {
@@ -57,9 +68,17 @@ void to_json(json& j, const TriggerMessageResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const TriggerMessageResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::trigger_message_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, TriggerMessageResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_trigger_message_status(j.at("status"));
+    k.status = conversions::string_to_trigger_message_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
@@ -24,6 +24,14 @@ void to_json(json& j, const UnlockConnectorRequest& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const UnlockConnectorRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("connectorId", k.connectorId);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, UnlockConnectorRequest& k) {
     // the required parts of the message
     k.connectorId = j.at("connectorId");
@@ -50,9 +58,17 @@ void to_json(json& j, const UnlockConnectorResponse& k) {
     // the optional parts of the message
 }
 
+void write_json(JsonWriter& writer, const UnlockConnectorResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::unlock_status_to_string(k.status));
+    // the optional parts of the message
+    writer.end_object();
+}
+
 void from_json(const json& j, UnlockConnectorResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_unlock_status(j.at("status"));
+    k.status = conversions::string_to_unlock_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
 }
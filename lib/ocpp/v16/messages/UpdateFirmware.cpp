@@ -32,6 +32,21 @@ void to_json(json& j, const UpdateFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("location", k.location);
+    writer.member("retrieveDate", k.retrieveDate.to_rfc3339());
+    // the optional parts of the message
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, UpdateFirmwareRequest& k) {
     // the required parts of the message
     k.location = j.at("location");
@@ -64,6 +79,14 @@ void to_json(json& j, const UpdateFirmwareResponse& k) {
     (void)k; // no elements to unpack, silence unused parameter warning
 }
 
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    writer.end_object();
+    (void)k; // no elements to write, silence unused parameter warning
+}
+
 void from_json(const json& j, UpdateFirmwareResponse& k) {
     // the required parts of the message
 
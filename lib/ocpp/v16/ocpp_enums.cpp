@@ -4,7 +4,9 @@
 
 #include <ocpp/v16/ocpp_enums.hpp>
 
+#include <iterator>
 #include <string>
+#include <string_view>
 
 #include <ocpp/common/types.hpp>
 
@@ -14,37 +16,59 @@ namespace v16 {
 // from: AuthorizeResponse
 namespace conversions {
 std::string authorization_status_to_string(AuthorizationStatus e) {
-    switch (e) {
-    case AuthorizationStatus::Accepted:
-        return "Accepted";
-    case AuthorizationStatus::Blocked:
-        return "Blocked";
-    case AuthorizationStatus::Expired:
-        return "Expired";
-    case AuthorizationStatus::Invalid:
-        return "Invalid";
-    case AuthorizationStatus::ConcurrentTx:
-        return "ConcurrentTx";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Blocked",
+        "Expired",
+        "Invalid",
+        "ConcurrentTx",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(AuthorizationStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(AuthorizationStatus::Blocked) == 1);
+    static_assert(static_cast<std::size_t>(AuthorizationStatus::Expired) == 2);
+    static_assert(static_cast<std::size_t>(AuthorizationStatus::Invalid) == 3);
+    static_assert(static_cast<std::size_t>(AuthorizationStatus::ConcurrentTx) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "AuthorizationStatus"};
 }
 
-AuthorizationStatus string_to_authorization_status(const std::string& s) {
-    if (s == "Accepted") {
-        return AuthorizationStatus::Accepted;
-    }
-    if (s == "Blocked") {
-        return AuthorizationStatus::Blocked;
-    }
-    if (s == "Expired") {
-        return AuthorizationStatus::Expired;
-    }
-    if (s == "Invalid") {
-        return AuthorizationStatus::Invalid;
-    }
-    if (s == "ConcurrentTx") {
-        return AuthorizationStatus::ConcurrentTx;
+AuthorizationStatus string_to_authorization_status(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        switch (s[0]) {
+        case 'B':
+            if (s == "Blocked") {
+                return AuthorizationStatus::Blocked;
+            }
+            break;
+        case 'E':
+            if (s == "Expired") {
+                return AuthorizationStatus::Expired;
+            }
+            break;
+        case 'I':
+            if (s == "Invalid") {
+                return AuthorizationStatus::Invalid;
+            }
+            break;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return AuthorizationStatus::Accepted;
+        }
+        break;
+    case 12:
+        if (s == "ConcurrentTx") {
+            return AuthorizationStatus::ConcurrentTx;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AuthorizationStatus"};
@@ -59,27 +83,45 @@ std::ostream& operator<<(std::ostream& os, const AuthorizationStatus& authorizat
 // from: BootNotificationResponse
 namespace conversions {
 std::string registration_status_to_string(RegistrationStatus e) {
-    switch (e) {
-    case RegistrationStatus::Accepted:
-        return "Accepted";
-    case RegistrationStatus::Pending:
-        return "Pending";
-    case RegistrationStatus::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Pending",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(RegistrationStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(RegistrationStatus::Pending) == 1);
+    static_assert(static_cast<std::size_t>(RegistrationStatus::Rejected) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "RegistrationStatus"};
 }
 
-RegistrationStatus string_to_registration_status(const std::string& s) {
-    if (s == "Accepted") {
-        return RegistrationStatus::Accepted;
-    }
-    if (s == "Pending") {
-        return RegistrationStatus::Pending;
-    }
-    if (s == "Rejected") {
-        return RegistrationStatus::Rejected;
+RegistrationStatus string_to_registration_status(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Pending") {
+            return RegistrationStatus::Pending;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return RegistrationStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return RegistrationStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RegistrationStatus"};
@@ -94,22 +136,38 @@ std::ostream& operator<<(std::ostream& os, const RegistrationStatus& registratio
 // from: CancelReservationResponse
 namespace conversions {
 std::string cancel_reservation_status_to_string(CancelReservationStatus e) {
-    switch (e) {
-    case CancelReservationStatus::Accepted:
-        return "Accepted";
-    case CancelReservationStatus::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(CancelReservationStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(CancelReservationStatus::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "CancelReservationStatus"};
 }
 
-CancelReservationStatus string_to_cancel_reservation_status(const std::string& s) {
-    if (s == "Accepted") {
-        return CancelReservationStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return CancelReservationStatus::Rejected;
+CancelReservationStatus string_to_cancel_reservation_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return CancelReservationStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return CancelReservationStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CancelReservationStatus"};
@@ -124,22 +182,38 @@ std::ostream& operator<<(std::ostream& os, const CancelReservationStatus& cancel
 // from: CertificateSignedResponse
 namespace conversions {
 std::string certificate_signed_status_enum_type_to_string(CertificateSignedStatusEnumType e) {
-    switch (e) {
-    case CertificateSignedStatusEnumType::Accepted:
-        return "Accepted";
-    case CertificateSignedStatusEnumType::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(CertificateSignedStatusEnumType::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(CertificateSignedStatusEnumType::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "CertificateSignedStatusEnumType"};
 }
 
-CertificateSignedStatusEnumType string_to_certificate_signed_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return CertificateSignedStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return CertificateSignedStatusEnumType::Rejected;
+CertificateSignedStatusEnumType string_to_certificate_signed_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return CertificateSignedStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return CertificateSignedStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CertificateSignedStatusEnumType"};
@@ -154,22 +228,34 @@ std::ostream& operator<<(std::ostream& os, const CertificateSignedStatusEnumType
 // from: ChangeAvailabilityRequest
 namespace conversions {
 std::string availability_type_to_string(AvailabilityType e) {
-    switch (e) {
-    case AvailabilityType::Inoperative:
-        return "Inoperative";
-    case AvailabilityType::Operative:
-        return "Operative";
+    static constexpr std::string_view strings[] = {
+        "Inoperative",
+        "Operative",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(AvailabilityType::Inoperative) == 0);
+    static_assert(static_cast<std::size_t>(AvailabilityType::Operative) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "AvailabilityType"};
 }
 
-AvailabilityType string_to_availability_type(const std::string& s) {
-    if (s == "Inoperative") {
-        return AvailabilityType::Inoperative;
-    }
-    if (s == "Operative") {
-        return AvailabilityType::Operative;
+AvailabilityType string_to_availability_type(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "Operative") {
+            return AvailabilityType::Operative;
+        }
+        break;
+    case 11:
+        if (s == "Inoperative") {
+            return AvailabilityType::Inoperative;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AvailabilityType"};
@@ -184,27 +270,45 @@ std::ostream& operator<<(std::ostream& os, const AvailabilityType& availability_
 // from: ChangeAvailabilityResponse
 namespace conversions {
 std::string availability_status_to_string(AvailabilityStatus e) {
-    switch (e) {
-    case AvailabilityStatus::Accepted:
-        return "Accepted";
-    case AvailabilityStatus::Rejected:
-        return "Rejected";
-    case AvailabilityStatus::Scheduled:
-        return "Scheduled";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "Scheduled",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(AvailabilityStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(AvailabilityStatus::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(AvailabilityStatus::Scheduled) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "AvailabilityStatus"};
 }
 
-AvailabilityStatus string_to_availability_status(const std::string& s) {
-    if (s == "Accepted") {
-        return AvailabilityStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return AvailabilityStatus::Rejected;
-    }
-    if (s == "Scheduled") {
-        return AvailabilityStatus::Scheduled;
+AvailabilityStatus string_to_availability_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return AvailabilityStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return AvailabilityStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Scheduled") {
+            return AvailabilityStatus::Scheduled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AvailabilityStatus"};
@@ -219,32 +323,52 @@ std::ostream& operator<<(std::ostream& os, const AvailabilityStatus& availabilit
 // from: ChangeConfigurationResponse
 namespace conversions {
 std::string configuration_status_to_string(ConfigurationStatus e) {
-    switch (e) {
-    case ConfigurationStatus::Accepted:
-        return "Accepted";
-    case ConfigurationStatus::Rejected:
-        return "Rejected";
-    case ConfigurationStatus::RebootRequired:
-        return "RebootRequired";
-    case ConfigurationStatus::NotSupported:
-        return "NotSupported";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "RebootRequired",
+        "NotSupported",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ConfigurationStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ConfigurationStatus::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(ConfigurationStatus::RebootRequired) == 2);
+    static_assert(static_cast<std::size_t>(ConfigurationStatus::NotSupported) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ConfigurationStatus"};
 }
 
-ConfigurationStatus string_to_configuration_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ConfigurationStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ConfigurationStatus::Rejected;
-    }
-    if (s == "RebootRequired") {
-        return ConfigurationStatus::RebootRequired;
-    }
-    if (s == "NotSupported") {
-        return ConfigurationStatus::NotSupported;
+ConfigurationStatus string_to_configuration_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ConfigurationStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ConfigurationStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return ConfigurationStatus::NotSupported;
+        }
+        break;
+    case 14:
+        if (s == "RebootRequired") {
+            return ConfigurationStatus::RebootRequired;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ConfigurationStatus"};
@@ -259,22 +383,38 @@ std::ostream& operator<<(std::ostream& os, const ConfigurationStatus& configurat
 // from: ClearCacheResponse
 namespace conversions {
 std::string clear_cache_status_to_string(ClearCacheStatus e) {
-    switch (e) {
-    case ClearCacheStatus::Accepted:
-        return "Accepted";
-    case ClearCacheStatus::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ClearCacheStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ClearCacheStatus::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ClearCacheStatus"};
 }
 
-ClearCacheStatus string_to_clear_cache_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearCacheStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ClearCacheStatus::Rejected;
+ClearCacheStatus string_to_clear_cache_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ClearCacheStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ClearCacheStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearCacheStatus"};
@@ -289,27 +429,41 @@ std::ostream& operator<<(std::ostream& os, const ClearCacheStatus& clear_cache_s
 // from: ClearChargingProfileRequest
 namespace conversions {
 std::string charging_profile_purpose_type_to_string(ChargingProfilePurposeType e) {
-    switch (e) {
-    case ChargingProfilePurposeType::ChargePointMaxProfile:
-        return "ChargePointMaxProfile";
-    case ChargingProfilePurposeType::TxDefaultProfile:
-        return "TxDefaultProfile";
-    case ChargingProfilePurposeType::TxProfile:
-        return "TxProfile";
+    static constexpr std::string_view strings[] = {
+        "ChargePointMaxProfile",
+        "TxDefaultProfile",
+        "TxProfile",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargingProfilePurposeType::ChargePointMaxProfile) == 0);
+    static_assert(static_cast<std::size_t>(ChargingProfilePurposeType::TxDefaultProfile) == 1);
+    static_assert(static_cast<std::size_t>(ChargingProfilePurposeType::TxProfile) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargingProfilePurposeType"};
 }
 
-ChargingProfilePurposeType string_to_charging_profile_purpose_type(const std::string& s) {
-    if (s == "ChargePointMaxProfile") {
-        return ChargingProfilePurposeType::ChargePointMaxProfile;
-    }
-    if (s == "TxDefaultProfile") {
-        return ChargingProfilePurposeType::TxDefaultProfile;
-    }
-    if (s == "TxProfile") {
-        return ChargingProfilePurposeType::TxProfile;
+ChargingProfilePurposeType string_to_charging_profile_purpose_type(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "TxProfile") {
+            return ChargingProfilePurposeType::TxProfile;
+        }
+        break;
+    case 16:
+        if (s == "TxDefaultProfile") {
+            return ChargingProfilePurposeType::TxDefaultProfile;
+        }
+        break;
+    case 21:
+        if (s == "ChargePointMaxProfile") {
+            return ChargingProfilePurposeType::ChargePointMaxProfile;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfilePurposeType"};
@@ -324,22 +478,34 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfilePurposeType& cha
 // from: ClearChargingProfileResponse
 namespace conversions {
 std::string clear_charging_profile_status_to_string(ClearChargingProfileStatus e) {
-    switch (e) {
-    case ClearChargingProfileStatus::Accepted:
-        return "Accepted";
-    case ClearChargingProfileStatus::Unknown:
-        return "Unknown";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Unknown",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ClearChargingProfileStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ClearChargingProfileStatus::Unknown) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ClearChargingProfileStatus"};
 }
 
-ClearChargingProfileStatus string_to_clear_charging_profile_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearChargingProfileStatus::Accepted;
-    }
-    if (s == "Unknown") {
-        return ClearChargingProfileStatus::Unknown;
+ClearChargingProfileStatus string_to_clear_charging_profile_status(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return ClearChargingProfileStatus::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ClearChargingProfileStatus::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearChargingProfileStatus"};
@@ -354,32 +520,52 @@ std::ostream& operator<<(std::ostream& os, const ClearChargingProfileStatus& cle
 // from: DataTransferResponse
 namespace conversions {
 std::string data_transfer_status_to_string(DataTransferStatus e) {
-    switch (e) {
-    case DataTransferStatus::Accepted:
-        return "Accepted";
-    case DataTransferStatus::Rejected:
-        return "Rejected";
-    case DataTransferStatus::UnknownMessageId:
-        return "UnknownMessageId";
-    case DataTransferStatus::UnknownVendorId:
-        return "UnknownVendorId";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "UnknownMessageId",
+        "UnknownVendorId",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(DataTransferStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(DataTransferStatus::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(DataTransferStatus::UnknownMessageId) == 2);
+    static_assert(static_cast<std::size_t>(DataTransferStatus::UnknownVendorId) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "DataTransferStatus"};
 }
 
-DataTransferStatus string_to_data_transfer_status(const std::string& s) {
-    if (s == "Accepted") {
-        return DataTransferStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return DataTransferStatus::Rejected;
-    }
-    if (s == "UnknownMessageId") {
-        return DataTransferStatus::UnknownMessageId;
-    }
-    if (s == "UnknownVendorId") {
-        return DataTransferStatus::UnknownVendorId;
+DataTransferStatus string_to_data_transfer_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return DataTransferStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return DataTransferStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVendorId") {
+            return DataTransferStatus::UnknownVendorId;
+        }
+        break;
+    case 16:
+        if (s == "UnknownMessageId") {
+            return DataTransferStatus::UnknownMessageId;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DataTransferStatus"};
@@ -394,27 +580,45 @@ std::ostream& operator<<(std::ostream& os, const DataTransferStatus& data_transf
 // from: DeleteCertificateRequest
 namespace conversions {
 std::string hash_algorithm_enum_type_to_string(HashAlgorithmEnumType e) {
-    switch (e) {
-    case HashAlgorithmEnumType::SHA256:
-        return "SHA256";
-    case HashAlgorithmEnumType::SHA384:
-        return "SHA384";
-    case HashAlgorithmEnumType::SHA512:
-        return "SHA512";
+    static constexpr std::string_view strings[] = {
+        "SHA256",
+        "SHA384",
+        "SHA512",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(HashAlgorithmEnumType::SHA256) == 0);
+    static_assert(static_cast<std::size_t>(HashAlgorithmEnumType::SHA384) == 1);
+    static_assert(static_cast<std::size_t>(HashAlgorithmEnumType::SHA512) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "HashAlgorithmEnumType"};
 }
 
-HashAlgorithmEnumType string_to_hash_algorithm_enum_type(const std::string& s) {
-    if (s == "SHA256") {
-        return HashAlgorithmEnumType::SHA256;
-    }
-    if (s == "SHA384") {
-        return HashAlgorithmEnumType::SHA384;
-    }
-    if (s == "SHA512") {
-        return HashAlgorithmEnumType::SHA512;
+HashAlgorithmEnumType string_to_hash_algorithm_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        switch (s[3]) {
+        case '2':
+            if (s == "SHA256") {
+                return HashAlgorithmEnumType::SHA256;
+            }
+            break;
+        case '3':
+            if (s == "SHA384") {
+                return HashAlgorithmEnumType::SHA384;
+            }
+            break;
+        case '5':
+            if (s == "SHA512") {
+                return HashAlgorithmEnumType::SHA512;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "HashAlgorithmEnumType"};
@@ -429,27 +633,45 @@ std::ostream& operator<<(std::ostream& os, const HashAlgorithmEnumType& hash_alg
 // from: DeleteCertificateResponse
 namespace conversions {
 std::string delete_certificate_status_enum_type_to_string(DeleteCertificateStatusEnumType e) {
-    switch (e) {
-    case DeleteCertificateStatusEnumType::Accepted:
-        return "Accepted";
-    case DeleteCertificateStatusEnumType::Failed:
-        return "Failed";
-    case DeleteCertificateStatusEnumType::NotFound:
-        return "NotFound";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Failed",
+        "NotFound",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(DeleteCertificateStatusEnumType::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(DeleteCertificateStatusEnumType::Failed) == 1);
+    static_assert(static_cast<std::size_t>(DeleteCertificateStatusEnumType::NotFound) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "DeleteCertificateStatusEnumType"};
 }
 
-DeleteCertificateStatusEnumType string_to_delete_certificate_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return DeleteCertificateStatusEnumType::Accepted;
-    }
-    if (s == "Failed") {
-        return DeleteCertificateStatusEnumType::Failed;
-    }
-    if (s == "NotFound") {
-        return DeleteCertificateStatusEnumType::NotFound;
+DeleteCertificateStatusEnumType string_to_delete_certificate_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return DeleteCertificateStatusEnumType::Failed;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return DeleteCertificateStatusEnumType::Accepted;
+            }
+            break;
+        case 'N':
+            if (s == "NotFound") {
+                return DeleteCertificateStatusEnumType::NotFound;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DeleteCertificateStatusEnumType"};
@@ -464,32 +686,48 @@ std::ostream& operator<<(std::ostream& os, const DeleteCertificateStatusEnumType
 // from: DiagnosticsStatusNotificationRequest
 namespace conversions {
 std::string diagnostics_status_to_string(DiagnosticsStatus e) {
-    switch (e) {
-    case DiagnosticsStatus::Idle:
-        return "Idle";
-    case DiagnosticsStatus::Uploaded:
-        return "Uploaded";
-    case DiagnosticsStatus::UploadFailed:
-        return "UploadFailed";
-    case DiagnosticsStatus::Uploading:
-        return "Uploading";
+    static constexpr std::string_view strings[] = {
+        "Idle",
+        "Uploaded",
+        "UploadFailed",
+        "Uploading",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(DiagnosticsStatus::Idle) == 0);
+    static_assert(static_cast<std::size_t>(DiagnosticsStatus::Uploaded) == 1);
+    static_assert(static_cast<std::size_t>(DiagnosticsStatus::UploadFailed) == 2);
+    static_assert(static_cast<std::size_t>(DiagnosticsStatus::Uploading) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "DiagnosticsStatus"};
 }
 
-DiagnosticsStatus string_to_diagnostics_status(const std::string& s) {
-    if (s == "Idle") {
-        return DiagnosticsStatus::Idle;
-    }
-    if (s == "Uploaded") {
-        return DiagnosticsStatus::Uploaded;
-    }
-    if (s == "UploadFailed") {
-        return DiagnosticsStatus::UploadFailed;
-    }
-    if (s == "Uploading") {
-        return DiagnosticsStatus::Uploading;
+DiagnosticsStatus string_to_diagnostics_status(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return DiagnosticsStatus::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Uploaded") {
+            return DiagnosticsStatus::Uploaded;
+        }
+        break;
+    case 9:
+        if (s == "Uploading") {
+            return DiagnosticsStatus::Uploading;
+        }
+        break;
+    case 12:
+        if (s == "UploadFailed") {
+            return DiagnosticsStatus::UploadFailed;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DiagnosticsStatus"};
@@ -504,47 +742,73 @@ std::ostream& operator<<(std::ostream& os, const DiagnosticsStatus& diagnostics_
 // from: ExtendedTriggerMessageRequest
 namespace conversions {
 std::string message_trigger_enum_type_to_string(MessageTriggerEnumType e) {
-    switch (e) {
-    case MessageTriggerEnumType::BootNotification:
-        return "BootNotification";
-    case MessageTriggerEnumType::LogStatusNotification:
-        return "LogStatusNotification";
-    case MessageTriggerEnumType::FirmwareStatusNotification:
-        return "FirmwareStatusNotification";
-    case MessageTriggerEnumType::Heartbeat:
-        return "Heartbeat";
-    case MessageTriggerEnumType::MeterValues:
-        return "MeterValues";
-    case MessageTriggerEnumType::SignChargePointCertificate:
-        return "SignChargePointCertificate";
-    case MessageTriggerEnumType::StatusNotification:
-        return "StatusNotification";
+    static constexpr std::string_view strings[] = {
+        "BootNotification",
+        "LogStatusNotification",
+        "FirmwareStatusNotification",
+        "Heartbeat",
+        "MeterValues",
+        "SignChargePointCertificate",
+        "StatusNotification",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MessageTriggerEnumType::BootNotification) == 0);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnumType::LogStatusNotification) == 1);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnumType::FirmwareStatusNotification) == 2);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnumType::Heartbeat) == 3);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnumType::MeterValues) == 4);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnumType::SignChargePointCertificate) == 5);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnumType::StatusNotification) == 6);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MessageTriggerEnumType"};
 }
 
-MessageTriggerEnumType string_to_message_trigger_enum_type(const std::string& s) {
-    if (s == "BootNotification") {
-        return MessageTriggerEnumType::BootNotification;
-    }
-    if (s == "LogStatusNotification") {
-        return MessageTriggerEnumType::LogStatusNotification;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageTriggerEnumType::FirmwareStatusNotification;
-    }
-    if (s == "Heartbeat") {
-        return MessageTriggerEnumType::Heartbeat;
-    }
-    if (s == "MeterValues") {
-        return MessageTriggerEnumType::MeterValues;
-    }
-    if (s == "SignChargePointCertificate") {
-        return MessageTriggerEnumType::SignChargePointCertificate;
-    }
-    if (s == "StatusNotification") {
-        return MessageTriggerEnumType::StatusNotification;
+MessageTriggerEnumType string_to_message_trigger_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "Heartbeat") {
+            return MessageTriggerEnumType::Heartbeat;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageTriggerEnumType::MeterValues;
+        }
+        break;
+    case 16:
+        if (s == "BootNotification") {
+            return MessageTriggerEnumType::BootNotification;
+        }
+        break;
+    case 18:
+        if (s == "StatusNotification") {
+            return MessageTriggerEnumType::StatusNotification;
+        }
+        break;
+    case 21:
+        if (s == "LogStatusNotification") {
+            return MessageTriggerEnumType::LogStatusNotification;
+        }
+        break;
+    case 26:
+        switch (s[0]) {
+        case 'F':
+            if (s == "FirmwareStatusNotification") {
+                return MessageTriggerEnumType::FirmwareStatusNotification;
+            }
+            break;
+        case 'S':
+            if (s == "SignChargePointCertificate") {
+                return MessageTriggerEnumType::SignChargePointCertificate;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageTriggerEnumType"};
@@ -559,27 +823,45 @@ std::ostream& operator<<(std::ostream& os, const MessageTriggerEnumType& message
 // from: ExtendedTriggerMessageResponse
 namespace conversions {
 std::string trigger_message_status_enum_type_to_string(TriggerMessageStatusEnumType e) {
-    switch (e) {
-    case TriggerMessageStatusEnumType::Accepted:
-        return "Accepted";
-    case TriggerMessageStatusEnumType::Rejected:
-        return "Rejected";
-    case TriggerMessageStatusEnumType::NotImplemented:
-        return "NotImplemented";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "NotImplemented",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(TriggerMessageStatusEnumType::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(TriggerMessageStatusEnumType::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(TriggerMessageStatusEnumType::NotImplemented) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "TriggerMessageStatusEnumType"};
 }
 
-TriggerMessageStatusEnumType string_to_trigger_message_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return TriggerMessageStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return TriggerMessageStatusEnumType::Rejected;
-    }
-    if (s == "NotImplemented") {
-        return TriggerMessageStatusEnumType::NotImplemented;
+TriggerMessageStatusEnumType string_to_trigger_message_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return TriggerMessageStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return TriggerMessageStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "NotImplemented") {
+            return TriggerMessageStatusEnumType::NotImplemented;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "TriggerMessageStatusEnumType"};
@@ -594,47 +876,73 @@ std::ostream& operator<<(std::ostream& os, const TriggerMessageStatusEnumType& t
 // from: FirmwareStatusNotificationRequest
 namespace conversions {
 std::string firmware_status_to_string(FirmwareStatus e) {
-    switch (e) {
-    case FirmwareStatus::Downloaded:
-        return "Downloaded";
-    case FirmwareStatus::DownloadFailed:
-        return "DownloadFailed";
-    case FirmwareStatus::Downloading:
-        return "Downloading";
-    case FirmwareStatus::Idle:
-        return "Idle";
-    case FirmwareStatus::InstallationFailed:
-        return "InstallationFailed";
-    case FirmwareStatus::Installing:
-        return "Installing";
-    case FirmwareStatus::Installed:
-        return "Installed";
+    static constexpr std::string_view strings[] = {
+        "Downloaded",
+        "DownloadFailed",
+        "Downloading",
+        "Idle",
+        "InstallationFailed",
+        "Installing",
+        "Installed",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(FirmwareStatus::Downloaded) == 0);
+    static_assert(static_cast<std::size_t>(FirmwareStatus::DownloadFailed) == 1);
+    static_assert(static_cast<std::size_t>(FirmwareStatus::Downloading) == 2);
+    static_assert(static_cast<std::size_t>(FirmwareStatus::Idle) == 3);
+    static_assert(static_cast<std::size_t>(FirmwareStatus::InstallationFailed) == 4);
+    static_assert(static_cast<std::size_t>(FirmwareStatus::Installing) == 5);
+    static_assert(static_cast<std::size_t>(FirmwareStatus::Installed) == 6);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "FirmwareStatus"};
 }
 
-FirmwareStatus string_to_firmware_status(const std::string& s) {
-    if (s == "Downloaded") {
-        return FirmwareStatus::Downloaded;
-    }
-    if (s == "DownloadFailed") {
-        return FirmwareStatus::DownloadFailed;
-    }
-    if (s == "Downloading") {
-        return FirmwareStatus::Downloading;
-    }
-    if (s == "Idle") {
-        return FirmwareStatus::Idle;
-    }
-    if (s == "InstallationFailed") {
-        return FirmwareStatus::InstallationFailed;
-    }
-    if (s == "Installing") {
-        return FirmwareStatus::Installing;
-    }
-    if (s == "Installed") {
-        return FirmwareStatus::Installed;
+FirmwareStatus string_to_firmware_status(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return FirmwareStatus::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Installed") {
+            return FirmwareStatus::Installed;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'D':
+            if (s == "Downloaded") {
+                return FirmwareStatus::Downloaded;
+            }
+            break;
+        case 'I':
+            if (s == "Installing") {
+                return FirmwareStatus::Installing;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return FirmwareStatus::Downloading;
+        }
+        break;
+    case 14:
+        if (s == "DownloadFailed") {
+            return FirmwareStatus::DownloadFailed;
+        }
+        break;
+    case 18:
+        if (s == "InstallationFailed") {
+            return FirmwareStatus::InstallationFailed;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "FirmwareStatus"};
@@ -649,22 +957,38 @@ std::ostream& operator<<(std::ostream& os, const FirmwareStatus& firmware_status
 // from: GetCompositeScheduleRequest
 namespace conversions {
 std::string charging_rate_unit_to_string(ChargingRateUnit e) {
-    switch (e) {
-    case ChargingRateUnit::A:
-        return "A";
-    case ChargingRateUnit::W:
-        return "W";
+    static constexpr std::string_view strings[] = {
+        "A",
+        "W",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargingRateUnit::A) == 0);
+    static_assert(static_cast<std::size_t>(ChargingRateUnit::W) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargingRateUnit"};
 }
 
-ChargingRateUnit string_to_charging_rate_unit(const std::string& s) {
-    if (s == "A") {
-        return ChargingRateUnit::A;
-    }
-    if (s == "W") {
-        return ChargingRateUnit::W;
+ChargingRateUnit string_to_charging_rate_unit(std::string_view s) {
+    switch (s.size()) {
+    case 1:
+        switch (s[0]) {
+        case 'A':
+            if (s == "A") {
+                return ChargingRateUnit::A;
+            }
+            break;
+        case 'W':
+            if (s == "W") {
+                return ChargingRateUnit::W;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingRateUnit"};
@@ -679,22 +1003,38 @@ std::ostream& operator<<(std::ostream& os, const ChargingRateUnit& charging_rate
 // from: GetCompositeScheduleResponse
 namespace conversions {
 std::string get_composite_schedule_status_to_string(GetCompositeScheduleStatus e) {
-    switch (e) {
-    case GetCompositeScheduleStatus::Accepted:
-        return "Accepted";
-    case GetCompositeScheduleStatus::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GetCompositeScheduleStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(GetCompositeScheduleStatus::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GetCompositeScheduleStatus"};
 }
 
-GetCompositeScheduleStatus string_to_get_composite_schedule_status(const std::string& s) {
-    if (s == "Accepted") {
-        return GetCompositeScheduleStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return GetCompositeScheduleStatus::Rejected;
+GetCompositeScheduleStatus string_to_get_composite_schedule_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GetCompositeScheduleStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return GetCompositeScheduleStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetCompositeScheduleStatus"};
@@ -709,22 +1049,34 @@ std::ostream& operator<<(std::ostream& os, const GetCompositeScheduleStatus& get
 // from: GetInstalledCertificateIdsRequest
 namespace conversions {
 std::string certificate_use_enum_type_to_string(CertificateUseEnumType e) {
-    switch (e) {
-    case CertificateUseEnumType::CentralSystemRootCertificate:
-        return "CentralSystemRootCertificate";
-    case CertificateUseEnumType::ManufacturerRootCertificate:
-        return "ManufacturerRootCertificate";
+    static constexpr std::string_view strings[] = {
+        "CentralSystemRootCertificate",
+        "ManufacturerRootCertificate",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(CertificateUseEnumType::CentralSystemRootCertificate) == 0);
+    static_assert(static_cast<std::size_t>(CertificateUseEnumType::ManufacturerRootCertificate) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "CertificateUseEnumType"};
 }
 
-CertificateUseEnumType string_to_certificate_use_enum_type(const std::string& s) {
-    if (s == "CentralSystemRootCertificate") {
-        return CertificateUseEnumType::CentralSystemRootCertificate;
-    }
-    if (s == "ManufacturerRootCertificate") {
-        return CertificateUseEnumType::ManufacturerRootCertificate;
+CertificateUseEnumType string_to_certificate_use_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 27:
+        if (s == "ManufacturerRootCertificate") {
+            return CertificateUseEnumType::ManufacturerRootCertificate;
+        }
+        break;
+    case 28:
+        if (s == "CentralSystemRootCertificate") {
+            return CertificateUseEnumType::CentralSystemRootCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CertificateUseEnumType"};
@@ -739,22 +1091,38 @@ std::ostream& operator<<(std::ostream& os, const CertificateUseEnumType& certifi
 // from: GetInstalledCertificateIdsResponse
 namespace conversions {
 std::string get_installed_certificate_status_enum_type_to_string(GetInstalledCertificateStatusEnumType e) {
-    switch (e) {
-    case GetInstalledCertificateStatusEnumType::Accepted:
-        return "Accepted";
-    case GetInstalledCertificateStatusEnumType::NotFound:
-        return "NotFound";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "NotFound",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GetInstalledCertificateStatusEnumType::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(GetInstalledCertificateStatusEnumType::NotFound) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GetInstalledCertificateStatusEnumType"};
 }
 
-GetInstalledCertificateStatusEnumType string_to_get_installed_certificate_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return GetInstalledCertificateStatusEnumType::Accepted;
-    }
-    if (s == "NotFound") {
-        return GetInstalledCertificateStatusEnumType::NotFound;
+GetInstalledCertificateStatusEnumType string_to_get_installed_certificate_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GetInstalledCertificateStatusEnumType::Accepted;
+            }
+            break;
+        case 'N':
+            if (s == "NotFound") {
+                return GetInstalledCertificateStatusEnumType::NotFound;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetInstalledCertificateStatusEnumType"};
@@ -770,22 +1138,34 @@ std::ostream& operator<<(std::ostream& os,
 // from: GetLogRequest
 namespace conversions {
 std::string log_enum_type_to_string(LogEnumType e) {
-    switch (e) {
-    case LogEnumType::DiagnosticsLog:
-        return "DiagnosticsLog";
-    case LogEnumType::SecurityLog:
-        return "SecurityLog";
+    static constexpr std::string_view strings[] = {
+        "DiagnosticsLog",
+        "SecurityLog",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(LogEnumType::DiagnosticsLog) == 0);
+    static_assert(static_cast<std::size_t>(LogEnumType::SecurityLog) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "LogEnumType"};
 }
 
-LogEnumType string_to_log_enum_type(const std::string& s) {
-    if (s == "DiagnosticsLog") {
-        return LogEnumType::DiagnosticsLog;
-    }
-    if (s == "SecurityLog") {
-        return LogEnumType::SecurityLog;
+LogEnumType string_to_log_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 11:
+        if (s == "SecurityLog") {
+            return LogEnumType::SecurityLog;
+        }
+        break;
+    case 14:
+        if (s == "DiagnosticsLog") {
+            return LogEnumType::DiagnosticsLog;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "LogEnumType"};
@@ -800,27 +1180,45 @@ std::ostream& operator<<(std::ostream& os, const LogEnumType& log_enum_type) {
 // from: GetLogResponse
 namespace conversions {
 std::string log_status_enum_type_to_string(LogStatusEnumType e) {
-    switch (e) {
-    case LogStatusEnumType::Accepted:
-        return "Accepted";
-    case LogStatusEnumType::Rejected:
-        return "Rejected";
-    case LogStatusEnumType::AcceptedCanceled:
-        return "AcceptedCanceled";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "AcceptedCanceled",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(LogStatusEnumType::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(LogStatusEnumType::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(LogStatusEnumType::AcceptedCanceled) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "LogStatusEnumType"};
 }
 
-LogStatusEnumType string_to_log_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return LogStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return LogStatusEnumType::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return LogStatusEnumType::AcceptedCanceled;
+LogStatusEnumType string_to_log_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return LogStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return LogStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return LogStatusEnumType::AcceptedCanceled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "LogStatusEnumType"};
@@ -835,27 +1233,45 @@ std::ostream& operator<<(std::ostream& os, const LogStatusEnumType& log_status_e
 // from: InstallCertificateResponse
 namespace conversions {
 std::string install_certificate_status_enum_type_to_string(InstallCertificateStatusEnumType e) {
-    switch (e) {
-    case InstallCertificateStatusEnumType::Accepted:
-        return "Accepted";
-    case InstallCertificateStatusEnumType::Failed:
-        return "Failed";
-    case InstallCertificateStatusEnumType::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Failed",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(InstallCertificateStatusEnumType::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(InstallCertificateStatusEnumType::Failed) == 1);
+    static_assert(static_cast<std::size_t>(InstallCertificateStatusEnumType::Rejected) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "InstallCertificateStatusEnumType"};
 }
 
-InstallCertificateStatusEnumType string_to_install_certificate_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return InstallCertificateStatusEnumType::Accepted;
-    }
-    if (s == "Failed") {
-        return InstallCertificateStatusEnumType::Failed;
-    }
-    if (s == "Rejected") {
-        return InstallCertificateStatusEnumType::Rejected;
+InstallCertificateStatusEnumType string_to_install_certificate_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return InstallCertificateStatusEnumType::Failed;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return InstallCertificateStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return InstallCertificateStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "InstallCertificateStatusEnumType"};
@@ -871,47 +1287,69 @@ std::ostream& operator<<(std::ostream& os,
 // from: LogStatusNotificationRequest
 namespace conversions {
 std::string upload_log_status_enum_type_to_string(UploadLogStatusEnumType e) {
-    switch (e) {
-    case UploadLogStatusEnumType::BadMessage:
-        return "BadMessage";
-    case UploadLogStatusEnumType::Idle:
-        return "Idle";
-    case UploadLogStatusEnumType::NotSupportedOperation:
-        return "NotSupportedOperation";
-    case UploadLogStatusEnumType::PermissionDenied:
-        return "PermissionDenied";
-    case UploadLogStatusEnumType::Uploaded:
-        return "Uploaded";
-    case UploadLogStatusEnumType::UploadFailure:
-        return "UploadFailure";
-    case UploadLogStatusEnumType::Uploading:
-        return "Uploading";
+    static constexpr std::string_view strings[] = {
+        "BadMessage",
+        "Idle",
+        "NotSupportedOperation",
+        "PermissionDenied",
+        "Uploaded",
+        "UploadFailure",
+        "Uploading",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnumType::BadMessage) == 0);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnumType::Idle) == 1);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnumType::NotSupportedOperation) == 2);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnumType::PermissionDenied) == 3);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnumType::Uploaded) == 4);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnumType::UploadFailure) == 5);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnumType::Uploading) == 6);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UploadLogStatusEnumType"};
 }
 
-UploadLogStatusEnumType string_to_upload_log_status_enum_type(const std::string& s) {
-    if (s == "BadMessage") {
-        return UploadLogStatusEnumType::BadMessage;
-    }
-    if (s == "Idle") {
-        return UploadLogStatusEnumType::Idle;
-    }
-    if (s == "NotSupportedOperation") {
-        return UploadLogStatusEnumType::NotSupportedOperation;
-    }
-    if (s == "PermissionDenied") {
-        return UploadLogStatusEnumType::PermissionDenied;
-    }
-    if (s == "Uploaded") {
-        return UploadLogStatusEnumType::Uploaded;
-    }
-    if (s == "UploadFailure") {
-        return UploadLogStatusEnumType::UploadFailure;
-    }
-    if (s == "Uploading") {
-        return UploadLogStatusEnumType::Uploading;
+UploadLogStatusEnumType string_to_upload_log_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return UploadLogStatusEnumType::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Uploaded") {
+            return UploadLogStatusEnumType::Uploaded;
+        }
+        break;
+    case 9:
+        if (s == "Uploading") {
+            return UploadLogStatusEnumType::Uploading;
+        }
+        break;
+    case 10:
+        if (s == "BadMessage") {
+            return UploadLogStatusEnumType::BadMessage;
+        }
+        break;
+    case 13:
+        if (s == "UploadFailure") {
+            return UploadLogStatusEnumType::UploadFailure;
+        }
+        break;
+    case 16:
+        if (s == "PermissionDenied") {
+            return UploadLogStatusEnumType::PermissionDenied;
+        }
+        break;
+    case 21:
+        if (s == "NotSupportedOperation") {
+            return UploadLogStatusEnumType::NotSupportedOperation;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UploadLogStatusEnumType"};
@@ -926,52 +1364,80 @@ std::ostream& operator<<(std::ostream& os, const UploadLogStatusEnumType& upload
 // from: MeterValuesRequest
 namespace conversions {
 std::string reading_context_to_string(ReadingContext e) {
-    switch (e) {
-    case ReadingContext::Interruption_Begin:
-        return "Interruption.Begin";
-    case ReadingContext::Interruption_End:
-        return "Interruption.End";
-    case ReadingContext::Sample_Clock:
-        return "Sample.Clock";
-    case ReadingContext::Sample_Periodic:
-        return "Sample.Periodic";
-    case ReadingContext::Transaction_Begin:
-        return "Transaction.Begin";
-    case ReadingContext::Transaction_End:
-        return "Transaction.End";
-    case ReadingContext::Trigger:
-        return "Trigger";
-    case ReadingContext::Other:
-        return "Other";
+    static constexpr std::string_view strings[] = {
+        "Interruption.Begin",
+        "Interruption.End",
+        "Sample.Clock",
+        "Sample.Periodic",
+        "Transaction.Begin",
+        "Transaction.End",
+        "Trigger",
+        "Other",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ReadingContext::Interruption_Begin) == 0);
+    static_assert(static_cast<std::size_t>(ReadingContext::Interruption_End) == 1);
+    static_assert(static_cast<std::size_t>(ReadingContext::Sample_Clock) == 2);
+    static_assert(static_cast<std::size_t>(ReadingContext::Sample_Periodic) == 3);
+    static_assert(static_cast<std::size_t>(ReadingContext::Transaction_Begin) == 4);
+    static_assert(static_cast<std::size_t>(ReadingContext::Transaction_End) == 5);
+    static_assert(static_cast<std::size_t>(ReadingContext::Trigger) == 6);
+    static_assert(static_cast<std::size_t>(ReadingContext::Other) == 7);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ReadingContext"};
 }
 
-ReadingContext string_to_reading_context(const std::string& s) {
-    if (s == "Interruption.Begin") {
-        return ReadingContext::Interruption_Begin;
-    }
-    if (s == "Interruption.End") {
-        return ReadingContext::Interruption_End;
-    }
-    if (s == "Sample.Clock") {
-        return ReadingContext::Sample_Clock;
-    }
-    if (s == "Sample.Periodic") {
-        return ReadingContext::Sample_Periodic;
-    }
-    if (s == "Transaction.Begin") {
-        return ReadingContext::Transaction_Begin;
-    }
-    if (s == "Transaction.End") {
-        return ReadingContext::Transaction_End;
-    }
-    if (s == "Trigger") {
-        return ReadingContext::Trigger;
-    }
-    if (s == "Other") {
-        return ReadingContext::Other;
+ReadingContext string_to_reading_context(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Other") {
+            return ReadingContext::Other;
+        }
+        break;
+    case 7:
+        if (s == "Trigger") {
+            return ReadingContext::Trigger;
+        }
+        break;
+    case 12:
+        if (s == "Sample.Clock") {
+            return ReadingContext::Sample_Clock;
+        }
+        break;
+    case 15:
+        switch (s[0]) {
+        case 'S':
+            if (s == "Sample.Periodic") {
+                return ReadingContext::Sample_Periodic;
+            }
+            break;
+        case 'T':
+            if (s == "Transaction.End") {
+                return ReadingContext::Transaction_End;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "Interruption.End") {
+            return ReadingContext::Interruption_End;
+        }
+        break;
+    case 17:
+        if (s == "Transaction.Begin") {
+            return ReadingContext::Transaction_Begin;
+        }
+        break;
+    case 18:
+        if (s == "Interruption.Begin") {
+            return ReadingContext::Interruption_Begin;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReadingContext"};
@@ -986,22 +1452,34 @@ std::ostream& operator<<(std::ostream& os, const ReadingContext& reading_context
 // from: MeterValuesRequest
 namespace conversions {
 std::string value_format_to_string(ValueFormat e) {
-    switch (e) {
-    case ValueFormat::Raw:
-        return "Raw";
-    case ValueFormat::SignedData:
-        return "SignedData";
+    static constexpr std::string_view strings[] = {
+        "Raw",
+        "SignedData",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ValueFormat::Raw) == 0);
+    static_assert(static_cast<std::size_t>(ValueFormat::SignedData) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ValueFormat"};
 }
 
-ValueFormat string_to_value_format(const std::string& s) {
-    if (s == "Raw") {
-        return ValueFormat::Raw;
-    }
-    if (s == "SignedData") {
-        return ValueFormat::SignedData;
+ValueFormat string_to_value_format(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "Raw") {
+            return ValueFormat::Raw;
+        }
+        break;
+    case 10:
+        if (s == "SignedData") {
+            return ValueFormat::SignedData;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ValueFormat"};
@@ -1016,122 +1494,178 @@ std::ostream& operator<<(std::ostream& os, const ValueFormat& value_format) {
 // from: MeterValuesRequest
 namespace conversions {
 std::string measurand_to_string(Measurand e) {
-    switch (e) {
-    case Measurand::Energy_Active_Export_Register:
-        return "Energy.Active.Export.Register";
-    case Measurand::Energy_Active_Import_Register:
-        return "Energy.Active.Import.Register";
-    case Measurand::Energy_Reactive_Export_Register:
-        return "Energy.Reactive.Export.Register";
-    case Measurand::Energy_Reactive_Import_Register:
-        return "Energy.Reactive.Import.Register";
-    case Measurand::Energy_Active_Export_Interval:
-        return "Energy.Active.Export.Interval";
-    case Measurand::Energy_Active_Import_Interval:
-        return "Energy.Active.Import.Interval";
-    case Measurand::Energy_Reactive_Export_Interval:
-        return "Energy.Reactive.Export.Interval";
-    case Measurand::Energy_Reactive_Import_Interval:
-        return "Energy.Reactive.Import.Interval";
-    case Measurand::Power_Active_Export:
-        return "Power.Active.Export";
-    case Measurand::Power_Active_Import:
-        return "Power.Active.Import";
-    case Measurand::Power_Offered:
-        return "Power.Offered";
-    case Measurand::Power_Reactive_Export:
-        return "Power.Reactive.Export";
-    case Measurand::Power_Reactive_Import:
-        return "Power.Reactive.Import";
-    case Measurand::Power_Factor:
-        return "Power.Factor";
-    case Measurand::Current_Import:
-        return "Current.Import";
-    case Measurand::Current_Export:
-        return "Current.Export";
-    case Measurand::Current_Offered:
-        return "Current.Offered";
-    case Measurand::Voltage:
-        return "Voltage";
-    case Measurand::Frequency:
-        return "Frequency";
-    case Measurand::Temperature:
-        return "Temperature";
-    case Measurand::SoC:
-        return "SoC";
-    case Measurand::RPM:
-        return "RPM";
+    static constexpr std::string_view strings[] = {
+        "Energy.Active.Export.Register",
+        "Energy.Active.Import.Register",
+        "Energy.Reactive.Export.Register",
+        "Energy.Reactive.Import.Register",
+        "Energy.Active.Export.Interval",
+        "Energy.Active.Import.Interval",
+        "Energy.Reactive.Export.Interval",
+        "Energy.Reactive.Import.Interval",
+        "Power.Active.Export",
+        "Power.Active.Import",
+        "Power.Offered",
+        "Power.Reactive.Export",
+        "Power.Reactive.Import",
+        "Power.Factor",
+        "Current.Import",
+        "Current.Export",
+        "Current.Offered",
+        "Voltage",
+        "Frequency",
+        "Temperature",
+        "SoC",
+        "RPM",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(Measurand::Energy_Active_Export_Register) == 0);
+    static_assert(static_cast<std::size_t>(Measurand::Energy_Active_Import_Register) == 1);
+    static_assert(static_cast<std::size_t>(Measurand::Energy_Reactive_Export_Register) == 2);
+    static_assert(static_cast<std::size_t>(Measurand::Energy_Reactive_Import_Register) == 3);
+    static_assert(static_cast<std::size_t>(Measurand::Energy_Active_Export_Interval) == 4);
+    static_assert(static_cast<std::size_t>(Measurand::Energy_Active_Import_Interval) == 5);
+    static_assert(static_cast<std::size_t>(Measurand::Energy_Reactive_Export_Interval) == 6);
+    static_assert(static_cast<std::size_t>(Measurand::Energy_Reactive_Import_Interval) == 7);
+    static_assert(static_cast<std::size_t>(Measurand::Power_Active_Export) == 8);
+    static_assert(static_cast<std::size_t>(Measurand::Power_Active_Import) == 9);
+    static_assert(static_cast<std::size_t>(Measurand::Power_Offered) == 10);
+    static_assert(static_cast<std::size_t>(Measurand::Power_Reactive_Export) == 11);
+    static_assert(static_cast<std::size_t>(Measurand::Power_Reactive_Import) == 12);
+    static_assert(static_cast<std::size_t>(Measurand::Power_Factor) == 13);
+    static_assert(static_cast<std::size_t>(Measurand::Current_Import) == 14);
+    static_assert(static_cast<std::size_t>(Measurand::Current_Export) == 15);
+    static_assert(static_cast<std::size_t>(Measurand::Current_Offered) == 16);
+    static_assert(static_cast<std::size_t>(Measurand::Voltage) == 17);
+    static_assert(static_cast<std::size_t>(Measurand::Frequency) == 18);
+    static_assert(static_cast<std::size_t>(Measurand::Temperature) == 19);
+    static_assert(static_cast<std::size_t>(Measurand::SoC) == 20);
+    static_assert(static_cast<std::size_t>(Measurand::RPM) == 21);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "Measurand"};
 }
 
-Measurand string_to_measurand(const std::string& s) {
-    if (s == "Energy.Active.Export.Register") {
-        return Measurand::Energy_Active_Export_Register;
-    }
-    if (s == "Energy.Active.Import.Register") {
-        return Measurand::Energy_Active_Import_Register;
-    }
-    if (s == "Energy.Reactive.Export.Register") {
-        return Measurand::Energy_Reactive_Export_Register;
-    }
-    if (s == "Energy.Reactive.Import.Register") {
-        return Measurand::Energy_Reactive_Import_Register;
-    }
-    if (s == "Energy.Active.Export.Interval") {
-        return Measurand::Energy_Active_Export_Interval;
-    }
-    if (s == "Energy.Active.Import.Interval") {
-        return Measurand::Energy_Active_Import_Interval;
-    }
-    if (s == "Energy.Reactive.Export.Interval") {
-        return Measurand::Energy_Reactive_Export_Interval;
-    }
-    if (s == "Energy.Reactive.Import.Interval") {
-        return Measurand::Energy_Reactive_Import_Interval;
-    }
-    if (s == "Power.Active.Export") {
-        return Measurand::Power_Active_Export;
-    }
-    if (s == "Power.Active.Import") {
-        return Measurand::Power_Active_Import;
-    }
-    if (s == "Power.Offered") {
-        return Measurand::Power_Offered;
-    }
-    if (s == "Power.Reactive.Export") {
-        return Measurand::Power_Reactive_Export;
-    }
-    if (s == "Power.Reactive.Import") {
-        return Measurand::Power_Reactive_Import;
-    }
-    if (s == "Power.Factor") {
-        return Measurand::Power_Factor;
-    }
-    if (s == "Current.Import") {
-        return Measurand::Current_Import;
-    }
-    if (s == "Current.Export") {
-        return Measurand::Current_Export;
-    }
-    if (s == "Current.Offered") {
-        return Measurand::Current_Offered;
-    }
-    if (s == "Voltage") {
-        return Measurand::Voltage;
-    }
-    if (s == "Frequency") {
-        return Measurand::Frequency;
-    }
-    if (s == "Temperature") {
-        return Measurand::Temperature;
-    }
-    if (s == "SoC") {
-        return Measurand::SoC;
-    }
-    if (s == "RPM") {
-        return Measurand::RPM;
+Measurand string_to_measurand(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        switch (s[0]) {
+        case 'S':
+            if (s == "SoC") {
+                return Measurand::SoC;
+            }
+            break;
+        case 'R':
+            if (s == "RPM") {
+                return Measurand::RPM;
+            }
+            break;
+        }
+        break;
+    case 7:
+        if (s == "Voltage") {
+            return Measurand::Voltage;
+        }
+        break;
+    case 9:
+        if (s == "Frequency") {
+            return Measurand::Frequency;
+        }
+        break;
+    case 11:
+        if (s == "Temperature") {
+            return Measurand::Temperature;
+        }
+        break;
+    case 12:
+        if (s == "Power.Factor") {
+            return Measurand::Power_Factor;
+        }
+        break;
+    case 13:
+        if (s == "Power.Offered") {
+            return Measurand::Power_Offered;
+        }
+        break;
+    case 14:
+        switch (s[8]) {
+        case 'I':
+            if (s == "Current.Import") {
+                return Measurand::Current_Import;
+            }
+            break;
+        case 'E':
+            if (s == "Current.Export") {
+                return Measurand::Current_Export;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "Current.Offered") {
+            return Measurand::Current_Offered;
+        }
+        break;
+    case 19:
+        switch (s[13]) {
+        case 'E':
+            if (s == "Power.Active.Export") {
+                return Measurand::Power_Active_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Power.Active.Import") {
+                return Measurand::Power_Active_Import;
+            }
+            break;
+        }
+        break;
+    case 21:
+        switch (s[15]) {
+        case 'E':
+            if (s == "Power.Reactive.Export") {
+                return Measurand::Power_Reactive_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Power.Reactive.Import") {
+                return Measurand::Power_Reactive_Import;
+            }
+            break;
+        }
+        break;
+    case 29:
+        if (s == "Energy.Active.Export.Register") {
+            return Measurand::Energy_Active_Export_Register;
+        }
+        if (s == "Energy.Active.Import.Register") {
+            return Measurand::Energy_Active_Import_Register;
+        }
+        if (s == "Energy.Active.Export.Interval") {
+            return Measurand::Energy_Active_Export_Interval;
+        }
+        if (s == "Energy.Active.Import.Interval") {
+            return Measurand::Energy_Active_Import_Interval;
+        }
+        break;
+    case 31:
+        if (s == "Energy.Reactive.Export.Register") {
+            return Measurand::Energy_Reactive_Export_Register;
+        }
+        if (s == "Energy.Reactive.Import.Register") {
+            return Measurand::Energy_Reactive_Import_Register;
+        }
+        if (s == "Energy.Reactive.Export.Interval") {
+            return Measurand::Energy_Reactive_Export_Interval;
+        }
+        if (s == "Energy.Reactive.Import.Interval") {
+            return Measurand::Energy_Reactive_Import_Interval;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "Measurand"};
@@ -1146,62 +1680,102 @@ std::ostream& operator<<(std::ostream& os, const Measurand& measurand) {
 // from: MeterValuesRequest
 namespace conversions {
 std::string phase_to_string(Phase e) {
-    switch (e) {
-    case Phase::L1:
-        return "L1";
-    case Phase::L2:
-        return "L2";
-    case Phase::L3:
-        return "L3";
-    case Phase::N:
-        return "N";
-    case Phase::L1_N:
-        return "L1-N";
-    case Phase::L2_N:
-        return "L2-N";
-    case Phase::L3_N:
-        return "L3-N";
-    case Phase::L1_L2:
-        return "L1-L2";
-    case Phase::L2_L3:
-        return "L2-L3";
-    case Phase::L3_L1:
-        return "L3-L1";
+    static constexpr std::string_view strings[] = {
+        "L1",
+        "L2",
+        "L3",
+        "N",
+        "L1-N",
+        "L2-N",
+        "L3-N",
+        "L1-L2",
+        "L2-L3",
+        "L3-L1",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(Phase::L1) == 0);
+    static_assert(static_cast<std::size_t>(Phase::L2) == 1);
+    static_assert(static_cast<std::size_t>(Phase::L3) == 2);
+    static_assert(static_cast<std::size_t>(Phase::N) == 3);
+    static_assert(static_cast<std::size_t>(Phase::L1_N) == 4);
+    static_assert(static_cast<std::size_t>(Phase::L2_N) == 5);
+    static_assert(static_cast<std::size_t>(Phase::L3_N) == 6);
+    static_assert(static_cast<std::size_t>(Phase::L1_L2) == 7);
+    static_assert(static_cast<std::size_t>(Phase::L2_L3) == 8);
+    static_assert(static_cast<std::size_t>(Phase::L3_L1) == 9);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "Phase"};
 }
 
-Phase string_to_phase(const std::string& s) {
-    if (s == "L1") {
-        return Phase::L1;
-    }
-    if (s == "L2") {
-        return Phase::L2;
-    }
-    if (s == "L3") {
-        return Phase::L3;
-    }
-    if (s == "N") {
-        return Phase::N;
-    }
-    if (s == "L1-N") {
-        return Phase::L1_N;
-    }
-    if (s == "L2-N") {
-        return Phase::L2_N;
-    }
-    if (s == "L3-N") {
-        return Phase::L3_N;
-    }
-    if (s == "L1-L2") {
-        return Phase::L1_L2;
-    }
-    if (s == "L2-L3") {
-        return Phase::L2_L3;
-    }
-    if (s == "L3-L1") {
-        return Phase::L3_L1;
+Phase string_to_phase(std::string_view s) {
+    switch (s.size()) {
+    case 1:
+        if (s == "N") {
+            return Phase::N;
+        }
+        break;
+    case 2:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1") {
+                return Phase::L1;
+            }
+            break;
+        case '2':
+            if (s == "L2") {
+                return Phase::L2;
+            }
+            break;
+        case '3':
+            if (s == "L3") {
+                return Phase::L3;
+            }
+            break;
+        }
+        break;
+    case 4:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1-N") {
+                return Phase::L1_N;
+            }
+            break;
+        case '2':
+            if (s == "L2-N") {
+                return Phase::L2_N;
+            }
+            break;
+        case '3':
+            if (s == "L3-N") {
+                return Phase::L3_N;
+            }
+            break;
+        }
+        break;
+    case 5:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1-L2") {
+                return Phase::L1_L2;
+            }
+            break;
+        case '2':
+            if (s == "L2-L3") {
+                return Phase::L2_L3;
+            }
+            break;
+        case '3':
+            if (s == "L3-L1") {
+                return Phase::L3_L1;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "Phase"};
@@ -1216,37 +1790,59 @@ std::ostream& operator<<(std::ostream& os, const Phase& phase) {
 // from: MeterValuesRequest
 namespace conversions {
 std::string location_to_string(Location e) {
-    switch (e) {
-    case Location::Cable:
-        return "Cable";
-    case Location::EV:
-        return "EV";
-    case Location::Inlet:
-        return "Inlet";
-    case Location::Outlet:
-        return "Outlet";
-    case Location::Body:
-        return "Body";
+    static constexpr std::string_view strings[] = {
+        "Cable",
+        "EV",
+        "Inlet",
+        "Outlet",
+        "Body",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(Location::Cable) == 0);
+    static_assert(static_cast<std::size_t>(Location::EV) == 1);
+    static_assert(static_cast<std::size_t>(Location::Inlet) == 2);
+    static_assert(static_cast<std::size_t>(Location::Outlet) == 3);
+    static_assert(static_cast<std::size_t>(Location::Body) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "Location"};
 }
 
-Location string_to_location(const std::string& s) {
-    if (s == "Cable") {
-        return Location::Cable;
-    }
-    if (s == "EV") {
-        return Location::EV;
-    }
-    if (s == "Inlet") {
-        return Location::Inlet;
-    }
-    if (s == "Outlet") {
-        return Location::Outlet;
-    }
-    if (s == "Body") {
-        return Location::Body;
+Location string_to_location(std::string_view s) {
+    switch (s.size()) {
+    case 2:
+        if (s == "EV") {
+            return Location::EV;
+        }
+        break;
+    case 4:
+        if (s == "Body") {
+            return Location::Body;
+        }
+        break;
+    case 5:
+        switch (s[0]) {
+        case 'C':
+            if (s == "Cable") {
+                return Location::Cable;
+            }
+            break;
+        case 'I':
+            if (s == "Inlet") {
+                return Location::Inlet;
+            }
+            break;
+        }
+        break;
+    case 6:
+        if (s == "Outlet") {
+            return Location::Outlet;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "Location"};
@@ -1261,97 +1857,151 @@ std::ostream& operator<<(std::ostream& os, const Location& location) {
 // from: MeterValuesRequest
 namespace conversions {
 std::string unit_of_measure_to_string(UnitOfMeasure e) {
-    switch (e) {
-    case UnitOfMeasure::Wh:
-        return "Wh";
-    case UnitOfMeasure::kWh:
-        return "kWh";
-    case UnitOfMeasure::varh:
-        return "varh";
-    case UnitOfMeasure::kvarh:
-        return "kvarh";
-    case UnitOfMeasure::W:
-        return "W";
-    case UnitOfMeasure::kW:
-        return "kW";
-    case UnitOfMeasure::VA:
-        return "VA";
-    case UnitOfMeasure::kVA:
-        return "kVA";
-    case UnitOfMeasure::var:
-        return "var";
-    case UnitOfMeasure::kvar:
-        return "kvar";
-    case UnitOfMeasure::A:
-        return "A";
-    case UnitOfMeasure::V:
-        return "V";
-    case UnitOfMeasure::K:
-        return "K";
-    case UnitOfMeasure::Celcius:
-        return "Celcius";
-    case UnitOfMeasure::Celsius:
-        return "Celsius";
-    case UnitOfMeasure::Fahrenheit:
-        return "Fahrenheit";
-    case UnitOfMeasure::Percent:
-        return "Percent";
+    static constexpr std::string_view strings[] = {
+        "Wh",
+        "kWh",
+        "varh",
+        "kvarh",
+        "W",
+        "kW",
+        "VA",
+        "kVA",
+        "var",
+        "kvar",
+        "A",
+        "V",
+        "K",
+        "Celcius",
+        "Celsius",
+        "Fahrenheit",
+        "Percent",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::Wh) == 0);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::kWh) == 1);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::varh) == 2);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::kvarh) == 3);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::W) == 4);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::kW) == 5);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::VA) == 6);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::kVA) == 7);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::var) == 8);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::kvar) == 9);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::A) == 10);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::V) == 11);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::K) == 12);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::Celcius) == 13);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::Celsius) == 14);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::Fahrenheit) == 15);
+    static_assert(static_cast<std::size_t>(UnitOfMeasure::Percent) == 16);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UnitOfMeasure"};
 }
 
-UnitOfMeasure string_to_unit_of_measure(const std::string& s) {
-    if (s == "Wh") {
-        return UnitOfMeasure::Wh;
-    }
-    if (s == "kWh") {
-        return UnitOfMeasure::kWh;
-    }
-    if (s == "varh") {
-        return UnitOfMeasure::varh;
-    }
-    if (s == "kvarh") {
-        return UnitOfMeasure::kvarh;
-    }
-    if (s == "W") {
-        return UnitOfMeasure::W;
-    }
-    if (s == "kW") {
-        return UnitOfMeasure::kW;
-    }
-    if (s == "VA") {
-        return UnitOfMeasure::VA;
-    }
-    if (s == "kVA") {
-        return UnitOfMeasure::kVA;
-    }
-    if (s == "var") {
-        return UnitOfMeasure::var;
-    }
-    if (s == "kvar") {
-        return UnitOfMeasure::kvar;
-    }
-    if (s == "A") {
-        return UnitOfMeasure::A;
-    }
-    if (s == "V") {
-        return UnitOfMeasure::V;
-    }
-    if (s == "K") {
-        return UnitOfMeasure::K;
-    }
-    if (s == "Celcius") {
-        return UnitOfMeasure::Celcius;
-    }
-    if (s == "Celsius") {
-        return UnitOfMeasure::Celsius;
-    }
-    if (s == "Fahrenheit") {
-        return UnitOfMeasure::Fahrenheit;
-    }
-    if (s == "Percent") {
-        return UnitOfMeasure::Percent;
+UnitOfMeasure string_to_unit_of_measure(std::string_view s) {
+    switch (s.size()) {
+    case 1:
+        switch (s[0]) {
+        case 'W':
+            if (s == "W") {
+                return UnitOfMeasure::W;
+            }
+            break;
+        case 'A':
+            if (s == "A") {
+                return UnitOfMeasure::A;
+            }
+            break;
+        case 'V':
+            if (s == "V") {
+                return UnitOfMeasure::V;
+            }
+            break;
+        case 'K':
+            if (s == "K") {
+                return UnitOfMeasure::K;
+            }
+            break;
+        }
+        break;
+    case 2:
+        switch (s[0]) {
+        case 'W':
+            if (s == "Wh") {
+                return UnitOfMeasure::Wh;
+            }
+            break;
+        case 'k':
+            if (s == "kW") {
+                return UnitOfMeasure::kW;
+            }
+            break;
+        case 'V':
+            if (s == "VA") {
+                return UnitOfMeasure::VA;
+            }
+            break;
+        }
+        break;
+    case 3:
+        switch (s[1]) {
+        case 'W':
+            if (s == "kWh") {
+                return UnitOfMeasure::kWh;
+            }
+            break;
+        case 'V':
+            if (s == "kVA") {
+                return UnitOfMeasure::kVA;
+            }
+            break;
+        case 'a':
+            if (s == "var") {
+                return UnitOfMeasure::var;
+            }
+            break;
+        }
+        break;
+    case 4:
+        switch (s[0]) {
+        case 'v':
+            if (s == "varh") {
+                return UnitOfMeasure::varh;
+            }
+            break;
+        case 'k':
+            if (s == "kvar") {
+                return UnitOfMeasure::kvar;
+            }
+            break;
+        }
+        break;
+    case 5:
+        if (s == "kvarh") {
+            return UnitOfMeasure::kvarh;
+        }
+        break;
+    case 7:
+        if (s == "Celcius") {
+            return UnitOfMeasure::Celcius;
+        }
+        if (s == "Celsius") {
+            return UnitOfMeasure::Celsius;
+        }
+        if (s == "Percent") {
+            return UnitOfMeasure::Percent;
+        }
+        break;
+    case 10:
+        if (s == "Fahrenheit") {
+            return UnitOfMeasure::Fahrenheit;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UnitOfMeasure"};
@@ -1366,27 +2016,45 @@ std::ostream& operator<<(std::ostream& os, const UnitOfMeasure& unit_of_measure)
 // from: RemoteStartTransactionRequest
 namespace conversions {
 std::string charging_profile_kind_type_to_string(ChargingProfileKindType e) {
-    switch (e) {
-    case ChargingProfileKindType::Absolute:
-        return "Absolute";
-    case ChargingProfileKindType::Recurring:
-        return "Recurring";
-    case ChargingProfileKindType::Relative:
-        return "Relative";
+    static constexpr std::string_view strings[] = {
+        "Absolute",
+        "Recurring",
+        "Relative",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargingProfileKindType::Absolute) == 0);
+    static_assert(static_cast<std::size_t>(ChargingProfileKindType::Recurring) == 1);
+    static_assert(static_cast<std::size_t>(ChargingProfileKindType::Relative) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargingProfileKindType"};
 }
 
-ChargingProfileKindType string_to_charging_profile_kind_type(const std::string& s) {
-    if (s == "Absolute") {
-        return ChargingProfileKindType::Absolute;
-    }
-    if (s == "Recurring") {
-        return ChargingProfileKindType::Recurring;
-    }
-    if (s == "Relative") {
-        return ChargingProfileKindType::Relative;
+ChargingProfileKindType string_to_charging_profile_kind_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Absolute") {
+                return ChargingProfileKindType::Absolute;
+            }
+            break;
+        case 'R':
+            if (s == "Relative") {
+                return ChargingProfileKindType::Relative;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Recurring") {
+            return ChargingProfileKindType::Recurring;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfileKindType"};
@@ -1401,22 +2069,34 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfileKindType& chargi
 // from: RemoteStartTransactionRequest
 namespace conversions {
 std::string recurrency_kind_type_to_string(RecurrencyKindType e) {
-    switch (e) {
-    case RecurrencyKindType::Daily:
-        return "Daily";
-    case RecurrencyKindType::Weekly:
-        return "Weekly";
+    static constexpr std::string_view strings[] = {
+        "Daily",
+        "Weekly",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(RecurrencyKindType::Daily) == 0);
+    static_assert(static_cast<std::size_t>(RecurrencyKindType::Weekly) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "RecurrencyKindType"};
 }
 
-RecurrencyKindType string_to_recurrency_kind_type(const std::string& s) {
-    if (s == "Daily") {
-        return RecurrencyKindType::Daily;
-    }
-    if (s == "Weekly") {
-        return RecurrencyKindType::Weekly;
+RecurrencyKindType string_to_recurrency_kind_type(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Daily") {
+            return RecurrencyKindType::Daily;
+        }
+        break;
+    case 6:
+        if (s == "Weekly") {
+            return RecurrencyKindType::Weekly;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RecurrencyKindType"};
@@ -1431,22 +2111,38 @@ std::ostream& operator<<(std::ostream& os, const RecurrencyKindType& recurrency_
 // from: RemoteStartTransactionResponse
 namespace conversions {
 std::string remote_start_stop_status_to_string(RemoteStartStopStatus e) {
-    switch (e) {
-    case RemoteStartStopStatus::Accepted:
-        return "Accepted";
-    case RemoteStartStopStatus::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(RemoteStartStopStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(RemoteStartStopStatus::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "RemoteStartStopStatus"};
 }
 
-RemoteStartStopStatus string_to_remote_start_stop_status(const std::string& s) {
-    if (s == "Accepted") {
-        return RemoteStartStopStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return RemoteStartStopStatus::Rejected;
+RemoteStartStopStatus string_to_remote_start_stop_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return RemoteStartStopStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return RemoteStartStopStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RemoteStartStopStatus"};
@@ -1461,37 +2157,59 @@ std::ostream& operator<<(std::ostream& os, const RemoteStartStopStatus& remote_s
 // from: ReserveNowResponse
 namespace conversions {
 std::string reservation_status_to_string(ReservationStatus e) {
-    switch (e) {
-    case ReservationStatus::Accepted:
-        return "Accepted";
-    case ReservationStatus::Faulted:
-        return "Faulted";
-    case ReservationStatus::Occupied:
-        return "Occupied";
-    case ReservationStatus::Rejected:
-        return "Rejected";
-    case ReservationStatus::Unavailable:
-        return "Unavailable";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Faulted",
+        "Occupied",
+        "Rejected",
+        "Unavailable",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ReservationStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ReservationStatus::Faulted) == 1);
+    static_assert(static_cast<std::size_t>(ReservationStatus::Occupied) == 2);
+    static_assert(static_cast<std::size_t>(ReservationStatus::Rejected) == 3);
+    static_assert(static_cast<std::size_t>(ReservationStatus::Unavailable) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ReservationStatus"};
 }
 
-ReservationStatus string_to_reservation_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ReservationStatus::Accepted;
-    }
-    if (s == "Faulted") {
-        return ReservationStatus::Faulted;
-    }
-    if (s == "Occupied") {
-        return ReservationStatus::Occupied;
-    }
-    if (s == "Rejected") {
-        return ReservationStatus::Rejected;
-    }
-    if (s == "Unavailable") {
-        return ReservationStatus::Unavailable;
+ReservationStatus string_to_reservation_status(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ReservationStatus::Faulted;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ReservationStatus::Accepted;
+            }
+            break;
+        case 'O':
+            if (s == "Occupied") {
+                return ReservationStatus::Occupied;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ReservationStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return ReservationStatus::Unavailable;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReservationStatus"};
@@ -1506,22 +2224,38 @@ std::ostream& operator<<(std::ostream& os, const ReservationStatus& reservation_
 // from: ResetRequest
 namespace conversions {
 std::string reset_type_to_string(ResetType e) {
-    switch (e) {
-    case ResetType::Hard:
-        return "Hard";
-    case ResetType::Soft:
-        return "Soft";
+    static constexpr std::string_view strings[] = {
+        "Hard",
+        "Soft",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ResetType::Hard) == 0);
+    static_assert(static_cast<std::size_t>(ResetType::Soft) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ResetType"};
 }
 
-ResetType string_to_reset_type(const std::string& s) {
-    if (s == "Hard") {
-        return ResetType::Hard;
-    }
-    if (s == "Soft") {
-        return ResetType::Soft;
+ResetType string_to_reset_type(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        switch (s[0]) {
+        case 'H':
+            if (s == "Hard") {
+                return ResetType::Hard;
+            }
+            break;
+        case 'S':
+            if (s == "Soft") {
+                return ResetType::Soft;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ResetType"};
@@ -1536,22 +2270,38 @@ std::ostream& operator<<(std::ostream& os, const ResetType& reset_type) {
 // from: ResetResponse
 namespace conversions {
 std::string reset_status_to_string(ResetStatus e) {
-    switch (e) {
-    case ResetStatus::Accepted:
-        return "Accepted";
-    case ResetStatus::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ResetStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ResetStatus::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ResetStatus"};
 }
 
-ResetStatus string_to_reset_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ResetStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ResetStatus::Rejected;
+ResetStatus string_to_reset_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ResetStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ResetStatus::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ResetStatus"};
@@ -1566,22 +2316,34 @@ std::ostream& operator<<(std::ostream& os, const ResetStatus& reset_status) {
 // from: SendLocalListRequest
 namespace conversions {
 std::string update_type_to_string(UpdateType e) {
-    switch (e) {
-    case UpdateType::Differential:
-        return "Differential";
-    case UpdateType::Full:
-        return "Full";
+    static constexpr std::string_view strings[] = {
+        "Differential",
+        "Full",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UpdateType::Differential) == 0);
+    static_assert(static_cast<std::size_t>(UpdateType::Full) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UpdateType"};
 }
 
-UpdateType string_to_update_type(const std::string& s) {
-    if (s == "Differential") {
-        return UpdateType::Differential;
-    }
-    if (s == "Full") {
-        return UpdateType::Full;
+UpdateType string_to_update_type(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Full") {
+            return UpdateType::Full;
+        }
+        break;
+    case 12:
+        if (s == "Differential") {
+            return UpdateType::Differential;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UpdateType"};
@@ -1596,32 +2358,48 @@ std::ostream& operator<<(std::ostream& os, const UpdateType& update_type) {
 // from: SendLocalListResponse
 namespace conversions {
 std::string update_status_to_string(UpdateStatus e) {
-    switch (e) {
-    case UpdateStatus::Accepted:
-        return "Accepted";
-    case UpdateStatus::Failed:
-        return "Failed";
-    case UpdateStatus::NotSupported:
-        return "NotSupported";
-    case UpdateStatus::VersionMismatch:
-        return "VersionMismatch";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Failed",
+        "NotSupported",
+        "VersionMismatch",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UpdateStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(UpdateStatus::Failed) == 1);
+    static_assert(static_cast<std::size_t>(UpdateStatus::NotSupported) == 2);
+    static_assert(static_cast<std::size_t>(UpdateStatus::VersionMismatch) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UpdateStatus"};
 }
 
-UpdateStatus string_to_update_status(const std::string& s) {
-    if (s == "Accepted") {
-        return UpdateStatus::Accepted;
-    }
-    if (s == "Failed") {
-        return UpdateStatus::Failed;
-    }
-    if (s == "NotSupported") {
-        return UpdateStatus::NotSupported;
-    }
-    if (s == "VersionMismatch") {
-        return UpdateStatus::VersionMismatch;
+UpdateStatus string_to_update_status(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return UpdateStatus::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return UpdateStatus::Accepted;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return UpdateStatus::NotSupported;
+        }
+        break;
+    case 15:
+        if (s == "VersionMismatch") {
+            return UpdateStatus::VersionMismatch;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UpdateStatus"};
@@ -1636,27 +2414,45 @@ std::ostream& operator<<(std::ostream& os, const UpdateStatus& update_status) {
 // from: SetChargingProfileResponse
 namespace conversions {
 std::string charging_profile_status_to_string(ChargingProfileStatus e) {
-    switch (e) {
-    case ChargingProfileStatus::Accepted:
-        return "Accepted";
-    case ChargingProfileStatus::Rejected:
-        return "Rejected";
-    case ChargingProfileStatus::NotSupported:
-        return "NotSupported";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "NotSupported",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargingProfileStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ChargingProfileStatus::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(ChargingProfileStatus::NotSupported) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargingProfileStatus"};
 }
 
-ChargingProfileStatus string_to_charging_profile_status(const std::string& s) {
-    if (s == "Accepted") {
-        return ChargingProfileStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return ChargingProfileStatus::Rejected;
-    }
-    if (s == "NotSupported") {
-        return ChargingProfileStatus::NotSupported;
+ChargingProfileStatus string_to_charging_profile_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ChargingProfileStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ChargingProfileStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return ChargingProfileStatus::NotSupported;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfileStatus"};
@@ -1671,22 +2467,38 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfileStatus& charging
 // from: SignCertificateResponse
 namespace conversions {
 std::string generic_status_enum_type_to_string(GenericStatusEnumType e) {
-    switch (e) {
-    case GenericStatusEnumType::Accepted:
-        return "Accepted";
-    case GenericStatusEnumType::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GenericStatusEnumType::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(GenericStatusEnumType::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GenericStatusEnumType"};
 }
 
-GenericStatusEnumType string_to_generic_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return GenericStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return GenericStatusEnumType::Rejected;
+GenericStatusEnumType string_to_generic_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GenericStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return GenericStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GenericStatusEnumType"};
@@ -1701,82 +2513,134 @@ std::ostream& operator<<(std::ostream& os, const GenericStatusEnumType& generic_
 // from: SignedFirmwareStatusNotificationRequest
 namespace conversions {
 std::string firmware_status_enum_type_to_string(FirmwareStatusEnumType e) {
-    switch (e) {
-    case FirmwareStatusEnumType::Downloaded:
-        return "Downloaded";
-    case FirmwareStatusEnumType::DownloadFailed:
-        return "DownloadFailed";
-    case FirmwareStatusEnumType::Downloading:
-        return "Downloading";
-    case FirmwareStatusEnumType::DownloadScheduled:
-        return "DownloadScheduled";
-    case FirmwareStatusEnumType::DownloadPaused:
-        return "DownloadPaused";
-    case FirmwareStatusEnumType::Idle:
-        return "Idle";
-    case FirmwareStatusEnumType::InstallationFailed:
-        return "InstallationFailed";
-    case FirmwareStatusEnumType::Installing:
-        return "Installing";
-    case FirmwareStatusEnumType::Installed:
-        return "Installed";
-    case FirmwareStatusEnumType::InstallRebooting:
-        return "InstallRebooting";
-    case FirmwareStatusEnumType::InstallScheduled:
-        return "InstallScheduled";
-    case FirmwareStatusEnumType::InstallVerificationFailed:
-        return "InstallVerificationFailed";
-    case FirmwareStatusEnumType::InvalidSignature:
-        return "InvalidSignature";
-    case FirmwareStatusEnumType::SignatureVerified:
-        return "SignatureVerified";
+    static constexpr std::string_view strings[] = {
+        "Downloaded",
+        "DownloadFailed",
+        "Downloading",
+        "DownloadScheduled",
+        "DownloadPaused",
+        "Idle",
+        "InstallationFailed",
+        "Installing",
+        "Installed",
+        "InstallRebooting",
+        "InstallScheduled",
+        "InstallVerificationFailed",
+        "InvalidSignature",
+        "SignatureVerified",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::Downloaded) == 0);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::DownloadFailed) == 1);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::Downloading) == 2);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::DownloadScheduled) == 3);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::DownloadPaused) == 4);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::Idle) == 5);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::InstallationFailed) == 6);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::Installing) == 7);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::Installed) == 8);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::InstallRebooting) == 9);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::InstallScheduled) == 10);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::InstallVerificationFailed) == 11);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::InvalidSignature) == 12);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnumType::SignatureVerified) == 13);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "FirmwareStatusEnumType"};
 }
 
-FirmwareStatusEnumType string_to_firmware_status_enum_type(const std::string& s) {
-    if (s == "Downloaded") {
-        return FirmwareStatusEnumType::Downloaded;
-    }
-    if (s == "DownloadFailed") {
-        return FirmwareStatusEnumType::DownloadFailed;
-    }
-    if (s == "Downloading") {
-        return FirmwareStatusEnumType::Downloading;
-    }
-    if (s == "DownloadScheduled") {
-        return FirmwareStatusEnumType::DownloadScheduled;
-    }
-    if (s == "DownloadPaused") {
-        return FirmwareStatusEnumType::DownloadPaused;
-    }
-    if (s == "Idle") {
-        return FirmwareStatusEnumType::Idle;
-    }
-    if (s == "InstallationFailed") {
-        return FirmwareStatusEnumType::InstallationFailed;
-    }
-    if (s == "Installing") {
-        return FirmwareStatusEnumType::Installing;
-    }
-    if (s == "Installed") {
-        return FirmwareStatusEnumType::Installed;
-    }
-    if (s == "InstallRebooting") {
-        return FirmwareStatusEnumType::InstallRebooting;
-    }
-    if (s == "InstallScheduled") {
-        return FirmwareStatusEnumType::InstallScheduled;
-    }
-    if (s == "InstallVerificationFailed") {
-        return FirmwareStatusEnumType::InstallVerificationFailed;
-    }
-    if (s == "InvalidSignature") {
-        return FirmwareStatusEnumType::InvalidSignature;
-    }
-    if (s == "SignatureVerified") {
-        return FirmwareStatusEnumType::SignatureVerified;
+FirmwareStatusEnumType string_to_firmware_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return FirmwareStatusEnumType::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Installed") {
+            return FirmwareStatusEnumType::Installed;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'D':
+            if (s == "Downloaded") {
+                return FirmwareStatusEnumType::Downloaded;
+            }
+            break;
+        case 'I':
+            if (s == "Installing") {
+                return FirmwareStatusEnumType::Installing;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return FirmwareStatusEnumType::Downloading;
+        }
+        break;
+    case 14:
+        switch (s[8]) {
+        case 'F':
+            if (s == "DownloadFailed") {
+                return FirmwareStatusEnumType::DownloadFailed;
+            }
+            break;
+        case 'P':
+            if (s == "DownloadPaused") {
+                return FirmwareStatusEnumType::DownloadPaused;
+            }
+            break;
+        }
+        break;
+    case 16:
+        switch (s[8]) {
+        case 'e':
+            if (s == "InstallRebooting") {
+                return FirmwareStatusEnumType::InstallRebooting;
+            }
+            break;
+        case 'c':
+            if (s == "InstallScheduled") {
+                return FirmwareStatusEnumType::InstallScheduled;
+            }
+            break;
+        case 'i':
+            if (s == "InvalidSignature") {
+                return FirmwareStatusEnumType::InvalidSignature;
+            }
+            break;
+        }
+        break;
+    case 17:
+        switch (s[0]) {
+        case 'D':
+            if (s == "DownloadScheduled") {
+                return FirmwareStatusEnumType::DownloadScheduled;
+            }
+            break;
+        case 'S':
+            if (s == "SignatureVerified") {
+                return FirmwareStatusEnumType::SignatureVerified;
+            }
+            break;
+        }
+        break;
+    case 18:
+        if (s == "InstallationFailed") {
+            return FirmwareStatusEnumType::InstallationFailed;
+        }
+        break;
+    case 25:
+        if (s == "InstallVerificationFailed") {
+            return FirmwareStatusEnumType::InstallVerificationFailed;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "FirmwareStatusEnumType"};
@@ -1791,37 +2655,63 @@ std::ostream& operator<<(std::ostream& os, const FirmwareStatusEnumType& firmwar
 // from: SignedUpdateFirmwareResponse
 namespace conversions {
 std::string update_firmware_status_enum_type_to_string(UpdateFirmwareStatusEnumType e) {
-    switch (e) {
-    case UpdateFirmwareStatusEnumType::Accepted:
-        return "Accepted";
-    case UpdateFirmwareStatusEnumType::Rejected:
-        return "Rejected";
-    case UpdateFirmwareStatusEnumType::AcceptedCanceled:
-        return "AcceptedCanceled";
-    case UpdateFirmwareStatusEnumType::InvalidCertificate:
-        return "InvalidCertificate";
-    case UpdateFirmwareStatusEnumType::RevokedCertificate:
-        return "RevokedCertificate";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "AcceptedCanceled",
+        "InvalidCertificate",
+        "RevokedCertificate",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UpdateFirmwareStatusEnumType::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(UpdateFirmwareStatusEnumType::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(UpdateFirmwareStatusEnumType::AcceptedCanceled) == 2);
+    static_assert(static_cast<std::size_t>(UpdateFirmwareStatusEnumType::InvalidCertificate) == 3);
+    static_assert(static_cast<std::size_t>(UpdateFirmwareStatusEnumType::RevokedCertificate) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UpdateFirmwareStatusEnumType"};
 }
 
-UpdateFirmwareStatusEnumType string_to_update_firmware_status_enum_type(const std::string& s) {
-    if (s == "Accepted") {
-        return UpdateFirmwareStatusEnumType::Accepted;
-    }
-    if (s == "Rejected") {
-        return UpdateFirmwareStatusEnumType::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return UpdateFirmwareStatusEnumType::AcceptedCanceled;
-    }
-    if (s == "InvalidCertificate") {
-        return UpdateFirmwareStatusEnumType::InvalidCertificate;
-    }
-    if (s == "RevokedCertificate") {
-        return UpdateFirmwareStatusEnumType::RevokedCertificate;
+UpdateFirmwareStatusEnumType string_to_update_firmware_status_enum_type(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return UpdateFirmwareStatusEnumType::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return UpdateFirmwareStatusEnumType::Rejected;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return UpdateFirmwareStatusEnumType::AcceptedCanceled;
+        }
+        break;
+    case 18:
+        switch (s[0]) {
+        case 'I':
+            if (s == "InvalidCertificate") {
+                return UpdateFirmwareStatusEnumType::InvalidCertificate;
+            }
+            break;
+        case 'R':
+            if (s == "RevokedCertificate") {
+                return UpdateFirmwareStatusEnumType::RevokedCertificate;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UpdateFirmwareStatusEnumType"};
@@ -1836,92 +2726,156 @@ std::ostream& operator<<(std::ostream& os, const UpdateFirmwareStatusEnumType& u
 // from: StatusNotificationRequest
 namespace conversions {
 std::string charge_point_error_code_to_string(ChargePointErrorCode e) {
-    switch (e) {
-    case ChargePointErrorCode::ConnectorLockFailure:
-        return "ConnectorLockFailure";
-    case ChargePointErrorCode::EVCommunicationError:
-        return "EVCommunicationError";
-    case ChargePointErrorCode::GroundFailure:
-        return "GroundFailure";
-    case ChargePointErrorCode::HighTemperature:
-        return "HighTemperature";
-    case ChargePointErrorCode::InternalError:
-        return "InternalError";
-    case ChargePointErrorCode::LocalListConflict:
-        return "LocalListConflict";
-    case ChargePointErrorCode::NoError:
-        return "NoError";
-    case ChargePointErrorCode::OtherError:
-        return "OtherError";
-    case ChargePointErrorCode::OverCurrentFailure:
-        return "OverCurrentFailure";
-    case ChargePointErrorCode::PowerMeterFailure:
-        return "PowerMeterFailure";
-    case ChargePointErrorCode::PowerSwitchFailure:
-        return "PowerSwitchFailure";
-    case ChargePointErrorCode::ReaderFailure:
-        return "ReaderFailure";
-    case ChargePointErrorCode::ResetFailure:
-        return "ResetFailure";
-    case ChargePointErrorCode::UnderVoltage:
-        return "UnderVoltage";
-    case ChargePointErrorCode::OverVoltage:
-        return "OverVoltage";
-    case ChargePointErrorCode::WeakSignal:
-        return "WeakSignal";
+    static constexpr std::string_view strings[] = {
+        "ConnectorLockFailure",
+        "EVCommunicationError",
+        "GroundFailure",
+        "HighTemperature",
+        "InternalError",
+        "LocalListConflict",
+        "NoError",
+        "OtherError",
+        "OverCurrentFailure",
+        "PowerMeterFailure",
+        "PowerSwitchFailure",
+        "ReaderFailure",
+        "ResetFailure",
+        "UnderVoltage",
+        "OverVoltage",
+        "WeakSignal",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::ConnectorLockFailure) == 0);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::EVCommunicationError) == 1);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::GroundFailure) == 2);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::HighTemperature) == 3);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::InternalError) == 4);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::LocalListConflict) == 5);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::NoError) == 6);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::OtherError) == 7);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::OverCurrentFailure) == 8);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::PowerMeterFailure) == 9);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::PowerSwitchFailure) == 10);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::ReaderFailure) == 11);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::ResetFailure) == 12);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::UnderVoltage) == 13);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::OverVoltage) == 14);
+    static_assert(static_cast<std::size_t>(ChargePointErrorCode::WeakSignal) == 15);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargePointErrorCode"};
 }
 
-ChargePointErrorCode string_to_charge_point_error_code(const std::string& s) {
-    if (s == "ConnectorLockFailure") {
-        return ChargePointErrorCode::ConnectorLockFailure;
-    }
-    if (s == "EVCommunicationError") {
-        return ChargePointErrorCode::EVCommunicationError;
-    }
-    if (s == "GroundFailure") {
-        return ChargePointErrorCode::GroundFailure;
-    }
-    if (s == "HighTemperature") {
-        return ChargePointErrorCode::HighTemperature;
-    }
-    if (s == "InternalError") {
-        return ChargePointErrorCode::InternalError;
-    }
-    if (s == "LocalListConflict") {
-        return ChargePointErrorCode::LocalListConflict;
-    }
-    if (s == "NoError") {
-        return ChargePointErrorCode::NoError;
-    }
-    if (s == "OtherError") {
-        return ChargePointErrorCode::OtherError;
-    }
-    if (s == "OverCurrentFailure") {
-        return ChargePointErrorCode::OverCurrentFailure;
-    }
-    if (s == "PowerMeterFailure") {
-        return ChargePointErrorCode::PowerMeterFailure;
-    }
-    if (s == "PowerSwitchFailure") {
-        return ChargePointErrorCode::PowerSwitchFailure;
-    }
-    if (s == "ReaderFailure") {
-        return ChargePointErrorCode::ReaderFailure;
-    }
-    if (s == "ResetFailure") {
-        return ChargePointErrorCode::ResetFailure;
-    }
-    if (s == "UnderVoltage") {
-        return ChargePointErrorCode::UnderVoltage;
-    }
-    if (s == "OverVoltage") {
-        return ChargePointErrorCode::OverVoltage;
-    }
-    if (s == "WeakSignal") {
-        return ChargePointErrorCode::WeakSignal;
+ChargePointErrorCode string_to_charge_point_error_code(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "NoError") {
+            return ChargePointErrorCode::NoError;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'O':
+            if (s == "OtherError") {
+                return ChargePointErrorCode::OtherError;
+            }
+            break;
+        case 'W':
+            if (s == "WeakSignal") {
+                return ChargePointErrorCode::WeakSignal;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "OverVoltage") {
+            return ChargePointErrorCode::OverVoltage;
+        }
+        break;
+    case 12:
+        switch (s[0]) {
+        case 'R':
+            if (s == "ResetFailure") {
+                return ChargePointErrorCode::ResetFailure;
+            }
+            break;
+        case 'U':
+            if (s == "UnderVoltage") {
+                return ChargePointErrorCode::UnderVoltage;
+            }
+            break;
+        }
+        break;
+    case 13:
+        switch (s[0]) {
+        case 'G':
+            if (s == "GroundFailure") {
+                return ChargePointErrorCode::GroundFailure;
+            }
+            break;
+        case 'I':
+            if (s == "InternalError") {
+                return ChargePointErrorCode::InternalError;
+            }
+            break;
+        case 'R':
+            if (s == "ReaderFailure") {
+                return ChargePointErrorCode::ReaderFailure;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "HighTemperature") {
+            return ChargePointErrorCode::HighTemperature;
+        }
+        break;
+    case 17:
+        switch (s[0]) {
+        case 'L':
+            if (s == "LocalListConflict") {
+                return ChargePointErrorCode::LocalListConflict;
+            }
+            break;
+        case 'P':
+            if (s == "PowerMeterFailure") {
+                return ChargePointErrorCode::PowerMeterFailure;
+            }
+            break;
+        }
+        break;
+    case 18:
+        switch (s[0]) {
+        case 'O':
+            if (s == "OverCurrentFailure") {
+                return ChargePointErrorCode::OverCurrentFailure;
+            }
+            break;
+        case 'P':
+            if (s == "PowerSwitchFailure") {
+                return ChargePointErrorCode::PowerSwitchFailure;
+            }
+            break;
+        }
+        break;
+    case 20:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ConnectorLockFailure") {
+                return ChargePointErrorCode::ConnectorLockFailure;
+            }
+            break;
+        case 'E':
+            if (s == "EVCommunicationError") {
+                return ChargePointErrorCode::EVCommunicationError;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargePointErrorCode"};
@@ -1936,57 +2890,95 @@ std::ostream& operator<<(std::ostream& os, const ChargePointErrorCode& charge_po
 // from: StatusNotificationRequest
 namespace conversions {
 std::string charge_point_status_to_string(ChargePointStatus e) {
-    switch (e) {
-    case ChargePointStatus::Available:
-        return "Available";
-    case ChargePointStatus::Preparing:
-        return "Preparing";
-    case ChargePointStatus::Charging:
-        return "Charging";
-    case ChargePointStatus::SuspendedEVSE:
-        return "SuspendedEVSE";
-    case ChargePointStatus::SuspendedEV:
-        return "SuspendedEV";
-    case ChargePointStatus::Finishing:
-        return "Finishing";
-    case ChargePointStatus::Reserved:
-        return "Reserved";
-    case ChargePointStatus::Unavailable:
-        return "Unavailable";
-    case ChargePointStatus::Faulted:
-        return "Faulted";
+    static constexpr std::string_view strings[] = {
+        "Available",
+        "Preparing",
+        "Charging",
+        "SuspendedEVSE",
+        "SuspendedEV",
+        "Finishing",
+        "Reserved",
+        "Unavailable",
+        "Faulted",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargePointStatus::Available) == 0);
+    static_assert(static_cast<std::size_t>(ChargePointStatus::Preparing) == 1);
+    static_assert(static_cast<std::size_t>(ChargePointStatus::Charging) == 2);
+    static_assert(static_cast<std::size_t>(ChargePointStatus::SuspendedEVSE) == 3);
+    static_assert(static_cast<std::size_t>(ChargePointStatus::SuspendedEV) == 4);
+    static_assert(static_cast<std::size_t>(ChargePointStatus::Finishing) == 5);
+    static_assert(static_cast<std::size_t>(ChargePointStatus::Reserved) == 6);
+    static_assert(static_cast<std::size_t>(ChargePointStatus::Unavailable) == 7);
+    static_assert(static_cast<std::size_t>(ChargePointStatus::Faulted) == 8);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargePointStatus"};
 }
 
-ChargePointStatus string_to_charge_point_status(const std::string& s) {
-    if (s == "Available") {
-        return ChargePointStatus::Available;
-    }
-    if (s == "Preparing") {
-        return ChargePointStatus::Preparing;
-    }
-    if (s == "Charging") {
-        return ChargePointStatus::Charging;
-    }
-    if (s == "SuspendedEVSE") {
-        return ChargePointStatus::SuspendedEVSE;
-    }
-    if (s == "SuspendedEV") {
-        return ChargePointStatus::SuspendedEV;
-    }
-    if (s == "Finishing") {
-        return ChargePointStatus::Finishing;
-    }
-    if (s == "Reserved") {
-        return ChargePointStatus::Reserved;
-    }
-    if (s == "Unavailable") {
-        return ChargePointStatus::Unavailable;
-    }
-    if (s == "Faulted") {
-        return ChargePointStatus::Faulted;
+ChargePointStatus string_to_charge_point_status(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ChargePointStatus::Faulted;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'C':
+            if (s == "Charging") {
+                return ChargePointStatus::Charging;
+            }
+            break;
+        case 'R':
+            if (s == "Reserved") {
+                return ChargePointStatus::Reserved;
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Available") {
+                return ChargePointStatus::Available;
+            }
+            break;
+        case 'P':
+            if (s == "Preparing") {
+                return ChargePointStatus::Preparing;
+            }
+            break;
+        case 'F':
+            if (s == "Finishing") {
+                return ChargePointStatus::Finishing;
+            }
+            break;
+        }
+        break;
+    case 11:
+        switch (s[0]) {
+        case 'S':
+            if (s == "SuspendedEV") {
+                return ChargePointStatus::SuspendedEV;
+            }
+            break;
+        case 'U':
+            if (s == "Unavailable") {
+                return ChargePointStatus::Unavailable;
+            }
+            break;
+        }
+        break;
+    case 13:
+        if (s == "SuspendedEVSE") {
+            return ChargePointStatus::SuspendedEVSE;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargePointStatus"};
@@ -2001,67 +2993,113 @@ std::ostream& operator<<(std::ostream& os, const ChargePointStatus& charge_point
 // from: StopTransactionRequest
 namespace conversions {
 std::string reason_to_string(Reason e) {
-    switch (e) {
-    case Reason::EmergencyStop:
-        return "EmergencyStop";
-    case Reason::EVDisconnected:
-        return "EVDisconnected";
-    case Reason::HardReset:
-        return "HardReset";
-    case Reason::Local:
-        return "Local";
-    case Reason::Other:
-        return "Other";
-    case Reason::PowerLoss:
-        return "PowerLoss";
-    case Reason::Reboot:
-        return "Reboot";
-    case Reason::Remote:
-        return "Remote";
-    case Reason::SoftReset:
-        return "SoftReset";
-    case Reason::UnlockCommand:
-        return "UnlockCommand";
-    case Reason::DeAuthorized:
-        return "DeAuthorized";
+    static constexpr std::string_view strings[] = {
+        "EmergencyStop",
+        "EVDisconnected",
+        "HardReset",
+        "Local",
+        "Other",
+        "PowerLoss",
+        "Reboot",
+        "Remote",
+        "SoftReset",
+        "UnlockCommand",
+        "DeAuthorized",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(Reason::EmergencyStop) == 0);
+    static_assert(static_cast<std::size_t>(Reason::EVDisconnected) == 1);
+    static_assert(static_cast<std::size_t>(Reason::HardReset) == 2);
+    static_assert(static_cast<std::size_t>(Reason::Local) == 3);
+    static_assert(static_cast<std::size_t>(Reason::Other) == 4);
+    static_assert(static_cast<std::size_t>(Reason::PowerLoss) == 5);
+    static_assert(static_cast<std::size_t>(Reason::Reboot) == 6);
+    static_assert(static_cast<std::size_t>(Reason::Remote) == 7);
+    static_assert(static_cast<std::size_t>(Reason::SoftReset) == 8);
+    static_assert(static_cast<std::size_t>(Reason::UnlockCommand) == 9);
+    static_assert(static_cast<std::size_t>(Reason::DeAuthorized) == 10);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "Reason"};
 }
 
-Reason string_to_reason(const std::string& s) {
-    if (s == "EmergencyStop") {
-        return Reason::EmergencyStop;
-    }
-    if (s == "EVDisconnected") {
-        return Reason::EVDisconnected;
-    }
-    if (s == "HardReset") {
-        return Reason::HardReset;
-    }
-    if (s == "Local") {
-        return Reason::Local;
-    }
-    if (s == "Other") {
-        return Reason::Other;
-    }
-    if (s == "PowerLoss") {
-        return Reason::PowerLoss;
-    }
-    if (s == "Reboot") {
-        return Reason::Reboot;
-    }
-    if (s == "Remote") {
-        return Reason::Remote;
-    }
-    if (s == "SoftReset") {
-        return Reason::SoftReset;
-    }
-    if (s == "UnlockCommand") {
-        return Reason::UnlockCommand;
-    }
-    if (s == "DeAuthorized") {
-        return Reason::DeAuthorized;
+Reason string_to_reason(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        switch (s[0]) {
+        case 'L':
+            if (s == "Local") {
+                return Reason::Local;
+            }
+            break;
+        case 'O':
+            if (s == "Other") {
+                return Reason::Other;
+            }
+            break;
+        }
+        break;
+    case 6:
+        switch (s[2]) {
+        case 'b':
+            if (s == "Reboot") {
+                return Reason::Reboot;
+            }
+            break;
+        case 'm':
+            if (s == "Remote") {
+                return Reason::Remote;
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch (s[0]) {
+        case 'H':
+            if (s == "HardReset") {
+                return Reason::HardReset;
+            }
+            break;
+        case 'P':
+            if (s == "PowerLoss") {
+                return Reason::PowerLoss;
+            }
+            break;
+        case 'S':
+            if (s == "SoftReset") {
+                return Reason::SoftReset;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "DeAuthorized") {
+            return Reason::DeAuthorized;
+        }
+        break;
+    case 13:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EmergencyStop") {
+                return Reason::EmergencyStop;
+            }
+            break;
+        case 'U':
+            if (s == "UnlockCommand") {
+                return Reason::UnlockCommand;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "EVDisconnected") {
+            return Reason::EVDisconnected;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "Reason"};
@@ -2076,42 +3114,62 @@ std::ostream& operator<<(std::ostream& os, const Reason& reason) {
 // from: TriggerMessageRequest
 namespace conversions {
 std::string message_trigger_to_string(MessageTrigger e) {
-    switch (e) {
-    case MessageTrigger::BootNotification:
-        return "BootNotification";
-    case MessageTrigger::DiagnosticsStatusNotification:
-        return "DiagnosticsStatusNotification";
-    case MessageTrigger::FirmwareStatusNotification:
-        return "FirmwareStatusNotification";
-    case MessageTrigger::Heartbeat:
-        return "Heartbeat";
-    case MessageTrigger::MeterValues:
-        return "MeterValues";
-    case MessageTrigger::StatusNotification:
-        return "StatusNotification";
+    static constexpr std::string_view strings[] = {
+        "BootNotification",
+        "DiagnosticsStatusNotification",
+        "FirmwareStatusNotification",
+        "Heartbeat",
+        "MeterValues",
+        "StatusNotification",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MessageTrigger::BootNotification) == 0);
+    static_assert(static_cast<std::size_t>(MessageTrigger::DiagnosticsStatusNotification) == 1);
+    static_assert(static_cast<std::size_t>(MessageTrigger::FirmwareStatusNotification) == 2);
+    static_assert(static_cast<std::size_t>(MessageTrigger::Heartbeat) == 3);
+    static_assert(static_cast<std::size_t>(MessageTrigger::MeterValues) == 4);
+    static_assert(static_cast<std::size_t>(MessageTrigger::StatusNotification) == 5);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MessageTrigger"};
 }
 
-MessageTrigger string_to_message_trigger(const std::string& s) {
-    if (s == "BootNotification") {
-        return MessageTrigger::BootNotification;
-    }
-    if (s == "DiagnosticsStatusNotification") {
-        return MessageTrigger::DiagnosticsStatusNotification;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageTrigger::FirmwareStatusNotification;
-    }
-    if (s == "Heartbeat") {
-        return MessageTrigger::Heartbeat;
-    }
-    if (s == "MeterValues") {
-        return MessageTrigger::MeterValues;
-    }
-    if (s == "StatusNotification") {
-        return MessageTrigger::StatusNotification;
+MessageTrigger string_to_message_trigger(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "Heartbeat") {
+            return MessageTrigger::Heartbeat;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageTrigger::MeterValues;
+        }
+        break;
+    case 16:
+        if (s == "BootNotification") {
+            return MessageTrigger::BootNotification;
+        }
+        break;
+    case 18:
+        if (s == "StatusNotification") {
+            return MessageTrigger::StatusNotification;
+        }
+        break;
+    case 26:
+        if (s == "FirmwareStatusNotification") {
+            return MessageTrigger::FirmwareStatusNotification;
+        }
+        break;
+    case 29:
+        if (s == "DiagnosticsStatusNotification") {
+            return MessageTrigger::DiagnosticsStatusNotification;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageTrigger"};
@@ -2126,27 +3184,45 @@ std::ostream& operator<<(std::ostream& os, const MessageTrigger& message_trigger
 // from: TriggerMessageResponse
 namespace conversions {
 std::string trigger_message_status_to_string(TriggerMessageStatus e) {
-    switch (e) {
-    case TriggerMessageStatus::Accepted:
-        return "Accepted";
-    case TriggerMessageStatus::Rejected:
-        return "Rejected";
-    case TriggerMessageStatus::NotImplemented:
-        return "NotImplemented";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "NotImplemented",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(TriggerMessageStatus::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(TriggerMessageStatus::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(TriggerMessageStatus::NotImplemented) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "TriggerMessageStatus"};
 }
 
-TriggerMessageStatus string_to_trigger_message_status(const std::string& s) {
-    if (s == "Accepted") {
-        return TriggerMessageStatus::Accepted;
-    }
-    if (s == "Rejected") {
-        return TriggerMessageStatus::Rejected;
-    }
-    if (s == "NotImplemented") {
-        return TriggerMessageStatus::NotImplemented;
+TriggerMessageStatus string_to_trigger_message_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return TriggerMessageStatus::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return TriggerMessageStatus::Rejected;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "NotImplemented") {
+            return TriggerMessageStatus::NotImplemented;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "TriggerMessageStatus"};
@@ -2161,27 +3237,45 @@ std::ostream& operator<<(std::ostream& os, const TriggerMessageStatus& trigger_m
 // from: UnlockConnectorResponse
 namespace conversions {
 std::string unlock_status_to_string(UnlockStatus e) {
-    switch (e) {
-    case UnlockStatus::Unlocked:
-        return "Unlocked";
-    case UnlockStatus::UnlockFailed:
-        return "UnlockFailed";
-    case UnlockStatus::NotSupported:
-        return "NotSupported";
+    static constexpr std::string_view strings[] = {
+        "Unlocked",
+        "UnlockFailed",
+        "NotSupported",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UnlockStatus::Unlocked) == 0);
+    static_assert(static_cast<std::size_t>(UnlockStatus::UnlockFailed) == 1);
+    static_assert(static_cast<std::size_t>(UnlockStatus::NotSupported) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UnlockStatus"};
 }
 
-UnlockStatus string_to_unlock_status(const std::string& s) {
-    if (s == "Unlocked") {
-        return UnlockStatus::Unlocked;
-    }
-    if (s == "UnlockFailed") {
-        return UnlockStatus::UnlockFailed;
-    }
-    if (s == "NotSupported") {
-        return UnlockStatus::NotSupported;
+UnlockStatus string_to_unlock_status(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Unlocked") {
+            return UnlockStatus::Unlocked;
+        }
+        break;
+    case 12:
+        switch (s[0]) {
+        case 'U':
+            if (s == "UnlockFailed") {
+                return UnlockStatus::UnlockFailed;
+            }
+            break;
+        case 'N':
+            if (s == "NotSupported") {
+                return UnlockStatus::NotSupported;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UnlockStatus"};
@@ -9,6 +9,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v16/ocpp_enums.hpp>
 
@@ -30,10 +31,25 @@ void to_json(json& j, const IdTagInfo& k) {
     }
 }
 
+/// \brief Writes the given IdTagInfo \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const IdTagInfo& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::authorization_status_to_string(k.status));
+    // the optional parts of the message
+    if (k.expiryDate) {
+        writer.member("expiryDate", k.expiryDate.value().to_rfc3339());
+    }
+    if (k.parentIdTag) {
+        writer.member("parentIdTag", k.parentIdTag.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given IdTagInfo \p k
 void from_json(const json& j, IdTagInfo& k) {
     // the required parts of the message
-    k.status = conversions::string_to_authorization_status(j.at("status"));
+    k.status = conversions::string_to_authorization_status(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("expiryDate")) {
@@ -63,10 +79,23 @@ void to_json(json& j, const CertificateHashDataType& k) {
     // the optional parts of the message
 }
 
+/// \brief Writes the given CertificateHashDataType \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CertificateHashDataType& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("hashAlgorithm", conversions::hash_algorithm_enum_type_to_string(k.hashAlgorithm));
+    writer.member("issuerNameHash", k.issuerNameHash);
+    writer.member("issuerKeyHash", k.issuerKeyHash);
+    writer.member("serialNumber", k.serialNumber);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k) {
     // the required parts of the message
-    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum_type(j.at("hashAlgorithm"));
+    k.hashAlgorithm =
+        conversions::string_to_hash_algorithm_enum_type(j.at("hashAlgorithm").get_ref<const std::string&>());
     k.issuerNameHash = j.at("issuerNameHash");
     k.issuerKeyHash = j.at("issuerKeyHash");
     k.serialNumber = j.at("serialNumber");
@@ -94,6 +123,19 @@ void to_json(json& j, const ChargingSchedulePeriod& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedulePeriod \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("startPeriod", k.startPeriod);
+    writer.member("limit", k.limit);
+    // the optional parts of the message
+    if (k.numberPhases) {
+        writer.member("numberPhases", k.numberPhases.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ChargingSchedulePeriod \p k
 void from_json(const json& j, ChargingSchedulePeriod& k) {
     // the required parts of the message
@@ -132,10 +174,30 @@ void to_json(json& j, const ChargingSchedule& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedule \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingSchedule& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("chargingRateUnit", conversions::charging_rate_unit_to_string(k.chargingRateUnit));
+    writer.member("chargingSchedulePeriod", k.chargingSchedulePeriod);
+    // the optional parts of the message
+    if (k.duration) {
+        writer.member("duration", k.duration.value());
+    }
+    if (k.startSchedule) {
+        writer.member("startSchedule", k.startSchedule.value().to_rfc3339());
+    }
+    if (k.minChargingRate) {
+        writer.member("minChargingRate", k.minChargingRate.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, ChargingSchedule& k) {
     // the required parts of the message
-    k.chargingRateUnit = conversions::string_to_charging_rate_unit(j.at("chargingRateUnit"));
+    k.chargingRateUnit =
+        conversions::string_to_charging_rate_unit(j.at("chargingRateUnit").get_ref<const std::string&>());
     for (auto val : j.at("chargingSchedulePeriod")) {
         k.chargingSchedulePeriod.push_back(val);
     }
@@ -172,6 +234,19 @@ void to_json(json& j, const KeyValue& k) {
     }
 }
 
+/// \brief Writes the given KeyValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const KeyValue& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("key", k.key);
+    writer.member("readonly", k.readonly);
+    // the optional parts of the message
+    if (k.value) {
+        writer.member("value", k.value.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given KeyValue \p k
 void from_json(const json& j, KeyValue& k) {
     // the required parts of the message
@@ -206,6 +281,21 @@ void to_json(json& j, const LogParametersType& k) {
     }
 }
 
+/// \brief Writes the given LogParametersType \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const LogParametersType& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("remoteLocation", k.remoteLocation);
+    // the optional parts of the message
+    if (k.oldestTimestamp) {
+        writer.member("oldestTimestamp", k.oldestTimestamp.value().to_rfc3339());
+    }
+    if (k.latestTimestamp) {
+        writer.member("latestTimestamp", k.latestTimestamp.value().to_rfc3339());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given LogParametersType \p k
 void from_json(const json& j, LogParametersType& k) {
     // the required parts of the message
@@ -254,6 +344,33 @@ void to_json(json& j, const SampledValue& k) {
     }
 }
 
+/// \brief Writes the given SampledValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SampledValue& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("value", k.value);
+    // the optional parts of the message
+    if (k.context) {
+        writer.member("context", conversions::reading_context_to_string(k.context.value()));
+    }
+    if (k.format) {
+        writer.member("format", conversions::value_format_to_string(k.format.value()));
+    }
+    if (k.measurand) {
+        writer.member("measurand", conversions::measurand_to_string(k.measurand.value()));
+    }
+    if (k.phase) {
+        writer.member("phase", conversions::phase_to_string(k.phase.value()));
+    }
+    if (k.location) {
+        writer.member("location", conversions::location_to_string(k.location.value()));
+    }
+    if (k.unit) {
+        writer.member("unit", conversions::unit_of_measure_to_string(k.unit.value()));
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given SampledValue \p k
 void from_json(const json& j, SampledValue& k) {
     // the required parts of the message
@@ -261,22 +378,22 @@ void from_json(const json& j, SampledValue& k) {
 
     // the optional parts of the message
     if (j.contains("context")) {
-        k.context.emplace(conversions::string_to_reading_context(j.at("context")));
+        k.context.emplace(conversions::string_to_reading_context(j.at("context").get_ref<const std::string&>()));
     }
     if (j.contains("format")) {
-        k.format.emplace(conversions::string_to_value_format(j.at("format")));
+        k.format.emplace(conversions::string_to_value_format(j.at("format").get_ref<const std::string&>()));
     }
     if (j.contains("measurand")) {
-        k.measurand.emplace(conversions::string_to_measurand(j.at("measurand")));
+        k.measurand.emplace(conversions::string_to_measurand(j.at("measurand").get_ref<const std::string&>()));
     }
     if (j.contains("phase")) {
-        k.phase.emplace(conversions::string_to_phase(j.at("phase")));
+        k.phase.emplace(conversions::string_to_phase(j.at("phase").get_ref<const std::string&>()));
     }
     if (j.contains("location")) {
-        k.location.emplace(conversions::string_to_location(j.at("location")));
+        k.location.emplace(conversions::string_to_location(j.at("location").get_ref<const std::string&>()));
     }
     if (j.contains("unit")) {
-        k.unit.emplace(conversions::string_to_unit_of_measure(j.at("unit")));
+        k.unit.emplace(conversions::string_to_unit_of_measure(j.at("unit").get_ref<const std::string&>()));
     }
 }
 
@@ -297,6 +414,16 @@ void to_json(json& j, const MeterValue& k) {
     // the optional parts of the message
 }
 
+/// \brief Writes the given MeterValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MeterValue& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("timestamp", k.timestamp.to_rfc3339());
+    writer.member("sampledValue", k.sampledValue);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given MeterValue \p k
 void from_json(const json& j, MeterValue& k) {
     // the required parts of the message
@@ -340,13 +467,41 @@ void to_json(json& j, const ChargingProfile& k) {
     }
 }
 
+/// \brief Writes the given ChargingProfile \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingProfile& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("chargingProfileId", k.chargingProfileId);
+    writer.member("stackLevel", k.stackLevel);
+    writer.member("chargingProfilePurpose",
+                  conversions::charging_profile_purpose_type_to_string(k.chargingProfilePurpose));
+    writer.member("chargingProfileKind", conversions::charging_profile_kind_type_to_string(k.chargingProfileKind));
+    writer.member("chargingSchedule", k.chargingSchedule);
+    // the optional parts of the message
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    if (k.recurrencyKind) {
+        writer.member("recurrencyKind", conversions::recurrency_kind_type_to_string(k.recurrencyKind.value()));
+    }
+    if (k.validFrom) {
+        writer.member("validFrom", k.validFrom.value().to_rfc3339());
+    }
+    if (k.validTo) {
+        writer.member("validTo", k.validTo.value().to_rfc3339());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ChargingProfile \p k
 void from_json(const json& j, ChargingProfile& k) {
     // the required parts of the message
     k.chargingProfileId = j.at("chargingProfileId");
     k.stackLevel = j.at("stackLevel");
-    k.chargingProfilePurpose = conversions::string_to_charging_profile_purpose_type(j.at("chargingProfilePurpose"));
-    k.chargingProfileKind = conversions::string_to_charging_profile_kind_type(j.at("chargingProfileKind"));
+    k.chargingProfilePurpose = conversions::string_to_charging_profile_purpose_type(
+        j.at("chargingProfilePurpose").get_ref<const std::string&>());
+    k.chargingProfileKind =
+        conversions::string_to_charging_profile_kind_type(j.at("chargingProfileKind").get_ref<const std::string&>());
     k.chargingSchedule = j.at("chargingSchedule");
 
     // the optional parts of the message
@@ -354,7 +509,8 @@ void from_json(const json& j, ChargingProfile& k) {
         k.transactionId.emplace(j.at("transactionId"));
     }
     if (j.contains("recurrencyKind")) {
-        k.recurrencyKind.emplace(conversions::string_to_recurrency_kind_type(j.at("recurrencyKind")));
+        k.recurrencyKind.emplace(
+            conversions::string_to_recurrency_kind_type(j.at("recurrencyKind").get_ref<const std::string&>()));
     }
     if (j.contains("validFrom")) {
         k.validFrom.emplace(j.at("validFrom").get<std::string>());
@@ -383,6 +539,18 @@ void to_json(json& j, const LocalAuthorizationList& k) {
     }
 }
 
+/// \brief Writes the given LocalAuthorizationList \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const LocalAuthorizationList& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("idTag", k.idTag);
+    // the optional parts of the message
+    if (k.idTagInfo) {
+        writer.member("idTagInfo", k.idTagInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given LocalAuthorizationList \p k
 void from_json(const json& j, LocalAuthorizationList& k) {
     // the required parts of the message
@@ -416,6 +584,21 @@ void to_json(json& j, const FirmwareType& k) {
     }
 }
 
+/// \brief Writes the given FirmwareType \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const FirmwareType& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("location", k.location);
+    writer.member("retrieveDateTime", k.retrieveDateTime.to_rfc3339());
+    writer.member("signingCertificate", k.signingCertificate);
+    writer.member("signature", k.signature);
+    // the optional parts of the message
+    if (k.installDateTime) {
+        writer.member("installDateTime", k.installDateTime.value().to_rfc3339());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given FirmwareType \p k
 void from_json(const json& j, FirmwareType& k) {
     // the required parts of the message
@@ -447,6 +630,16 @@ void to_json(json& j, const TransactionData& k) {
     // the optional parts of the message
 }
 
+/// \brief Writes the given TransactionData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const TransactionData& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("timestamp", k.timestamp.to_rfc3339());
+    writer.member("sampledValue", k.sampledValue);
+    // the optional parts of the message
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given TransactionData \p k
 void from_json(const json& j, TransactionData& k) {
     // the required parts of the message
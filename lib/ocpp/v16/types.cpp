@@ -179,240 +179,482 @@ std::string messagetype_to_string(MessageType m) {
     throw EnumToStringException{m, "MessageType"};
 }
 
-MessageType string_to_messagetype(const std::string& s) {
-    if (s == "Authorize") {
-        return MessageType::Authorize;
-    }
-    if (s == "AuthorizeResponse") {
-        return MessageType::AuthorizeResponse;
-    }
-    if (s == "BootNotification") {
-        return MessageType::BootNotification;
-    }
-    if (s == "BootNotificationResponse") {
-        return MessageType::BootNotificationResponse;
-    }
-    if (s == "CancelReservation") {
-        return MessageType::CancelReservation;
-    }
-    if (s == "CancelReservationResponse") {
-        return MessageType::CancelReservationResponse;
-    }
-    if (s == "CertificateSigned") {
-        return MessageType::CertificateSigned;
-    }
-    if (s == "CertificateSignedResponse") {
-        return MessageType::CertificateSignedResponse;
-    }
-    if (s == "ChangeAvailability") {
-        return MessageType::ChangeAvailability;
-    }
-    if (s == "ChangeAvailabilityResponse") {
-        return MessageType::ChangeAvailabilityResponse;
-    }
-    if (s == "ChangeConfiguration") {
-        return MessageType::ChangeConfiguration;
-    }
-    if (s == "ChangeConfigurationResponse") {
-        return MessageType::ChangeConfigurationResponse;
-    }
-    if (s == "ClearCache") {
-        return MessageType::ClearCache;
-    }
-    if (s == "ClearCacheResponse") {
-        return MessageType::ClearCacheResponse;
-    }
-    if (s == "ClearChargingProfile") {
-        return MessageType::ClearChargingProfile;
-    }
-    if (s == "ClearChargingProfileResponse") {
-        return MessageType::ClearChargingProfileResponse;
-    }
-    if (s == "DataTransfer") {
-        return MessageType::DataTransfer;
-    }
-    if (s == "DataTransferResponse") {
-        return MessageType::DataTransferResponse;
-    }
-    if (s == "DeleteCertificate") {
-        return MessageType::DeleteCertificate;
-    }
-    if (s == "DeleteCertificateResponse") {
-        return MessageType::DeleteCertificateResponse;
-    }
-    if (s == "DiagnosticsStatusNotification") {
-        return MessageType::DiagnosticsStatusNotification;
-    }
-    if (s == "DiagnosticsStatusNotificationResponse") {
-        return MessageType::DiagnosticsStatusNotificationResponse;
-    }
-    if (s == "ExtendedTriggerMessage") {
-        return MessageType::ExtendedTriggerMessage;
-    }
-    if (s == "ExtendedTriggerMessageResponse") {
-        return MessageType::ExtendedTriggerMessageResponse;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageType::FirmwareStatusNotification;
-    }
-    if (s == "FirmwareStatusNotificationResponse") {
-        return MessageType::FirmwareStatusNotificationResponse;
-    }
-    if (s == "GetCompositeSchedule") {
-        return MessageType::GetCompositeSchedule;
-    }
-    if (s == "GetCompositeScheduleResponse") {
-        return MessageType::GetCompositeScheduleResponse;
-    }
-    if (s == "GetConfiguration") {
-        return MessageType::GetConfiguration;
-    }
-    if (s == "GetConfigurationResponse") {
-        return MessageType::GetConfigurationResponse;
-    }
-    if (s == "GetDiagnostics") {
-        return MessageType::GetDiagnostics;
-    }
-    if (s == "GetDiagnosticsResponse") {
-        return MessageType::GetDiagnosticsResponse;
-    }
-    if (s == "GetInstalledCertificateIds") {
-        return MessageType::GetInstalledCertificateIds;
-    }
-    if (s == "GetInstalledCertificateIdsResponse") {
-        return MessageType::GetInstalledCertificateIdsResponse;
-    }
-    if (s == "GetLocalListVersion") {
-        return MessageType::GetLocalListVersion;
-    }
-    if (s == "GetLocalListVersionResponse") {
-        return MessageType::GetLocalListVersionResponse;
-    }
-    if (s == "GetLog") {
-        return MessageType::GetLog;
-    }
-    if (s == "GetLogResponse") {
-        return MessageType::GetLogResponse;
-    }
-    if (s == "Heartbeat") {
-        return MessageType::Heartbeat;
-    }
-    if (s == "HeartbeatResponse") {
-        return MessageType::HeartbeatResponse;
-    }
-    if (s == "InstallCertificate") {
-        return MessageType::InstallCertificate;
-    }
-    if (s == "InstallCertificateResponse") {
-        return MessageType::InstallCertificateResponse;
-    }
-    if (s == "LogStatusNotification") {
-        return MessageType::LogStatusNotification;
-    }
-    if (s == "LogStatusNotificationResponse") {
-        return MessageType::LogStatusNotificationResponse;
-    }
-    if (s == "MeterValues") {
-        return MessageType::MeterValues;
-    }
-    if (s == "MeterValuesResponse") {
-        return MessageType::MeterValuesResponse;
-    }
-    if (s == "RemoteStartTransaction") {
-        return MessageType::RemoteStartTransaction;
-    }
-    if (s == "RemoteStartTransactionResponse") {
-        return MessageType::RemoteStartTransactionResponse;
-    }
-    if (s == "RemoteStopTransaction") {
-        return MessageType::RemoteStopTransaction;
-    }
-    if (s == "RemoteStopTransactionResponse") {
-        return MessageType::RemoteStopTransactionResponse;
-    }
-    if (s == "ReserveNow") {
-        return MessageType::ReserveNow;
-    }
-    if (s == "ReserveNowResponse") {
-        return MessageType::ReserveNowResponse;
-    }
-    if (s == "Reset") {
-        return MessageType::Reset;
-    }
-    if (s == "ResetResponse") {
-        return MessageType::ResetResponse;
-    }
-    if (s == "SecurityEventNotification") {
-        return MessageType::SecurityEventNotification;
-    }
-    if (s == "SecurityEventNotificationResponse") {
-        return MessageType::SecurityEventNotificationResponse;
-    }
-    if (s == "SendLocalList") {
-        return MessageType::SendLocalList;
-    }
-    if (s == "SendLocalListResponse") {
-        return MessageType::SendLocalListResponse;
-    }
-    if (s == "SetChargingProfile") {
-        return MessageType::SetChargingProfile;
-    }
-    if (s == "SetChargingProfileResponse") {
-        return MessageType::SetChargingProfileResponse;
-    }
-    if (s == "SignCertificate") {
-        return MessageType::SignCertificate;
-    }
-    if (s == "SignCertificateResponse") {
-        return MessageType::SignCertificateResponse;
-    }
-    if (s == "SignedFirmwareStatusNotification") {
-        return MessageType::SignedFirmwareStatusNotification;
-    }
-    if (s == "SignedFirmwareStatusNotificationResponse") {
-        return MessageType::SignedFirmwareStatusNotificationResponse;
-    }
-    if (s == "SignedUpdateFirmware") {
-        return MessageType::SignedUpdateFirmware;
-    }
-    if (s == "SignedUpdateFirmwareResponse") {
-        return MessageType::SignedUpdateFirmwareResponse;
-    }
-    if (s == "StartTransaction") {
-        return MessageType::StartTransaction;
-    }
-    if (s == "StartTransactionResponse") {
-        return MessageType::StartTransactionResponse;
-    }
-    if (s == "StatusNotification") {
-        return MessageType::StatusNotification;
-    }
-    if (s == "StatusNotificationResponse") {
-        return MessageType::StatusNotificationResponse;
-    }
-    if (s == "StopTransaction") {
-        return MessageType::StopTransaction;
-    }
-    if (s == "StopTransactionResponse") {
-        return MessageType::StopTransactionResponse;
-    }
-    if (s == "TriggerMessage") {
-        return MessageType::TriggerMessage;
-    }
-    if (s == "TriggerMessageResponse") {
-        return MessageType::TriggerMessageResponse;
-    }
-    if (s == "UnlockConnector") {
-        return MessageType::UnlockConnector;
-    }
-    if (s == "UnlockConnectorResponse") {
-        return MessageType::UnlockConnectorResponse;
-    }
-    if (s == "UpdateFirmware") {
-        return MessageType::UpdateFirmware;
-    }
-    if (s == "UpdateFirmwareResponse") {
-        return MessageType::UpdateFirmwareResponse;
+MessageType string_to_messagetype(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Reset") {
+            return MessageType::Reset;
+        }
+        break;
+    case 6:
+        if (s == "GetLog") {
+            return MessageType::GetLog;
+        }
+        break;
+    case 9:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Authorize") {
+                return MessageType::Authorize;
+            }
+            break;
+        case 'H':
+            if (s == "Heartbeat") {
+                return MessageType::Heartbeat;
+            }
+            break;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ClearCache") {
+                return MessageType::ClearCache;
+            }
+            break;
+        case 'R':
+            if (s == "ReserveNow") {
+                return MessageType::ReserveNow;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageType::MeterValues;
+        }
+        break;
+    case 12:
+        if (s == "DataTransfer") {
+            return MessageType::DataTransfer;
+        }
+        break;
+    case 13:
+        switch (s[0]) {
+        case 'R':
+            if (s == "ResetResponse") {
+                return MessageType::ResetResponse;
+            }
+            break;
+        case 'S':
+            if (s == "SendLocalList") {
+                return MessageType::SendLocalList;
+            }
+            break;
+        }
+        break;
+    case 14:
+        switch (s[3]) {
+        case 'D':
+            if (s == "GetDiagnostics") {
+                return MessageType::GetDiagnostics;
+            }
+            break;
+        case 'L':
+            if (s == "GetLogResponse") {
+                return MessageType::GetLogResponse;
+            }
+            break;
+        case 'g':
+            if (s == "TriggerMessage") {
+                return MessageType::TriggerMessage;
+            }
+            break;
+        case 'a':
+            if (s == "UpdateFirmware") {
+                return MessageType::UpdateFirmware;
+            }
+            break;
+        }
+        break;
+    case 15:
+        switch (s[1]) {
+        case 'i':
+            if (s == "SignCertificate") {
+                return MessageType::SignCertificate;
+            }
+            break;
+        case 't':
+            if (s == "StopTransaction") {
+                return MessageType::StopTransaction;
+            }
+            break;
+        case 'n':
+            if (s == "UnlockConnector") {
+                return MessageType::UnlockConnector;
+            }
+            break;
+        }
+        break;
+    case 16:
+        switch (s[0]) {
+        case 'B':
+            if (s == "BootNotification") {
+                return MessageType::BootNotification;
+            }
+            break;
+        case 'G':
+            if (s == "GetConfiguration") {
+                return MessageType::GetConfiguration;
+            }
+            break;
+        case 'S':
+            if (s == "StartTransaction") {
+                return MessageType::StartTransaction;
+            }
+            break;
+        }
+        break;
+    case 17:
+        switch (s[2]) {
+        case 't':
+            if (s == "AuthorizeResponse") {
+                return MessageType::AuthorizeResponse;
+            }
+            break;
+        case 'n':
+            if (s == "CancelReservation") {
+                return MessageType::CancelReservation;
+            }
+            break;
+        case 'r':
+            if (s == "CertificateSigned") {
+                return MessageType::CertificateSigned;
+            }
+            break;
+        case 'l':
+            if (s == "DeleteCertificate") {
+                return MessageType::DeleteCertificate;
+            }
+            break;
+        case 'a':
+            if (s == "HeartbeatResponse") {
+                return MessageType::HeartbeatResponse;
+            }
+            break;
+        }
+        break;
+    case 18:
+        switch (s[5]) {
+        case 'e':
+            if (s == "ChangeAvailability") {
+                return MessageType::ChangeAvailability;
+            }
+            break;
+        case 'C':
+            if (s == "ClearCacheResponse") {
+                return MessageType::ClearCacheResponse;
+            }
+            break;
+        case 'l':
+            if (s == "InstallCertificate") {
+                return MessageType::InstallCertificate;
+            }
+            break;
+        case 'v':
+            if (s == "ReserveNowResponse") {
+                return MessageType::ReserveNowResponse;
+            }
+            break;
+        case 'a':
+            if (s == "SetChargingProfile") {
+                return MessageType::SetChargingProfile;
+            }
+            break;
+        case 's':
+            if (s == "StatusNotification") {
+                return MessageType::StatusNotification;
+            }
+            break;
+        }
+        break;
+    case 19:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ChangeConfiguration") {
+                return MessageType::ChangeConfiguration;
+            }
+            break;
+        case 'G':
+            if (s == "GetLocalListVersion") {
+                return MessageType::GetLocalListVersion;
+            }
+            break;
+        case 'M':
+            if (s == "MeterValuesResponse") {
+                return MessageType::MeterValuesResponse;
+            }
+            break;
+        }
+        break;
+    case 20:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ClearChargingProfile") {
+                return MessageType::ClearChargingProfile;
+            }
+            break;
+        case 'D':
+            if (s == "DataTransferResponse") {
+                return MessageType::DataTransferResponse;
+            }
+            break;
+        case 'G':
+            if (s == "GetCompositeSchedule") {
+                return MessageType::GetCompositeSchedule;
+            }
+            break;
+        case 'S':
+            if (s == "SignedUpdateFirmware") {
+                return MessageType::SignedUpdateFirmware;
+            }
+            break;
+        }
+        break;
+    case 21:
+        switch (s[0]) {
+        case 'L':
+            if (s == "LogStatusNotification") {
+                return MessageType::LogStatusNotification;
+            }
+            break;
+        case 'R':
+            if (s == "RemoteStopTransaction") {
+                return MessageType::RemoteStopTransaction;
+            }
+            break;
+        case 'S':
+            if (s == "SendLocalListResponse") {
+                return MessageType::SendLocalListResponse;
+            }
+            break;
+        }
+        break;
+    case 22:
+        switch (s[0]) {
+        case 'E':
+            if (s == "ExtendedTriggerMessage") {
+                return MessageType::ExtendedTriggerMessage;
+            }
+            break;
+        case 'G':
+            if (s == "GetDiagnosticsResponse") {
+                return MessageType::GetDiagnosticsResponse;
+            }
+            break;
+        case 'R':
+            if (s == "RemoteStartTransaction") {
+                return MessageType::RemoteStartTransaction;
+            }
+            break;
+        case 'T':
+            if (s == "TriggerMessageResponse") {
+                return MessageType::TriggerMessageResponse;
+            }
+            break;
+        case 'U':
+            if (s == "UpdateFirmwareResponse") {
+                return MessageType::UpdateFirmwareResponse;
+            }
+            break;
+        }
+        break;
+    case 23:
+        switch (s[1]) {
+        case 'i':
+            if (s == "SignCertificateResponse") {
+                return MessageType::SignCertificateResponse;
+            }
+            break;
+        case 't':
+            if (s == "StopTransactionResponse") {
+                return MessageType::StopTransactionResponse;
+            }
+            break;
+        case 'n':
+            if (s == "UnlockConnectorResponse") {
+                return MessageType::UnlockConnectorResponse;
+            }
+            break;
+        }
+        break;
+    case 24:
+        switch (s[0]) {
+        case 'B':
+            if (s == "BootNotificationResponse") {
+                return MessageType::BootNotificationResponse;
+            }
+            break;
+        case 'G':
+            if (s == "GetConfigurationResponse") {
+                return MessageType::GetConfigurationResponse;
+            }
+            break;
+        case 'S':
+            if (s == "StartTransactionResponse") {
+                return MessageType::StartTransactionResponse;
+            }
+            break;
+        }
+        break;
+    case 25:
+        switch (s[2]) {
+        case 'n':
+            if (s == "CancelReservationResponse") {
+                return MessageType::CancelReservationResponse;
+            }
+            break;
+        case 'r':
+            if (s == "CertificateSignedResponse") {
+                return MessageType::CertificateSignedResponse;
+            }
+            break;
+        case 'l':
+            if (s == "DeleteCertificateResponse") {
+                return MessageType::DeleteCertificateResponse;
+            }
+            break;
+        case 'c':
+            if (s == "SecurityEventNotification") {
+                return MessageType::SecurityEventNotification;
+            }
+            break;
+        }
+        break;
+    case 26:
+        switch (s[4]) {
+        case 'g':
+            if (s == "ChangeAvailabilityResponse") {
+                return MessageType::ChangeAvailabilityResponse;
+            }
+            break;
+        case 'w':
+            if (s == "FirmwareStatusNotification") {
+                return MessageType::FirmwareStatusNotification;
+            }
+            break;
+        case 'n':
+            if (s == "GetInstalledCertificateIds") {
+                return MessageType::GetInstalledCertificateIds;
+            }
+            break;
+        case 'a':
+            if (s == "InstallCertificateResponse") {
+                return MessageType::InstallCertificateResponse;
+            }
+            break;
+        case 'h':
+            if (s == "SetChargingProfileResponse") {
+                return MessageType::SetChargingProfileResponse;
+            }
+            break;
+        case 'u':
+            if (s == "StatusNotificationResponse") {
+                return MessageType::StatusNotificationResponse;
+            }
+            break;
+        }
+        break;
+    case 27:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ChangeConfigurationResponse") {
+                return MessageType::ChangeConfigurationResponse;
+            }
+            break;
+        case 'G':
+            if (s == "GetLocalListVersionResponse") {
+                return MessageType::GetLocalListVersionResponse;
+            }
+            break;
+        }
+        break;
+    case 28:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ClearChargingProfileResponse") {
+                return MessageType::ClearChargingProfileResponse;
+            }
+            break;
+        case 'G':
+            if (s == "GetCompositeScheduleResponse") {
+                return MessageType::GetCompositeScheduleResponse;
+            }
+            break;
+        case 'S':
+            if (s == "SignedUpdateFirmwareResponse") {
+                return MessageType::SignedUpdateFirmwareResponse;
+            }
+            break;
+        }
+        break;
+    case 29:
+        switch (s[0]) {
+        case 'D':
+            if (s == "DiagnosticsStatusNotification") {
+                return MessageType::DiagnosticsStatusNotification;
+            }
+            break;
+        case 'L':
+            if (s == "LogStatusNotificationResponse") {
+                return MessageType::LogStatusNotificationResponse;
+            }
+            break;
+        case 'R':
+            if (s == "RemoteStopTransactionResponse") {
+                return MessageType::RemoteStopTransactionResponse;
+            }
+            break;
+        }
+        break;
+    case 30:
+        switch (s[0]) {
+        case 'E':
+            if (s == "ExtendedTriggerMessageResponse") {
+                return MessageType::ExtendedTriggerMessageResponse;
+            }
+            break;
+        case 'R':
+            if (s == "RemoteStartTransactionResponse") {
+                return MessageType::RemoteStartTransactionResponse;
+            }
+            break;
+        }
+        break;
+    case 32:
+        if (s == "SignedFirmwareStatusNotification") {
+            return MessageType::SignedFirmwareStatusNotification;
+        }
+        break;
+    case 33:
+        if (s == "SecurityEventNotificationResponse") {
+            return MessageType::SecurityEventNotificationResponse;
+        }
+        break;
+    case 34:
+        switch (s[0]) {
+        case 'F':
+            if (s == "FirmwareStatusNotificationResponse") {
+                return MessageType::FirmwareStatusNotificationResponse;
+            }
+            break;
+        case 'G':
+            if (s == "GetInstalledCertificateIdsResponse") {
+                return MessageType::GetInstalledCertificateIdsResponse;
+            }
+            break;
+        }
+        break;
+    case 37:
+        if (s == "DiagnosticsStatusNotificationResponse") {
+            return MessageType::DiagnosticsStatusNotificationResponse;
+        }
+        break;
+    case 40:
+        if (s == "SignedFirmwareStatusNotificationResponse") {
+            return MessageType::SignedFirmwareStatusNotificationResponse;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageType"};
@@ -610,7 +852,8 @@ void to_json(json& j, const EnhancedChargingSchedule& k) {
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, EnhancedChargingSchedule& k) {
     // the required parts of the message
-    k.chargingRateUnit = conversions::string_to_charging_rate_unit(j.at("chargingRateUnit"));
+    k.chargingRateUnit =
+        conversions::string_to_charging_rate_unit(j.at("chargingRateUnit").get_ref<const std::string&>());
     for (auto val : j.at("chargingSchedulePeriod")) {
         k.chargingSchedulePeriod.push_back(val);
     }
@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <ocpp/v16/user_config_persister.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <everest/logging.hpp>
+
+namespace ocpp {
+namespace v16 {
+
+namespace {
+
+constexpr auto TEMPORARY_EXTENSION = ".tmp";
+constexpr mode_t DEFAULT_MODE = 0644;
+
+bool write_all(int fd, const std::string& content) {
+    size_t written = 0;
+    while (written < content.size()) {
+        const auto result = ::write(fd, content.data() + written, content.size() - written);
+        if (result < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        written += static_cast<size_t>(result);
+    }
+    return true;
+}
+
+/// \brief Replaces the file at \p path with \p content, so that the file either has its old or its new content even if
+/// the process or the system crashes while it is written
+bool write_file_atomically(const fs::path& path, const std::string& content) {
+    const auto temporary_path = path.string() + TEMPORARY_EXTENSION;
+
+    // keep the permissions of the existing file
+    mode_t mode = DEFAULT_MODE;
+    struct stat existing;
+    if (::stat(path.c_str(), &existing) == 0) {
+        mode = existing.st_mode & 0777;
+    }
+
+    const int fd = ::open(temporary_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, mode);
+    if (fd < 0) {
+        EVLOG_error << "Could not open " << temporary_path << ": " << std::strerror(errno);
+        return false;
+    }
+    if (!write_all(fd, content) or ::fsync(fd) != 0) {
+        EVLOG_error << "Could not write " << temporary_path << ": " << std::strerror(errno);
+        ::close(fd);
+        ::unlink(temporary_path.c_str());
+        return false;
+    }
+    if (::close(fd) != 0) {
+        EVLOG_error << "Could not close " << temporary_path << ": " << std::strerror(errno);
+        ::unlink(temporary_path.c_str());
+        return false;
+    }
+
+    if (::rename(temporary_path.c_str(), path.c_str()) != 0) {
+        EVLOG_error << "Could not rename " << temporary_path << " to " << path.string() << ": "
+                    << std::strerror(errno);
+        ::unlink(temporary_path.c_str());
+        return false;
+    }
+
+    // make the rename itself durable
+    auto directory = path.parent_path();
+    if (directory.empty()) {
+        directory = ".";
+    }
+    const int directory_fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+    if (directory_fd >= 0) {
+        ::fsync(directory_fd);
+        ::close(directory_fd);
+    }
+    return true;
+}
+
+} // namespace
+
+UserConfigPersister::UserConfigPersister(const fs::path& user_config_path, std::chrono::milliseconds write_delay) :
+    user_config_path(user_config_path),
+    write_delay(std::max(write_delay, std::chrono::milliseconds(0))),
+    user_config(nlohmann::json::object()),
+    pending_changes(false),
+    running(false) {
+    if (fs::exists(this->user_config_path)) {
+        std::ifstream ifs(this->user_config_path.c_str());
+        this->user_config = nlohmann::json::parse(ifs);
+    }
+
+    if (this->write_delay.count() > 0) {
+        this->running = true;
+        this->writer_thread = std::thread(&UserConfigPersister::run_writer, this);
+    }
+}
+
+UserConfigPersister::~UserConfigPersister() {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->running = false;
+    }
+    this->cv.notify_one();
+    if (this->writer_thread.joinable()) {
+        this->writer_thread.join();
+    }
+    this->write();
+}
+
+void UserConfigPersister::set(const std::string& profile, const std::string& key, const nlohmann::json& value) {
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->user_config[profile][key] = value;
+        this->last_pending_change = Clock::now();
+        if (!this->pending_changes) {
+            this->pending_changes = true;
+            this->first_pending_change = this->last_pending_change;
+        }
+    }
+
+    if (this->write_delay.count() > 0) {
+        this->cv.notify_one();
+    } else {
+        this->write();
+    }
+}
+
+bool UserConfigPersister::flush() {
+    return this->write();
+}
+
+void UserConfigPersister::run_writer() {
+    std::unique_lock<std::mutex> lock(this->mutex);
+    while (this->running) {
+        if (!this->pending_changes) {
+            this->cv.wait(lock, [this]() { return !this->running or this->pending_changes; });
+            continue;
+        }
+
+        const auto write_at = std::min(this->last_pending_change + this->write_delay,
+                                       this->first_pending_change + this->write_delay * MAXIMUM_DELAY_FACTOR);
+        if (Clock::now() < write_at) {
+            this->cv.wait_until(lock, write_at);
+            continue;
+        }
+
+        lock.unlock();
+        this->write();
+        lock.lock();
+    }
+}
+
+bool UserConfigPersister::write() {
+    std::lock_guard<std::mutex> write_lock(this->write_mutex);
+    std::string content;
+    {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (!this->pending_changes) {
+            return true;
+        }
+        content = this->user_config.dump() + "\n";
+        this->pending_changes = false;
+    }
+
+    if (write_file_atomically(this->user_config_path, content)) {
+        return true;
+    }
+
+    EVLOG_error << "Could not persist the user config, retrying with the next write";
+    std::lock_guard<std::mutex> lock(this->mutex);
+    if (!this->pending_changes) {
+        this->pending_changes = true;
+        this->first_pending_change = Clock::now();
+        this->last_pending_change = this->first_pending_change;
+    }
+    return false;
+}
+
+} // namespace v16
+} // namespace ocpp
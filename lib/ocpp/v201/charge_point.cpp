@@ -29,12 +29,25 @@ namespace v201 {
 
 const auto DEFAULT_BOOT_NOTIFICATION_RETRY_INTERVAL = std::chrono::seconds(30);
 const auto DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD = 2E5;
+const auto DEFAULT_MESSAGE_QUEUE_DB_FLUSH_INTERVAL_MS = 250;
+const auto DEFAULT_MESSAGE_QUEUE_INGRESS_RING_CAPACITY = 1024;
 const auto DEFAULT_MAX_MESSAGE_SIZE = 65000;
 
 static DisplayMessageContent message_content_to_display_message_content(const MessageContent& message_content);
 static std::optional<MessageInfo> display_message_to_message_info_type(const DisplayMessage& display_message);
 static DisplayMessage message_info_to_display_message(const MessageInfo& message_info);
 
+static common::DatabaseTuning get_database_tuning(const DeviceModel& device_model) {
+    const auto preset =
+        device_model.get_optional_value<std::string>(ControllerComponentVariables::DatabaseTuning).value_or("Durable");
+    try {
+        return common::DatabaseTuning::from_preset(preset);
+    } catch (const std::out_of_range& e) {
+        EVLOG_warning << "Unknown DatabaseTuning " << preset << ", using Durable";
+        return common::DatabaseTuning::durable();
+    }
+}
+
 ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure,
                          std::shared_ptr<DeviceModel> device_model, std::shared_ptr<DatabaseHandler> database_handler,
                          std::shared_ptr<MessageQueue<v201::MessageType>> message_queue,
@@ -82,11 +95,8 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
                          const std::string& core_database_path, const std::string& sql_init_path,
                          const std::string& message_log_path, const std::shared_ptr<EvseSecurity> evse_security,
                          const Callbacks& callbacks) :
-    ChargePoint(
-        evse_connector_structure, std::make_shared<DeviceModel>(std::move(device_model_storage)),
-        std::make_shared<DatabaseHandler>(
-            std::make_unique<common::DatabaseConnection>(fs::path(core_database_path) / "cp.db"), sql_init_path),
-        nullptr /* message_queue initialized in this constructor */, message_log_path, evse_security, callbacks) {
+    ChargePoint(evse_connector_structure, std::make_shared<DeviceModel>(std::move(device_model_storage)),
+                fs::path(core_database_path), fs::path(sql_init_path), message_log_path, evse_security, callbacks) {
     std::set<v201::MessageType> message_types_discard_for_queueing;
     try {
         const auto message_types_discard_for_queueing_csl = ocpp::split_string(
@@ -105,18 +115,49 @@ ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_struct
         EVLOG_warning << "Could not apply MessageTypesDiscardForQueueing configuration";
     }
 
+    MessageQueueConfig<v201::MessageType> config{
+        this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts),
+        this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval),
+        this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueSizeThreshold)
+            .value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
+        this->device_model->get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages).value_or(false),
+        message_types_discard_for_queueing,
+        this->device_model->get_value<int>(ControllerComponentVariables::MessageTimeout)};
+    config.queue_db_flush_interval_ms = DEFAULT_MESSAGE_QUEUE_DB_FLUSH_INTERVAL_MS;
+    config.ingress_ring_capacity = DEFAULT_MESSAGE_QUEUE_INGRESS_RING_CAPACITY;
+    config.replay_window =
+        this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueReplayWindow)
+            .value_or(1);
+
     this->message_queue = std::make_unique<ocpp::MessageQueue<v201::MessageType>>(
-        [this](json message) -> bool { return this->connectivity_manager->send_to_websocket(message.dump()); },
-        MessageQueueConfig<v201::MessageType>{
-            this->device_model->get_value<int>(ControllerComponentVariables::MessageAttempts),
-            this->device_model->get_value<int>(ControllerComponentVariables::MessageAttemptInterval),
-            this->device_model->get_optional_value<int>(ControllerComponentVariables::MessageQueueSizeThreshold)
-                .value_or(DEFAULT_MESSAGE_QUEUE_SIZE_THRESHOLD),
-            this->device_model->get_optional_value<bool>(ControllerComponentVariables::QueueAllMessages)
-                .value_or(false),
-            message_types_discard_for_queueing,
-            this->device_model->get_value<int>(ControllerComponentVariables::MessageTimeout)},
-        this->database_handler);
+        [this](json message) -> bool { return this->connectivity_manager->send_to_websocket_async(message.dump()); },
+        config, this->database_handler);
+    // a CALL that the websocket drops after accepting it is reported back through on_sent and sent again
+    this->message_queue->register_serialized_send_callback(
+        [this](const std::string& message, const std::function<void(bool sent)>& on_sent) -> bool {
+            return this->connectivity_manager->send_to_websocket_async(message, on_sent);
+        });
+    this->message_queue->register_writer_send_callback(
+        [this](const std::function<void(JsonWriter& writer)>& write) -> bool {
+            return this->connectivity_manager->send_to_websocket_async(write);
+        });
+    if (this->callbacks.message_queue_replay_progress_callback.has_value()) {
+        this->message_queue->register_replay_progress_callback(
+            this->callbacks.message_queue_replay_progress_callback.value());
+    }
+}
+
+ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure,
+                         std::shared_ptr<DeviceModel> device_model, const fs::path& core_database_path,
+                         const fs::path& sql_init_path, const std::string& message_log_path,
+                         const std::shared_ptr<EvseSecurity> evse_security, const Callbacks& callbacks) :
+    ChargePoint(evse_connector_structure, device_model,
+                std::make_shared<DatabaseHandler>(
+                    std::make_unique<common::DatabaseConnection>(core_database_path / "cp.db",
+                                                                 get_database_tuning(*device_model)),
+                    sql_init_path),
+                nullptr /* message_queue initialized in the delegating constructor */, message_log_path, evse_security,
+                callbacks) {
 }
 
 ChargePoint::ChargePoint(const std::map<int32_t, int32_t>& evse_connector_structure,
@@ -201,6 +242,10 @@ void ChargePoint::disconnect_websocket() {
     this->connectivity_manager->disconnect_websocket();
 }
 
+WebsocketMetrics ChargePoint::get_websocket_metrics() {
+    return this->connectivity_manager->get_websocket_metrics();
+}
+
 void ChargePoint::on_firmware_update_status_notification(int32_t request_id,
                                                          const FirmwareStatusEnum& firmware_update_status) {
     if (this->firmware_status == firmware_update_status) {
@@ -539,6 +584,7 @@ void ChargePoint::configure_message_logging_format(const std::string& message_lo
     bool detailed_log_to_console = log_formats.find("console_detailed") != log_formats.npos;
     bool log_to_file = log_formats.find("log") != log_formats.npos;
     bool log_to_html = log_formats.find("html") != log_formats.npos;
+    bool log_to_binary = log_formats.find("binary") != log_formats.npos;
     bool log_security = log_formats.find("security") != log_formats.npos;
     bool session_logging = log_formats.find("session_logging") != log_formats.npos;
     bool message_callback = log_formats.find("callback") != log_formats.npos;
@@ -554,6 +600,17 @@ void ChargePoint::configure_message_logging_format(const std::string& message_lo
     uint64_t log_rotation_maximum_file_count =
         this->device_model->get_optional_value<uint64_t>(ControllerComponentVariables::LogRotationMaximumFileCount)
             .value_or(0);
+    bool log_rotation_compress =
+        this->device_model->get_optional_value<bool>(ControllerComponentVariables::LogRotationCompress)
+            .value_or(false);
+
+    const ocpp::LogQueueConfig log_queue_config(
+        this->device_model->get_optional_value<uint64_t>(ControllerComponentVariables::LogMessagesQueueSize)
+            .value_or(DEFAULT_LOG_QUEUE_CAPACITY),
+        this->device_model->get_optional_value<std::string>(ControllerComponentVariables::LogMessagesQueueFullPolicy)
+                    .value_or("Block") == "Drop"
+            ? ocpp::LogQueueFullPolicy::Drop
+            : ocpp::LogQueueFullPolicy::Block);
 
     if (message_callback) {
         logging_callback = this->callbacks.ocpp_messages_callback.value_or(nullptr);
@@ -564,11 +621,12 @@ void ChargePoint::configure_message_logging_format(const std::string& message_lo
             !log_formats.empty(), message_log_path, "libocpp_201", log_to_console, detailed_log_to_console, log_to_file,
             log_to_html, log_security, session_logging, logging_callback,
             ocpp::LogRotationConfig(log_rotation_date_suffix, log_rotation_maximum_file_size,
-                                    log_rotation_maximum_file_count));
+                                    log_rotation_maximum_file_count, log_rotation_compress),
+            log_queue_config, log_to_binary);
     } else {
         this->logging = std::make_shared<ocpp::MessageLogging>(
             !log_formats.empty(), message_log_path, DateTime().to_rfc3339(), log_to_console, detailed_log_to_console,
-            log_to_file, log_to_html, log_security, session_logging, logging_callback);
+            log_to_file, log_to_html, log_security, session_logging, logging_callback, log_queue_config, log_to_binary);
     }
 }
 
@@ -1373,7 +1431,7 @@ void ChargePoint::message_callback(const std::string& message) {
     }
 
     enhanced_message.message_size = message.size();
-    auto json_message = enhanced_message.message;
+    const auto& json_message = enhanced_message.message;
     this->logging->central_system(conversions::messagetype_to_string(enhanced_message.messageType), message);
     try {
         if (this->registration_status == RegistrationStatusEnum::Accepted) {
@@ -2450,7 +2508,7 @@ void ChargePoint::handle_set_variables_req(Call<SetVariablesRequest> call) {
 }
 
 void ChargePoint::handle_get_variables_req(const EnhancedMessage<v201::MessageType>& message) {
-    Call<GetVariablesRequest> call = message.call_message;
+    Call<GetVariablesRequest> call = message.message;
     const auto msg = call.msg;
 
     const auto max_variables_per_message =
@@ -2496,7 +2554,7 @@ void ChargePoint::handle_get_base_report_req(Call<GetBaseReportRequest> call) {
 }
 
 void ChargePoint::handle_get_report_req(const EnhancedMessage<v201::MessageType>& message) {
-    Call<GetReportRequest> call = message.call_message;
+    Call<GetReportRequest> call = message.message;
     const auto msg = call.msg;
     std::vector<ReportData> report_data;
     GetReportResponse response;
@@ -2740,7 +2798,7 @@ void ChargePoint::handle_clear_cache_req(Call<ClearCacheRequest> call) {
 
 void ChargePoint::handle_transaction_event_response(const EnhancedMessage<v201::MessageType>& message) {
     CallResult<TransactionEventResponse> call_result = message.message;
-    const Call<TransactionEventRequest>& original_call = message.call_message;
+    const Call<TransactionEventRequest> original_call = message.get_call_message();
     const auto& original_msg = original_call.msg;
 
     if (this->callbacks.transaction_event_response_callback.has_value()) {
@@ -3678,7 +3736,7 @@ void ChargePoint::handle_set_monitoring_level_req(Call<SetMonitoringLevelRequest
 }
 
 void ChargePoint::handle_set_variable_monitoring_req(const EnhancedMessage<v201::MessageType>& message) {
-    Call<SetVariableMonitoringRequest> call = message.call_message;
+    Call<SetVariableMonitoringRequest> call = message.message;
     SetVariableMonitoringResponse response;
     const auto& msg = call.msg;
 
@@ -3963,7 +4021,7 @@ void ChargePoint::handle_data_transfer_req(Call<DataTransferRequest> call) {
 }
 
 template <class T> bool ChargePoint::send(ocpp::Call<T> call, const bool initiated_by_trigger_message) {
-    const auto message_type = conversions::string_to_messagetype(json(call).at(CALL_ACTION));
+    const auto message_type = conversions::string_to_messagetype(call.msg.get_type());
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), initiated_by_trigger_message,
         (this->registration_status == RegistrationStatusEnum::Accepted), is_transaction_message(message_type),
@@ -3982,7 +4040,7 @@ template <class T> bool ChargePoint::send(ocpp::Call<T> call, const bool initiat
 }
 
 template <class T> std::future<EnhancedMessage<v201::MessageType>> ChargePoint::send_async(ocpp::Call<T> call) {
-    const auto message_type = conversions::string_to_messagetype(json(call).at(CALL_ACTION));
+    const auto message_type = conversions::string_to_messagetype(call.msg.get_type());
     const auto message_transmission_priority = get_message_transmission_priority(
         is_boot_notification_message(message_type), false,
         (this->registration_status == RegistrationStatusEnum::Accepted), is_transaction_message(message_type),
@@ -86,6 +86,13 @@ bool ConnectivityManager::is_websocket_connected() {
     return this->websocket != nullptr && this->websocket->is_connected();
 }
 
+WebsocketMetrics ConnectivityManager::get_websocket_metrics() {
+    if (this->websocket == nullptr) {
+        return {};
+    }
+    return this->websocket->get_metrics();
+}
+
 void ConnectivityManager::start() {
     init_websocket();
     if (websocket != nullptr) {
@@ -123,6 +130,23 @@ bool ConnectivityManager::send_to_websocket(const std::string& message) {
     return this->websocket->send(message);
 }
 
+bool ConnectivityManager::send_to_websocket_async(const std::string& message,
+                                                  const std::function<void(bool sent)>& on_sent) {
+    if (this->websocket == nullptr) {
+        return false;
+    }
+
+    return this->websocket->send_async(message, on_sent);
+}
+
+bool ConnectivityManager::send_to_websocket_async(const std::function<void(JsonWriter& writer)>& write) {
+    if (this->websocket == nullptr) {
+        return false;
+    }
+
+    return this->websocket->send_async(write);
+}
+
 void ConnectivityManager::init_websocket() {
     if (this->device_model.get_value<std::string>(ControllerComponentVariables::ChargePointId).find(':') !=
         std::string::npos) {
@@ -246,6 +270,30 @@ WebsocketConnectionOptions ConnectivityManager::get_ws_connection_options(const
         this->device_model.get_optional_value<std::string>(ControllerComponentVariables::IFace),
         this->device_model.get_optional_value<bool>(ControllerComponentVariables::EnableTLSKeylog).value_or(false),
         this->device_model.get_optional_value<std::string>(ControllerComponentVariables::TLSKeylogFile)};
+    connection_options.max_fragment_size =
+        this->device_model.get_optional_value<int>(ControllerComponentVariables::WebsocketMaxFragmentSize)
+            .value_or(DEFAULT_WEBSOCKET_MAX_FRAGMENT_SIZE);
+    connection_options.max_send_queue_size =
+        this->device_model.get_optional_value<int>(ControllerComponentVariables::WebsocketMaxSendQueueSize)
+            .value_or(DEFAULT_WEBSOCKET_MAX_SEND_QUEUE_SIZE);
+    connection_options.enable_compression =
+        this->device_model.get_optional_value<bool>(ControllerComponentVariables::WebsocketCompression).value_or(false);
+    connection_options.compression_window_bits =
+        this->device_model.get_optional_value<int>(ControllerComponentVariables::WebsocketCompressionWindowBits)
+            .value_or(15);
+    connection_options.compression_level =
+        this->device_model.get_optional_value<int>(ControllerComponentVariables::WebsocketCompressionLevel)
+            .value_or(6);
+    connection_options.use_shared_event_loop =
+        this->device_model.get_optional_value<bool>(ControllerComponentVariables::WebsocketSharedEventLoop)
+            .value_or(false);
+    connection_options.shared_event_loop_workers =
+        this->device_model.get_optional_value<int>(ControllerComponentVariables::WebsocketSharedEventLoopWorkers)
+            .value_or(DEFAULT_WEBSOCKET_EVENT_LOOP_WORKERS);
+    connection_options.enable_tls_session_resumption =
+        this->device_model.get_optional_value<bool>(ControllerComponentVariables::TLSSessionResumption).value_or(false);
+    connection_options.tls_session_cache_file =
+        this->device_model.get_optional_value<std::string>(ControllerComponentVariables::TLSSessionCacheFile);
 
     return connection_options;
 }
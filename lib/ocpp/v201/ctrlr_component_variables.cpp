@@ -184,6 +184,27 @@ const ComponentVariable& LogRotationMaximumFileCount = {
         "LogRotationMaximumFileCount",
     }),
 };
+const ComponentVariable& LogRotationCompress = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "LogRotationCompress",
+    }),
+};
+const ComponentVariable& LogMessagesQueueSize = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "LogMessagesQueueSize",
+    }),
+};
+const ComponentVariable& LogMessagesQueueFullPolicy = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "LogMessagesQueueFullPolicy",
+    }),
+};
 const ComponentVariable& SupportedCriteria = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
@@ -268,6 +289,69 @@ const ComponentVariable& TLSKeylogFile = {
         "TLSKeylogFile",
     }),
 };
+const ComponentVariable& WebsocketMaxFragmentSize = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketMaxFragmentSize",
+    }),
+};
+const ComponentVariable& WebsocketMaxSendQueueSize = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketMaxSendQueueSize",
+    }),
+};
+const ComponentVariable& WebsocketCompression = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketCompression",
+    }),
+};
+const ComponentVariable& WebsocketCompressionWindowBits = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketCompressionWindowBits",
+    }),
+};
+const ComponentVariable& WebsocketCompressionLevel = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketCompressionLevel",
+    }),
+};
+const ComponentVariable& WebsocketSharedEventLoop = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketSharedEventLoop",
+    }),
+};
+const ComponentVariable& WebsocketSharedEventLoopWorkers = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "WebsocketSharedEventLoopWorkers",
+    }),
+};
+const ComponentVariable& TLSSessionResumption = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "TLSSessionResumption",
+    }),
+};
+const ComponentVariable& TLSSessionCacheFile = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "TLSSessionCacheFile",
+    }),
+};
 const ComponentVariable& OcspRequestInterval = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
@@ -338,6 +422,20 @@ const ComponentVariable& MessageQueueSizeThreshold = {
         "MessageQueueSizeThreshold",
     }),
 };
+const ComponentVariable& MessageQueueReplayWindow = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "MessageQueueReplayWindow",
+    }),
+};
+const ComponentVariable& DatabaseTuning = {
+    ControllerComponents::InternalCtrlr,
+    std::nullopt,
+    std::optional<Variable>({
+        "DatabaseTuning",
+    }),
+};
 const ComponentVariable& MaxMessageSize = {
     ControllerComponents::InternalCtrlr,
     std::nullopt,
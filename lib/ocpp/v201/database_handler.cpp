@@ -21,6 +21,22 @@ using namespace common;
 
 namespace v201 {
 
+static const std::string AUTHORIZATION_CACHE_UPDATE_LAST_USED_SQL =
+    "UPDATE AUTH_CACHE SET LAST_USED = @last_used WHERE ID_TOKEN_HASH = @id_token_hash";
+static const std::string AUTHORIZATION_CACHE_GET_ENTRY_SQL =
+    "SELECT ID_TOKEN_INFO, LAST_USED FROM AUTH_CACHE WHERE ID_TOKEN_HASH = @id_token_hash";
+static const std::string INSERT_METER_VALUE_SQL =
+    "INSERT INTO METER_VALUES (TRANSACTION_ID, TIMESTAMP, READING_CONTEXT, CUSTOM_DATA) VALUES "
+    "(@transaction_id, @timestamp, @context, @custom_data)";
+static const std::string INSERT_METER_VALUE_ITEM_SQL =
+    "INSERT INTO METER_VALUE_ITEMS (METER_VALUE_ID, VALUE, MEASURAND, PHASE, LOCATION, CUSTOM_DATA, "
+    "UNIT_CUSTOM_DATA, UNIT_TEXT, UNIT_MULTIPLIER, SIGNED_METER_DATA, SIGNING_METHOD, "
+    "ENCODING_METHOD, PUBLIC_KEY) VALUES (@meter_value_id, @value, @measurand, "
+    "@phase, @location, @custom_data, @unit_custom_data, @unit_text, @unit_multiplier, "
+    "@signed_meter_data, @signing_method, @encoding_method, @public_key);";
+static const std::string UPDATE_TRANSACTION_SEQ_NO_SQL =
+    "UPDATE TRANSACTIONS SET SEQ_NO = @seq_no WHERE TRANSACTION_ID = @transaction_id";
+
 DatabaseHandler::DatabaseHandler(std::unique_ptr<DatabaseConnectionInterface> database,
                                  const fs::path& sql_migration_files_path) :
     DatabaseHandlerCommon(std::move(database), sql_migration_files_path, MIGRATION_FILE_VERSION_V201) {
@@ -39,6 +55,14 @@ void DatabaseHandler::init_sql() {
     }
 }
 
+std::vector<std::string> DatabaseHandler::get_hot_statements() {
+    auto statements = DatabaseHandlerCommon::get_hot_statements();
+    statements.insert(statements.end(), {AUTHORIZATION_CACHE_UPDATE_LAST_USED_SQL, AUTHORIZATION_CACHE_GET_ENTRY_SQL,
+                                         INSERT_METER_VALUE_SQL, INSERT_METER_VALUE_ITEM_SQL,
+                                         UPDATE_TRANSACTION_SEQ_NO_SQL});
+    return statements;
+}
+
 void DatabaseHandler::inintialize_enum_tables() {
 
     // TODO: Don't throw away all meter value items to allow resuming transactions
@@ -117,8 +141,7 @@ void DatabaseHandler::authorization_cache_insert_entry(const std::string& id_tok
 }
 
 void DatabaseHandler::authorization_cache_update_last_used(const std::string& id_token_hash) {
-    std::string sql = "UPDATE AUTH_CACHE SET LAST_USED = @last_used WHERE ID_TOKEN_HASH = @id_token_hash";
-    auto insert_stmt = this->database->new_statement(sql);
+    auto insert_stmt = this->database->new_statement(AUTHORIZATION_CACHE_UPDATE_LAST_USED_SQL);
 
     insert_stmt->bind_datetime("@last_used", DateTime());
     insert_stmt->bind_text("@id_token_hash", id_token_hash);
@@ -130,8 +153,7 @@ void DatabaseHandler::authorization_cache_update_last_used(const std::string& id
 
 std::optional<AuthorizationCacheEntry>
 DatabaseHandler::authorization_cache_get_entry(const std::string& id_token_hash) {
-    std::string sql = "SELECT ID_TOKEN_INFO, LAST_USED FROM AUTH_CACHE WHERE ID_TOKEN_HASH = @id_token_hash";
-    auto select_stmt = this->database->new_statement(sql);
+    auto select_stmt = this->database->new_statement(AUTHORIZATION_CACHE_GET_ENTRY_SQL);
 
     select_stmt->bind_text("@id_token_hash", id_token_hash);
 
@@ -380,10 +402,7 @@ void DatabaseHandler::transaction_metervalues_insert(const std::string& transact
         throw std::invalid_argument("All metervalues must have the same context");
     }
 
-    std::string sql1 = "INSERT INTO METER_VALUES (TRANSACTION_ID, TIMESTAMP, READING_CONTEXT, CUSTOM_DATA) VALUES "
-                       "(@transaction_id, @timestamp, @context, @custom_data)";
-
-    auto stmt = this->database->new_statement(sql1);
+    auto stmt = this->database->new_statement(INSERT_METER_VALUE_SQL);
 
     stmt->bind_text("@transaction_id", transaction_id);
     stmt->bind_datetime("@timestamp", meter_value.timestamp);
@@ -398,14 +417,8 @@ void DatabaseHandler::transaction_metervalues_insert(const std::string& transact
     auto last_row_id = this->database->get_last_inserted_rowid();
     stmt->reset();
 
-    std::string sql2 = "INSERT INTO METER_VALUE_ITEMS (METER_VALUE_ID, VALUE, MEASURAND, PHASE, LOCATION, CUSTOM_DATA, "
-                       "UNIT_CUSTOM_DATA, UNIT_TEXT, UNIT_MULTIPLIER, SIGNED_METER_DATA, SIGNING_METHOD, "
-                       "ENCODING_METHOD, PUBLIC_KEY) VALUES (@meter_value_id, @value, @measurand, "
-                       "@phase, @location, @custom_data, @unit_custom_data, @unit_text, @unit_multiplier, "
-                       "@signed_meter_data, @signing_method, @encoding_method, @public_key);";
-
     auto transaction = this->database->begin_transaction();
-    auto insert_stmt = this->database->new_statement(sql2);
+    auto insert_stmt = this->database->new_statement(INSERT_METER_VALUE_ITEM_SQL);
 
     for (const auto& item : meter_value.sampledValue) {
         insert_stmt->bind_int("@meter_value_id", last_row_id);
@@ -684,8 +697,7 @@ std::unique_ptr<EnhancedTransaction> DatabaseHandler::transaction_get(const int3
 }
 
 void DatabaseHandler::transaction_update_seq_no(const std::string& transaction_id, int32_t seq_no) {
-    std::string sql = "UPDATE TRANSACTIONS SET SEQ_NO = @seq_no WHERE TRANSACTION_ID = @transaction_id";
-    auto update_stmt = this->database->new_statement(sql);
+    auto update_stmt = this->database->new_statement(UPDATE_TRANSACTION_SEQ_NO_SQL);
 
     update_stmt->bind_int("@seq_no", seq_no);
     update_stmt->bind_text("@transaction_id", transaction_id);
@@ -233,19 +233,23 @@ GetVariableStatusEnum DeviceModel::request_value_internal(const Component& compo
         return GetVariableStatusEnum::UnknownVariable;
     }
 
-    const auto attribute_opt = this->storage->get_variable_attribute(component_id, variable_id, attribute_enum);
+    std::lock_guard<std::mutex> lock(this->attributes_mutex);
+    const auto& attributes = variable_it->second.attributes;
+    const auto attribute_it = attributes.find(attribute_enum);
 
-    if ((not attribute_opt) or (not attribute_opt->value)) {
+    if (attribute_it == attributes.end() or (not attribute_it->second.value)) {
         return GetVariableStatusEnum::NotSupportedAttributeType;
     }
 
+    const auto& attribute = attribute_it->second;
+
     // only internal functions can access WriteOnly variables
-    if (!allow_write_only and attribute_opt.value().mutability.has_value() and
-        attribute_opt.value().mutability.value() == MutabilityEnum::WriteOnly) {
+    if (!allow_write_only and attribute.mutability.has_value() and
+        attribute.mutability.value() == MutabilityEnum::WriteOnly) {
         return GetVariableStatusEnum::Rejected;
     }
 
-    value = attribute_opt->value->get();
+    value = attribute.value->get();
     return GetVariableStatusEnum::Accepted;
 }
 
@@ -253,17 +257,20 @@ SetVariableStatusEnum DeviceModel::set_value(const Component& component, const V
                                              const AttributeEnum& attribute_enum, const std::string& value,
                                              const std::string& source, bool allow_read_only) {
 
-    if (this->device_model.find(component) == this->device_model.end()) {
+    const auto component_it = this->device_model.find(component);
+    if (component_it == this->device_model.end()) {
         return SetVariableStatusEnum::UnknownComponent;
     }
 
-    auto variable_map = this->device_model[component];
+    auto& variable_map = component_it->second;
+    const auto variable_it = variable_map.find(variable);
 
-    if (variable_map.find(variable) == variable_map.end()) {
+    if (variable_it == variable_map.end()) {
         return SetVariableStatusEnum::UnknownVariable;
     }
 
-    const auto& characteristics = variable_map[variable].characteristics;
+    auto& variable_meta_data = variable_it->second;
+    const auto& characteristics = variable_meta_data.characteristics;
     try {
         if (!validate_value(characteristics, value, allow_zero(component, variable))) {
             return SetVariableStatusEnum::Rejected;
@@ -274,45 +281,86 @@ SetVariableStatusEnum DeviceModel::set_value(const Component& component, const V
         return SetVariableStatusEnum::Rejected;
     }
 
-    const auto attribute = this->storage->get_variable_attribute(component, variable, attribute_enum);
+    std::unique_lock<std::mutex> lock(this->attributes_mutex);
+    const auto attribute_it = variable_meta_data.attributes.find(attribute_enum);
 
-    if (!attribute.has_value()) {
+    if (attribute_it == variable_meta_data.attributes.end()) {
         return SetVariableStatusEnum::NotSupportedAttributeType;
     }
 
+    auto& attribute = attribute_it->second;
+
     // If allow_read_only is false, don't allow read only
-    if (!attribute.value().mutability.has_value() or
-        ((attribute.value().mutability.value() == MutabilityEnum::ReadOnly) and !allow_read_only)) {
+    if (!attribute.mutability.has_value() or
+        ((attribute.mutability.value() == MutabilityEnum::ReadOnly) and !allow_read_only)) {
         return SetVariableStatusEnum::Rejected;
     }
 
-    const auto success =
-        this->storage->set_variable_attribute_value(component, variable, attribute_enum, value, source);
+    // Values that are not persistent only live in memory, everything else is written through to the storage
+    bool success = true;
+    if (attribute.persistent.value_or(true)) {
+        success = this->storage->set_variable_attribute_value(component, variable, attribute_enum, value, source);
+    }
+
+    if (!success) {
+        return SetVariableStatusEnum::Rejected;
+    }
+
+    const VariableAttribute attribute_previous = attribute;
+    attribute.value = value;
+    lock.unlock();
 
     // Only trigger for actual values
-    if ((attribute_enum == AttributeEnum::Actual) && success && variable_listener) {
-        const auto& monitors = variable_map[variable].monitors;
+    if ((attribute_enum == AttributeEnum::Actual) && variable_listener) {
+        const auto& monitors = variable_meta_data.monitors;
 
         // If we had a variable value change, trigger the listener
         if (!monitors.empty()) {
             static const std::string EMPTY_VALUE{};
 
-            const std::string& value_previous = attribute.value().value.value_or(EMPTY_VALUE);
+            const std::string& value_previous = attribute_previous.value.value_or(EMPTY_VALUE);
             const std::string& value_current = value;
 
             if (value_previous != value_current) {
-                variable_listener(monitors, component, variable, characteristics, attribute.value(), value_previous,
+                variable_listener(monitors, component, variable, characteristics, attribute_previous, value_previous,
                                   value_current);
             }
         }
     }
 
-    return success ? SetVariableStatusEnum::Accepted : SetVariableStatusEnum::Rejected;
+    return SetVariableStatusEnum::Accepted;
 };
 
 DeviceModel::DeviceModel(std::unique_ptr<DeviceModelStorage> device_model_storage) :
     storage{std::move(device_model_storage)} {
     this->device_model = this->storage->get_device_model();
+    this->load_variable_attributes();
+}
+
+void DeviceModel::load_variable_attributes() {
+    std::lock_guard<std::mutex> lock(this->attributes_mutex);
+    for (auto& [component, variable_map] : this->device_model) {
+        for (auto& [variable, variable_meta_data] : variable_map) {
+            variable_meta_data.attributes.clear();
+            for (auto& attribute : this->storage->get_variable_attributes(component, variable)) {
+                if (attribute.type.has_value()) {
+                    const auto attribute_enum = attribute.type.value();
+                    variable_meta_data.attributes.emplace(attribute_enum, std::move(attribute));
+                }
+            }
+        }
+    }
+}
+
+std::vector<VariableAttribute>
+DeviceModel::get_cached_variable_attributes(const VariableMetaData& variable_meta_data) const {
+    std::lock_guard<std::mutex> lock(this->attributes_mutex);
+    std::vector<VariableAttribute> attributes;
+    attributes.reserve(variable_meta_data.attributes.size());
+    for (const auto& [attribute_enum, attribute] : variable_meta_data.attributes) {
+        attributes.push_back(attribute);
+    }
+    return attributes;
 }
 
 SetVariableStatusEnum DeviceModel::set_read_only_value(const Component& component, const Variable& variable,
@@ -347,8 +395,7 @@ std::vector<ReportData> DeviceModel::get_base_report_data(const ReportBaseEnum&
 
             ComponentVariable cv = {component, std::nullopt, variable};
 
-            // request the variable attribute from the device model storage
-            const auto variable_attributes = this->storage->get_variable_attributes(component, variable);
+            const auto variable_attributes = this->get_cached_variable_attributes(variable_meta_data);
 
             // iterate over possibly (Actual, Target, MinSet, MaxSet)
             for (const auto& variable_attribute : variable_attributes) {
@@ -391,8 +438,7 @@ DeviceModel::get_custom_report_data(const std::optional<std::vector<ComponentVar
                     report_data.component = component;
                     report_data.variable = variable;
 
-                    //  request the variable attribute from the device model storage
-                    const auto variable_attributes = this->storage->get_variable_attributes(component, variable);
+                    const auto variable_attributes = this->get_cached_variable_attributes(variable_meta_data);
 
                     for (const auto& variable_attribute : variable_attributes) {
                         report_data.variableAttribute.push_back(variable_attribute);
@@ -661,8 +707,15 @@ std::vector<SetMonitoringResult> DeviceModel::set_monitors(const std::vector<Set
                 // N07.FR.11
                 // In case of an existing monitor update
                 if (request_has_id && monitor_update_listener) {
-                    auto attribute = this->storage->get_variable_attribute(component_it->first, variable_it->first,
-                                                                           AttributeEnum::Actual);
+                    std::optional<VariableAttribute> attribute;
+                    {
+                        std::lock_guard<std::mutex> lock(this->attributes_mutex);
+                        const auto& attributes = variable_it->second.attributes;
+                        const auto attribute_it = attributes.find(AttributeEnum::Actual);
+                        if (attribute_it != attributes.end()) {
+                            attribute = attribute_it->second;
+                        }
+                    }
 
                     if (attribute.has_value()) {
                         static std::string empty_value{};
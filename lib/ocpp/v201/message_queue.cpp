@@ -21,6 +21,9 @@ bool is_boot_notification_message(const ocpp::v201::MessageType message_type) {
 }
 
 template <> bool ControlMessage<v201::MessageType>::is_transaction_update_message() const {
+    if (this->serialized.has_value()) {
+        return this->serialized->transaction_update_message;
+    }
     if (this->messageType == v201::MessageType::TransactionEvent) {
         return v201::TransactionEventRequest{this->message.at(CALL_PAYLOAD)}.eventType ==
                v201::TransactionEventEnum::Updated;
@@ -28,10 +31,32 @@ template <> bool ControlMessage<v201::MessageType>::is_transaction_update_messag
     return false;
 }
 
+template <> std::optional<std::string> ControlMessage<v201::MessageType>::transaction_id() const {
+    if (this->serialized.has_value()) {
+        return this->serialized->transaction_id;
+    }
+    if (this->messageType == v201::MessageType::TransactionEvent) {
+        return this->message.at(CALL_PAYLOAD).at("transactionInfo").at("transactionId").get<std::string>();
+    }
+    return std::nullopt;
+}
+
+template <> std::optional<std::string> ControlMessage<v201::MessageType>::replay_ordering_key() const {
+    if (this->messageType == v201::MessageType::TransactionEvent) {
+        // seqNo of a transaction has to arrive in order
+        return this->transaction_id();
+    }
+    if (this->messageType == v201::MessageType::BootNotification) {
+        return std::nullopt;
+    }
+    return this->initial_unique_id.get();
+}
+
 template <>
 ControlMessage<v201::MessageType>::ControlMessage(const json& message, const bool stall_until_accepted) :
     message(message.get<json::array_t>()),
-    messageType(v201::conversions::string_to_messagetype(message.at(CALL_ACTION))),
+    messageType(
+        v201::conversions::string_to_messagetype(message.at(CALL_ACTION).get_ref<const std::string&>())),
     message_attempts(0),
     initial_unique_id(message[MESSAGE_ID]),
     stall_until_accepted(stall_until_accepted) {
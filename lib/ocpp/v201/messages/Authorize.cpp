@@ -37,6 +37,23 @@ void to_json(json& j, const AuthorizeRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const AuthorizeRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("idToken", k.idToken);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.certificate) {
+        writer.member("certificate", k.certificate.value());
+    }
+    if (k.iso15118CertificateHashData) {
+        writer.member("iso15118CertificateHashData", k.iso15118CertificateHashData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, AuthorizeRequest& k) {
     // the required parts of the message
     k.idToken = j.at("idToken");
@@ -83,6 +100,21 @@ void to_json(json& j, const AuthorizeResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const AuthorizeResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("idTokenInfo", k.idTokenInfo);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.certificateStatus) {
+        writer.member("certificateStatus",
+                      conversions::authorize_certificate_status_enum_to_string(k.certificateStatus.value()));
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, AuthorizeResponse& k) {
     // the required parts of the message
     k.idTokenInfo = j.at("idTokenInfo");
@@ -93,7 +125,8 @@ void from_json(const json& j, AuthorizeResponse& k) {
     }
     if (j.contains("certificateStatus")) {
         k.certificateStatus.emplace(
-            conversions::string_to_authorize_certificate_status_enum(j.at("certificateStatus")));
+            conversions::string_to_authorize_certificate_status_enum(
+                j.at("certificateStatus").get_ref<const std::string&>()));
     }
 }
 
@@ -29,10 +29,22 @@ void to_json(json& j, const BootNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const BootNotificationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("chargingStation", k.chargingStation);
+    writer.member("reason", conversions::boot_reason_enum_to_string(k.reason));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, BootNotificationRequest& k) {
     // the required parts of the message
     k.chargingStation = j.at("chargingStation");
-    k.reason = conversions::string_to_boot_reason_enum(j.at("reason"));
+    k.reason = conversions::string_to_boot_reason_enum(j.at("reason").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -67,11 +79,27 @@ void to_json(json& j, const BootNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const BootNotificationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("currentTime", k.currentTime.to_rfc3339());
+    writer.member("interval", k.interval);
+    writer.member("status", conversions::registration_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, BootNotificationResponse& k) {
     // the required parts of the message
     k.currentTime = ocpp::DateTime(std::string(j.at("currentTime")));
     k.interval = j.at("interval");
-    k.status = conversions::string_to_registration_status_enum(j.at("status"));
+    k.status = conversions::string_to_registration_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
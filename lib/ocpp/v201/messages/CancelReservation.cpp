@@ -28,6 +28,17 @@ void to_json(json& j, const CancelReservationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CancelReservationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("reservationId", k.reservationId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, CancelReservationRequest& k) {
     // the required parts of the message
     k.reservationId = j.at("reservationId");
@@ -63,9 +74,23 @@ void to_json(json& j, const CancelReservationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CancelReservationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::cancel_reservation_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, CancelReservationResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_cancel_reservation_status_enum(j.at("status"));
+    k.status = conversions::string_to_cancel_reservation_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
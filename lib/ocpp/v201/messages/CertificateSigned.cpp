@@ -31,6 +31,21 @@ void to_json(json& j, const CertificateSignedRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("certificateChain", k.certificateChain);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.certificateType) {
+        writer.member("certificateType",
+                      conversions::certificate_signing_use_enum_to_string(k.certificateType.value()));
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, CertificateSignedRequest& k) {
     // the required parts of the message
     k.certificateChain = j.at("certificateChain");
@@ -40,7 +55,8 @@ void from_json(const json& j, CertificateSignedRequest& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("certificateType")) {
-        k.certificateType.emplace(conversions::string_to_certificate_signing_use_enum(j.at("certificateType")));
+        k.certificateType.emplace(
+            conversions::string_to_certificate_signing_use_enum(j.at("certificateType").get_ref<const std::string&>()));
     }
 }
 
@@ -69,9 +85,23 @@ void to_json(json& j, const CertificateSignedResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CertificateSignedResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::certificate_signed_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, CertificateSignedResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_certificate_signed_status_enum(j.at("status"));
+    k.status = conversions::string_to_certificate_signed_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
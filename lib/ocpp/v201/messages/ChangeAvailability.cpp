@@ -31,9 +31,24 @@ void to_json(json& j, const ChangeAvailabilityRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ChangeAvailabilityRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("operationalStatus", conversions::operational_status_enum_to_string(k.operationalStatus));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evse) {
+        writer.member("evse", k.evse.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ChangeAvailabilityRequest& k) {
     // the required parts of the message
-    k.operationalStatus = conversions::string_to_operational_status_enum(j.at("operationalStatus"));
+    k.operationalStatus =
+        conversions::string_to_operational_status_enum(j.at("operationalStatus").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -69,9 +84,23 @@ void to_json(json& j, const ChangeAvailabilityResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ChangeAvailabilityResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::change_availability_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ChangeAvailabilityResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_change_availability_status_enum(j.at("status"));
+    k.status = conversions::string_to_change_availability_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -26,6 +26,16 @@ void to_json(json& j, const ClearCacheRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearCacheRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearCacheRequest& k) {
     // the required parts of the message
 
@@ -60,9 +70,23 @@ void to_json(json& j, const ClearCacheResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearCacheResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_cache_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearCacheResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_cache_status_enum(j.at("status"));
+    k.status = conversions::string_to_clear_cache_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -32,6 +32,22 @@ void to_json(json& j, const ClearChargingProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearChargingProfileRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.chargingProfileId) {
+        writer.member("chargingProfileId", k.chargingProfileId.value());
+    }
+    if (k.chargingProfileCriteria) {
+        writer.member("chargingProfileCriteria", k.chargingProfileCriteria.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearChargingProfileRequest& k) {
     // the required parts of the message
 
@@ -72,9 +88,23 @@ void to_json(json& j, const ClearChargingProfileResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearChargingProfileResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_charging_profile_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearChargingProfileResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_charging_profile_status_enum(j.at("status"));
+    k.status = conversions::string_to_clear_charging_profile_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
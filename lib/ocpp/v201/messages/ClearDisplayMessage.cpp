@@ -28,6 +28,17 @@ void to_json(json& j, const ClearDisplayMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearDisplayMessageRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearDisplayMessageRequest& k) {
     // the required parts of the message
     k.id = j.at("id");
@@ -63,9 +74,23 @@ void to_json(json& j, const ClearDisplayMessageResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearDisplayMessageResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_message_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearDisplayMessageResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_message_status_enum(j.at("status"));
+    k.status = conversions::string_to_clear_message_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
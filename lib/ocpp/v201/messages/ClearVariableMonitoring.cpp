@@ -28,6 +28,17 @@ void to_json(json& j, const ClearVariableMonitoringRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearVariableMonitoringRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearVariableMonitoringRequest& k) {
     // the required parts of the message
     for (auto val : j.at("id")) {
@@ -62,6 +73,17 @@ void to_json(json& j, const ClearVariableMonitoringResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearVariableMonitoringResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("clearMonitoringResult", k.clearMonitoringResult);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearVariableMonitoringResponse& k) {
     // the required parts of the message
     for (auto val : j.at("clearMonitoringResult")) {
@@ -31,9 +31,24 @@ void to_json(json& j, const ClearedChargingLimitRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearedChargingLimitRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("chargingLimitSource", conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearedChargingLimitRequest& k) {
     // the required parts of the message
-    k.chargingLimitSource = conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource"));
+    k.chargingLimitSource =
+        conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -64,6 +79,16 @@ void to_json(json& j, const ClearedChargingLimitResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ClearedChargingLimitResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ClearedChargingLimitResponse& k) {
     // the required parts of the message
 
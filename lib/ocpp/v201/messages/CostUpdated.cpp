@@ -29,6 +29,18 @@ void to_json(json& j, const CostUpdatedRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CostUpdatedRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("totalCost", k.totalCost);
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, CostUpdatedRequest& k) {
     // the required parts of the message
     k.totalCost = j.at("totalCost");
@@ -60,6 +72,16 @@ void to_json(json& j, const CostUpdatedResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CostUpdatedResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, CostUpdatedResponse& k) {
     // the required parts of the message
 
@@ -39,6 +39,28 @@ void to_json(json& j, const CustomerInformationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CustomerInformationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("report", k.report);
+    writer.member("clear", k.clear);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.customerCertificate) {
+        writer.member("customerCertificate", k.customerCertificate.value());
+    }
+    if (k.idToken) {
+        writer.member("idToken", k.idToken.value());
+    }
+    if (k.customerIdentifier) {
+        writer.member("customerIdentifier", k.customerIdentifier.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, CustomerInformationRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
@@ -85,9 +107,23 @@ void to_json(json& j, const CustomerInformationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const CustomerInformationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::customer_information_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, CustomerInformationResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_customer_information_status_enum(j.at("status"));
+    k.status = conversions::string_to_customer_information_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
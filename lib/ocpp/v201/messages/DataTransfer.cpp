@@ -34,6 +34,23 @@ void to_json(json& j, const DataTransferRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DataTransferRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("vendorId", k.vendorId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.messageId) {
+        writer.member("messageId", k.messageId.value());
+    }
+    if (k.data) {
+        writer.member("data", k.data.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, DataTransferRequest& k) {
     // the required parts of the message
     k.vendorId = j.at("vendorId");
@@ -78,9 +95,26 @@ void to_json(json& j, const DataTransferResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DataTransferResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::data_transfer_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.data) {
+        writer.member("data", k.data.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, DataTransferResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_data_transfer_status_enum(j.at("status"));
+    k.status = conversions::string_to_data_transfer_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
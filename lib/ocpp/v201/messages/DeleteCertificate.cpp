@@ -28,6 +28,17 @@ void to_json(json& j, const DeleteCertificateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DeleteCertificateRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("certificateHashData", k.certificateHashData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, DeleteCertificateRequest& k) {
     // the required parts of the message
     k.certificateHashData = j.at("certificateHashData");
@@ -63,9 +74,23 @@ void to_json(json& j, const DeleteCertificateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const DeleteCertificateResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::delete_certificate_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, DeleteCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_delete_certificate_status_enum(j.at("status"));
+    k.status = conversions::string_to_delete_certificate_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -31,9 +31,23 @@ void to_json(json& j, const FirmwareStatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::firmware_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.requestId) {
+        writer.member("requestId", k.requestId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, FirmwareStatusNotificationRequest& k) {
     // the required parts of the message
-    k.status = conversions::string_to_firmware_status_enum(j.at("status"));
+    k.status = conversions::string_to_firmware_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -64,6 +78,16 @@ void to_json(json& j, const FirmwareStatusNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const FirmwareStatusNotificationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, FirmwareStatusNotificationResponse& k) {
     // the required parts of the message
 
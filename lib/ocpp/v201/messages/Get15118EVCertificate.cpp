@@ -30,10 +30,23 @@ void to_json(json& j, const Get15118EVCertificateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const Get15118EVCertificateRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("iso15118SchemaVersion", k.iso15118SchemaVersion);
+    writer.member("action", conversions::certificate_action_enum_to_string(k.action));
+    writer.member("exiRequest", k.exiRequest);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, Get15118EVCertificateRequest& k) {
     // the required parts of the message
     k.iso15118SchemaVersion = j.at("iso15118SchemaVersion");
-    k.action = conversions::string_to_certificate_action_enum(j.at("action"));
+    k.action = conversions::string_to_certificate_action_enum(j.at("action").get_ref<const std::string&>());
     k.exiRequest = j.at("exiRequest");
 
     // the optional parts of the message
@@ -68,9 +81,24 @@ void to_json(json& j, const Get15118EVCertificateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const Get15118EVCertificateResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::iso15118evcertificate_status_enum_to_string(k.status));
+    writer.member("exiResponse", k.exiResponse);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, Get15118EVCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_iso15118evcertificate_status_enum(j.at("status"));
+    k.status = conversions::string_to_iso15118evcertificate_status_enum(j.at("status").get_ref<const std::string&>());
     k.exiResponse = j.at("exiResponse");
 
     // the optional parts of the message
@@ -29,10 +29,22 @@ void to_json(json& j, const GetBaseReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetBaseReportRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("reportBase", conversions::report_base_enum_to_string(k.reportBase));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetBaseReportRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
-    k.reportBase = conversions::string_to_report_base_enum(j.at("reportBase"));
+    k.reportBase = conversions::string_to_report_base_enum(j.at("reportBase").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -65,9 +77,23 @@ void to_json(json& j, const GetBaseReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetBaseReportResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_device_model_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetBaseReportResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -28,6 +28,17 @@ void to_json(json& j, const GetCertificateStatusRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCertificateStatusRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("ocspRequestData", k.ocspRequestData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetCertificateStatusRequest& k) {
     // the required parts of the message
     k.ocspRequestData = j.at("ocspRequestData");
@@ -66,9 +77,26 @@ void to_json(json& j, const GetCertificateStatusResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCertificateStatusResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_certificate_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.ocspResult) {
+        writer.member("ocspResult", k.ocspResult.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetCertificateStatusResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_certificate_status_enum(j.at("status"));
+    k.status = conversions::string_to_get_certificate_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -32,6 +32,21 @@ void to_json(json& j, const GetChargingProfilesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetChargingProfilesRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("chargingProfile", k.chargingProfile);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetChargingProfilesRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
@@ -71,9 +86,23 @@ void to_json(json& j, const GetChargingProfilesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetChargingProfilesResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_charging_profile_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetChargingProfilesResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_charging_profile_status_enum(j.at("status"));
+    k.status = conversions::string_to_get_charging_profile_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
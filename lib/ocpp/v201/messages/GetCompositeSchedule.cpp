@@ -32,6 +32,21 @@ void to_json(json& j, const GetCompositeScheduleRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCompositeScheduleRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("duration", k.duration);
+    writer.member("evseId", k.evseId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.chargingRateUnit) {
+        writer.member("chargingRateUnit", conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit.value()));
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetCompositeScheduleRequest& k) {
     // the required parts of the message
     k.duration = j.at("duration");
@@ -42,7 +57,8 @@ void from_json(const json& j, GetCompositeScheduleRequest& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("chargingRateUnit")) {
-        k.chargingRateUnit.emplace(conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit")));
+        k.chargingRateUnit.emplace(
+            conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit").get_ref<const std::string&>()));
     }
 }
 
@@ -74,9 +90,26 @@ void to_json(json& j, const GetCompositeScheduleResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetCompositeScheduleResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.schedule) {
+        writer.member("schedule", k.schedule.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetCompositeScheduleResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
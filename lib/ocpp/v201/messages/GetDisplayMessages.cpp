@@ -40,6 +40,26 @@ void to_json(json& j, const GetDisplayMessagesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDisplayMessagesRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.id) {
+        writer.member("id", k.id.value());
+    }
+    if (k.priority) {
+        writer.member("priority", conversions::message_priority_enum_to_string(k.priority.value()));
+    }
+    if (k.state) {
+        writer.member("state", conversions::message_state_enum_to_string(k.state.value()));
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetDisplayMessagesRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
@@ -57,10 +77,11 @@ void from_json(const json& j, GetDisplayMessagesRequest& k) {
         k.id.emplace(vec);
     }
     if (j.contains("priority")) {
-        k.priority.emplace(conversions::string_to_message_priority_enum(j.at("priority")));
+        k.priority.emplace(
+            conversions::string_to_message_priority_enum(j.at("priority").get_ref<const std::string&>()));
     }
     if (j.contains("state")) {
-        k.state.emplace(conversions::string_to_message_state_enum(j.at("state")));
+        k.state.emplace(conversions::string_to_message_state_enum(j.at("state").get_ref<const std::string&>()));
     }
 }
 
@@ -89,9 +110,23 @@ void to_json(json& j, const GetDisplayMessagesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetDisplayMessagesResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_display_messages_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetDisplayMessagesResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_display_messages_status_enum(j.at("status"));
+    k.status = conversions::string_to_get_display_messages_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
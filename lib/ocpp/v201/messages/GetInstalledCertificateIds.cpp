@@ -36,6 +36,24 @@ void to_json(json& j, const GetInstalledCertificateIdsRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.certificateType) {
+        writer.key("certificateType");
+        writer.start_array();
+        for (const auto& val : k.certificateType.value()) {
+            writer.value(conversions::get_certificate_id_use_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetInstalledCertificateIdsRequest& k) {
     // the required parts of the message
 
@@ -47,7 +65,7 @@ void from_json(const json& j, GetInstalledCertificateIdsRequest& k) {
         json arr = j.at("certificateType");
         std::vector<GetCertificateIdUseEnum> vec;
         for (auto val : arr) {
-            vec.push_back(conversions::string_to_get_certificate_id_use_enum(val));
+            vec.push_back(conversions::string_to_get_certificate_id_use_enum(val.get_ref<const std::string&>()));
         }
         k.certificateType.emplace(vec);
     }
@@ -84,9 +102,27 @@ void to_json(json& j, const GetInstalledCertificateIdsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetInstalledCertificateIdsResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::get_installed_certificate_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.certificateHashDataChain) {
+        writer.member("certificateHashDataChain", k.certificateHashDataChain.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetInstalledCertificateIdsResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_get_installed_certificate_status_enum(j.at("status"));
+    k.status =
+        conversions::string_to_get_installed_certificate_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
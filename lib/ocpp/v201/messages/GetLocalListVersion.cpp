@@ -26,6 +26,16 @@ void to_json(json& j, const GetLocalListVersionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLocalListVersionRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetLocalListVersionRequest& k) {
     // the required parts of the message
 
@@ -57,6 +67,17 @@ void to_json(json& j, const GetLocalListVersionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLocalListVersionResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("versionNumber", k.versionNumber);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetLocalListVersionResponse& k) {
     // the required parts of the message
     k.versionNumber = j.at("versionNumber");
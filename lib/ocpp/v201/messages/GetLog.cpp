@@ -36,10 +36,29 @@ void to_json(json& j, const GetLogRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLogRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("log", k.log);
+    writer.member("logType", conversions::log_enum_to_string(k.logType));
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetLogRequest& k) {
     // the required parts of the message
     k.log = j.at("log");
-    k.logType = conversions::string_to_log_enum(j.at("logType"));
+    k.logType = conversions::string_to_log_enum(j.at("logType").get_ref<const std::string&>());
     k.requestId = j.at("requestId");
 
     // the optional parts of the message
@@ -82,9 +101,26 @@ void to_json(json& j, const GetLogResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetLogResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::log_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.filename) {
+        writer.member("filename", k.filename.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetLogResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_log_status_enum(j.at("status"));
+    k.status = conversions::string_to_log_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
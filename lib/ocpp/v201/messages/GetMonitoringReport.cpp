@@ -40,6 +40,28 @@ void to_json(json& j, const GetMonitoringReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetMonitoringReportRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.componentVariable) {
+        writer.member("componentVariable", k.componentVariable.value());
+    }
+    if (k.monitoringCriteria) {
+        writer.key("monitoringCriteria");
+        writer.start_array();
+        for (const auto& val : k.monitoringCriteria.value()) {
+            writer.value(conversions::monitoring_criterion_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetMonitoringReportRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
@@ -60,7 +82,7 @@ void from_json(const json& j, GetMonitoringReportRequest& k) {
         json arr = j.at("monitoringCriteria");
         std::vector<MonitoringCriterionEnum> vec;
         for (auto val : arr) {
-            vec.push_back(conversions::string_to_monitoring_criterion_enum(val));
+            vec.push_back(conversions::string_to_monitoring_criterion_enum(val.get_ref<const std::string&>()));
         }
         k.monitoringCriteria.emplace(vec);
     }
@@ -91,9 +113,23 @@ void to_json(json& j, const GetMonitoringReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetMonitoringReportResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_device_model_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetMonitoringReportResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
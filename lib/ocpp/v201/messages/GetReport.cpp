@@ -40,6 +40,28 @@ void to_json(json& j, const GetReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetReportRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.componentVariable) {
+        writer.member("componentVariable", k.componentVariable.value());
+    }
+    if (k.componentCriteria) {
+        writer.key("componentCriteria");
+        writer.start_array();
+        for (const auto& val : k.componentCriteria.value()) {
+            writer.value(conversions::component_criterion_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetReportRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
@@ -60,7 +82,7 @@ void from_json(const json& j, GetReportRequest& k) {
         json arr = j.at("componentCriteria");
         std::vector<ComponentCriterionEnum> vec;
         for (auto val : arr) {
-            vec.push_back(conversions::string_to_component_criterion_enum(val));
+            vec.push_back(conversions::string_to_component_criterion_enum(val.get_ref<const std::string&>()));
         }
         k.componentCriteria.emplace(vec);
     }
@@ -91,9 +113,23 @@ void to_json(json& j, const GetReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetReportResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_device_model_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetReportResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -29,6 +29,19 @@ void to_json(json& j, const GetTransactionStatusRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetTransactionStatusRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetTransactionStatusRequest& k) {
     // the required parts of the message
 
@@ -66,6 +79,20 @@ void to_json(json& j, const GetTransactionStatusResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetTransactionStatusResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("messagesInQueue", k.messagesInQueue);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.ongoingIndicator) {
+        writer.member("ongoingIndicator", k.ongoingIndicator.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetTransactionStatusResponse& k) {
     // the required parts of the message
     k.messagesInQueue = j.at("messagesInQueue");
@@ -28,6 +28,17 @@ void to_json(json& j, const GetVariablesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetVariablesRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("getVariableData", k.getVariableData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetVariablesRequest& k) {
     // the required parts of the message
     for (auto val : j.at("getVariableData")) {
@@ -62,6 +73,17 @@ void to_json(json& j, const GetVariablesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const GetVariablesResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("getVariableResult", k.getVariableResult);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, GetVariablesResponse& k) {
     // the required parts of the message
     for (auto val : j.at("getVariableResult")) {
@@ -26,6 +26,16 @@ void to_json(json& j, const HeartbeatRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const HeartbeatRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, HeartbeatRequest& k) {
     // the required parts of the message
 
@@ -57,6 +67,17 @@ void to_json(json& j, const HeartbeatResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const HeartbeatResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("currentTime", k.currentTime.to_rfc3339());
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, HeartbeatResponse& k) {
     // the required parts of the message
     k.currentTime = ocpp::DateTime(std::string(j.at("currentTime")));
@@ -29,9 +29,22 @@ void to_json(json& j, const InstallCertificateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const InstallCertificateRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("certificateType", conversions::install_certificate_use_enum_to_string(k.certificateType));
+    writer.member("certificate", k.certificate);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, InstallCertificateRequest& k) {
     // the required parts of the message
-    k.certificateType = conversions::string_to_install_certificate_use_enum(j.at("certificateType"));
+    k.certificateType =
+        conversions::string_to_install_certificate_use_enum(j.at("certificateType").get_ref<const std::string&>());
     k.certificate = j.at("certificate");
 
     // the optional parts of the message
@@ -65,9 +78,23 @@ void to_json(json& j, const InstallCertificateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const InstallCertificateResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::install_certificate_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, InstallCertificateResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_install_certificate_status_enum(j.at("status"));
+    k.status = conversions::string_to_install_certificate_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
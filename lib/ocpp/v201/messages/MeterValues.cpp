@@ -29,6 +29,18 @@ void to_json(json& j, const MeterValuesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const MeterValuesRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("evseId", k.evseId);
+    writer.member("meterValue", k.meterValue);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, MeterValuesRequest& k) {
     // the required parts of the message
     k.evseId = j.at("evseId");
@@ -62,6 +74,16 @@ void to_json(json& j, const MeterValuesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const MeterValuesResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, MeterValuesResponse& k) {
     // the required parts of the message
 
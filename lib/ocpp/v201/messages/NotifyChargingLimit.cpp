@@ -37,6 +37,23 @@ void to_json(json& j, const NotifyChargingLimitRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyChargingLimitRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("chargingLimit", k.chargingLimit);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.chargingSchedule) {
+        writer.member("chargingSchedule", k.chargingSchedule.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyChargingLimitRequest& k) {
     // the required parts of the message
     k.chargingLimit = j.at("chargingLimit");
@@ -78,6 +95,16 @@ void to_json(json& j, const NotifyChargingLimitResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyChargingLimitResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyChargingLimitResponse& k) {
     // the required parts of the message
 
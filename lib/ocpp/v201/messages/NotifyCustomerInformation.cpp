@@ -34,6 +34,23 @@ void to_json(json& j, const NotifyCustomerInformationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyCustomerInformationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("data", k.data);
+    writer.member("seqNo", k.seqNo);
+    writer.member("generatedAt", k.generatedAt.to_rfc3339());
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyCustomerInformationRequest& k) {
     // the required parts of the message
     k.data = j.at("data");
@@ -70,6 +87,16 @@ void to_json(json& j, const NotifyCustomerInformationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyCustomerInformationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyCustomerInformationResponse& k) {
     // the required parts of the message
 
@@ -37,6 +37,23 @@ void to_json(json& j, const NotifyDisplayMessagesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.messageInfo) {
+        writer.member("messageInfo", k.messageInfo.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyDisplayMessagesRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
@@ -78,6 +95,16 @@ void to_json(json& j, const NotifyDisplayMessagesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyDisplayMessagesResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyDisplayMessagesResponse& k) {
     // the required parts of the message
 
@@ -32,6 +32,21 @@ void to_json(json& j, const NotifyEVChargingNeedsRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("chargingNeeds", k.chargingNeeds);
+    writer.member("evseId", k.evseId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.maxScheduleTuples) {
+        writer.member("maxScheduleTuples", k.maxScheduleTuples.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyEVChargingNeedsRequest& k) {
     // the required parts of the message
     k.chargingNeeds = j.at("chargingNeeds");
@@ -71,9 +86,23 @@ void to_json(json& j, const NotifyEVChargingNeedsResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingNeedsResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::notify_evcharging_needs_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyEVChargingNeedsResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_notify_evcharging_needs_status_enum(j.at("status"));
+    k.status = conversions::string_to_notify_evcharging_needs_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -30,6 +30,19 @@ void to_json(json& j, const NotifyEVChargingScheduleRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("timeBase", k.timeBase.to_rfc3339());
+    writer.member("chargingSchedule", k.chargingSchedule);
+    writer.member("evseId", k.evseId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyEVChargingScheduleRequest& k) {
     // the required parts of the message
     k.timeBase = ocpp::DateTime(std::string(j.at("timeBase")));
@@ -67,9 +80,23 @@ void to_json(json& j, const NotifyEVChargingScheduleResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEVChargingScheduleResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyEVChargingScheduleResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -33,6 +33,22 @@ void to_json(json& j, const NotifyEventRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEventRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("generatedAt", k.generatedAt.to_rfc3339());
+    writer.member("seqNo", k.seqNo);
+    writer.member("eventData", k.eventData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyEventRequest& k) {
     // the required parts of the message
     k.generatedAt = ocpp::DateTime(std::string(j.at("generatedAt")));
@@ -70,6 +86,16 @@ void to_json(json& j, const NotifyEventResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyEventResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyEventResponse& k) {
     // the required parts of the message
 
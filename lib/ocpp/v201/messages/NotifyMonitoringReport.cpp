@@ -39,6 +39,25 @@ void to_json(json& j, const NotifyMonitoringReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyMonitoringReportRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("seqNo", k.seqNo);
+    writer.member("generatedAt", k.generatedAt.to_rfc3339());
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.monitor) {
+        writer.member("monitor", k.monitor.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyMonitoringReportRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
@@ -82,6 +101,16 @@ void to_json(json& j, const NotifyMonitoringReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyMonitoringReportResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyMonitoringReportResponse& k) {
     // the required parts of the message
 
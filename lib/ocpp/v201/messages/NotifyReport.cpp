@@ -39,6 +39,25 @@ void to_json(json& j, const NotifyReportRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyReportRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("generatedAt", k.generatedAt.to_rfc3339());
+    writer.member("seqNo", k.seqNo);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.reportData) {
+        writer.member("reportData", k.reportData.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyReportRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
@@ -82,6 +101,16 @@ void to_json(json& j, const NotifyReportResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const NotifyReportResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, NotifyReportResponse& k) {
     // the required parts of the message
 
@@ -36,6 +36,25 @@ void to_json(json& j, const PublishFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("location", k.location);
+    writer.member("checksum", k.checksum);
+    writer.member("requestId", k.requestId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, PublishFirmwareRequest& k) {
     // the required parts of the message
     k.location = j.at("location");
@@ -79,9 +98,23 @@ void to_json(json& j, const PublishFirmwareResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, PublishFirmwareResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
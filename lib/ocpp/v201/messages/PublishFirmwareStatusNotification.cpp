@@ -37,9 +37,26 @@ void to_json(json& j, const PublishFirmwareStatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::publish_firmware_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.location) {
+        writer.member("location", k.location.value());
+    }
+    if (k.requestId) {
+        writer.member("requestId", k.requestId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, PublishFirmwareStatusNotificationRequest& k) {
     // the required parts of the message
-    k.status = conversions::string_to_publish_firmware_status_enum(j.at("status"));
+    k.status = conversions::string_to_publish_firmware_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -78,6 +95,16 @@ void to_json(json& j, const PublishFirmwareStatusNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const PublishFirmwareStatusNotificationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, PublishFirmwareStatusNotificationResponse& k) {
     // the required parts of the message
 
@@ -34,10 +34,28 @@ void to_json(json& j, const ReportChargingProfilesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReportChargingProfilesRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("chargingLimitSource", conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    writer.member("chargingProfile", k.chargingProfile);
+    writer.member("evseId", k.evseId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.tbc) {
+        writer.member("tbc", k.tbc.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ReportChargingProfilesRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
-    k.chargingLimitSource = conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource"));
+    k.chargingLimitSource =
+        conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource").get_ref<const std::string&>());
     for (auto val : j.at("chargingProfile")) {
         k.chargingProfile.push_back(val);
     }
@@ -72,6 +90,16 @@ void to_json(json& j, const ReportChargingProfilesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReportChargingProfilesResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ReportChargingProfilesResponse& k) {
     // the required parts of the message
 
@@ -38,6 +38,27 @@ void to_json(json& j, const RequestStartTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStartTransactionRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("idToken", k.idToken);
+    writer.member("remoteStartId", k.remoteStartId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    if (k.groupIdToken) {
+        writer.member("groupIdToken", k.groupIdToken.value());
+    }
+    if (k.chargingProfile) {
+        writer.member("chargingProfile", k.chargingProfile.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, RequestStartTransactionRequest& k) {
     // the required parts of the message
     k.idToken = j.at("idToken");
@@ -86,9 +107,26 @@ void to_json(json& j, const RequestStartTransactionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStartTransactionResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::request_start_stop_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, RequestStartTransactionResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_request_start_stop_status_enum(j.at("status"));
+    k.status = conversions::string_to_request_start_stop_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -28,6 +28,17 @@ void to_json(json& j, const RequestStopTransactionRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStopTransactionRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, RequestStopTransactionRequest& k) {
     // the required parts of the message
     k.transactionId = j.at("transactionId");
@@ -63,9 +74,23 @@ void to_json(json& j, const RequestStopTransactionResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const RequestStopTransactionResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::request_start_stop_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, RequestStopTransactionResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_request_start_stop_status_enum(j.at("status"));
+    k.status = conversions::string_to_request_start_stop_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
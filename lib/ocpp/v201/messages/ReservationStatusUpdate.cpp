@@ -29,10 +29,24 @@ void to_json(json& j, const ReservationStatusUpdateRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReservationStatusUpdateRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("reservationId", k.reservationId);
+    writer.member("reservationUpdateStatus",
+                  conversions::reservation_update_status_enum_to_string(k.reservationUpdateStatus));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ReservationStatusUpdateRequest& k) {
     // the required parts of the message
     k.reservationId = j.at("reservationId");
-    k.reservationUpdateStatus = conversions::string_to_reservation_update_status_enum(j.at("reservationUpdateStatus"));
+    k.reservationUpdateStatus = conversions::string_to_reservation_update_status_enum(
+        j.at("reservationUpdateStatus").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -60,6 +74,16 @@ void to_json(json& j, const ReservationStatusUpdateResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReservationStatusUpdateResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ReservationStatusUpdateResponse& k) {
     // the required parts of the message
 
@@ -39,6 +39,28 @@ void to_json(json& j, const ReserveNowRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReserveNowRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("expiryDateTime", k.expiryDateTime.to_rfc3339());
+    writer.member("idToken", k.idToken);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.connectorType) {
+        writer.member("connectorType", conversions::connector_enum_to_string(k.connectorType.value()));
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    if (k.groupIdToken) {
+        writer.member("groupIdToken", k.groupIdToken.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ReserveNowRequest& k) {
     // the required parts of the message
     k.id = j.at("id");
@@ -50,7 +72,8 @@ void from_json(const json& j, ReserveNowRequest& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("connectorType")) {
-        k.connectorType.emplace(conversions::string_to_connector_enum(j.at("connectorType")));
+        k.connectorType.emplace(
+            conversions::string_to_connector_enum(j.at("connectorType").get_ref<const std::string&>()));
     }
     if (j.contains("evseId")) {
         k.evseId.emplace(j.at("evseId"));
@@ -85,9 +108,23 @@ void to_json(json& j, const ReserveNowResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ReserveNowResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::reserve_now_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ReserveNowResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_reserve_now_status_enum(j.at("status"));
+    k.status = conversions::string_to_reserve_now_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -31,9 +31,23 @@ void to_json(json& j, const ResetRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ResetRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("type", conversions::reset_enum_to_string(k.type));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ResetRequest& k) {
     // the required parts of the message
-    k.type = conversions::string_to_reset_enum(j.at("type"));
+    k.type = conversions::string_to_reset_enum(j.at("type").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -69,9 +83,23 @@ void to_json(json& j, const ResetResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const ResetResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::reset_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, ResetResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_reset_status_enum(j.at("status"));
+    k.status = conversions::string_to_reset_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
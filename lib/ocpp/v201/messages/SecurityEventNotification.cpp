@@ -32,6 +32,21 @@ void to_json(json& j, const SecurityEventNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SecurityEventNotificationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("type", k.type);
+    writer.member("timestamp", k.timestamp.to_rfc3339());
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.techInfo) {
+        writer.member("techInfo", k.techInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SecurityEventNotificationRequest& k) {
     // the required parts of the message
     k.type = j.at("type");
@@ -66,6 +81,16 @@ void to_json(json& j, const SecurityEventNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SecurityEventNotificationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SecurityEventNotificationResponse& k) {
     // the required parts of the message
 
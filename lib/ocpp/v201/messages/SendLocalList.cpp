@@ -35,10 +35,25 @@ void to_json(json& j, const SendLocalListRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SendLocalListRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("versionNumber", k.versionNumber);
+    writer.member("updateType", conversions::update_enum_to_string(k.updateType));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.localAuthorizationList) {
+        writer.member("localAuthorizationList", k.localAuthorizationList.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SendLocalListRequest& k) {
     // the required parts of the message
     k.versionNumber = j.at("versionNumber");
-    k.updateType = conversions::string_to_update_enum(j.at("updateType"));
+    k.updateType = conversions::string_to_update_enum(j.at("updateType").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -79,9 +94,23 @@ void to_json(json& j, const SendLocalListResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SendLocalListResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::send_local_list_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SendLocalListResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_send_local_list_status_enum(j.at("status"));
+    k.status = conversions::string_to_send_local_list_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -29,6 +29,18 @@ void to_json(json& j, const SetChargingProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("evseId", k.evseId);
+    writer.member("chargingProfile", k.chargingProfile);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetChargingProfileRequest& k) {
     // the required parts of the message
     k.evseId = j.at("evseId");
@@ -65,9 +77,23 @@ void to_json(json& j, const SetChargingProfileResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetChargingProfileResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::charging_profile_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetChargingProfileResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_charging_profile_status_enum(j.at("status"));
+    k.status = conversions::string_to_charging_profile_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
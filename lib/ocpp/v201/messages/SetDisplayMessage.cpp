@@ -28,6 +28,17 @@ void to_json(json& j, const SetDisplayMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetDisplayMessageRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("message", k.message);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetDisplayMessageRequest& k) {
     // the required parts of the message
     k.message = j.at("message");
@@ -63,9 +74,23 @@ void to_json(json& j, const SetDisplayMessageResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetDisplayMessageResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::display_message_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetDisplayMessageResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_display_message_status_enum(j.at("status"));
+    k.status = conversions::string_to_display_message_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
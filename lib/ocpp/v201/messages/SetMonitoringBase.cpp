@@ -28,9 +28,21 @@ void to_json(json& j, const SetMonitoringBaseRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringBaseRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("monitoringBase", conversions::monitoring_base_enum_to_string(k.monitoringBase));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetMonitoringBaseRequest& k) {
     // the required parts of the message
-    k.monitoringBase = conversions::string_to_monitoring_base_enum(j.at("monitoringBase"));
+    k.monitoringBase =
+        conversions::string_to_monitoring_base_enum(j.at("monitoringBase").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -63,9 +75,23 @@ void to_json(json& j, const SetMonitoringBaseResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringBaseResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_device_model_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetMonitoringBaseResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_device_model_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
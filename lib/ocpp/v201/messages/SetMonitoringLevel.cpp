@@ -28,6 +28,17 @@ void to_json(json& j, const SetMonitoringLevelRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringLevelRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("severity", k.severity);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetMonitoringLevelRequest& k) {
     // the required parts of the message
     k.severity = j.at("severity");
@@ -63,9 +74,23 @@ void to_json(json& j, const SetMonitoringLevelResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetMonitoringLevelResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::generic_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetMonitoringLevelResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_generic_status_enum(j.at("status"));
+    k.status = conversions::string_to_generic_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -29,6 +29,18 @@ void to_json(json& j, const SetNetworkProfileRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetNetworkProfileRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("configurationSlot", k.configurationSlot);
+    writer.member("connectionData", k.connectionData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetNetworkProfileRequest& k) {
     // the required parts of the message
     k.configurationSlot = j.at("configurationSlot");
@@ -65,9 +77,23 @@ void to_json(json& j, const SetNetworkProfileResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetNetworkProfileResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::set_network_profile_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetNetworkProfileResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_set_network_profile_status_enum(j.at("status"));
+    k.status = conversions::string_to_set_network_profile_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -28,6 +28,17 @@ void to_json(json& j, const SetVariableMonitoringRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariableMonitoringRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("setMonitoringData", k.setMonitoringData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetVariableMonitoringRequest& k) {
     // the required parts of the message
     for (auto val : j.at("setMonitoringData")) {
@@ -62,6 +73,17 @@ void to_json(json& j, const SetVariableMonitoringResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariableMonitoringResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("setMonitoringResult", k.setMonitoringResult);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetVariableMonitoringResponse& k) {
     // the required parts of the message
     for (auto val : j.at("setMonitoringResult")) {
@@ -28,6 +28,17 @@ void to_json(json& j, const SetVariablesRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariablesRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("setVariableData", k.setVariableData);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetVariablesRequest& k) {
     // the required parts of the message
     for (auto val : j.at("setVariableData")) {
@@ -62,6 +73,17 @@ void to_json(json& j, const SetVariablesResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const SetVariablesResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("setVariableResult", k.setVariableResult);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, SetVariablesResponse& k) {
     // the required parts of the message
     for (auto val : j.at("setVariableResult")) {
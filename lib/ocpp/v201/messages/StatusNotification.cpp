@@ -31,10 +31,25 @@ void to_json(json& j, const StatusNotificationRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StatusNotificationRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("timestamp", k.timestamp.to_rfc3339());
+    writer.member("connectorStatus", conversions::connector_status_enum_to_string(k.connectorStatus));
+    writer.member("evseId", k.evseId);
+    writer.member("connectorId", k.connectorId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, StatusNotificationRequest& k) {
     // the required parts of the message
     k.timestamp = ocpp::DateTime(std::string(j.at("timestamp")));
-    k.connectorStatus = conversions::string_to_connector_status_enum(j.at("connectorStatus"));
+    k.connectorStatus =
+        conversions::string_to_connector_status_enum(j.at("connectorStatus").get_ref<const std::string&>());
     k.evseId = j.at("evseId");
     k.connectorId = j.at("connectorId");
 
@@ -64,6 +79,16 @@ void to_json(json& j, const StatusNotificationResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const StatusNotificationResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, StatusNotificationResponse& k) {
     // the required parts of the message
 
@@ -56,11 +56,47 @@ void to_json(json& j, const TransactionEventRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TransactionEventRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("eventType", conversions::transaction_event_enum_to_string(k.eventType));
+    writer.member("timestamp", k.timestamp.to_rfc3339());
+    writer.member("triggerReason", conversions::trigger_reason_enum_to_string(k.triggerReason));
+    writer.member("seqNo", k.seqNo);
+    writer.member("transactionInfo", k.transactionInfo);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.meterValue) {
+        writer.member("meterValue", k.meterValue.value());
+    }
+    if (k.offline) {
+        writer.member("offline", k.offline.value());
+    }
+    if (k.numberOfPhasesUsed) {
+        writer.member("numberOfPhasesUsed", k.numberOfPhasesUsed.value());
+    }
+    if (k.cableMaxCurrent) {
+        writer.member("cableMaxCurrent", k.cableMaxCurrent.value());
+    }
+    if (k.reservationId) {
+        writer.member("reservationId", k.reservationId.value());
+    }
+    if (k.evse) {
+        writer.member("evse", k.evse.value());
+    }
+    if (k.idToken) {
+        writer.member("idToken", k.idToken.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, TransactionEventRequest& k) {
     // the required parts of the message
-    k.eventType = conversions::string_to_transaction_event_enum(j.at("eventType"));
+    k.eventType = conversions::string_to_transaction_event_enum(j.at("eventType").get_ref<const std::string&>());
     k.timestamp = ocpp::DateTime(std::string(j.at("timestamp")));
-    k.triggerReason = conversions::string_to_trigger_reason_enum(j.at("triggerReason"));
+    k.triggerReason = conversions::string_to_trigger_reason_enum(j.at("triggerReason").get_ref<const std::string&>());
     k.seqNo = j.at("seqNo");
     k.transactionInfo = j.at("transactionInfo");
 
@@ -128,6 +164,28 @@ void to_json(json& j, const TransactionEventResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TransactionEventResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.totalCost) {
+        writer.member("totalCost", k.totalCost.value());
+    }
+    if (k.chargingPriority) {
+        writer.member("chargingPriority", k.chargingPriority.value());
+    }
+    if (k.idTokenInfo) {
+        writer.member("idTokenInfo", k.idTokenInfo.value());
+    }
+    if (k.updatedPersonalMessage) {
+        writer.member("updatedPersonalMessage", k.updatedPersonalMessage.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, TransactionEventResponse& k) {
     // the required parts of the message
 
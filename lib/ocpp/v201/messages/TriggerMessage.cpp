@@ -31,9 +31,24 @@ void to_json(json& j, const TriggerMessageRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TriggerMessageRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestedMessage", conversions::message_trigger_enum_to_string(k.requestedMessage));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evse) {
+        writer.member("evse", k.evse.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, TriggerMessageRequest& k) {
     // the required parts of the message
-    k.requestedMessage = conversions::string_to_message_trigger_enum(j.at("requestedMessage"));
+    k.requestedMessage =
+        conversions::string_to_message_trigger_enum(j.at("requestedMessage").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -69,9 +84,23 @@ void to_json(json& j, const TriggerMessageResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const TriggerMessageResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::trigger_message_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, TriggerMessageResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_trigger_message_status_enum(j.at("status"));
+    k.status = conversions::string_to_trigger_message_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -29,6 +29,18 @@ void to_json(json& j, const UnlockConnectorRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UnlockConnectorRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("evseId", k.evseId);
+    writer.member("connectorId", k.connectorId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, UnlockConnectorRequest& k) {
     // the required parts of the message
     k.evseId = j.at("evseId");
@@ -65,9 +77,23 @@ void to_json(json& j, const UnlockConnectorResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UnlockConnectorResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::unlock_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, UnlockConnectorResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_unlock_status_enum(j.at("status"));
+    k.status = conversions::string_to_unlock_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -28,6 +28,17 @@ void to_json(json& j, const UnpublishFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UnpublishFirmwareRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("checksum", k.checksum);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, UnpublishFirmwareRequest& k) {
     // the required parts of the message
     k.checksum = j.at("checksum");
@@ -60,9 +71,20 @@ void to_json(json& j, const UnpublishFirmwareResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UnpublishFirmwareResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::unpublish_firmware_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, UnpublishFirmwareResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_unpublish_firmware_status_enum(j.at("status"));
+    k.status = conversions::string_to_unpublish_firmware_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -35,6 +35,24 @@ void to_json(json& j, const UpdateFirmwareRequest& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UpdateFirmwareRequest& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestId", k.requestId);
+    writer.member("firmware", k.firmware);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.retries) {
+        writer.member("retries", k.retries.value());
+    }
+    if (k.retryInterval) {
+        writer.member("retryInterval", k.retryInterval.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, UpdateFirmwareRequest& k) {
     // the required parts of the message
     k.requestId = j.at("requestId");
@@ -77,9 +95,23 @@ void to_json(json& j, const UpdateFirmwareResponse& k) {
     }
 }
 
+void write_json(JsonWriter& writer, const UpdateFirmwareResponse& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::update_firmware_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 void from_json(const json& j, UpdateFirmwareResponse& k) {
     // the required parts of the message
-    k.status = conversions::string_to_update_firmware_status_enum(j.at("status"));
+    k.status = conversions::string_to_update_firmware_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
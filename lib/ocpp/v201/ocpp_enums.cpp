@@ -4,7 +4,9 @@
 
 #include <ocpp/v201/ocpp_enums.hpp>
 
+#include <iterator>
 #include <string>
+#include <string_view>
 
 #include <ocpp/common/types.hpp>
 
@@ -14,52 +16,88 @@ namespace v201 {
 // from: AuthorizeRequest
 namespace conversions {
 std::string id_token_enum_to_string(IdTokenEnum e) {
-    switch (e) {
-    case IdTokenEnum::Central:
-        return "Central";
-    case IdTokenEnum::eMAID:
-        return "eMAID";
-    case IdTokenEnum::ISO14443:
-        return "ISO14443";
-    case IdTokenEnum::ISO15693:
-        return "ISO15693";
-    case IdTokenEnum::KeyCode:
-        return "KeyCode";
-    case IdTokenEnum::Local:
-        return "Local";
-    case IdTokenEnum::MacAddress:
-        return "MacAddress";
-    case IdTokenEnum::NoAuthorization:
-        return "NoAuthorization";
+    static constexpr std::string_view strings[] = {
+        "Central",
+        "eMAID",
+        "ISO14443",
+        "ISO15693",
+        "KeyCode",
+        "Local",
+        "MacAddress",
+        "NoAuthorization",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(IdTokenEnum::Central) == 0);
+    static_assert(static_cast<std::size_t>(IdTokenEnum::eMAID) == 1);
+    static_assert(static_cast<std::size_t>(IdTokenEnum::ISO14443) == 2);
+    static_assert(static_cast<std::size_t>(IdTokenEnum::ISO15693) == 3);
+    static_assert(static_cast<std::size_t>(IdTokenEnum::KeyCode) == 4);
+    static_assert(static_cast<std::size_t>(IdTokenEnum::Local) == 5);
+    static_assert(static_cast<std::size_t>(IdTokenEnum::MacAddress) == 6);
+    static_assert(static_cast<std::size_t>(IdTokenEnum::NoAuthorization) == 7);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "IdTokenEnum"};
 }
 
-IdTokenEnum string_to_id_token_enum(const std::string& s) {
-    if (s == "Central") {
-        return IdTokenEnum::Central;
-    }
-    if (s == "eMAID") {
-        return IdTokenEnum::eMAID;
-    }
-    if (s == "ISO14443") {
-        return IdTokenEnum::ISO14443;
-    }
-    if (s == "ISO15693") {
-        return IdTokenEnum::ISO15693;
-    }
-    if (s == "KeyCode") {
-        return IdTokenEnum::KeyCode;
-    }
-    if (s == "Local") {
-        return IdTokenEnum::Local;
-    }
-    if (s == "MacAddress") {
-        return IdTokenEnum::MacAddress;
-    }
-    if (s == "NoAuthorization") {
-        return IdTokenEnum::NoAuthorization;
+IdTokenEnum string_to_id_token_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        switch (s[0]) {
+        case 'e':
+            if (s == "eMAID") {
+                return IdTokenEnum::eMAID;
+            }
+            break;
+        case 'L':
+            if (s == "Local") {
+                return IdTokenEnum::Local;
+            }
+            break;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 'C':
+            if (s == "Central") {
+                return IdTokenEnum::Central;
+            }
+            break;
+        case 'K':
+            if (s == "KeyCode") {
+                return IdTokenEnum::KeyCode;
+            }
+            break;
+        }
+        break;
+    case 8:
+        switch (s[4]) {
+        case '4':
+            if (s == "ISO14443") {
+                return IdTokenEnum::ISO14443;
+            }
+            break;
+        case '5':
+            if (s == "ISO15693") {
+                return IdTokenEnum::ISO15693;
+            }
+            break;
+        }
+        break;
+    case 10:
+        if (s == "MacAddress") {
+            return IdTokenEnum::MacAddress;
+        }
+        break;
+    case 15:
+        if (s == "NoAuthorization") {
+            return IdTokenEnum::NoAuthorization;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "IdTokenEnum"};
@@ -74,27 +112,45 @@ std::ostream& operator<<(std::ostream& os, const IdTokenEnum& id_token_enum) {
 // from: AuthorizeRequest
 namespace conversions {
 std::string hash_algorithm_enum_to_string(HashAlgorithmEnum e) {
-    switch (e) {
-    case HashAlgorithmEnum::SHA256:
-        return "SHA256";
-    case HashAlgorithmEnum::SHA384:
-        return "SHA384";
-    case HashAlgorithmEnum::SHA512:
-        return "SHA512";
+    static constexpr std::string_view strings[] = {
+        "SHA256",
+        "SHA384",
+        "SHA512",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(HashAlgorithmEnum::SHA256) == 0);
+    static_assert(static_cast<std::size_t>(HashAlgorithmEnum::SHA384) == 1);
+    static_assert(static_cast<std::size_t>(HashAlgorithmEnum::SHA512) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "HashAlgorithmEnum"};
 }
 
-HashAlgorithmEnum string_to_hash_algorithm_enum(const std::string& s) {
-    if (s == "SHA256") {
-        return HashAlgorithmEnum::SHA256;
-    }
-    if (s == "SHA384") {
-        return HashAlgorithmEnum::SHA384;
-    }
-    if (s == "SHA512") {
-        return HashAlgorithmEnum::SHA512;
+HashAlgorithmEnum string_to_hash_algorithm_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        switch (s[3]) {
+        case '2':
+            if (s == "SHA256") {
+                return HashAlgorithmEnum::SHA256;
+            }
+            break;
+        case '3':
+            if (s == "SHA384") {
+                return HashAlgorithmEnum::SHA384;
+            }
+            break;
+        case '5':
+            if (s == "SHA512") {
+                return HashAlgorithmEnum::SHA512;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "HashAlgorithmEnum"};
@@ -109,62 +165,98 @@ std::ostream& operator<<(std::ostream& os, const HashAlgorithmEnum& hash_algorit
 // from: AuthorizeResponse
 namespace conversions {
 std::string authorization_status_enum_to_string(AuthorizationStatusEnum e) {
-    switch (e) {
-    case AuthorizationStatusEnum::Accepted:
-        return "Accepted";
-    case AuthorizationStatusEnum::Blocked:
-        return "Blocked";
-    case AuthorizationStatusEnum::ConcurrentTx:
-        return "ConcurrentTx";
-    case AuthorizationStatusEnum::Expired:
-        return "Expired";
-    case AuthorizationStatusEnum::Invalid:
-        return "Invalid";
-    case AuthorizationStatusEnum::NoCredit:
-        return "NoCredit";
-    case AuthorizationStatusEnum::NotAllowedTypeEVSE:
-        return "NotAllowedTypeEVSE";
-    case AuthorizationStatusEnum::NotAtThisLocation:
-        return "NotAtThisLocation";
-    case AuthorizationStatusEnum::NotAtThisTime:
-        return "NotAtThisTime";
-    case AuthorizationStatusEnum::Unknown:
-        return "Unknown";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Blocked",
+        "ConcurrentTx",
+        "Expired",
+        "Invalid",
+        "NoCredit",
+        "NotAllowedTypeEVSE",
+        "NotAtThisLocation",
+        "NotAtThisTime",
+        "Unknown",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(AuthorizationStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(AuthorizationStatusEnum::Blocked) == 1);
+    static_assert(static_cast<std::size_t>(AuthorizationStatusEnum::ConcurrentTx) == 2);
+    static_assert(static_cast<std::size_t>(AuthorizationStatusEnum::Expired) == 3);
+    static_assert(static_cast<std::size_t>(AuthorizationStatusEnum::Invalid) == 4);
+    static_assert(static_cast<std::size_t>(AuthorizationStatusEnum::NoCredit) == 5);
+    static_assert(static_cast<std::size_t>(AuthorizationStatusEnum::NotAllowedTypeEVSE) == 6);
+    static_assert(static_cast<std::size_t>(AuthorizationStatusEnum::NotAtThisLocation) == 7);
+    static_assert(static_cast<std::size_t>(AuthorizationStatusEnum::NotAtThisTime) == 8);
+    static_assert(static_cast<std::size_t>(AuthorizationStatusEnum::Unknown) == 9);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "AuthorizationStatusEnum"};
 }
 
-AuthorizationStatusEnum string_to_authorization_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return AuthorizationStatusEnum::Accepted;
-    }
-    if (s == "Blocked") {
-        return AuthorizationStatusEnum::Blocked;
-    }
-    if (s == "ConcurrentTx") {
-        return AuthorizationStatusEnum::ConcurrentTx;
-    }
-    if (s == "Expired") {
-        return AuthorizationStatusEnum::Expired;
-    }
-    if (s == "Invalid") {
-        return AuthorizationStatusEnum::Invalid;
-    }
-    if (s == "NoCredit") {
-        return AuthorizationStatusEnum::NoCredit;
-    }
-    if (s == "NotAllowedTypeEVSE") {
-        return AuthorizationStatusEnum::NotAllowedTypeEVSE;
-    }
-    if (s == "NotAtThisLocation") {
-        return AuthorizationStatusEnum::NotAtThisLocation;
-    }
-    if (s == "NotAtThisTime") {
-        return AuthorizationStatusEnum::NotAtThisTime;
-    }
-    if (s == "Unknown") {
-        return AuthorizationStatusEnum::Unknown;
+AuthorizationStatusEnum string_to_authorization_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        switch (s[0]) {
+        case 'B':
+            if (s == "Blocked") {
+                return AuthorizationStatusEnum::Blocked;
+            }
+            break;
+        case 'E':
+            if (s == "Expired") {
+                return AuthorizationStatusEnum::Expired;
+            }
+            break;
+        case 'I':
+            if (s == "Invalid") {
+                return AuthorizationStatusEnum::Invalid;
+            }
+            break;
+        case 'U':
+            if (s == "Unknown") {
+                return AuthorizationStatusEnum::Unknown;
+            }
+            break;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return AuthorizationStatusEnum::Accepted;
+            }
+            break;
+        case 'N':
+            if (s == "NoCredit") {
+                return AuthorizationStatusEnum::NoCredit;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "ConcurrentTx") {
+            return AuthorizationStatusEnum::ConcurrentTx;
+        }
+        break;
+    case 13:
+        if (s == "NotAtThisTime") {
+            return AuthorizationStatusEnum::NotAtThisTime;
+        }
+        break;
+    case 17:
+        if (s == "NotAtThisLocation") {
+            return AuthorizationStatusEnum::NotAtThisLocation;
+        }
+        break;
+    case 18:
+        if (s == "NotAllowedTypeEVSE") {
+            return AuthorizationStatusEnum::NotAllowedTypeEVSE;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AuthorizationStatusEnum"};
@@ -179,32 +271,52 @@ std::ostream& operator<<(std::ostream& os, const AuthorizationStatusEnum& author
 // from: AuthorizeResponse
 namespace conversions {
 std::string message_format_enum_to_string(MessageFormatEnum e) {
-    switch (e) {
-    case MessageFormatEnum::ASCII:
-        return "ASCII";
-    case MessageFormatEnum::HTML:
-        return "HTML";
-    case MessageFormatEnum::URI:
-        return "URI";
-    case MessageFormatEnum::UTF8:
-        return "UTF8";
+    static constexpr std::string_view strings[] = {
+        "ASCII",
+        "HTML",
+        "URI",
+        "UTF8",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MessageFormatEnum::ASCII) == 0);
+    static_assert(static_cast<std::size_t>(MessageFormatEnum::HTML) == 1);
+    static_assert(static_cast<std::size_t>(MessageFormatEnum::URI) == 2);
+    static_assert(static_cast<std::size_t>(MessageFormatEnum::UTF8) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MessageFormatEnum"};
 }
 
-MessageFormatEnum string_to_message_format_enum(const std::string& s) {
-    if (s == "ASCII") {
-        return MessageFormatEnum::ASCII;
-    }
-    if (s == "HTML") {
-        return MessageFormatEnum::HTML;
-    }
-    if (s == "URI") {
-        return MessageFormatEnum::URI;
-    }
-    if (s == "UTF8") {
-        return MessageFormatEnum::UTF8;
+MessageFormatEnum string_to_message_format_enum(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "URI") {
+            return MessageFormatEnum::URI;
+        }
+        break;
+    case 4:
+        switch (s[0]) {
+        case 'H':
+            if (s == "HTML") {
+                return MessageFormatEnum::HTML;
+            }
+            break;
+        case 'U':
+            if (s == "UTF8") {
+                return MessageFormatEnum::UTF8;
+            }
+            break;
+        }
+        break;
+    case 5:
+        if (s == "ASCII") {
+            return MessageFormatEnum::ASCII;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageFormatEnum"};
@@ -219,47 +331,77 @@ std::ostream& operator<<(std::ostream& os, const MessageFormatEnum& message_form
 // from: AuthorizeResponse
 namespace conversions {
 std::string authorize_certificate_status_enum_to_string(AuthorizeCertificateStatusEnum e) {
-    switch (e) {
-    case AuthorizeCertificateStatusEnum::Accepted:
-        return "Accepted";
-    case AuthorizeCertificateStatusEnum::SignatureError:
-        return "SignatureError";
-    case AuthorizeCertificateStatusEnum::CertificateExpired:
-        return "CertificateExpired";
-    case AuthorizeCertificateStatusEnum::CertificateRevoked:
-        return "CertificateRevoked";
-    case AuthorizeCertificateStatusEnum::NoCertificateAvailable:
-        return "NoCertificateAvailable";
-    case AuthorizeCertificateStatusEnum::CertChainError:
-        return "CertChainError";
-    case AuthorizeCertificateStatusEnum::ContractCancelled:
-        return "ContractCancelled";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "SignatureError",
+        "CertificateExpired",
+        "CertificateRevoked",
+        "NoCertificateAvailable",
+        "CertChainError",
+        "ContractCancelled",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(AuthorizeCertificateStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(AuthorizeCertificateStatusEnum::SignatureError) == 1);
+    static_assert(static_cast<std::size_t>(AuthorizeCertificateStatusEnum::CertificateExpired) == 2);
+    static_assert(static_cast<std::size_t>(AuthorizeCertificateStatusEnum::CertificateRevoked) == 3);
+    static_assert(static_cast<std::size_t>(AuthorizeCertificateStatusEnum::NoCertificateAvailable) == 4);
+    static_assert(static_cast<std::size_t>(AuthorizeCertificateStatusEnum::CertChainError) == 5);
+    static_assert(static_cast<std::size_t>(AuthorizeCertificateStatusEnum::ContractCancelled) == 6);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "AuthorizeCertificateStatusEnum"};
 }
 
-AuthorizeCertificateStatusEnum string_to_authorize_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return AuthorizeCertificateStatusEnum::Accepted;
-    }
-    if (s == "SignatureError") {
-        return AuthorizeCertificateStatusEnum::SignatureError;
-    }
-    if (s == "CertificateExpired") {
-        return AuthorizeCertificateStatusEnum::CertificateExpired;
-    }
-    if (s == "CertificateRevoked") {
-        return AuthorizeCertificateStatusEnum::CertificateRevoked;
-    }
-    if (s == "NoCertificateAvailable") {
-        return AuthorizeCertificateStatusEnum::NoCertificateAvailable;
-    }
-    if (s == "CertChainError") {
-        return AuthorizeCertificateStatusEnum::CertChainError;
-    }
-    if (s == "ContractCancelled") {
-        return AuthorizeCertificateStatusEnum::ContractCancelled;
+AuthorizeCertificateStatusEnum string_to_authorize_certificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return AuthorizeCertificateStatusEnum::Accepted;
+        }
+        break;
+    case 14:
+        switch (s[0]) {
+        case 'S':
+            if (s == "SignatureError") {
+                return AuthorizeCertificateStatusEnum::SignatureError;
+            }
+            break;
+        case 'C':
+            if (s == "CertChainError") {
+                return AuthorizeCertificateStatusEnum::CertChainError;
+            }
+            break;
+        }
+        break;
+    case 17:
+        if (s == "ContractCancelled") {
+            return AuthorizeCertificateStatusEnum::ContractCancelled;
+        }
+        break;
+    case 18:
+        switch (s[11]) {
+        case 'E':
+            if (s == "CertificateExpired") {
+                return AuthorizeCertificateStatusEnum::CertificateExpired;
+            }
+            break;
+        case 'R':
+            if (s == "CertificateRevoked") {
+                return AuthorizeCertificateStatusEnum::CertificateRevoked;
+            }
+            break;
+        }
+        break;
+    case 22:
+        if (s == "NoCertificateAvailable") {
+            return AuthorizeCertificateStatusEnum::NoCertificateAvailable;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AuthorizeCertificateStatusEnum"};
@@ -274,57 +416,91 @@ std::ostream& operator<<(std::ostream& os, const AuthorizeCertificateStatusEnum&
 // from: BootNotificationRequest
 namespace conversions {
 std::string boot_reason_enum_to_string(BootReasonEnum e) {
-    switch (e) {
-    case BootReasonEnum::ApplicationReset:
-        return "ApplicationReset";
-    case BootReasonEnum::FirmwareUpdate:
-        return "FirmwareUpdate";
-    case BootReasonEnum::LocalReset:
-        return "LocalReset";
-    case BootReasonEnum::PowerUp:
-        return "PowerUp";
-    case BootReasonEnum::RemoteReset:
-        return "RemoteReset";
-    case BootReasonEnum::ScheduledReset:
-        return "ScheduledReset";
-    case BootReasonEnum::Triggered:
-        return "Triggered";
-    case BootReasonEnum::Unknown:
-        return "Unknown";
-    case BootReasonEnum::Watchdog:
-        return "Watchdog";
+    static constexpr std::string_view strings[] = {
+        "ApplicationReset",
+        "FirmwareUpdate",
+        "LocalReset",
+        "PowerUp",
+        "RemoteReset",
+        "ScheduledReset",
+        "Triggered",
+        "Unknown",
+        "Watchdog",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(BootReasonEnum::ApplicationReset) == 0);
+    static_assert(static_cast<std::size_t>(BootReasonEnum::FirmwareUpdate) == 1);
+    static_assert(static_cast<std::size_t>(BootReasonEnum::LocalReset) == 2);
+    static_assert(static_cast<std::size_t>(BootReasonEnum::PowerUp) == 3);
+    static_assert(static_cast<std::size_t>(BootReasonEnum::RemoteReset) == 4);
+    static_assert(static_cast<std::size_t>(BootReasonEnum::ScheduledReset) == 5);
+    static_assert(static_cast<std::size_t>(BootReasonEnum::Triggered) == 6);
+    static_assert(static_cast<std::size_t>(BootReasonEnum::Unknown) == 7);
+    static_assert(static_cast<std::size_t>(BootReasonEnum::Watchdog) == 8);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "BootReasonEnum"};
 }
 
-BootReasonEnum string_to_boot_reason_enum(const std::string& s) {
-    if (s == "ApplicationReset") {
-        return BootReasonEnum::ApplicationReset;
-    }
-    if (s == "FirmwareUpdate") {
-        return BootReasonEnum::FirmwareUpdate;
-    }
-    if (s == "LocalReset") {
-        return BootReasonEnum::LocalReset;
-    }
-    if (s == "PowerUp") {
-        return BootReasonEnum::PowerUp;
-    }
-    if (s == "RemoteReset") {
-        return BootReasonEnum::RemoteReset;
-    }
-    if (s == "ScheduledReset") {
-        return BootReasonEnum::ScheduledReset;
-    }
-    if (s == "Triggered") {
-        return BootReasonEnum::Triggered;
-    }
-    if (s == "Unknown") {
-        return BootReasonEnum::Unknown;
-    }
-    if (s == "Watchdog") {
-        return BootReasonEnum::Watchdog;
+BootReasonEnum string_to_boot_reason_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        switch (s[0]) {
+        case 'P':
+            if (s == "PowerUp") {
+                return BootReasonEnum::PowerUp;
+            }
+            break;
+        case 'U':
+            if (s == "Unknown") {
+                return BootReasonEnum::Unknown;
+            }
+            break;
+        }
+        break;
+    case 8:
+        if (s == "Watchdog") {
+            return BootReasonEnum::Watchdog;
+        }
+        break;
+    case 9:
+        if (s == "Triggered") {
+            return BootReasonEnum::Triggered;
+        }
+        break;
+    case 10:
+        if (s == "LocalReset") {
+            return BootReasonEnum::LocalReset;
+        }
+        break;
+    case 11:
+        if (s == "RemoteReset") {
+            return BootReasonEnum::RemoteReset;
+        }
+        break;
+    case 14:
+        switch (s[0]) {
+        case 'F':
+            if (s == "FirmwareUpdate") {
+                return BootReasonEnum::FirmwareUpdate;
+            }
+            break;
+        case 'S':
+            if (s == "ScheduledReset") {
+                return BootReasonEnum::ScheduledReset;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "ApplicationReset") {
+            return BootReasonEnum::ApplicationReset;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "BootReasonEnum"};
@@ -339,27 +515,45 @@ std::ostream& operator<<(std::ostream& os, const BootReasonEnum& boot_reason_enu
 // from: BootNotificationResponse
 namespace conversions {
 std::string registration_status_enum_to_string(RegistrationStatusEnum e) {
-    switch (e) {
-    case RegistrationStatusEnum::Accepted:
-        return "Accepted";
-    case RegistrationStatusEnum::Pending:
-        return "Pending";
-    case RegistrationStatusEnum::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Pending",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(RegistrationStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(RegistrationStatusEnum::Pending) == 1);
+    static_assert(static_cast<std::size_t>(RegistrationStatusEnum::Rejected) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "RegistrationStatusEnum"};
 }
 
-RegistrationStatusEnum string_to_registration_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return RegistrationStatusEnum::Accepted;
-    }
-    if (s == "Pending") {
-        return RegistrationStatusEnum::Pending;
-    }
-    if (s == "Rejected") {
-        return RegistrationStatusEnum::Rejected;
+RegistrationStatusEnum string_to_registration_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Pending") {
+            return RegistrationStatusEnum::Pending;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return RegistrationStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return RegistrationStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RegistrationStatusEnum"};
@@ -374,22 +568,38 @@ std::ostream& operator<<(std::ostream& os, const RegistrationStatusEnum& registr
 // from: CancelReservationResponse
 namespace conversions {
 std::string cancel_reservation_status_enum_to_string(CancelReservationStatusEnum e) {
-    switch (e) {
-    case CancelReservationStatusEnum::Accepted:
-        return "Accepted";
-    case CancelReservationStatusEnum::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(CancelReservationStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(CancelReservationStatusEnum::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "CancelReservationStatusEnum"};
 }
 
-CancelReservationStatusEnum string_to_cancel_reservation_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return CancelReservationStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return CancelReservationStatusEnum::Rejected;
+CancelReservationStatusEnum string_to_cancel_reservation_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return CancelReservationStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return CancelReservationStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CancelReservationStatusEnum"};
@@ -404,22 +614,34 @@ std::ostream& operator<<(std::ostream& os, const CancelReservationStatusEnum& ca
 // from: CertificateSignedRequest
 namespace conversions {
 std::string certificate_signing_use_enum_to_string(CertificateSigningUseEnum e) {
-    switch (e) {
-    case CertificateSigningUseEnum::ChargingStationCertificate:
-        return "ChargingStationCertificate";
-    case CertificateSigningUseEnum::V2GCertificate:
-        return "V2GCertificate";
+    static constexpr std::string_view strings[] = {
+        "ChargingStationCertificate",
+        "V2GCertificate",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(CertificateSigningUseEnum::ChargingStationCertificate) == 0);
+    static_assert(static_cast<std::size_t>(CertificateSigningUseEnum::V2GCertificate) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "CertificateSigningUseEnum"};
 }
 
-CertificateSigningUseEnum string_to_certificate_signing_use_enum(const std::string& s) {
-    if (s == "ChargingStationCertificate") {
-        return CertificateSigningUseEnum::ChargingStationCertificate;
-    }
-    if (s == "V2GCertificate") {
-        return CertificateSigningUseEnum::V2GCertificate;
+CertificateSigningUseEnum string_to_certificate_signing_use_enum(std::string_view s) {
+    switch (s.size()) {
+    case 14:
+        if (s == "V2GCertificate") {
+            return CertificateSigningUseEnum::V2GCertificate;
+        }
+        break;
+    case 26:
+        if (s == "ChargingStationCertificate") {
+            return CertificateSigningUseEnum::ChargingStationCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CertificateSigningUseEnum"};
@@ -434,22 +656,38 @@ std::ostream& operator<<(std::ostream& os, const CertificateSigningUseEnum& cert
 // from: CertificateSignedResponse
 namespace conversions {
 std::string certificate_signed_status_enum_to_string(CertificateSignedStatusEnum e) {
-    switch (e) {
-    case CertificateSignedStatusEnum::Accepted:
-        return "Accepted";
-    case CertificateSignedStatusEnum::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(CertificateSignedStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(CertificateSignedStatusEnum::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "CertificateSignedStatusEnum"};
 }
 
-CertificateSignedStatusEnum string_to_certificate_signed_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return CertificateSignedStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return CertificateSignedStatusEnum::Rejected;
+CertificateSignedStatusEnum string_to_certificate_signed_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return CertificateSignedStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return CertificateSignedStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CertificateSignedStatusEnum"};
@@ -464,22 +702,34 @@ std::ostream& operator<<(std::ostream& os, const CertificateSignedStatusEnum& ce
 // from: ChangeAvailabilityRequest
 namespace conversions {
 std::string operational_status_enum_to_string(OperationalStatusEnum e) {
-    switch (e) {
-    case OperationalStatusEnum::Inoperative:
-        return "Inoperative";
-    case OperationalStatusEnum::Operative:
-        return "Operative";
+    static constexpr std::string_view strings[] = {
+        "Inoperative",
+        "Operative",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(OperationalStatusEnum::Inoperative) == 0);
+    static_assert(static_cast<std::size_t>(OperationalStatusEnum::Operative) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "OperationalStatusEnum"};
 }
 
-OperationalStatusEnum string_to_operational_status_enum(const std::string& s) {
-    if (s == "Inoperative") {
-        return OperationalStatusEnum::Inoperative;
-    }
-    if (s == "Operative") {
-        return OperationalStatusEnum::Operative;
+OperationalStatusEnum string_to_operational_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "Operative") {
+            return OperationalStatusEnum::Operative;
+        }
+        break;
+    case 11:
+        if (s == "Inoperative") {
+            return OperationalStatusEnum::Inoperative;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "OperationalStatusEnum"};
@@ -494,27 +744,45 @@ std::ostream& operator<<(std::ostream& os, const OperationalStatusEnum& operatio
 // from: ChangeAvailabilityResponse
 namespace conversions {
 std::string change_availability_status_enum_to_string(ChangeAvailabilityStatusEnum e) {
-    switch (e) {
-    case ChangeAvailabilityStatusEnum::Accepted:
-        return "Accepted";
-    case ChangeAvailabilityStatusEnum::Rejected:
-        return "Rejected";
-    case ChangeAvailabilityStatusEnum::Scheduled:
-        return "Scheduled";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "Scheduled",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChangeAvailabilityStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ChangeAvailabilityStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(ChangeAvailabilityStatusEnum::Scheduled) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChangeAvailabilityStatusEnum"};
 }
 
-ChangeAvailabilityStatusEnum string_to_change_availability_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ChangeAvailabilityStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ChangeAvailabilityStatusEnum::Rejected;
-    }
-    if (s == "Scheduled") {
-        return ChangeAvailabilityStatusEnum::Scheduled;
+ChangeAvailabilityStatusEnum string_to_change_availability_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ChangeAvailabilityStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ChangeAvailabilityStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Scheduled") {
+            return ChangeAvailabilityStatusEnum::Scheduled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChangeAvailabilityStatusEnum"};
@@ -529,22 +797,38 @@ std::ostream& operator<<(std::ostream& os, const ChangeAvailabilityStatusEnum& c
 // from: ClearCacheResponse
 namespace conversions {
 std::string clear_cache_status_enum_to_string(ClearCacheStatusEnum e) {
-    switch (e) {
-    case ClearCacheStatusEnum::Accepted:
-        return "Accepted";
-    case ClearCacheStatusEnum::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ClearCacheStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ClearCacheStatusEnum::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ClearCacheStatusEnum"};
 }
 
-ClearCacheStatusEnum string_to_clear_cache_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearCacheStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ClearCacheStatusEnum::Rejected;
+ClearCacheStatusEnum string_to_clear_cache_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ClearCacheStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ClearCacheStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearCacheStatusEnum"};
@@ -559,32 +843,48 @@ std::ostream& operator<<(std::ostream& os, const ClearCacheStatusEnum& clear_cac
 // from: ClearChargingProfileRequest
 namespace conversions {
 std::string charging_profile_purpose_enum_to_string(ChargingProfilePurposeEnum e) {
-    switch (e) {
-    case ChargingProfilePurposeEnum::ChargingStationExternalConstraints:
-        return "ChargingStationExternalConstraints";
-    case ChargingProfilePurposeEnum::ChargingStationMaxProfile:
-        return "ChargingStationMaxProfile";
-    case ChargingProfilePurposeEnum::TxDefaultProfile:
-        return "TxDefaultProfile";
-    case ChargingProfilePurposeEnum::TxProfile:
-        return "TxProfile";
+    static constexpr std::string_view strings[] = {
+        "ChargingStationExternalConstraints",
+        "ChargingStationMaxProfile",
+        "TxDefaultProfile",
+        "TxProfile",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargingProfilePurposeEnum::ChargingStationExternalConstraints) == 0);
+    static_assert(static_cast<std::size_t>(ChargingProfilePurposeEnum::ChargingStationMaxProfile) == 1);
+    static_assert(static_cast<std::size_t>(ChargingProfilePurposeEnum::TxDefaultProfile) == 2);
+    static_assert(static_cast<std::size_t>(ChargingProfilePurposeEnum::TxProfile) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargingProfilePurposeEnum"};
 }
 
-ChargingProfilePurposeEnum string_to_charging_profile_purpose_enum(const std::string& s) {
-    if (s == "ChargingStationExternalConstraints") {
-        return ChargingProfilePurposeEnum::ChargingStationExternalConstraints;
-    }
-    if (s == "ChargingStationMaxProfile") {
-        return ChargingProfilePurposeEnum::ChargingStationMaxProfile;
-    }
-    if (s == "TxDefaultProfile") {
-        return ChargingProfilePurposeEnum::TxDefaultProfile;
-    }
-    if (s == "TxProfile") {
-        return ChargingProfilePurposeEnum::TxProfile;
+ChargingProfilePurposeEnum string_to_charging_profile_purpose_enum(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "TxProfile") {
+            return ChargingProfilePurposeEnum::TxProfile;
+        }
+        break;
+    case 16:
+        if (s == "TxDefaultProfile") {
+            return ChargingProfilePurposeEnum::TxDefaultProfile;
+        }
+        break;
+    case 25:
+        if (s == "ChargingStationMaxProfile") {
+            return ChargingProfilePurposeEnum::ChargingStationMaxProfile;
+        }
+        break;
+    case 34:
+        if (s == "ChargingStationExternalConstraints") {
+            return ChargingProfilePurposeEnum::ChargingStationExternalConstraints;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfilePurposeEnum"};
@@ -599,22 +899,34 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfilePurposeEnum& cha
 // from: ClearChargingProfileResponse
 namespace conversions {
 std::string clear_charging_profile_status_enum_to_string(ClearChargingProfileStatusEnum e) {
-    switch (e) {
-    case ClearChargingProfileStatusEnum::Accepted:
-        return "Accepted";
-    case ClearChargingProfileStatusEnum::Unknown:
-        return "Unknown";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Unknown",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ClearChargingProfileStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ClearChargingProfileStatusEnum::Unknown) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ClearChargingProfileStatusEnum"};
 }
 
-ClearChargingProfileStatusEnum string_to_clear_charging_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearChargingProfileStatusEnum::Accepted;
-    }
-    if (s == "Unknown") {
-        return ClearChargingProfileStatusEnum::Unknown;
+ClearChargingProfileStatusEnum string_to_clear_charging_profile_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return ClearChargingProfileStatusEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ClearChargingProfileStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearChargingProfileStatusEnum"};
@@ -629,22 +941,34 @@ std::ostream& operator<<(std::ostream& os, const ClearChargingProfileStatusEnum&
 // from: ClearDisplayMessageResponse
 namespace conversions {
 std::string clear_message_status_enum_to_string(ClearMessageStatusEnum e) {
-    switch (e) {
-    case ClearMessageStatusEnum::Accepted:
-        return "Accepted";
-    case ClearMessageStatusEnum::Unknown:
-        return "Unknown";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Unknown",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ClearMessageStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ClearMessageStatusEnum::Unknown) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ClearMessageStatusEnum"};
 }
 
-ClearMessageStatusEnum string_to_clear_message_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearMessageStatusEnum::Accepted;
-    }
-    if (s == "Unknown") {
-        return ClearMessageStatusEnum::Unknown;
+ClearMessageStatusEnum string_to_clear_message_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return ClearMessageStatusEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return ClearMessageStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearMessageStatusEnum"};
@@ -659,27 +983,45 @@ std::ostream& operator<<(std::ostream& os, const ClearMessageStatusEnum& clear_m
 // from: ClearVariableMonitoringResponse
 namespace conversions {
 std::string clear_monitoring_status_enum_to_string(ClearMonitoringStatusEnum e) {
-    switch (e) {
-    case ClearMonitoringStatusEnum::Accepted:
-        return "Accepted";
-    case ClearMonitoringStatusEnum::Rejected:
-        return "Rejected";
-    case ClearMonitoringStatusEnum::NotFound:
-        return "NotFound";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "NotFound",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ClearMonitoringStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ClearMonitoringStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(ClearMonitoringStatusEnum::NotFound) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ClearMonitoringStatusEnum"};
 }
 
-ClearMonitoringStatusEnum string_to_clear_monitoring_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ClearMonitoringStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ClearMonitoringStatusEnum::Rejected;
-    }
-    if (s == "NotFound") {
-        return ClearMonitoringStatusEnum::NotFound;
+ClearMonitoringStatusEnum string_to_clear_monitoring_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ClearMonitoringStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ClearMonitoringStatusEnum::Rejected;
+            }
+            break;
+        case 'N':
+            if (s == "NotFound") {
+                return ClearMonitoringStatusEnum::NotFound;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ClearMonitoringStatusEnum"};
@@ -694,32 +1036,52 @@ std::ostream& operator<<(std::ostream& os, const ClearMonitoringStatusEnum& clea
 // from: ClearedChargingLimitRequest
 namespace conversions {
 std::string charging_limit_source_enum_to_string(ChargingLimitSourceEnum e) {
-    switch (e) {
-    case ChargingLimitSourceEnum::EMS:
-        return "EMS";
-    case ChargingLimitSourceEnum::Other:
-        return "Other";
-    case ChargingLimitSourceEnum::SO:
-        return "SO";
-    case ChargingLimitSourceEnum::CSO:
-        return "CSO";
+    static constexpr std::string_view strings[] = {
+        "EMS",
+        "Other",
+        "SO",
+        "CSO",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargingLimitSourceEnum::EMS) == 0);
+    static_assert(static_cast<std::size_t>(ChargingLimitSourceEnum::Other) == 1);
+    static_assert(static_cast<std::size_t>(ChargingLimitSourceEnum::SO) == 2);
+    static_assert(static_cast<std::size_t>(ChargingLimitSourceEnum::CSO) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargingLimitSourceEnum"};
 }
 
-ChargingLimitSourceEnum string_to_charging_limit_source_enum(const std::string& s) {
-    if (s == "EMS") {
-        return ChargingLimitSourceEnum::EMS;
-    }
-    if (s == "Other") {
-        return ChargingLimitSourceEnum::Other;
-    }
-    if (s == "SO") {
-        return ChargingLimitSourceEnum::SO;
-    }
-    if (s == "CSO") {
-        return ChargingLimitSourceEnum::CSO;
+ChargingLimitSourceEnum string_to_charging_limit_source_enum(std::string_view s) {
+    switch (s.size()) {
+    case 2:
+        if (s == "SO") {
+            return ChargingLimitSourceEnum::SO;
+        }
+        break;
+    case 3:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EMS") {
+                return ChargingLimitSourceEnum::EMS;
+            }
+            break;
+        case 'C':
+            if (s == "CSO") {
+                return ChargingLimitSourceEnum::CSO;
+            }
+            break;
+        }
+        break;
+    case 5:
+        if (s == "Other") {
+            return ChargingLimitSourceEnum::Other;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingLimitSourceEnum"};
@@ -734,27 +1096,45 @@ std::ostream& operator<<(std::ostream& os, const ChargingLimitSourceEnum& chargi
 // from: CustomerInformationResponse
 namespace conversions {
 std::string customer_information_status_enum_to_string(CustomerInformationStatusEnum e) {
-    switch (e) {
-    case CustomerInformationStatusEnum::Accepted:
-        return "Accepted";
-    case CustomerInformationStatusEnum::Rejected:
-        return "Rejected";
-    case CustomerInformationStatusEnum::Invalid:
-        return "Invalid";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "Invalid",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(CustomerInformationStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(CustomerInformationStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(CustomerInformationStatusEnum::Invalid) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "CustomerInformationStatusEnum"};
 }
 
-CustomerInformationStatusEnum string_to_customer_information_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return CustomerInformationStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return CustomerInformationStatusEnum::Rejected;
-    }
-    if (s == "Invalid") {
-        return CustomerInformationStatusEnum::Invalid;
+CustomerInformationStatusEnum string_to_customer_information_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Invalid") {
+            return CustomerInformationStatusEnum::Invalid;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return CustomerInformationStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return CustomerInformationStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CustomerInformationStatusEnum"};
@@ -769,32 +1149,52 @@ std::ostream& operator<<(std::ostream& os, const CustomerInformationStatusEnum&
 // from: DataTransferResponse
 namespace conversions {
 std::string data_transfer_status_enum_to_string(DataTransferStatusEnum e) {
-    switch (e) {
-    case DataTransferStatusEnum::Accepted:
-        return "Accepted";
-    case DataTransferStatusEnum::Rejected:
-        return "Rejected";
-    case DataTransferStatusEnum::UnknownMessageId:
-        return "UnknownMessageId";
-    case DataTransferStatusEnum::UnknownVendorId:
-        return "UnknownVendorId";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "UnknownMessageId",
+        "UnknownVendorId",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(DataTransferStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(DataTransferStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(DataTransferStatusEnum::UnknownMessageId) == 2);
+    static_assert(static_cast<std::size_t>(DataTransferStatusEnum::UnknownVendorId) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "DataTransferStatusEnum"};
 }
 
-DataTransferStatusEnum string_to_data_transfer_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return DataTransferStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return DataTransferStatusEnum::Rejected;
-    }
-    if (s == "UnknownMessageId") {
-        return DataTransferStatusEnum::UnknownMessageId;
-    }
-    if (s == "UnknownVendorId") {
-        return DataTransferStatusEnum::UnknownVendorId;
+DataTransferStatusEnum string_to_data_transfer_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return DataTransferStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return DataTransferStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVendorId") {
+            return DataTransferStatusEnum::UnknownVendorId;
+        }
+        break;
+    case 16:
+        if (s == "UnknownMessageId") {
+            return DataTransferStatusEnum::UnknownMessageId;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DataTransferStatusEnum"};
@@ -809,27 +1209,45 @@ std::ostream& operator<<(std::ostream& os, const DataTransferStatusEnum& data_tr
 // from: DeleteCertificateResponse
 namespace conversions {
 std::string delete_certificate_status_enum_to_string(DeleteCertificateStatusEnum e) {
-    switch (e) {
-    case DeleteCertificateStatusEnum::Accepted:
-        return "Accepted";
-    case DeleteCertificateStatusEnum::Failed:
-        return "Failed";
-    case DeleteCertificateStatusEnum::NotFound:
-        return "NotFound";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Failed",
+        "NotFound",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(DeleteCertificateStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(DeleteCertificateStatusEnum::Failed) == 1);
+    static_assert(static_cast<std::size_t>(DeleteCertificateStatusEnum::NotFound) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "DeleteCertificateStatusEnum"};
 }
 
-DeleteCertificateStatusEnum string_to_delete_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return DeleteCertificateStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return DeleteCertificateStatusEnum::Failed;
-    }
-    if (s == "NotFound") {
-        return DeleteCertificateStatusEnum::NotFound;
+DeleteCertificateStatusEnum string_to_delete_certificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return DeleteCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return DeleteCertificateStatusEnum::Accepted;
+            }
+            break;
+        case 'N':
+            if (s == "NotFound") {
+                return DeleteCertificateStatusEnum::NotFound;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DeleteCertificateStatusEnum"};
@@ -844,82 +1262,134 @@ std::ostream& operator<<(std::ostream& os, const DeleteCertificateStatusEnum& de
 // from: FirmwareStatusNotificationRequest
 namespace conversions {
 std::string firmware_status_enum_to_string(FirmwareStatusEnum e) {
-    switch (e) {
-    case FirmwareStatusEnum::Downloaded:
-        return "Downloaded";
-    case FirmwareStatusEnum::DownloadFailed:
-        return "DownloadFailed";
-    case FirmwareStatusEnum::Downloading:
-        return "Downloading";
-    case FirmwareStatusEnum::DownloadScheduled:
-        return "DownloadScheduled";
-    case FirmwareStatusEnum::DownloadPaused:
-        return "DownloadPaused";
-    case FirmwareStatusEnum::Idle:
-        return "Idle";
-    case FirmwareStatusEnum::InstallationFailed:
-        return "InstallationFailed";
-    case FirmwareStatusEnum::Installing:
-        return "Installing";
-    case FirmwareStatusEnum::Installed:
-        return "Installed";
-    case FirmwareStatusEnum::InstallRebooting:
-        return "InstallRebooting";
-    case FirmwareStatusEnum::InstallScheduled:
-        return "InstallScheduled";
-    case FirmwareStatusEnum::InstallVerificationFailed:
-        return "InstallVerificationFailed";
-    case FirmwareStatusEnum::InvalidSignature:
-        return "InvalidSignature";
-    case FirmwareStatusEnum::SignatureVerified:
-        return "SignatureVerified";
+    static constexpr std::string_view strings[] = {
+        "Downloaded",
+        "DownloadFailed",
+        "Downloading",
+        "DownloadScheduled",
+        "DownloadPaused",
+        "Idle",
+        "InstallationFailed",
+        "Installing",
+        "Installed",
+        "InstallRebooting",
+        "InstallScheduled",
+        "InstallVerificationFailed",
+        "InvalidSignature",
+        "SignatureVerified",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::Downloaded) == 0);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::DownloadFailed) == 1);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::Downloading) == 2);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::DownloadScheduled) == 3);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::DownloadPaused) == 4);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::Idle) == 5);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::InstallationFailed) == 6);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::Installing) == 7);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::Installed) == 8);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::InstallRebooting) == 9);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::InstallScheduled) == 10);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::InstallVerificationFailed) == 11);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::InvalidSignature) == 12);
+    static_assert(static_cast<std::size_t>(FirmwareStatusEnum::SignatureVerified) == 13);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "FirmwareStatusEnum"};
 }
 
-FirmwareStatusEnum string_to_firmware_status_enum(const std::string& s) {
-    if (s == "Downloaded") {
-        return FirmwareStatusEnum::Downloaded;
-    }
-    if (s == "DownloadFailed") {
-        return FirmwareStatusEnum::DownloadFailed;
-    }
-    if (s == "Downloading") {
-        return FirmwareStatusEnum::Downloading;
-    }
-    if (s == "DownloadScheduled") {
-        return FirmwareStatusEnum::DownloadScheduled;
-    }
-    if (s == "DownloadPaused") {
-        return FirmwareStatusEnum::DownloadPaused;
-    }
-    if (s == "Idle") {
-        return FirmwareStatusEnum::Idle;
-    }
-    if (s == "InstallationFailed") {
-        return FirmwareStatusEnum::InstallationFailed;
-    }
-    if (s == "Installing") {
-        return FirmwareStatusEnum::Installing;
-    }
-    if (s == "Installed") {
-        return FirmwareStatusEnum::Installed;
-    }
-    if (s == "InstallRebooting") {
-        return FirmwareStatusEnum::InstallRebooting;
-    }
-    if (s == "InstallScheduled") {
-        return FirmwareStatusEnum::InstallScheduled;
-    }
-    if (s == "InstallVerificationFailed") {
-        return FirmwareStatusEnum::InstallVerificationFailed;
-    }
-    if (s == "InvalidSignature") {
-        return FirmwareStatusEnum::InvalidSignature;
-    }
-    if (s == "SignatureVerified") {
-        return FirmwareStatusEnum::SignatureVerified;
+FirmwareStatusEnum string_to_firmware_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return FirmwareStatusEnum::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Installed") {
+            return FirmwareStatusEnum::Installed;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'D':
+            if (s == "Downloaded") {
+                return FirmwareStatusEnum::Downloaded;
+            }
+            break;
+        case 'I':
+            if (s == "Installing") {
+                return FirmwareStatusEnum::Installing;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return FirmwareStatusEnum::Downloading;
+        }
+        break;
+    case 14:
+        switch (s[8]) {
+        case 'F':
+            if (s == "DownloadFailed") {
+                return FirmwareStatusEnum::DownloadFailed;
+            }
+            break;
+        case 'P':
+            if (s == "DownloadPaused") {
+                return FirmwareStatusEnum::DownloadPaused;
+            }
+            break;
+        }
+        break;
+    case 16:
+        switch (s[8]) {
+        case 'e':
+            if (s == "InstallRebooting") {
+                return FirmwareStatusEnum::InstallRebooting;
+            }
+            break;
+        case 'c':
+            if (s == "InstallScheduled") {
+                return FirmwareStatusEnum::InstallScheduled;
+            }
+            break;
+        case 'i':
+            if (s == "InvalidSignature") {
+                return FirmwareStatusEnum::InvalidSignature;
+            }
+            break;
+        }
+        break;
+    case 17:
+        switch (s[0]) {
+        case 'D':
+            if (s == "DownloadScheduled") {
+                return FirmwareStatusEnum::DownloadScheduled;
+            }
+            break;
+        case 'S':
+            if (s == "SignatureVerified") {
+                return FirmwareStatusEnum::SignatureVerified;
+            }
+            break;
+        }
+        break;
+    case 18:
+        if (s == "InstallationFailed") {
+            return FirmwareStatusEnum::InstallationFailed;
+        }
+        break;
+    case 25:
+        if (s == "InstallVerificationFailed") {
+            return FirmwareStatusEnum::InstallVerificationFailed;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "FirmwareStatusEnum"};
@@ -934,22 +1404,34 @@ std::ostream& operator<<(std::ostream& os, const FirmwareStatusEnum& firmware_st
 // from: Get15118EVCertificateRequest
 namespace conversions {
 std::string certificate_action_enum_to_string(CertificateActionEnum e) {
-    switch (e) {
-    case CertificateActionEnum::Install:
-        return "Install";
-    case CertificateActionEnum::Update:
-        return "Update";
+    static constexpr std::string_view strings[] = {
+        "Install",
+        "Update",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(CertificateActionEnum::Install) == 0);
+    static_assert(static_cast<std::size_t>(CertificateActionEnum::Update) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "CertificateActionEnum"};
 }
 
-CertificateActionEnum string_to_certificate_action_enum(const std::string& s) {
-    if (s == "Install") {
-        return CertificateActionEnum::Install;
-    }
-    if (s == "Update") {
-        return CertificateActionEnum::Update;
+CertificateActionEnum string_to_certificate_action_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Update") {
+            return CertificateActionEnum::Update;
+        }
+        break;
+    case 7:
+        if (s == "Install") {
+            return CertificateActionEnum::Install;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CertificateActionEnum"};
@@ -964,22 +1446,34 @@ std::ostream& operator<<(std::ostream& os, const CertificateActionEnum& certific
 // from: Get15118EVCertificateResponse
 namespace conversions {
 std::string iso15118evcertificate_status_enum_to_string(Iso15118EVCertificateStatusEnum e) {
-    switch (e) {
-    case Iso15118EVCertificateStatusEnum::Accepted:
-        return "Accepted";
-    case Iso15118EVCertificateStatusEnum::Failed:
-        return "Failed";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Failed",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(Iso15118EVCertificateStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(Iso15118EVCertificateStatusEnum::Failed) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "Iso15118EVCertificateStatusEnum"};
 }
 
-Iso15118EVCertificateStatusEnum string_to_iso15118evcertificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return Iso15118EVCertificateStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return Iso15118EVCertificateStatusEnum::Failed;
+Iso15118EVCertificateStatusEnum string_to_iso15118evcertificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return Iso15118EVCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return Iso15118EVCertificateStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "Iso15118EVCertificateStatusEnum"};
@@ -994,27 +1488,41 @@ std::ostream& operator<<(std::ostream& os, const Iso15118EVCertificateStatusEnum
 // from: GetBaseReportRequest
 namespace conversions {
 std::string report_base_enum_to_string(ReportBaseEnum e) {
-    switch (e) {
-    case ReportBaseEnum::ConfigurationInventory:
-        return "ConfigurationInventory";
-    case ReportBaseEnum::FullInventory:
-        return "FullInventory";
-    case ReportBaseEnum::SummaryInventory:
-        return "SummaryInventory";
+    static constexpr std::string_view strings[] = {
+        "ConfigurationInventory",
+        "FullInventory",
+        "SummaryInventory",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ReportBaseEnum::ConfigurationInventory) == 0);
+    static_assert(static_cast<std::size_t>(ReportBaseEnum::FullInventory) == 1);
+    static_assert(static_cast<std::size_t>(ReportBaseEnum::SummaryInventory) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ReportBaseEnum"};
 }
 
-ReportBaseEnum string_to_report_base_enum(const std::string& s) {
-    if (s == "ConfigurationInventory") {
-        return ReportBaseEnum::ConfigurationInventory;
-    }
-    if (s == "FullInventory") {
-        return ReportBaseEnum::FullInventory;
-    }
-    if (s == "SummaryInventory") {
-        return ReportBaseEnum::SummaryInventory;
+ReportBaseEnum string_to_report_base_enum(std::string_view s) {
+    switch (s.size()) {
+    case 13:
+        if (s == "FullInventory") {
+            return ReportBaseEnum::FullInventory;
+        }
+        break;
+    case 16:
+        if (s == "SummaryInventory") {
+            return ReportBaseEnum::SummaryInventory;
+        }
+        break;
+    case 22:
+        if (s == "ConfigurationInventory") {
+            return ReportBaseEnum::ConfigurationInventory;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReportBaseEnum"};
@@ -1029,32 +1537,52 @@ std::ostream& operator<<(std::ostream& os, const ReportBaseEnum& report_base_enu
 // from: GetBaseReportResponse
 namespace conversions {
 std::string generic_device_model_status_enum_to_string(GenericDeviceModelStatusEnum e) {
-    switch (e) {
-    case GenericDeviceModelStatusEnum::Accepted:
-        return "Accepted";
-    case GenericDeviceModelStatusEnum::Rejected:
-        return "Rejected";
-    case GenericDeviceModelStatusEnum::NotSupported:
-        return "NotSupported";
-    case GenericDeviceModelStatusEnum::EmptyResultSet:
-        return "EmptyResultSet";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "NotSupported",
+        "EmptyResultSet",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GenericDeviceModelStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(GenericDeviceModelStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(GenericDeviceModelStatusEnum::NotSupported) == 2);
+    static_assert(static_cast<std::size_t>(GenericDeviceModelStatusEnum::EmptyResultSet) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GenericDeviceModelStatusEnum"};
 }
 
-GenericDeviceModelStatusEnum string_to_generic_device_model_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GenericDeviceModelStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return GenericDeviceModelStatusEnum::Rejected;
-    }
-    if (s == "NotSupported") {
-        return GenericDeviceModelStatusEnum::NotSupported;
-    }
-    if (s == "EmptyResultSet") {
-        return GenericDeviceModelStatusEnum::EmptyResultSet;
+GenericDeviceModelStatusEnum string_to_generic_device_model_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GenericDeviceModelStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return GenericDeviceModelStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "NotSupported") {
+            return GenericDeviceModelStatusEnum::NotSupported;
+        }
+        break;
+    case 14:
+        if (s == "EmptyResultSet") {
+            return GenericDeviceModelStatusEnum::EmptyResultSet;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GenericDeviceModelStatusEnum"};
@@ -1069,22 +1597,34 @@ std::ostream& operator<<(std::ostream& os, const GenericDeviceModelStatusEnum& g
 // from: GetCertificateStatusResponse
 namespace conversions {
 std::string get_certificate_status_enum_to_string(GetCertificateStatusEnum e) {
-    switch (e) {
-    case GetCertificateStatusEnum::Accepted:
-        return "Accepted";
-    case GetCertificateStatusEnum::Failed:
-        return "Failed";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Failed",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GetCertificateStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(GetCertificateStatusEnum::Failed) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GetCertificateStatusEnum"};
 }
 
-GetCertificateStatusEnum string_to_get_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetCertificateStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return GetCertificateStatusEnum::Failed;
+GetCertificateStatusEnum string_to_get_certificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return GetCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return GetCertificateStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetCertificateStatusEnum"};
@@ -1099,22 +1639,34 @@ std::ostream& operator<<(std::ostream& os, const GetCertificateStatusEnum& get_c
 // from: GetChargingProfilesResponse
 namespace conversions {
 std::string get_charging_profile_status_enum_to_string(GetChargingProfileStatusEnum e) {
-    switch (e) {
-    case GetChargingProfileStatusEnum::Accepted:
-        return "Accepted";
-    case GetChargingProfileStatusEnum::NoProfiles:
-        return "NoProfiles";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "NoProfiles",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GetChargingProfileStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(GetChargingProfileStatusEnum::NoProfiles) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GetChargingProfileStatusEnum"};
 }
 
-GetChargingProfileStatusEnum string_to_get_charging_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetChargingProfileStatusEnum::Accepted;
-    }
-    if (s == "NoProfiles") {
-        return GetChargingProfileStatusEnum::NoProfiles;
+GetChargingProfileStatusEnum string_to_get_charging_profile_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Accepted") {
+            return GetChargingProfileStatusEnum::Accepted;
+        }
+        break;
+    case 10:
+        if (s == "NoProfiles") {
+            return GetChargingProfileStatusEnum::NoProfiles;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetChargingProfileStatusEnum"};
@@ -1129,22 +1681,38 @@ std::ostream& operator<<(std::ostream& os, const GetChargingProfileStatusEnum& g
 // from: GetCompositeScheduleRequest
 namespace conversions {
 std::string charging_rate_unit_enum_to_string(ChargingRateUnitEnum e) {
-    switch (e) {
-    case ChargingRateUnitEnum::W:
-        return "W";
-    case ChargingRateUnitEnum::A:
-        return "A";
+    static constexpr std::string_view strings[] = {
+        "W",
+        "A",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargingRateUnitEnum::W) == 0);
+    static_assert(static_cast<std::size_t>(ChargingRateUnitEnum::A) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargingRateUnitEnum"};
 }
 
-ChargingRateUnitEnum string_to_charging_rate_unit_enum(const std::string& s) {
-    if (s == "W") {
-        return ChargingRateUnitEnum::W;
-    }
-    if (s == "A") {
-        return ChargingRateUnitEnum::A;
+ChargingRateUnitEnum string_to_charging_rate_unit_enum(std::string_view s) {
+    switch (s.size()) {
+    case 1:
+        switch (s[0]) {
+        case 'W':
+            if (s == "W") {
+                return ChargingRateUnitEnum::W;
+            }
+            break;
+        case 'A':
+            if (s == "A") {
+                return ChargingRateUnitEnum::A;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingRateUnitEnum"};
@@ -1159,22 +1727,38 @@ std::ostream& operator<<(std::ostream& os, const ChargingRateUnitEnum& charging_
 // from: GetCompositeScheduleResponse
 namespace conversions {
 std::string generic_status_enum_to_string(GenericStatusEnum e) {
-    switch (e) {
-    case GenericStatusEnum::Accepted:
-        return "Accepted";
-    case GenericStatusEnum::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GenericStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(GenericStatusEnum::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GenericStatusEnum"};
 }
 
-GenericStatusEnum string_to_generic_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GenericStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return GenericStatusEnum::Rejected;
+GenericStatusEnum string_to_generic_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GenericStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return GenericStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GenericStatusEnum"};
@@ -1189,27 +1773,45 @@ std::ostream& operator<<(std::ostream& os, const GenericStatusEnum& generic_stat
 // from: GetDisplayMessagesRequest
 namespace conversions {
 std::string message_priority_enum_to_string(MessagePriorityEnum e) {
-    switch (e) {
-    case MessagePriorityEnum::AlwaysFront:
-        return "AlwaysFront";
-    case MessagePriorityEnum::InFront:
-        return "InFront";
-    case MessagePriorityEnum::NormalCycle:
-        return "NormalCycle";
+    static constexpr std::string_view strings[] = {
+        "AlwaysFront",
+        "InFront",
+        "NormalCycle",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MessagePriorityEnum::AlwaysFront) == 0);
+    static_assert(static_cast<std::size_t>(MessagePriorityEnum::InFront) == 1);
+    static_assert(static_cast<std::size_t>(MessagePriorityEnum::NormalCycle) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MessagePriorityEnum"};
 }
 
-MessagePriorityEnum string_to_message_priority_enum(const std::string& s) {
-    if (s == "AlwaysFront") {
-        return MessagePriorityEnum::AlwaysFront;
-    }
-    if (s == "InFront") {
-        return MessagePriorityEnum::InFront;
-    }
-    if (s == "NormalCycle") {
-        return MessagePriorityEnum::NormalCycle;
+MessagePriorityEnum string_to_message_priority_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "InFront") {
+            return MessagePriorityEnum::InFront;
+        }
+        break;
+    case 11:
+        switch (s[0]) {
+        case 'A':
+            if (s == "AlwaysFront") {
+                return MessagePriorityEnum::AlwaysFront;
+            }
+            break;
+        case 'N':
+            if (s == "NormalCycle") {
+                return MessagePriorityEnum::NormalCycle;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessagePriorityEnum"};
@@ -1224,32 +1826,48 @@ std::ostream& operator<<(std::ostream& os, const MessagePriorityEnum& message_pr
 // from: GetDisplayMessagesRequest
 namespace conversions {
 std::string message_state_enum_to_string(MessageStateEnum e) {
-    switch (e) {
-    case MessageStateEnum::Charging:
-        return "Charging";
-    case MessageStateEnum::Faulted:
-        return "Faulted";
-    case MessageStateEnum::Idle:
-        return "Idle";
-    case MessageStateEnum::Unavailable:
-        return "Unavailable";
+    static constexpr std::string_view strings[] = {
+        "Charging",
+        "Faulted",
+        "Idle",
+        "Unavailable",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MessageStateEnum::Charging) == 0);
+    static_assert(static_cast<std::size_t>(MessageStateEnum::Faulted) == 1);
+    static_assert(static_cast<std::size_t>(MessageStateEnum::Idle) == 2);
+    static_assert(static_cast<std::size_t>(MessageStateEnum::Unavailable) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MessageStateEnum"};
 }
 
-MessageStateEnum string_to_message_state_enum(const std::string& s) {
-    if (s == "Charging") {
-        return MessageStateEnum::Charging;
-    }
-    if (s == "Faulted") {
-        return MessageStateEnum::Faulted;
-    }
-    if (s == "Idle") {
-        return MessageStateEnum::Idle;
-    }
-    if (s == "Unavailable") {
-        return MessageStateEnum::Unavailable;
+MessageStateEnum string_to_message_state_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return MessageStateEnum::Idle;
+        }
+        break;
+    case 7:
+        if (s == "Faulted") {
+            return MessageStateEnum::Faulted;
+        }
+        break;
+    case 8:
+        if (s == "Charging") {
+            return MessageStateEnum::Charging;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return MessageStateEnum::Unavailable;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageStateEnum"};
@@ -1264,22 +1882,34 @@ std::ostream& operator<<(std::ostream& os, const MessageStateEnum& message_state
 // from: GetDisplayMessagesResponse
 namespace conversions {
 std::string get_display_messages_status_enum_to_string(GetDisplayMessagesStatusEnum e) {
-    switch (e) {
-    case GetDisplayMessagesStatusEnum::Accepted:
-        return "Accepted";
-    case GetDisplayMessagesStatusEnum::Unknown:
-        return "Unknown";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Unknown",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GetDisplayMessagesStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(GetDisplayMessagesStatusEnum::Unknown) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GetDisplayMessagesStatusEnum"};
 }
 
-GetDisplayMessagesStatusEnum string_to_get_display_messages_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetDisplayMessagesStatusEnum::Accepted;
-    }
-    if (s == "Unknown") {
-        return GetDisplayMessagesStatusEnum::Unknown;
+GetDisplayMessagesStatusEnum string_to_get_display_messages_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Unknown") {
+            return GetDisplayMessagesStatusEnum::Unknown;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return GetDisplayMessagesStatusEnum::Accepted;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetDisplayMessagesStatusEnum"};
@@ -1294,37 +1924,59 @@ std::ostream& operator<<(std::ostream& os, const GetDisplayMessagesStatusEnum& g
 // from: GetInstalledCertificateIdsRequest
 namespace conversions {
 std::string get_certificate_id_use_enum_to_string(GetCertificateIdUseEnum e) {
-    switch (e) {
-    case GetCertificateIdUseEnum::V2GRootCertificate:
-        return "V2GRootCertificate";
-    case GetCertificateIdUseEnum::MORootCertificate:
-        return "MORootCertificate";
-    case GetCertificateIdUseEnum::CSMSRootCertificate:
-        return "CSMSRootCertificate";
-    case GetCertificateIdUseEnum::V2GCertificateChain:
-        return "V2GCertificateChain";
-    case GetCertificateIdUseEnum::ManufacturerRootCertificate:
-        return "ManufacturerRootCertificate";
+    static constexpr std::string_view strings[] = {
+        "V2GRootCertificate",
+        "MORootCertificate",
+        "CSMSRootCertificate",
+        "V2GCertificateChain",
+        "ManufacturerRootCertificate",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GetCertificateIdUseEnum::V2GRootCertificate) == 0);
+    static_assert(static_cast<std::size_t>(GetCertificateIdUseEnum::MORootCertificate) == 1);
+    static_assert(static_cast<std::size_t>(GetCertificateIdUseEnum::CSMSRootCertificate) == 2);
+    static_assert(static_cast<std::size_t>(GetCertificateIdUseEnum::V2GCertificateChain) == 3);
+    static_assert(static_cast<std::size_t>(GetCertificateIdUseEnum::ManufacturerRootCertificate) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GetCertificateIdUseEnum"};
 }
 
-GetCertificateIdUseEnum string_to_get_certificate_id_use_enum(const std::string& s) {
-    if (s == "V2GRootCertificate") {
-        return GetCertificateIdUseEnum::V2GRootCertificate;
-    }
-    if (s == "MORootCertificate") {
-        return GetCertificateIdUseEnum::MORootCertificate;
-    }
-    if (s == "CSMSRootCertificate") {
-        return GetCertificateIdUseEnum::CSMSRootCertificate;
-    }
-    if (s == "V2GCertificateChain") {
-        return GetCertificateIdUseEnum::V2GCertificateChain;
-    }
-    if (s == "ManufacturerRootCertificate") {
-        return GetCertificateIdUseEnum::ManufacturerRootCertificate;
+GetCertificateIdUseEnum string_to_get_certificate_id_use_enum(std::string_view s) {
+    switch (s.size()) {
+    case 17:
+        if (s == "MORootCertificate") {
+            return GetCertificateIdUseEnum::MORootCertificate;
+        }
+        break;
+    case 18:
+        if (s == "V2GRootCertificate") {
+            return GetCertificateIdUseEnum::V2GRootCertificate;
+        }
+        break;
+    case 19:
+        switch (s[0]) {
+        case 'C':
+            if (s == "CSMSRootCertificate") {
+                return GetCertificateIdUseEnum::CSMSRootCertificate;
+            }
+            break;
+        case 'V':
+            if (s == "V2GCertificateChain") {
+                return GetCertificateIdUseEnum::V2GCertificateChain;
+            }
+            break;
+        }
+        break;
+    case 27:
+        if (s == "ManufacturerRootCertificate") {
+            return GetCertificateIdUseEnum::ManufacturerRootCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetCertificateIdUseEnum"};
@@ -1339,22 +1991,38 @@ std::ostream& operator<<(std::ostream& os, const GetCertificateIdUseEnum& get_ce
 // from: GetInstalledCertificateIdsResponse
 namespace conversions {
 std::string get_installed_certificate_status_enum_to_string(GetInstalledCertificateStatusEnum e) {
-    switch (e) {
-    case GetInstalledCertificateStatusEnum::Accepted:
-        return "Accepted";
-    case GetInstalledCertificateStatusEnum::NotFound:
-        return "NotFound";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "NotFound",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GetInstalledCertificateStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(GetInstalledCertificateStatusEnum::NotFound) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GetInstalledCertificateStatusEnum"};
 }
 
-GetInstalledCertificateStatusEnum string_to_get_installed_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetInstalledCertificateStatusEnum::Accepted;
-    }
-    if (s == "NotFound") {
-        return GetInstalledCertificateStatusEnum::NotFound;
+GetInstalledCertificateStatusEnum string_to_get_installed_certificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GetInstalledCertificateStatusEnum::Accepted;
+            }
+            break;
+        case 'N':
+            if (s == "NotFound") {
+                return GetInstalledCertificateStatusEnum::NotFound;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetInstalledCertificateStatusEnum"};
@@ -1370,22 +2038,34 @@ std::ostream& operator<<(std::ostream& os,
 // from: GetLogRequest
 namespace conversions {
 std::string log_enum_to_string(LogEnum e) {
-    switch (e) {
-    case LogEnum::DiagnosticsLog:
-        return "DiagnosticsLog";
-    case LogEnum::SecurityLog:
-        return "SecurityLog";
+    static constexpr std::string_view strings[] = {
+        "DiagnosticsLog",
+        "SecurityLog",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(LogEnum::DiagnosticsLog) == 0);
+    static_assert(static_cast<std::size_t>(LogEnum::SecurityLog) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "LogEnum"};
 }
 
-LogEnum string_to_log_enum(const std::string& s) {
-    if (s == "DiagnosticsLog") {
-        return LogEnum::DiagnosticsLog;
-    }
-    if (s == "SecurityLog") {
-        return LogEnum::SecurityLog;
+LogEnum string_to_log_enum(std::string_view s) {
+    switch (s.size()) {
+    case 11:
+        if (s == "SecurityLog") {
+            return LogEnum::SecurityLog;
+        }
+        break;
+    case 14:
+        if (s == "DiagnosticsLog") {
+            return LogEnum::DiagnosticsLog;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "LogEnum"};
@@ -1400,27 +2080,45 @@ std::ostream& operator<<(std::ostream& os, const LogEnum& log_enum) {
 // from: GetLogResponse
 namespace conversions {
 std::string log_status_enum_to_string(LogStatusEnum e) {
-    switch (e) {
-    case LogStatusEnum::Accepted:
-        return "Accepted";
-    case LogStatusEnum::Rejected:
-        return "Rejected";
-    case LogStatusEnum::AcceptedCanceled:
-        return "AcceptedCanceled";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "AcceptedCanceled",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(LogStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(LogStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(LogStatusEnum::AcceptedCanceled) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "LogStatusEnum"};
 }
 
-LogStatusEnum string_to_log_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return LogStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return LogStatusEnum::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return LogStatusEnum::AcceptedCanceled;
+LogStatusEnum string_to_log_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return LogStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return LogStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return LogStatusEnum::AcceptedCanceled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "LogStatusEnum"};
@@ -1435,27 +2133,41 @@ std::ostream& operator<<(std::ostream& os, const LogStatusEnum& log_status_enum)
 // from: GetMonitoringReportRequest
 namespace conversions {
 std::string monitoring_criterion_enum_to_string(MonitoringCriterionEnum e) {
-    switch (e) {
-    case MonitoringCriterionEnum::ThresholdMonitoring:
-        return "ThresholdMonitoring";
-    case MonitoringCriterionEnum::DeltaMonitoring:
-        return "DeltaMonitoring";
-    case MonitoringCriterionEnum::PeriodicMonitoring:
-        return "PeriodicMonitoring";
+    static constexpr std::string_view strings[] = {
+        "ThresholdMonitoring",
+        "DeltaMonitoring",
+        "PeriodicMonitoring",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MonitoringCriterionEnum::ThresholdMonitoring) == 0);
+    static_assert(static_cast<std::size_t>(MonitoringCriterionEnum::DeltaMonitoring) == 1);
+    static_assert(static_cast<std::size_t>(MonitoringCriterionEnum::PeriodicMonitoring) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MonitoringCriterionEnum"};
 }
 
-MonitoringCriterionEnum string_to_monitoring_criterion_enum(const std::string& s) {
-    if (s == "ThresholdMonitoring") {
-        return MonitoringCriterionEnum::ThresholdMonitoring;
-    }
-    if (s == "DeltaMonitoring") {
-        return MonitoringCriterionEnum::DeltaMonitoring;
-    }
-    if (s == "PeriodicMonitoring") {
-        return MonitoringCriterionEnum::PeriodicMonitoring;
+MonitoringCriterionEnum string_to_monitoring_criterion_enum(std::string_view s) {
+    switch (s.size()) {
+    case 15:
+        if (s == "DeltaMonitoring") {
+            return MonitoringCriterionEnum::DeltaMonitoring;
+        }
+        break;
+    case 18:
+        if (s == "PeriodicMonitoring") {
+            return MonitoringCriterionEnum::PeriodicMonitoring;
+        }
+        break;
+    case 19:
+        if (s == "ThresholdMonitoring") {
+            return MonitoringCriterionEnum::ThresholdMonitoring;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MonitoringCriterionEnum"};
@@ -1470,32 +2182,52 @@ std::ostream& operator<<(std::ostream& os, const MonitoringCriterionEnum& monito
 // from: GetReportRequest
 namespace conversions {
 std::string component_criterion_enum_to_string(ComponentCriterionEnum e) {
-    switch (e) {
-    case ComponentCriterionEnum::Active:
-        return "Active";
-    case ComponentCriterionEnum::Available:
-        return "Available";
-    case ComponentCriterionEnum::Enabled:
-        return "Enabled";
-    case ComponentCriterionEnum::Problem:
-        return "Problem";
+    static constexpr std::string_view strings[] = {
+        "Active",
+        "Available",
+        "Enabled",
+        "Problem",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ComponentCriterionEnum::Active) == 0);
+    static_assert(static_cast<std::size_t>(ComponentCriterionEnum::Available) == 1);
+    static_assert(static_cast<std::size_t>(ComponentCriterionEnum::Enabled) == 2);
+    static_assert(static_cast<std::size_t>(ComponentCriterionEnum::Problem) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ComponentCriterionEnum"};
 }
 
-ComponentCriterionEnum string_to_component_criterion_enum(const std::string& s) {
-    if (s == "Active") {
-        return ComponentCriterionEnum::Active;
-    }
-    if (s == "Available") {
-        return ComponentCriterionEnum::Available;
-    }
-    if (s == "Enabled") {
-        return ComponentCriterionEnum::Enabled;
-    }
-    if (s == "Problem") {
-        return ComponentCriterionEnum::Problem;
+ComponentCriterionEnum string_to_component_criterion_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Active") {
+            return ComponentCriterionEnum::Active;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 'E':
+            if (s == "Enabled") {
+                return ComponentCriterionEnum::Enabled;
+            }
+            break;
+        case 'P':
+            if (s == "Problem") {
+                return ComponentCriterionEnum::Problem;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Available") {
+            return ComponentCriterionEnum::Available;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ComponentCriterionEnum"};
@@ -1510,32 +2242,52 @@ std::ostream& operator<<(std::ostream& os, const ComponentCriterionEnum& compone
 // from: GetVariablesRequest
 namespace conversions {
 std::string attribute_enum_to_string(AttributeEnum e) {
-    switch (e) {
-    case AttributeEnum::Actual:
-        return "Actual";
-    case AttributeEnum::Target:
-        return "Target";
-    case AttributeEnum::MinSet:
-        return "MinSet";
-    case AttributeEnum::MaxSet:
-        return "MaxSet";
+    static constexpr std::string_view strings[] = {
+        "Actual",
+        "Target",
+        "MinSet",
+        "MaxSet",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(AttributeEnum::Actual) == 0);
+    static_assert(static_cast<std::size_t>(AttributeEnum::Target) == 1);
+    static_assert(static_cast<std::size_t>(AttributeEnum::MinSet) == 2);
+    static_assert(static_cast<std::size_t>(AttributeEnum::MaxSet) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "AttributeEnum"};
 }
 
-AttributeEnum string_to_attribute_enum(const std::string& s) {
-    if (s == "Actual") {
-        return AttributeEnum::Actual;
-    }
-    if (s == "Target") {
-        return AttributeEnum::Target;
-    }
-    if (s == "MinSet") {
-        return AttributeEnum::MinSet;
-    }
-    if (s == "MaxSet") {
-        return AttributeEnum::MaxSet;
+AttributeEnum string_to_attribute_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        switch (s[2]) {
+        case 't':
+            if (s == "Actual") {
+                return AttributeEnum::Actual;
+            }
+            break;
+        case 'r':
+            if (s == "Target") {
+                return AttributeEnum::Target;
+            }
+            break;
+        case 'n':
+            if (s == "MinSet") {
+                return AttributeEnum::MinSet;
+            }
+            break;
+        case 'x':
+            if (s == "MaxSet") {
+                return AttributeEnum::MaxSet;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "AttributeEnum"};
@@ -1550,37 +2302,59 @@ std::ostream& operator<<(std::ostream& os, const AttributeEnum& attribute_enum)
 // from: GetVariablesResponse
 namespace conversions {
 std::string get_variable_status_enum_to_string(GetVariableStatusEnum e) {
-    switch (e) {
-    case GetVariableStatusEnum::Accepted:
-        return "Accepted";
-    case GetVariableStatusEnum::Rejected:
-        return "Rejected";
-    case GetVariableStatusEnum::UnknownComponent:
-        return "UnknownComponent";
-    case GetVariableStatusEnum::UnknownVariable:
-        return "UnknownVariable";
-    case GetVariableStatusEnum::NotSupportedAttributeType:
-        return "NotSupportedAttributeType";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "UnknownComponent",
+        "UnknownVariable",
+        "NotSupportedAttributeType",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(GetVariableStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(GetVariableStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(GetVariableStatusEnum::UnknownComponent) == 2);
+    static_assert(static_cast<std::size_t>(GetVariableStatusEnum::UnknownVariable) == 3);
+    static_assert(static_cast<std::size_t>(GetVariableStatusEnum::NotSupportedAttributeType) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "GetVariableStatusEnum"};
 }
 
-GetVariableStatusEnum string_to_get_variable_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return GetVariableStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return GetVariableStatusEnum::Rejected;
-    }
-    if (s == "UnknownComponent") {
-        return GetVariableStatusEnum::UnknownComponent;
-    }
-    if (s == "UnknownVariable") {
-        return GetVariableStatusEnum::UnknownVariable;
-    }
-    if (s == "NotSupportedAttributeType") {
-        return GetVariableStatusEnum::NotSupportedAttributeType;
+GetVariableStatusEnum string_to_get_variable_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return GetVariableStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return GetVariableStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVariable") {
+            return GetVariableStatusEnum::UnknownVariable;
+        }
+        break;
+    case 16:
+        if (s == "UnknownComponent") {
+            return GetVariableStatusEnum::UnknownComponent;
+        }
+        break;
+    case 25:
+        if (s == "NotSupportedAttributeType") {
+            return GetVariableStatusEnum::NotSupportedAttributeType;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "GetVariableStatusEnum"};
@@ -1595,32 +2369,48 @@ std::ostream& operator<<(std::ostream& os, const GetVariableStatusEnum& get_vari
 // from: InstallCertificateRequest
 namespace conversions {
 std::string install_certificate_use_enum_to_string(InstallCertificateUseEnum e) {
-    switch (e) {
-    case InstallCertificateUseEnum::V2GRootCertificate:
-        return "V2GRootCertificate";
-    case InstallCertificateUseEnum::MORootCertificate:
-        return "MORootCertificate";
-    case InstallCertificateUseEnum::CSMSRootCertificate:
-        return "CSMSRootCertificate";
-    case InstallCertificateUseEnum::ManufacturerRootCertificate:
-        return "ManufacturerRootCertificate";
+    static constexpr std::string_view strings[] = {
+        "V2GRootCertificate",
+        "MORootCertificate",
+        "CSMSRootCertificate",
+        "ManufacturerRootCertificate",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(InstallCertificateUseEnum::V2GRootCertificate) == 0);
+    static_assert(static_cast<std::size_t>(InstallCertificateUseEnum::MORootCertificate) == 1);
+    static_assert(static_cast<std::size_t>(InstallCertificateUseEnum::CSMSRootCertificate) == 2);
+    static_assert(static_cast<std::size_t>(InstallCertificateUseEnum::ManufacturerRootCertificate) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "InstallCertificateUseEnum"};
 }
 
-InstallCertificateUseEnum string_to_install_certificate_use_enum(const std::string& s) {
-    if (s == "V2GRootCertificate") {
-        return InstallCertificateUseEnum::V2GRootCertificate;
-    }
-    if (s == "MORootCertificate") {
-        return InstallCertificateUseEnum::MORootCertificate;
-    }
-    if (s == "CSMSRootCertificate") {
-        return InstallCertificateUseEnum::CSMSRootCertificate;
-    }
-    if (s == "ManufacturerRootCertificate") {
-        return InstallCertificateUseEnum::ManufacturerRootCertificate;
+InstallCertificateUseEnum string_to_install_certificate_use_enum(std::string_view s) {
+    switch (s.size()) {
+    case 17:
+        if (s == "MORootCertificate") {
+            return InstallCertificateUseEnum::MORootCertificate;
+        }
+        break;
+    case 18:
+        if (s == "V2GRootCertificate") {
+            return InstallCertificateUseEnum::V2GRootCertificate;
+        }
+        break;
+    case 19:
+        if (s == "CSMSRootCertificate") {
+            return InstallCertificateUseEnum::CSMSRootCertificate;
+        }
+        break;
+    case 27:
+        if (s == "ManufacturerRootCertificate") {
+            return InstallCertificateUseEnum::ManufacturerRootCertificate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "InstallCertificateUseEnum"};
@@ -1635,27 +2425,45 @@ std::ostream& operator<<(std::ostream& os, const InstallCertificateUseEnum& inst
 // from: InstallCertificateResponse
 namespace conversions {
 std::string install_certificate_status_enum_to_string(InstallCertificateStatusEnum e) {
-    switch (e) {
-    case InstallCertificateStatusEnum::Accepted:
-        return "Accepted";
-    case InstallCertificateStatusEnum::Rejected:
-        return "Rejected";
-    case InstallCertificateStatusEnum::Failed:
-        return "Failed";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "Failed",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(InstallCertificateStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(InstallCertificateStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(InstallCertificateStatusEnum::Failed) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "InstallCertificateStatusEnum"};
 }
 
-InstallCertificateStatusEnum string_to_install_certificate_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return InstallCertificateStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return InstallCertificateStatusEnum::Rejected;
-    }
-    if (s == "Failed") {
-        return InstallCertificateStatusEnum::Failed;
+InstallCertificateStatusEnum string_to_install_certificate_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return InstallCertificateStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return InstallCertificateStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return InstallCertificateStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "InstallCertificateStatusEnum"};
@@ -1670,52 +2478,80 @@ std::ostream& operator<<(std::ostream& os, const InstallCertificateStatusEnum& i
 // from: LogStatusNotificationRequest
 namespace conversions {
 std::string upload_log_status_enum_to_string(UploadLogStatusEnum e) {
-    switch (e) {
-    case UploadLogStatusEnum::BadMessage:
-        return "BadMessage";
-    case UploadLogStatusEnum::Idle:
-        return "Idle";
-    case UploadLogStatusEnum::NotSupportedOperation:
-        return "NotSupportedOperation";
-    case UploadLogStatusEnum::PermissionDenied:
-        return "PermissionDenied";
-    case UploadLogStatusEnum::Uploaded:
-        return "Uploaded";
-    case UploadLogStatusEnum::UploadFailure:
-        return "UploadFailure";
-    case UploadLogStatusEnum::Uploading:
-        return "Uploading";
-    case UploadLogStatusEnum::AcceptedCanceled:
-        return "AcceptedCanceled";
+    static constexpr std::string_view strings[] = {
+        "BadMessage",
+        "Idle",
+        "NotSupportedOperation",
+        "PermissionDenied",
+        "Uploaded",
+        "UploadFailure",
+        "Uploading",
+        "AcceptedCanceled",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnum::BadMessage) == 0);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnum::Idle) == 1);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnum::NotSupportedOperation) == 2);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnum::PermissionDenied) == 3);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnum::Uploaded) == 4);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnum::UploadFailure) == 5);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnum::Uploading) == 6);
+    static_assert(static_cast<std::size_t>(UploadLogStatusEnum::AcceptedCanceled) == 7);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UploadLogStatusEnum"};
 }
 
-UploadLogStatusEnum string_to_upload_log_status_enum(const std::string& s) {
-    if (s == "BadMessage") {
-        return UploadLogStatusEnum::BadMessage;
-    }
-    if (s == "Idle") {
-        return UploadLogStatusEnum::Idle;
-    }
-    if (s == "NotSupportedOperation") {
-        return UploadLogStatusEnum::NotSupportedOperation;
-    }
-    if (s == "PermissionDenied") {
-        return UploadLogStatusEnum::PermissionDenied;
-    }
-    if (s == "Uploaded") {
-        return UploadLogStatusEnum::Uploaded;
-    }
-    if (s == "UploadFailure") {
-        return UploadLogStatusEnum::UploadFailure;
-    }
-    if (s == "Uploading") {
-        return UploadLogStatusEnum::Uploading;
-    }
-    if (s == "AcceptedCanceled") {
-        return UploadLogStatusEnum::AcceptedCanceled;
+UploadLogStatusEnum string_to_upload_log_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return UploadLogStatusEnum::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Uploaded") {
+            return UploadLogStatusEnum::Uploaded;
+        }
+        break;
+    case 9:
+        if (s == "Uploading") {
+            return UploadLogStatusEnum::Uploading;
+        }
+        break;
+    case 10:
+        if (s == "BadMessage") {
+            return UploadLogStatusEnum::BadMessage;
+        }
+        break;
+    case 13:
+        if (s == "UploadFailure") {
+            return UploadLogStatusEnum::UploadFailure;
+        }
+        break;
+    case 16:
+        switch (s[0]) {
+        case 'P':
+            if (s == "PermissionDenied") {
+                return UploadLogStatusEnum::PermissionDenied;
+            }
+            break;
+        case 'A':
+            if (s == "AcceptedCanceled") {
+                return UploadLogStatusEnum::AcceptedCanceled;
+            }
+            break;
+        }
+        break;
+    case 21:
+        if (s == "NotSupportedOperation") {
+            return UploadLogStatusEnum::NotSupportedOperation;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UploadLogStatusEnum"};
@@ -1730,52 +2566,80 @@ std::ostream& operator<<(std::ostream& os, const UploadLogStatusEnum& upload_log
 // from: MeterValuesRequest
 namespace conversions {
 std::string reading_context_enum_to_string(ReadingContextEnum e) {
-    switch (e) {
-    case ReadingContextEnum::Interruption_Begin:
-        return "Interruption.Begin";
-    case ReadingContextEnum::Interruption_End:
-        return "Interruption.End";
-    case ReadingContextEnum::Other:
-        return "Other";
-    case ReadingContextEnum::Sample_Clock:
-        return "Sample.Clock";
-    case ReadingContextEnum::Sample_Periodic:
-        return "Sample.Periodic";
-    case ReadingContextEnum::Transaction_Begin:
-        return "Transaction.Begin";
-    case ReadingContextEnum::Transaction_End:
-        return "Transaction.End";
-    case ReadingContextEnum::Trigger:
-        return "Trigger";
+    static constexpr std::string_view strings[] = {
+        "Interruption.Begin",
+        "Interruption.End",
+        "Other",
+        "Sample.Clock",
+        "Sample.Periodic",
+        "Transaction.Begin",
+        "Transaction.End",
+        "Trigger",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ReadingContextEnum::Interruption_Begin) == 0);
+    static_assert(static_cast<std::size_t>(ReadingContextEnum::Interruption_End) == 1);
+    static_assert(static_cast<std::size_t>(ReadingContextEnum::Other) == 2);
+    static_assert(static_cast<std::size_t>(ReadingContextEnum::Sample_Clock) == 3);
+    static_assert(static_cast<std::size_t>(ReadingContextEnum::Sample_Periodic) == 4);
+    static_assert(static_cast<std::size_t>(ReadingContextEnum::Transaction_Begin) == 5);
+    static_assert(static_cast<std::size_t>(ReadingContextEnum::Transaction_End) == 6);
+    static_assert(static_cast<std::size_t>(ReadingContextEnum::Trigger) == 7);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ReadingContextEnum"};
 }
 
-ReadingContextEnum string_to_reading_context_enum(const std::string& s) {
-    if (s == "Interruption.Begin") {
-        return ReadingContextEnum::Interruption_Begin;
-    }
-    if (s == "Interruption.End") {
-        return ReadingContextEnum::Interruption_End;
-    }
-    if (s == "Other") {
-        return ReadingContextEnum::Other;
-    }
-    if (s == "Sample.Clock") {
-        return ReadingContextEnum::Sample_Clock;
-    }
-    if (s == "Sample.Periodic") {
-        return ReadingContextEnum::Sample_Periodic;
-    }
-    if (s == "Transaction.Begin") {
-        return ReadingContextEnum::Transaction_Begin;
-    }
-    if (s == "Transaction.End") {
-        return ReadingContextEnum::Transaction_End;
-    }
-    if (s == "Trigger") {
-        return ReadingContextEnum::Trigger;
+ReadingContextEnum string_to_reading_context_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Other") {
+            return ReadingContextEnum::Other;
+        }
+        break;
+    case 7:
+        if (s == "Trigger") {
+            return ReadingContextEnum::Trigger;
+        }
+        break;
+    case 12:
+        if (s == "Sample.Clock") {
+            return ReadingContextEnum::Sample_Clock;
+        }
+        break;
+    case 15:
+        switch (s[0]) {
+        case 'S':
+            if (s == "Sample.Periodic") {
+                return ReadingContextEnum::Sample_Periodic;
+            }
+            break;
+        case 'T':
+            if (s == "Transaction.End") {
+                return ReadingContextEnum::Transaction_End;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "Interruption.End") {
+            return ReadingContextEnum::Interruption_End;
+        }
+        break;
+    case 17:
+        if (s == "Transaction.Begin") {
+            return ReadingContextEnum::Transaction_Begin;
+        }
+        break;
+    case 18:
+        if (s == "Interruption.Begin") {
+            return ReadingContextEnum::Interruption_Begin;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReadingContextEnum"};
@@ -1790,137 +2654,199 @@ std::ostream& operator<<(std::ostream& os, const ReadingContextEnum& reading_con
 // from: MeterValuesRequest
 namespace conversions {
 std::string measurand_enum_to_string(MeasurandEnum e) {
-    switch (e) {
-    case MeasurandEnum::Current_Export:
-        return "Current.Export";
-    case MeasurandEnum::Current_Import:
-        return "Current.Import";
-    case MeasurandEnum::Current_Offered:
-        return "Current.Offered";
-    case MeasurandEnum::Energy_Active_Export_Register:
-        return "Energy.Active.Export.Register";
-    case MeasurandEnum::Energy_Active_Import_Register:
-        return "Energy.Active.Import.Register";
-    case MeasurandEnum::Energy_Reactive_Export_Register:
-        return "Energy.Reactive.Export.Register";
-    case MeasurandEnum::Energy_Reactive_Import_Register:
-        return "Energy.Reactive.Import.Register";
-    case MeasurandEnum::Energy_Active_Export_Interval:
-        return "Energy.Active.Export.Interval";
-    case MeasurandEnum::Energy_Active_Import_Interval:
-        return "Energy.Active.Import.Interval";
-    case MeasurandEnum::Energy_Active_Net:
-        return "Energy.Active.Net";
-    case MeasurandEnum::Energy_Reactive_Export_Interval:
-        return "Energy.Reactive.Export.Interval";
-    case MeasurandEnum::Energy_Reactive_Import_Interval:
-        return "Energy.Reactive.Import.Interval";
-    case MeasurandEnum::Energy_Reactive_Net:
-        return "Energy.Reactive.Net";
-    case MeasurandEnum::Energy_Apparent_Net:
-        return "Energy.Apparent.Net";
-    case MeasurandEnum::Energy_Apparent_Import:
-        return "Energy.Apparent.Import";
-    case MeasurandEnum::Energy_Apparent_Export:
-        return "Energy.Apparent.Export";
-    case MeasurandEnum::Frequency:
-        return "Frequency";
-    case MeasurandEnum::Power_Active_Export:
-        return "Power.Active.Export";
-    case MeasurandEnum::Power_Active_Import:
-        return "Power.Active.Import";
-    case MeasurandEnum::Power_Factor:
-        return "Power.Factor";
-    case MeasurandEnum::Power_Offered:
-        return "Power.Offered";
-    case MeasurandEnum::Power_Reactive_Export:
-        return "Power.Reactive.Export";
-    case MeasurandEnum::Power_Reactive_Import:
-        return "Power.Reactive.Import";
-    case MeasurandEnum::SoC:
-        return "SoC";
-    case MeasurandEnum::Voltage:
-        return "Voltage";
+    static constexpr std::string_view strings[] = {
+        "Current.Export",
+        "Current.Import",
+        "Current.Offered",
+        "Energy.Active.Export.Register",
+        "Energy.Active.Import.Register",
+        "Energy.Reactive.Export.Register",
+        "Energy.Reactive.Import.Register",
+        "Energy.Active.Export.Interval",
+        "Energy.Active.Import.Interval",
+        "Energy.Active.Net",
+        "Energy.Reactive.Export.Interval",
+        "Energy.Reactive.Import.Interval",
+        "Energy.Reactive.Net",
+        "Energy.Apparent.Net",
+        "Energy.Apparent.Import",
+        "Energy.Apparent.Export",
+        "Frequency",
+        "Power.Active.Export",
+        "Power.Active.Import",
+        "Power.Factor",
+        "Power.Offered",
+        "Power.Reactive.Export",
+        "Power.Reactive.Import",
+        "SoC",
+        "Voltage",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Current_Export) == 0);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Current_Import) == 1);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Current_Offered) == 2);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Active_Export_Register) == 3);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Active_Import_Register) == 4);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Reactive_Export_Register) == 5);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Reactive_Import_Register) == 6);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Active_Export_Interval) == 7);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Active_Import_Interval) == 8);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Active_Net) == 9);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Reactive_Export_Interval) == 10);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Reactive_Import_Interval) == 11);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Reactive_Net) == 12);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Apparent_Net) == 13);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Apparent_Import) == 14);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Energy_Apparent_Export) == 15);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Frequency) == 16);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Power_Active_Export) == 17);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Power_Active_Import) == 18);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Power_Factor) == 19);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Power_Offered) == 20);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Power_Reactive_Export) == 21);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Power_Reactive_Import) == 22);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::SoC) == 23);
+    static_assert(static_cast<std::size_t>(MeasurandEnum::Voltage) == 24);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MeasurandEnum"};
 }
 
-MeasurandEnum string_to_measurand_enum(const std::string& s) {
-    if (s == "Current.Export") {
-        return MeasurandEnum::Current_Export;
-    }
-    if (s == "Current.Import") {
-        return MeasurandEnum::Current_Import;
-    }
-    if (s == "Current.Offered") {
-        return MeasurandEnum::Current_Offered;
-    }
-    if (s == "Energy.Active.Export.Register") {
-        return MeasurandEnum::Energy_Active_Export_Register;
-    }
-    if (s == "Energy.Active.Import.Register") {
-        return MeasurandEnum::Energy_Active_Import_Register;
-    }
-    if (s == "Energy.Reactive.Export.Register") {
-        return MeasurandEnum::Energy_Reactive_Export_Register;
-    }
-    if (s == "Energy.Reactive.Import.Register") {
-        return MeasurandEnum::Energy_Reactive_Import_Register;
-    }
-    if (s == "Energy.Active.Export.Interval") {
-        return MeasurandEnum::Energy_Active_Export_Interval;
-    }
-    if (s == "Energy.Active.Import.Interval") {
-        return MeasurandEnum::Energy_Active_Import_Interval;
-    }
-    if (s == "Energy.Active.Net") {
-        return MeasurandEnum::Energy_Active_Net;
-    }
-    if (s == "Energy.Reactive.Export.Interval") {
-        return MeasurandEnum::Energy_Reactive_Export_Interval;
-    }
-    if (s == "Energy.Reactive.Import.Interval") {
-        return MeasurandEnum::Energy_Reactive_Import_Interval;
-    }
-    if (s == "Energy.Reactive.Net") {
-        return MeasurandEnum::Energy_Reactive_Net;
-    }
-    if (s == "Energy.Apparent.Net") {
-        return MeasurandEnum::Energy_Apparent_Net;
-    }
-    if (s == "Energy.Apparent.Import") {
-        return MeasurandEnum::Energy_Apparent_Import;
-    }
-    if (s == "Energy.Apparent.Export") {
-        return MeasurandEnum::Energy_Apparent_Export;
-    }
-    if (s == "Frequency") {
-        return MeasurandEnum::Frequency;
-    }
-    if (s == "Power.Active.Export") {
-        return MeasurandEnum::Power_Active_Export;
-    }
-    if (s == "Power.Active.Import") {
-        return MeasurandEnum::Power_Active_Import;
-    }
-    if (s == "Power.Factor") {
-        return MeasurandEnum::Power_Factor;
-    }
-    if (s == "Power.Offered") {
-        return MeasurandEnum::Power_Offered;
-    }
-    if (s == "Power.Reactive.Export") {
-        return MeasurandEnum::Power_Reactive_Export;
-    }
-    if (s == "Power.Reactive.Import") {
-        return MeasurandEnum::Power_Reactive_Import;
-    }
-    if (s == "SoC") {
-        return MeasurandEnum::SoC;
-    }
-    if (s == "Voltage") {
-        return MeasurandEnum::Voltage;
+MeasurandEnum string_to_measurand_enum(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "SoC") {
+            return MeasurandEnum::SoC;
+        }
+        break;
+    case 7:
+        if (s == "Voltage") {
+            return MeasurandEnum::Voltage;
+        }
+        break;
+    case 9:
+        if (s == "Frequency") {
+            return MeasurandEnum::Frequency;
+        }
+        break;
+    case 12:
+        if (s == "Power.Factor") {
+            return MeasurandEnum::Power_Factor;
+        }
+        break;
+    case 13:
+        if (s == "Power.Offered") {
+            return MeasurandEnum::Power_Offered;
+        }
+        break;
+    case 14:
+        switch (s[8]) {
+        case 'E':
+            if (s == "Current.Export") {
+                return MeasurandEnum::Current_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Current.Import") {
+                return MeasurandEnum::Current_Import;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "Current.Offered") {
+            return MeasurandEnum::Current_Offered;
+        }
+        break;
+    case 17:
+        if (s == "Energy.Active.Net") {
+            return MeasurandEnum::Energy_Active_Net;
+        }
+        break;
+    case 19:
+        switch (s[13]) {
+        case 'v':
+            if (s == "Energy.Reactive.Net") {
+                return MeasurandEnum::Energy_Reactive_Net;
+            }
+            break;
+        case 'n':
+            if (s == "Energy.Apparent.Net") {
+                return MeasurandEnum::Energy_Apparent_Net;
+            }
+            break;
+        case 'E':
+            if (s == "Power.Active.Export") {
+                return MeasurandEnum::Power_Active_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Power.Active.Import") {
+                return MeasurandEnum::Power_Active_Import;
+            }
+            break;
+        }
+        break;
+    case 21:
+        switch (s[15]) {
+        case 'E':
+            if (s == "Power.Reactive.Export") {
+                return MeasurandEnum::Power_Reactive_Export;
+            }
+            break;
+        case 'I':
+            if (s == "Power.Reactive.Import") {
+                return MeasurandEnum::Power_Reactive_Import;
+            }
+            break;
+        }
+        break;
+    case 22:
+        switch (s[16]) {
+        case 'I':
+            if (s == "Energy.Apparent.Import") {
+                return MeasurandEnum::Energy_Apparent_Import;
+            }
+            break;
+        case 'E':
+            if (s == "Energy.Apparent.Export") {
+                return MeasurandEnum::Energy_Apparent_Export;
+            }
+            break;
+        }
+        break;
+    case 29:
+        if (s == "Energy.Active.Export.Register") {
+            return MeasurandEnum::Energy_Active_Export_Register;
+        }
+        if (s == "Energy.Active.Import.Register") {
+            return MeasurandEnum::Energy_Active_Import_Register;
+        }
+        if (s == "Energy.Active.Export.Interval") {
+            return MeasurandEnum::Energy_Active_Export_Interval;
+        }
+        if (s == "Energy.Active.Import.Interval") {
+            return MeasurandEnum::Energy_Active_Import_Interval;
+        }
+        break;
+    case 31:
+        if (s == "Energy.Reactive.Export.Register") {
+            return MeasurandEnum::Energy_Reactive_Export_Register;
+        }
+        if (s == "Energy.Reactive.Import.Register") {
+            return MeasurandEnum::Energy_Reactive_Import_Register;
+        }
+        if (s == "Energy.Reactive.Export.Interval") {
+            return MeasurandEnum::Energy_Reactive_Export_Interval;
+        }
+        if (s == "Energy.Reactive.Import.Interval") {
+            return MeasurandEnum::Energy_Reactive_Import_Interval;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MeasurandEnum"};
@@ -1935,62 +2861,102 @@ std::ostream& operator<<(std::ostream& os, const MeasurandEnum& measurand_enum)
 // from: MeterValuesRequest
 namespace conversions {
 std::string phase_enum_to_string(PhaseEnum e) {
-    switch (e) {
-    case PhaseEnum::L1:
-        return "L1";
-    case PhaseEnum::L2:
-        return "L2";
-    case PhaseEnum::L3:
-        return "L3";
-    case PhaseEnum::N:
-        return "N";
-    case PhaseEnum::L1_N:
-        return "L1-N";
-    case PhaseEnum::L2_N:
-        return "L2-N";
-    case PhaseEnum::L3_N:
-        return "L3-N";
-    case PhaseEnum::L1_L2:
-        return "L1-L2";
-    case PhaseEnum::L2_L3:
-        return "L2-L3";
-    case PhaseEnum::L3_L1:
-        return "L3-L1";
+    static constexpr std::string_view strings[] = {
+        "L1",
+        "L2",
+        "L3",
+        "N",
+        "L1-N",
+        "L2-N",
+        "L3-N",
+        "L1-L2",
+        "L2-L3",
+        "L3-L1",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(PhaseEnum::L1) == 0);
+    static_assert(static_cast<std::size_t>(PhaseEnum::L2) == 1);
+    static_assert(static_cast<std::size_t>(PhaseEnum::L3) == 2);
+    static_assert(static_cast<std::size_t>(PhaseEnum::N) == 3);
+    static_assert(static_cast<std::size_t>(PhaseEnum::L1_N) == 4);
+    static_assert(static_cast<std::size_t>(PhaseEnum::L2_N) == 5);
+    static_assert(static_cast<std::size_t>(PhaseEnum::L3_N) == 6);
+    static_assert(static_cast<std::size_t>(PhaseEnum::L1_L2) == 7);
+    static_assert(static_cast<std::size_t>(PhaseEnum::L2_L3) == 8);
+    static_assert(static_cast<std::size_t>(PhaseEnum::L3_L1) == 9);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "PhaseEnum"};
 }
 
-PhaseEnum string_to_phase_enum(const std::string& s) {
-    if (s == "L1") {
-        return PhaseEnum::L1;
-    }
-    if (s == "L2") {
-        return PhaseEnum::L2;
-    }
-    if (s == "L3") {
-        return PhaseEnum::L3;
-    }
-    if (s == "N") {
-        return PhaseEnum::N;
-    }
-    if (s == "L1-N") {
-        return PhaseEnum::L1_N;
-    }
-    if (s == "L2-N") {
-        return PhaseEnum::L2_N;
-    }
-    if (s == "L3-N") {
-        return PhaseEnum::L3_N;
-    }
-    if (s == "L1-L2") {
-        return PhaseEnum::L1_L2;
-    }
-    if (s == "L2-L3") {
-        return PhaseEnum::L2_L3;
-    }
-    if (s == "L3-L1") {
-        return PhaseEnum::L3_L1;
+PhaseEnum string_to_phase_enum(std::string_view s) {
+    switch (s.size()) {
+    case 1:
+        if (s == "N") {
+            return PhaseEnum::N;
+        }
+        break;
+    case 2:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1") {
+                return PhaseEnum::L1;
+            }
+            break;
+        case '2':
+            if (s == "L2") {
+                return PhaseEnum::L2;
+            }
+            break;
+        case '3':
+            if (s == "L3") {
+                return PhaseEnum::L3;
+            }
+            break;
+        }
+        break;
+    case 4:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1-N") {
+                return PhaseEnum::L1_N;
+            }
+            break;
+        case '2':
+            if (s == "L2-N") {
+                return PhaseEnum::L2_N;
+            }
+            break;
+        case '3':
+            if (s == "L3-N") {
+                return PhaseEnum::L3_N;
+            }
+            break;
+        }
+        break;
+    case 5:
+        switch (s[1]) {
+        case '1':
+            if (s == "L1-L2") {
+                return PhaseEnum::L1_L2;
+            }
+            break;
+        case '2':
+            if (s == "L2-L3") {
+                return PhaseEnum::L2_L3;
+            }
+            break;
+        case '3':
+            if (s == "L3-L1") {
+                return PhaseEnum::L3_L1;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "PhaseEnum"};
@@ -2005,37 +2971,59 @@ std::ostream& operator<<(std::ostream& os, const PhaseEnum& phase_enum) {
 // from: MeterValuesRequest
 namespace conversions {
 std::string location_enum_to_string(LocationEnum e) {
-    switch (e) {
-    case LocationEnum::Body:
-        return "Body";
-    case LocationEnum::Cable:
-        return "Cable";
-    case LocationEnum::EV:
-        return "EV";
-    case LocationEnum::Inlet:
-        return "Inlet";
-    case LocationEnum::Outlet:
-        return "Outlet";
+    static constexpr std::string_view strings[] = {
+        "Body",
+        "Cable",
+        "EV",
+        "Inlet",
+        "Outlet",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(LocationEnum::Body) == 0);
+    static_assert(static_cast<std::size_t>(LocationEnum::Cable) == 1);
+    static_assert(static_cast<std::size_t>(LocationEnum::EV) == 2);
+    static_assert(static_cast<std::size_t>(LocationEnum::Inlet) == 3);
+    static_assert(static_cast<std::size_t>(LocationEnum::Outlet) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "LocationEnum"};
 }
 
-LocationEnum string_to_location_enum(const std::string& s) {
-    if (s == "Body") {
-        return LocationEnum::Body;
-    }
-    if (s == "Cable") {
-        return LocationEnum::Cable;
-    }
-    if (s == "EV") {
-        return LocationEnum::EV;
-    }
-    if (s == "Inlet") {
-        return LocationEnum::Inlet;
-    }
-    if (s == "Outlet") {
-        return LocationEnum::Outlet;
+LocationEnum string_to_location_enum(std::string_view s) {
+    switch (s.size()) {
+    case 2:
+        if (s == "EV") {
+            return LocationEnum::EV;
+        }
+        break;
+    case 4:
+        if (s == "Body") {
+            return LocationEnum::Body;
+        }
+        break;
+    case 5:
+        switch (s[0]) {
+        case 'C':
+            if (s == "Cable") {
+                return LocationEnum::Cable;
+            }
+            break;
+        case 'I':
+            if (s == "Inlet") {
+                return LocationEnum::Inlet;
+            }
+            break;
+        }
+        break;
+    case 6:
+        if (s == "Outlet") {
+            return LocationEnum::Outlet;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "LocationEnum"};
@@ -2050,27 +3038,41 @@ std::ostream& operator<<(std::ostream& os, const LocationEnum& location_enum) {
 // from: NotifyChargingLimitRequest
 namespace conversions {
 std::string cost_kind_enum_to_string(CostKindEnum e) {
-    switch (e) {
-    case CostKindEnum::CarbonDioxideEmission:
-        return "CarbonDioxideEmission";
-    case CostKindEnum::RelativePricePercentage:
-        return "RelativePricePercentage";
-    case CostKindEnum::RenewableGenerationPercentage:
-        return "RenewableGenerationPercentage";
+    static constexpr std::string_view strings[] = {
+        "CarbonDioxideEmission",
+        "RelativePricePercentage",
+        "RenewableGenerationPercentage",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(CostKindEnum::CarbonDioxideEmission) == 0);
+    static_assert(static_cast<std::size_t>(CostKindEnum::RelativePricePercentage) == 1);
+    static_assert(static_cast<std::size_t>(CostKindEnum::RenewableGenerationPercentage) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "CostKindEnum"};
 }
 
-CostKindEnum string_to_cost_kind_enum(const std::string& s) {
-    if (s == "CarbonDioxideEmission") {
-        return CostKindEnum::CarbonDioxideEmission;
-    }
-    if (s == "RelativePricePercentage") {
-        return CostKindEnum::RelativePricePercentage;
-    }
-    if (s == "RenewableGenerationPercentage") {
-        return CostKindEnum::RenewableGenerationPercentage;
+CostKindEnum string_to_cost_kind_enum(std::string_view s) {
+    switch (s.size()) {
+    case 21:
+        if (s == "CarbonDioxideEmission") {
+            return CostKindEnum::CarbonDioxideEmission;
+        }
+        break;
+    case 23:
+        if (s == "RelativePricePercentage") {
+            return CostKindEnum::RelativePricePercentage;
+        }
+        break;
+    case 29:
+        if (s == "RenewableGenerationPercentage") {
+            return CostKindEnum::RenewableGenerationPercentage;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "CostKindEnum"};
@@ -2085,32 +3087,48 @@ std::ostream& operator<<(std::ostream& os, const CostKindEnum& cost_kind_enum) {
 // from: NotifyEVChargingNeedsRequest
 namespace conversions {
 std::string energy_transfer_mode_enum_to_string(EnergyTransferModeEnum e) {
-    switch (e) {
-    case EnergyTransferModeEnum::DC:
-        return "DC";
-    case EnergyTransferModeEnum::AC_single_phase:
-        return "AC_single_phase";
-    case EnergyTransferModeEnum::AC_two_phase:
-        return "AC_two_phase";
-    case EnergyTransferModeEnum::AC_three_phase:
-        return "AC_three_phase";
+    static constexpr std::string_view strings[] = {
+        "DC",
+        "AC_single_phase",
+        "AC_two_phase",
+        "AC_three_phase",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(EnergyTransferModeEnum::DC) == 0);
+    static_assert(static_cast<std::size_t>(EnergyTransferModeEnum::AC_single_phase) == 1);
+    static_assert(static_cast<std::size_t>(EnergyTransferModeEnum::AC_two_phase) == 2);
+    static_assert(static_cast<std::size_t>(EnergyTransferModeEnum::AC_three_phase) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "EnergyTransferModeEnum"};
 }
 
-EnergyTransferModeEnum string_to_energy_transfer_mode_enum(const std::string& s) {
-    if (s == "DC") {
-        return EnergyTransferModeEnum::DC;
-    }
-    if (s == "AC_single_phase") {
-        return EnergyTransferModeEnum::AC_single_phase;
-    }
-    if (s == "AC_two_phase") {
-        return EnergyTransferModeEnum::AC_two_phase;
-    }
-    if (s == "AC_three_phase") {
-        return EnergyTransferModeEnum::AC_three_phase;
+EnergyTransferModeEnum string_to_energy_transfer_mode_enum(std::string_view s) {
+    switch (s.size()) {
+    case 2:
+        if (s == "DC") {
+            return EnergyTransferModeEnum::DC;
+        }
+        break;
+    case 12:
+        if (s == "AC_two_phase") {
+            return EnergyTransferModeEnum::AC_two_phase;
+        }
+        break;
+    case 14:
+        if (s == "AC_three_phase") {
+            return EnergyTransferModeEnum::AC_three_phase;
+        }
+        break;
+    case 15:
+        if (s == "AC_single_phase") {
+            return EnergyTransferModeEnum::AC_single_phase;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "EnergyTransferModeEnum"};
@@ -2125,27 +3143,45 @@ std::ostream& operator<<(std::ostream& os, const EnergyTransferModeEnum& energy_
 // from: NotifyEVChargingNeedsResponse
 namespace conversions {
 std::string notify_evcharging_needs_status_enum_to_string(NotifyEVChargingNeedsStatusEnum e) {
-    switch (e) {
-    case NotifyEVChargingNeedsStatusEnum::Accepted:
-        return "Accepted";
-    case NotifyEVChargingNeedsStatusEnum::Rejected:
-        return "Rejected";
-    case NotifyEVChargingNeedsStatusEnum::Processing:
-        return "Processing";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "Processing",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(NotifyEVChargingNeedsStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(NotifyEVChargingNeedsStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(NotifyEVChargingNeedsStatusEnum::Processing) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "NotifyEVChargingNeedsStatusEnum"};
 }
 
-NotifyEVChargingNeedsStatusEnum string_to_notify_evcharging_needs_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return NotifyEVChargingNeedsStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return NotifyEVChargingNeedsStatusEnum::Rejected;
-    }
-    if (s == "Processing") {
-        return NotifyEVChargingNeedsStatusEnum::Processing;
+NotifyEVChargingNeedsStatusEnum string_to_notify_evcharging_needs_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return NotifyEVChargingNeedsStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return NotifyEVChargingNeedsStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 10:
+        if (s == "Processing") {
+            return NotifyEVChargingNeedsStatusEnum::Processing;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "NotifyEVChargingNeedsStatusEnum"};
@@ -2160,27 +3196,45 @@ std::ostream& operator<<(std::ostream& os, const NotifyEVChargingNeedsStatusEnum
 // from: NotifyEventRequest
 namespace conversions {
 std::string event_trigger_enum_to_string(EventTriggerEnum e) {
-    switch (e) {
-    case EventTriggerEnum::Alerting:
-        return "Alerting";
-    case EventTriggerEnum::Delta:
-        return "Delta";
-    case EventTriggerEnum::Periodic:
-        return "Periodic";
+    static constexpr std::string_view strings[] = {
+        "Alerting",
+        "Delta",
+        "Periodic",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(EventTriggerEnum::Alerting) == 0);
+    static_assert(static_cast<std::size_t>(EventTriggerEnum::Delta) == 1);
+    static_assert(static_cast<std::size_t>(EventTriggerEnum::Periodic) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "EventTriggerEnum"};
 }
 
-EventTriggerEnum string_to_event_trigger_enum(const std::string& s) {
-    if (s == "Alerting") {
-        return EventTriggerEnum::Alerting;
-    }
-    if (s == "Delta") {
-        return EventTriggerEnum::Delta;
-    }
-    if (s == "Periodic") {
-        return EventTriggerEnum::Periodic;
+EventTriggerEnum string_to_event_trigger_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Delta") {
+            return EventTriggerEnum::Delta;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Alerting") {
+                return EventTriggerEnum::Alerting;
+            }
+            break;
+        case 'P':
+            if (s == "Periodic") {
+                return EventTriggerEnum::Periodic;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "EventTriggerEnum"};
@@ -2195,32 +3249,48 @@ std::ostream& operator<<(std::ostream& os, const EventTriggerEnum& event_trigger
 // from: NotifyEventRequest
 namespace conversions {
 std::string event_notification_enum_to_string(EventNotificationEnum e) {
-    switch (e) {
-    case EventNotificationEnum::HardWiredNotification:
-        return "HardWiredNotification";
-    case EventNotificationEnum::HardWiredMonitor:
-        return "HardWiredMonitor";
-    case EventNotificationEnum::PreconfiguredMonitor:
-        return "PreconfiguredMonitor";
-    case EventNotificationEnum::CustomMonitor:
-        return "CustomMonitor";
+    static constexpr std::string_view strings[] = {
+        "HardWiredNotification",
+        "HardWiredMonitor",
+        "PreconfiguredMonitor",
+        "CustomMonitor",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(EventNotificationEnum::HardWiredNotification) == 0);
+    static_assert(static_cast<std::size_t>(EventNotificationEnum::HardWiredMonitor) == 1);
+    static_assert(static_cast<std::size_t>(EventNotificationEnum::PreconfiguredMonitor) == 2);
+    static_assert(static_cast<std::size_t>(EventNotificationEnum::CustomMonitor) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "EventNotificationEnum"};
 }
 
-EventNotificationEnum string_to_event_notification_enum(const std::string& s) {
-    if (s == "HardWiredNotification") {
-        return EventNotificationEnum::HardWiredNotification;
-    }
-    if (s == "HardWiredMonitor") {
-        return EventNotificationEnum::HardWiredMonitor;
-    }
-    if (s == "PreconfiguredMonitor") {
-        return EventNotificationEnum::PreconfiguredMonitor;
-    }
-    if (s == "CustomMonitor") {
-        return EventNotificationEnum::CustomMonitor;
+EventNotificationEnum string_to_event_notification_enum(std::string_view s) {
+    switch (s.size()) {
+    case 13:
+        if (s == "CustomMonitor") {
+            return EventNotificationEnum::CustomMonitor;
+        }
+        break;
+    case 16:
+        if (s == "HardWiredMonitor") {
+            return EventNotificationEnum::HardWiredMonitor;
+        }
+        break;
+    case 20:
+        if (s == "PreconfiguredMonitor") {
+            return EventNotificationEnum::PreconfiguredMonitor;
+        }
+        break;
+    case 21:
+        if (s == "HardWiredNotification") {
+            return EventNotificationEnum::HardWiredNotification;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "EventNotificationEnum"};
@@ -2235,37 +3305,59 @@ std::ostream& operator<<(std::ostream& os, const EventNotificationEnum& event_no
 // from: NotifyMonitoringReportRequest
 namespace conversions {
 std::string monitor_enum_to_string(MonitorEnum e) {
-    switch (e) {
-    case MonitorEnum::UpperThreshold:
-        return "UpperThreshold";
-    case MonitorEnum::LowerThreshold:
-        return "LowerThreshold";
-    case MonitorEnum::Delta:
-        return "Delta";
-    case MonitorEnum::Periodic:
-        return "Periodic";
-    case MonitorEnum::PeriodicClockAligned:
-        return "PeriodicClockAligned";
+    static constexpr std::string_view strings[] = {
+        "UpperThreshold",
+        "LowerThreshold",
+        "Delta",
+        "Periodic",
+        "PeriodicClockAligned",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MonitorEnum::UpperThreshold) == 0);
+    static_assert(static_cast<std::size_t>(MonitorEnum::LowerThreshold) == 1);
+    static_assert(static_cast<std::size_t>(MonitorEnum::Delta) == 2);
+    static_assert(static_cast<std::size_t>(MonitorEnum::Periodic) == 3);
+    static_assert(static_cast<std::size_t>(MonitorEnum::PeriodicClockAligned) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MonitorEnum"};
 }
 
-MonitorEnum string_to_monitor_enum(const std::string& s) {
-    if (s == "UpperThreshold") {
-        return MonitorEnum::UpperThreshold;
-    }
-    if (s == "LowerThreshold") {
-        return MonitorEnum::LowerThreshold;
-    }
-    if (s == "Delta") {
-        return MonitorEnum::Delta;
-    }
-    if (s == "Periodic") {
-        return MonitorEnum::Periodic;
-    }
-    if (s == "PeriodicClockAligned") {
-        return MonitorEnum::PeriodicClockAligned;
+MonitorEnum string_to_monitor_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Delta") {
+            return MonitorEnum::Delta;
+        }
+        break;
+    case 8:
+        if (s == "Periodic") {
+            return MonitorEnum::Periodic;
+        }
+        break;
+    case 14:
+        switch (s[0]) {
+        case 'U':
+            if (s == "UpperThreshold") {
+                return MonitorEnum::UpperThreshold;
+            }
+            break;
+        case 'L':
+            if (s == "LowerThreshold") {
+                return MonitorEnum::LowerThreshold;
+            }
+            break;
+        }
+        break;
+    case 20:
+        if (s == "PeriodicClockAligned") {
+            return MonitorEnum::PeriodicClockAligned;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MonitorEnum"};
@@ -2280,27 +3372,45 @@ std::ostream& operator<<(std::ostream& os, const MonitorEnum& monitor_enum) {
 // from: NotifyReportRequest
 namespace conversions {
 std::string mutability_enum_to_string(MutabilityEnum e) {
-    switch (e) {
-    case MutabilityEnum::ReadOnly:
-        return "ReadOnly";
-    case MutabilityEnum::WriteOnly:
-        return "WriteOnly";
-    case MutabilityEnum::ReadWrite:
-        return "ReadWrite";
+    static constexpr std::string_view strings[] = {
+        "ReadOnly",
+        "WriteOnly",
+        "ReadWrite",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MutabilityEnum::ReadOnly) == 0);
+    static_assert(static_cast<std::size_t>(MutabilityEnum::WriteOnly) == 1);
+    static_assert(static_cast<std::size_t>(MutabilityEnum::ReadWrite) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MutabilityEnum"};
 }
 
-MutabilityEnum string_to_mutability_enum(const std::string& s) {
-    if (s == "ReadOnly") {
-        return MutabilityEnum::ReadOnly;
-    }
-    if (s == "WriteOnly") {
-        return MutabilityEnum::WriteOnly;
-    }
-    if (s == "ReadWrite") {
-        return MutabilityEnum::ReadWrite;
+MutabilityEnum string_to_mutability_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "ReadOnly") {
+            return MutabilityEnum::ReadOnly;
+        }
+        break;
+    case 9:
+        switch (s[0]) {
+        case 'W':
+            if (s == "WriteOnly") {
+                return MutabilityEnum::WriteOnly;
+            }
+            break;
+        case 'R':
+            if (s == "ReadWrite") {
+                return MutabilityEnum::ReadWrite;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MutabilityEnum"};
@@ -2315,52 +3425,84 @@ std::ostream& operator<<(std::ostream& os, const MutabilityEnum& mutability_enum
 // from: NotifyReportRequest
 namespace conversions {
 std::string data_enum_to_string(DataEnum e) {
-    switch (e) {
-    case DataEnum::string:
-        return "string";
-    case DataEnum::decimal:
-        return "decimal";
-    case DataEnum::integer:
-        return "integer";
-    case DataEnum::dateTime:
-        return "dateTime";
-    case DataEnum::boolean:
-        return "boolean";
-    case DataEnum::OptionList:
-        return "OptionList";
-    case DataEnum::SequenceList:
-        return "SequenceList";
-    case DataEnum::MemberList:
-        return "MemberList";
+    static constexpr std::string_view strings[] = {
+        "string",
+        "decimal",
+        "integer",
+        "dateTime",
+        "boolean",
+        "OptionList",
+        "SequenceList",
+        "MemberList",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(DataEnum::string) == 0);
+    static_assert(static_cast<std::size_t>(DataEnum::decimal) == 1);
+    static_assert(static_cast<std::size_t>(DataEnum::integer) == 2);
+    static_assert(static_cast<std::size_t>(DataEnum::dateTime) == 3);
+    static_assert(static_cast<std::size_t>(DataEnum::boolean) == 4);
+    static_assert(static_cast<std::size_t>(DataEnum::OptionList) == 5);
+    static_assert(static_cast<std::size_t>(DataEnum::SequenceList) == 6);
+    static_assert(static_cast<std::size_t>(DataEnum::MemberList) == 7);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "DataEnum"};
 }
 
-DataEnum string_to_data_enum(const std::string& s) {
-    if (s == "string") {
-        return DataEnum::string;
-    }
-    if (s == "decimal") {
-        return DataEnum::decimal;
-    }
-    if (s == "integer") {
-        return DataEnum::integer;
-    }
-    if (s == "dateTime") {
-        return DataEnum::dateTime;
-    }
-    if (s == "boolean") {
-        return DataEnum::boolean;
-    }
-    if (s == "OptionList") {
-        return DataEnum::OptionList;
-    }
-    if (s == "SequenceList") {
-        return DataEnum::SequenceList;
-    }
-    if (s == "MemberList") {
-        return DataEnum::MemberList;
+DataEnum string_to_data_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "string") {
+            return DataEnum::string;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 'd':
+            if (s == "decimal") {
+                return DataEnum::decimal;
+            }
+            break;
+        case 'i':
+            if (s == "integer") {
+                return DataEnum::integer;
+            }
+            break;
+        case 'b':
+            if (s == "boolean") {
+                return DataEnum::boolean;
+            }
+            break;
+        }
+        break;
+    case 8:
+        if (s == "dateTime") {
+            return DataEnum::dateTime;
+        }
+        break;
+    case 10:
+        switch (s[0]) {
+        case 'O':
+            if (s == "OptionList") {
+                return DataEnum::OptionList;
+            }
+            break;
+        case 'M':
+            if (s == "MemberList") {
+                return DataEnum::MemberList;
+            }
+            break;
+        }
+        break;
+    case 12:
+        if (s == "SequenceList") {
+            return DataEnum::SequenceList;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DataEnum"};
@@ -2375,62 +3517,94 @@ std::ostream& operator<<(std::ostream& os, const DataEnum& data_enum) {
 // from: PublishFirmwareStatusNotificationRequest
 namespace conversions {
 std::string publish_firmware_status_enum_to_string(PublishFirmwareStatusEnum e) {
-    switch (e) {
-    case PublishFirmwareStatusEnum::Idle:
-        return "Idle";
-    case PublishFirmwareStatusEnum::DownloadScheduled:
-        return "DownloadScheduled";
-    case PublishFirmwareStatusEnum::Downloading:
-        return "Downloading";
-    case PublishFirmwareStatusEnum::Downloaded:
-        return "Downloaded";
-    case PublishFirmwareStatusEnum::Published:
-        return "Published";
-    case PublishFirmwareStatusEnum::DownloadFailed:
-        return "DownloadFailed";
-    case PublishFirmwareStatusEnum::DownloadPaused:
-        return "DownloadPaused";
-    case PublishFirmwareStatusEnum::InvalidChecksum:
-        return "InvalidChecksum";
-    case PublishFirmwareStatusEnum::ChecksumVerified:
-        return "ChecksumVerified";
-    case PublishFirmwareStatusEnum::PublishFailed:
-        return "PublishFailed";
+    static constexpr std::string_view strings[] = {
+        "Idle",
+        "DownloadScheduled",
+        "Downloading",
+        "Downloaded",
+        "Published",
+        "DownloadFailed",
+        "DownloadPaused",
+        "InvalidChecksum",
+        "ChecksumVerified",
+        "PublishFailed",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(PublishFirmwareStatusEnum::Idle) == 0);
+    static_assert(static_cast<std::size_t>(PublishFirmwareStatusEnum::DownloadScheduled) == 1);
+    static_assert(static_cast<std::size_t>(PublishFirmwareStatusEnum::Downloading) == 2);
+    static_assert(static_cast<std::size_t>(PublishFirmwareStatusEnum::Downloaded) == 3);
+    static_assert(static_cast<std::size_t>(PublishFirmwareStatusEnum::Published) == 4);
+    static_assert(static_cast<std::size_t>(PublishFirmwareStatusEnum::DownloadFailed) == 5);
+    static_assert(static_cast<std::size_t>(PublishFirmwareStatusEnum::DownloadPaused) == 6);
+    static_assert(static_cast<std::size_t>(PublishFirmwareStatusEnum::InvalidChecksum) == 7);
+    static_assert(static_cast<std::size_t>(PublishFirmwareStatusEnum::ChecksumVerified) == 8);
+    static_assert(static_cast<std::size_t>(PublishFirmwareStatusEnum::PublishFailed) == 9);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "PublishFirmwareStatusEnum"};
 }
 
-PublishFirmwareStatusEnum string_to_publish_firmware_status_enum(const std::string& s) {
-    if (s == "Idle") {
-        return PublishFirmwareStatusEnum::Idle;
-    }
-    if (s == "DownloadScheduled") {
-        return PublishFirmwareStatusEnum::DownloadScheduled;
-    }
-    if (s == "Downloading") {
-        return PublishFirmwareStatusEnum::Downloading;
-    }
-    if (s == "Downloaded") {
-        return PublishFirmwareStatusEnum::Downloaded;
-    }
-    if (s == "Published") {
-        return PublishFirmwareStatusEnum::Published;
-    }
-    if (s == "DownloadFailed") {
-        return PublishFirmwareStatusEnum::DownloadFailed;
-    }
-    if (s == "DownloadPaused") {
-        return PublishFirmwareStatusEnum::DownloadPaused;
-    }
-    if (s == "InvalidChecksum") {
-        return PublishFirmwareStatusEnum::InvalidChecksum;
-    }
-    if (s == "ChecksumVerified") {
-        return PublishFirmwareStatusEnum::ChecksumVerified;
-    }
-    if (s == "PublishFailed") {
-        return PublishFirmwareStatusEnum::PublishFailed;
+PublishFirmwareStatusEnum string_to_publish_firmware_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return PublishFirmwareStatusEnum::Idle;
+        }
+        break;
+    case 9:
+        if (s == "Published") {
+            return PublishFirmwareStatusEnum::Published;
+        }
+        break;
+    case 10:
+        if (s == "Downloaded") {
+            return PublishFirmwareStatusEnum::Downloaded;
+        }
+        break;
+    case 11:
+        if (s == "Downloading") {
+            return PublishFirmwareStatusEnum::Downloading;
+        }
+        break;
+    case 13:
+        if (s == "PublishFailed") {
+            return PublishFirmwareStatusEnum::PublishFailed;
+        }
+        break;
+    case 14:
+        switch (s[8]) {
+        case 'F':
+            if (s == "DownloadFailed") {
+                return PublishFirmwareStatusEnum::DownloadFailed;
+            }
+            break;
+        case 'P':
+            if (s == "DownloadPaused") {
+                return PublishFirmwareStatusEnum::DownloadPaused;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "InvalidChecksum") {
+            return PublishFirmwareStatusEnum::InvalidChecksum;
+        }
+        break;
+    case 16:
+        if (s == "ChecksumVerified") {
+            return PublishFirmwareStatusEnum::ChecksumVerified;
+        }
+        break;
+    case 17:
+        if (s == "DownloadScheduled") {
+            return PublishFirmwareStatusEnum::DownloadScheduled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "PublishFirmwareStatusEnum"};
@@ -2445,27 +3619,45 @@ std::ostream& operator<<(std::ostream& os, const PublishFirmwareStatusEnum& publ
 // from: ReportChargingProfilesRequest
 namespace conversions {
 std::string charging_profile_kind_enum_to_string(ChargingProfileKindEnum e) {
-    switch (e) {
-    case ChargingProfileKindEnum::Absolute:
-        return "Absolute";
-    case ChargingProfileKindEnum::Recurring:
-        return "Recurring";
-    case ChargingProfileKindEnum::Relative:
-        return "Relative";
+    static constexpr std::string_view strings[] = {
+        "Absolute",
+        "Recurring",
+        "Relative",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargingProfileKindEnum::Absolute) == 0);
+    static_assert(static_cast<std::size_t>(ChargingProfileKindEnum::Recurring) == 1);
+    static_assert(static_cast<std::size_t>(ChargingProfileKindEnum::Relative) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargingProfileKindEnum"};
 }
 
-ChargingProfileKindEnum string_to_charging_profile_kind_enum(const std::string& s) {
-    if (s == "Absolute") {
-        return ChargingProfileKindEnum::Absolute;
-    }
-    if (s == "Recurring") {
-        return ChargingProfileKindEnum::Recurring;
-    }
-    if (s == "Relative") {
-        return ChargingProfileKindEnum::Relative;
+ChargingProfileKindEnum string_to_charging_profile_kind_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Absolute") {
+                return ChargingProfileKindEnum::Absolute;
+            }
+            break;
+        case 'R':
+            if (s == "Relative") {
+                return ChargingProfileKindEnum::Relative;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Recurring") {
+            return ChargingProfileKindEnum::Recurring;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfileKindEnum"};
@@ -2480,22 +3672,34 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfileKindEnum& chargi
 // from: ReportChargingProfilesRequest
 namespace conversions {
 std::string recurrency_kind_enum_to_string(RecurrencyKindEnum e) {
-    switch (e) {
-    case RecurrencyKindEnum::Daily:
-        return "Daily";
-    case RecurrencyKindEnum::Weekly:
-        return "Weekly";
+    static constexpr std::string_view strings[] = {
+        "Daily",
+        "Weekly",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(RecurrencyKindEnum::Daily) == 0);
+    static_assert(static_cast<std::size_t>(RecurrencyKindEnum::Weekly) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "RecurrencyKindEnum"};
 }
 
-RecurrencyKindEnum string_to_recurrency_kind_enum(const std::string& s) {
-    if (s == "Daily") {
-        return RecurrencyKindEnum::Daily;
-    }
-    if (s == "Weekly") {
-        return RecurrencyKindEnum::Weekly;
+RecurrencyKindEnum string_to_recurrency_kind_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Daily") {
+            return RecurrencyKindEnum::Daily;
+        }
+        break;
+    case 6:
+        if (s == "Weekly") {
+            return RecurrencyKindEnum::Weekly;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RecurrencyKindEnum"};
@@ -2510,22 +3714,38 @@ std::ostream& operator<<(std::ostream& os, const RecurrencyKindEnum& recurrency_
 // from: RequestStartTransactionResponse
 namespace conversions {
 std::string request_start_stop_status_enum_to_string(RequestStartStopStatusEnum e) {
-    switch (e) {
-    case RequestStartStopStatusEnum::Accepted:
-        return "Accepted";
-    case RequestStartStopStatusEnum::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(RequestStartStopStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(RequestStartStopStatusEnum::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "RequestStartStopStatusEnum"};
 }
 
-RequestStartStopStatusEnum string_to_request_start_stop_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return RequestStartStopStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return RequestStartStopStatusEnum::Rejected;
+RequestStartStopStatusEnum string_to_request_start_stop_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return RequestStartStopStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return RequestStartStopStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "RequestStartStopStatusEnum"};
@@ -2540,22 +3760,38 @@ std::ostream& operator<<(std::ostream& os, const RequestStartStopStatusEnum& req
 // from: ReservationStatusUpdateRequest
 namespace conversions {
 std::string reservation_update_status_enum_to_string(ReservationUpdateStatusEnum e) {
-    switch (e) {
-    case ReservationUpdateStatusEnum::Expired:
-        return "Expired";
-    case ReservationUpdateStatusEnum::Removed:
-        return "Removed";
+    static constexpr std::string_view strings[] = {
+        "Expired",
+        "Removed",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ReservationUpdateStatusEnum::Expired) == 0);
+    static_assert(static_cast<std::size_t>(ReservationUpdateStatusEnum::Removed) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ReservationUpdateStatusEnum"};
 }
 
-ReservationUpdateStatusEnum string_to_reservation_update_status_enum(const std::string& s) {
-    if (s == "Expired") {
-        return ReservationUpdateStatusEnum::Expired;
-    }
-    if (s == "Removed") {
-        return ReservationUpdateStatusEnum::Removed;
+ReservationUpdateStatusEnum string_to_reservation_update_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        switch (s[0]) {
+        case 'E':
+            if (s == "Expired") {
+                return ReservationUpdateStatusEnum::Expired;
+            }
+            break;
+        case 'R':
+            if (s == "Removed") {
+                return ReservationUpdateStatusEnum::Removed;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReservationUpdateStatusEnum"};
@@ -2570,122 +3806,172 @@ std::ostream& operator<<(std::ostream& os, const ReservationUpdateStatusEnum& re
 // from: ReserveNowRequest
 namespace conversions {
 std::string connector_enum_to_string(ConnectorEnum e) {
-    switch (e) {
-    case ConnectorEnum::cCCS1:
-        return "cCCS1";
-    case ConnectorEnum::cCCS2:
-        return "cCCS2";
-    case ConnectorEnum::cG105:
-        return "cG105";
-    case ConnectorEnum::cTesla:
-        return "cTesla";
-    case ConnectorEnum::cType1:
-        return "cType1";
-    case ConnectorEnum::cType2:
-        return "cType2";
-    case ConnectorEnum::s309_1P_16A:
-        return "s309-1P-16A";
-    case ConnectorEnum::s309_1P_32A:
-        return "s309-1P-32A";
-    case ConnectorEnum::s309_3P_16A:
-        return "s309-3P-16A";
-    case ConnectorEnum::s309_3P_32A:
-        return "s309-3P-32A";
-    case ConnectorEnum::sBS1361:
-        return "sBS1361";
-    case ConnectorEnum::sCEE_7_7:
-        return "sCEE-7-7";
-    case ConnectorEnum::sType2:
-        return "sType2";
-    case ConnectorEnum::sType3:
-        return "sType3";
-    case ConnectorEnum::Other1PhMax16A:
-        return "Other1PhMax16A";
-    case ConnectorEnum::Other1PhOver16A:
-        return "Other1PhOver16A";
-    case ConnectorEnum::Other3Ph:
-        return "Other3Ph";
-    case ConnectorEnum::Pan:
-        return "Pan";
-    case ConnectorEnum::wInductive:
-        return "wInductive";
-    case ConnectorEnum::wResonant:
-        return "wResonant";
-    case ConnectorEnum::Undetermined:
-        return "Undetermined";
-    case ConnectorEnum::Unknown:
-        return "Unknown";
+    static constexpr std::string_view strings[] = {
+        "cCCS1",
+        "cCCS2",
+        "cG105",
+        "cTesla",
+        "cType1",
+        "cType2",
+        "s309-1P-16A",
+        "s309-1P-32A",
+        "s309-3P-16A",
+        "s309-3P-32A",
+        "sBS1361",
+        "sCEE-7-7",
+        "sType2",
+        "sType3",
+        "Other1PhMax16A",
+        "Other1PhOver16A",
+        "Other3Ph",
+        "Pan",
+        "wInductive",
+        "wResonant",
+        "Undetermined",
+        "Unknown",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ConnectorEnum::cCCS1) == 0);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::cCCS2) == 1);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::cG105) == 2);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::cTesla) == 3);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::cType1) == 4);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::cType2) == 5);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::s309_1P_16A) == 6);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::s309_1P_32A) == 7);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::s309_3P_16A) == 8);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::s309_3P_32A) == 9);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::sBS1361) == 10);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::sCEE_7_7) == 11);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::sType2) == 12);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::sType3) == 13);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::Other1PhMax16A) == 14);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::Other1PhOver16A) == 15);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::Other3Ph) == 16);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::Pan) == 17);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::wInductive) == 18);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::wResonant) == 19);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::Undetermined) == 20);
+    static_assert(static_cast<std::size_t>(ConnectorEnum::Unknown) == 21);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ConnectorEnum"};
 }
 
-ConnectorEnum string_to_connector_enum(const std::string& s) {
-    if (s == "cCCS1") {
-        return ConnectorEnum::cCCS1;
-    }
-    if (s == "cCCS2") {
-        return ConnectorEnum::cCCS2;
-    }
-    if (s == "cG105") {
-        return ConnectorEnum::cG105;
-    }
-    if (s == "cTesla") {
-        return ConnectorEnum::cTesla;
-    }
-    if (s == "cType1") {
-        return ConnectorEnum::cType1;
-    }
-    if (s == "cType2") {
-        return ConnectorEnum::cType2;
-    }
-    if (s == "s309-1P-16A") {
-        return ConnectorEnum::s309_1P_16A;
-    }
-    if (s == "s309-1P-32A") {
-        return ConnectorEnum::s309_1P_32A;
-    }
-    if (s == "s309-3P-16A") {
-        return ConnectorEnum::s309_3P_16A;
-    }
-    if (s == "s309-3P-32A") {
-        return ConnectorEnum::s309_3P_32A;
-    }
-    if (s == "sBS1361") {
-        return ConnectorEnum::sBS1361;
-    }
-    if (s == "sCEE-7-7") {
-        return ConnectorEnum::sCEE_7_7;
-    }
-    if (s == "sType2") {
-        return ConnectorEnum::sType2;
-    }
-    if (s == "sType3") {
-        return ConnectorEnum::sType3;
-    }
-    if (s == "Other1PhMax16A") {
-        return ConnectorEnum::Other1PhMax16A;
-    }
-    if (s == "Other1PhOver16A") {
-        return ConnectorEnum::Other1PhOver16A;
-    }
-    if (s == "Other3Ph") {
-        return ConnectorEnum::Other3Ph;
-    }
-    if (s == "Pan") {
-        return ConnectorEnum::Pan;
-    }
-    if (s == "wInductive") {
-        return ConnectorEnum::wInductive;
-    }
-    if (s == "wResonant") {
-        return ConnectorEnum::wResonant;
-    }
-    if (s == "Undetermined") {
-        return ConnectorEnum::Undetermined;
-    }
-    if (s == "Unknown") {
-        return ConnectorEnum::Unknown;
+ConnectorEnum string_to_connector_enum(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "Pan") {
+            return ConnectorEnum::Pan;
+        }
+        break;
+    case 5:
+        switch (s[4]) {
+        case '1':
+            if (s == "cCCS1") {
+                return ConnectorEnum::cCCS1;
+            }
+            break;
+        case '2':
+            if (s == "cCCS2") {
+                return ConnectorEnum::cCCS2;
+            }
+            break;
+        case '5':
+            if (s == "cG105") {
+                return ConnectorEnum::cG105;
+            }
+            break;
+        }
+        break;
+    case 6:
+        if (s == "cTesla") {
+            return ConnectorEnum::cTesla;
+        }
+        if (s == "cType1") {
+            return ConnectorEnum::cType1;
+        }
+        if (s == "cType2") {
+            return ConnectorEnum::cType2;
+        }
+        if (s == "sType2") {
+            return ConnectorEnum::sType2;
+        }
+        if (s == "sType3") {
+            return ConnectorEnum::sType3;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 's':
+            if (s == "sBS1361") {
+                return ConnectorEnum::sBS1361;
+            }
+            break;
+        case 'U':
+            if (s == "Unknown") {
+                return ConnectorEnum::Unknown;
+            }
+            break;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 's':
+            if (s == "sCEE-7-7") {
+                return ConnectorEnum::sCEE_7_7;
+            }
+            break;
+        case 'O':
+            if (s == "Other3Ph") {
+                return ConnectorEnum::Other3Ph;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "wResonant") {
+            return ConnectorEnum::wResonant;
+        }
+        break;
+    case 10:
+        if (s == "wInductive") {
+            return ConnectorEnum::wInductive;
+        }
+        break;
+    case 11:
+        if (s == "s309-1P-16A") {
+            return ConnectorEnum::s309_1P_16A;
+        }
+        if (s == "s309-1P-32A") {
+            return ConnectorEnum::s309_1P_32A;
+        }
+        if (s == "s309-3P-16A") {
+            return ConnectorEnum::s309_3P_16A;
+        }
+        if (s == "s309-3P-32A") {
+            return ConnectorEnum::s309_3P_32A;
+        }
+        break;
+    case 12:
+        if (s == "Undetermined") {
+            return ConnectorEnum::Undetermined;
+        }
+        break;
+    case 14:
+        if (s == "Other1PhMax16A") {
+            return ConnectorEnum::Other1PhMax16A;
+        }
+        break;
+    case 15:
+        if (s == "Other1PhOver16A") {
+            return ConnectorEnum::Other1PhOver16A;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ConnectorEnum"};
@@ -2700,37 +3986,59 @@ std::ostream& operator<<(std::ostream& os, const ConnectorEnum& connector_enum)
 // from: ReserveNowResponse
 namespace conversions {
 std::string reserve_now_status_enum_to_string(ReserveNowStatusEnum e) {
-    switch (e) {
-    case ReserveNowStatusEnum::Accepted:
-        return "Accepted";
-    case ReserveNowStatusEnum::Faulted:
-        return "Faulted";
-    case ReserveNowStatusEnum::Occupied:
-        return "Occupied";
-    case ReserveNowStatusEnum::Rejected:
-        return "Rejected";
-    case ReserveNowStatusEnum::Unavailable:
-        return "Unavailable";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Faulted",
+        "Occupied",
+        "Rejected",
+        "Unavailable",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ReserveNowStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ReserveNowStatusEnum::Faulted) == 1);
+    static_assert(static_cast<std::size_t>(ReserveNowStatusEnum::Occupied) == 2);
+    static_assert(static_cast<std::size_t>(ReserveNowStatusEnum::Rejected) == 3);
+    static_assert(static_cast<std::size_t>(ReserveNowStatusEnum::Unavailable) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ReserveNowStatusEnum"};
 }
 
-ReserveNowStatusEnum string_to_reserve_now_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ReserveNowStatusEnum::Accepted;
-    }
-    if (s == "Faulted") {
-        return ReserveNowStatusEnum::Faulted;
-    }
-    if (s == "Occupied") {
-        return ReserveNowStatusEnum::Occupied;
-    }
-    if (s == "Rejected") {
-        return ReserveNowStatusEnum::Rejected;
-    }
-    if (s == "Unavailable") {
-        return ReserveNowStatusEnum::Unavailable;
+ReserveNowStatusEnum string_to_reserve_now_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ReserveNowStatusEnum::Faulted;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ReserveNowStatusEnum::Accepted;
+            }
+            break;
+        case 'O':
+            if (s == "Occupied") {
+                return ReserveNowStatusEnum::Occupied;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ReserveNowStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return ReserveNowStatusEnum::Unavailable;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReserveNowStatusEnum"};
@@ -2745,22 +4053,34 @@ std::ostream& operator<<(std::ostream& os, const ReserveNowStatusEnum& reserve_n
 // from: ResetRequest
 namespace conversions {
 std::string reset_enum_to_string(ResetEnum e) {
-    switch (e) {
-    case ResetEnum::Immediate:
-        return "Immediate";
-    case ResetEnum::OnIdle:
-        return "OnIdle";
+    static constexpr std::string_view strings[] = {
+        "Immediate",
+        "OnIdle",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ResetEnum::Immediate) == 0);
+    static_assert(static_cast<std::size_t>(ResetEnum::OnIdle) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ResetEnum"};
 }
 
-ResetEnum string_to_reset_enum(const std::string& s) {
-    if (s == "Immediate") {
-        return ResetEnum::Immediate;
-    }
-    if (s == "OnIdle") {
-        return ResetEnum::OnIdle;
+ResetEnum string_to_reset_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "OnIdle") {
+            return ResetEnum::OnIdle;
+        }
+        break;
+    case 9:
+        if (s == "Immediate") {
+            return ResetEnum::Immediate;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ResetEnum"};
@@ -2775,27 +4095,45 @@ std::ostream& operator<<(std::ostream& os, const ResetEnum& reset_enum) {
 // from: ResetResponse
 namespace conversions {
 std::string reset_status_enum_to_string(ResetStatusEnum e) {
-    switch (e) {
-    case ResetStatusEnum::Accepted:
-        return "Accepted";
-    case ResetStatusEnum::Rejected:
-        return "Rejected";
-    case ResetStatusEnum::Scheduled:
-        return "Scheduled";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "Scheduled",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ResetStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ResetStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(ResetStatusEnum::Scheduled) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ResetStatusEnum"};
 }
 
-ResetStatusEnum string_to_reset_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ResetStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ResetStatusEnum::Rejected;
-    }
-    if (s == "Scheduled") {
-        return ResetStatusEnum::Scheduled;
+ResetStatusEnum string_to_reset_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ResetStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ResetStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Scheduled") {
+            return ResetStatusEnum::Scheduled;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ResetStatusEnum"};
@@ -2810,22 +4148,34 @@ std::ostream& operator<<(std::ostream& os, const ResetStatusEnum& reset_status_e
 // from: SendLocalListRequest
 namespace conversions {
 std::string update_enum_to_string(UpdateEnum e) {
-    switch (e) {
-    case UpdateEnum::Differential:
-        return "Differential";
-    case UpdateEnum::Full:
-        return "Full";
+    static constexpr std::string_view strings[] = {
+        "Differential",
+        "Full",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UpdateEnum::Differential) == 0);
+    static_assert(static_cast<std::size_t>(UpdateEnum::Full) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UpdateEnum"};
 }
 
-UpdateEnum string_to_update_enum(const std::string& s) {
-    if (s == "Differential") {
-        return UpdateEnum::Differential;
-    }
-    if (s == "Full") {
-        return UpdateEnum::Full;
+UpdateEnum string_to_update_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Full") {
+            return UpdateEnum::Full;
+        }
+        break;
+    case 12:
+        if (s == "Differential") {
+            return UpdateEnum::Differential;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UpdateEnum"};
@@ -2840,27 +4190,41 @@ std::ostream& operator<<(std::ostream& os, const UpdateEnum& update_enum) {
 // from: SendLocalListResponse
 namespace conversions {
 std::string send_local_list_status_enum_to_string(SendLocalListStatusEnum e) {
-    switch (e) {
-    case SendLocalListStatusEnum::Accepted:
-        return "Accepted";
-    case SendLocalListStatusEnum::Failed:
-        return "Failed";
-    case SendLocalListStatusEnum::VersionMismatch:
-        return "VersionMismatch";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Failed",
+        "VersionMismatch",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(SendLocalListStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(SendLocalListStatusEnum::Failed) == 1);
+    static_assert(static_cast<std::size_t>(SendLocalListStatusEnum::VersionMismatch) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "SendLocalListStatusEnum"};
 }
 
-SendLocalListStatusEnum string_to_send_local_list_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SendLocalListStatusEnum::Accepted;
-    }
-    if (s == "Failed") {
-        return SendLocalListStatusEnum::Failed;
-    }
-    if (s == "VersionMismatch") {
-        return SendLocalListStatusEnum::VersionMismatch;
+SendLocalListStatusEnum string_to_send_local_list_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return SendLocalListStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        if (s == "Accepted") {
+            return SendLocalListStatusEnum::Accepted;
+        }
+        break;
+    case 15:
+        if (s == "VersionMismatch") {
+            return SendLocalListStatusEnum::VersionMismatch;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "SendLocalListStatusEnum"};
@@ -2875,22 +4239,38 @@ std::ostream& operator<<(std::ostream& os, const SendLocalListStatusEnum& send_l
 // from: SetChargingProfileResponse
 namespace conversions {
 std::string charging_profile_status_enum_to_string(ChargingProfileStatusEnum e) {
-    switch (e) {
-    case ChargingProfileStatusEnum::Accepted:
-        return "Accepted";
-    case ChargingProfileStatusEnum::Rejected:
-        return "Rejected";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargingProfileStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(ChargingProfileStatusEnum::Rejected) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargingProfileStatusEnum"};
 }
 
-ChargingProfileStatusEnum string_to_charging_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return ChargingProfileStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return ChargingProfileStatusEnum::Rejected;
+ChargingProfileStatusEnum string_to_charging_profile_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return ChargingProfileStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return ChargingProfileStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingProfileStatusEnum"};
@@ -2905,42 +4285,66 @@ std::ostream& operator<<(std::ostream& os, const ChargingProfileStatusEnum& char
 // from: SetDisplayMessageResponse
 namespace conversions {
 std::string display_message_status_enum_to_string(DisplayMessageStatusEnum e) {
-    switch (e) {
-    case DisplayMessageStatusEnum::Accepted:
-        return "Accepted";
-    case DisplayMessageStatusEnum::NotSupportedMessageFormat:
-        return "NotSupportedMessageFormat";
-    case DisplayMessageStatusEnum::Rejected:
-        return "Rejected";
-    case DisplayMessageStatusEnum::NotSupportedPriority:
-        return "NotSupportedPriority";
-    case DisplayMessageStatusEnum::NotSupportedState:
-        return "NotSupportedState";
-    case DisplayMessageStatusEnum::UnknownTransaction:
-        return "UnknownTransaction";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "NotSupportedMessageFormat",
+        "Rejected",
+        "NotSupportedPriority",
+        "NotSupportedState",
+        "UnknownTransaction",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(DisplayMessageStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(DisplayMessageStatusEnum::NotSupportedMessageFormat) == 1);
+    static_assert(static_cast<std::size_t>(DisplayMessageStatusEnum::Rejected) == 2);
+    static_assert(static_cast<std::size_t>(DisplayMessageStatusEnum::NotSupportedPriority) == 3);
+    static_assert(static_cast<std::size_t>(DisplayMessageStatusEnum::NotSupportedState) == 4);
+    static_assert(static_cast<std::size_t>(DisplayMessageStatusEnum::UnknownTransaction) == 5);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "DisplayMessageStatusEnum"};
 }
 
-DisplayMessageStatusEnum string_to_display_message_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return DisplayMessageStatusEnum::Accepted;
-    }
-    if (s == "NotSupportedMessageFormat") {
-        return DisplayMessageStatusEnum::NotSupportedMessageFormat;
-    }
-    if (s == "Rejected") {
-        return DisplayMessageStatusEnum::Rejected;
-    }
-    if (s == "NotSupportedPriority") {
-        return DisplayMessageStatusEnum::NotSupportedPriority;
-    }
-    if (s == "NotSupportedState") {
-        return DisplayMessageStatusEnum::NotSupportedState;
-    }
-    if (s == "UnknownTransaction") {
-        return DisplayMessageStatusEnum::UnknownTransaction;
+DisplayMessageStatusEnum string_to_display_message_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return DisplayMessageStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return DisplayMessageStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 17:
+        if (s == "NotSupportedState") {
+            return DisplayMessageStatusEnum::NotSupportedState;
+        }
+        break;
+    case 18:
+        if (s == "UnknownTransaction") {
+            return DisplayMessageStatusEnum::UnknownTransaction;
+        }
+        break;
+    case 20:
+        if (s == "NotSupportedPriority") {
+            return DisplayMessageStatusEnum::NotSupportedPriority;
+        }
+        break;
+    case 25:
+        if (s == "NotSupportedMessageFormat") {
+            return DisplayMessageStatusEnum::NotSupportedMessageFormat;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "DisplayMessageStatusEnum"};
@@ -2955,27 +4359,41 @@ std::ostream& operator<<(std::ostream& os, const DisplayMessageStatusEnum& displ
 // from: SetMonitoringBaseRequest
 namespace conversions {
 std::string monitoring_base_enum_to_string(MonitoringBaseEnum e) {
-    switch (e) {
-    case MonitoringBaseEnum::All:
-        return "All";
-    case MonitoringBaseEnum::FactoryDefault:
-        return "FactoryDefault";
-    case MonitoringBaseEnum::HardWiredOnly:
-        return "HardWiredOnly";
+    static constexpr std::string_view strings[] = {
+        "All",
+        "FactoryDefault",
+        "HardWiredOnly",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MonitoringBaseEnum::All) == 0);
+    static_assert(static_cast<std::size_t>(MonitoringBaseEnum::FactoryDefault) == 1);
+    static_assert(static_cast<std::size_t>(MonitoringBaseEnum::HardWiredOnly) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MonitoringBaseEnum"};
 }
 
-MonitoringBaseEnum string_to_monitoring_base_enum(const std::string& s) {
-    if (s == "All") {
-        return MonitoringBaseEnum::All;
-    }
-    if (s == "FactoryDefault") {
-        return MonitoringBaseEnum::FactoryDefault;
-    }
-    if (s == "HardWiredOnly") {
-        return MonitoringBaseEnum::HardWiredOnly;
+MonitoringBaseEnum string_to_monitoring_base_enum(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "All") {
+            return MonitoringBaseEnum::All;
+        }
+        break;
+    case 13:
+        if (s == "HardWiredOnly") {
+            return MonitoringBaseEnum::HardWiredOnly;
+        }
+        break;
+    case 14:
+        if (s == "FactoryDefault") {
+            return MonitoringBaseEnum::FactoryDefault;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MonitoringBaseEnum"};
@@ -2990,32 +4408,52 @@ std::ostream& operator<<(std::ostream& os, const MonitoringBaseEnum& monitoring_
 // from: SetNetworkProfileRequest
 namespace conversions {
 std::string apnauthentication_enum_to_string(APNAuthenticationEnum e) {
-    switch (e) {
-    case APNAuthenticationEnum::CHAP:
-        return "CHAP";
-    case APNAuthenticationEnum::NONE:
-        return "NONE";
-    case APNAuthenticationEnum::PAP:
-        return "PAP";
-    case APNAuthenticationEnum::AUTO:
-        return "AUTO";
+    static constexpr std::string_view strings[] = {
+        "CHAP",
+        "NONE",
+        "PAP",
+        "AUTO",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(APNAuthenticationEnum::CHAP) == 0);
+    static_assert(static_cast<std::size_t>(APNAuthenticationEnum::NONE) == 1);
+    static_assert(static_cast<std::size_t>(APNAuthenticationEnum::PAP) == 2);
+    static_assert(static_cast<std::size_t>(APNAuthenticationEnum::AUTO) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "APNAuthenticationEnum"};
 }
 
-APNAuthenticationEnum string_to_apnauthentication_enum(const std::string& s) {
-    if (s == "CHAP") {
-        return APNAuthenticationEnum::CHAP;
-    }
-    if (s == "NONE") {
-        return APNAuthenticationEnum::NONE;
-    }
-    if (s == "PAP") {
-        return APNAuthenticationEnum::PAP;
-    }
-    if (s == "AUTO") {
-        return APNAuthenticationEnum::AUTO;
+APNAuthenticationEnum string_to_apnauthentication_enum(std::string_view s) {
+    switch (s.size()) {
+    case 3:
+        if (s == "PAP") {
+            return APNAuthenticationEnum::PAP;
+        }
+        break;
+    case 4:
+        switch (s[0]) {
+        case 'C':
+            if (s == "CHAP") {
+                return APNAuthenticationEnum::CHAP;
+            }
+            break;
+        case 'N':
+            if (s == "NONE") {
+                return APNAuthenticationEnum::NONE;
+            }
+            break;
+        case 'A':
+            if (s == "AUTO") {
+                return APNAuthenticationEnum::AUTO;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "APNAuthenticationEnum"};
@@ -3030,32 +4468,52 @@ std::ostream& operator<<(std::ostream& os, const APNAuthenticationEnum& apnauthe
 // from: SetNetworkProfileRequest
 namespace conversions {
 std::string ocppversion_enum_to_string(OCPPVersionEnum e) {
-    switch (e) {
-    case OCPPVersionEnum::OCPP12:
-        return "OCPP12";
-    case OCPPVersionEnum::OCPP15:
-        return "OCPP15";
-    case OCPPVersionEnum::OCPP16:
-        return "OCPP16";
-    case OCPPVersionEnum::OCPP20:
-        return "OCPP20";
+    static constexpr std::string_view strings[] = {
+        "OCPP12",
+        "OCPP15",
+        "OCPP16",
+        "OCPP20",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(OCPPVersionEnum::OCPP12) == 0);
+    static_assert(static_cast<std::size_t>(OCPPVersionEnum::OCPP15) == 1);
+    static_assert(static_cast<std::size_t>(OCPPVersionEnum::OCPP16) == 2);
+    static_assert(static_cast<std::size_t>(OCPPVersionEnum::OCPP20) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "OCPPVersionEnum"};
 }
 
-OCPPVersionEnum string_to_ocppversion_enum(const std::string& s) {
-    if (s == "OCPP12") {
-        return OCPPVersionEnum::OCPP12;
-    }
-    if (s == "OCPP15") {
-        return OCPPVersionEnum::OCPP15;
-    }
-    if (s == "OCPP16") {
-        return OCPPVersionEnum::OCPP16;
-    }
-    if (s == "OCPP20") {
-        return OCPPVersionEnum::OCPP20;
+OCPPVersionEnum string_to_ocppversion_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        switch (s[5]) {
+        case '2':
+            if (s == "OCPP12") {
+                return OCPPVersionEnum::OCPP12;
+            }
+            break;
+        case '5':
+            if (s == "OCPP15") {
+                return OCPPVersionEnum::OCPP15;
+            }
+            break;
+        case '6':
+            if (s == "OCPP16") {
+                return OCPPVersionEnum::OCPP16;
+            }
+            break;
+        case '0':
+            if (s == "OCPP20") {
+                return OCPPVersionEnum::OCPP20;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "OCPPVersionEnum"};
@@ -3070,22 +4528,38 @@ std::ostream& operator<<(std::ostream& os, const OCPPVersionEnum& ocppversion_en
 // from: SetNetworkProfileRequest
 namespace conversions {
 std::string ocpptransport_enum_to_string(OCPPTransportEnum e) {
-    switch (e) {
-    case OCPPTransportEnum::JSON:
-        return "JSON";
-    case OCPPTransportEnum::SOAP:
-        return "SOAP";
+    static constexpr std::string_view strings[] = {
+        "JSON",
+        "SOAP",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(OCPPTransportEnum::JSON) == 0);
+    static_assert(static_cast<std::size_t>(OCPPTransportEnum::SOAP) == 1);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "OCPPTransportEnum"};
 }
 
-OCPPTransportEnum string_to_ocpptransport_enum(const std::string& s) {
-    if (s == "JSON") {
-        return OCPPTransportEnum::JSON;
-    }
-    if (s == "SOAP") {
-        return OCPPTransportEnum::SOAP;
+OCPPTransportEnum string_to_ocpptransport_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        switch (s[0]) {
+        case 'J':
+            if (s == "JSON") {
+                return OCPPTransportEnum::JSON;
+            }
+            break;
+        case 'S':
+            if (s == "SOAP") {
+                return OCPPTransportEnum::SOAP;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "OCPPTransportEnum"};
@@ -3100,52 +4574,84 @@ std::ostream& operator<<(std::ostream& os, const OCPPTransportEnum& ocpptranspor
 // from: SetNetworkProfileRequest
 namespace conversions {
 std::string ocppinterface_enum_to_string(OCPPInterfaceEnum e) {
-    switch (e) {
-    case OCPPInterfaceEnum::Wired0:
-        return "Wired0";
-    case OCPPInterfaceEnum::Wired1:
-        return "Wired1";
-    case OCPPInterfaceEnum::Wired2:
-        return "Wired2";
-    case OCPPInterfaceEnum::Wired3:
-        return "Wired3";
-    case OCPPInterfaceEnum::Wireless0:
-        return "Wireless0";
-    case OCPPInterfaceEnum::Wireless1:
-        return "Wireless1";
-    case OCPPInterfaceEnum::Wireless2:
-        return "Wireless2";
-    case OCPPInterfaceEnum::Wireless3:
-        return "Wireless3";
+    static constexpr std::string_view strings[] = {
+        "Wired0",
+        "Wired1",
+        "Wired2",
+        "Wired3",
+        "Wireless0",
+        "Wireless1",
+        "Wireless2",
+        "Wireless3",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(OCPPInterfaceEnum::Wired0) == 0);
+    static_assert(static_cast<std::size_t>(OCPPInterfaceEnum::Wired1) == 1);
+    static_assert(static_cast<std::size_t>(OCPPInterfaceEnum::Wired2) == 2);
+    static_assert(static_cast<std::size_t>(OCPPInterfaceEnum::Wired3) == 3);
+    static_assert(static_cast<std::size_t>(OCPPInterfaceEnum::Wireless0) == 4);
+    static_assert(static_cast<std::size_t>(OCPPInterfaceEnum::Wireless1) == 5);
+    static_assert(static_cast<std::size_t>(OCPPInterfaceEnum::Wireless2) == 6);
+    static_assert(static_cast<std::size_t>(OCPPInterfaceEnum::Wireless3) == 7);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "OCPPInterfaceEnum"};
 }
 
-OCPPInterfaceEnum string_to_ocppinterface_enum(const std::string& s) {
-    if (s == "Wired0") {
-        return OCPPInterfaceEnum::Wired0;
-    }
-    if (s == "Wired1") {
-        return OCPPInterfaceEnum::Wired1;
-    }
-    if (s == "Wired2") {
-        return OCPPInterfaceEnum::Wired2;
-    }
-    if (s == "Wired3") {
-        return OCPPInterfaceEnum::Wired3;
-    }
-    if (s == "Wireless0") {
-        return OCPPInterfaceEnum::Wireless0;
-    }
-    if (s == "Wireless1") {
-        return OCPPInterfaceEnum::Wireless1;
-    }
-    if (s == "Wireless2") {
-        return OCPPInterfaceEnum::Wireless2;
-    }
-    if (s == "Wireless3") {
-        return OCPPInterfaceEnum::Wireless3;
+OCPPInterfaceEnum string_to_ocppinterface_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        switch (s[5]) {
+        case '0':
+            if (s == "Wired0") {
+                return OCPPInterfaceEnum::Wired0;
+            }
+            break;
+        case '1':
+            if (s == "Wired1") {
+                return OCPPInterfaceEnum::Wired1;
+            }
+            break;
+        case '2':
+            if (s == "Wired2") {
+                return OCPPInterfaceEnum::Wired2;
+            }
+            break;
+        case '3':
+            if (s == "Wired3") {
+                return OCPPInterfaceEnum::Wired3;
+            }
+            break;
+        }
+        break;
+    case 9:
+        switch (s[8]) {
+        case '0':
+            if (s == "Wireless0") {
+                return OCPPInterfaceEnum::Wireless0;
+            }
+            break;
+        case '1':
+            if (s == "Wireless1") {
+                return OCPPInterfaceEnum::Wireless1;
+            }
+            break;
+        case '2':
+            if (s == "Wireless2") {
+                return OCPPInterfaceEnum::Wireless2;
+            }
+            break;
+        case '3':
+            if (s == "Wireless3") {
+                return OCPPInterfaceEnum::Wireless3;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "OCPPInterfaceEnum"};
@@ -3160,32 +4666,56 @@ std::ostream& operator<<(std::ostream& os, const OCPPInterfaceEnum& ocppinterfac
 // from: SetNetworkProfileRequest
 namespace conversions {
 std::string vpnenum_to_string(VPNEnum e) {
-    switch (e) {
-    case VPNEnum::IKEv2:
-        return "IKEv2";
-    case VPNEnum::IPSec:
-        return "IPSec";
-    case VPNEnum::L2TP:
-        return "L2TP";
-    case VPNEnum::PPTP:
-        return "PPTP";
+    static constexpr std::string_view strings[] = {
+        "IKEv2",
+        "IPSec",
+        "L2TP",
+        "PPTP",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(VPNEnum::IKEv2) == 0);
+    static_assert(static_cast<std::size_t>(VPNEnum::IPSec) == 1);
+    static_assert(static_cast<std::size_t>(VPNEnum::L2TP) == 2);
+    static_assert(static_cast<std::size_t>(VPNEnum::PPTP) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "VPNEnum"};
 }
 
-VPNEnum string_to_vpnenum(const std::string& s) {
-    if (s == "IKEv2") {
-        return VPNEnum::IKEv2;
-    }
-    if (s == "IPSec") {
-        return VPNEnum::IPSec;
-    }
-    if (s == "L2TP") {
-        return VPNEnum::L2TP;
-    }
-    if (s == "PPTP") {
-        return VPNEnum::PPTP;
+VPNEnum string_to_vpnenum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        switch (s[0]) {
+        case 'L':
+            if (s == "L2TP") {
+                return VPNEnum::L2TP;
+            }
+            break;
+        case 'P':
+            if (s == "PPTP") {
+                return VPNEnum::PPTP;
+            }
+            break;
+        }
+        break;
+    case 5:
+        switch (s[1]) {
+        case 'K':
+            if (s == "IKEv2") {
+                return VPNEnum::IKEv2;
+            }
+            break;
+        case 'P':
+            if (s == "IPSec") {
+                return VPNEnum::IPSec;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "VPNEnum"};
@@ -3200,27 +4730,45 @@ std::ostream& operator<<(std::ostream& os, const VPNEnum& vpnenum) {
 // from: SetNetworkProfileResponse
 namespace conversions {
 std::string set_network_profile_status_enum_to_string(SetNetworkProfileStatusEnum e) {
-    switch (e) {
-    case SetNetworkProfileStatusEnum::Accepted:
-        return "Accepted";
-    case SetNetworkProfileStatusEnum::Rejected:
-        return "Rejected";
-    case SetNetworkProfileStatusEnum::Failed:
-        return "Failed";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "Failed",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(SetNetworkProfileStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(SetNetworkProfileStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(SetNetworkProfileStatusEnum::Failed) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "SetNetworkProfileStatusEnum"};
 }
 
-SetNetworkProfileStatusEnum string_to_set_network_profile_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SetNetworkProfileStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return SetNetworkProfileStatusEnum::Rejected;
-    }
-    if (s == "Failed") {
-        return SetNetworkProfileStatusEnum::Failed;
+SetNetworkProfileStatusEnum string_to_set_network_profile_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 6:
+        if (s == "Failed") {
+            return SetNetworkProfileStatusEnum::Failed;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return SetNetworkProfileStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return SetNetworkProfileStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "SetNetworkProfileStatusEnum"};
@@ -3235,42 +4783,66 @@ std::ostream& operator<<(std::ostream& os, const SetNetworkProfileStatusEnum& se
 // from: SetVariableMonitoringResponse
 namespace conversions {
 std::string set_monitoring_status_enum_to_string(SetMonitoringStatusEnum e) {
-    switch (e) {
-    case SetMonitoringStatusEnum::Accepted:
-        return "Accepted";
-    case SetMonitoringStatusEnum::UnknownComponent:
-        return "UnknownComponent";
-    case SetMonitoringStatusEnum::UnknownVariable:
-        return "UnknownVariable";
-    case SetMonitoringStatusEnum::UnsupportedMonitorType:
-        return "UnsupportedMonitorType";
-    case SetMonitoringStatusEnum::Rejected:
-        return "Rejected";
-    case SetMonitoringStatusEnum::Duplicate:
-        return "Duplicate";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "UnknownComponent",
+        "UnknownVariable",
+        "UnsupportedMonitorType",
+        "Rejected",
+        "Duplicate",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(SetMonitoringStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(SetMonitoringStatusEnum::UnknownComponent) == 1);
+    static_assert(static_cast<std::size_t>(SetMonitoringStatusEnum::UnknownVariable) == 2);
+    static_assert(static_cast<std::size_t>(SetMonitoringStatusEnum::UnsupportedMonitorType) == 3);
+    static_assert(static_cast<std::size_t>(SetMonitoringStatusEnum::Rejected) == 4);
+    static_assert(static_cast<std::size_t>(SetMonitoringStatusEnum::Duplicate) == 5);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "SetMonitoringStatusEnum"};
 }
 
-SetMonitoringStatusEnum string_to_set_monitoring_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SetMonitoringStatusEnum::Accepted;
-    }
-    if (s == "UnknownComponent") {
-        return SetMonitoringStatusEnum::UnknownComponent;
-    }
-    if (s == "UnknownVariable") {
-        return SetMonitoringStatusEnum::UnknownVariable;
-    }
-    if (s == "UnsupportedMonitorType") {
-        return SetMonitoringStatusEnum::UnsupportedMonitorType;
-    }
-    if (s == "Rejected") {
-        return SetMonitoringStatusEnum::Rejected;
-    }
-    if (s == "Duplicate") {
-        return SetMonitoringStatusEnum::Duplicate;
+SetMonitoringStatusEnum string_to_set_monitoring_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return SetMonitoringStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return SetMonitoringStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Duplicate") {
+            return SetMonitoringStatusEnum::Duplicate;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVariable") {
+            return SetMonitoringStatusEnum::UnknownVariable;
+        }
+        break;
+    case 16:
+        if (s == "UnknownComponent") {
+            return SetMonitoringStatusEnum::UnknownComponent;
+        }
+        break;
+    case 22:
+        if (s == "UnsupportedMonitorType") {
+            return SetMonitoringStatusEnum::UnsupportedMonitorType;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "SetMonitoringStatusEnum"};
@@ -3285,42 +4857,66 @@ std::ostream& operator<<(std::ostream& os, const SetMonitoringStatusEnum& set_mo
 // from: SetVariablesResponse
 namespace conversions {
 std::string set_variable_status_enum_to_string(SetVariableStatusEnum e) {
-    switch (e) {
-    case SetVariableStatusEnum::Accepted:
-        return "Accepted";
-    case SetVariableStatusEnum::Rejected:
-        return "Rejected";
-    case SetVariableStatusEnum::UnknownComponent:
-        return "UnknownComponent";
-    case SetVariableStatusEnum::UnknownVariable:
-        return "UnknownVariable";
-    case SetVariableStatusEnum::NotSupportedAttributeType:
-        return "NotSupportedAttributeType";
-    case SetVariableStatusEnum::RebootRequired:
-        return "RebootRequired";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "UnknownComponent",
+        "UnknownVariable",
+        "NotSupportedAttributeType",
+        "RebootRequired",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(SetVariableStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(SetVariableStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(SetVariableStatusEnum::UnknownComponent) == 2);
+    static_assert(static_cast<std::size_t>(SetVariableStatusEnum::UnknownVariable) == 3);
+    static_assert(static_cast<std::size_t>(SetVariableStatusEnum::NotSupportedAttributeType) == 4);
+    static_assert(static_cast<std::size_t>(SetVariableStatusEnum::RebootRequired) == 5);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "SetVariableStatusEnum"};
 }
 
-SetVariableStatusEnum string_to_set_variable_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return SetVariableStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return SetVariableStatusEnum::Rejected;
-    }
-    if (s == "UnknownComponent") {
-        return SetVariableStatusEnum::UnknownComponent;
-    }
-    if (s == "UnknownVariable") {
-        return SetVariableStatusEnum::UnknownVariable;
-    }
-    if (s == "NotSupportedAttributeType") {
-        return SetVariableStatusEnum::NotSupportedAttributeType;
-    }
-    if (s == "RebootRequired") {
-        return SetVariableStatusEnum::RebootRequired;
+SetVariableStatusEnum string_to_set_variable_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return SetVariableStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return SetVariableStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "RebootRequired") {
+            return SetVariableStatusEnum::RebootRequired;
+        }
+        break;
+    case 15:
+        if (s == "UnknownVariable") {
+            return SetVariableStatusEnum::UnknownVariable;
+        }
+        break;
+    case 16:
+        if (s == "UnknownComponent") {
+            return SetVariableStatusEnum::UnknownComponent;
+        }
+        break;
+    case 25:
+        if (s == "NotSupportedAttributeType") {
+            return SetVariableStatusEnum::NotSupportedAttributeType;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "SetVariableStatusEnum"};
@@ -3335,37 +4931,59 @@ std::ostream& operator<<(std::ostream& os, const SetVariableStatusEnum& set_vari
 // from: StatusNotificationRequest
 namespace conversions {
 std::string connector_status_enum_to_string(ConnectorStatusEnum e) {
-    switch (e) {
-    case ConnectorStatusEnum::Available:
-        return "Available";
-    case ConnectorStatusEnum::Occupied:
-        return "Occupied";
-    case ConnectorStatusEnum::Reserved:
-        return "Reserved";
-    case ConnectorStatusEnum::Unavailable:
-        return "Unavailable";
-    case ConnectorStatusEnum::Faulted:
-        return "Faulted";
+    static constexpr std::string_view strings[] = {
+        "Available",
+        "Occupied",
+        "Reserved",
+        "Unavailable",
+        "Faulted",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ConnectorStatusEnum::Available) == 0);
+    static_assert(static_cast<std::size_t>(ConnectorStatusEnum::Occupied) == 1);
+    static_assert(static_cast<std::size_t>(ConnectorStatusEnum::Reserved) == 2);
+    static_assert(static_cast<std::size_t>(ConnectorStatusEnum::Unavailable) == 3);
+    static_assert(static_cast<std::size_t>(ConnectorStatusEnum::Faulted) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ConnectorStatusEnum"};
 }
 
-ConnectorStatusEnum string_to_connector_status_enum(const std::string& s) {
-    if (s == "Available") {
-        return ConnectorStatusEnum::Available;
-    }
-    if (s == "Occupied") {
-        return ConnectorStatusEnum::Occupied;
-    }
-    if (s == "Reserved") {
-        return ConnectorStatusEnum::Reserved;
-    }
-    if (s == "Unavailable") {
-        return ConnectorStatusEnum::Unavailable;
-    }
-    if (s == "Faulted") {
-        return ConnectorStatusEnum::Faulted;
+ConnectorStatusEnum string_to_connector_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Faulted") {
+            return ConnectorStatusEnum::Faulted;
+        }
+        break;
+    case 8:
+        switch (s[0]) {
+        case 'O':
+            if (s == "Occupied") {
+                return ConnectorStatusEnum::Occupied;
+            }
+            break;
+        case 'R':
+            if (s == "Reserved") {
+                return ConnectorStatusEnum::Reserved;
+            }
+            break;
+        }
+        break;
+    case 9:
+        if (s == "Available") {
+            return ConnectorStatusEnum::Available;
+        }
+        break;
+    case 11:
+        if (s == "Unavailable") {
+            return ConnectorStatusEnum::Unavailable;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ConnectorStatusEnum"};
@@ -3380,27 +4998,45 @@ std::ostream& operator<<(std::ostream& os, const ConnectorStatusEnum& connector_
 // from: TransactionEventRequest
 namespace conversions {
 std::string transaction_event_enum_to_string(TransactionEventEnum e) {
-    switch (e) {
-    case TransactionEventEnum::Ended:
-        return "Ended";
-    case TransactionEventEnum::Started:
-        return "Started";
-    case TransactionEventEnum::Updated:
-        return "Updated";
+    static constexpr std::string_view strings[] = {
+        "Ended",
+        "Started",
+        "Updated",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(TransactionEventEnum::Ended) == 0);
+    static_assert(static_cast<std::size_t>(TransactionEventEnum::Started) == 1);
+    static_assert(static_cast<std::size_t>(TransactionEventEnum::Updated) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "TransactionEventEnum"};
 }
 
-TransactionEventEnum string_to_transaction_event_enum(const std::string& s) {
-    if (s == "Ended") {
-        return TransactionEventEnum::Ended;
-    }
-    if (s == "Started") {
-        return TransactionEventEnum::Started;
-    }
-    if (s == "Updated") {
-        return TransactionEventEnum::Updated;
+TransactionEventEnum string_to_transaction_event_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        if (s == "Ended") {
+            return TransactionEventEnum::Ended;
+        }
+        break;
+    case 7:
+        switch (s[0]) {
+        case 'S':
+            if (s == "Started") {
+                return TransactionEventEnum::Started;
+            }
+            break;
+        case 'U':
+            if (s == "Updated") {
+                return TransactionEventEnum::Updated;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "TransactionEventEnum"};
@@ -3415,117 +5051,191 @@ std::ostream& operator<<(std::ostream& os, const TransactionEventEnum& transacti
 // from: TransactionEventRequest
 namespace conversions {
 std::string trigger_reason_enum_to_string(TriggerReasonEnum e) {
-    switch (e) {
-    case TriggerReasonEnum::Authorized:
-        return "Authorized";
-    case TriggerReasonEnum::CablePluggedIn:
-        return "CablePluggedIn";
-    case TriggerReasonEnum::ChargingRateChanged:
-        return "ChargingRateChanged";
-    case TriggerReasonEnum::ChargingStateChanged:
-        return "ChargingStateChanged";
-    case TriggerReasonEnum::Deauthorized:
-        return "Deauthorized";
-    case TriggerReasonEnum::EnergyLimitReached:
-        return "EnergyLimitReached";
-    case TriggerReasonEnum::EVCommunicationLost:
-        return "EVCommunicationLost";
-    case TriggerReasonEnum::EVConnectTimeout:
-        return "EVConnectTimeout";
-    case TriggerReasonEnum::MeterValueClock:
-        return "MeterValueClock";
-    case TriggerReasonEnum::MeterValuePeriodic:
-        return "MeterValuePeriodic";
-    case TriggerReasonEnum::TimeLimitReached:
-        return "TimeLimitReached";
-    case TriggerReasonEnum::Trigger:
-        return "Trigger";
-    case TriggerReasonEnum::UnlockCommand:
-        return "UnlockCommand";
-    case TriggerReasonEnum::StopAuthorized:
-        return "StopAuthorized";
-    case TriggerReasonEnum::EVDeparted:
-        return "EVDeparted";
-    case TriggerReasonEnum::EVDetected:
-        return "EVDetected";
-    case TriggerReasonEnum::RemoteStop:
-        return "RemoteStop";
-    case TriggerReasonEnum::RemoteStart:
-        return "RemoteStart";
-    case TriggerReasonEnum::AbnormalCondition:
-        return "AbnormalCondition";
-    case TriggerReasonEnum::SignedDataReceived:
-        return "SignedDataReceived";
-    case TriggerReasonEnum::ResetCommand:
-        return "ResetCommand";
+    static constexpr std::string_view strings[] = {
+        "Authorized",
+        "CablePluggedIn",
+        "ChargingRateChanged",
+        "ChargingStateChanged",
+        "Deauthorized",
+        "EnergyLimitReached",
+        "EVCommunicationLost",
+        "EVConnectTimeout",
+        "MeterValueClock",
+        "MeterValuePeriodic",
+        "TimeLimitReached",
+        "Trigger",
+        "UnlockCommand",
+        "StopAuthorized",
+        "EVDeparted",
+        "EVDetected",
+        "RemoteStop",
+        "RemoteStart",
+        "AbnormalCondition",
+        "SignedDataReceived",
+        "ResetCommand",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::Authorized) == 0);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::CablePluggedIn) == 1);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::ChargingRateChanged) == 2);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::ChargingStateChanged) == 3);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::Deauthorized) == 4);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::EnergyLimitReached) == 5);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::EVCommunicationLost) == 6);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::EVConnectTimeout) == 7);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::MeterValueClock) == 8);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::MeterValuePeriodic) == 9);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::TimeLimitReached) == 10);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::Trigger) == 11);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::UnlockCommand) == 12);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::StopAuthorized) == 13);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::EVDeparted) == 14);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::EVDetected) == 15);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::RemoteStop) == 16);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::RemoteStart) == 17);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::AbnormalCondition) == 18);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::SignedDataReceived) == 19);
+    static_assert(static_cast<std::size_t>(TriggerReasonEnum::ResetCommand) == 20);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "TriggerReasonEnum"};
 }
 
-TriggerReasonEnum string_to_trigger_reason_enum(const std::string& s) {
-    if (s == "Authorized") {
-        return TriggerReasonEnum::Authorized;
-    }
-    if (s == "CablePluggedIn") {
-        return TriggerReasonEnum::CablePluggedIn;
-    }
-    if (s == "ChargingRateChanged") {
-        return TriggerReasonEnum::ChargingRateChanged;
-    }
-    if (s == "ChargingStateChanged") {
-        return TriggerReasonEnum::ChargingStateChanged;
-    }
-    if (s == "Deauthorized") {
-        return TriggerReasonEnum::Deauthorized;
-    }
-    if (s == "EnergyLimitReached") {
-        return TriggerReasonEnum::EnergyLimitReached;
-    }
-    if (s == "EVCommunicationLost") {
-        return TriggerReasonEnum::EVCommunicationLost;
-    }
-    if (s == "EVConnectTimeout") {
-        return TriggerReasonEnum::EVConnectTimeout;
-    }
-    if (s == "MeterValueClock") {
-        return TriggerReasonEnum::MeterValueClock;
-    }
-    if (s == "MeterValuePeriodic") {
-        return TriggerReasonEnum::MeterValuePeriodic;
-    }
-    if (s == "TimeLimitReached") {
-        return TriggerReasonEnum::TimeLimitReached;
-    }
-    if (s == "Trigger") {
-        return TriggerReasonEnum::Trigger;
-    }
-    if (s == "UnlockCommand") {
-        return TriggerReasonEnum::UnlockCommand;
-    }
-    if (s == "StopAuthorized") {
-        return TriggerReasonEnum::StopAuthorized;
-    }
-    if (s == "EVDeparted") {
-        return TriggerReasonEnum::EVDeparted;
-    }
-    if (s == "EVDetected") {
-        return TriggerReasonEnum::EVDetected;
-    }
-    if (s == "RemoteStop") {
-        return TriggerReasonEnum::RemoteStop;
-    }
-    if (s == "RemoteStart") {
-        return TriggerReasonEnum::RemoteStart;
-    }
-    if (s == "AbnormalCondition") {
-        return TriggerReasonEnum::AbnormalCondition;
-    }
-    if (s == "SignedDataReceived") {
-        return TriggerReasonEnum::SignedDataReceived;
-    }
-    if (s == "ResetCommand") {
-        return TriggerReasonEnum::ResetCommand;
+TriggerReasonEnum string_to_trigger_reason_enum(std::string_view s) {
+    switch (s.size()) {
+    case 7:
+        if (s == "Trigger") {
+            return TriggerReasonEnum::Trigger;
+        }
+        break;
+    case 10:
+        switch (s[6]) {
+        case 'i':
+            if (s == "Authorized") {
+                return TriggerReasonEnum::Authorized;
+            }
+            break;
+        case 'r':
+            if (s == "EVDeparted") {
+                return TriggerReasonEnum::EVDeparted;
+            }
+            break;
+        case 'c':
+            if (s == "EVDetected") {
+                return TriggerReasonEnum::EVDetected;
+            }
+            break;
+        case 'S':
+            if (s == "RemoteStop") {
+                return TriggerReasonEnum::RemoteStop;
+            }
+            break;
+        }
+        break;
+    case 11:
+        if (s == "RemoteStart") {
+            return TriggerReasonEnum::RemoteStart;
+        }
+        break;
+    case 12:
+        switch (s[0]) {
+        case 'D':
+            if (s == "Deauthorized") {
+                return TriggerReasonEnum::Deauthorized;
+            }
+            break;
+        case 'R':
+            if (s == "ResetCommand") {
+                return TriggerReasonEnum::ResetCommand;
+            }
+            break;
+        }
+        break;
+    case 13:
+        if (s == "UnlockCommand") {
+            return TriggerReasonEnum::UnlockCommand;
+        }
+        break;
+    case 14:
+        switch (s[0]) {
+        case 'C':
+            if (s == "CablePluggedIn") {
+                return TriggerReasonEnum::CablePluggedIn;
+            }
+            break;
+        case 'S':
+            if (s == "StopAuthorized") {
+                return TriggerReasonEnum::StopAuthorized;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "MeterValueClock") {
+            return TriggerReasonEnum::MeterValueClock;
+        }
+        break;
+    case 16:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EVConnectTimeout") {
+                return TriggerReasonEnum::EVConnectTimeout;
+            }
+            break;
+        case 'T':
+            if (s == "TimeLimitReached") {
+                return TriggerReasonEnum::TimeLimitReached;
+            }
+            break;
+        }
+        break;
+    case 17:
+        if (s == "AbnormalCondition") {
+            return TriggerReasonEnum::AbnormalCondition;
+        }
+        break;
+    case 18:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EnergyLimitReached") {
+                return TriggerReasonEnum::EnergyLimitReached;
+            }
+            break;
+        case 'M':
+            if (s == "MeterValuePeriodic") {
+                return TriggerReasonEnum::MeterValuePeriodic;
+            }
+            break;
+        case 'S':
+            if (s == "SignedDataReceived") {
+                return TriggerReasonEnum::SignedDataReceived;
+            }
+            break;
+        }
+        break;
+    case 19:
+        switch (s[0]) {
+        case 'C':
+            if (s == "ChargingRateChanged") {
+                return TriggerReasonEnum::ChargingRateChanged;
+            }
+            break;
+        case 'E':
+            if (s == "EVCommunicationLost") {
+                return TriggerReasonEnum::EVCommunicationLost;
+            }
+            break;
+        }
+        break;
+    case 20:
+        if (s == "ChargingStateChanged") {
+            return TriggerReasonEnum::ChargingStateChanged;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "TriggerReasonEnum"};
@@ -3540,37 +5250,59 @@ std::ostream& operator<<(std::ostream& os, const TriggerReasonEnum& trigger_reas
 // from: TransactionEventRequest
 namespace conversions {
 std::string charging_state_enum_to_string(ChargingStateEnum e) {
-    switch (e) {
-    case ChargingStateEnum::Charging:
-        return "Charging";
-    case ChargingStateEnum::EVConnected:
-        return "EVConnected";
-    case ChargingStateEnum::SuspendedEV:
-        return "SuspendedEV";
-    case ChargingStateEnum::SuspendedEVSE:
-        return "SuspendedEVSE";
-    case ChargingStateEnum::Idle:
-        return "Idle";
+    static constexpr std::string_view strings[] = {
+        "Charging",
+        "EVConnected",
+        "SuspendedEV",
+        "SuspendedEVSE",
+        "Idle",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ChargingStateEnum::Charging) == 0);
+    static_assert(static_cast<std::size_t>(ChargingStateEnum::EVConnected) == 1);
+    static_assert(static_cast<std::size_t>(ChargingStateEnum::SuspendedEV) == 2);
+    static_assert(static_cast<std::size_t>(ChargingStateEnum::SuspendedEVSE) == 3);
+    static_assert(static_cast<std::size_t>(ChargingStateEnum::Idle) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ChargingStateEnum"};
 }
 
-ChargingStateEnum string_to_charging_state_enum(const std::string& s) {
-    if (s == "Charging") {
-        return ChargingStateEnum::Charging;
-    }
-    if (s == "EVConnected") {
-        return ChargingStateEnum::EVConnected;
-    }
-    if (s == "SuspendedEV") {
-        return ChargingStateEnum::SuspendedEV;
-    }
-    if (s == "SuspendedEVSE") {
-        return ChargingStateEnum::SuspendedEVSE;
-    }
-    if (s == "Idle") {
-        return ChargingStateEnum::Idle;
+ChargingStateEnum string_to_charging_state_enum(std::string_view s) {
+    switch (s.size()) {
+    case 4:
+        if (s == "Idle") {
+            return ChargingStateEnum::Idle;
+        }
+        break;
+    case 8:
+        if (s == "Charging") {
+            return ChargingStateEnum::Charging;
+        }
+        break;
+    case 11:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EVConnected") {
+                return ChargingStateEnum::EVConnected;
+            }
+            break;
+        case 'S':
+            if (s == "SuspendedEV") {
+                return ChargingStateEnum::SuspendedEV;
+            }
+            break;
+        }
+        break;
+    case 13:
+        if (s == "SuspendedEVSE") {
+            return ChargingStateEnum::SuspendedEVSE;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ChargingStateEnum"};
@@ -3585,107 +5317,177 @@ std::ostream& operator<<(std::ostream& os, const ChargingStateEnum& charging_sta
 // from: TransactionEventRequest
 namespace conversions {
 std::string reason_enum_to_string(ReasonEnum e) {
-    switch (e) {
-    case ReasonEnum::DeAuthorized:
-        return "DeAuthorized";
-    case ReasonEnum::EmergencyStop:
-        return "EmergencyStop";
-    case ReasonEnum::EnergyLimitReached:
-        return "EnergyLimitReached";
-    case ReasonEnum::EVDisconnected:
-        return "EVDisconnected";
-    case ReasonEnum::GroundFault:
-        return "GroundFault";
-    case ReasonEnum::ImmediateReset:
-        return "ImmediateReset";
-    case ReasonEnum::Local:
-        return "Local";
-    case ReasonEnum::LocalOutOfCredit:
-        return "LocalOutOfCredit";
-    case ReasonEnum::MasterPass:
-        return "MasterPass";
-    case ReasonEnum::Other:
-        return "Other";
-    case ReasonEnum::OvercurrentFault:
-        return "OvercurrentFault";
-    case ReasonEnum::PowerLoss:
-        return "PowerLoss";
-    case ReasonEnum::PowerQuality:
-        return "PowerQuality";
-    case ReasonEnum::Reboot:
-        return "Reboot";
-    case ReasonEnum::Remote:
-        return "Remote";
-    case ReasonEnum::SOCLimitReached:
-        return "SOCLimitReached";
-    case ReasonEnum::StoppedByEV:
-        return "StoppedByEV";
-    case ReasonEnum::TimeLimitReached:
-        return "TimeLimitReached";
-    case ReasonEnum::Timeout:
-        return "Timeout";
+    static constexpr std::string_view strings[] = {
+        "DeAuthorized",
+        "EmergencyStop",
+        "EnergyLimitReached",
+        "EVDisconnected",
+        "GroundFault",
+        "ImmediateReset",
+        "Local",
+        "LocalOutOfCredit",
+        "MasterPass",
+        "Other",
+        "OvercurrentFault",
+        "PowerLoss",
+        "PowerQuality",
+        "Reboot",
+        "Remote",
+        "SOCLimitReached",
+        "StoppedByEV",
+        "TimeLimitReached",
+        "Timeout",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(ReasonEnum::DeAuthorized) == 0);
+    static_assert(static_cast<std::size_t>(ReasonEnum::EmergencyStop) == 1);
+    static_assert(static_cast<std::size_t>(ReasonEnum::EnergyLimitReached) == 2);
+    static_assert(static_cast<std::size_t>(ReasonEnum::EVDisconnected) == 3);
+    static_assert(static_cast<std::size_t>(ReasonEnum::GroundFault) == 4);
+    static_assert(static_cast<std::size_t>(ReasonEnum::ImmediateReset) == 5);
+    static_assert(static_cast<std::size_t>(ReasonEnum::Local) == 6);
+    static_assert(static_cast<std::size_t>(ReasonEnum::LocalOutOfCredit) == 7);
+    static_assert(static_cast<std::size_t>(ReasonEnum::MasterPass) == 8);
+    static_assert(static_cast<std::size_t>(ReasonEnum::Other) == 9);
+    static_assert(static_cast<std::size_t>(ReasonEnum::OvercurrentFault) == 10);
+    static_assert(static_cast<std::size_t>(ReasonEnum::PowerLoss) == 11);
+    static_assert(static_cast<std::size_t>(ReasonEnum::PowerQuality) == 12);
+    static_assert(static_cast<std::size_t>(ReasonEnum::Reboot) == 13);
+    static_assert(static_cast<std::size_t>(ReasonEnum::Remote) == 14);
+    static_assert(static_cast<std::size_t>(ReasonEnum::SOCLimitReached) == 15);
+    static_assert(static_cast<std::size_t>(ReasonEnum::StoppedByEV) == 16);
+    static_assert(static_cast<std::size_t>(ReasonEnum::TimeLimitReached) == 17);
+    static_assert(static_cast<std::size_t>(ReasonEnum::Timeout) == 18);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "ReasonEnum"};
 }
 
-ReasonEnum string_to_reason_enum(const std::string& s) {
-    if (s == "DeAuthorized") {
-        return ReasonEnum::DeAuthorized;
-    }
-    if (s == "EmergencyStop") {
-        return ReasonEnum::EmergencyStop;
-    }
-    if (s == "EnergyLimitReached") {
-        return ReasonEnum::EnergyLimitReached;
-    }
-    if (s == "EVDisconnected") {
-        return ReasonEnum::EVDisconnected;
-    }
-    if (s == "GroundFault") {
-        return ReasonEnum::GroundFault;
-    }
-    if (s == "ImmediateReset") {
-        return ReasonEnum::ImmediateReset;
-    }
-    if (s == "Local") {
-        return ReasonEnum::Local;
-    }
-    if (s == "LocalOutOfCredit") {
-        return ReasonEnum::LocalOutOfCredit;
-    }
-    if (s == "MasterPass") {
-        return ReasonEnum::MasterPass;
-    }
-    if (s == "Other") {
-        return ReasonEnum::Other;
-    }
-    if (s == "OvercurrentFault") {
-        return ReasonEnum::OvercurrentFault;
-    }
-    if (s == "PowerLoss") {
-        return ReasonEnum::PowerLoss;
-    }
-    if (s == "PowerQuality") {
-        return ReasonEnum::PowerQuality;
-    }
-    if (s == "Reboot") {
-        return ReasonEnum::Reboot;
-    }
-    if (s == "Remote") {
-        return ReasonEnum::Remote;
-    }
-    if (s == "SOCLimitReached") {
-        return ReasonEnum::SOCLimitReached;
-    }
-    if (s == "StoppedByEV") {
-        return ReasonEnum::StoppedByEV;
-    }
-    if (s == "TimeLimitReached") {
-        return ReasonEnum::TimeLimitReached;
-    }
-    if (s == "Timeout") {
-        return ReasonEnum::Timeout;
+ReasonEnum string_to_reason_enum(std::string_view s) {
+    switch (s.size()) {
+    case 5:
+        switch (s[0]) {
+        case 'L':
+            if (s == "Local") {
+                return ReasonEnum::Local;
+            }
+            break;
+        case 'O':
+            if (s == "Other") {
+                return ReasonEnum::Other;
+            }
+            break;
+        }
+        break;
+    case 6:
+        switch (s[2]) {
+        case 'b':
+            if (s == "Reboot") {
+                return ReasonEnum::Reboot;
+            }
+            break;
+        case 'm':
+            if (s == "Remote") {
+                return ReasonEnum::Remote;
+            }
+            break;
+        }
+        break;
+    case 7:
+        if (s == "Timeout") {
+            return ReasonEnum::Timeout;
+        }
+        break;
+    case 9:
+        if (s == "PowerLoss") {
+            return ReasonEnum::PowerLoss;
+        }
+        break;
+    case 10:
+        if (s == "MasterPass") {
+            return ReasonEnum::MasterPass;
+        }
+        break;
+    case 11:
+        switch (s[0]) {
+        case 'G':
+            if (s == "GroundFault") {
+                return ReasonEnum::GroundFault;
+            }
+            break;
+        case 'S':
+            if (s == "StoppedByEV") {
+                return ReasonEnum::StoppedByEV;
+            }
+            break;
+        }
+        break;
+    case 12:
+        switch (s[0]) {
+        case 'D':
+            if (s == "DeAuthorized") {
+                return ReasonEnum::DeAuthorized;
+            }
+            break;
+        case 'P':
+            if (s == "PowerQuality") {
+                return ReasonEnum::PowerQuality;
+            }
+            break;
+        }
+        break;
+    case 13:
+        if (s == "EmergencyStop") {
+            return ReasonEnum::EmergencyStop;
+        }
+        break;
+    case 14:
+        switch (s[0]) {
+        case 'E':
+            if (s == "EVDisconnected") {
+                return ReasonEnum::EVDisconnected;
+            }
+            break;
+        case 'I':
+            if (s == "ImmediateReset") {
+                return ReasonEnum::ImmediateReset;
+            }
+            break;
+        }
+        break;
+    case 15:
+        if (s == "SOCLimitReached") {
+            return ReasonEnum::SOCLimitReached;
+        }
+        break;
+    case 16:
+        switch (s[0]) {
+        case 'L':
+            if (s == "LocalOutOfCredit") {
+                return ReasonEnum::LocalOutOfCredit;
+            }
+            break;
+        case 'O':
+            if (s == "OvercurrentFault") {
+                return ReasonEnum::OvercurrentFault;
+            }
+            break;
+        case 'T':
+            if (s == "TimeLimitReached") {
+                return ReasonEnum::TimeLimitReached;
+            }
+            break;
+        }
+        break;
+    case 18:
+        if (s == "EnergyLimitReached") {
+            return ReasonEnum::EnergyLimitReached;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "ReasonEnum"};
@@ -3700,67 +5502,105 @@ std::ostream& operator<<(std::ostream& os, const ReasonEnum& reason_enum) {
 // from: TriggerMessageRequest
 namespace conversions {
 std::string message_trigger_enum_to_string(MessageTriggerEnum e) {
-    switch (e) {
-    case MessageTriggerEnum::BootNotification:
-        return "BootNotification";
-    case MessageTriggerEnum::LogStatusNotification:
-        return "LogStatusNotification";
-    case MessageTriggerEnum::FirmwareStatusNotification:
-        return "FirmwareStatusNotification";
-    case MessageTriggerEnum::Heartbeat:
-        return "Heartbeat";
-    case MessageTriggerEnum::MeterValues:
-        return "MeterValues";
-    case MessageTriggerEnum::SignChargingStationCertificate:
-        return "SignChargingStationCertificate";
-    case MessageTriggerEnum::SignV2GCertificate:
-        return "SignV2GCertificate";
-    case MessageTriggerEnum::StatusNotification:
-        return "StatusNotification";
-    case MessageTriggerEnum::TransactionEvent:
-        return "TransactionEvent";
-    case MessageTriggerEnum::SignCombinedCertificate:
-        return "SignCombinedCertificate";
-    case MessageTriggerEnum::PublishFirmwareStatusNotification:
-        return "PublishFirmwareStatusNotification";
+    static constexpr std::string_view strings[] = {
+        "BootNotification",
+        "LogStatusNotification",
+        "FirmwareStatusNotification",
+        "Heartbeat",
+        "MeterValues",
+        "SignChargingStationCertificate",
+        "SignV2GCertificate",
+        "StatusNotification",
+        "TransactionEvent",
+        "SignCombinedCertificate",
+        "PublishFirmwareStatusNotification",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::BootNotification) == 0);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::LogStatusNotification) == 1);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::FirmwareStatusNotification) == 2);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::Heartbeat) == 3);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::MeterValues) == 4);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::SignChargingStationCertificate) == 5);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::SignV2GCertificate) == 6);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::StatusNotification) == 7);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::TransactionEvent) == 8);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::SignCombinedCertificate) == 9);
+    static_assert(static_cast<std::size_t>(MessageTriggerEnum::PublishFirmwareStatusNotification) == 10);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "MessageTriggerEnum"};
 }
 
-MessageTriggerEnum string_to_message_trigger_enum(const std::string& s) {
-    if (s == "BootNotification") {
-        return MessageTriggerEnum::BootNotification;
-    }
-    if (s == "LogStatusNotification") {
-        return MessageTriggerEnum::LogStatusNotification;
-    }
-    if (s == "FirmwareStatusNotification") {
-        return MessageTriggerEnum::FirmwareStatusNotification;
-    }
-    if (s == "Heartbeat") {
-        return MessageTriggerEnum::Heartbeat;
-    }
-    if (s == "MeterValues") {
-        return MessageTriggerEnum::MeterValues;
-    }
-    if (s == "SignChargingStationCertificate") {
-        return MessageTriggerEnum::SignChargingStationCertificate;
-    }
-    if (s == "SignV2GCertificate") {
-        return MessageTriggerEnum::SignV2GCertificate;
-    }
-    if (s == "StatusNotification") {
-        return MessageTriggerEnum::StatusNotification;
-    }
-    if (s == "TransactionEvent") {
-        return MessageTriggerEnum::TransactionEvent;
-    }
-    if (s == "SignCombinedCertificate") {
-        return MessageTriggerEnum::SignCombinedCertificate;
-    }
-    if (s == "PublishFirmwareStatusNotification") {
-        return MessageTriggerEnum::PublishFirmwareStatusNotification;
+MessageTriggerEnum string_to_message_trigger_enum(std::string_view s) {
+    switch (s.size()) {
+    case 9:
+        if (s == "Heartbeat") {
+            return MessageTriggerEnum::Heartbeat;
+        }
+        break;
+    case 11:
+        if (s == "MeterValues") {
+            return MessageTriggerEnum::MeterValues;
+        }
+        break;
+    case 16:
+        switch (s[0]) {
+        case 'B':
+            if (s == "BootNotification") {
+                return MessageTriggerEnum::BootNotification;
+            }
+            break;
+        case 'T':
+            if (s == "TransactionEvent") {
+                return MessageTriggerEnum::TransactionEvent;
+            }
+            break;
+        }
+        break;
+    case 18:
+        switch (s[1]) {
+        case 'i':
+            if (s == "SignV2GCertificate") {
+                return MessageTriggerEnum::SignV2GCertificate;
+            }
+            break;
+        case 't':
+            if (s == "StatusNotification") {
+                return MessageTriggerEnum::StatusNotification;
+            }
+            break;
+        }
+        break;
+    case 21:
+        if (s == "LogStatusNotification") {
+            return MessageTriggerEnum::LogStatusNotification;
+        }
+        break;
+    case 23:
+        if (s == "SignCombinedCertificate") {
+            return MessageTriggerEnum::SignCombinedCertificate;
+        }
+        break;
+    case 26:
+        if (s == "FirmwareStatusNotification") {
+            return MessageTriggerEnum::FirmwareStatusNotification;
+        }
+        break;
+    case 30:
+        if (s == "SignChargingStationCertificate") {
+            return MessageTriggerEnum::SignChargingStationCertificate;
+        }
+        break;
+    case 33:
+        if (s == "PublishFirmwareStatusNotification") {
+            return MessageTriggerEnum::PublishFirmwareStatusNotification;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "MessageTriggerEnum"};
@@ -3775,27 +5615,45 @@ std::ostream& operator<<(std::ostream& os, const MessageTriggerEnum& message_tri
 // from: TriggerMessageResponse
 namespace conversions {
 std::string trigger_message_status_enum_to_string(TriggerMessageStatusEnum e) {
-    switch (e) {
-    case TriggerMessageStatusEnum::Accepted:
-        return "Accepted";
-    case TriggerMessageStatusEnum::Rejected:
-        return "Rejected";
-    case TriggerMessageStatusEnum::NotImplemented:
-        return "NotImplemented";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "NotImplemented",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(TriggerMessageStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(TriggerMessageStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(TriggerMessageStatusEnum::NotImplemented) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "TriggerMessageStatusEnum"};
 }
 
-TriggerMessageStatusEnum string_to_trigger_message_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return TriggerMessageStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return TriggerMessageStatusEnum::Rejected;
-    }
-    if (s == "NotImplemented") {
-        return TriggerMessageStatusEnum::NotImplemented;
+TriggerMessageStatusEnum string_to_trigger_message_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return TriggerMessageStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return TriggerMessageStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 14:
+        if (s == "NotImplemented") {
+            return TriggerMessageStatusEnum::NotImplemented;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "TriggerMessageStatusEnum"};
@@ -3810,32 +5668,48 @@ std::ostream& operator<<(std::ostream& os, const TriggerMessageStatusEnum& trigg
 // from: UnlockConnectorResponse
 namespace conversions {
 std::string unlock_status_enum_to_string(UnlockStatusEnum e) {
-    switch (e) {
-    case UnlockStatusEnum::Unlocked:
-        return "Unlocked";
-    case UnlockStatusEnum::UnlockFailed:
-        return "UnlockFailed";
-    case UnlockStatusEnum::OngoingAuthorizedTransaction:
-        return "OngoingAuthorizedTransaction";
-    case UnlockStatusEnum::UnknownConnector:
-        return "UnknownConnector";
+    static constexpr std::string_view strings[] = {
+        "Unlocked",
+        "UnlockFailed",
+        "OngoingAuthorizedTransaction",
+        "UnknownConnector",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UnlockStatusEnum::Unlocked) == 0);
+    static_assert(static_cast<std::size_t>(UnlockStatusEnum::UnlockFailed) == 1);
+    static_assert(static_cast<std::size_t>(UnlockStatusEnum::OngoingAuthorizedTransaction) == 2);
+    static_assert(static_cast<std::size_t>(UnlockStatusEnum::UnknownConnector) == 3);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UnlockStatusEnum"};
 }
 
-UnlockStatusEnum string_to_unlock_status_enum(const std::string& s) {
-    if (s == "Unlocked") {
-        return UnlockStatusEnum::Unlocked;
-    }
-    if (s == "UnlockFailed") {
-        return UnlockStatusEnum::UnlockFailed;
-    }
-    if (s == "OngoingAuthorizedTransaction") {
-        return UnlockStatusEnum::OngoingAuthorizedTransaction;
-    }
-    if (s == "UnknownConnector") {
-        return UnlockStatusEnum::UnknownConnector;
+UnlockStatusEnum string_to_unlock_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        if (s == "Unlocked") {
+            return UnlockStatusEnum::Unlocked;
+        }
+        break;
+    case 12:
+        if (s == "UnlockFailed") {
+            return UnlockStatusEnum::UnlockFailed;
+        }
+        break;
+    case 16:
+        if (s == "UnknownConnector") {
+            return UnlockStatusEnum::UnknownConnector;
+        }
+        break;
+    case 28:
+        if (s == "OngoingAuthorizedTransaction") {
+            return UnlockStatusEnum::OngoingAuthorizedTransaction;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UnlockStatusEnum"};
@@ -3850,27 +5724,41 @@ std::ostream& operator<<(std::ostream& os, const UnlockStatusEnum& unlock_status
 // from: UnpublishFirmwareResponse
 namespace conversions {
 std::string unpublish_firmware_status_enum_to_string(UnpublishFirmwareStatusEnum e) {
-    switch (e) {
-    case UnpublishFirmwareStatusEnum::DownloadOngoing:
-        return "DownloadOngoing";
-    case UnpublishFirmwareStatusEnum::NoFirmware:
-        return "NoFirmware";
-    case UnpublishFirmwareStatusEnum::Unpublished:
-        return "Unpublished";
+    static constexpr std::string_view strings[] = {
+        "DownloadOngoing",
+        "NoFirmware",
+        "Unpublished",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UnpublishFirmwareStatusEnum::DownloadOngoing) == 0);
+    static_assert(static_cast<std::size_t>(UnpublishFirmwareStatusEnum::NoFirmware) == 1);
+    static_assert(static_cast<std::size_t>(UnpublishFirmwareStatusEnum::Unpublished) == 2);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UnpublishFirmwareStatusEnum"};
 }
 
-UnpublishFirmwareStatusEnum string_to_unpublish_firmware_status_enum(const std::string& s) {
-    if (s == "DownloadOngoing") {
-        return UnpublishFirmwareStatusEnum::DownloadOngoing;
-    }
-    if (s == "NoFirmware") {
-        return UnpublishFirmwareStatusEnum::NoFirmware;
-    }
-    if (s == "Unpublished") {
-        return UnpublishFirmwareStatusEnum::Unpublished;
+UnpublishFirmwareStatusEnum string_to_unpublish_firmware_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 10:
+        if (s == "NoFirmware") {
+            return UnpublishFirmwareStatusEnum::NoFirmware;
+        }
+        break;
+    case 11:
+        if (s == "Unpublished") {
+            return UnpublishFirmwareStatusEnum::Unpublished;
+        }
+        break;
+    case 15:
+        if (s == "DownloadOngoing") {
+            return UnpublishFirmwareStatusEnum::DownloadOngoing;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UnpublishFirmwareStatusEnum"};
@@ -3885,37 +5773,63 @@ std::ostream& operator<<(std::ostream& os, const UnpublishFirmwareStatusEnum& un
 // from: UpdateFirmwareResponse
 namespace conversions {
 std::string update_firmware_status_enum_to_string(UpdateFirmwareStatusEnum e) {
-    switch (e) {
-    case UpdateFirmwareStatusEnum::Accepted:
-        return "Accepted";
-    case UpdateFirmwareStatusEnum::Rejected:
-        return "Rejected";
-    case UpdateFirmwareStatusEnum::AcceptedCanceled:
-        return "AcceptedCanceled";
-    case UpdateFirmwareStatusEnum::InvalidCertificate:
-        return "InvalidCertificate";
-    case UpdateFirmwareStatusEnum::RevokedCertificate:
-        return "RevokedCertificate";
+    static constexpr std::string_view strings[] = {
+        "Accepted",
+        "Rejected",
+        "AcceptedCanceled",
+        "InvalidCertificate",
+        "RevokedCertificate",
+    };
+    // the strings are indexed by the value of the enumerators
+    static_assert(static_cast<std::size_t>(UpdateFirmwareStatusEnum::Accepted) == 0);
+    static_assert(static_cast<std::size_t>(UpdateFirmwareStatusEnum::Rejected) == 1);
+    static_assert(static_cast<std::size_t>(UpdateFirmwareStatusEnum::AcceptedCanceled) == 2);
+    static_assert(static_cast<std::size_t>(UpdateFirmwareStatusEnum::InvalidCertificate) == 3);
+    static_assert(static_cast<std::size_t>(UpdateFirmwareStatusEnum::RevokedCertificate) == 4);
+
+    const auto index = static_cast<std::size_t>(e);
+    if (index < std::size(strings)) {
+        return std::string{strings[index]};
     }
 
     throw EnumToStringException{e, "UpdateFirmwareStatusEnum"};
 }
 
-UpdateFirmwareStatusEnum string_to_update_firmware_status_enum(const std::string& s) {
-    if (s == "Accepted") {
-        return UpdateFirmwareStatusEnum::Accepted;
-    }
-    if (s == "Rejected") {
-        return UpdateFirmwareStatusEnum::Rejected;
-    }
-    if (s == "AcceptedCanceled") {
-        return UpdateFirmwareStatusEnum::AcceptedCanceled;
-    }
-    if (s == "InvalidCertificate") {
-        return UpdateFirmwareStatusEnum::InvalidCertificate;
-    }
-    if (s == "RevokedCertificate") {
-        return UpdateFirmwareStatusEnum::RevokedCertificate;
+UpdateFirmwareStatusEnum string_to_update_firmware_status_enum(std::string_view s) {
+    switch (s.size()) {
+    case 8:
+        switch (s[0]) {
+        case 'A':
+            if (s == "Accepted") {
+                return UpdateFirmwareStatusEnum::Accepted;
+            }
+            break;
+        case 'R':
+            if (s == "Rejected") {
+                return UpdateFirmwareStatusEnum::Rejected;
+            }
+            break;
+        }
+        break;
+    case 16:
+        if (s == "AcceptedCanceled") {
+            return UpdateFirmwareStatusEnum::AcceptedCanceled;
+        }
+        break;
+    case 18:
+        switch (s[0]) {
+        case 'I':
+            if (s == "InvalidCertificate") {
+                return UpdateFirmwareStatusEnum::InvalidCertificate;
+            }
+            break;
+        case 'R':
+            if (s == "RevokedCertificate") {
+                return UpdateFirmwareStatusEnum::RevokedCertificate;
+            }
+            break;
+        }
+        break;
     }
 
     throw StringToEnumException{s, "UpdateFirmwareStatusEnum"};
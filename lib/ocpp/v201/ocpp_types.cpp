@@ -9,6 +9,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <ocpp/common/json_writer.hpp>
 #include <ocpp/common/types.hpp>
 #include <ocpp/v201/ocpp_enums.hpp>
 
@@ -28,6 +29,19 @@ void to_json(json& j, const AdditionalInfo& k) {
     }
 }
 
+/// \brief Writes the given AdditionalInfo \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const AdditionalInfo& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("additionalIdToken", k.additionalIdToken);
+    writer.member("type", k.type);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given AdditionalInfo \p k
 void from_json(const json& j, AdditionalInfo& k) {
     // the required parts of the message
@@ -66,11 +80,27 @@ void to_json(json& j, const IdToken& k) {
     }
 }
 
+/// \brief Writes the given IdToken \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const IdToken& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("idToken", k.idToken);
+    writer.member("type", conversions::id_token_enum_to_string(k.type));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.additionalInfo) {
+        writer.member("additionalInfo", k.additionalInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given IdToken \p k
 void from_json(const json& j, IdToken& k) {
     // the required parts of the message
     k.idToken = j.at("idToken");
-    k.type = conversions::string_to_id_token_enum(j.at("type"));
+    k.type = conversions::string_to_id_token_enum(j.at("type").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -109,10 +139,26 @@ void to_json(json& j, const OCSPRequestData& k) {
     }
 }
 
+/// \brief Writes the given OCSPRequestData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const OCSPRequestData& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("hashAlgorithm", conversions::hash_algorithm_enum_to_string(k.hashAlgorithm));
+    writer.member("issuerNameHash", k.issuerNameHash);
+    writer.member("issuerKeyHash", k.issuerKeyHash);
+    writer.member("serialNumber", k.serialNumber);
+    writer.member("responderURL", k.responderURL);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given OCSPRequestData \p k
 void from_json(const json& j, OCSPRequestData& k) {
     // the required parts of the message
-    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum(j.at("hashAlgorithm"));
+    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum(j.at("hashAlgorithm").get_ref<const std::string&>());
     k.issuerNameHash = j.at("issuerNameHash");
     k.issuerKeyHash = j.at("issuerKeyHash");
     k.serialNumber = j.at("serialNumber");
@@ -147,10 +193,26 @@ void to_json(json& j, const MessageContent& k) {
     }
 }
 
+/// \brief Writes the given MessageContent \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MessageContent& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("format", conversions::message_format_enum_to_string(k.format));
+    writer.member("content", k.content);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.language) {
+        writer.member("language", k.language.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given MessageContent \p k
 void from_json(const json& j, MessageContent& k) {
     // the required parts of the message
-    k.format = conversions::string_to_message_format_enum(j.at("format"));
+    k.format = conversions::string_to_message_format_enum(j.at("format").get_ref<const std::string&>());
     k.content = j.at("content");
 
     // the optional parts of the message
@@ -205,10 +267,43 @@ void to_json(json& j, const IdTokenInfo& k) {
     }
 }
 
+/// \brief Writes the given IdTokenInfo \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const IdTokenInfo& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::authorization_status_enum_to_string(k.status));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.cacheExpiryDateTime) {
+        writer.member("cacheExpiryDateTime", k.cacheExpiryDateTime.value().to_rfc3339());
+    }
+    if (k.chargingPriority) {
+        writer.member("chargingPriority", k.chargingPriority.value());
+    }
+    if (k.language1) {
+        writer.member("language1", k.language1.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    if (k.groupIdToken) {
+        writer.member("groupIdToken", k.groupIdToken.value());
+    }
+    if (k.language2) {
+        writer.member("language2", k.language2.value());
+    }
+    if (k.personalMessage) {
+        writer.member("personalMessage", k.personalMessage.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given IdTokenInfo \p k
 void from_json(const json& j, IdTokenInfo& k) {
     // the required parts of the message
-    k.status = conversions::string_to_authorization_status_enum(j.at("status"));
+    k.status = conversions::string_to_authorization_status_enum(j.at("status").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -265,6 +360,23 @@ void to_json(json& j, const Modem& k) {
     }
 }
 
+/// \brief Writes the given Modem \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Modem& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.iccid) {
+        writer.member("iccid", k.iccid.value());
+    }
+    if (k.imsi) {
+        writer.member("imsi", k.imsi.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given Modem \p k
 void from_json(const json& j, Modem& k) {
     // the required parts of the message
@@ -310,6 +422,28 @@ void to_json(json& j, const ChargingStation& k) {
     }
 }
 
+/// \brief Writes the given ChargingStation \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingStation& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("model", k.model);
+    writer.member("vendorName", k.vendorName);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.serialNumber) {
+        writer.member("serialNumber", k.serialNumber.value());
+    }
+    if (k.modem) {
+        writer.member("modem", k.modem.value());
+    }
+    if (k.firmwareVersion) {
+        writer.member("firmwareVersion", k.firmwareVersion.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ChargingStation \p k
 void from_json(const json& j, ChargingStation& k) {
     // the required parts of the message
@@ -353,6 +487,21 @@ void to_json(json& j, const StatusInfo& k) {
     }
 }
 
+/// \brief Writes the given StatusInfo \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const StatusInfo& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("reasonCode", k.reasonCode);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.additionalInfo) {
+        writer.member("additionalInfo", k.additionalInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given StatusInfo \p k
 void from_json(const json& j, StatusInfo& k) {
     // the required parts of the message
@@ -389,6 +538,21 @@ void to_json(json& j, const EVSE& k) {
     }
 }
 
+/// \brief Writes the given EVSE \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const EVSE& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.connectorId) {
+        writer.member("connectorId", k.connectorId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given EVSE \p k
 void from_json(const json& j, EVSE& k) {
     // the required parts of the message
@@ -430,6 +594,27 @@ void to_json(json& j, const ClearChargingProfile& k) {
     }
 }
 
+/// \brief Writes the given ClearChargingProfile \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearChargingProfile& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evseId) {
+        writer.member("evseId", k.evseId.value());
+    }
+    if (k.chargingProfilePurpose) {
+        writer.member("chargingProfilePurpose",
+                      conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.stackLevel) {
+        writer.member("stackLevel", k.stackLevel.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ClearChargingProfile \p k
 void from_json(const json& j, ClearChargingProfile& k) {
     // the required parts of the message
@@ -443,7 +628,8 @@ void from_json(const json& j, ClearChargingProfile& k) {
     }
     if (j.contains("chargingProfilePurpose")) {
         k.chargingProfilePurpose.emplace(
-            conversions::string_to_charging_profile_purpose_enum(j.at("chargingProfilePurpose")));
+            conversions::string_to_charging_profile_purpose_enum(
+                j.at("chargingProfilePurpose").get_ref<const std::string&>()));
     }
     if (j.contains("stackLevel")) {
         k.stackLevel.emplace(j.at("stackLevel"));
@@ -473,10 +659,26 @@ void to_json(json& j, const ClearMonitoringResult& k) {
     }
 }
 
+/// \brief Writes the given ClearMonitoringResult \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ClearMonitoringResult& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::clear_monitoring_status_enum_to_string(k.status));
+    writer.member("id", k.id);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ClearMonitoringResult \p k
 void from_json(const json& j, ClearMonitoringResult& k) {
     // the required parts of the message
-    k.status = conversions::string_to_clear_monitoring_status_enum(j.at("status"));
+    k.status = conversions::string_to_clear_monitoring_status_enum(j.at("status").get_ref<const std::string&>());
     k.id = j.at("id");
 
     // the optional parts of the message
@@ -510,10 +712,25 @@ void to_json(json& j, const CertificateHashDataType& k) {
     }
 }
 
+/// \brief Writes the given CertificateHashDataType \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CertificateHashDataType& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("hashAlgorithm", conversions::hash_algorithm_enum_to_string(k.hashAlgorithm));
+    writer.member("issuerNameHash", k.issuerNameHash);
+    writer.member("issuerKeyHash", k.issuerKeyHash);
+    writer.member("serialNumber", k.serialNumber);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataType \p k
 void from_json(const json& j, CertificateHashDataType& k) {
     // the required parts of the message
-    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum(j.at("hashAlgorithm"));
+    k.hashAlgorithm = conversions::string_to_hash_algorithm_enum(j.at("hashAlgorithm").get_ref<const std::string&>());
     k.issuerNameHash = j.at("issuerNameHash");
     k.issuerKeyHash = j.at("issuerKeyHash");
     k.serialNumber = j.at("serialNumber");
@@ -568,6 +785,35 @@ void to_json(json& j, const ChargingProfileCriterion& k) {
     }
 }
 
+/// \brief Writes the given ChargingProfileCriterion \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingProfileCriterion& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.chargingProfilePurpose) {
+        writer.member("chargingProfilePurpose",
+                      conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose.value()));
+    }
+    if (k.stackLevel) {
+        writer.member("stackLevel", k.stackLevel.value());
+    }
+    if (k.chargingProfileId) {
+        writer.member("chargingProfileId", k.chargingProfileId.value());
+    }
+    if (k.chargingLimitSource) {
+        writer.key("chargingLimitSource");
+        writer.start_array();
+        for (const auto& val : k.chargingLimitSource.value()) {
+            writer.value(conversions::charging_limit_source_enum_to_string(val));
+        }
+        writer.end_array();
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ChargingProfileCriterion \p k
 void from_json(const json& j, ChargingProfileCriterion& k) {
     // the required parts of the message
@@ -578,7 +824,8 @@ void from_json(const json& j, ChargingProfileCriterion& k) {
     }
     if (j.contains("chargingProfilePurpose")) {
         k.chargingProfilePurpose.emplace(
-            conversions::string_to_charging_profile_purpose_enum(j.at("chargingProfilePurpose")));
+            conversions::string_to_charging_profile_purpose_enum(
+                j.at("chargingProfilePurpose").get_ref<const std::string&>()));
     }
     if (j.contains("stackLevel")) {
         k.stackLevel.emplace(j.at("stackLevel"));
@@ -595,7 +842,7 @@ void from_json(const json& j, ChargingProfileCriterion& k) {
         json arr = j.at("chargingLimitSource");
         std::vector<ChargingLimitSourceEnum> vec;
         for (auto val : arr) {
-            vec.push_back(conversions::string_to_charging_limit_source_enum(val));
+            vec.push_back(conversions::string_to_charging_limit_source_enum(val.get_ref<const std::string&>()));
         }
         k.chargingLimitSource.emplace(vec);
     }
@@ -627,6 +874,25 @@ void to_json(json& j, const ChargingSchedulePeriod& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedulePeriod \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingSchedulePeriod& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("startPeriod", k.startPeriod);
+    writer.member("limit", k.limit);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.numberPhases) {
+        writer.member("numberPhases", k.numberPhases.value());
+    }
+    if (k.phaseToUse) {
+        writer.member("phaseToUse", k.phaseToUse.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ChargingSchedulePeriod \p k
 void from_json(const json& j, ChargingSchedulePeriod& k) {
     // the required parts of the message
@@ -668,6 +934,22 @@ void to_json(json& j, const CompositeSchedule& k) {
     }
 }
 
+/// \brief Writes the given CompositeSchedule \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CompositeSchedule& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("chargingSchedulePeriod", k.chargingSchedulePeriod);
+    writer.member("evseId", k.evseId);
+    writer.member("duration", k.duration);
+    writer.member("scheduleStart", k.scheduleStart.to_rfc3339());
+    writer.member("chargingRateUnit", conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given CompositeSchedule \p k
 void from_json(const json& j, CompositeSchedule& k) {
     // the required parts of the message
@@ -677,7 +959,8 @@ void from_json(const json& j, CompositeSchedule& k) {
     k.evseId = j.at("evseId");
     k.duration = j.at("duration");
     k.scheduleStart = ocpp::DateTime(std::string(j.at("scheduleStart")));
-    k.chargingRateUnit = conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit"));
+    k.chargingRateUnit =
+        conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -711,11 +994,28 @@ void to_json(json& j, const CertificateHashDataChain& k) {
     }
 }
 
+/// \brief Writes the given CertificateHashDataChain \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const CertificateHashDataChain& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("certificateHashData", k.certificateHashData);
+    writer.member("certificateType", conversions::get_certificate_id_use_enum_to_string(k.certificateType));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.childCertificateHashData) {
+        writer.member("childCertificateHashData", k.childCertificateHashData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given CertificateHashDataChain \p k
 void from_json(const json& j, CertificateHashDataChain& k) {
     // the required parts of the message
     k.certificateHashData = j.at("certificateHashData");
-    k.certificateType = conversions::string_to_get_certificate_id_use_enum(j.at("certificateType"));
+    k.certificateType =
+        conversions::string_to_get_certificate_id_use_enum(j.at("certificateType").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -756,6 +1056,24 @@ void to_json(json& j, const LogParameters& k) {
     }
 }
 
+/// \brief Writes the given LogParameters \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const LogParameters& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("remoteLocation", k.remoteLocation);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.oldestTimestamp) {
+        writer.member("oldestTimestamp", k.oldestTimestamp.value().to_rfc3339());
+    }
+    if (k.latestTimestamp) {
+        writer.member("latestTimestamp", k.latestTimestamp.value().to_rfc3339());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given LogParameters \p k
 void from_json(const json& j, LogParameters& k) {
     // the required parts of the message
@@ -798,6 +1116,24 @@ void to_json(json& j, const Component& k) {
     }
 }
 
+/// \brief Writes the given Component \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Component& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("name", k.name);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.evse) {
+        writer.member("evse", k.evse.value());
+    }
+    if (k.instance) {
+        writer.member("instance", k.instance.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given Component \p k
 void from_json(const json& j, Component& k) {
     // the required parts of the message
@@ -837,6 +1173,21 @@ void to_json(json& j, const Variable& k) {
     }
 }
 
+/// \brief Writes the given Variable \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Variable& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("name", k.name);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.instance) {
+        writer.member("instance", k.instance.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given Variable \p k
 void from_json(const json& j, Variable& k) {
     // the required parts of the message
@@ -873,6 +1224,21 @@ void to_json(json& j, const ComponentVariable& k) {
     }
 }
 
+/// \brief Writes the given ComponentVariable \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ComponentVariable& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("component", k.component);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.variable) {
+        writer.member("variable", k.variable.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ComponentVariable \p k
 void from_json(const json& j, ComponentVariable& k) {
     // the required parts of the message
@@ -910,6 +1276,22 @@ void to_json(json& j, const GetVariableData& k) {
     }
 }
 
+/// \brief Writes the given GetVariableData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetVariableData& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.attributeType) {
+        writer.member("attributeType", conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given GetVariableData \p k
 void from_json(const json& j, GetVariableData& k) {
     // the required parts of the message
@@ -921,7 +1303,8 @@ void from_json(const json& j, GetVariableData& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("attributeType")) {
-        k.attributeType.emplace(conversions::string_to_attribute_enum(j.at("attributeType")));
+        k.attributeType.emplace(
+            conversions::string_to_attribute_enum(j.at("attributeType").get_ref<const std::string&>()));
     }
 }
 
@@ -955,10 +1338,34 @@ void to_json(json& j, const GetVariableResult& k) {
     }
 }
 
+/// \brief Writes the given GetVariableResult \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const GetVariableResult& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("attributeStatus", conversions::get_variable_status_enum_to_string(k.attributeStatus));
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.attributeStatusInfo) {
+        writer.member("attributeStatusInfo", k.attributeStatusInfo.value());
+    }
+    if (k.attributeType) {
+        writer.member("attributeType", conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    if (k.attributeValue) {
+        writer.member("attributeValue", k.attributeValue.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given GetVariableResult \p k
 void from_json(const json& j, GetVariableResult& k) {
     // the required parts of the message
-    k.attributeStatus = conversions::string_to_get_variable_status_enum(j.at("attributeStatus"));
+    k.attributeStatus =
+        conversions::string_to_get_variable_status_enum(j.at("attributeStatus").get_ref<const std::string&>());
     k.component = j.at("component");
     k.variable = j.at("variable");
 
@@ -970,7 +1377,8 @@ void from_json(const json& j, GetVariableResult& k) {
         k.attributeStatusInfo.emplace(j.at("attributeStatusInfo"));
     }
     if (j.contains("attributeType")) {
-        k.attributeType.emplace(conversions::string_to_attribute_enum(j.at("attributeType")));
+        k.attributeType.emplace(
+            conversions::string_to_attribute_enum(j.at("attributeType").get_ref<const std::string&>()));
     }
     if (j.contains("attributeValue")) {
         k.attributeValue.emplace(j.at("attributeValue"));
@@ -999,6 +1407,21 @@ void to_json(json& j, const SignedMeterValue& k) {
     }
 }
 
+/// \brief Writes the given SignedMeterValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SignedMeterValue& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("signedMeterData", k.signedMeterData);
+    writer.member("signingMethod", k.signingMethod);
+    writer.member("encodingMethod", k.encodingMethod);
+    writer.member("publicKey", k.publicKey);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given SignedMeterValue \p k
 void from_json(const json& j, SignedMeterValue& k) {
     // the required parts of the message
@@ -1036,6 +1459,23 @@ void to_json(json& j, const UnitOfMeasure& k) {
     }
 }
 
+/// \brief Writes the given UnitOfMeasure \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const UnitOfMeasure& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.unit) {
+        writer.member("unit", k.unit.value());
+    }
+    if (k.multiplier) {
+        writer.member("multiplier", k.multiplier.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given UnitOfMeasure \p k
 void from_json(const json& j, UnitOfMeasure& k) {
     // the required parts of the message
@@ -1089,6 +1529,36 @@ void to_json(json& j, const SampledValue& k) {
     }
 }
 
+/// \brief Writes the given SampledValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SampledValue& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("value", k.value);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.context) {
+        writer.member("context", conversions::reading_context_enum_to_string(k.context.value()));
+    }
+    if (k.measurand) {
+        writer.member("measurand", conversions::measurand_enum_to_string(k.measurand.value()));
+    }
+    if (k.phase) {
+        writer.member("phase", conversions::phase_enum_to_string(k.phase.value()));
+    }
+    if (k.location) {
+        writer.member("location", conversions::location_enum_to_string(k.location.value()));
+    }
+    if (k.signedMeterValue) {
+        writer.member("signedMeterValue", k.signedMeterValue.value());
+    }
+    if (k.unitOfMeasure) {
+        writer.member("unitOfMeasure", k.unitOfMeasure.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given SampledValue \p k
 void from_json(const json& j, SampledValue& k) {
     // the required parts of the message
@@ -1099,16 +1569,16 @@ void from_json(const json& j, SampledValue& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("context")) {
-        k.context.emplace(conversions::string_to_reading_context_enum(j.at("context")));
+        k.context.emplace(conversions::string_to_reading_context_enum(j.at("context").get_ref<const std::string&>()));
     }
     if (j.contains("measurand")) {
-        k.measurand.emplace(conversions::string_to_measurand_enum(j.at("measurand")));
+        k.measurand.emplace(conversions::string_to_measurand_enum(j.at("measurand").get_ref<const std::string&>()));
     }
     if (j.contains("phase")) {
-        k.phase.emplace(conversions::string_to_phase_enum(j.at("phase")));
+        k.phase.emplace(conversions::string_to_phase_enum(j.at("phase").get_ref<const std::string&>()));
     }
     if (j.contains("location")) {
-        k.location.emplace(conversions::string_to_location_enum(j.at("location")));
+        k.location.emplace(conversions::string_to_location_enum(j.at("location").get_ref<const std::string&>()));
     }
     if (j.contains("signedMeterValue")) {
         k.signedMeterValue.emplace(j.at("signedMeterValue"));
@@ -1138,6 +1608,19 @@ void to_json(json& j, const MeterValue& k) {
     }
 }
 
+/// \brief Writes the given MeterValue \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MeterValue& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("sampledValue", k.sampledValue);
+    writer.member("timestamp", k.timestamp.to_rfc3339());
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given MeterValue \p k
 void from_json(const json& j, MeterValue& k) {
     // the required parts of the message
@@ -1174,6 +1657,21 @@ void to_json(json& j, const RelativeTimeInterval& k) {
     }
 }
 
+/// \brief Writes the given RelativeTimeInterval \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const RelativeTimeInterval& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("start", k.start);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.duration) {
+        writer.member("duration", k.duration.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given RelativeTimeInterval \p k
 void from_json(const json& j, RelativeTimeInterval& k) {
     // the required parts of the message
@@ -1211,10 +1709,26 @@ void to_json(json& j, const Cost& k) {
     }
 }
 
-/// \brief Conversion from a given json object \p j to a given Cost \p k
+/// \brief Writes the given Cost \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Cost& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("costKind", conversions::cost_kind_enum_to_string(k.costKind));
+    writer.member("amount", k.amount);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.amountMultiplier) {
+        writer.member("amountMultiplier", k.amountMultiplier.value());
+    }
+    writer.end_object();
+}
+
+/// \brief Conversion from a given json object \p j to a given Cost \p k
 void from_json(const json& j, Cost& k) {
     // the required parts of the message
-    k.costKind = conversions::string_to_cost_kind_enum(j.at("costKind"));
+    k.costKind = conversions::string_to_cost_kind_enum(j.at("costKind").get_ref<const std::string&>());
     k.amount = j.at("amount");
 
     // the optional parts of the message
@@ -1246,6 +1760,19 @@ void to_json(json& j, const ConsumptionCost& k) {
     }
 }
 
+/// \brief Writes the given ConsumptionCost \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ConsumptionCost& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("startValue", k.startValue);
+    writer.member("cost", k.cost);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ConsumptionCost \p k
 void from_json(const json& j, ConsumptionCost& k) {
     // the required parts of the message
@@ -1288,6 +1815,24 @@ void to_json(json& j, const SalesTariffEntry& k) {
     }
 }
 
+/// \brief Writes the given SalesTariffEntry \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SalesTariffEntry& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("relativeTimeInterval", k.relativeTimeInterval);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.ePriceLevel) {
+        writer.member("ePriceLevel", k.ePriceLevel.value());
+    }
+    if (k.consumptionCost) {
+        writer.member("consumptionCost", k.consumptionCost.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given SalesTariffEntry \p k
 void from_json(const json& j, SalesTariffEntry& k) {
     // the required parts of the message
@@ -1336,6 +1881,25 @@ void to_json(json& j, const SalesTariff& k) {
     }
 }
 
+/// \brief Writes the given SalesTariff \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SalesTariff& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("salesTariffEntry", k.salesTariffEntry);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.salesTariffDescription) {
+        writer.member("salesTariffDescription", k.salesTariffDescription.value());
+    }
+    if (k.numEPriceLevels) {
+        writer.member("numEPriceLevels", k.numEPriceLevels.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given SalesTariff \p k
 void from_json(const json& j, SalesTariff& k) {
     // the required parts of the message
@@ -1389,11 +1953,38 @@ void to_json(json& j, const ChargingSchedule& k) {
     }
 }
 
+/// \brief Writes the given ChargingSchedule \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingSchedule& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("chargingRateUnit", conversions::charging_rate_unit_enum_to_string(k.chargingRateUnit));
+    writer.member("chargingSchedulePeriod", k.chargingSchedulePeriod);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.startSchedule) {
+        writer.member("startSchedule", k.startSchedule.value().to_rfc3339());
+    }
+    if (k.duration) {
+        writer.member("duration", k.duration.value());
+    }
+    if (k.minChargingRate) {
+        writer.member("minChargingRate", k.minChargingRate.value());
+    }
+    if (k.salesTariff) {
+        writer.member("salesTariff", k.salesTariff.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ChargingSchedule \p k
 void from_json(const json& j, ChargingSchedule& k) {
     // the required parts of the message
     k.id = j.at("id");
-    k.chargingRateUnit = conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit"));
+    k.chargingRateUnit =
+        conversions::string_to_charging_rate_unit_enum(j.at("chargingRateUnit").get_ref<const std::string&>());
     for (auto val : j.at("chargingSchedulePeriod")) {
         k.chargingSchedulePeriod.push_back(val);
     }
@@ -1438,10 +2029,26 @@ void to_json(json& j, const ChargingLimit& k) {
     }
 }
 
+/// \brief Writes the given ChargingLimit \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingLimit& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("chargingLimitSource", conversions::charging_limit_source_enum_to_string(k.chargingLimitSource));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.isGridCritical) {
+        writer.member("isGridCritical", k.isGridCritical.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ChargingLimit \p k
 void from_json(const json& j, ChargingLimit& k) {
     // the required parts of the message
-    k.chargingLimitSource = conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource"));
+    k.chargingLimitSource =
+        conversions::string_to_charging_limit_source_enum(j.at("chargingLimitSource").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -1488,11 +2095,40 @@ void to_json(json& j, const MessageInfo& k) {
     }
 }
 
+/// \brief Writes the given MessageInfo \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MessageInfo& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("priority", conversions::message_priority_enum_to_string(k.priority));
+    writer.member("message", k.message);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.display) {
+        writer.member("display", k.display.value());
+    }
+    if (k.state) {
+        writer.member("state", conversions::message_state_enum_to_string(k.state.value()));
+    }
+    if (k.startDateTime) {
+        writer.member("startDateTime", k.startDateTime.value().to_rfc3339());
+    }
+    if (k.endDateTime) {
+        writer.member("endDateTime", k.endDateTime.value().to_rfc3339());
+    }
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given MessageInfo \p k
 void from_json(const json& j, MessageInfo& k) {
     // the required parts of the message
     k.id = j.at("id");
-    k.priority = conversions::string_to_message_priority_enum(j.at("priority"));
+    k.priority = conversions::string_to_message_priority_enum(j.at("priority").get_ref<const std::string&>());
     k.message = j.at("message");
 
     // the optional parts of the message
@@ -1503,7 +2139,7 @@ void from_json(const json& j, MessageInfo& k) {
         k.display.emplace(j.at("display"));
     }
     if (j.contains("state")) {
-        k.state.emplace(conversions::string_to_message_state_enum(j.at("state")));
+        k.state.emplace(conversions::string_to_message_state_enum(j.at("state").get_ref<const std::string&>()));
     }
     if (j.contains("startDateTime")) {
         k.startDateTime.emplace(j.at("startDateTime").get<std::string>());
@@ -1538,6 +2174,21 @@ void to_json(json& j, const ACChargingParameters& k) {
     }
 }
 
+/// \brief Writes the given ACChargingParameters \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ACChargingParameters& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("energyAmount", k.energyAmount);
+    writer.member("evMinCurrent", k.evMinCurrent);
+    writer.member("evMaxCurrent", k.evMaxCurrent);
+    writer.member("evMaxVoltage", k.evMaxVoltage);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ACChargingParameters \p k
 void from_json(const json& j, ACChargingParameters& k) {
     // the required parts of the message
@@ -1590,6 +2241,37 @@ void to_json(json& j, const DCChargingParameters& k) {
     }
 }
 
+/// \brief Writes the given DCChargingParameters \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const DCChargingParameters& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("evMaxCurrent", k.evMaxCurrent);
+    writer.member("evMaxVoltage", k.evMaxVoltage);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.energyAmount) {
+        writer.member("energyAmount", k.energyAmount.value());
+    }
+    if (k.evMaxPower) {
+        writer.member("evMaxPower", k.evMaxPower.value());
+    }
+    if (k.stateOfCharge) {
+        writer.member("stateOfCharge", k.stateOfCharge.value());
+    }
+    if (k.evEnergyCapacity) {
+        writer.member("evEnergyCapacity", k.evEnergyCapacity.value());
+    }
+    if (k.fullSoC) {
+        writer.member("fullSoC", k.fullSoC.value());
+    }
+    if (k.bulkSoC) {
+        writer.member("bulkSoC", k.bulkSoC.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given DCChargingParameters \p k
 void from_json(const json& j, DCChargingParameters& k) {
     // the required parts of the message
@@ -1648,10 +2330,33 @@ void to_json(json& j, const ChargingNeeds& k) {
     }
 }
 
+/// \brief Writes the given ChargingNeeds \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingNeeds& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("requestedEnergyTransfer",
+                  conversions::energy_transfer_mode_enum_to_string(k.requestedEnergyTransfer));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.acChargingParameters) {
+        writer.member("acChargingParameters", k.acChargingParameters.value());
+    }
+    if (k.dcChargingParameters) {
+        writer.member("dcChargingParameters", k.dcChargingParameters.value());
+    }
+    if (k.departureTime) {
+        writer.member("departureTime", k.departureTime.value().to_rfc3339());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ChargingNeeds \p k
 void from_json(const json& j, ChargingNeeds& k) {
     // the required parts of the message
-    k.requestedEnergyTransfer = conversions::string_to_energy_transfer_mode_enum(j.at("requestedEnergyTransfer"));
+    k.requestedEnergyTransfer =
+        conversions::string_to_energy_transfer_mode_enum(j.at("requestedEnergyTransfer").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -1711,15 +2416,52 @@ void to_json(json& j, const EventData& k) {
     }
 }
 
+/// \brief Writes the given EventData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const EventData& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("eventId", k.eventId);
+    writer.member("timestamp", k.timestamp.to_rfc3339());
+    writer.member("trigger", conversions::event_trigger_enum_to_string(k.trigger));
+    writer.member("actualValue", k.actualValue);
+    writer.member("component", k.component);
+    writer.member("eventNotificationType", conversions::event_notification_enum_to_string(k.eventNotificationType));
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.cause) {
+        writer.member("cause", k.cause.value());
+    }
+    if (k.techCode) {
+        writer.member("techCode", k.techCode.value());
+    }
+    if (k.techInfo) {
+        writer.member("techInfo", k.techInfo.value());
+    }
+    if (k.cleared) {
+        writer.member("cleared", k.cleared.value());
+    }
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    if (k.variableMonitoringId) {
+        writer.member("variableMonitoringId", k.variableMonitoringId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given EventData \p k
 void from_json(const json& j, EventData& k) {
     // the required parts of the message
     k.eventId = j.at("eventId");
     k.timestamp = ocpp::DateTime(std::string(j.at("timestamp")));
-    k.trigger = conversions::string_to_event_trigger_enum(j.at("trigger"));
+    k.trigger = conversions::string_to_event_trigger_enum(j.at("trigger").get_ref<const std::string&>());
     k.actualValue = j.at("actualValue");
     k.component = j.at("component");
-    k.eventNotificationType = conversions::string_to_event_notification_enum(j.at("eventNotificationType"));
+    k.eventNotificationType =
+        conversions::string_to_event_notification_enum(j.at("eventNotificationType").get_ref<const std::string&>());
     k.variable = j.at("variable");
 
     // the optional parts of the message
@@ -1769,13 +2511,29 @@ void to_json(json& j, const VariableMonitoring& k) {
     }
 }
 
+/// \brief Writes the given VariableMonitoring \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const VariableMonitoring& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("transaction", k.transaction);
+    writer.member("value", k.value);
+    writer.member("type", conversions::monitor_enum_to_string(k.type));
+    writer.member("severity", k.severity);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given VariableMonitoring \p k
 void from_json(const json& j, VariableMonitoring& k) {
     // the required parts of the message
     k.id = j.at("id");
     k.transaction = j.at("transaction");
     k.value = j.at("value");
-    k.type = conversions::string_to_monitor_enum(j.at("type"));
+    k.type = conversions::string_to_monitor_enum(j.at("type").get_ref<const std::string&>());
     k.severity = j.at("severity");
 
     // the optional parts of the message
@@ -1805,6 +2563,20 @@ void to_json(json& j, const MonitoringData& k) {
     }
 }
 
+/// \brief Writes the given MonitoringData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const MonitoringData& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    writer.member("variableMonitoring", k.variableMonitoring);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given MonitoringData \p k
 void from_json(const json& j, MonitoringData& k) {
     // the required parts of the message
@@ -1852,6 +2624,32 @@ void to_json(json& j, const VariableAttribute& k) {
     }
 }
 
+/// \brief Writes the given VariableAttribute \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const VariableAttribute& k) {
+    writer.start_object();
+    // the required parts of the message
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.type) {
+        writer.member("type", conversions::attribute_enum_to_string(k.type.value()));
+    }
+    if (k.value) {
+        writer.member("value", k.value.value());
+    }
+    if (k.mutability) {
+        writer.member("mutability", conversions::mutability_enum_to_string(k.mutability.value()));
+    }
+    if (k.persistent) {
+        writer.member("persistent", k.persistent.value());
+    }
+    if (k.constant) {
+        writer.member("constant", k.constant.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given VariableAttribute \p k
 void from_json(const json& j, VariableAttribute& k) {
     // the required parts of the message
@@ -1861,7 +2659,7 @@ void from_json(const json& j, VariableAttribute& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("type")) {
-        k.type.emplace(conversions::string_to_attribute_enum(j.at("type")));
+        k.type.emplace(conversions::string_to_attribute_enum(j.at("type").get_ref<const std::string&>()));
     }
     if (j.contains("value")) {
         const json& value = j.at("value");
@@ -1883,7 +2681,7 @@ void from_json(const json& j, VariableAttribute& k) {
         }
     }
     if (j.contains("mutability")) {
-        k.mutability.emplace(conversions::string_to_mutability_enum(j.at("mutability")));
+        k.mutability.emplace(conversions::string_to_mutability_enum(j.at("mutability").get_ref<const std::string&>()));
     }
     if (j.contains("persistent")) {
         k.persistent.emplace(j.at("persistent"));
@@ -1925,10 +2723,35 @@ void to_json(json& j, const VariableCharacteristics& k) {
     }
 }
 
+/// \brief Writes the given VariableCharacteristics \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const VariableCharacteristics& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("dataType", conversions::data_enum_to_string(k.dataType));
+    writer.member("supportsMonitoring", k.supportsMonitoring);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.unit) {
+        writer.member("unit", k.unit.value());
+    }
+    if (k.minLimit) {
+        writer.member("minLimit", k.minLimit.value());
+    }
+    if (k.maxLimit) {
+        writer.member("maxLimit", k.maxLimit.value());
+    }
+    if (k.valuesList) {
+        writer.member("valuesList", k.valuesList.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given VariableCharacteristics \p k
 void from_json(const json& j, VariableCharacteristics& k) {
     // the required parts of the message
-    k.dataType = conversions::string_to_data_enum(j.at("dataType"));
+    k.dataType = conversions::string_to_data_enum(j.at("dataType").get_ref<const std::string&>());
     k.supportsMonitoring = j.at("supportsMonitoring");
 
     // the optional parts of the message
@@ -1973,6 +2796,23 @@ void to_json(json& j, const ReportData& k) {
     }
 }
 
+/// \brief Writes the given ReportData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ReportData& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    writer.member("variableAttribute", k.variableAttribute);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.variableCharacteristics) {
+        writer.member("variableCharacteristics", k.variableCharacteristics.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ReportData \p k
 void from_json(const json& j, ReportData& k) {
     // the required parts of the message
@@ -2026,13 +2866,44 @@ void to_json(json& j, const ChargingProfile& k) {
     }
 }
 
+/// \brief Writes the given ChargingProfile \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const ChargingProfile& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("id", k.id);
+    writer.member("stackLevel", k.stackLevel);
+    writer.member("chargingProfilePurpose",
+                  conversions::charging_profile_purpose_enum_to_string(k.chargingProfilePurpose));
+    writer.member("chargingProfileKind", conversions::charging_profile_kind_enum_to_string(k.chargingProfileKind));
+    writer.member("chargingSchedule", k.chargingSchedule);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.recurrencyKind) {
+        writer.member("recurrencyKind", conversions::recurrency_kind_enum_to_string(k.recurrencyKind.value()));
+    }
+    if (k.validFrom) {
+        writer.member("validFrom", k.validFrom.value().to_rfc3339());
+    }
+    if (k.validTo) {
+        writer.member("validTo", k.validTo.value().to_rfc3339());
+    }
+    if (k.transactionId) {
+        writer.member("transactionId", k.transactionId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given ChargingProfile \p k
 void from_json(const json& j, ChargingProfile& k) {
     // the required parts of the message
     k.id = j.at("id");
     k.stackLevel = j.at("stackLevel");
-    k.chargingProfilePurpose = conversions::string_to_charging_profile_purpose_enum(j.at("chargingProfilePurpose"));
-    k.chargingProfileKind = conversions::string_to_charging_profile_kind_enum(j.at("chargingProfileKind"));
+    k.chargingProfilePurpose = conversions::string_to_charging_profile_purpose_enum(
+        j.at("chargingProfilePurpose").get_ref<const std::string&>());
+    k.chargingProfileKind =
+        conversions::string_to_charging_profile_kind_enum(j.at("chargingProfileKind").get_ref<const std::string&>());
     for (auto val : j.at("chargingSchedule")) {
         k.chargingSchedule.push_back(val);
     }
@@ -2042,7 +2913,8 @@ void from_json(const json& j, ChargingProfile& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("recurrencyKind")) {
-        k.recurrencyKind.emplace(conversions::string_to_recurrency_kind_enum(j.at("recurrencyKind")));
+        k.recurrencyKind.emplace(
+            conversions::string_to_recurrency_kind_enum(j.at("recurrencyKind").get_ref<const std::string&>()));
     }
     if (j.contains("validFrom")) {
         k.validFrom.emplace(j.at("validFrom").get<std::string>());
@@ -2077,6 +2949,21 @@ void to_json(json& j, const AuthorizationData& k) {
     }
 }
 
+/// \brief Writes the given AuthorizationData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const AuthorizationData& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("idToken", k.idToken);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.idTokenInfo) {
+        writer.member("idTokenInfo", k.idTokenInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given AuthorizationData \p k
 void from_json(const json& j, AuthorizationData& k) {
     // the required parts of the message
@@ -2126,11 +3013,40 @@ void to_json(json& j, const APN& k) {
     }
 }
 
+/// \brief Writes the given APN \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const APN& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("apn", k.apn);
+    writer.member("apnAuthentication", conversions::apnauthentication_enum_to_string(k.apnAuthentication));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.apnUserName) {
+        writer.member("apnUserName", k.apnUserName.value());
+    }
+    if (k.apnPassword) {
+        writer.member("apnPassword", k.apnPassword.value());
+    }
+    if (k.simPin) {
+        writer.member("simPin", k.simPin.value());
+    }
+    if (k.preferredNetwork) {
+        writer.member("preferredNetwork", k.preferredNetwork.value());
+    }
+    if (k.useOnlyPreferredNetwork) {
+        writer.member("useOnlyPreferredNetwork", k.useOnlyPreferredNetwork.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given APN \p k
 void from_json(const json& j, APN& k) {
     // the required parts of the message
     k.apn = j.at("apn");
-    k.apnAuthentication = conversions::string_to_apnauthentication_enum(j.at("apnAuthentication"));
+    k.apnAuthentication =
+        conversions::string_to_apnauthentication_enum(j.at("apnAuthentication").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -2179,6 +3095,25 @@ void to_json(json& j, const VPN& k) {
     }
 }
 
+/// \brief Writes the given VPN \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const VPN& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("server", k.server);
+    writer.member("user", k.user);
+    writer.member("password", k.password);
+    writer.member("key", k.key);
+    writer.member("type", conversions::vpnenum_to_string(k.type));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.group) {
+        writer.member("group", k.group.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given VPN \p k
 void from_json(const json& j, VPN& k) {
     // the required parts of the message
@@ -2186,7 +3121,7 @@ void from_json(const json& j, VPN& k) {
     k.user = j.at("user");
     k.password = j.at("password");
     k.key = j.at("key");
-    k.type = conversions::string_to_vpnenum(j.at("type"));
+    k.type = conversions::string_to_vpnenum(j.at("type").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -2227,15 +3162,38 @@ void to_json(json& j, const NetworkConnectionProfile& k) {
     }
 }
 
+/// \brief Writes the given NetworkConnectionProfile \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const NetworkConnectionProfile& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("ocppVersion", conversions::ocppversion_enum_to_string(k.ocppVersion));
+    writer.member("ocppTransport", conversions::ocpptransport_enum_to_string(k.ocppTransport));
+    writer.member("ocppCsmsUrl", k.ocppCsmsUrl);
+    writer.member("messageTimeout", k.messageTimeout);
+    writer.member("securityProfile", k.securityProfile);
+    writer.member("ocppInterface", conversions::ocppinterface_enum_to_string(k.ocppInterface));
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.apn) {
+        writer.member("apn", k.apn.value());
+    }
+    if (k.vpn) {
+        writer.member("vpn", k.vpn.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given NetworkConnectionProfile \p k
 void from_json(const json& j, NetworkConnectionProfile& k) {
     // the required parts of the message
-    k.ocppVersion = conversions::string_to_ocppversion_enum(j.at("ocppVersion"));
-    k.ocppTransport = conversions::string_to_ocpptransport_enum(j.at("ocppTransport"));
+    k.ocppVersion = conversions::string_to_ocppversion_enum(j.at("ocppVersion").get_ref<const std::string&>());
+    k.ocppTransport = conversions::string_to_ocpptransport_enum(j.at("ocppTransport").get_ref<const std::string&>());
     k.ocppCsmsUrl = j.at("ocppCsmsUrl");
     k.messageTimeout = j.at("messageTimeout");
     k.securityProfile = j.at("securityProfile");
-    k.ocppInterface = conversions::string_to_ocppinterface_enum(j.at("ocppInterface"));
+    k.ocppInterface = conversions::string_to_ocppinterface_enum(j.at("ocppInterface").get_ref<const std::string&>());
 
     // the optional parts of the message
     if (j.contains("customData")) {
@@ -2276,11 +3234,33 @@ void to_json(json& j, const SetMonitoringData& k) {
     }
 }
 
+/// \brief Writes the given SetMonitoringData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetMonitoringData& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("value", k.value);
+    writer.member("type", conversions::monitor_enum_to_string(k.type));
+    writer.member("severity", k.severity);
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.id) {
+        writer.member("id", k.id.value());
+    }
+    if (k.transaction) {
+        writer.member("transaction", k.transaction.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given SetMonitoringData \p k
 void from_json(const json& j, SetMonitoringData& k) {
     // the required parts of the message
     k.value = j.at("value");
-    k.type = conversions::string_to_monitor_enum(j.at("type"));
+    k.type = conversions::string_to_monitor_enum(j.at("type").get_ref<const std::string&>());
     k.severity = j.at("severity");
     k.component = j.at("component");
     k.variable = j.at("variable");
@@ -2326,11 +3306,33 @@ void to_json(json& j, const SetMonitoringResult& k) {
     }
 }
 
+/// \brief Writes the given SetMonitoringResult \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetMonitoringResult& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("status", conversions::set_monitoring_status_enum_to_string(k.status));
+    writer.member("type", conversions::monitor_enum_to_string(k.type));
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    writer.member("severity", k.severity);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.id) {
+        writer.member("id", k.id.value());
+    }
+    if (k.statusInfo) {
+        writer.member("statusInfo", k.statusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given SetMonitoringResult \p k
 void from_json(const json& j, SetMonitoringResult& k) {
     // the required parts of the message
-    k.status = conversions::string_to_set_monitoring_status_enum(j.at("status"));
-    k.type = conversions::string_to_monitor_enum(j.at("type"));
+    k.status = conversions::string_to_set_monitoring_status_enum(j.at("status").get_ref<const std::string&>());
+    k.type = conversions::string_to_monitor_enum(j.at("type").get_ref<const std::string&>());
     k.component = j.at("component");
     k.variable = j.at("variable");
     k.severity = j.at("severity");
@@ -2371,6 +3373,23 @@ void to_json(json& j, const SetVariableData& k) {
     }
 }
 
+/// \brief Writes the given SetVariableData \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetVariableData& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("attributeValue", k.attributeValue);
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.attributeType) {
+        writer.member("attributeType", conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given SetVariableData \p k
 void from_json(const json& j, SetVariableData& k) {
     // the required parts of the message
@@ -2383,7 +3402,8 @@ void from_json(const json& j, SetVariableData& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("attributeType")) {
-        k.attributeType.emplace(conversions::string_to_attribute_enum(j.at("attributeType")));
+        k.attributeType.emplace(
+            conversions::string_to_attribute_enum(j.at("attributeType").get_ref<const std::string&>()));
     }
 }
 
@@ -2414,10 +3434,31 @@ void to_json(json& j, const SetVariableResult& k) {
     }
 }
 
+/// \brief Writes the given SetVariableResult \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const SetVariableResult& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("attributeStatus", conversions::set_variable_status_enum_to_string(k.attributeStatus));
+    writer.member("component", k.component);
+    writer.member("variable", k.variable);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.attributeType) {
+        writer.member("attributeType", conversions::attribute_enum_to_string(k.attributeType.value()));
+    }
+    if (k.attributeStatusInfo) {
+        writer.member("attributeStatusInfo", k.attributeStatusInfo.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given SetVariableResult \p k
 void from_json(const json& j, SetVariableResult& k) {
     // the required parts of the message
-    k.attributeStatus = conversions::string_to_set_variable_status_enum(j.at("attributeStatus"));
+    k.attributeStatus =
+        conversions::string_to_set_variable_status_enum(j.at("attributeStatus").get_ref<const std::string&>());
     k.component = j.at("component");
     k.variable = j.at("variable");
 
@@ -2426,7 +3467,8 @@ void from_json(const json& j, SetVariableResult& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("attributeType")) {
-        k.attributeType.emplace(conversions::string_to_attribute_enum(j.at("attributeType")));
+        k.attributeType.emplace(
+            conversions::string_to_attribute_enum(j.at("attributeType").get_ref<const std::string&>()));
     }
     if (j.contains("attributeStatusInfo")) {
         k.attributeStatusInfo.emplace(j.at("attributeStatusInfo"));
@@ -2464,6 +3506,30 @@ void to_json(json& j, const Transaction& k) {
     }
 }
 
+/// \brief Writes the given Transaction \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Transaction& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("transactionId", k.transactionId);
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.chargingState) {
+        writer.member("chargingState", conversions::charging_state_enum_to_string(k.chargingState.value()));
+    }
+    if (k.timeSpentCharging) {
+        writer.member("timeSpentCharging", k.timeSpentCharging.value());
+    }
+    if (k.stoppedReason) {
+        writer.member("stoppedReason", conversions::reason_enum_to_string(k.stoppedReason.value()));
+    }
+    if (k.remoteStartId) {
+        writer.member("remoteStartId", k.remoteStartId.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given Transaction \p k
 void from_json(const json& j, Transaction& k) {
     // the required parts of the message
@@ -2474,13 +3540,15 @@ void from_json(const json& j, Transaction& k) {
         k.customData.emplace(j.at("customData"));
     }
     if (j.contains("chargingState")) {
-        k.chargingState.emplace(conversions::string_to_charging_state_enum(j.at("chargingState")));
+        k.chargingState.emplace(
+            conversions::string_to_charging_state_enum(j.at("chargingState").get_ref<const std::string&>()));
     }
     if (j.contains("timeSpentCharging")) {
         k.timeSpentCharging.emplace(j.at("timeSpentCharging"));
     }
     if (j.contains("stoppedReason")) {
-        k.stoppedReason.emplace(conversions::string_to_reason_enum(j.at("stoppedReason")));
+        k.stoppedReason.emplace(
+            conversions::string_to_reason_enum(j.at("stoppedReason").get_ref<const std::string&>()));
     }
     if (j.contains("remoteStartId")) {
         k.remoteStartId.emplace(j.at("remoteStartId"));
@@ -2516,6 +3584,28 @@ void to_json(json& j, const Firmware& k) {
     }
 }
 
+/// \brief Writes the given Firmware \p k to the given \p writer without building a json object
+void write_json(JsonWriter& writer, const Firmware& k) {
+    writer.start_object();
+    // the required parts of the message
+    writer.member("location", k.location);
+    writer.member("retrieveDateTime", k.retrieveDateTime.to_rfc3339());
+    // the optional parts of the message
+    if (k.customData) {
+        writer.member("customData", k.customData.value());
+    }
+    if (k.installDateTime) {
+        writer.member("installDateTime", k.installDateTime.value().to_rfc3339());
+    }
+    if (k.signingCertificate) {
+        writer.member("signingCertificate", k.signingCertificate.value());
+    }
+    if (k.signature) {
+        writer.member("signature", k.signature.value());
+    }
+    writer.end_object();
+}
+
 /// \brief Conversion from a given json object \p j to a given Firmware \p k
 void from_json(const json& j, Firmware& k) {
     // the required parts of the message
@@ -53,6 +53,28 @@ def remove_last(input_string: str, search: str) -> str:
     return input_string
 
 
+def string_switch(enums: Tuple[str]) -> List[Dict]:
+    """Groups the given enum strings by length for the generated string_to_* lookups.
+    Within every group the first character position that tells all strings of this
+    length apart is selected, so a lookup only needs a switch on the length, a switch
+    on this character and a single string compare. Groups without such a position
+    fall back to comparing all strings of this length.
+    """
+
+    groups = []
+    for length in sorted({len(enum) for enum in enums}):
+        candidates = [enum for enum in enums if len(enum) == length]
+        index = None
+        if len(candidates) > 1:
+            for i in range(length):
+                chars = [candidate[i] for candidate in candidates]
+                if len(set(chars)) == len(chars) and not any(c in '\\\'' for c in chars):
+                    index = i
+                    break
+        groups.append({'length': length, 'index': index, 'enums': candidates})
+    return groups
+
+
 def uses_optional(types):
     for t in types:
         for property in t['properties']:
@@ -89,6 +111,7 @@ env = Environment(
 )
 env.filters['snake_case'] = snake_case
 env.filters['remove_last'] = remove_last
+env.filters['string_switch'] = string_switch
 env.globals['timestamp'] = datetime.utcnow
 env.globals['year'] = datetime.utcnow().year
 message_hpp_template = env.get_template('message.hpp.jinja')
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <everest/logging.hpp>
+
+#include <ocpp/common/binary_message_log.hpp>
+#include <ocpp/common/ocpp_logging.hpp>
+
+namespace po = boost::program_options;
+
+/// Converts binary message logs to the text and HTML message logs that MessageLogging writes
+int main(int argc, char* argv[]) {
+    po::options_description desc("OCPP binary message log converter");
+
+    desc.add_options()("help,h", "produce help message");
+    desc.add_options()("input", po::value<std::vector<std::string>>(),
+                       "binary message logs to convert, rotated logs in the order they were written");
+    desc.add_options()("output-dir", po::value<std::string>()->default_value("."),
+                       "directory the converted logs are written to");
+    desc.add_options()("name", po::value<std::string>()->default_value("converted"),
+                       "file name of the converted logs without extension");
+    desc.add_options()("log", "write a text log");
+    desc.add_options()("html", "write a html log");
+    desc.add_options()("logconf", po::value<std::string>(), "The path to a custom logging.ini");
+
+    po::positional_options_description positional;
+    positional.add("input", -1);
+
+    po::variables_map vm;
+    po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
+    po::notify(vm);
+
+    if (vm.count("help") != 0 or vm.count("input") == 0) {
+        std::cout << desc << "\n";
+        return 1;
+    }
+
+    if (vm.count("logconf") != 0) {
+        Everest::Logging::init(vm["logconf"].as<std::string>(), "message_log_converter");
+    }
+
+    bool log_to_file = vm.count("log") != 0;
+    bool log_to_html = vm.count("html") != 0;
+    if (not log_to_file and not log_to_html) {
+        log_to_file = true;
+        log_to_html = true;
+    }
+
+    const auto output_dir = vm["output-dir"].as<std::string>();
+    std::filesystem::create_directories(output_dir);
+
+    size_t converted = 0;
+    {
+        ocpp::MessageLogging logging(true, output_dir, vm["name"].as<std::string>(), false, false, log_to_file,
+                                     log_to_html, false, false, nullptr);
+
+        for (const auto& input : vm["input"].as<std::vector<std::string>>()) {
+            std::ifstream ifs(input, std::ifstream::binary);
+            if (not ifs.is_open()) {
+                EVLOG_error << "Could not open binary message log: " << input;
+                return 1;
+            }
+            if (not ocpp::read_binary_log_header(ifs)) {
+                EVLOG_error << "Not a binary message log of a supported version: " << input;
+                return 1;
+            }
+
+            try {
+                while (auto record = ocpp::read_binary_log_record(ifs)) {
+                    logging.replay(record.value());
+                    converted++;
+                }
+            } catch (const std::runtime_error& e) {
+                // The last record of a log can be incomplete if the charge point has been stopped while writing it
+                EVLOG_warning << "Stopped converting " << input << ": " << e.what();
+            }
+        }
+    }
+
+    std::cout << "Converted " << converted << " messages to: " << output_dir << "\n";
+    return 0;
+}
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+#include <ocpp/common/binary_message_log.hpp>
+#include <ocpp/common/ocpp_logging.hpp>
+
+using namespace ocpp;
+
+namespace {
+
+class BinaryMessageLogTest : public ::testing::Test {
+protected:
+    std::filesystem::path log_path = std::filesystem::temp_directory_path() / "libocpp_test_binary_message_log";
+
+    void SetUp() override {
+        std::filesystem::remove_all(log_path);
+        std::filesystem::create_directories(log_path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(log_path);
+    }
+
+    std::string read_file(const std::filesystem::path& path) {
+        std::ifstream ifs(path, std::ifstream::binary);
+        std::stringstream buffer;
+        buffer << ifs.rdbuf();
+        return buffer.str();
+    }
+};
+
+} // namespace
+
+TEST_F(BinaryMessageLogTest, RecordsRoundTrip) {
+    const auto timestamp = std::chrono::time_point<date::utc_clock>(std::chrono::nanoseconds(1700000000123456789));
+    const std::string call = "[2,\"1\",\"Heartbeat\",{}]";
+    const std::string binary_frame("\0\xff\n", 3);
+
+    std::stringstream stream;
+    write_binary_log_header(stream);
+    write_binary_log_record(stream, {timestamp, 0, "Heartbeat", call});
+    write_binary_log_record(stream, {timestamp, 1, "", binary_frame});
+    write_binary_log_record(stream, {timestamp, 2, "Session logging started.", ""});
+
+    ASSERT_TRUE(read_binary_log_header(stream));
+
+    auto first = read_binary_log_record(stream);
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first->timestamp, timestamp);
+    EXPECT_EQ(first->typ, 0);
+    EXPECT_EQ(first->message_type, "Heartbeat");
+    EXPECT_EQ(first->message, call);
+
+    auto second = read_binary_log_record(stream);
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second->typ, 1);
+    EXPECT_EQ(second->message_type, "");
+    EXPECT_EQ(second->message, binary_frame);
+
+    auto third = read_binary_log_record(stream);
+    ASSERT_TRUE(third.has_value());
+    EXPECT_EQ(third->typ, 2);
+    EXPECT_EQ(third->message_type, "Session logging started.");
+    EXPECT_EQ(third->message, "");
+
+    EXPECT_FALSE(read_binary_log_record(stream).has_value());
+}
+
+TEST_F(BinaryMessageLogTest, RejectsOtherFiles) {
+    std::stringstream stream("<html><head><title>EVerest OCPP log session</title>");
+    EXPECT_FALSE(read_binary_log_header(stream));
+}
+
+TEST_F(BinaryMessageLogTest, ThrowsOnTruncatedRecord) {
+    std::stringstream stream;
+    write_binary_log_header(stream);
+    write_binary_log_record(stream, {date::utc_clock::now(), 0, "Heartbeat", "[2,\"1\",\"Heartbeat\",{}]"});
+
+    const auto content = stream.str();
+    std::stringstream truncated(content.substr(0, content.size() - 5));
+    ASSERT_TRUE(read_binary_log_header(truncated));
+    EXPECT_THROW(read_binary_log_record(truncated), std::runtime_error);
+}
+
+TEST_F(BinaryMessageLogTest, ReplayedBinaryLogMatchesTextLog) {
+    const std::string call =
+        "[2,\"1\",\"BootNotification\",{\"chargePointModel\":\"model\",\"chargePointVendor\":\"vendor\"}]";
+    const std::string call_result = "[3,\"1\",{\"currentTime\":\"2024-01-01T00:00:00Z\",\"interval\":300,"
+                                    "\"status\":\"Accepted\"}]";
+    {
+        MessageLogging logging(true, log_path.string(), "charge_point", false, false, false, false, false, false,
+                               nullptr, LogQueueConfig(), true);
+        logging.charge_point("BootNotification", call);
+        logging.central_system("BootNotification", call_result);
+    }
+
+    const auto binary_log = log_path / "charge_point.binlog";
+    ASSERT_TRUE(std::filesystem::exists(binary_log));
+    EXPECT_FALSE(std::filesystem::exists(log_path / "charge_point.log"));
+
+    // The frames are stored as they were sent, without pretty printing
+    const auto binary_content = read_file(binary_log);
+    EXPECT_NE(binary_content.find(call), std::string::npos);
+    EXPECT_NE(binary_content.find(call_result), std::string::npos);
+
+    {
+        MessageLogging converted(true, log_path.string(), "converted", false, false, true, false, false, false,
+                                 nullptr);
+        std::ifstream ifs(binary_log, std::ifstream::binary);
+        ASSERT_TRUE(read_binary_log_header(ifs));
+        while (auto record = read_binary_log_record(ifs)) {
+            converted.replay(record.value());
+        }
+    }
+
+    const auto text_log = read_file(log_path / "converted.log");
+    EXPECT_NE(text_log.find("ChargePoint>CentralSystem BootNotification"), std::string::npos);
+    EXPECT_NE(text_log.find("CentralSystem>ChargePoint  BootNotificationResponse"), std::string::npos);
+    EXPECT_NE(text_log.find("\"status\": \"Accepted\""), std::string::npos);
+}
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include "database_testing_utils.hpp"
+#include <ocpp/common/database/database_exceptions.hpp>
+
+class StatementCacheTest : public DatabaseTestingUtils {
+protected:
+    void SetUp() override {
+        EXPECT_TRUE(this->database->execute_statement(
+            "CREATE TABLE IF NOT EXISTS CACHE_TEST(FIELD1 TEXT PRIMARY KEY NOT NULL, FIELD2 INT);"));
+        EXPECT_TRUE(this->database->clear_table("CACHE_TEST"));
+    }
+
+    void Insert(const std::string& field1, const std::optional<int>& field2) {
+        auto statement = this->database->new_statement("INSERT INTO CACHE_TEST (FIELD1, FIELD2) VALUES (@f1, @f2)");
+        statement->bind_text("@f1", field1);
+        if (field2.has_value()) {
+            statement->bind_int("@f2", field2.value());
+        }
+        EXPECT_EQ(statement->step(), SQLITE_DONE);
+    }
+
+    int CountRowsWithNull() {
+        auto statement = this->database->new_statement("SELECT COUNT(*) FROM CACHE_TEST WHERE FIELD2 IS NULL");
+        EXPECT_EQ(statement->step(), SQLITE_ROW);
+        return statement->column_int(0);
+    }
+};
+
+TEST_F(StatementCacheTest, ReusedStatementHasClearedBindings) {
+    this->Insert("a", 1);
+    // second use of the same SQL text must not see the binding of the previous use
+    this->Insert("b", std::nullopt);
+
+    EXPECT_EQ(this->CountRowsWithNull(), 1);
+}
+
+TEST_F(StatementCacheTest, SameStatementCanBeUsedConcurrently) {
+    this->Insert("a", 1);
+    this->Insert("b", 2);
+
+    const std::string sql = "SELECT FIELD1 FROM CACHE_TEST ORDER BY FIELD1";
+    auto first = this->database->new_statement(sql);
+    auto second = this->database->new_statement(sql);
+
+    EXPECT_EQ(first->step(), SQLITE_ROW);
+    EXPECT_EQ(second->step(), SQLITE_ROW);
+    EXPECT_EQ(first->step(), SQLITE_ROW);
+    EXPECT_EQ(first->column_text(0), "b");
+    EXPECT_EQ(second->column_text(0), "a");
+}
+
+TEST_F(StatementCacheTest, PreparedStatementsAreUsable) {
+    const std::string sql = "SELECT COUNT(*) FROM CACHE_TEST";
+    this->database->prepare_statements({sql});
+
+    this->Insert("a", 1);
+    auto statement = this->database->new_statement(sql);
+    EXPECT_EQ(statement->step(), SQLITE_ROW);
+    EXPECT_EQ(statement->column_int(0), 1);
+}
+
+TEST_F(StatementCacheTest, PrepareInvalidStatementThrows) {
+    EXPECT_THROW(this->database->prepare_statements({"SELECT * FROM DOES_NOT_EXIST"}), QueryExecutionException);
+}
+
+TEST(DatabaseTuningTest, DurablePresetIsApplied) {
+    const fs::path database_file = fs::temp_directory_path() / "libocpp_database_tuning_test.db";
+    fs::remove(database_file);
+
+    DatabaseConnection database{database_file, DatabaseTuning::durable()};
+    ASSERT_TRUE(database.open_connection());
+
+    auto journal_mode = database.new_statement("PRAGMA journal_mode");
+    ASSERT_EQ(journal_mode->step(), SQLITE_ROW);
+    EXPECT_EQ(journal_mode->column_text(0), "wal");
+
+    auto synchronous = database.new_statement("PRAGMA synchronous");
+    ASSERT_EQ(synchronous->step(), SQLITE_ROW);
+    EXPECT_EQ(synchronous->column_int(0), 2); // FULL
+
+    journal_mode.reset();
+    synchronous.reset();
+    EXPECT_TRUE(database.close_connection());
+    fs::remove(database_file);
+}
+
+TEST(DatabaseTuningTest, FastPresetIsApplied) {
+    DatabaseConnection database{"file::memory:", DatabaseTuning::fast()};
+    ASSERT_TRUE(database.open_connection());
+
+    auto synchronous = database.new_statement("PRAGMA synchronous");
+    ASSERT_EQ(synchronous->step(), SQLITE_ROW);
+    EXPECT_EQ(synchronous->column_int(0), 1); // NORMAL
+
+    auto cache_size = database.new_statement("PRAGMA cache_size");
+    ASSERT_EQ(cache_size->step(), SQLITE_ROW);
+    EXPECT_EQ(cache_size->column_int(0), -8 * 1024);
+}
+
+TEST(DatabaseTuningTest, PresetsAreFoundByName) {
+    EXPECT_EQ(DatabaseTuning::from_preset("Durable").synchronous, SynchronousMode::Full);
+    EXPECT_EQ(DatabaseTuning::from_preset("Fast").synchronous, SynchronousMode::Normal);
+    EXPECT_THROW(DatabaseTuning::from_preset("Unknown"), std::out_of_range);
+}
+
+TEST(DatabaseTuningTest, CustomTuningIsApplied) {
+    DatabaseTuning tuning;
+    tuning.synchronous = SynchronousMode::Normal;
+    tuning.cache_size = -8 * 1024;
+
+    DatabaseConnection database{"file::memory:", tuning};
+    ASSERT_TRUE(database.open_connection());
+
+    auto synchronous = database.new_statement("PRAGMA synchronous");
+    ASSERT_EQ(synchronous->step(), SQLITE_ROW);
+    EXPECT_EQ(synchronous->column_int(0), 1); // NORMAL
+
+    auto cache_size = database.new_statement("PRAGMA cache_size");
+    ASSERT_EQ(cache_size->step(), SQLITE_ROW);
+    EXPECT_EQ(cache_size->column_int(0), -8 * 1024);
+}
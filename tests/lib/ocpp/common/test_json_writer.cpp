@@ -0,0 +1,70 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+
+#include <limits>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ocpp/common/json_writer.hpp>
+
+namespace ocpp {
+
+static std::string write_value(const std::string& value) {
+    JsonWriter writer;
+    writer.value(value);
+    return writer.str();
+}
+
+static std::string write_value(const double value) {
+    JsonWriter writer;
+    writer.value(value);
+    return writer.str();
+}
+
+TEST(JsonWriterTest, test_strings_are_written_like_dump) {
+    const std::vector<std::string> values = {
+        "", "plain", "quote\" backslash\\ slash/", "\b\f\n\r\t", std::string("\x01\x1f", 2),
+        "\xc3\xa4\xe2\x82\xac\xf0\x9f\x94\x8c"};
+    for (const auto& value : values) {
+        EXPECT_EQ(write_value(value), json(value).dump());
+    }
+}
+
+TEST(JsonWriterTest, test_invalid_utf8_throws_like_dump) {
+    // truncated, overlong, surrogate, above U+10FFFF, invalid lead byte and truncated at the end
+    const std::vector<std::string> values = {"\xc3", "\xc0\xaf", "\xed\xa0\x80", "\xf4\x90\x80\x80", "abc\xff", "\xe2\x82"};
+    for (const auto& value : values) {
+        EXPECT_THROW(json(value).dump(), json::type_error);
+        EXPECT_THROW(write_value(value), json::type_error);
+    }
+}
+
+TEST(JsonWriterTest, test_numbers_are_written_like_dump) {
+    for (const double value : {0.0, 1.0, -0.5, 0.1, 123.456, 1e20, 1e-7, std::numeric_limits<double>::max()}) {
+        EXPECT_EQ(write_value(value), json(value).dump());
+    }
+    EXPECT_EQ(write_value(std::numeric_limits<double>::quiet_NaN()), "null");
+    EXPECT_EQ(write_value(std::numeric_limits<double>::infinity()), "null");
+    EXPECT_EQ(write_value(-0.0), "-0.0");
+    EXPECT_EQ(write_value(1e15), "1e+15");
+    EXPECT_EQ(write_value(0.0001), "0.0001");
+
+    // the shortest representation is written, which json::dump() does not always find
+    EXPECT_EQ(write_value(-8.481620698703041e+18), "-8.48162069870304e+18");
+    for (const double value : {-8.481620698703041e+18, 5e-324, 0.1 + 0.2, 1.3164367751946823e+15}) {
+        const auto parsed = json::parse(write_value(value));
+        EXPECT_TRUE(parsed.is_number_float());
+        EXPECT_EQ(parsed.get<double>(), value);
+    }
+
+    JsonWriter writer;
+    writer.start_array();
+    writer.value(-42);
+    writer.value(42u);
+    writer.value(true);
+    writer.null();
+    writer.end_array();
+    EXPECT_EQ(writer.str(), "[-42,42,true,null]");
+}
+
+} // namespace ocpp
@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+
+#include <zlib.h>
+
+#include <ocpp/common/log_file_rotator.hpp>
+
+using namespace ocpp;
+
+namespace {
+
+class LogFileRotatorTest : public ::testing::Test {
+protected:
+    std::filesystem::path log_path = std::filesystem::temp_directory_path() / "libocpp_test_log_file_rotator";
+    std::filesystem::path file = log_path / "ocpp.log";
+
+    void SetUp() override {
+        std::filesystem::remove_all(log_path);
+        std::filesystem::create_directories(log_path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(log_path);
+    }
+
+    /// \brief Appends \p content to the file like MessageLogging does and rotates it if needed
+    void write(LogFileRotator& rotator, const std::string& content) {
+        if (rotator.rotation_needed()) {
+            rotator.rotate();
+        }
+        std::ofstream ofs(file, std::ofstream::app);
+        ofs << content;
+        rotator.add_written(content.size());
+    }
+
+    std::set<std::string> list_files() {
+        std::set<std::string> files;
+        for (const auto& entry : std::filesystem::directory_iterator(log_path)) {
+            files.insert(entry.path().filename().string());
+        }
+        return files;
+    }
+
+    static std::string read_file(const std::filesystem::path& path) {
+        std::ifstream ifs(path);
+        return std::string(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+};
+
+} // namespace
+
+TEST_F(LogFileRotatorTest, RotatesWhenMaximumSizeIsReached) {
+    LogFileRotator rotator(file, LogRotationConfig(false, 10, 0));
+
+    write(rotator, "first-");
+    EXPECT_FALSE(rotator.rotation_needed());
+    write(rotator, "record");
+    EXPECT_TRUE(rotator.rotation_needed());
+    write(rotator, "second");
+
+    EXPECT_EQ(list_files(), (std::set<std::string>{"ocpp.log", "ocpp.log.0"}));
+    EXPECT_EQ(read_file(log_path / "ocpp.log.0"), "first-record");
+    EXPECT_EQ(read_file(file), "second");
+}
+
+TEST_F(LogFileRotatorTest, KeepsMaximumFileCount) {
+    LogFileRotator rotator(file, LogRotationConfig(false, 1, 3));
+    for (int i = 0; i < 6; i++) {
+        write(rotator, std::to_string(i));
+    }
+
+    // The rotated files keep their names, the oldest ones have been removed
+    EXPECT_EQ(list_files(), (std::set<std::string>{"ocpp.log", "ocpp.log.3", "ocpp.log.4"}));
+    EXPECT_EQ(read_file(log_path / "ocpp.log.3"), "3");
+    EXPECT_EQ(read_file(log_path / "ocpp.log.4"), "4");
+    EXPECT_EQ(read_file(file), "5");
+}
+
+TEST_F(LogFileRotatorTest, ContinuesRotationOfPreviousRun) {
+    {
+        LogFileRotator rotator(file, LogRotationConfig(false, 1, 3));
+        for (int i = 0; i < 4; i++) {
+            write(rotator, std::to_string(i));
+        }
+    }
+    EXPECT_EQ(list_files(), (std::set<std::string>{"ocpp.log", "ocpp.log.1", "ocpp.log.2"}));
+
+    // The size of the existing file is taken into account and the oldest file of the previous run is removed
+    LogFileRotator rotator(file, LogRotationConfig(false, 1, 3));
+    EXPECT_TRUE(rotator.rotation_needed());
+    write(rotator, "4");
+
+    EXPECT_EQ(list_files(), (std::set<std::string>{"ocpp.log", "ocpp.log.2", "ocpp.log.3"}));
+    EXPECT_EQ(read_file(log_path / "ocpp.log.3"), "3");
+}
+
+TEST_F(LogFileRotatorTest, CompressesRotatedFiles) {
+    const std::string content(4096, 'x');
+    {
+        LogFileRotator rotator(file, LogRotationConfig(false, 1, 0, true));
+        write(rotator, content);
+        write(rotator, "second");
+    }
+
+    EXPECT_EQ(list_files(), (std::set<std::string>{"ocpp.log", "ocpp.log.0.gz"}));
+    EXPECT_LT(std::filesystem::file_size(log_path / "ocpp.log.0.gz"), content.size());
+
+    gzFile gz = gzopen((log_path / "ocpp.log.0.gz").c_str(), "rb");
+    ASSERT_NE(gz, nullptr);
+    std::string decompressed(content.size() + 1, '\0');
+    const auto size = gzread(gz, decompressed.data(), static_cast<unsigned int>(decompressed.size()));
+    gzclose(gz);
+    decompressed.resize(size);
+    EXPECT_EQ(decompressed, content);
+}
+
+TEST_F(LogFileRotatorTest, RotationsWithinTheSameSecondKeepEveryFile) {
+    LogFileRotator rotator(file, LogRotationConfig(true, 1, 4));
+    for (int i = 0; i < 6; i++) {
+        write(rotator, std::to_string(i));
+    }
+
+    // The rotated files got the same date and a sequence number, only the oldest ones have been removed
+    std::set<std::string> rotated_contents;
+    for (const auto& name : list_files()) {
+        if (name != "ocpp.log") {
+            rotated_contents.insert(read_file(log_path / name));
+        }
+    }
+    EXPECT_EQ(rotated_contents, (std::set<std::string>{"2", "3", "4"}));
+    EXPECT_EQ(read_file(file), "5");
+}
+
+TEST_F(LogFileRotatorTest, CompressesEveryRotatedFileOfConsecutiveRotations) {
+    {
+        LogFileRotator rotator(file, LogRotationConfig(false, 1, 3, true));
+        for (int i = 0; i < 6; i++) {
+            write(rotator, std::string(4096, static_cast<char>('0' + i)));
+        }
+    }
+
+    // No compressed file of a removed rotated file is left behind
+    EXPECT_EQ(list_files(), (std::set<std::string>{"ocpp.log", "ocpp.log.3.gz", "ocpp.log.4.gz"}));
+}
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <ocpp/common/message_correlation_index.hpp>
+
+using namespace ocpp;
+using namespace std::chrono_literals;
+
+namespace {
+
+const MessageCorrelationIndex::TimePoint start = std::chrono::steady_clock::now();
+
+} // namespace
+
+TEST(MessageCorrelationIndexTest, RemovesAnsweredCalls) {
+    MessageCorrelationIndex index;
+    index.add_call("1", "BootNotification", true, start);
+    index.add_call("2", "Heartbeat", true, start);
+    EXPECT_EQ(index.size(), 2);
+
+    EXPECT_EQ(index.take_call("1", false, start + 10ms), "BootNotification");
+    EXPECT_EQ(index.size(), 1);
+
+    // A response is only correlated once
+    EXPECT_FALSE(index.take_call("1", false, start + 20ms).has_value());
+    EXPECT_EQ(index.take_call("2", false, start + 20ms), "Heartbeat");
+    EXPECT_EQ(index.size(), 0);
+}
+
+TEST(MessageCorrelationIndexTest, BoundsNumberOfPendingCalls) {
+    MessageCorrelationIndex index(100, 600s);
+    for (int i = 0; i < 1000; i++) {
+        index.add_call(std::to_string(i), "Heartbeat", true, start + std::chrono::milliseconds(i));
+    }
+    EXPECT_EQ(index.size(), 100);
+
+    // The oldest unanswered CALLs have been dropped
+    EXPECT_FALSE(index.take_call("899", false, start + 1s).has_value());
+    EXPECT_EQ(index.take_call("900", false, start + 1s), "Heartbeat");
+}
+
+TEST(MessageCorrelationIndexTest, ExpiresUnansweredCalls) {
+    MessageCorrelationIndex index(100, 60s);
+    index.add_call("1", "Authorize", true, start);
+    index.add_call("2", "Authorize", true, start + 30s);
+
+    index.add_call("3", "Heartbeat", true, start + 61s);
+    EXPECT_EQ(index.size(), 2);
+    EXPECT_FALSE(index.take_call("1", false, start + 61s).has_value());
+    EXPECT_EQ(index.take_call("2", false, start + 61s), "Authorize");
+}
+
+TEST(MessageCorrelationIndexTest, CalculatesResponseTimePercentiles) {
+    MessageCorrelationIndex index;
+    for (int i = 1; i <= 100; i++) {
+        const auto id = std::to_string(i);
+        index.add_call(id, "MeterValues", true, start);
+        index.take_call(id, false, start + std::chrono::milliseconds(i));
+    }
+
+    // CALLs of the CSMS are answered by the charge point, their response times are not recorded
+    index.add_call("csms", "GetConfiguration", false, start);
+    index.take_call("csms", true, start + 5s);
+
+    const auto stats = index.get_response_time_stats();
+    ASSERT_EQ(stats.size(), 1);
+    const auto& meter_values = stats.at("MeterValues");
+    EXPECT_EQ(meter_values.count, 100);
+    EXPECT_EQ(meter_values.p50, 50ms);
+    EXPECT_EQ(meter_values.p90, 90ms);
+    EXPECT_EQ(meter_values.p99, 99ms);
+    EXPECT_EQ(meter_values.max, 100ms);
+}
+
+TEST(MessageCorrelationIndexTest, KeepsMostRecentResponseTimes) {
+    MessageCorrelationIndex index;
+    for (size_t i = 0; i < MessageCorrelationIndex::RESPONSE_TIME_SAMPLES * 2; i++) {
+        const auto id = std::to_string(i);
+        const auto response_time = i < MessageCorrelationIndex::RESPONSE_TIME_SAMPLES ? 1000ms : 10ms;
+        index.add_call(id, "StatusNotification", true, start);
+        index.take_call(id, false, start + response_time);
+    }
+
+    const auto stats = index.get_response_time_stats().at("StatusNotification");
+    EXPECT_EQ(stats.count, MessageCorrelationIndex::RESPONSE_TIME_SAMPLES);
+    EXPECT_EQ(stats.max, 10ms);
+}
+
+TEST(MessageCorrelationIndexTest, MatchesResponsesWithCallsOfTheOtherSide) {
+    MessageCorrelationIndex index;
+    // Both sides choose their ids independently
+    index.add_call("1", "Heartbeat", true, start);
+    index.add_call("1", "GetConfiguration", false, start);
+    EXPECT_EQ(index.size(), 2);
+
+    // The response of the charge point answers the CALL of the CSMS
+    EXPECT_EQ(index.take_call("1", true, start + 10ms), "GetConfiguration");
+    EXPECT_FALSE(index.take_call("1", true, start + 10ms).has_value());
+    EXPECT_EQ(index.size(), 1);
+
+    EXPECT_EQ(index.take_call("1", false, start + 20ms), "Heartbeat");
+    EXPECT_EQ(index.size(), 0);
+
+    const auto stats = index.get_response_time_stats().at("Heartbeat");
+    EXPECT_EQ(stats.count, 1);
+    EXPECT_EQ(stats.max, 20ms);
+}
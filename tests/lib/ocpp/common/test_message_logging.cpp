@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include <ocpp/common/ocpp_logging.hpp>
+
+using namespace ocpp;
+
+namespace {
+
+class MessageLoggingTest : public ::testing::Test {
+protected:
+    std::filesystem::path log_path = std::filesystem::temp_directory_path() / "libocpp_test_message_logging";
+
+    void SetUp() override {
+        std::filesystem::remove_all(log_path);
+        std::filesystem::create_directories(log_path);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(log_path);
+    }
+
+    std::unique_ptr<MessageLogging> make_logging(LogQueueConfig log_queue_config, bool session_logging = false) {
+        return std::make_unique<MessageLogging>(true, log_path.string(), "test", false, false, true, false, false,
+                                                session_logging, nullptr, log_queue_config);
+    }
+
+    std::string read_file(const std::filesystem::path& path) {
+        std::ifstream ifs(path);
+        std::stringstream buffer;
+        buffer << ifs.rdbuf();
+        return buffer.str();
+    }
+
+    std::string read_log() {
+        return read_file(log_path / "test.log");
+    }
+
+    /// \brief Logs \p count CALLs from each of \p thread_count threads, their message ids are "<thread>-<index>"
+    void log_calls(MessageLogging& logging, int thread_count, int count) {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < thread_count; t++) {
+            threads.emplace_back([&logging, t, count]() {
+                for (int i = 0; i < count; i++) {
+                    logging.charge_point("Heartbeat", "[2,\"" + std::to_string(t) + "-" + std::to_string(i) +
+                                                          "\",\"Heartbeat\",{}]");
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    static size_t count_occurrences(const std::string& text, const std::string& pattern) {
+        size_t count = 0;
+        for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) {
+            count++;
+        }
+        return count;
+    }
+};
+
+} // namespace
+
+TEST_F(MessageLoggingTest, WritesQueuedMessagesInOrder) {
+    auto logging = make_logging(LogQueueConfig(8));
+    log_calls(*logging, 4, 250);
+    logging->flush();
+
+    const auto log = read_log();
+    EXPECT_EQ(count_occurrences(log, "ChargePoint>CentralSystem Heartbeat"), 1000);
+
+    // The messages of every thread are written in the order they were logged
+    for (int t = 0; t < 4; t++) {
+        size_t last_pos = 0;
+        for (int i = 0; i < 250; i++) {
+            const auto pos = log.find("\"" + std::to_string(t) + "-" + std::to_string(i) + "\"");
+            ASSERT_NE(pos, std::string::npos);
+            EXPECT_GT(pos, last_pos);
+            last_pos = pos;
+        }
+    }
+}
+
+TEST_F(MessageLoggingTest, DestructorWritesRemainingMessages) {
+    {
+        auto logging = make_logging(LogQueueConfig(1024));
+        log_calls(*logging, 1, 500);
+    }
+
+    EXPECT_EQ(count_occurrences(read_log(), "ChargePoint>CentralSystem Heartbeat"), 500);
+}
+
+TEST_F(MessageLoggingTest, DropPolicyReportsDroppedMessages) {
+    {
+        auto logging = make_logging(LogQueueConfig(2, LogQueueFullPolicy::Drop));
+        log_calls(*logging, 4, 2500);
+    }
+
+    const auto log = read_log();
+    size_t dropped = 0;
+    const std::regex dropped_regex("Dropped ([0-9]+) messages");
+    for (auto it = std::sregex_iterator(log.begin(), log.end(), dropped_regex); it != std::sregex_iterator(); ++it) {
+        dropped += std::stoul((*it)[1]);
+    }
+
+    // Every message is either written or counted as dropped
+    EXPECT_EQ(count_occurrences(log, "ChargePoint>CentralSystem Heartbeat") + dropped, 10000);
+}
+
+TEST_F(MessageLoggingTest, SynchronousLoggingWritesImmediately) {
+    auto logging = make_logging(LogQueueConfig(0));
+    logging->charge_point("Heartbeat", "[2,\"1\",\"Heartbeat\",{}]");
+
+    EXPECT_EQ(count_occurrences(read_log(), "ChargePoint>CentralSystem Heartbeat"), 1);
+}
+
+TEST_F(MessageLoggingTest, SessionLogContainsQueuedMessages) {
+    auto logging = make_logging(LogQueueConfig(1024), true);
+    const auto session_path = log_path / "session";
+    std::filesystem::create_directories(session_path);
+
+    logging->start_session_logging("session", session_path.string());
+    logging->charge_point("StartTransaction", "[2,\"1\",\"StartTransaction\",{}]");
+    logging->central_system("StartTransactionResponse", "[3,\"1\",{}]");
+    logging->stop_session_logging("session");
+
+    const auto session_log = read_file(session_path / "ocpp.html");
+    EXPECT_NE(session_log.find("StartTransaction"), std::string::npos);
+    EXPECT_NE(session_log.find("StartTransactionResponse"), std::string::npos);
+}
+
+TEST_F(MessageLoggingTest, RotatesLogBySize) {
+    {
+        MessageLogging logging(true, log_path.string(), "test", false, false, true, false, false, false, nullptr,
+                               LogRotationConfig(false, 1024, 3), LogQueueConfig(0));
+        for (int i = 0; i < 100; i++) {
+            logging.charge_point("Heartbeat", "[2,\"" + std::to_string(i) + "\",\"Heartbeat\",{}]");
+        }
+    }
+
+    // The newest rotated files are kept next to the current file
+    std::vector<std::string> files;
+    for (const auto& entry : std::filesystem::directory_iterator(log_path)) {
+        files.push_back(entry.path().filename().string());
+    }
+    EXPECT_EQ(files.size(), 3);
+    EXPECT_NE(read_log().find("\"99\""), std::string::npos);
+}
+
+TEST_F(MessageLoggingTest, SessionLogsShareFormattedMessages) {
+    auto logging = make_logging(LogQueueConfig(1024), true);
+    logging->charge_point("StartTransaction", "[2,\"1\",\"StartTransaction\",{\"connectorId\":1}]");
+
+    std::vector<std::filesystem::path> session_paths;
+    for (int i = 0; i < 3; i++) {
+        session_paths.push_back(log_path / ("session" + std::to_string(i)));
+        std::filesystem::create_directories(session_paths.back());
+        logging->start_session_logging(std::to_string(i), session_paths.back().string());
+    }
+
+    // The response is named after the CALL, even in session logs that have been started after it
+    logging->central_system("StartTransactionResponse", "[3,\"1\",{\"transactionId\":42}]");
+    for (int i = 0; i < 3; i++) {
+        logging->stop_session_logging(std::to_string(i));
+    }
+
+    for (const auto& session_path : session_paths) {
+        const auto session_log = read_file(session_path / "ocpp.html");
+        EXPECT_NE(session_log.find("<b>StartTransactionResponse</b>"), std::string::npos);
+        EXPECT_NE(session_log.find("\"transactionId\": 42"), std::string::npos);
+    }
+}
+
+TEST_F(MessageLoggingTest, ReportsResponseTimesOfCsms) {
+    {
+        auto logging = make_logging(LogQueueConfig(0));
+        logging->charge_point("BootNotification", "[2,\"1\",\"BootNotification\",{}]");
+        logging->central_system("BootNotification", "[3,\"1\",{\"status\":\"Accepted\"}]");
+        logging->charge_point("Authorize", "[2,\"2\",\"Authorize\",{}]");
+        logging->central_system("Authorize", "[4,\"2\",\"InternalError\",\"\",{}]");
+
+        const auto stats = logging->get_response_time_stats();
+        EXPECT_EQ(stats.size(), 2);
+        EXPECT_EQ(stats.at("BootNotification").count, 1);
+        EXPECT_EQ(stats.at("Authorize").count, 1);
+    }
+
+    const auto log = read_log();
+    EXPECT_NE(log.find("CentralSystem>ChargePoint  BootNotificationResponse"), std::string::npos);
+    EXPECT_NE(log.find("Response times of the CSMS for BootNotification: 1 responses"), std::string::npos);
+}
+
+TEST_F(MessageLoggingTest, ReportsResponseTimesWithoutTextLog) {
+    // Only the binary log is written, the messages are not formatted
+    MessageLogging logging(true, log_path.string(), "test", false, false, false, false, false, false, nullptr,
+                           LogQueueConfig(0), true);
+    logging.charge_point("BootNotification", "[2,\"1\",\"BootNotification\",{\"chargePointVendor\":\"v\"}]");
+    logging.central_system("BootNotification", "[3,\"1\",{\"status\":\"Accepted\",\"interval\":[1,2]}]");
+    logging.charge_point("Authorize", "[2,\"2\",\"Authorize\",{}]");
+    logging.central_system("Authorize", "[4,\"2\",\"InternalError\",\"\",{}]");
+    logging.central_system("Reset", "[2,\"3\",\"Reset\",{}]");
+
+    const auto stats = logging.get_response_time_stats();
+    EXPECT_EQ(stats.size(), 2);
+    EXPECT_EQ(stats.at("BootNotification").count, 1);
+    EXPECT_EQ(stats.at("Authorize").count, 1);
+    EXPECT_FALSE(std::filesystem::exists(log_path / "test.log"));
+}
@@ -1,5 +1,9 @@
 // SPDX-License-Identifier: Apache-2.0
 // Copyright 2020 - 2023 Pionix GmbH and Contributors to EVerest
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
@@ -127,10 +131,82 @@ template <> bool ControlMessage<TestMessageType>::is_transaction_update_message(
     return this->messageType == TestMessageType::TRANSACTIONAL_UPDATE;
 }
 
+template <> std::optional<std::string> ControlMessage<TestMessageType>::transaction_id() const {
+    if (this->serialized.has_value()) {
+        return this->serialized->transaction_id;
+    }
+    // transactional test messages carry their transaction in the data field
+    if (is_transaction_message(this->messageType)) {
+        return this->message[CALL_PAYLOAD].value("data", "");
+    }
+    return std::nullopt;
+}
+
+std::optional<std::string> get_transaction_id(const TestRequest& request) {
+    if (is_transaction_message(request.type)) {
+        return request.data.value_or("");
+    }
+    return std::nullopt;
+}
+
+bool is_transaction_update_request(const TestRequest& request) {
+    return request.type == TestMessageType::TRANSACTIONAL_UPDATE;
+}
+
+template <> std::optional<std::string> ControlMessage<TestMessageType>::replay_ordering_key() const {
+    if (this->messageType == TestMessageType::BootNotification) {
+        return std::nullopt;
+    }
+    if (is_transaction_message(this->messageType)) {
+        return this->transaction_id();
+    }
+    return this->uniqueId().get();
+}
+
 bool is_boot_notification_message(const TestMessageType message_type) {
     return message_type == TestMessageType::BootNotification;
 }
 
+/************************************************************************************************
+ * IndexedMessageQueue
+ */
+
+static std::shared_ptr<ControlMessage<TestMessageType>> make_control_message(const TestMessageType message_type,
+                                                                             const std::string& unique_id,
+                                                                             const std::string& data) {
+    return std::make_shared<ControlMessage<TestMessageType>>(
+        json{2, unique_id, to_string(message_type), json{{"data", data}}});
+}
+
+TEST(IndexedMessageQueueTest, test_lookup_and_fifo_order) {
+    IndexedMessageQueue<TestMessageType> queue;
+    queue.push_back(make_control_message(TestMessageType::TRANSACTIONAL, "1", "tx1"));
+    queue.push_back(make_control_message(TestMessageType::TRANSACTIONAL_UPDATE, "2", "tx1"));
+    queue.push_back(make_control_message(TestMessageType::TRANSACTIONAL, "3", "tx2"));
+    queue.push_front(make_control_message(TestMessageType::NON_TRANSACTIONAL, "0", "none"));
+
+    std::vector<std::string> order;
+    for (const auto& message : queue) {
+        order.push_back(message->uniqueId().get());
+    }
+    EXPECT_EQ(order, (std::vector<std::string>{"0", "1", "2", "3"}));
+
+    EXPECT_TRUE(queue.contains_transaction("tx1"));
+    EXPECT_EQ(queue.count("tx1", TestMessageType::TRANSACTIONAL_UPDATE), 1);
+    EXPECT_EQ(queue.count(TestMessageType::TRANSACTIONAL), 2);
+    ASSERT_EQ(queue.get_transaction_update_messages().size(), 1);
+
+    queue.erase(queue.find("2"));
+    queue.erase(queue.find("1"));
+    EXPECT_FALSE(queue.contains_transaction("tx1"));
+    EXPECT_TRUE(queue.get_transaction_update_messages().empty());
+    EXPECT_EQ(queue.find("1"), queue.end());
+    EXPECT_EQ(queue.size(), 2);
+
+    queue.pop_front();
+    EXPECT_EQ(queue.front()->uniqueId().get(), "3");
+}
+
 /************************************************************************************************
  * MessageQueueTest
  */
@@ -147,11 +223,19 @@ public:
     MOCK_METHOD(std::vector<common::DBTransactionMessage>, get_message_queue_messages, (const QueueType), (override));
     MOCK_METHOD(void, insert_message_queue_message, (const common::DBTransactionMessage&, const QueueType), (override));
     MOCK_METHOD(void, remove_message_queue_message, (const std::string&, const QueueType), (override));
+    MOCK_METHOD(void, update_message_queue,
+                ((const std::vector<std::pair<common::DBTransactionMessage, QueueType>>&),
+                 (const std::vector<std::pair<std::string, QueueType>>&)),
+                (override));
 };
 
+using SerializedSendCallbackMock =
+    testing::MockFunction<bool(const std::string& message, const std::function<void(bool sent)>& on_sent)>;
+
 class MessageQueueTest : public ::testing::Test {
     int internal_message_count{0};
     int call_count{0};
+    int pending_responses{0};
 
 protected:
     MessageQueueConfig<TestMessageType> config{};
@@ -167,20 +251,30 @@ protected:
         return call_count;
     }
 
-    template <typename R> auto MarkAndReturn(R value, bool respond = false) {
-        return testing::Invoke([this, value, respond](const json::array_t& s) -> R {
-            if (respond) {
-                reception_timer.timeout(
-                    [this, s]() {
-                        this->message_queue->receive(json{3, s[1], ""}.dump());
-                    },
-                    std::chrono::milliseconds(0));
+    template <typename R> R mark_and_return(const json::array_t& s, R value, bool respond = false) {
+        if (respond) {
+            {
+                std::lock_guard<std::mutex> lock(call_marker_mutex);
+                this->pending_responses++;
             }
-            std::lock_guard<std::mutex> lock(call_marker_mutex);
-            this->call_count++;
-            this->call_marker_cond_var.notify_one();
-            return value;
-        });
+            reception_timer.timeout(
+                [this, s]() {
+                    this->message_queue->receive(json{3, s[1], ""}.dump());
+                    std::lock_guard<std::mutex> lock(call_marker_mutex);
+                    this->pending_responses--;
+                    this->call_marker_cond_var.notify_all();
+                },
+                std::chrono::milliseconds(0));
+        }
+        std::lock_guard<std::mutex> lock(call_marker_mutex);
+        this->call_count++;
+        this->call_marker_cond_var.notify_one();
+        return value;
+    }
+
+    template <typename R> auto MarkAndReturn(R value, bool respond = false) {
+        return testing::Invoke(
+            [this, value, respond](const json::array_t& s) -> R { return this->mark_and_return(s, value, respond); });
     };
 
     void wait_for_calls(int expected_calls = 1) {
@@ -231,6 +325,13 @@ protected:
     }
 
     void TearDown() override {
+        {
+            // let the last scheduled response arrive, it must not reach the destroyed message queue
+            std::unique_lock<std::mutex> lock(call_marker_mutex);
+            call_marker_cond_var.wait_for(lock, std::chrono::seconds(1),
+                                          [this] { return this->pending_responses == 0; });
+        }
+        reception_timer.stop();
         message_queue->stop();
     };
 };
@@ -322,6 +423,19 @@ TEST_F(MessageQueueTest, test_non_queuing_up_of_non_transactional_messages) {
     EXPECT_EQ(1, get_call_count());
 }
 
+// \brief Test that a received CALL is parsed into message and call_message
+TEST_F(MessageQueueTest, test_received_call_is_available_as_call_message) {
+    const auto call = json{2, "42", to_string(TestMessageType::NON_TRANSACTIONAL), json{{"data", "test"}}};
+
+    const auto enhanced_message = message_queue->receive(call.dump());
+
+    EXPECT_EQ(enhanced_message.messageTypeId, MessageTypeId::CALL);
+    EXPECT_EQ(enhanced_message.uniqueId.get(), "42");
+    EXPECT_EQ(enhanced_message.messageType, TestMessageType::NON_TRANSACTIONAL);
+    EXPECT_EQ(enhanced_message.message, call);
+    EXPECT_EQ(enhanced_message.call_message, call);
+}
+
 // \brief Test that if queue_all_messages is set to true, non-transactional messages that are sent when online again
 TEST_F(MessageQueueTest, test_queuing_up_of_non_transactional_messages) {
     config.queue_all_messages = true;
@@ -480,4 +594,370 @@ TEST_F(MessageQueueTest, test_clean_up_transactional_queue) {
     wait_for_calls(expected_sent_messages);
 }
 
+// \brief Test that persisted message queue updates are committed as a group
+TEST_F(MessageQueueTest, test_persisted_updates_are_grouped) {
+    config.queue_db_flush_interval_ms = 60000;
+    restart_message_queue();
+    message_queue->pause();
+
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, testing::_)).Times(0);
+    EXPECT_CALL(*db, update_message_queue(testing::SizeIs(3), testing::IsEmpty())).Times(1);
+
+    for (int i = 0; i < 3; i++) {
+        push_message_call(TestMessageType::TRANSACTIONAL);
+    }
+
+    message_queue->flush();
+}
+
+// \brief Test that persisted message queue updates are committed once the maximum group size is reached
+TEST_F(MessageQueueTest, test_persisted_updates_are_flushed_on_max_operations) {
+    config.queue_db_flush_interval_ms = 60000;
+    config.queue_db_flush_max_operations = 2;
+    restart_message_queue();
+    message_queue->pause();
+
+    EXPECT_CALL(*db, update_message_queue(testing::SizeIs(2), testing::IsEmpty())).Times(1);
+
+    push_message_call(TestMessageType::TRANSACTIONAL);
+    push_message_call(TestMessageType::TRANSACTIONAL);
+
+    testing::Mock::VerifyAndClearExpectations(db.get());
+}
+
+// \brief Test that messages are written to json text directly if a serialized send callback is registered
+TEST_F(MessageQueueTest, test_serialized_messages_are_sent) {
+    SerializedSendCallbackMock serialized_send_callback_mock;
+    message_queue->stop();
+    message_queue = std::make_unique<MessageQueue<TestMessageType>>(send_callback_mock.AsStdFunction(), config, db);
+    message_queue->register_serialized_send_callback(serialized_send_callback_mock.AsStdFunction());
+    message_queue->start();
+    message_queue->set_registration_status_accepted();
+    message_queue->resume(std::chrono::seconds(0));
+
+    const std::string call_text = R"([2,"0","transactional",{"data":"test_\"data\""}])";
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).Times(0);
+    // the text is persisted as it is, it is not serialized a second time
+    const auto persisted_text = testing::Field(&common::DBTransactionMessage::serialized_json_message, call_text);
+    EXPECT_CALL(*db, insert_message_queue_message(persisted_text, testing::_));
+    bool call_sent = false;
+    EXPECT_CALL(serialized_send_callback_mock, Call(call_text, testing::_))
+        .WillOnce(testing::Invoke([this, &call_sent](const std::string&, const std::function<void(bool sent)>&) {
+            std::lock_guard<std::mutex> lock(call_marker_mutex);
+            call_sent = true;
+            this->call_marker_cond_var.notify_one();
+            return true;
+        }));
+    EXPECT_CALL(serialized_send_callback_mock, Call(R"([3,"1",{"data":"result"}])", testing::_))
+        .WillOnce(testing::Return(true));
+    EXPECT_CALL(serialized_send_callback_mock, Call(R"([4,"2","NotImplemented","",{}])", testing::_))
+        .WillOnce(testing::Return(true));
+
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::TRANSACTIONAL;
+    call.msg.data = "test_\"data\"";
+    call.uniqueId = "0";
+    message_queue->push(call);
+
+    TestRequest result;
+    result.data = "result";
+    message_queue->push(CallResult<TestRequest>(result, MessageId("1")));
+    message_queue->push(CallError(MessageId("2"), "NotImplemented", "", json({}, true)));
+
+    std::unique_lock<std::mutex> lock(call_marker_mutex);
+    EXPECT_TRUE(call_marker_cond_var.wait_for(lock, std::chrono::seconds(3), [&call_sent] { return call_sent; }));
+}
+
+// \brief Test that the CALLRESULT of a CALL that was sent as json text carries the text, which is parsed on demand only
+TEST_F(MessageQueueTest, test_call_result_carries_the_serialized_call) {
+    SerializedSendCallbackMock serialized_send_callback_mock;
+    message_queue->stop();
+    message_queue = std::make_unique<MessageQueue<TestMessageType>>(send_callback_mock.AsStdFunction(), config, db);
+    message_queue->register_serialized_send_callback(serialized_send_callback_mock.AsStdFunction());
+    message_queue->start();
+    message_queue->set_registration_status_accepted();
+    message_queue->resume(std::chrono::seconds(0));
+
+    const std::string call_text = R"([2,"0","transactional",{"data":"tx1"}])";
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, testing::_));
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, testing::_));
+    bool call_sent = false;
+    EXPECT_CALL(serialized_send_callback_mock, Call(call_text, testing::_))
+        .WillOnce(testing::Invoke([this, &call_sent](const std::string&, const std::function<void(bool sent)>&) {
+            std::lock_guard<std::mutex> lock(call_marker_mutex);
+            call_sent = true;
+            this->call_marker_cond_var.notify_one();
+            return true;
+        }));
+
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::TRANSACTIONAL;
+    call.msg.data = "tx1";
+    call.uniqueId = "0";
+    auto future = message_queue->push_async(call);
+    {
+        std::unique_lock<std::mutex> lock(call_marker_mutex);
+        ASSERT_TRUE(call_marker_cond_var.wait_for(lock, std::chrono::seconds(3), [&call_sent] { return call_sent; }));
+    }
+
+    const auto enhanced_message = message_queue->receive(R"([3,"0",{}])");
+    EXPECT_EQ(enhanced_message.messageType, TestMessageType::TRANSACTIONAL_RESPONSE);
+    EXPECT_TRUE(enhanced_message.call_message.is_null());
+    ASSERT_NE(enhanced_message.call_message_text, nullptr);
+    EXPECT_EQ(*enhanced_message.call_message_text, call_text);
+    EXPECT_EQ(enhanced_message.get_call_message(), json::parse(call_text));
+
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(3)), std::future_status::ready);
+    EXPECT_EQ(future.get().get_call_message(), json::parse(call_text));
+}
+
+// \brief Test that a transactional message that the transport accepted, but dropped because the connection was closed,
+// pauses the queue and is sent again once the queue is resumed instead of waiting for its timeout
+TEST_F(MessageQueueTest, test_dropped_transactional_message_is_sent_again) {
+    SerializedSendCallbackMock serialized_send_callback_mock;
+    message_queue->stop();
+    config.message_timeout_seconds = 60;
+    message_queue = std::make_unique<MessageQueue<TestMessageType>>(send_callback_mock.AsStdFunction(), config, db);
+    message_queue->register_serialized_send_callback(serialized_send_callback_mock.AsStdFunction());
+    message_queue->start();
+    message_queue->set_registration_status_accepted();
+    message_queue->resume(std::chrono::seconds(0));
+
+    const std::string call_text = R"([2,"0","transactional",{"data":"tx1"}])";
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, testing::_));
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, testing::_));
+    std::function<void(bool sent)> on_sent;
+    int sent_count = 0;
+    EXPECT_CALL(serialized_send_callback_mock, Call(call_text, testing::_))
+        .Times(2)
+        .WillRepeatedly(testing::Invoke(
+            [this, &on_sent, &sent_count](const std::string&, const std::function<void(bool sent)>& callback) {
+                std::lock_guard<std::mutex> lock(call_marker_mutex);
+                on_sent = callback;
+                sent_count++;
+                this->call_marker_cond_var.notify_one();
+                return true;
+            }));
+    auto wait_for_sent = [this, &sent_count](int count) {
+        std::unique_lock<std::mutex> lock(call_marker_mutex);
+        return call_marker_cond_var.wait_for(lock, std::chrono::seconds(3),
+                                             [&sent_count, count] { return sent_count >= count; });
+    };
+
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::TRANSACTIONAL;
+    call.msg.data = "tx1";
+    call.uniqueId = "0";
+    auto future = message_queue->push_async(call);
+    ASSERT_TRUE(wait_for_sent(1));
+
+    // the connection is closed while the message is still in the send queue of the websocket
+    message_queue->pause();
+    on_sent(false);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(future.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+
+    // the message is sent again right after reconnecting, not after its timeout
+    message_queue->resume(std::chrono::seconds(0));
+    ASSERT_TRUE(wait_for_sent(2));
+    message_queue->receive(R"([3,"0",{}])");
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(3)), std::future_status::ready);
+    EXPECT_FALSE(future.get().offline);
+
+    // a late report for the delivered message is ignored
+    on_sent(false);
+}
+
+// \brief Test that a non-transactional message that the transport dropped is reported as offline and not sent again
+TEST_F(MessageQueueTest, test_dropped_non_transactional_message_is_reported_offline) {
+    SerializedSendCallbackMock serialized_send_callback_mock;
+    message_queue->stop();
+    message_queue = std::make_unique<MessageQueue<TestMessageType>>(send_callback_mock.AsStdFunction(), config, db);
+    message_queue->register_serialized_send_callback(serialized_send_callback_mock.AsStdFunction());
+    message_queue->start();
+    message_queue->set_registration_status_accepted();
+    message_queue->resume(std::chrono::seconds(0));
+
+    EXPECT_CALL(serialized_send_callback_mock, Call(testing::_, testing::_))
+        .WillOnce(testing::Invoke([](const std::string&, const std::function<void(bool sent)>& on_sent) {
+            // dropped right away, e.g. because the connection is closed at the same time
+            std::thread([on_sent]() { on_sent(false); }).detach();
+            return true;
+        }));
+
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::NON_TRANSACTIONAL;
+    call.uniqueId = "0";
+    auto future = message_queue->push_async(call);
+    ASSERT_EQ(future.wait_for(std::chrono::seconds(3)), std::future_status::ready);
+    EXPECT_TRUE(future.get().offline);
+}
+
+// \brief Test that responses are written into the send buffers provided by the writer send callback
+TEST_F(MessageQueueTest, test_responses_are_written_into_send_buffers) {
+    SerializedSendCallbackMock serialized_send_callback_mock;
+    message_queue->stop();
+    message_queue = std::make_unique<MessageQueue<TestMessageType>>(send_callback_mock.AsStdFunction(), config, db);
+    message_queue->register_serialized_send_callback(serialized_send_callback_mock.AsStdFunction());
+
+    // the transport keeps headroom for its frame header in front of the written text
+    constexpr size_t headroom = 16;
+    std::vector<std::string> buffers;
+    message_queue->register_writer_send_callback(
+        [&buffers, headroom](const std::function<void(JsonWriter& writer)>& write) {
+            JsonWriter writer(std::string(), headroom);
+            write(writer);
+            buffers.push_back(writer.release());
+            return true;
+        });
+    message_queue->start();
+
+    EXPECT_CALL(send_callback_mock, Call(testing::_)).Times(0);
+    EXPECT_CALL(serialized_send_callback_mock, Call(testing::_, testing::_)).Times(0);
+
+    TestRequest result;
+    result.data = "result";
+    message_queue->push(CallResult<TestRequest>(result, MessageId("1")));
+    message_queue->push(CallError(MessageId("2"), "NotImplemented", "", json({}, true)));
+
+    ASSERT_EQ(buffers.size(), 2);
+    EXPECT_EQ(buffers.at(0).substr(headroom), R"([3,"1",{"data":"result"}])");
+    EXPECT_EQ(buffers.at(1).substr(headroom), R"([4,"2","NotImplemented","",{}])");
+}
+
+// \brief Test that a backlog of transactional messages is replayed with several messages in flight
+TEST_F(MessageQueueTest, test_pipelined_replay_of_transactional_messages) {
+    config.replay_window = 3;
+    config.queues_total_size_threshold = 100;
+    restart_message_queue();
+    message_queue->pause();
+
+    std::optional<ReplayProgress> final_progress;
+    message_queue->register_replay_progress_callback(
+        [&final_progress](const ReplayProgress& progress) { final_progress = progress; });
+
+    // two transactions; the messages of each transaction have to be sent one after another
+    push_message_call(TestMessageType::TRANSACTIONAL, "tx1");
+    push_message_call(TestMessageType::TRANSACTIONAL, "tx2");
+    Call<TestRequest> call;
+    call.msg.type = TestMessageType::TRANSACTIONAL_UPDATE;
+    call.msg.data = "tx1";
+    call.uniqueId = "tx1_update";
+    message_queue->push(call);
+
+    std::vector<std::string> sent_ids;
+    std::mutex sent_ids_mutex;
+    EXPECT_CALL(send_callback_mock, Call(testing::_))
+        .Times(3)
+        .WillRepeatedly(testing::Invoke([&](const json::array_t& s) {
+            {
+                std::lock_guard<std::mutex> lock(sent_ids_mutex);
+                sent_ids.push_back(s[1].get<std::string>());
+            }
+            return this->mark_and_return(s, true);
+        }));
+
+    message_queue->resume(std::chrono::seconds(0));
+
+    // both transactions are in flight at the same time, the update has to wait for its predecessor
+    wait_for_calls(2);
+    {
+        std::lock_guard<std::mutex> lock(sent_ids_mutex);
+        EXPECT_EQ(sent_ids, (std::vector<std::string>{"tx1", "tx2"}));
+    }
+
+    message_queue->receive(json{3, "tx2", ""}.dump());
+    message_queue->receive(json{3, "tx1", ""}.dump());
+    wait_for_calls(3);
+    {
+        std::lock_guard<std::mutex> lock(sent_ids_mutex);
+        EXPECT_EQ(sent_ids.back(), "tx1_update");
+    }
+
+    message_queue->receive(json{3, "tx1_update", ""}.dump());
+    ASSERT_TRUE(final_progress.has_value());
+    EXPECT_EQ(final_progress->total, 3);
+    EXPECT_EQ(final_progress->delivered, 3);
+    EXPECT_EQ(final_progress->remaining, 0);
+}
+
+// \brief Pushes transactional messages from several threads while the worker is busy sending and returns the sorted
+// durations of the push() calls
+static std::vector<std::chrono::nanoseconds> measure_push_latency(MessageQueue<TestMessageType>& message_queue,
+                                                                  const int producers, const int pushes_per_producer) {
+    std::vector<std::chrono::nanoseconds> durations(producers * pushes_per_producer);
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; producer++) {
+        threads.emplace_back([&, producer]() {
+            for (int i = 0; i < pushes_per_producer; i++) {
+                Call<TestRequest> call;
+                call.msg.type = TestMessageType::TRANSACTIONAL;
+                call.msg.data = "tx" + std::to_string(producer);
+                call.uniqueId = std::to_string(producer) + "_" + std::to_string(i);
+                const auto start = std::chrono::steady_clock::now();
+                message_queue.push(call);
+                durations[producer * pushes_per_producer + i] = std::chrono::steady_clock::now() - start;
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    std::sort(durations.begin(), durations.end());
+    return durations;
+}
+
+// \brief Prints the p50, p99, p99.9 and maximum of the sorted \p durations and records them as test properties
+static void report_push_latency(const std::string& name, const std::vector<std::chrono::nanoseconds>& durations) {
+    auto percentile = [&durations](const double p) {
+        const auto index = std::min(durations.size() - 1, static_cast<size_t>(p * durations.size()));
+        return std::chrono::duration_cast<std::chrono::microseconds>(durations[index]).count();
+    };
+    std::cout << "push() latency " << name << ": p50=" << percentile(0.5) << "us p99=" << percentile(0.99)
+              << "us p99.9=" << percentile(0.999) << "us max=" << percentile(1.0) << "us" << std::endl;
+    ::testing::Test::RecordProperty("push_latency_p50_us", std::to_string(percentile(0.5)));
+    ::testing::Test::RecordProperty("push_latency_p99_us", std::to_string(percentile(0.99)));
+    ::testing::Test::RecordProperty("push_latency_p99_9_us", std::to_string(percentile(0.999)));
+    ::testing::Test::RecordProperty("push_latency_max_us", std::to_string(percentile(1.0)));
+}
+
+class MessageQueueIngressTest : public MessageQueueTest, public ::testing::WithParamInterface<int> {};
+
+// \brief Test that transactional messages pushed from several threads while the worker is busy sending are all
+// delivered, with the messages of every producer in the order they were pushed. The tail latency of push() is reported
+// as a benchmark of the ingress ring against the locked queue
+TEST_P(MessageQueueIngressTest, test_concurrent_pushes_are_delivered_in_order) {
+    const int producers = 4;
+    const int pushes_per_producer = 200;
+    config.queues_total_size_threshold = producers * pushes_per_producer;
+    config.ingress_ring_capacity = GetParam();
+    restart_message_queue();
+
+    EXPECT_CALL(*db, insert_message_queue_message(testing::_, testing::_)).Times(producers * pushes_per_producer);
+    EXPECT_CALL(*db, remove_message_queue_message(testing::_, testing::_)).Times(testing::AnyNumber());
+    std::vector<int> last_sent(producers, -1);
+    bool in_order = true;
+    EXPECT_CALL(send_callback_mock, Call(testing::_))
+        .WillRepeatedly(testing::Invoke([&](const json::array_t& s) {
+            const auto unique_id = s[1].get<std::string>();
+            const auto separator = unique_id.find('_');
+            const auto producer = std::stoi(unique_id.substr(0, separator));
+            const auto index = std::stoi(unique_id.substr(separator + 1));
+            // only the worker thread sends, so no lock is needed
+            in_order = in_order and index > last_sent[producer];
+            last_sent[producer] = index;
+            std::this_thread::sleep_for(std::chrono::microseconds(200));
+            return this->mark_and_return(s, true, true);
+        }));
+
+    const auto durations = measure_push_latency(*message_queue, producers, pushes_per_producer);
+    report_push_latency(GetParam() > 0 ? "with ingress ring" : "without ingress ring", durations);
+
+    wait_for_calls(producers * pushes_per_producer);
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(last_sent, std::vector<int>(producers, pushes_per_producer - 1));
+}
+
+INSTANTIATE_TEST_SUITE_P(IngressRing, MessageQueueIngressTest, testing::Values(0, 1024));
+
 } // namespace ocpp
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <ocpp/common/mpsc_ring_buffer.hpp>
+
+namespace ocpp {
+
+TEST(MpscRingBufferTest, test_push_pop_and_full) {
+    MpscRingBuffer<int> ring(3);
+    EXPECT_EQ(ring.capacity(), 4);
+    EXPECT_TRUE(ring.empty());
+
+    for (int i = 0; i < 4; i++) {
+        EXPECT_TRUE(ring.try_push(i));
+    }
+    int value = 4;
+    EXPECT_FALSE(ring.try_push(value));
+
+    for (int i = 0; i < 4; i++) {
+        ASSERT_TRUE(ring.try_pop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(ring.try_pop(value));
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(MpscRingBufferTest, test_concurrent_producers) {
+    const int producers = 4;
+    const int values_per_producer = 10000;
+    MpscRingBuffer<int> ring(64);
+
+    std::vector<std::thread> threads;
+    for (int producer = 0; producer < producers; producer++) {
+        threads.emplace_back([&ring, producer]() {
+            for (int i = 0; i < values_per_producer; i++) {
+                int value = producer * values_per_producer + i;
+                while (!ring.try_push(value)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // values of every producer have to arrive in the order they were pushed
+    std::vector<int> last_value(producers, -1);
+    int received = 0;
+    while (received < producers * values_per_producer) {
+        int value;
+        if (!ring.try_pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+        const auto producer = value / values_per_producer;
+        EXPECT_GT(value, last_value[producer]);
+        last_value[producer] = value;
+        received++;
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_TRUE(ring.empty());
+}
+
+} // namespace ocpp
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <openssl/bio.h>
+#include <openssl/evp.h>
+#include <openssl/ssl.h>
+#include <openssl/x509.h>
+
+#include "ocpp/common/websocket/tls_session_cache.hpp"
+
+using namespace ocpp;
+
+namespace {
+
+struct SslCtxDeleter {
+    void operator()(SSL_CTX* ctx) const {
+        SSL_CTX_free(ctx);
+    }
+};
+using SslCtxPtr = std::unique_ptr<SSL_CTX, SslCtxDeleter>;
+
+/// \brief Creates a server context with a self signed certificate
+SslCtxPtr make_server_ctx() {
+    EVP_PKEY* key = nullptr;
+    EVP_PKEY_CTX* key_ctx = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, nullptr);
+    EVP_PKEY_keygen_init(key_ctx);
+    EVP_PKEY_CTX_set_ec_paramgen_curve_nid(key_ctx, NID_X9_62_prime256v1);
+    EVP_PKEY_keygen(key_ctx, &key);
+    EVP_PKEY_CTX_free(key_ctx);
+
+    X509* cert = X509_new();
+    X509_set_version(cert, 2);
+    ASN1_INTEGER_set(X509_get_serialNumber(cert), 1);
+    X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+    X509_gmtime_adj(X509_getm_notAfter(cert), 3600);
+    X509_set_pubkey(cert, key);
+    X509_NAME* name = X509_get_subject_name(cert);
+    X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC, reinterpret_cast<const unsigned char*>("csms"), -1, -1, 0);
+    X509_set_issuer_name(cert, name);
+    X509_sign(cert, key, EVP_sha256());
+
+    SslCtxPtr ctx(SSL_CTX_new(TLS_server_method()));
+    SSL_CTX_use_certificate(ctx.get(), cert);
+    SSL_CTX_use_PrivateKey(ctx.get(), key);
+
+    X509_free(cert);
+    EVP_PKEY_free(key);
+    return ctx;
+}
+
+SslCtxPtr make_client_ctx(int max_version = 0) {
+    SslCtxPtr ctx(SSL_CTX_new(TLS_client_method()));
+    SSL_CTX_set_verify(ctx.get(), SSL_VERIFY_NONE, nullptr);
+    if (max_version != 0) {
+        SSL_CTX_set_max_proto_version(ctx.get(), max_version);
+    }
+    return ctx;
+}
+
+/// \brief Runs a handshake between a client and a server over an in memory BIO pair, afterwards lets the client
+/// read the session tickets the server sent
+/// \returns true if the client resumed a session
+bool handshake(SSL_CTX* client_ctx, SSL_CTX* server_ctx) {
+    SSL* client = SSL_new(client_ctx);
+    SSL* server = SSL_new(server_ctx);
+    BIO* client_bio = nullptr;
+    BIO* server_bio = nullptr;
+    BIO_new_bio_pair(&client_bio, 0, &server_bio, 0);
+    SSL_set_bio(client, client_bio, client_bio);
+    SSL_set_bio(server, server_bio, server_bio);
+    SSL_set_connect_state(client);
+    SSL_set_accept_state(server);
+
+    bool client_done = false;
+    bool server_done = false;
+    for (int i = 0; i < 100 and not(client_done and server_done); i++) {
+        client_done = client_done or SSL_do_handshake(client) == 1;
+        server_done = server_done or SSL_do_handshake(server) == 1;
+    }
+    EXPECT_TRUE(client_done and server_done);
+
+    char buffer[16];
+    SSL_read(client, buffer, sizeof(buffer));
+
+    const bool reused = SSL_session_reused(client) == 1;
+    SSL_free(client);
+    SSL_free(server);
+    return reused;
+}
+
+size_t count_lines(const std::filesystem::path& file) {
+    std::ifstream ifs(file);
+    std::string line;
+    size_t count = 0;
+    while (std::getline(ifs, line)) {
+        count++;
+    }
+    return count;
+}
+
+class TlsSessionCacheTest : public ::testing::Test {
+protected:
+    SslCtxPtr server_ctx = make_server_ctx();
+    std::filesystem::path file = std::filesystem::temp_directory_path() / "libocpp_test_tls_sessions.txt";
+
+    void TearDown() override {
+        std::filesystem::remove(file);
+    }
+};
+
+} // namespace
+
+TEST_F(TlsSessionCacheTest, ResumesTls13SessionOnReconnect) {
+    auto cache = std::make_shared<TlsSessionCache>(std::nullopt);
+
+    auto first = make_client_ctx();
+    cache->attach(first.get(), "csms:443");
+    EXPECT_FALSE(handshake(first.get(), server_ctx.get()));
+    EXPECT_EQ(cache->size(), 1);
+
+    // Every reconnect uses a new client context, like a new connection of the websocket
+    for (int i = 0; i < 3; i++) {
+        auto next = make_client_ctx();
+        cache->attach(next.get(), "csms:443");
+        EXPECT_TRUE(handshake(next.get(), server_ctx.get()));
+
+        // The used ticket has been replaced by the tickets of the resumed connection
+        EXPECT_EQ(cache->size(), 1);
+    }
+}
+
+TEST_F(TlsSessionCacheTest, ResumesTls12SessionOnReconnect) {
+    auto cache = std::make_shared<TlsSessionCache>(std::nullopt);
+
+    auto first = make_client_ctx(TLS1_2_VERSION);
+    cache->attach(first.get(), "csms:443");
+    EXPECT_FALSE(handshake(first.get(), server_ctx.get()));
+
+    for (int i = 0; i < 3; i++) {
+        auto next = make_client_ctx(TLS1_2_VERSION);
+        cache->attach(next.get(), "csms:443");
+        EXPECT_TRUE(handshake(next.get(), server_ctx.get()));
+    }
+}
+
+TEST_F(TlsSessionCacheTest, DoesNotResumeSessionOfOtherKey) {
+    auto cache = std::make_shared<TlsSessionCache>(std::nullopt);
+
+    auto first = make_client_ctx();
+    cache->attach(first.get(), "csms:443|client-a");
+    EXPECT_FALSE(handshake(first.get(), server_ctx.get()));
+
+    auto other = make_client_ctx();
+    cache->attach(other.get(), "csms:443|client-b");
+    EXPECT_FALSE(handshake(other.get(), server_ctx.get()));
+    EXPECT_EQ(cache->size(), 2);
+}
+
+TEST_F(TlsSessionCacheTest, ResumesPersistedSessionAfterRestart) {
+    {
+        auto cache = std::make_shared<TlsSessionCache>(file);
+        auto first = make_client_ctx();
+        cache->attach(first.get(), "csms:443");
+        EXPECT_FALSE(handshake(first.get(), server_ctx.get()));
+    }
+
+    ASSERT_TRUE(std::filesystem::exists(file));
+    const auto perms = std::filesystem::status(file).permissions();
+    EXPECT_EQ(perms & (std::filesystem::perms::group_all | std::filesystem::perms::others_all),
+              std::filesystem::perms::none);
+
+    auto restarted = std::make_shared<TlsSessionCache>(file);
+    EXPECT_EQ(restarted->size(), 1);
+
+    auto next = make_client_ctx();
+    restarted->attach(next.get(), "csms:443");
+    EXPECT_TRUE(handshake(next.get(), server_ctx.get()));
+}
+
+TEST_F(TlsSessionCacheTest, DoesNotWriteThroughALinkAtTheTemporaryFile) {
+    const auto victim = std::filesystem::temp_directory_path() / "libocpp_test_tls_sessions_victim.txt";
+    std::filesystem::path tmp_file = file;
+    tmp_file += ".tmp";
+    std::ofstream(victim) << "victim\n";
+    const auto victim_perms = std::filesystem::status(victim).permissions();
+    std::filesystem::remove(tmp_file);
+    std::filesystem::create_symlink(victim, tmp_file);
+
+    {
+        auto cache = std::make_shared<TlsSessionCache>(file);
+        auto ctx = make_client_ctx();
+        cache->attach(ctx.get(), "csms:443");
+        EXPECT_FALSE(handshake(ctx.get(), server_ctx.get()));
+    }
+
+    // The link is replaced by a new file, the target of the link is not touched
+    EXPECT_EQ(count_lines(file), 1);
+    EXPECT_FALSE(std::filesystem::exists(std::filesystem::symlink_status(tmp_file)));
+    std::ifstream ifs(victim);
+    std::string content;
+    std::getline(ifs, content);
+    EXPECT_EQ(content, "victim");
+    EXPECT_EQ(std::filesystem::status(victim).permissions(), victim_perms);
+
+    std::filesystem::remove(victim);
+}
+
+TEST_F(TlsSessionCacheTest, IgnoresInvalidEntriesOfFile) {
+    {
+        std::ofstream ofs(file);
+        ofs << "no separator\n";
+        ofs << "csms:443\tnot hex\n";
+        ofs << "csms:443\t00ff00ff\n";
+    }
+
+    auto cache = std::make_shared<TlsSessionCache>(file);
+    EXPECT_EQ(cache->size(), 0);
+
+    auto ctx = make_client_ctx();
+    cache->attach(ctx.get(), "csms:443");
+    EXPECT_FALSE(handshake(ctx.get(), server_ctx.get()));
+}
+
+TEST_F(TlsSessionCacheTest, EvictsLeastRecentlyUsedSession) {
+    auto cache = std::make_shared<TlsSessionCache>(std::nullopt);
+
+    for (size_t i = 0; i < TlsSessionCache::MAX_SESSIONS; i++) {
+        auto ctx = make_client_ctx(TLS1_2_VERSION);
+        cache->attach(ctx.get(), "csms:443|client-" + std::to_string(i));
+        EXPECT_FALSE(handshake(ctx.get(), server_ctx.get()));
+    }
+    EXPECT_EQ(cache->size(), TlsSessionCache::MAX_SESSIONS);
+
+    // Resuming the oldest session makes the second one the least recently used
+    auto resumed = make_client_ctx(TLS1_2_VERSION);
+    cache->attach(resumed.get(), "csms:443|client-0");
+    EXPECT_TRUE(handshake(resumed.get(), server_ctx.get()));
+
+    auto added = make_client_ctx(TLS1_2_VERSION);
+    cache->attach(added.get(), "csms:443|client-new");
+    EXPECT_FALSE(handshake(added.get(), server_ctx.get()));
+    EXPECT_EQ(cache->size(), TlsSessionCache::MAX_SESSIONS);
+
+    auto first = make_client_ctx(TLS1_2_VERSION);
+    cache->attach(first.get(), "csms:443|client-0");
+    EXPECT_TRUE(handshake(first.get(), server_ctx.get()));
+
+    auto evicted = make_client_ctx(TLS1_2_VERSION);
+    cache->attach(evicted.get(), "csms:443|client-1");
+    EXPECT_FALSE(handshake(evicted.get(), server_ctx.get()));
+}
+
+TEST_F(TlsSessionCacheTest, CoalescesWritesOfNewSessions) {
+    auto cache = std::make_shared<TlsSessionCache>(file);
+
+    auto first = make_client_ctx();
+    cache->attach(first.get(), "csms:443|client-a");
+    EXPECT_FALSE(handshake(first.get(), server_ctx.get()));
+
+    // The first session is written right away, the following ones within the SAVE_INTERVAL are not
+    ASSERT_TRUE(std::filesystem::exists(file));
+    EXPECT_EQ(count_lines(file), 1);
+
+    auto other = make_client_ctx();
+    cache->attach(other.get(), "csms:443|client-b");
+    EXPECT_FALSE(handshake(other.get(), server_ctx.get()));
+    EXPECT_EQ(cache->size(), 2);
+    EXPECT_EQ(count_lines(file), 1);
+
+    cache->flush();
+    EXPECT_EQ(count_lines(file), 2);
+}
@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "ocpp/common/websocket/websocket_event_loop.hpp"
+
+using namespace ocpp;
+
+namespace {
+
+/// \brief Waits until the given \p condition is true, fails after a timeout
+template <typename Condition> bool wait_for(const Condition& condition) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+TEST(WebsocketEventLoopTest, TimeoutRunsOnceOnTheServiceThread) {
+    WebsocketEventLoop loop(1);
+    std::atomic<int> run_count{0};
+    std::atomic<bool> on_service_thread{false};
+
+    const auto start = std::chrono::steady_clock::now();
+    std::atomic<std::chrono::steady_clock::duration> elapsed{};
+    const auto id = loop.timeout(
+        [&]() {
+            elapsed = std::chrono::steady_clock::now() - start;
+            on_service_thread = loop.is_service_thread();
+            run_count++;
+        },
+        std::chrono::milliseconds(20));
+
+    EXPECT_NE(id, 0u);
+    ASSERT_TRUE(wait_for([&]() { return run_count == 1; }));
+    EXPECT_TRUE(on_service_thread);
+    EXPECT_GE(elapsed.load(), std::chrono::milliseconds(20));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(run_count, 1);
+}
+
+TEST(WebsocketEventLoopTest, IntervalRunsUntilItIsCancelled) {
+    WebsocketEventLoop loop(1);
+    std::atomic<int> run_count{0};
+
+    const auto id = loop.interval([&run_count]() { run_count++; }, std::chrono::milliseconds(5));
+    ASSERT_TRUE(wait_for([&]() { return run_count >= 3; }));
+
+    loop.cancel(id);
+    loop.run_sync([]() {});
+    const int count_after_cancel = run_count;
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(run_count, count_after_cancel);
+}
+
+TEST(WebsocketEventLoopTest, IntervalCanBeCancelledFromItsTask) {
+    WebsocketEventLoop loop(1);
+    std::atomic<int> run_count{0};
+    std::atomic<WebsocketEventLoop::TimerId> id{0};
+
+    loop.run_sync([&]() {
+        id = loop.interval(
+            [&]() {
+                run_count++;
+                loop.cancel(id);
+            },
+            std::chrono::milliseconds(5));
+    });
+
+    ASSERT_TRUE(wait_for([&]() { return run_count == 1; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(run_count, 1);
+}
+
+TEST(WebsocketEventLoopTest, CancelledTimeoutIsNotRun) {
+    WebsocketEventLoop loop(1);
+    std::atomic<int> run_count{0};
+
+    const auto id = loop.timeout([&run_count]() { run_count++; }, std::chrono::milliseconds(20));
+    loop.cancel(id);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(run_count, 0);
+}
+
+TEST(WebsocketEventLoopTest, SharedLoopIsReleasedWithItsLastUser) {
+    std::weak_ptr<WebsocketEventLoop> released;
+    {
+        auto first = WebsocketEventLoop::get_shared(2);
+        auto second = WebsocketEventLoop::get_shared(4);
+        EXPECT_EQ(first, second);
+        EXPECT_EQ(first->get_thread_count(), 3);
+        released = first;
+    }
+    EXPECT_TRUE(released.expired());
+
+    // A new loop is created for the next user
+    auto next = WebsocketEventLoop::get_shared(4);
+    EXPECT_EQ(next->get_thread_count(), 5);
+}
+
+TEST(WebsocketEventLoopTest, SharedLoopCanBeReleasedFromItsServiceThread) {
+    std::weak_ptr<WebsocketEventLoop> released;
+    {
+        auto loop = WebsocketEventLoop::get_shared(1);
+        released = loop;
+
+        // The task holds the last reference once it runs
+        loop->post([keep_alive = loop]() {});
+    }
+
+    EXPECT_TRUE(wait_for([&]() { return released.expired(); }));
+}
@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "ocpp/common/websocket/websocket_fragmenter.hpp"
+
+using namespace ocpp;
+
+namespace {
+
+/// \brief Creates a payload of the given \p size with a repeating pattern, so that misplaced fragments are detected
+std::string make_payload(size_t size) {
+    std::string payload(size, '\0');
+    for (size_t i = 0; i < size; i++) {
+        payload[i] = static_cast<char>('a' + (i * 7) % 26);
+    }
+    return payload;
+}
+
+/// \brief Writes all fragments of the given \p payload like the websocket does and checks the frame sequence
+std::vector<WebsocketFragment> write_fragments(const std::string& payload, size_t max_fragment_size,
+                                               std::string& reassembled) {
+    std::vector<WebsocketFragment> fragments;
+    WebsocketFragmenter fragmenter(payload.size(), max_fragment_size);
+    while (!fragmenter.done()) {
+        const auto fragment = fragmenter.next();
+        EXPECT_EQ(fragment.offset, reassembled.size());
+        reassembled.append(payload, fragment.offset, fragment.length);
+        EXPECT_EQ(fragmenter.get_written(), reassembled.size());
+        fragments.push_back(fragment);
+    }
+    return fragments;
+}
+
+} // namespace
+
+TEST(WebsocketFragmenterTest, UnfragmentedMessageIsASingleFrame) {
+    const auto payload = make_payload(3 * 1024 * 1024);
+    std::string reassembled;
+    const auto fragments = write_fragments(payload, 0, reassembled);
+
+    ASSERT_EQ(fragments.size(), 1);
+    EXPECT_TRUE(fragments.at(0).first);
+    EXPECT_TRUE(fragments.at(0).last);
+    EXPECT_EQ(reassembled, payload);
+}
+
+TEST(WebsocketFragmenterTest, SmallMessageIsNotFragmented) {
+    const auto payload = make_payload(100);
+    std::string reassembled;
+    const auto fragments = write_fragments(payload, 64 * 1024, reassembled);
+
+    ASSERT_EQ(fragments.size(), 1);
+    EXPECT_TRUE(fragments.at(0).first);
+    EXPECT_TRUE(fragments.at(0).last);
+    EXPECT_EQ(fragments.at(0).length, 100);
+}
+
+TEST(WebsocketFragmenterTest, EmptyMessageIsASingleEmptyFrame) {
+    std::string reassembled;
+    const auto fragments = write_fragments("", 64 * 1024, reassembled);
+
+    ASSERT_EQ(fragments.size(), 1);
+    EXPECT_TRUE(fragments.at(0).first);
+    EXPECT_TRUE(fragments.at(0).last);
+    EXPECT_EQ(fragments.at(0).length, 0);
+}
+
+TEST(WebsocketFragmenterTest, MultiMegabyteMessageIsSplitIntoContinuationFrames) {
+    constexpr size_t fragment_size = 64 * 1024;
+    // not a multiple of the fragment size, so the last fragment is shorter
+    const auto payload = make_payload(5 * 1024 * 1024 + 123);
+    std::string reassembled;
+    const auto fragments = write_fragments(payload, fragment_size, reassembled);
+
+    ASSERT_EQ(fragments.size(), 81);
+    for (size_t i = 0; i < fragments.size(); i++) {
+        const auto& fragment = fragments.at(i);
+        EXPECT_EQ(fragment.first, i == 0);
+        EXPECT_EQ(fragment.last, i == fragments.size() - 1);
+        if (!fragment.last) {
+            EXPECT_EQ(fragment.length, fragment_size);
+        }
+    }
+    EXPECT_EQ(fragments.back().length, 123);
+    EXPECT_EQ(reassembled, payload);
+}
+
+TEST(WebsocketFragmenterTest, MessageOfExactMultipleHasNoEmptyFinalFrame) {
+    constexpr size_t fragment_size = 16 * 1024;
+    const auto payload = make_payload(2 * 1024 * 1024);
+    std::string reassembled;
+    const auto fragments = write_fragments(payload, fragment_size, reassembled);
+
+    ASSERT_EQ(fragments.size(), 128);
+    EXPECT_TRUE(fragments.back().last);
+    EXPECT_EQ(fragments.back().length, fragment_size);
+    EXPECT_EQ(reassembled, payload);
+}
+
+TEST(WebsocketFragmenterTest, NextThrowsWhenDone) {
+    WebsocketFragmenter fragmenter(10, 4);
+    fragmenter.next();
+    fragmenter.next();
+    fragmenter.next();
+    EXPECT_TRUE(fragmenter.done());
+    EXPECT_THROW(fragmenter.next(), std::out_of_range);
+}
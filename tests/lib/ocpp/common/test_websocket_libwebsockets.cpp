@@ -0,0 +1,777 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <arpa/inet.h>
+#include <libwebsockets.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "evse_security_mock.hpp"
+#include "ocpp/common/websocket/websocket_libwebsockets.hpp"
+
+using namespace ocpp;
+
+namespace {
+
+/// \brief Waits until the given \p condition is true, fails after a timeout
+template <typename Condition> bool wait_for(const Condition& condition) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+/// \brief A message the test server has received, with the sizes of the frames it was received in
+struct ReceivedMessage {
+    std::string payload;
+    std::vector<size_t> frame_sizes;
+};
+
+int test_server_callback(lws* wsi, lws_callback_reasons reason, void* user, void* in, size_t len);
+
+const lws_protocols test_server_protocols[] = {{"ocpp1.6", test_server_callback, 0, 0, 0, nullptr, 0},
+                                               LWS_PROTOCOL_LIST_TERM};
+const lws_extension test_server_extensions[] = {
+    {"permessage-deflate", lws_extension_callback_pm_deflate, "permessage-deflate; client_max_window_bits"},
+    {nullptr, nullptr, nullptr}};
+
+/// \brief Plain websocket server on an ephemeral port that records the messages it receives and sends messages to
+/// the connected client, optionally split into continuation frames
+class TestWebsocketServer {
+public:
+    explicit TestWebsocketServer(bool enable_compression = false) {
+        lws_set_log_level(LLL_ERR, nullptr);
+
+        lws_context_creation_info info;
+        memset(&info, 0, sizeof(lws_context_creation_info));
+        info.port = 0;
+        info.protocols = test_server_protocols;
+        info.user = this;
+        if (enable_compression) {
+            info.extensions = test_server_extensions;
+        }
+
+        this->context = lws_create_context(&info);
+        if (this->context == nullptr) {
+            throw std::runtime_error("Could not create the test websocket server");
+        }
+        this->port = lws_get_vhost_listen_port(lws_get_vhost_by_name(this->context, "default"));
+
+        this->service_thread = std::thread([this]() {
+            while (!this->stopped) {
+                lws_service(this->context, 0);
+            }
+        });
+    }
+
+    ~TestWebsocketServer() {
+        this->stopped = true;
+        lws_cancel_service(this->context);
+        this->service_thread.join();
+        lws_context_destroy(this->context);
+    }
+
+    int get_port() const {
+        return this->port;
+    }
+
+    /// \brief Sends the given \p message to the client in frames of at most \p fragment_size bytes, 0 sends a single
+    /// frame
+    void send(const std::string& message, size_t fragment_size = 0) {
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            const size_t step = (fragment_size == 0) ? std::max<size_t>(message.size(), 1) : fragment_size;
+            size_t offset = 0;
+            do {
+                const auto length = std::min(step, message.size() - offset);
+                this->outgoing.push_back(
+                    {message.substr(offset, length), offset == 0, offset + length == message.size()});
+                offset += length;
+            } while (offset < message.size());
+        }
+        lws_cancel_service(this->context);
+    }
+
+    /// \brief Waits until the server has received at least \p count messages
+    bool wait_for_messages(size_t count) {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        return this->received_cv.wait_for(lock, std::chrono::seconds(10),
+                                          [this, count]() { return this->received.size() >= count; });
+    }
+
+    std::vector<ReceivedMessage> get_messages() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->received;
+    }
+
+    /// \brief Makes the server close the connection as soon as it receives data
+    void close_on_receive() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        this->closing_on_receive = true;
+    }
+
+    /// \brief Called from the service thread for every callback of libwebsockets
+    int on_callback(lws* wsi, lws_callback_reasons reason, void* in, size_t len) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        switch (reason) {
+        case LWS_CALLBACK_ESTABLISHED:
+            this->client = wsi;
+            break;
+        case LWS_CALLBACK_CLOSED:
+            this->client = nullptr;
+            break;
+        case LWS_CALLBACK_RECEIVE:
+            if (this->closing_on_receive) {
+                return -1;
+            }
+            this->current_message.payload.append(static_cast<const char*>(in), len);
+            this->current_frame_size += len;
+            if (lws_remaining_packet_payload(wsi) == 0) {
+                this->current_message.frame_sizes.push_back(this->current_frame_size);
+                this->current_frame_size = 0;
+            }
+            if (lws_is_final_fragment(wsi)) {
+                this->received.push_back(std::move(this->current_message));
+                this->current_message = {};
+                this->received_cv.notify_all();
+            }
+            break;
+        case LWS_CALLBACK_EVENT_WAIT_CANCELLED:
+            if (this->client != nullptr and !this->outgoing.empty()) {
+                lws_callback_on_writable(this->client);
+            }
+            break;
+        case LWS_CALLBACK_SERVER_WRITEABLE: {
+            if (this->outgoing.empty()) {
+                break;
+            }
+            const auto frame = std::move(this->outgoing.front());
+            this->outgoing.pop_front();
+
+            std::string buffer(LWS_PRE, '\0');
+            buffer.append(frame.payload);
+            const auto flags = lws_write_ws_flags(LWS_WRITE_TEXT, frame.first, frame.last);
+            lws_write(wsi, reinterpret_cast<unsigned char*>(&buffer[LWS_PRE]), frame.payload.size(),
+                      static_cast<lws_write_protocol>(flags));
+
+            if (!this->outgoing.empty()) {
+                lws_callback_on_writable(wsi);
+            }
+        } break;
+        default:
+            break;
+        }
+        return 0;
+    }
+
+private:
+    struct OutgoingFrame {
+        std::string payload;
+        bool first;
+        bool last;
+    };
+
+    lws_context* context = nullptr;
+    int port = 0;
+    std::thread service_thread;
+    std::atomic_bool stopped{false};
+
+    std::mutex mutex;
+    std::condition_variable received_cv;
+    lws* client = nullptr;
+    std::deque<OutgoingFrame> outgoing;
+    std::vector<ReceivedMessage> received;
+    ReceivedMessage current_message;
+    size_t current_frame_size = 0;
+    bool closing_on_receive = false;
+};
+
+int test_server_callback(lws* wsi, lws_callback_reasons reason, void* user, void* in, size_t len) {
+    if (wsi == nullptr) {
+        return 0;
+    }
+    auto* server = static_cast<TestWebsocketServer*>(lws_context_user(lws_get_context(wsi)));
+    if (server == nullptr) {
+        return 0;
+    }
+    return server->on_callback(wsi, reason, in, len);
+}
+
+/// \brief Listens on the given port of the loopback interface without ever accepting a connection. The kernel completes
+/// the TCP handshake of connecting clients, but their websocket handshake is never answered
+class SilentTcpListener {
+public:
+    explicit SilentTcpListener(int port) : fd(socket(AF_INET, SOCK_STREAM, 0)) {
+        const int reuse = 1;
+        setsockopt(this->fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        sockaddr_in address{};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(static_cast<uint16_t>(port));
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (bind(this->fd, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 or
+            listen(this->fd, 64) != 0) {
+            ::close(this->fd);
+            throw std::runtime_error("Could not listen on port " + std::to_string(port));
+        }
+    }
+
+    ~SilentTcpListener() {
+        ::close(this->fd);
+    }
+
+private:
+    int fd;
+};
+
+/// \brief Provides the number of threads of this process
+size_t get_thread_count() {
+    const std::filesystem::directory_iterator tasks("/proc/self/task");
+    return std::distance(std::filesystem::begin(tasks), std::filesystem::end(tasks));
+}
+
+class WebsocketLibwebsocketsTest : public ::testing::Test {
+protected:
+    WebsocketConnectionOptions make_options(bool enable_compression = false) {
+        const auto security_profile =
+            security::SecurityProfile::OCPP_1_6_ONLY_UNSECURED_TRANSPORT_WITHOUT_BASIC_AUTHENTICATION;
+        const auto uri = "ws://127.0.0.1:" + std::to_string(this->server->get_port()) + "/ocpp";
+
+        WebsocketConnectionOptions options{};
+        options.ocpp_version = OcppProtocolVersion::v16;
+        options.csms_uri = Uri::parse_and_validate(uri, "cp001", security_profile);
+        options.security_profile = security_profile;
+        options.retry_backoff_wait_minimum_s = 1;
+        options.max_connection_attempts = 1;
+        options.use_ssl_default_verify_paths = false;
+        options.verify_csms_common_name = false;
+        options.enable_compression = enable_compression;
+        return options;
+    }
+
+    /// \brief Connects a websocket with the given \p options to the test server
+    std::unique_ptr<WebsocketTlsTPM> connect(const WebsocketConnectionOptions& options) {
+        auto websocket = std::make_unique<WebsocketTlsTPM>(options, std::make_shared<EvseSecurityMock>());
+        websocket->register_connected_callback([](const int security_profile) {});
+        websocket->register_closed_callback([](const WebsocketCloseReason reason) {});
+        websocket->register_disconnected_callback([]() {});
+        websocket->register_message_callback([this](const std::string& message) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->received.push_back(message);
+            this->received_cv.notify_all();
+        });
+
+        EXPECT_TRUE(websocket->connect());
+        EXPECT_TRUE(wait_for([&websocket]() { return websocket->is_connected(); }));
+        return websocket;
+    }
+
+    /// \brief Waits until the websocket has received at least \p count messages
+    bool wait_for_received(size_t count) {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        return this->received_cv.wait_for(lock, std::chrono::seconds(10),
+                                          [this, count]() { return this->received.size() >= count; });
+    }
+
+    void SetUp() override {
+        this->server = std::make_unique<TestWebsocketServer>();
+    }
+
+    std::unique_ptr<TestWebsocketServer> server;
+
+    std::mutex mutex;
+    std::condition_variable received_cv;
+    std::vector<std::string> received;
+};
+
+/// \brief Records the results of the completion callbacks of sent messages
+struct SentResults {
+    std::mutex mutex;
+    std::vector<bool> results;
+
+    std::function<void(bool sent)> callback() {
+        return [this](bool sent) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->results.push_back(sent);
+        };
+    }
+
+    size_t size() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->results.size();
+    }
+
+    std::vector<bool> get() {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        return this->results;
+    }
+};
+
+} // namespace
+
+TEST_F(WebsocketLibwebsocketsTest, SendAsyncIsRejectedWhenNotConnected) {
+    WebsocketTlsTPM websocket(make_options(), std::make_shared<EvseSecurityMock>());
+    websocket.register_connected_callback([](const int security_profile) {});
+    websocket.register_closed_callback([](const WebsocketCloseReason reason) {});
+    websocket.register_message_callback([](const std::string& message) {});
+
+    SentResults sent;
+    EXPECT_FALSE(websocket.send_async("[2,\"1\",\"Heartbeat\",{}]", sent.callback()));
+
+    // The completion callback is only called for accepted messages
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_TRUE(sent.get().empty());
+}
+
+TEST_F(WebsocketLibwebsocketsTest, SendAsyncCompletesWrittenMessagesInOrder) {
+    auto websocket = connect(make_options());
+
+    SentResults sent;
+    const std::vector<std::string> messages = {"[2,\"1\",\"Heartbeat\",{}]", "[2,\"2\",\"Heartbeat\",{}]",
+                                               "[2,\"3\",\"Heartbeat\",{}]"};
+    for (const auto& message : messages) {
+        EXPECT_TRUE(websocket->send_async(message, sent.callback()));
+    }
+
+    ASSERT_TRUE(this->server->wait_for_messages(messages.size()));
+    ASSERT_TRUE(wait_for([&sent, &messages]() { return sent.size() == messages.size(); }));
+    EXPECT_EQ(sent.get(), std::vector<bool>(messages.size(), true));
+
+    const auto received = this->server->get_messages();
+    ASSERT_EQ(received.size(), messages.size());
+    for (size_t i = 0; i < messages.size(); i++) {
+        EXPECT_EQ(received[i].payload, messages[i]);
+    }
+
+    const auto metrics = websocket->get_metrics();
+    EXPECT_EQ(metrics.messages_sent, messages.size());
+    EXPECT_EQ(metrics.send_queue_depth, 0);
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, SendAsyncWritesMessagesOfTheJsonWriter) {
+    auto websocket = connect(make_options());
+
+    SentResults sent;
+    EXPECT_TRUE(websocket->send_async(
+        [](JsonWriter& writer) {
+            writer.start_array();
+            writer.value(2);
+            writer.value("1");
+            writer.value("Heartbeat");
+            writer.start_object();
+            writer.end_object();
+            writer.end_array();
+        },
+        sent.callback()));
+
+    ASSERT_TRUE(this->server->wait_for_messages(1));
+    EXPECT_EQ(this->server->get_messages().at(0).payload, "[2,\"1\",\"Heartbeat\",{}]");
+    ASSERT_TRUE(wait_for([&sent]() { return sent.size() == 1; }));
+    EXPECT_TRUE(sent.get().at(0));
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, SendAsyncIsRejectedWhileTheSendQueueIsFull) {
+    auto options = make_options();
+    options.max_send_queue_size = 2;
+    // Every byte is written with its own writable callback, so the large message stays queued for a while
+    options.max_fragment_size = 1;
+    auto websocket = connect(options);
+
+    SentResults sent;
+    const std::string large_message(64 * 1024, 'a');
+    EXPECT_TRUE(websocket->send_async(large_message, sent.callback()));
+    EXPECT_TRUE(websocket->send_async("b", sent.callback()));
+    EXPECT_FALSE(websocket->send_async("c", sent.callback()));
+    EXPECT_EQ(websocket->get_metrics().messages_rejected, 1);
+
+    // Once the queue has drained messages are accepted again
+    ASSERT_TRUE(wait_for([&sent]() { return sent.size() == 2; }));
+    EXPECT_TRUE(websocket->send_async("d", sent.callback()));
+
+    ASSERT_TRUE(this->server->wait_for_messages(3));
+    const auto received = this->server->get_messages();
+    ASSERT_EQ(received.size(), 3);
+    EXPECT_EQ(received[0].payload, large_message);
+    EXPECT_EQ(received[1].payload, "b");
+    EXPECT_EQ(received[2].payload, "d");
+    ASSERT_TRUE(wait_for([&sent]() { return sent.size() == 3; }));
+    EXPECT_EQ(sent.get(), std::vector<bool>(3, true));
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, SendAsyncQueueIsNotLimitedWithZeroSize) {
+    auto options = make_options();
+    options.max_send_queue_size = 0;
+    auto websocket = connect(options);
+
+    SentResults sent;
+    constexpr size_t message_count = 2000;
+    for (size_t i = 0; i < message_count; i++) {
+        EXPECT_TRUE(websocket->send_async("[2,\"" + std::to_string(i) + "\",\"Heartbeat\",{}]", sent.callback()));
+    }
+
+    ASSERT_TRUE(this->server->wait_for_messages(message_count));
+    ASSERT_TRUE(wait_for([&sent]() { return sent.size() == message_count; }));
+    EXPECT_EQ(websocket->get_metrics().messages_rejected, 0);
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, MessagesOfAFailedConnectionAreDroppedAndNotWrittenAgain) {
+    auto options = make_options();
+    options.max_fragment_size = 1;
+    auto websocket = connect(options);
+    this->server->close_on_receive();
+
+    SentResults sent;
+    EXPECT_TRUE(websocket->send_async(std::string(64 * 1024, 'a'), sent.callback()));
+    EXPECT_TRUE(websocket->send_async("b", sent.callback()));
+
+    // Both messages are completed as dropped once the connection has failed, the sender has to send them again
+    ASSERT_TRUE(wait_for([&sent]() { return sent.size() == 2; }));
+    EXPECT_EQ(sent.get(), std::vector<bool>(2, false));
+    EXPECT_EQ(websocket->get_metrics().messages_dropped, 2);
+    EXPECT_TRUE(this->server->get_messages().empty());
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, LargeMessagesAreWrittenAsContinuationFrames) {
+    auto options = make_options();
+    options.max_fragment_size = 1000;
+    auto websocket = connect(options);
+
+    std::string message(10 * 1000 + 10, 'a');
+    message.back() = 'z';
+    EXPECT_TRUE(websocket->send_async(message, nullptr));
+    EXPECT_TRUE(websocket->send_async("small", nullptr));
+
+    // The server reassembles the frames into a single message, which fails if the frames are not flagged as the
+    // start, continuation and end of the same message
+    ASSERT_TRUE(this->server->wait_for_messages(2));
+    const auto received = this->server->get_messages();
+    EXPECT_EQ(received[0].payload, message);
+    EXPECT_EQ(received[0].frame_sizes, std::vector<size_t>({1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000, 1000,
+                                                             1000, 10}));
+    EXPECT_EQ(received[1].payload, "small");
+    EXPECT_EQ(received[1].frame_sizes, std::vector<size_t>({5}));
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, MessagesAreNotFragmentedWithZeroFragmentSize) {
+    auto options = make_options();
+    options.max_fragment_size = 0;
+    auto websocket = connect(options);
+
+    const std::string message(200 * 1000, 'a');
+    EXPECT_TRUE(websocket->send_async(message, nullptr));
+
+    ASSERT_TRUE(this->server->wait_for_messages(1));
+    const auto received = this->server->get_messages();
+    EXPECT_EQ(received[0].payload, message);
+    EXPECT_EQ(websocket->get_metrics().frames_sent, 1);
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, PingIsWrittenBetweenTheFragmentsOfALargeMessage) {
+    auto options = make_options();
+    options.max_fragment_size = 1;
+    auto websocket = connect(options);
+
+    SentResults sent;
+    const std::string message(64 * 1024, 'a');
+    EXPECT_TRUE(websocket->send_async(message, sent.callback()));
+    websocket->ping();
+
+    // The pong arrives while the large message is still being written
+    ASSERT_TRUE(wait_for([&websocket]() { return websocket->get_metrics().ping_rtt.count == 1; }));
+    EXPECT_TRUE(sent.get().empty());
+
+    ASSERT_TRUE(this->server->wait_for_messages(1));
+    EXPECT_EQ(this->server->get_messages().at(0).payload, message);
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST(WebsocketLatencyStatsTest, RecordsCountTotalMaxAndLast) {
+    WebsocketLatencyStats stats;
+    EXPECT_EQ(stats.mean(), std::chrono::microseconds(0));
+
+    stats.record(std::chrono::milliseconds(3));
+    stats.record(std::chrono::milliseconds(7));
+    stats.record(std::chrono::milliseconds(2));
+
+    EXPECT_EQ(stats.count, 3u);
+    EXPECT_EQ(stats.total, std::chrono::milliseconds(12));
+    EXPECT_EQ(stats.max, std::chrono::milliseconds(7));
+    EXPECT_EQ(stats.last, std::chrono::milliseconds(2));
+    EXPECT_EQ(stats.mean(), std::chrono::milliseconds(4));
+}
+
+TEST_F(WebsocketLibwebsocketsTest, LatencyMetricsAreRecordedForEveryFrameAndMessage) {
+    auto websocket = connect(make_options());
+
+    const std::vector<std::string> messages = {"first", "second", "third"};
+    for (const auto& message : messages) {
+        EXPECT_TRUE(websocket->send_async(message, nullptr));
+    }
+    ASSERT_TRUE(this->server->wait_for_messages(messages.size()));
+    ASSERT_TRUE(wait_for([&websocket, &messages]() {
+        return websocket->get_metrics().messages_sent == messages.size();
+    }));
+
+    const auto metrics = websocket->get_metrics();
+    EXPECT_EQ(metrics.time_to_connect.count, 1u);
+    EXPECT_GT(metrics.time_to_connect.total.count(), 0);
+    EXPECT_EQ(metrics.frame_queue_time.count, metrics.frames_sent);
+    EXPECT_EQ(metrics.write_completion_time.count, messages.size());
+    EXPECT_LE(metrics.frame_queue_time.max, metrics.write_completion_time.max);
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, FrameQueueTimeOfContinuationFramesStartsAtThePreviousFrame) {
+    auto options = make_options();
+    options.max_fragment_size = 16;
+    auto websocket = connect(options);
+
+    SentResults sent;
+    const std::string message(64 * 1024, 'a');
+    EXPECT_TRUE(websocket->send_async(message, sent.callback()));
+    ASSERT_TRUE(wait_for([&sent]() { return sent.size() == 1; }));
+
+    // The frames wait one after the other, so their queue times add up to at most the time it took to write the
+    // whole message. Measured from the queueing of the message, they would add up to far more
+    const auto metrics = websocket->get_metrics();
+    EXPECT_EQ(metrics.frame_queue_time.count, message.size() / 16);
+    EXPECT_EQ(metrics.write_completion_time.count, 1u);
+    EXPECT_LE(metrics.frame_queue_time.total, metrics.write_completion_time.total);
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, CompressedMessagesRoundTrip) {
+    this->server = std::make_unique<TestWebsocketServer>(true);
+    auto websocket = connect(make_options(true));
+
+    std::string message = "[2,\"1\",\"MeterValues\",{\"meterValue\":[";
+    for (int i = 0; i < 200; i++) {
+        message += "{\"sampledValue\":[{\"value\":\"" + std::to_string(i) + "\",\"measurand\":\"Voltage\"}]},";
+    }
+    message += "{}]}]";
+
+    EXPECT_TRUE(websocket->send_async(message, nullptr));
+    ASSERT_TRUE(this->server->wait_for_messages(1));
+    EXPECT_EQ(this->server->get_messages().at(0).payload, message);
+
+    this->server->send(message);
+    ASSERT_TRUE(wait_for_received(1));
+    EXPECT_EQ(this->received.at(0), message);
+
+    const auto compression = websocket->get_metrics().compression;
+    EXPECT_TRUE(compression.negotiated);
+    EXPECT_EQ(compression.tx_payload_bytes, message.size());
+    EXPECT_GT(compression.tx_ratio(), 2);
+    EXPECT_EQ(compression.rx_payload_bytes, message.size());
+    EXPECT_GT(compression.rx_ratio(), 2);
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, MessagesAreNotCompressedIfTheServerDoesNotAcceptCompression) {
+    auto websocket = connect(make_options(true));
+
+    EXPECT_TRUE(websocket->send_async("[2,\"1\",\"Heartbeat\",{}]", nullptr));
+    ASSERT_TRUE(this->server->wait_for_messages(1));
+    EXPECT_EQ(this->server->get_messages().at(0).payload, "[2,\"1\",\"Heartbeat\",{}]");
+
+    const auto compression = websocket->get_metrics().compression;
+    EXPECT_FALSE(compression.negotiated);
+    EXPECT_EQ(compression.tx_compressed_bytes, 0);
+    EXPECT_EQ(compression.tx_ratio(), 0);
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, ConsecutiveMessagesAreReassembledFromPooledBuffers) {
+    auto websocket = connect(make_options());
+
+    // Long messages first, so that a reused receive buffer that still contains the previous message would show up
+    const std::vector<std::string> messages = {
+        "[2,\"1\",\"DataTransfer\",{\"vendorId\":\"a long vendor id\",\"data\":\"" + std::string(500, 'x') + "\"}]",
+        "[3,\"1\",{}]",
+        "[2,\"2\",\"DataTransfer\",{\"vendorId\":\"fragmented\",\"data\":\"" + std::string(300, 'y') + "\"}]",
+        "[3,\"2\",{}]",
+        "[2,\"3\",\"Reset\",{\"type\":\"Soft\"}]",
+    };
+
+    // Enough rounds to cycle every buffer of the pool several times
+    constexpr size_t rounds = 20;
+    for (size_t round = 0; round < rounds; round++) {
+        this->server->send(messages[0]);
+        this->server->send(messages[1]);
+        this->server->send(messages[2], 7);
+        this->server->send(messages[3]);
+        this->server->send(messages[4], 1);
+    }
+
+    ASSERT_TRUE(wait_for_received(rounds * messages.size()));
+    ASSERT_EQ(this->received.size(), rounds * messages.size());
+    for (size_t i = 0; i < this->received.size(); i++) {
+        EXPECT_EQ(this->received[i], messages[i % messages.size()]);
+    }
+
+    const auto metrics = websocket->get_metrics();
+    EXPECT_EQ(metrics.messages_received, rounds * messages.size());
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, ConsecutiveMessagesAreReassembledInTheSharedEventLoop) {
+    auto options = make_options();
+    options.use_shared_event_loop = true;
+    auto websocket = connect(options);
+
+    const std::vector<std::string> messages = {
+        "[2,\"1\",\"DataTransfer\",{\"data\":\"" + std::string(500, 'x') + "\"}]",
+        "[3,\"1\",{}]",
+        "[2,\"2\",\"Reset\",{\"type\":\"Soft\"}]",
+    };
+
+    constexpr size_t rounds = 20;
+    for (size_t round = 0; round < rounds; round++) {
+        this->server->send(messages[0], 64);
+        this->server->send(messages[1]);
+        this->server->send(messages[2], 3);
+    }
+
+    ASSERT_TRUE(wait_for_received(rounds * messages.size()));
+    ASSERT_EQ(this->received.size(), rounds * messages.size());
+    for (size_t i = 0; i < this->received.size(); i++) {
+        EXPECT_EQ(this->received[i], messages[i % messages.size()]);
+    }
+
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
+
+TEST_F(WebsocketLibwebsocketsTest, MultiMegabyteMessagesRoundTripWithAndWithoutCompression) {
+    // Varied values, so that the compressed message is still large enough to be written in many writes
+    std::string message = "[2,\"1\",\"DataTransfer\",{\"vendorId\":\"test\",\"data\":\"";
+    uint32_t value = 1;
+    while (message.size() < 4 * 1024 * 1024) {
+        value = value * 1664525 + 1013904223;
+        message += std::to_string(value) + ";";
+    }
+    message += "\"}]";
+
+    for (const bool enable_compression : {false, true}) {
+        SCOPED_TRACE(enable_compression ? "with compression" : "without compression");
+        this->server = std::make_unique<TestWebsocketServer>(enable_compression);
+        {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            this->received.clear();
+        }
+        auto websocket = connect(make_options(enable_compression));
+
+        SentResults sent;
+        EXPECT_TRUE(websocket->send_async(message, sent.callback()));
+        ASSERT_TRUE(this->server->wait_for_messages(1));
+        EXPECT_EQ(this->server->get_messages().at(0).payload, message);
+        ASSERT_TRUE(wait_for([&sent]() { return sent.size() == 1; }));
+        EXPECT_TRUE(sent.get().at(0));
+
+        this->server->send(message, 64 * 1024);
+        ASSERT_TRUE(wait_for_received(1));
+        EXPECT_EQ(this->received.at(0), message);
+
+        const auto metrics = websocket->get_metrics();
+        EXPECT_EQ(metrics.messages_sent, 1);
+        EXPECT_EQ(metrics.messages_received, 1);
+        EXPECT_EQ(metrics.compression.negotiated, enable_compression);
+        if (enable_compression) {
+            EXPECT_EQ(metrics.compression.tx_payload_bytes, message.size());
+            EXPECT_EQ(metrics.compression.rx_payload_bytes, message.size());
+        }
+
+        websocket->disconnect(WebsocketCloseReason::Normal);
+    }
+}
+
+TEST_F(WebsocketLibwebsocketsTest, ReconnectingWebsocketsDoNotStallTheSharedEventLoop) {
+    auto options = make_options();
+    options.use_shared_event_loop = true;
+    auto websocket = connect(options);
+
+    // More reconnecting websockets than the loop has workers, a reconnect that waits on a worker would block them all
+    constexpr size_t reconnecting_count = 2 * DEFAULT_WEBSOCKET_EVENT_LOOP_WORKERS;
+    auto failing_server = std::make_unique<TestWebsocketServer>();
+    const auto failing_port = failing_server->get_port();
+    auto reconnecting_options = options;
+    reconnecting_options.csms_uri = Uri::parse_and_validate("ws://127.0.0.1:" + std::to_string(failing_port) + "/ocpp",
+                                                            "cp002", options.security_profile);
+    reconnecting_options.max_connection_attempts = -1;
+
+    std::vector<std::unique_ptr<WebsocketTlsTPM>> reconnecting;
+    for (size_t i = 0; i < reconnecting_count; i++) {
+        reconnecting.push_back(connect(reconnecting_options));
+    }
+
+    // The server goes away, the websockets reconnect to a port that never finishes their handshake
+    failing_server.reset();
+    SilentTcpListener silent_listener(failing_port);
+    const auto thread_count = get_thread_count();
+    ASSERT_TRUE(wait_for([&reconnecting]() {
+        return std::all_of(reconnecting.begin(), reconnecting.end(),
+                           [](const auto& websocket) { return websocket->get_metrics().reconnects > 0; });
+    }));
+    // Gives the reconnect timers the time to expire and start the pending connections
+    std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+
+    // The connected websocket still sends and receives while the others are stuck in their handshake
+    SentResults sent;
+    EXPECT_TRUE(websocket->send_async("[2,\"1\",\"Heartbeat\",{}]", sent.callback()));
+    ASSERT_TRUE(this->server->wait_for_messages(1));
+    ASSERT_TRUE(wait_for([&sent]() { return sent.size() == 1; }));
+    EXPECT_TRUE(sent.get().at(0));
+
+    this->server->send("[3,\"1\",{}]");
+    ASSERT_TRUE(wait_for_received(1));
+    EXPECT_EQ(this->received.at(0), "[3,\"1\",{}]");
+
+    EXPECT_EQ(get_thread_count(), thread_count);
+    for (const auto& reconnecting_websocket : reconnecting) {
+        EXPECT_FALSE(reconnecting_websocket->is_connected());
+    }
+
+    reconnecting.clear();
+    websocket->disconnect(WebsocketCloseReason::Normal);
+}
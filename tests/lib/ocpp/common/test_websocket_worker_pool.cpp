@@ -0,0 +1,193 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "ocpp/common/websocket/websocket_worker_pool.hpp"
+
+using namespace ocpp;
+
+namespace {
+
+/// \brief Waits until the given \p condition is true, fails after a timeout
+template <typename Condition> bool wait_for(const Condition& condition) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+} // namespace
+
+TEST(WebsocketWorkerPoolTest, PostedTasksAreRun) {
+    std::atomic<int> run_count{0};
+    {
+        WebsocketWorkerPool pool(4);
+        EXPECT_EQ(pool.get_worker_count(), 4);
+        for (int i = 0; i < 1000; i++) {
+            pool.post([&run_count]() { run_count++; });
+        }
+    }
+
+    // The destructor runs the tasks that have already been posted
+    EXPECT_EQ(run_count, 1000);
+}
+
+TEST(WebsocketWorkerPoolTest, PoolHasAtLeastOneWorker) {
+    WebsocketWorkerPool pool(0);
+    EXPECT_EQ(pool.get_worker_count(), 1);
+}
+
+TEST(WebsocketStrandTest, TasksRunInOrderAndNeverConcurrently) {
+    auto pool = std::make_shared<WebsocketWorkerPool>(4);
+    auto strand = std::make_shared<WebsocketStrand>(pool);
+
+    std::vector<int> order;
+    std::atomic<int> running{0};
+    std::atomic<bool> overlapped{false};
+
+    for (int i = 0; i < 500; i++) {
+        EXPECT_TRUE(strand->post([&, i]() {
+            if (running++ != 0) {
+                overlapped = true;
+            }
+            order.push_back(i);
+            running--;
+        }));
+    }
+    strand->stop();
+
+    EXPECT_FALSE(overlapped);
+    ASSERT_EQ(order.size(), 500);
+    for (int i = 0; i < 500; i++) {
+        EXPECT_EQ(order.at(i), i);
+    }
+}
+
+TEST(WebsocketStrandTest, ManyStrandsShareTheWorkers) {
+    constexpr size_t strand_count = 300;
+    constexpr int tasks_per_strand = 20;
+
+    auto pool = std::make_shared<WebsocketWorkerPool>(2);
+    std::vector<std::shared_ptr<WebsocketStrand>> strands;
+    std::vector<std::vector<int>> orders(strand_count);
+    std::mutex threads_mutex;
+    std::set<std::thread::id> threads;
+
+    for (size_t s = 0; s < strand_count; s++) {
+        strands.push_back(std::make_shared<WebsocketStrand>(pool));
+    }
+
+    // Posted interleaved like the callbacks of many simulated charge points
+    for (int i = 0; i < tasks_per_strand; i++) {
+        for (size_t s = 0; s < strand_count; s++) {
+            strands.at(s)->post([&, s, i]() {
+                orders.at(s).push_back(i);
+                std::lock_guard<std::mutex> lock(threads_mutex);
+                threads.insert(std::this_thread::get_id());
+            });
+        }
+    }
+
+    for (auto& strand : strands) {
+        strand->stop();
+    }
+
+    // The number of threads does not grow with the number of strands
+    EXPECT_LE(threads.size(), pool->get_worker_count());
+    for (const auto& order : orders) {
+        ASSERT_EQ(order.size(), tasks_per_strand);
+        for (int i = 0; i < tasks_per_strand; i++) {
+            EXPECT_EQ(order.at(i), i);
+        }
+    }
+}
+
+TEST(WebsocketStrandTest, BusyStrandDoesNotBlockOtherStrands) {
+    auto pool = std::make_shared<WebsocketWorkerPool>(1);
+    auto busy = std::make_shared<WebsocketStrand>(pool);
+    auto other = std::make_shared<WebsocketStrand>(pool);
+
+    std::atomic<int> busy_count{0};
+    std::atomic<int> busy_count_when_other_ran{-1};
+    std::mutex release_mutex;
+    std::condition_variable release_cv;
+    bool released = false;
+
+    // Blocks the single worker until the busy strand has been filled with many tasks
+    busy->post([&]() {
+        std::unique_lock<std::mutex> lock(release_mutex);
+        release_cv.wait(lock, [&]() { return released; });
+    });
+    for (size_t i = 0; i < 10 * WebsocketStrand::MAX_TASKS_PER_BATCH; i++) {
+        busy->post([&]() { busy_count++; });
+    }
+    other->post([&]() { busy_count_when_other_ran = busy_count.load(); });
+
+    {
+        std::lock_guard<std::mutex> lock(release_mutex);
+        released = true;
+    }
+    release_cv.notify_all();
+
+    busy->stop();
+    other->stop();
+
+    // The other strand ran between two batches of the busy strand instead of after all of its tasks
+    EXPECT_GE(busy_count_when_other_ran, 0);
+    EXPECT_LT(busy_count_when_other_ran, 10 * WebsocketStrand::MAX_TASKS_PER_BATCH);
+}
+
+TEST(WebsocketStrandTest, StopRunsPostedTasksAndRejectsNewOnes) {
+    auto pool = std::make_shared<WebsocketWorkerPool>(2);
+    auto strand = std::make_shared<WebsocketStrand>(pool);
+    std::atomic<int> run_count{0};
+
+    for (int i = 0; i < 100; i++) {
+        strand->post([&run_count]() {
+            std::this_thread::sleep_for(std::chrono::microseconds(10));
+            run_count++;
+        });
+    }
+    strand->stop();
+
+    EXPECT_EQ(run_count, 100);
+    EXPECT_FALSE(strand->post([&run_count]() { run_count++; }));
+    EXPECT_EQ(run_count, 100);
+}
+
+TEST(WebsocketStrandTest, StopFromOwnTaskDropsRemainingTasks) {
+    auto pool = std::make_shared<WebsocketWorkerPool>(2);
+    auto strand = std::make_shared<WebsocketStrand>(pool);
+    std::atomic<bool> stopped{false};
+    std::atomic<int> run_count{0};
+    std::mutex start_mutex;
+
+    {
+        // Keeps the first task from running until all tasks are posted
+        std::lock_guard<std::mutex> lock(start_mutex);
+        strand->post([&]() {
+            std::lock_guard<std::mutex> lock(start_mutex);
+            strand->stop();
+            stopped = true;
+        });
+        for (int i = 0; i < 10; i++) {
+            strand->post([&run_count]() { run_count++; });
+        }
+    }
+
+    ASSERT_TRUE(wait_for([&]() { return stopped.load(); }));
+    strand->stop();
+    EXPECT_EQ(run_count, 0);
+}
@@ -111,6 +111,8 @@ struct DatabaseConnectionTest : public common::DatabaseConnectionInterface {
     virtual std::unique_ptr<ocpp::common::SQLiteStatementInterface> new_statement(const std::string& sql) {
         return std::make_unique<SQLiteStatementTest>();
     }
+    virtual void prepare_statements(const std::vector<std::string>& statements) override {
+    }
     virtual const char* get_error_message() {
         return "";
     }
@@ -0,0 +1,215 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <ocpp/v16/charge_point_configuration.hpp>
+
+using namespace ocpp::v16;
+using json = nlohmann::json;
+
+namespace {
+
+class ChargePointConfigurationTest : public ::testing::Test {
+protected:
+    std::filesystem::path directory =
+        std::filesystem::temp_directory_path() / "libocpp_test_charge_point_configuration";
+    std::filesystem::path user_config_path = directory / "user_config.json";
+    json config;
+
+    void SetUp() override {
+        const std::filesystem::path config_location = CONFIG_LOCATION_V16;
+
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        std::filesystem::copy(config_location / "profile_schemas", directory / "profile_schemas");
+
+        const json custom_schema = {
+            {"$schema", "http://json-schema.org/draft-07/schema#"},
+            {"type", "object"},
+            {"properties", {{"CustomKey", {{"type", "string"}, {"readOnly", false}}}}},
+        };
+        std::ofstream(directory / "profile_schemas" / "Custom.json") << custom_schema.dump();
+        std::ofstream(user_config_path) << "{}";
+
+        std::ifstream ifs(config_location / "config.json");
+        config = json::parse(ifs);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    std::unique_ptr<ChargePointConfiguration> create_configuration() {
+        return std::make_unique<ChargePointConfiguration>(config.dump(), directory, user_config_path);
+    }
+
+    void enable_cost_and_price(bool custom_display_cost_and_price) {
+        config["CostAndPrice"] = {
+            {"CustomDisplayCostAndPrice", custom_display_cost_and_price},
+            {"NumberOfDecimalsForCostValues", 3},
+            {"SupportedLanguages", "en,de"},
+            {"CustomMultiLanguageMessages", true},
+            {"DefaultPriceText", {{"priceTexts", json::array({{{"priceText", "0,30 EUR/kWh"}, {"language", "de"}}})}}},
+        };
+    }
+};
+
+} // namespace
+
+TEST_F(ChargePointConfigurationTest, GetsKeysCaseInsensitively) {
+    const auto configuration = create_configuration();
+
+    for (const std::string key : {"HeartbeatInterval", "heartbeatinterval", "HEARTBEATINTERVAL", "hEaRtBeAtInTeRvAl"}) {
+        const auto key_value = configuration->get(key);
+        ASSERT_TRUE(key_value.has_value()) << key;
+        EXPECT_EQ(key_value->key.get(), "HeartbeatInterval");
+        EXPECT_EQ(key_value->value.value().get(), "86400");
+    }
+
+    EXPECT_EQ(configuration->get("chargepointid")->value.value().get(), "cp001");
+    EXPECT_FALSE(configuration->get("UnknownKey").has_value());
+}
+
+TEST_F(ChargePointConfigurationTest, KeysOfUnsupportedProfilesAreNotAvailable) {
+    config["Core"]["SupportedFeatureProfiles"] = "Core,FirmwareManagement,RemoteTrigger,Reservation";
+    config.erase("PnC");
+    const auto configuration = create_configuration();
+
+    // The profiles are configured, but not supported
+    EXPECT_FALSE(configuration->get("ChargeProfileMaxStackLevel").has_value());
+    EXPECT_FALSE(configuration->get("LocalAuthListEnabled").has_value());
+    EXPECT_FALSE(configuration->get("ISO15118PnCEnabled").has_value());
+
+    EXPECT_TRUE(configuration->get("HeartbeatInterval").has_value());
+}
+
+TEST_F(ChargePointConfigurationTest, KeysOfSupportedProfilesAreAvailable) {
+    const auto configuration = create_configuration();
+
+    EXPECT_EQ(configuration->get("ChargeProfileMaxStackLevel")->value.value().get(), "42");
+    EXPECT_EQ(configuration->get("localauthlistenabled")->value.value().get(), "true");
+    EXPECT_TRUE(configuration->get("ISO15118PnCEnabled").has_value());
+}
+
+TEST_F(ChargePointConfigurationTest, CostAndPriceKeysRequireCustomDisplayCostAndPrice) {
+    enable_cost_and_price(false);
+    const auto configuration = create_configuration();
+
+    // CustomDisplayCostAndPrice itself is always available
+    EXPECT_EQ(configuration->get("CustomDisplayCostAndPrice")->value.value().get(), "0");
+    EXPECT_FALSE(configuration->get("NumberOfDecimalsForCostValues").has_value());
+    EXPECT_FALSE(configuration->get("SupportedLanguages").has_value());
+    EXPECT_FALSE(configuration->get("DefaultPriceText,de").has_value());
+}
+
+TEST_F(ChargePointConfigurationTest, CostAndPriceKeysAreAvailableWithCustomDisplayCostAndPrice) {
+    enable_cost_and_price(true);
+    const auto configuration = create_configuration();
+
+    EXPECT_EQ(configuration->get("CustomDisplayCostAndPrice")->value.value().get(), "1");
+    EXPECT_EQ(configuration->get("numberofdecimalsforcostvalues")->value.value().get(), "3");
+    EXPECT_EQ(configuration->get("SupportedLanguages")->value.value().get(), "en,de");
+    // Keys that are not configured
+    EXPECT_FALSE(configuration->get("DefaultPrice").has_value());
+    EXPECT_FALSE(configuration->get("Language").has_value());
+}
+
+TEST_F(ChargePointConfigurationTest, GetsDefaultPriceTextPerLanguage) {
+    enable_cost_and_price(true);
+    const auto configuration = create_configuration();
+
+    const auto german = configuration->get("DefaultPriceText,de");
+    ASSERT_TRUE(german.has_value());
+    EXPECT_EQ(german->key.get(), "DefaultPriceText,de");
+    EXPECT_EQ(json::parse(german->value.value().get()).at("priceText"), "0,30 EUR/kWh");
+
+    // A language without a price text can still be set, so it is returned with an empty value
+    const auto english = configuration->get("DefaultPriceText,en");
+    ASSERT_TRUE(english.has_value());
+    EXPECT_EQ(english->value.value().get(), "");
+
+    EXPECT_FALSE(configuration->get("DefaultPriceText").has_value());
+}
+
+TEST_F(ChargePointConfigurationTest, DefaultPriceTextRequiresCustomMultiLanguageMessages) {
+    enable_cost_and_price(true);
+    config["CostAndPrice"]["CustomMultiLanguageMessages"] = false;
+    const auto configuration = create_configuration();
+
+    EXPECT_FALSE(configuration->get("DefaultPriceText,de").has_value());
+}
+
+TEST_F(ChargePointConfigurationTest, UnknownKeysFallThroughToCustomKeys) {
+    config["Custom"] = {{"CustomKey", "custom value"}};
+    const auto configuration = create_configuration();
+
+    const auto custom = configuration->get("CustomKey");
+    ASSERT_TRUE(custom.has_value());
+    EXPECT_EQ(custom->value.value().get(), "custom value");
+    EXPECT_FALSE(custom->readonly);
+
+    EXPECT_FALSE(configuration->get("UnknownKey").has_value());
+    // Known keys are not looked up in the Custom profile
+    EXPECT_EQ(configuration->get("HeartbeatInterval")->value.value().get(), "86400");
+}
+
+TEST_F(ChargePointConfigurationTest, CustomKeysAreNotAvailableWithoutCustomProfile) {
+    const auto configuration = create_configuration();
+
+    EXPECT_FALSE(configuration->get("CustomKey").has_value());
+}
+
+TEST_F(ChargePointConfigurationTest, CachedIntervalsAreUpdatedBySet) {
+    const auto configuration = create_configuration();
+    EXPECT_EQ(configuration->getMeterValueSampleInterval(), 0);
+    EXPECT_EQ(configuration->getClockAlignedDataInterval(), 900);
+
+    EXPECT_EQ(configuration->set("MeterValueSampleInterval", "60"), ConfigurationStatus::Accepted);
+    EXPECT_EQ(configuration->set("clockaligneddatainterval", "300"), ConfigurationStatus::Accepted);
+    EXPECT_EQ(configuration->getMeterValueSampleInterval(), 60);
+    EXPECT_EQ(configuration->getClockAlignedDataInterval(), 300);
+    EXPECT_EQ(configuration->get("MeterValueSampleInterval")->value.value().get(), "60");
+    EXPECT_EQ(configuration->get("ClockAlignedDataInterval")->value.value().get(), "300");
+
+    // A rejected value does not change the cached interval
+    EXPECT_EQ(configuration->set("MeterValueSampleInterval", "-1"), ConfigurationStatus::Rejected);
+    EXPECT_EQ(configuration->getMeterValueSampleInterval(), 60);
+}
+
+TEST_F(ChargePointConfigurationTest, CachedMeasurandsAreUpdatedBySet) {
+    const auto configuration = create_configuration();
+    ASSERT_EQ(configuration->getMeterValuesSampledDataVector().size(), 1u);
+    ASSERT_EQ(configuration->getMeterValuesAlignedDataVector().size(), 1u);
+
+    EXPECT_EQ(configuration->set("MeterValuesSampledData", "Energy.Active.Import.Register,Voltage"),
+              ConfigurationStatus::Accepted);
+    EXPECT_EQ(configuration->set("MeterValuesAlignedData", "Power.Active.Import"), ConfigurationStatus::Accepted);
+
+    const auto sampled = configuration->getMeterValuesSampledDataVector();
+    ASSERT_EQ(sampled.size(), 2u);
+    EXPECT_EQ(sampled.at(0).measurand, Measurand::Energy_Active_Import_Register);
+    EXPECT_EQ(sampled.at(1).measurand, Measurand::Voltage);
+    const auto aligned = configuration->getMeterValuesAlignedDataVector();
+    ASSERT_EQ(aligned.size(), 1u);
+    EXPECT_EQ(aligned.at(0).measurand, Measurand::Power_Active_Import);
+
+    // Unsupported measurands are rejected and do not change the cached measurands
+    EXPECT_EQ(configuration->set("MeterValuesSampledData", "Temperature"), ConfigurationStatus::Rejected);
+    EXPECT_EQ(configuration->getMeterValuesSampledDataVector().size(), 2u);
+}
+
+TEST_F(ChargePointConfigurationTest, FlushWritesChangedKeysToTheUserConfig) {
+    config["Internal"]["UserConfigWriteDelay"] = 60000;
+    const auto configuration = create_configuration();
+
+    EXPECT_EQ(configuration->set("HeartbeatInterval", "120"), ConfigurationStatus::Accepted);
+    EXPECT_TRUE(configuration->flush_user_config());
+
+    std::ifstream ifs(user_config_path);
+    EXPECT_EQ(json::parse(ifs).at("Core").at("HeartbeatInterval"), 120);
+}
@@ -59,5 +59,15 @@ TEST_F(ControlMessageV16Test, test_is_transactional_update) {
                      .is_transaction_update_message());
 }
 
+TEST_F(ControlMessageV16Test, test_message_type_conversions_round_trip) {
+    // InternalError is only used internally and is never received
+    for (int i = 0; i < static_cast<int>(MessageType::InternalError); i++) {
+        const auto message_type = static_cast<MessageType>(i);
+        EXPECT_EQ(conversions::string_to_messagetype(conversions::messagetype_to_string(message_type)), message_type)
+            << "for enumerator " << i;
+    }
+    EXPECT_THROW(conversions::string_to_messagetype("InternalError"), StringToEnumException);
+}
+
 } // namespace v16
 } // namespace ocpp
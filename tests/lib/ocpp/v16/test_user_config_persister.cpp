@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: Apache-2.0
+// Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+
+#include <ocpp/v16/user_config_persister.hpp>
+
+using namespace ocpp::v16;
+using namespace std::chrono_literals;
+using json = nlohmann::json;
+
+namespace {
+
+class UserConfigPersisterTest : public ::testing::Test {
+protected:
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "libocpp_test_user_config_persister";
+    std::filesystem::path user_config_path = directory / "user_config.json";
+
+    void SetUp() override {
+        std::filesystem::remove_all(directory);
+        std::filesystem::create_directories(directory);
+        std::ofstream ofs(user_config_path);
+        ofs << R"({"Internal":{"ChargePointId":"cp001"}})" << std::endl;
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(directory);
+    }
+
+    json read_user_config() {
+        std::ifstream ifs(user_config_path);
+        return json::parse(ifs);
+    }
+
+    int count_files() {
+        int count = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(directory)) {
+            (void)entry;
+            count++;
+        }
+        return count;
+    }
+};
+
+} // namespace
+
+TEST_F(UserConfigPersisterTest, WritesEveryChangeWithoutDelay) {
+    UserConfigPersister persister(user_config_path, 0ms);
+    persister.set("Core", "HeartbeatInterval", 300);
+
+    const auto user_config = read_user_config();
+    EXPECT_EQ(user_config["Core"]["HeartbeatInterval"], 300);
+    EXPECT_EQ(user_config["Internal"]["ChargePointId"], "cp001");
+    // the temporary file has been renamed
+    EXPECT_EQ(count_files(), 1);
+}
+
+TEST_F(UserConfigPersisterTest, CoalescesChangesWithinDelay) {
+    const auto modified = std::filesystem::last_write_time(user_config_path);
+    UserConfigPersister persister(user_config_path, 1h);
+    for (int i = 0; i < 50; i++) {
+        persister.set("Custom", "Key" + std::to_string(i), i);
+    }
+
+    // nothing has been written yet
+    EXPECT_EQ(std::filesystem::last_write_time(user_config_path), modified);
+    EXPECT_FALSE(read_user_config().contains("Custom"));
+
+    EXPECT_TRUE(persister.flush());
+    const auto user_config = read_user_config();
+    for (int i = 0; i < 50; i++) {
+        EXPECT_EQ(user_config["Custom"]["Key" + std::to_string(i)], i);
+    }
+    EXPECT_EQ(user_config["Internal"]["ChargePointId"], "cp001");
+}
+
+TEST_F(UserConfigPersisterTest, WritesAfterDelay) {
+    UserConfigPersister persister(user_config_path, 10ms);
+    persister.set("Core", "MeterValueSampleInterval", 60);
+
+    for (int i = 0; i < 500 and !read_user_config().contains("Core"); i++) {
+        std::this_thread::sleep_for(10ms);
+    }
+    EXPECT_EQ(read_user_config()["Core"]["MeterValueSampleInterval"], 60);
+    EXPECT_EQ(count_files(), 1);
+}
+
+TEST_F(UserConfigPersisterTest, WritesPendingChangesOnDestruction) {
+    {
+        UserConfigPersister persister(user_config_path, 1h);
+        persister.set("Core", "ConnectionTimeOut", 30);
+    }
+    EXPECT_EQ(read_user_config()["Core"]["ConnectionTimeOut"], 30);
+}
+
+TEST_F(UserConfigPersisterTest, CreatesMissingUserConfig) {
+    std::filesystem::remove(user_config_path);
+    UserConfigPersister persister(user_config_path, 0ms);
+    persister.set("Core", "HeartbeatInterval", 60);
+    EXPECT_EQ(read_user_config(), json::parse(R"({"Core":{"HeartbeatInterval":60}})"));
+}
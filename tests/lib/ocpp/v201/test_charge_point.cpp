@@ -492,6 +492,18 @@ TEST_F(ChargePointCommonTestFixtureV201,
     EXPECT_TRUE(callbacks.all_callbacks_valid(device_model));
 }
 
+TEST_F(ChargePointCommonTestFixtureV201,
+       K01FR02_CallbacksValidityChecksIfOptionalMessageQueueReplayProgressCallbackIsNotSetOrNotNull) {
+    configure_callbacks_with_mocks();
+
+    callbacks.message_queue_replay_progress_callback = nullptr;
+    EXPECT_FALSE(callbacks.all_callbacks_valid(device_model));
+
+    testing::MockFunction<void(const ReplayProgress& progress)> message_queue_replay_progress_callback_mock;
+    callbacks.message_queue_replay_progress_callback = message_queue_replay_progress_callback_mock.AsStdFunction();
+    EXPECT_TRUE(callbacks.all_callbacks_valid(device_model));
+}
+
 class ChargePointConstructorTestFixtureV201 : public ChargePointCommonTestFixtureV201 {
 public:
     ChargePointConstructorTestFixtureV201() :
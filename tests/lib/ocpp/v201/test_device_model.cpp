@@ -45,6 +45,22 @@ TEST_F(DeviceModelTest, test_allow_zero) {
     ASSERT_EQ(r, 0);
 }
 
+/// \brief Test that values set through the device model are served from memory and written through to the storage
+TEST_F(DeviceModelTest, test_set_value_write_through) {
+    auto sv_result = dm->set_value(cv.component, cv.variable.value(), ocpp::v201::AttributeEnum::Actual, "20", "test");
+    ASSERT_EQ(sv_result, SetVariableStatusEnum::Accepted);
+    ASSERT_EQ(dm->get_value<int>(cv, ocpp::v201::AttributeEnum::Actual), 20);
+
+    // a second device model instance reads the value back from the storage
+    DeviceModel dm_reloaded(std::make_unique<DeviceModelStorageSqlite>(DEVICE_MODEL_DATABASE));
+    ASSERT_EQ(dm_reloaded.get_value<int>(cv, ocpp::v201::AttributeEnum::Actual), 20);
+
+    // attributes that are not present can not be set and are not served from the cache
+    sv_result = dm->set_value(cv.component, cv.variable.value(), ocpp::v201::AttributeEnum::MaxSet, "20", "test");
+    ASSERT_EQ(sv_result, SetVariableStatusEnum::NotSupportedAttributeType);
+    ASSERT_FALSE(dm->get_optional_value<int>(cv, ocpp::v201::AttributeEnum::MaxSet).has_value());
+}
+
 TEST_F(DeviceModelTest, test_component_as_key_in_map) {
     std::map<Component, int32_t> components_to_ints;
 
@@ -2,6 +2,7 @@
 // Copyright 2020 - 2024 Pionix GmbH and Contributors to EVerest
 
 #include <gtest/gtest.h>
+#include <ocpp/v201/types.hpp>
 #include <ocpp/v201/utils.hpp>
 
 namespace ocpp {
@@ -71,5 +72,37 @@ TEST_F(V201UtilsTest, test_is_critical_security_event) {
     EXPECT_FALSE(ocpp::v201::utils::is_critical(ocpp::security_events::ATTEMPTEDREPLAYATTACKS));
 }
 
+TEST_F(V201UtilsTest, test_string_to_enum_conversions) {
+    using namespace ocpp::v201;
+    namespace conversions = ocpp::v201::conversions;
+    for (const auto type : {IdTokenEnum::Central, IdTokenEnum::eMAID, IdTokenEnum::ISO14443, IdTokenEnum::ISO15693,
+                            IdTokenEnum::KeyCode, IdTokenEnum::Local, IdTokenEnum::MacAddress,
+                            IdTokenEnum::NoAuthorization}) {
+        EXPECT_EQ(conversions::string_to_id_token_enum(conversions::id_token_enum_to_string(type)), type);
+    }
+    EXPECT_EQ(conversions::string_to_messagetype("TransactionEvent"), MessageType::TransactionEvent);
+    EXPECT_EQ(conversions::string_to_messagetype("TransactionEventResponse"), MessageType::TransactionEventResponse);
+
+    // same length and same character at the discriminating position as a known value
+    EXPECT_THROW(conversions::string_to_id_token_enum("ISO14444"), StringToEnumException);
+    EXPECT_THROW(conversions::string_to_id_token_enum(""), StringToEnumException);
+    EXPECT_THROW(conversions::string_to_messagetype("Transactionevent"), StringToEnumException);
+
+    // the string view does not have to be null terminated
+    const std::string buffer = "KeyCodeLocal";
+    EXPECT_EQ(conversions::string_to_id_token_enum(std::string_view(buffer).substr(0, 7)), IdTokenEnum::KeyCode);
+    EXPECT_EQ(conversions::string_to_id_token_enum(std::string_view(buffer).substr(7)), IdTokenEnum::Local);
+}
+
+TEST_F(V201UtilsTest, test_message_type_conversions_round_trip) {
+    using namespace ocpp::v201;
+    namespace conversions = ocpp::v201::conversions;
+    for (int i = 0; i <= static_cast<int>(MessageType::InternalError); i++) {
+        const auto message_type = static_cast<MessageType>(i);
+        EXPECT_EQ(conversions::string_to_messagetype(conversions::messagetype_to_string(message_type)), message_type)
+            << "for enumerator " << i;
+    }
+}
+
 } // namespace common
 } // namespace ocpp